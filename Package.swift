@@ -229,6 +229,8 @@ let package = Package(
         "src/core/ext/transport/chttp2/transport/context_list_entry.h",
         "src/core/ext/transport/chttp2/transport/decode_huff.cc",
         "src/core/ext/transport/chttp2/transport/decode_huff.h",
+        "src/core/ext/transport/chttp2/transport/decode_huff_multi.cc",
+        "src/core/ext/transport/chttp2/transport/decode_huff_multi.h",
         "src/core/ext/transport/chttp2/transport/flow_control.cc",
         "src/core/ext/transport/chttp2/transport/flow_control.h",
         "src/core/ext/transport/chttp2/transport/frame.cc",
@@ -262,6 +264,8 @@ let package = Package(
         "src/core/ext/transport/chttp2/transport/http2_settings.h",
         "src/core/ext/transport/chttp2/transport/huffsyms.cc",
         "src/core/ext/transport/chttp2/transport/huffsyms.h",
+        "src/core/ext/transport/chttp2/transport/keepalive_ticker.cc",
+        "src/core/ext/transport/chttp2/transport/keepalive_ticker.h",
         "src/core/ext/transport/chttp2/transport/internal.h",
         "src/core/ext/transport/chttp2/transport/legacy_frame.h",
         "src/core/ext/transport/chttp2/transport/parsing.cc",
@@ -1138,7 +1142,13 @@ let package = Package(
         "src/core/lib/channel/promise_based_filter.h",
         "src/core/lib/channel/status_util.cc",
         "src/core/lib/channel/status_util.h",
+        "src/core/lib/compression/adaptive_compression.cc",
+        "src/core/lib/compression/adaptive_compression.h",
         "src/core/lib/compression/compression.cc",
+        "src/core/lib/compression/compression_dictionary.cc",
+        "src/core/lib/compression/compression_dictionary.h",
+        "src/core/lib/compression/compression_engine.cc",
+        "src/core/lib/compression/compression_engine.h",
         "src/core/lib/compression/compression_internal.cc",
         "src/core/lib/compression/compression_internal.h",
         "src/core/lib/compression/message_compress.cc",
@@ -1150,6 +1160,8 @@ let package = Package(
         "src/core/lib/debug/trace_impl.h",
         "src/core/lib/event_engine/ares_resolver.cc",
         "src/core/lib/event_engine/ares_resolver.h",
+        "src/core/lib/event_engine/caching_dns_resolver.cc",
+        "src/core/lib/event_engine/caching_dns_resolver.h",
         "src/core/lib/event_engine/cf_engine/cf_engine.cc",
         "src/core/lib/event_engine/cf_engine/cf_engine.h",
         "src/core/lib/event_engine/cf_engine/cfstream_endpoint.cc",
@@ -1168,7 +1180,9 @@ let package = Package(
         "src/core/lib/event_engine/event_engine_context.h",
         "src/core/lib/event_engine/extensions/can_track_errors.h",
         "src/core/lib/event_engine/extensions/chaotic_good_extension.h",
+        "src/core/lib/event_engine/extensions/run_with_priority.h",
         "src/core/lib/event_engine/extensions/supports_fd.h",
+        "src/core/lib/event_engine/extensions/tcp_info.h",
         "src/core/lib/event_engine/extensions/tcp_trace.h",
         "src/core/lib/event_engine/forkable.cc",
         "src/core/lib/event_engine/forkable.h",
@@ -1180,6 +1194,8 @@ let package = Package(
         "src/core/lib/event_engine/posix.h",
         "src/core/lib/event_engine/posix_engine/ev_epoll1_linux.cc",
         "src/core/lib/event_engine/posix_engine/ev_epoll1_linux.h",
+        "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.cc",
+        "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.h",
         "src/core/lib/event_engine/posix_engine/ev_poll_posix.cc",
         "src/core/lib/event_engine/posix_engine/ev_poll_posix.h",
         "src/core/lib/event_engine/posix_engine/event_poller.h",
@@ -1209,6 +1225,8 @@ let package = Package(
         "src/core/lib/event_engine/posix_engine/timer_heap.h",
         "src/core/lib/event_engine/posix_engine/timer_manager.cc",
         "src/core/lib/event_engine/posix_engine/timer_manager.h",
+        "src/core/lib/event_engine/posix_engine/timer_wheel.cc",
+        "src/core/lib/event_engine/posix_engine/timer_wheel.h",
         "src/core/lib/event_engine/posix_engine/traced_buffer_list.cc",
         "src/core/lib/event_engine/posix_engine/traced_buffer_list.h",
         "src/core/lib/event_engine/posix_engine/wakeup_fd_eventfd.cc",
@@ -1256,8 +1274,11 @@ let package = Package(
         "src/core/lib/event_engine/windows/windows_engine.h",
         "src/core/lib/event_engine/windows/windows_listener.cc",
         "src/core/lib/event_engine/windows/windows_listener.h",
+        "src/core/lib/event_engine/work_priority.h",
         "src/core/lib/event_engine/work_queue/basic_work_queue.cc",
         "src/core/lib/event_engine/work_queue/basic_work_queue.h",
+        "src/core/lib/event_engine/work_queue/lock_free_work_queue.cc",
+        "src/core/lib/event_engine/work_queue/lock_free_work_queue.h",
         "src/core/lib/event_engine/work_queue/work_queue.h",
         "src/core/lib/experiments/config.cc",
         "src/core/lib/experiments/config.h",
@@ -1407,6 +1428,7 @@ let package = Package(
         "src/core/lib/promise/detail/join_state.h",
         "src/core/lib/promise/detail/promise_factory.h",
         "src/core/lib/promise/detail/promise_like.h",
+        "src/core/lib/promise/detail/seq_fusion.h",
         "src/core/lib/promise/detail/seq_state.h",
         "src/core/lib/promise/detail/status.h",
         "src/core/lib/promise/exec_ctx_wakeup_scheduler.h",
@@ -1569,6 +1591,8 @@ let package = Package(
         "src/core/lib/security/transport/server_auth_filter.cc",
         "src/core/lib/security/util/json_util.cc",
         "src/core/lib/security/util/json_util.h",
+        "src/core/lib/slice/arena_slice.cc",
+        "src/core/lib/slice/arena_slice.h",
         "src/core/lib/slice/percent_encoding.cc",
         "src/core/lib/slice/percent_encoding.h",
         "src/core/lib/slice/slice.cc",
@@ -1583,6 +1607,8 @@ let package = Package(
         "src/core/lib/surface/byte_buffer_reader.cc",
         "src/core/lib/surface/call.cc",
         "src/core/lib/surface/call.h",
+        "src/core/lib/surface/call_deadline_wheel.cc",
+        "src/core/lib/surface/call_deadline_wheel.h",
         "src/core/lib/surface/call_details.cc",
         "src/core/lib/surface/call_log_batch.cc",
         "src/core/lib/surface/call_test_only.h",
@@ -1643,6 +1669,8 @@ let package = Package(
         "src/core/lib/transport/http2_errors.h",
         "src/core/lib/transport/interception_chain.cc",
         "src/core/lib/transport/interception_chain.h",
+        "src/core/lib/transport/interned_metadata_key.cc",
+        "src/core/lib/transport/interned_metadata_key.h",
         "src/core/lib/transport/message.cc",
         "src/core/lib/transport/message.h",
         "src/core/lib/transport/metadata.cc",
@@ -1652,6 +1680,8 @@ let package = Package(
         "src/core/lib/transport/metadata_compression_traits.h",
         "src/core/lib/transport/metadata_info.cc",
         "src/core/lib/transport/metadata_info.h",
+        "src/core/lib/transport/metadata_template.cc",
+        "src/core/lib/transport/metadata_template.h",
         "src/core/lib/transport/parsed_metadata.cc",
         "src/core/lib/transport/parsed_metadata.h",
         "src/core/lib/transport/simple_slice_based_metadata.h",
@@ -1692,6 +1722,7 @@ let package = Package(
         "src/core/load_balancing/lb_policy_factory.h",
         "src/core/load_balancing/lb_policy_registry.cc",
         "src/core/load_balancing/lb_policy_registry.h",
+        "src/core/load_balancing/least_request/least_request.cc",
         "src/core/load_balancing/oob_backend_metric.cc",
         "src/core/load_balancing/oob_backend_metric.h",
         "src/core/load_balancing/oob_backend_metric_internal.h",
@@ -1700,6 +1731,8 @@ let package = Package(
         "src/core/load_balancing/pick_first/pick_first.cc",
         "src/core/load_balancing/pick_first/pick_first.h",
         "src/core/load_balancing/priority/priority.cc",
+        "src/core/load_balancing/ring_hash/endpoint_hash_table.cc",
+        "src/core/load_balancing/ring_hash/endpoint_hash_table.h",
         "src/core/load_balancing/ring_hash/ring_hash.cc",
         "src/core/load_balancing/ring_hash/ring_hash.h",
         "src/core/load_balancing/rls/rls.cc",
@@ -1709,6 +1742,8 @@ let package = Package(
         "src/core/load_balancing/weighted_round_robin/static_stride_scheduler.cc",
         "src/core/load_balancing/weighted_round_robin/static_stride_scheduler.h",
         "src/core/load_balancing/weighted_round_robin/weighted_round_robin.cc",
+        "src/core/load_balancing/weighted_target/alias_table.cc",
+        "src/core/load_balancing/weighted_target/alias_table.h",
         "src/core/load_balancing/weighted_target/weighted_target.cc",
         "src/core/load_balancing/weighted_target/weighted_target.h",
         "src/core/load_balancing/xds/cds.cc",
@@ -1852,6 +1887,8 @@ let package = Package(
         "src/core/util/backoff.h",
         "src/core/util/bitset.h",
         "src/core/util/chunked_vector.h",
+        "src/core/util/codel.cc",
+        "src/core/util/codel.h",
         "src/core/util/construct_destruct.h",
         "src/core/util/cpp_impl_of.h",
         "src/core/util/crash.cc",
@@ -1867,6 +1904,8 @@ let package = Package(
         "src/core/util/event_log.h",
         "src/core/util/examine_stack.cc",
         "src/core/util/examine_stack.h",
+        "src/core/util/fast_random.cc",
+        "src/core/util/fast_random.h",
         "src/core/util/fork.cc",
         "src/core/util/fork.h",
         "src/core/util/gcp_metadata_query.cc",
@@ -1936,6 +1975,7 @@ let package = Package(
         "src/core/util/posix/thd.cc",
         "src/core/util/posix/time.cc",
         "src/core/util/posix/tmpfile.cc",
+        "src/core/util/printable_ascii.h",
         "src/core/util/random_early_detection.cc",
         "src/core/util/random_early_detection.h",
         "src/core/util/ref_counted.h",
@@ -18,35 +18,65 @@
 
 EXPERIMENT_ENABLES = {
     "backoff_cap_initial_at_max": "backoff_cap_initial_at_max",
+    "call_deadline_wheel": "call_deadline_wheel",
     "call_tracer_in_transport": "call_tracer_in_transport",
     "callv3_client_auth_filter": "callv3_client_auth_filter",
+    "chttp2_coalesce_control_frames": "chttp2_coalesce_control_frames",
+    "chttp2_idle_compaction": "chttp2_idle_compaction",
+    "chttp2_keepalive_ticker": "chttp2_keepalive_ticker",
+    "chttp2_model_based_flow_control": "chttp2_model_based_flow_control",
+    "chttp2_offload_stream_callbacks": "chttp2_offload_stream_callbacks",
+    "chttp2_optimistic_connect": "chttp2_optimistic_connect",
+    "chttp2_weighted_write_scheduling": "chttp2_weighted_write_scheduling",
     "disable_buffer_hint_on_high_memory_pressure": "disable_buffer_hint_on_high_memory_pressure",
     "event_engine_application_callbacks": "event_engine_application_callbacks",
     "event_engine_callback_cq": "event_engine_application_callbacks,event_engine_callback_cq",
     "event_engine_client": "event_engine_client",
     "event_engine_dns": "event_engine_dns",
+    "event_engine_dns_cache": "event_engine_dns_cache",
     "event_engine_dns_non_client_channel": "event_engine_dns_non_client_channel",
     "event_engine_listener": "event_engine_listener",
+    "event_engine_lock_free_work_queue": "event_engine_lock_free_work_queue",
+    "event_engine_shard_local_run": "event_engine_shard_local_run",
+    "event_engine_timer_wheel": "event_engine_timer_wheel",
     "free_large_allocator": "free_large_allocator",
     "keep_alive_ping_timer_batch": "keep_alive_ping_timer_batch",
     "local_connector_secure": "local_connector_secure",
     "max_pings_wo_data_throttle": "max_pings_wo_data_throttle",
+    "memory_pressure_scaled_buffers": "memory_pressure_scaled_buffers",
+    "memory_quota_per_cpu_cache": "memory_quota_per_cpu_cache",
     "monitoring_experiment": "monitoring_experiment",
     "multiping": "multiping",
+    "party_coalesced_wakeups": "party_coalesced_wakeups",
     "pick_first_new": "pick_first_new",
+    "pick_first_prefer_connected_family": "pick_first_prefer_connected_family",
     "posix_ee_skip_grpc_init": "posix_ee_skip_grpc_init",
+    "posix_lean_client_socket_setup": "posix_lean_client_socket_setup",
     "prioritize_finished_requests": "prioritize_finished_requests",
     "promise_based_http2_client_transport": "promise_based_http2_client_transport",
     "promise_based_http2_server_transport": "promise_based_http2_server_transport",
     "promise_based_inproc_transport": "promise_based_inproc_transport",
+    "reclaimer_cost_aware_selection": "reclaimer_cost_aware_selection",
     "retry_in_callv3": "retry_in_callv3",
+    "ring_hash_async_table_build": "ring_hash_async_table_build",
+    "rls_lock_free_cache_reads": "rls_lock_free_cache_reads",
+    "rls_refresh_ahead": "rls_refresh_ahead",
     "rq_fast_reject": "rq_fast_reject",
     "schedule_cancellation_over_write": "schedule_cancellation_over_write",
+    "secure_handshake_executor": "secure_handshake_executor",
     "server_listener": "server_listener",
+    "shared_ssl_client_context": "shared_ssl_client_context",
+    "skip_incompressible_methods": "skip_incompressible_methods",
+    "ssl_zero_copy_protector": "ssl_zero_copy_protector",
     "tcp_frame_size_tuning": "tcp_frame_size_tuning",
     "tcp_rcv_lowat": "tcp_rcv_lowat",
+    "tls_kernel_write_offload": "tls_kernel_write_offload",
     "trace_record_callops": "trace_record_callops",
+    "transport_message_size_check": "transport_message_size_check",
     "unconstrained_max_quota_buffer_size": "unconstrained_max_quota_buffer_size",
+    "work_serializer_batched_drain": "work_serializer_batched_drain",
+    "wrr_shared_endpoint_weights": "wrr_shared_endpoint_weights",
+    "wrr_skip_unchanged_weights": "wrr_skip_unchanged_weights",
 }
 
 EXPERIMENT_POLLERS = [
@@ -62,28 +92,57 @@ EXPERIMENTS = {
         },
         "off": {
             "core_end2end_test": [
+                "call_deadline_wheel",
                 "callv3_client_auth_filter",
+                "chttp2_idle_compaction",
+                "chttp2_keepalive_ticker",
+                "chttp2_optimistic_connect",
                 "event_engine_dns_non_client_channel",
                 "local_connector_secure",
+                "party_coalesced_wakeups",
                 "posix_ee_skip_grpc_init",
                 "retry_in_callv3",
+                "secure_handshake_executor",
+                "shared_ssl_client_context",
+                "ssl_zero_copy_protector",
+                "tls_kernel_write_offload",
+                "transport_message_size_check",
             ],
             "cpp_end2end_test": [
                 "posix_ee_skip_grpc_init",
+                "rls_lock_free_cache_reads",
             ],
             "endpoint_test": [
+                "memory_pressure_scaled_buffers",
                 "tcp_frame_size_tuning",
                 "tcp_rcv_lowat",
             ],
+            "event_engine_client_test": [
+                "event_engine_shard_local_run",
+            ],
             "flow_control_test": [
+                "memory_pressure_scaled_buffers",
                 "multiping",
                 "tcp_frame_size_tuning",
                 "tcp_rcv_lowat",
             ],
+            "lb_unit_test": [
+                "wrr_shared_endpoint_weights",
+                "wrr_skip_unchanged_weights",
+            ],
+            "promise_test": [
+                "party_coalesced_wakeups",
+            ],
             "resource_quota_test": [
                 "free_large_allocator",
+                "memory_pressure_scaled_buffers",
+                "memory_quota_per_cpu_cache",
+                "reclaimer_cost_aware_selection",
                 "unconstrained_max_quota_buffer_size",
             ],
+            "work_serializer_test": [
+                "work_serializer_batched_drain",
+            ],
         },
         "on": {
             "cancel_ares_query_test": [
@@ -120,28 +179,57 @@ EXPERIMENTS = {
         },
         "off": {
             "core_end2end_test": [
+                "call_deadline_wheel",
                 "callv3_client_auth_filter",
+                "chttp2_idle_compaction",
+                "chttp2_keepalive_ticker",
+                "chttp2_optimistic_connect",
                 "event_engine_dns_non_client_channel",
                 "local_connector_secure",
+                "party_coalesced_wakeups",
                 "posix_ee_skip_grpc_init",
                 "retry_in_callv3",
+                "secure_handshake_executor",
+                "shared_ssl_client_context",
+                "ssl_zero_copy_protector",
+                "tls_kernel_write_offload",
+                "transport_message_size_check",
             ],
             "cpp_end2end_test": [
                 "posix_ee_skip_grpc_init",
+                "rls_lock_free_cache_reads",
             ],
             "endpoint_test": [
+                "memory_pressure_scaled_buffers",
                 "tcp_frame_size_tuning",
                 "tcp_rcv_lowat",
             ],
+            "event_engine_client_test": [
+                "event_engine_shard_local_run",
+            ],
             "flow_control_test": [
+                "memory_pressure_scaled_buffers",
                 "multiping",
                 "tcp_frame_size_tuning",
                 "tcp_rcv_lowat",
             ],
+            "lb_unit_test": [
+                "wrr_shared_endpoint_weights",
+                "wrr_skip_unchanged_weights",
+            ],
+            "promise_test": [
+                "party_coalesced_wakeups",
+            ],
             "resource_quota_test": [
                 "free_large_allocator",
+                "memory_pressure_scaled_buffers",
+                "memory_quota_per_cpu_cache",
+                "reclaimer_cost_aware_selection",
                 "unconstrained_max_quota_buffer_size",
             ],
+            "work_serializer_test": [
+                "work_serializer_batched_drain",
+            ],
         },
         "on": {
             "core_end2end_test": [
@@ -164,28 +252,57 @@ EXPERIMENTS = {
         },
         "off": {
             "core_end2end_test": [
+                "call_deadline_wheel",
                 "callv3_client_auth_filter",
+                "chttp2_idle_compaction",
+                "chttp2_keepalive_ticker",
+                "chttp2_optimistic_connect",
                 "event_engine_dns_non_client_channel",
                 "local_connector_secure",
+                "party_coalesced_wakeups",
                 "posix_ee_skip_grpc_init",
                 "retry_in_callv3",
+                "secure_handshake_executor",
+                "shared_ssl_client_context",
+                "ssl_zero_copy_protector",
+                "tls_kernel_write_offload",
+                "transport_message_size_check",
             ],
             "cpp_end2end_test": [
                 "posix_ee_skip_grpc_init",
+                "rls_lock_free_cache_reads",
             ],
             "endpoint_test": [
+                "memory_pressure_scaled_buffers",
                 "tcp_frame_size_tuning",
                 "tcp_rcv_lowat",
             ],
+            "event_engine_client_test": [
+                "event_engine_shard_local_run",
+            ],
             "flow_control_test": [
+                "memory_pressure_scaled_buffers",
                 "multiping",
                 "tcp_frame_size_tuning",
                 "tcp_rcv_lowat",
             ],
+            "lb_unit_test": [
+                "wrr_shared_endpoint_weights",
+                "wrr_skip_unchanged_weights",
+            ],
+            "promise_test": [
+                "party_coalesced_wakeups",
+            ],
             "resource_quota_test": [
                 "free_large_allocator",
+                "memory_pressure_scaled_buffers",
+                "memory_quota_per_cpu_cache",
+                "reclaimer_cost_aware_selection",
                 "unconstrained_max_quota_buffer_size",
             ],
+            "work_serializer_test": [
+                "work_serializer_batched_drain",
+            ],
         },
         "on": {
             "cancel_ares_query_test": [
@@ -0,0 +1,29 @@
+# Copyright 2026 gRPC authors.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+if(TARGET zstd)
+  message(STATUS "Found zstd already?")
+  return()
+endif()
+
+find_package(PkgConfig)
+pkg_check_modules(ZSTD libzstd>=1.4.0)
+
+if(ZSTD_FOUND)
+  set(zstd_FOUND "${ZSTD_FOUND}")
+  add_library(zstd INTERFACE IMPORTED)
+  set_target_properties(zstd PROPERTIES
+    INTERFACE_INCLUDE_DIRECTORIES "${ZSTD_INCLUDE_DIRS}")
+  message(STATUS "Found zstd via pkg-config.")
+endif()
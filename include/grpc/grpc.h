@@ -122,6 +122,19 @@ GRPCAPI grpc_event grpc_completion_queue_next(grpc_completion_queue* cq,
                                               gpr_timespec deadline,
                                               void* reserved);
 
+/** Like grpc_completion_queue_next, but also returns up to max_events - 1
+    further events that are already queued, without waiting for them.
+
+    Fills events[0, n) and returns n, which is at least 1. An event of type
+    GRPC_QUEUE_TIMEOUT or GRPC_QUEUE_SHUTDOWN is always the only one returned.
+    cq must have completion type GRPC_CQ_NEXT, and max_events must be
+    positive. */
+GRPCAPI size_t grpc_completion_queue_next_batch(grpc_completion_queue* cq,
+                                                grpc_event* events,
+                                                size_t max_events,
+                                                gpr_timespec deadline,
+                                                void* reserved);
+
 /** Blocks until an event with tag 'tag' is available, the completion queue is
     being shutdown or deadline is reached.
 
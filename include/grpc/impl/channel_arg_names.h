@@ -30,6 +30,11 @@
 /** If non-zero, call metric recording is enabled. */
 #define GRPC_ARG_SERVER_CALL_METRIC_RECORDING \
   "grpc.server_call_metric_recording"
+/** If non-zero, the C++ sync server sizes its thread pool from the measured
+    wall and CPU time of its handlers, rather than growing it whenever all of
+    its polling threads are busy, up to the thread quota. Experimental. */
+#define GRPC_ARG_EXPERIMENTAL_SYNC_SERVER_ADAPTIVE_THREADS \
+  "grpc.experimental.sync_server_adaptive_threads"
 /** Request that optional features default to off (regardless of what they
     usually default to) - to enable tight control over what gets enabled */
 #define GRPC_ARG_MINIMAL_STACK "grpc.minimal_stack"
@@ -67,6 +72,23 @@
    application will see the compressed message in the byte buffer. */
 #define GRPC_ARG_ENABLE_PER_MESSAGE_DECOMPRESSION \
   "grpc.per_message_decompression"
+/** Compression level used for messages compressed with zstd. Int valued, in
+   the range accepted by the zstd library; 0 selects the library default. */
+#define GRPC_ARG_ZSTD_COMPRESSION_LEVEL "grpc.zstd_compression_level"
+/** Experimental Arg. If non-zero, compression and decompression contexts are
+   kept for the lifetime of each call and reset, rather than recreated, for
+   every message on it. Trades per-call memory for lower per-message CPU on
+   long streams; the wire format is unchanged. Defaults to 0. */
+#define GRPC_ARG_EXPERIMENTAL_REUSE_COMPRESSION_CONTEXTS \
+  "grpc.experimental.reuse_compression_contexts"
+/** Experimental Arg. If non-zero, messages of 2MB or more are compressed as
+   1MB chunks in parallel on the channel's EventEngine, and zstd messages
+   compressed that way are also decompressed in parallel. Deflate and gzip
+   output stays a single standard stream; zstd output is a sequence of
+   frames, which receivers built before multi-frame support reject.
+   Defaults to 0. */
+#define GRPC_ARG_EXPERIMENTAL_PARALLEL_COMPRESSION \
+  "grpc.experimental.parallel_compression"
 /** Initial stream ID for http2 transports. Int valued. */
 #define GRPC_ARG_HTTP2_INITIAL_SEQUENCE_NUMBER \
   "grpc.http2.initial_sequence_number"
@@ -81,6 +103,26 @@
 /** How much memory to use for hpack encoding. Int valued, bytes. */
 #define GRPC_ARG_HTTP2_HPACK_TABLE_SIZE_ENCODER \
   "grpc.http2.hpack_table_size.encoder"
+/** If non-zero, the hpack encoder tracks how often the values of custom
+    (application defined) headers repeat, and adds repeating values to the
+    hpack table instead of always sending custom headers as literals. Keys
+    whose values keep changing continue to be sent as literals. Boolean,
+    default false. */
+#define GRPC_ARG_HTTP2_HPACK_ADAPTIVE_INDEXING \
+  "grpc.http2.hpack_adaptive_indexing"
+/** If non-zero, received metadata that is sent uncompressed and not added to
+    the hpack table references the incoming frame buffers instead of being
+    copied. Saves an allocation and copy per header (useful for proxies that
+    forward headers unchanged), but received metadata keeps the buffers
+    alive. Boolean, default false. */
+#define GRPC_ARG_HTTP2_ZERO_COPY_METADATA "grpc.http2.zero_copy_metadata"
+/** Received messages of at most this many bytes are copied into a single
+    slice allocated from the call's arena, instead of keeping references to
+    the transport's read buffers. Small payloads then cost no allocation of
+    their own, but their memory is only reclaimed with the call. Int, default
+    0 (disabled). */
+#define GRPC_ARG_HTTP2_ARENA_PAYLOAD_MAX_BYTES \
+  "grpc.http2.arena_payload_max_bytes"
 /** How big a frame are we willing to receive via HTTP2.
     Min 16384, max 16777215. Larger values give lower CPU usage for large
     messages, but more head of line blocking for small messages. */
@@ -245,6 +287,13 @@
   "grpc.experimental.tcp_min_read_chunk_size"
 #define GRPC_ARG_TCP_MAX_READ_CHUNK_SIZE \
   "grpc.experimental.tcp_max_read_chunk_size"
+/* TCP Fast Open on client connects: zero is disabled, non-zero is enabled.
+   By default, it is disabled. Where the platform supports it, and once the
+   client holds a Fast Open cookie for the server, the connection's first
+   write goes out with its SYN, saving a round trip on connection setup.
+   Connect errors are then only seen on that first write. */
+#define GRPC_ARG_TCP_FAST_OPEN_CONNECT \
+  "grpc.experimental.tcp_fast_open_connect"
 /* TCP TX Zerocopy enable state: zero is disabled, non-zero is enabled. By
    default, it is disabled. */
 #define GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED \
@@ -259,6 +308,27 @@
    issued by the tcp_write(). By default, this is set to 4. */
 #define GRPC_ARG_TCP_TX_ZEROCOPY_MAX_SIMULT_SENDS \
   "grpc.experimental.tcp_tx_zerocopy_max_simultaneous_sends"
+/* TCP RX Zerocopy enable state: zero is disabled, non-zero is enabled. When
+   enabled, large reads map received pages into slices with
+   TCP_ZEROCOPY_RECEIVE instead of copying them. Readers must not write into
+   the received slices. By default, it is disabled. */
+#define GRPC_ARG_TCP_RX_ZEROCOPY_ENABLED \
+  "grpc.experimental.tcp_rx_zerocopy_enabled"
+/* TCP RX Zerocopy receive threshold: only zerocopy if >= this many bytes are
+   expected. Rounded down to the page size. By default, this is set to 64KB. */
+#define GRPC_ARG_TCP_RX_ZEROCOPY_RECEIVE_BYTES_THRESHOLD \
+  "grpc.experimental.tcp_rx_zerocopy_receive_bytes_threshold"
+/* TCP write coalescing delay in microseconds. When positive, writes smaller
+   than GRPC_ARG_TCP_WRITE_COALESCING_MAX_BYTES are held for up to this long
+   so that several of them leave the endpoint in a single sendmsg. Such writes
+   complete before their bytes reach the socket, and a failure to send them is
+   reported by the next write. By default, this is 0 (disabled). */
+#define GRPC_ARG_TCP_WRITE_COALESCING_DELAY_US \
+  "grpc.experimental.tcp_write_coalescing_delay_us"
+/* TCP write coalescing size limit: held bytes are flushed as soon as they
+   reach this many. By default, this is set to 16KB. */
+#define GRPC_ARG_TCP_WRITE_COALESCING_MAX_BYTES \
+  "grpc.experimental.tcp_write_coalescing_max_bytes"
 /* Overrides the TCP socket receive buffer size, SO_RCVBUF. */
 #define GRPC_ARG_TCP_RECEIVE_BUFFER_SIZE "grpc.tcp_receive_buffer_size"
 /* Timeout in milliseconds to use for calls to the grpclb load balancer.
@@ -290,6 +360,13 @@
    over to the next priority. Default value is 10 seconds. */
 #define GRPC_ARG_PRIORITY_FAILOVER_TIMEOUT_MS \
   "grpc.priority_failover_timeout_ms"
+/* Number of priorities below the one in use that the priority LB policy keeps
+   connected as warm standbys, so that failing over to them does not wait for
+   connection setup or the failover timeout. Each standby holds its own
+   connections, so this bounds the cost of idle connections. Default value is
+   0, which only creates lower priorities on failover. */
+#define GRPC_ARG_PRIORITY_WARM_STANDBY_COUNT \
+  "grpc.priority_warm_standby_count"
 /** If non-zero, grpc server's cronet compression workaround will be enabled */
 #define GRPC_ARG_WORKAROUND_CRONET_COMPRESSION \
   "grpc.workaround.cronet_compression"
@@ -322,6 +399,13 @@
 #define GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING "grpc.experimental.enable_hedging"
 /** Per-RPC retry buffer size, in bytes. Default is 256 KiB. */
 #define GRPC_ARG_PER_RPC_RETRY_BUFFER_SIZE "grpc.per_rpc_retry_buffer_size"
+/** Per-RPC retry buffer size, in bytes, up to which an RPC that has
+    outgrown GRPC_ARG_PER_RPC_RETRY_BUFFER_SIZE stays retryable for as long
+    as its resource quota is not under memory pressure.  Default is
+    GRPC_ARG_PER_RPC_RETRY_BUFFER_SIZE, so that RPCs commit as soon as they
+    outgrow it. */
+#define GRPC_ARG_EXPERIMENTAL_PER_RPC_RETRY_BUFFER_MAX_SIZE \
+  "grpc.experimental.per_rpc_retry_buffer_max_size"
 /** Channel arg that carries the bridged objective c object for custom metrics
  * logging filter. */
 #define GRPC_ARG_MOBILE_LOG_CONTEXT "grpc.mobile_log_context"
@@ -368,6 +452,42 @@
 /** If set, uses a local subchannel pool within the channel. Otherwise, uses the
  * global subchannel pool. */
 #define GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL "grpc.use_local_subchannel_pool"
+/** If non-zero, channels share subchannels even when their channel args
+ * differ, as long as they differ only in args that do not affect the
+ * connection: args used only by the client channel (such as the service
+ * config and the LB policy name), and those listed in
+ * GRPC_ARG_SUBCHANNEL_COALESCING_IGNORED_ARGS. Has no effect with
+ * GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL. Defaults to 0. */
+#define GRPC_ARG_SUBCHANNEL_COALESCING "grpc.subchannel_coalescing"
+/** With GRPC_ARG_SUBCHANNEL_COALESCING: a comma-separated list of further
+ * channel arg names that the application knows do not affect the connection,
+ * for example args read only by its own client filters. */
+#define GRPC_ARG_SUBCHANNEL_COALESCING_IGNORED_ARGS \
+  "grpc.subchannel_coalescing_ignored_args"
+/** With GRPC_ARG_SUBCHANNEL_COALESCING: how many subchannels per address the
+ * coalesced channels spread over. Each channel is assigned to one of them in
+ * turn, so that many channels multiplexing their streams onto one connection
+ * do not all queue behind its MAX_CONCURRENT_STREAMS limit. Defaults to 1. */
+#define GRPC_ARG_SUBCHANNEL_COALESCING_MAX_CONNECTIONS \
+  "grpc.subchannel_coalescing_max_connections"
+/** How many connections a subchannel may open to its address. Once every
+ * open connection has as many calls as the peer's MAX_CONCURRENT_STREAMS
+ * allows, the subchannel opens another one, and it spreads calls across its
+ * connections by how many more streams each can take. Only the legacy
+ * (filter stack) call path tracks stream capacity. Defaults to 1. */
+#define GRPC_ARG_MAX_CONNECTIONS_PER_SUBCHANNEL \
+  "grpc.max_connections_per_subchannel"
+/** Limits how often subchannels in this process start connection attempts to
+ * any one address, across all channels, so that a restarted backend is not
+ * hit by every client at once. Attempts beyond the limit are delayed rather
+ * than failed. 0 (the default) means no limit. */
+#define GRPC_ARG_SUBCHANNEL_CONNECT_ATTEMPTS_PER_SECOND \
+  "grpc.subchannel_connect_attempts_per_second"
+/** With GRPC_ARG_SUBCHANNEL_CONNECT_ATTEMPTS_PER_SECOND: how many attempts
+ * to an address may start at once before the limit applies. Defaults to
+ * 16. */
+#define GRPC_ARG_SUBCHANNEL_CONNECT_ATTEMPTS_BURST \
+  "grpc.subchannel_connect_attempts_burst"
 /** gRPC Objective-C channel pooling domain string. */
 #define GRPC_ARG_CHANNEL_POOL_DOMAIN "grpc.channel_pooling_domain"
 /** gRPC Objective-C channel pooling id. */
@@ -398,6 +518,11 @@
  * If unspecified, it is unlimited */
 #define GRPC_ARG_MAX_ALLOWED_INCOMING_CONNECTIONS \
   "grpc.max_allowed_incoming_connections"
+/** Configure the max rate, in connections per second, at which the server
+ * accepts incoming connections. Connections above the rate are closed before
+ * the handshake. If unspecified, it is unlimited */
+#define GRPC_ARG_MAX_INCOMING_CONNECTION_RATE \
+  "grpc.max_incoming_connection_rate"
 /** Configure per-channel or per-server stats plugins. */
 #define GRPC_ARG_EXPERIMENTAL_STATS_PLUGINS "grpc.experimental.stats_plugins"
 /** If non-zero, allow security frames to be sent and received. */
@@ -61,6 +61,9 @@ typedef enum {
   GRPC_COMPRESS_NONE = 0,
   GRPC_COMPRESS_DEFLATE,
   GRPC_COMPRESS_GZIP,
+  /** Only usable when gRPC is built with zstd support (GRPC_HAVE_ZSTD);
+   * otherwise it is never advertised and messages are sent uncompressed. */
+  GRPC_COMPRESS_ZSTD,
   /* TODO(ctiller): snappy */
   GRPC_COMPRESS_ALGORITHMS_COUNT
 } grpc_compression_algorithm;
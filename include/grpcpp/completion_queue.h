@@ -201,6 +201,29 @@ class CompletionQueue : private grpc::internal::GrpcLibrary {
     return AsyncNextInternal(tag, ok, deadline_tp.raw_time());
   }
 
+  /// EXPERIMENTAL
+  /// Read up to \a max_events events from the queue: blocks up to \a deadline
+  /// (or the queue's shutdown) for the first, as \a AsyncNext does, then also
+  /// takes events that are already queued, without waiting for them.
+  ///
+  /// \param[out] tags Upon success, the first \a *num_events entries are
+  ///        updated to point to the events' tags.
+  /// \param[out] oks Upon success, the first \a *num_events entries are
+  ///        updated as \a ok is by \a AsyncNext.
+  /// \param[in] max_events The size of \a tags and \a oks; must be positive.
+  /// \param[out] num_events Upon success, the number of events read.
+  /// \param[in] deadline How long to block in wait for the first event.
+  ///
+  /// \return The type of event read. \a *num_events is positive if it is
+  ///         GOT_EVENT, and zero otherwise.
+  template <typename T>
+  NextStatus AsyncNextBatch(void** tags, bool* oks, size_t max_events,
+                            size_t* num_events, const T& deadline) {
+    grpc::TimePoint<T> deadline_tp(deadline);
+    return AsyncNextBatchInternal(tags, oks, max_events, num_events,
+                                  deadline_tp.raw_time());
+  }
+
   /// EXPERIMENTAL
   /// First executes \a F, then reads from the queue, blocking up to
   /// \a deadline (or the queue's shutdown).
@@ -247,7 +270,16 @@ class CompletionQueue : private grpc::internal::GrpcLibrary {
 
  protected:
   /// Private constructor of CompletionQueue only visible to friend classes
-  explicit CompletionQueue(const grpc_completion_queue_attributes& attributes) {
+  explicit CompletionQueue(const grpc_completion_queue_attributes& attributes)
+      : CompletionQueue(attributes, /*call_grpc_init=*/true) {}
+
+  /// As above, but only calls grpc_init() if \a call_grpc_init is true. A
+  /// caller that already keeps the library initialized for the queue's whole
+  /// lifetime (e.g. through the channel it makes calls on) can pass false to
+  /// skip the global init lock.
+  CompletionQueue(const grpc_completion_queue_attributes& attributes,
+                  bool call_grpc_init)
+      : GrpcLibrary(call_grpc_init) {
     cq_ = grpc_completion_queue_create(
         grpc_completion_queue_factory_lookup(&attributes), &attributes,
         nullptr);
@@ -314,6 +346,8 @@ class CompletionQueue : private grpc::internal::GrpcLibrary {
   };
 
   NextStatus AsyncNextInternal(void** tag, bool* ok, gpr_timespec deadline);
+  NextStatus AsyncNextBatchInternal(void** tags, bool* oks, size_t max_events,
+                                    size_t* num_events, gpr_timespec deadline);
 
   /// Wraps \a grpc_completion_queue_pluck.
   /// \warning Must not be mixed with calls to \a Next.
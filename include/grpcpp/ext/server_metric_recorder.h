@@ -21,7 +21,9 @@
 
 #include <grpcpp/impl/sync.h>
 #include <grpcpp/support/string_ref.h>
+#include <stdint.h>
 
+#include <atomic>
 #include <functional>
 #include <map>
 #include <memory>
@@ -109,10 +111,19 @@ class ServerMetricRecorder {
   // Returned metric data is guaranteed to be identical between two calls if the
   // sequence numbers match.
   std::shared_ptr<const BackendMetricDataState> GetMetricsIfChanged() const;
+  // Returns the current metric state from a per-thread snapshot, only taking
+  // mu_ when the state has changed since this thread last looked. The
+  // reference stays valid until the next call on the same thread.
+  const BackendMetricDataState& GetMetricsForCurrentThread() const;
 
+  // Distinguishes recorders in the per-thread snapshots.
+  const uint64_t id_;
   mutable grpc::internal::Mutex mu_;
   std::shared_ptr<const BackendMetricDataState> metric_state_
       ABSL_GUARDED_BY(mu_);
+  // Mirrors metric_state_->sequence_number so readers can check whether their
+  // snapshot is current without taking mu_.
+  std::atomic<uint64_t> sequence_number_{0};
 };
 
 }  // namespace experimental
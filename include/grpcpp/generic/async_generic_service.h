@@ -63,6 +63,14 @@ class GenericServerContext final : public ServerContext {
 //
 // When tag is retrieved from cq->Next(), context.method() can be used to look
 // at the method and the RPC can be handled accordingly.
+//
+// When proxying, a ByteBuffer read from the incoming stream can be passed
+// unchanged to the outgoing stream's Write(): ByteBuffer copies share the
+// underlying slices, so the payload is forwarded without being copied.
+// Keeping a single Read() or Write() outstanding per direction, and issuing
+// the next Read() only once the matching Write() completes, bounds what the
+// proxy buffers to one message and lets HTTP/2 flow control push back on the
+// sender end to end.
 class AsyncGenericService final {
  public:
   AsyncGenericService() : server_(nullptr) {}
@@ -57,9 +57,12 @@ class BlockingUnaryCallImpl {
   BlockingUnaryCallImpl(ChannelInterface* channel, const RpcMethod& method,
                         grpc::ClientContext* context,
                         const InputMessage& request, OutputMessage* result) {
-    grpc::CompletionQueue cq(grpc_completion_queue_attributes{
-        GRPC_CQ_CURRENT_VERSION, GRPC_CQ_PLUCK, GRPC_CQ_DEFAULT_POLLING,
-        nullptr});  // Pluckable completion queue
+    // Pluckable completion queue. The channel keeps the library initialized
+    // for the duration of the call, so the queue doesn't take another ref.
+    grpc::CompletionQueue cq(
+        grpc_completion_queue_attributes{GRPC_CQ_CURRENT_VERSION, GRPC_CQ_PLUCK,
+                                         GRPC_CQ_DEFAULT_POLLING, nullptr},
+        /*call_grpc_init=*/false);
     grpc::internal::Call call(channel->CreateCall(method, context, &cq));
     CallOpSet<CallOpSendInitialMetadata, CallOpSendMessage,
               CallOpRecvInitialMetadata, CallOpRecvMessage<OutputMessage>,
@@ -35,6 +35,11 @@
 
 namespace grpc {
 
+// Messages up to this size are serialized in a single pass into one exactly
+// sized slice. Larger ones go through the ProtoBufferWriter, which may share
+// the memory of large absl::Cord fields rather than copying them.
+const int kProtoSerializeSingleSliceMaxLength = 64 * 1024;
+
 // ProtoBufferWriter must be a subclass of ::protobuf::io::ZeroCopyOutputStream.
 template <class ProtoBufferWriter, class T>
 Status GenericSerialize(const grpc::protobuf::MessageLite& msg, ByteBuffer* bb,
@@ -45,7 +50,7 @@ Status GenericSerialize(const grpc::protobuf::MessageLite& msg, ByteBuffer* bb,
                 "::protobuf::io::ZeroCopyOutputStream");
   *own_buffer = true;
   int byte_size = static_cast<int>(msg.ByteSizeLong());
-  if (static_cast<size_t>(byte_size) <= GRPC_SLICE_INLINED_SIZE) {
+  if (byte_size <= kProtoSerializeSingleSliceMaxLength) {
     Slice slice(byte_size);
     // We serialize directly into the allocated slices memory
     ABSL_CHECK(slice.end() == msg.SerializeWithCachedSizesToArray(
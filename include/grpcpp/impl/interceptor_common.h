@@ -26,7 +26,6 @@
 #include <grpcpp/support/client_interceptor.h>
 #include <grpcpp/support/server_interceptor.h>
 
-#include <array>
 #include <functional>
 
 #include "absl/log/absl_check.h"
@@ -37,20 +36,13 @@ namespace internal {
 class InterceptorBatchMethodsImpl
     : public experimental::InterceptorBatchMethods {
  public:
-  InterceptorBatchMethodsImpl() {
-    for (auto i = static_cast<experimental::InterceptionHookPoints>(0);
-         i < experimental::InterceptionHookPoints::NUM_INTERCEPTION_HOOKS;
-         i = static_cast<experimental::InterceptionHookPoints>(
-             static_cast<size_t>(i) + 1)) {
-      hooks_[static_cast<size_t>(i)] = false;
-    }
-  }
+  InterceptorBatchMethodsImpl() {}
 
   ~InterceptorBatchMethodsImpl() override {}
 
   bool QueryInterceptionHookPoint(
       experimental::InterceptionHookPoints type) override {
-    return hooks_[static_cast<size_t>(type)];
+    return (hooks_ & experimental::InterceptionHookPointBit(type)) != 0;
   }
 
   void Proceed() override {
@@ -77,7 +69,7 @@ class InterceptorBatchMethodsImpl
   }
 
   void AddInterceptionHookPoint(experimental::InterceptionHookPoints type) {
-    hooks_[static_cast<size_t>(type)] = true;
+    hooks_ |= experimental::InterceptionHookPointBit(type);
   }
 
   ByteBuffer* GetSerializedSendMessage() override {
@@ -130,8 +122,8 @@ class InterceptorBatchMethodsImpl
   Status* GetRecvStatus() override { return recv_status_; }
 
   void FailHijackedSendMessage() override {
-    ABSL_CHECK(hooks_[static_cast<size_t>(
-        experimental::InterceptionHookPoints::PRE_SEND_MESSAGE)]);
+    ABSL_CHECK(QueryInterceptionHookPoint(
+        experimental::InterceptionHookPoints::PRE_SEND_MESSAGE));
     *fail_send_message_ = true;
   }
 
@@ -193,8 +185,8 @@ class InterceptorBatchMethodsImpl
   }
 
   void FailHijackedRecvMessage() override {
-    ABSL_CHECK(hooks_[static_cast<size_t>(
-        experimental::InterceptionHookPoints::PRE_RECV_MESSAGE)]);
+    ABSL_CHECK(QueryInterceptionHookPoint(
+        experimental::InterceptionHookPoints::PRE_RECV_MESSAGE));
     *hijacked_recv_message_failed_ = true;
   }
 
@@ -285,7 +277,7 @@ class InterceptorBatchMethodsImpl
         current_interceptor_index_ = rpc_info->interceptors_.size() - 1;
       }
     }
-    rpc_info->RunInterceptor(this, current_interceptor_index_);
+    RunCurrentInterceptor(rpc_info);
   }
 
   void RunServerInterceptors() {
@@ -295,7 +287,7 @@ class InterceptorBatchMethodsImpl
     } else {
       current_interceptor_index_ = rpc_info->interceptors_.size() - 1;
     }
-    rpc_info->RunInterceptor(this, current_interceptor_index_);
+    RunCurrentInterceptor(rpc_info);
   }
 
   void ProceedClient() {
@@ -319,7 +311,7 @@ class InterceptorBatchMethodsImpl
           // This is a hijacked RPC and we are done with hijacking
           ops_->ContinueFillOpsAfterInterception();
         } else {
-          rpc_info->RunInterceptor(this, current_interceptor_index_);
+          RunCurrentInterceptor(rpc_info);
         }
       } else {
         // we are done running all the interceptors without any hijacking
@@ -330,7 +322,7 @@ class InterceptorBatchMethodsImpl
       if (current_interceptor_index_ > 0) {
         // Continue running interceptors
         current_interceptor_index_--;
-        rpc_info->RunInterceptor(this, current_interceptor_index_);
+        RunCurrentInterceptor(rpc_info);
       } else {
         // we are done running all the interceptors without any hijacking
         ops_->ContinueFinalizeResultAfterInterception();
@@ -343,7 +335,7 @@ class InterceptorBatchMethodsImpl
     if (!reverse_) {
       current_interceptor_index_++;
       if (current_interceptor_index_ < rpc_info->interceptors_.size()) {
-        return rpc_info->RunInterceptor(this, current_interceptor_index_);
+        return RunCurrentInterceptor(rpc_info);
       } else if (ops_) {
         return ops_->ContinueFillOpsAfterInterception();
       }
@@ -352,7 +344,7 @@ class InterceptorBatchMethodsImpl
       if (current_interceptor_index_ > 0) {
         // Continue running interceptors
         current_interceptor_index_--;
-        return rpc_info->RunInterceptor(this, current_interceptor_index_);
+        return RunCurrentInterceptor(rpc_info);
       } else if (ops_) {
         return ops_->ContinueFinalizeResultAfterInterception();
       }
@@ -361,19 +353,22 @@ class InterceptorBatchMethodsImpl
     callback_();
   }
 
-  void ClearHookPoints() {
-    for (auto i = static_cast<experimental::InterceptionHookPoints>(0);
-         i < experimental::InterceptionHookPoints::NUM_INTERCEPTION_HOOKS;
-         i = static_cast<experimental::InterceptionHookPoints>(
-             static_cast<size_t>(i) + 1)) {
-      hooks_[static_cast<size_t>(i)] = false;
+  // Runs the interceptor at current_interceptor_index_, or moves straight
+  // past it if it uses none of the hook points in this batch.
+  template <typename RpcInfo>
+  void RunCurrentInterceptor(RpcInfo* rpc_info) {
+    if (hooks_ != 0 &&
+        (rpc_info->interceptors_[current_interceptor_index_]
+             ->UsedHookPoints() &
+         hooks_) == 0) {
+      return Proceed();
     }
+    rpc_info->RunInterceptor(this, current_interceptor_index_);
   }
 
-  std::array<bool,
-             static_cast<size_t>(
-                 experimental::InterceptionHookPoints::NUM_INTERCEPTION_HOOKS)>
-      hooks_;
+  void ClearHookPoints() { hooks_ = 0; }
+
+  experimental::InterceptionHookPointSet hooks_ = 0;
 
   size_t current_interceptor_index_ = 0;  // Current iterator
   bool reverse_ = false;
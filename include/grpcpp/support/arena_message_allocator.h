@@ -0,0 +1,126 @@
+//
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPCPP_SUPPORT_ARENA_MESSAGE_ALLOCATOR_H
+#define GRPCPP_SUPPORT_ARENA_MESSAGE_ALLOCATOR_H
+
+#include <grpcpp/impl/codegen/config_protobuf.h>
+#include <grpcpp/impl/sync.h>
+#include <grpcpp/support/message_allocator.h>
+
+#include <stddef.h>
+
+#include <memory>
+#include <vector>
+
+namespace grpc {
+namespace experimental {
+
+/// A MessageAllocator that creates the request and response of each call on
+/// a protobuf arena, and pools the arenas across calls. Each arena starts
+/// with a block of initial_block_size bytes that it keeps when it is reset
+/// for the next call, so that calls whose messages fit in that block do not
+/// allocate them at all. Up to max_pooled_arenas idle arenas are kept.
+///
+/// Set it with the generated SetMessageAllocatorFor_<Method>(); like any
+/// MessageAllocator, it must outlive the server.
+template <typename RequestT, typename ResponseT>
+class ArenaMessageAllocator final
+    : public MessageAllocator<RequestT, ResponseT> {
+ public:
+  explicit ArenaMessageAllocator(size_t initial_block_size = 4096,
+                                 size_t max_pooled_arenas = 64)
+      : initial_block_size_(initial_block_size),
+        max_pooled_arenas_(max_pooled_arenas) {}
+
+  ~ArenaMessageAllocator() override {
+    for (MessageHolderImpl* holder : pool_) delete holder;
+  }
+
+  MessageHolder<RequestT, ResponseT>* AllocateMessages() override {
+    MessageHolderImpl* holder = nullptr;
+    {
+      grpc::internal::MutexLock lock(&mu_);
+      if (!pool_.empty()) {
+        holder = pool_.back();
+        pool_.pop_back();
+      }
+    }
+    if (holder == nullptr) holder = new MessageHolderImpl(this);
+    holder->CreateMessages();
+    return holder;
+  }
+
+ private:
+  class MessageHolderImpl final : public MessageHolder<RequestT, ResponseT> {
+   public:
+    explicit MessageHolderImpl(ArenaMessageAllocator* allocator)
+        : allocator_(allocator),
+          initial_block_(allocator->initial_block_size_ > 0
+                             ? new char[allocator->initial_block_size_]
+                             : nullptr),
+          arena_(MakeArenaOptions(initial_block_.get(),
+                                  allocator->initial_block_size_)) {}
+
+    void CreateMessages() {
+      this->set_request(grpc::protobuf::Arena::Create<RequestT>(&arena_));
+      this->set_response(grpc::protobuf::Arena::Create<ResponseT>(&arena_));
+    }
+
+    // Frees the messages, keeping the initial block, and returns the arena
+    // to the pool.
+    void Release() override {
+      arena_.Reset();
+      allocator_->ReturnToPool(this);
+    }
+
+   private:
+    static grpc::protobuf::ArenaOptions MakeArenaOptions(char* initial_block,
+                                                         size_t size) {
+      grpc::protobuf::ArenaOptions options;
+      options.initial_block = initial_block;
+      options.initial_block_size = size;
+      return options;
+    }
+
+    ArenaMessageAllocator* const allocator_;
+    const std::unique_ptr<char[]> initial_block_;
+    grpc::protobuf::Arena arena_;
+  };
+
+  void ReturnToPool(MessageHolderImpl* holder) {
+    {
+      grpc::internal::MutexLock lock(&mu_);
+      if (pool_.size() < max_pooled_arenas_) {
+        pool_.push_back(holder);
+        return;
+      }
+    }
+    delete holder;
+  }
+
+  const size_t initial_block_size_;
+  const size_t max_pooled_arenas_;
+  grpc::internal::Mutex mu_;
+  std::vector<MessageHolderImpl*> pool_;
+};
+
+}  // namespace experimental
+}  // namespace grpc
+
+#endif  // GRPCPP_SUPPORT_ARENA_MESSAGE_ALLOCATOR_H
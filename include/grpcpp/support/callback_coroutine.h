@@ -0,0 +1,274 @@
+//
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPCPP_SUPPORT_CALLBACK_COROUTINE_H
+#define GRPCPP_SUPPORT_CALLBACK_COROUTINE_H
+
+// C++20 coroutine support for the callback API. Nothing is declared here
+// when the compiler does not support coroutines.
+//
+// Each operation is an awaitable that starts the corresponding operation of
+// the callback API and resumes the coroutine from the reaction that reports
+// its result, i.e. on the thread that runs the callback API's reactions.
+// The state of each operation lives in the stream or in the coroutine frame,
+// so that no operation allocates.
+//
+// A client coroutine might look like:
+//
+//   grpc::experimental::CallbackTask Chat(Stub* stub) {
+//     grpc::ClientContext ctx;
+//     grpc::experimental::ClientBidiStream<Request, Response> stream;
+//     stub->async()->Chat(&ctx, &stream);
+//     stream.StartCall();
+//     Request request;
+//     Response response;
+//     if (co_await stream.Write(&request) && co_await stream.Read(&response)) {
+//       ...
+//     }
+//     co_await stream.WritesDone();
+//     grpc::Status status = co_await stream.Finish();
+//   }
+//
+// and a unary call:
+//
+//   grpc::Status status =
+//       co_await grpc::experimental::AwaitUnaryCall([&](auto done) {
+//         stub->async()->Echo(&ctx, &request, &response, std::move(done));
+//       });
+
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L && \
+    __has_include(<coroutine>)
+
+#include <grpcpp/support/client_callback.h>
+#include <grpcpp/support/server_callback.h>
+#include <grpcpp/support/status.h>
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <utility>
+
+namespace grpc {
+namespace internal {
+
+/// One outstanding operation of a coroutine: the coroutine awaiting it and,
+/// once the operation has completed, its result. The operation may complete
+/// on another thread before the coroutine has finished suspending, so
+/// whichever of the two comes second resumes the coroutine.
+template <typename T>
+class CoroutineOp {
+ public:
+  /// Suspends waiter and calls start, which starts the operation. Returns
+  /// false, to resume waiter at once, if the operation has completed by
+  /// then.
+  template <typename Start>
+  bool Suspend(std::coroutine_handle<> waiter, Start&& start) {
+    waiter_ = waiter;
+    start();
+    return !ready_.exchange(true, std::memory_order_acq_rel);
+  }
+
+  /// Called from the reaction that reports result. Must be the last use of
+  /// the operation, since the resumed coroutine may destroy it.
+  void Complete(T result) {
+    result_ = std::move(result);
+    if (ready_.exchange(true, std::memory_order_acq_rel)) waiter_.resume();
+  }
+
+  /// Returns the result, and readies the operation to be awaited again.
+  T TakeResult() {
+    ready_.store(false, std::memory_order_relaxed);
+    return std::move(result_);
+  }
+
+ private:
+  std::atomic<bool> ready_{false};
+  std::coroutine_handle<> waiter_;
+  T result_{};
+};
+
+/// Awaits op, after starting it with start.
+template <typename T, typename Start>
+class CoroutineOpAwaitable {
+ public:
+  CoroutineOpAwaitable(CoroutineOp<T>* op, Start start)
+      : op_(op), start_(std::move(start)) {}
+
+  bool await_ready() const noexcept { return false; }
+  bool await_suspend(std::coroutine_handle<> waiter) {
+    return op_->Suspend(waiter, start_);
+  }
+  T await_resume() { return op_->TakeResult(); }
+
+ private:
+  CoroutineOp<T>* const op_;
+  Start start_;
+};
+
+template <typename T, typename Start>
+CoroutineOpAwaitable<T, Start> AwaitCoroutineOp(CoroutineOp<T>* op,
+                                                Start start) {
+  return CoroutineOpAwaitable<T, Start>(op, std::move(start));
+}
+
+}  // namespace internal
+
+namespace experimental {
+
+/// The return type of a coroutine that runs detached: it starts running
+/// when called, and its frame is freed when it returns.
+class CallbackTask {
+ public:
+  struct promise_type {
+    CallbackTask get_return_object() noexcept { return CallbackTask(); }
+    std::suspend_never initial_suspend() noexcept { return {}; }
+    std::suspend_never final_suspend() noexcept { return {}; }
+    void return_void() noexcept {}
+    void unhandled_exception() noexcept { std::terminate(); }
+  };
+};
+
+/// Awaits a unary callback call. start is called with the callback to pass
+/// to the call, and must start the call. The awaitable yields the status of
+/// the call.
+template <typename Start>
+class UnaryCallAwaitable {
+ public:
+  explicit UnaryCallAwaitable(Start start) : start_(std::move(start)) {}
+
+  bool await_ready() const noexcept { return false; }
+  bool await_suspend(std::coroutine_handle<> waiter) {
+    return op_.Suspend(waiter, [this] {
+      start_([this](grpc::Status status) { op_.Complete(std::move(status)); });
+    });
+  }
+  grpc::Status await_resume() { return op_.TakeResult(); }
+
+ private:
+  Start start_;
+  internal::CoroutineOp<grpc::Status> op_;
+};
+
+template <typename Start>
+UnaryCallAwaitable<Start> AwaitUnaryCall(Start start) {
+  return UnaryCallAwaitable<Start>(std::move(start));
+}
+
+/// A bidi streaming client call driven by a coroutine. Pass the stream to
+/// the stub's async() method as its reactor, and call StartCall(). At most
+/// one Read() and one Write() or WritesDone() may be outstanding at a time,
+/// and Finish() must be awaited before the stream is destroyed.
+template <class Request, class Response>
+class ClientBidiStream final
+    : public grpc::ClientBidiReactor<Request, Response> {
+ public:
+  /// Yields whether resp was read; false once the stream has ended.
+  auto Read(Response* resp) {
+    return internal::AwaitCoroutineOp(
+        &read_, [this, resp] { this->StartRead(resp); });
+  }
+  /// Yields whether req was written; false once the call has failed.
+  auto Write(const Request* req,
+             grpc::WriteOptions options = grpc::WriteOptions()) {
+    return internal::AwaitCoroutineOp(&write_, [this, req, options] {
+      this->StartWrite(req, options);
+    });
+  }
+  auto WritesDone() {
+    return internal::AwaitCoroutineOp(&write_,
+                                      [this] { this->StartWritesDone(); });
+  }
+  /// Yields the status of the call once it is done.
+  auto Finish() {
+    return internal::AwaitCoroutineOp(&done_, [] {});
+  }
+
+  void OnReadDone(bool ok) override { read_.Complete(ok); }
+  void OnWriteDone(bool ok) override { write_.Complete(ok); }
+  void OnWritesDoneDone(bool ok) override { write_.Complete(ok); }
+  void OnDone(const grpc::Status& s) override { done_.Complete(s); }
+
+ private:
+  internal::CoroutineOp<bool> read_;
+  internal::CoroutineOp<bool> write_;
+  internal::CoroutineOp<grpc::Status> done_;
+};
+
+/// A bidi streaming server call driven by a coroutine. Allocate the stream
+/// with new, start the coroutine that drives it, and return the stream from
+/// the method handler. At most one Read() and one Write() may be outstanding
+/// at a time. The stream deletes itself when the awaited Finish() resumes
+/// the coroutine, so it must not be used after that.
+template <class Request, class Response>
+class ServerBidiStream final
+    : public grpc::ServerBidiReactor<Request, Response> {
+ public:
+  class FinishAwaitable {
+   public:
+    FinishAwaitable(ServerBidiStream* stream, grpc::Status status)
+        : stream_(stream), status_(std::move(status)) {}
+
+    bool await_ready() const noexcept { return false; }
+    bool await_suspend(std::coroutine_handle<> waiter) {
+      return stream_->done_.Suspend(waiter, [this] {
+        stream_->grpc::ServerBidiReactor<Request, Response>::Finish(
+            std::move(status_));
+      });
+    }
+    // OnDone() is the last use of the stream by the library, and this is the
+    // last use by the coroutine.
+    void await_resume() { delete stream_; }
+
+   private:
+    ServerBidiStream* const stream_;
+    grpc::Status status_;
+  };
+
+  /// Yields whether req was read; false once the stream has ended.
+  auto Read(Request* req) {
+    return internal::AwaitCoroutineOp(&read_,
+                                      [this, req] { this->StartRead(req); });
+  }
+  /// Yields whether resp was written; false once the call has failed.
+  auto Write(const Response* resp,
+             grpc::WriteOptions options = grpc::WriteOptions()) {
+    return internal::AwaitCoroutineOp(&write_, [this, resp, options] {
+      this->StartWrite(resp, options);
+    });
+  }
+  /// Finishes the call with status, and resumes once the call is done.
+  FinishAwaitable Finish(grpc::Status status) {
+    return FinishAwaitable(this, std::move(status));
+  }
+
+  void OnReadDone(bool ok) override { read_.Complete(ok); }
+  void OnWriteDone(bool ok) override { write_.Complete(ok); }
+  void OnDone() override { done_.Complete(true); }
+
+ private:
+  internal::CoroutineOp<bool> read_;
+  internal::CoroutineOp<bool> write_;
+  internal::CoroutineOp<bool> done_;
+};
+
+}  // namespace experimental
+}  // namespace grpc
+
+#endif  // defined(__cpp_impl_coroutine) && ...
+
+#endif  // GRPCPP_SUPPORT_CALLBACK_COROUTINE_H
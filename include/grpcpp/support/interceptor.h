@@ -25,6 +25,7 @@
 #include <grpcpp/support/config.h>
 #include <grpcpp/support/string_ref.h>
 
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
@@ -80,6 +81,20 @@ enum class InterceptionHookPoints {
   NUM_INTERCEPTION_HOOKS
 };
 
+/// A set of \a InterceptionHookPoints, with one bit per hook point.
+using InterceptionHookPointSet = uint32_t;
+
+/// Returns the set holding only the hook point \a type.
+constexpr InterceptionHookPointSet InterceptionHookPointBit(
+    InterceptionHookPoints type) {
+  return InterceptionHookPointSet{1} << static_cast<int>(type);
+}
+
+/// The set holding every hook point.
+constexpr InterceptionHookPointSet kAllInterceptionHookPoints =
+    InterceptionHookPointBit(InterceptionHookPoints::NUM_INTERCEPTION_HOOKS) -
+    1;
+
 /// Class that is passed as an argument to the \a Intercept method
 /// of the application's \a Interceptor interface implementation. It has five
 /// purposes:
@@ -222,6 +237,16 @@ class Interceptor {
   /// The one public method of an Interceptor interface. Override this to
   /// trigger the desired actions at the hook points described above.
   virtual void Intercept(InterceptorBatchMethods* methods) = 0;
+
+  /// Override this to declare the hook points that this interceptor acts on.
+  /// A batch that contains none of them skips this interceptor entirely, as
+  /// if its \a Intercept had just called \a Proceed, which saves the
+  /// dispatch cost for interceptors that only care about a few hook points.
+  /// PRE_SEND_CANCEL and the PRE_RECV_* batches of a hijacking interceptor are
+  /// always delivered. It is called once per batch, so it should be cheap.
+  virtual InterceptionHookPointSet UsedHookPoints() const {
+    return kAllInterceptionHookPoints;
+  }
 };
 
 }  // namespace experimental
@@ -140,13 +140,12 @@ class ProtoBufferReader : public grpc::protobuf::io::ZeroCopyInputStream {
     }
     // check for backed up data
     if (backup_count() > 0) {
+      const size_t backup_start = GRPC_SLICE_LENGTH(*slice()) - backup_count();
       if (backup_count() <= count) {
-        cord->Append(MakeCordFromSlice(grpc_slice_split_tail(
-            slice(), GRPC_SLICE_LENGTH(*slice()) - backup_count())));
+        AppendSliceToCord(grpc_slice_split_tail(slice(), backup_start), cord);
       } else {
-        cord->Append(MakeCordFromSlice(grpc_slice_sub(
-            *slice(), GRPC_SLICE_LENGTH(*slice()) - backup_count(),
-            GRPC_SLICE_LENGTH(*slice()) - backup_count() + count)));
+        AppendSliceToCord(
+            grpc_slice_sub(*slice(), backup_start, backup_start + count), cord);
       }
       int64_t take = (std::min)(backup_count(), static_cast<int64_t>(count));
       set_backup_count(backup_count() - take);
@@ -165,11 +164,11 @@ class ProtoBufferReader : public grpc::protobuf::io::ZeroCopyInputStream {
       uint64_t slice_length = GRPC_SLICE_LENGTH(*slice());
       set_byte_count(ByteCount() + slice_length);
       if (slice_length <= static_cast<uint64_t>(count)) {
-        cord->Append(MakeCordFromSlice(grpc_slice_ref(*slice())));
+        AppendSliceToCord(grpc_slice_ref(*slice()), cord);
         // This cast is safe as above.
         count -= static_cast<int>(slice_length);
       } else {
-        cord->Append(MakeCordFromSlice(grpc_slice_split_head(slice(), count)));
+        AppendSliceToCord(grpc_slice_split_head(slice(), count), cord);
         set_backup_count(slice_length - count);
         return true;
       }
@@ -193,20 +192,29 @@ class ProtoBufferReader : public grpc::protobuf::io::ZeroCopyInputStream {
 
  private:
 #ifdef GRPC_PROTOBUF_CORD_SUPPORT_ENABLED
-  // This function takes ownership of slice and return a newly created Cord off
-  // of it.
-  static absl::Cord MakeCordFromSlice(grpc_slice slice) {
-    // slice_for_cord is created to keep inlined data of the given slice
-    grpc_slice* slice_for_cord = new grpc_slice;
-    *slice_for_cord = slice;
-    return absl::MakeCordFromExternal(
-        absl::string_view(
-            reinterpret_cast<char*>(GRPC_SLICE_START_PTR(*slice_for_cord)),
-            GRPC_SLICE_LENGTH(*slice_for_cord)),
-        [slice_for_cord](absl::string_view /* view */) {
-          grpc_slice_unref(*slice_for_cord);
-          delete slice_for_cord;
-        });
+  // Chunks smaller than this are copied into the cord: sharing them would
+  // cost more than the copy.
+  static constexpr size_t kMinSharedCordChunkSize = 512;
+
+  // Holds the ref to a slice that a cord shares the memory of.
+  struct SliceReleaser {
+    grpc_slice slice;
+    void operator()() const { grpc_slice_unref(slice); }
+  };
+
+  // This function takes ownership of slice and appends its bytes to cord,
+  // sharing the slice's memory unless it is small. A slice of that size is
+  // never inlined, so its bytes do not move with the releaser.
+  static void AppendSliceToCord(grpc_slice slice, absl::Cord* cord) {
+    absl::string_view bytes(
+        reinterpret_cast<char*>(GRPC_SLICE_START_PTR(slice)),
+        GRPC_SLICE_LENGTH(slice));
+    if (bytes.size() < kMinSharedCordChunkSize) {
+      cord->Append(bytes);
+      grpc_slice_unref(slice);
+      return;
+    }
+    cord->Append(absl::MakeCordFromExternal(bytes, SliceReleaser{slice}));
   }
 #endif  // GRPC_PROTOBUF_CORD_SUPPORT_ENABLED
 
@@ -74,6 +74,8 @@ class RequestBuffer {
       return Arena::MakePooled<ClientMetadata>(md->Copy());
     }
 
+    // Shares the payload's slices with the buffered message rather than
+    // copying their bytes, so every attempt replays the same memory.
     MessageHandle CopyObject(const MessageHandle& msg) {
       return Arena::MakePooled<Message>(msg->payload()->Copy(), msg->flags());
     }
@@ -18,17 +18,18 @@
 
 #include "src/core/channelz/channel_trace.h"
 
-#include <grpc/support/alloc.h>
 #include <grpc/support/json.h>
 #include <grpc/support/port_platform.h>
 
-#include <memory>
+#include <algorithm>
+#include <string>
 #include <utility>
 
 #include "absl/strings/str_cat.h"
 #include "src/core/channelz/channelz.h"
 #include "src/core/lib/slice/slice.h"
 #include "src/core/lib/slice/slice_internal.h"
+#include "src/core/lib/transport/connectivity_state.h"
 #include "src/core/util/string.h"
 #include "src/core/util/time.h"
 
@@ -39,16 +40,51 @@ namespace channelz {
 // ChannelTrace::TraceEvent
 //
 
-ChannelTrace::TraceEvent::TraceEvent(Severity severity, const grpc_slice& data,
+ChannelTrace::TraceEvent::TraceEvent(Severity severity, Kind kind,
+                                     const grpc_slice& data,
                                      RefCountedPtr<BaseNode> referenced_entity)
-    : timestamp_(Timestamp::Now().as_timespec(GPR_CLOCK_REALTIME)),
+    : timestamp_(Timestamp::Now()),
       severity_(severity),
+      kind_(kind),
       data_(data),
       memory_usage_(sizeof(TraceEvent) + grpc_slice_memory_usage(data)),
       referenced_entity_(std::move(referenced_entity)) {}
 
-ChannelTrace::TraceEvent::TraceEvent(Severity severity, const grpc_slice& data)
-    : TraceEvent(severity, data, nullptr) {}
+ChannelTrace::TraceEvent::TraceEvent(Severity severity, Kind kind,
+                                     grpc_connectivity_state state,
+                                     absl::Status status)
+    : timestamp_(Timestamp::Now()),
+      severity_(severity),
+      kind_(kind),
+      state_(state),
+      status_(std::move(status)),
+      memory_usage_(sizeof(TraceEvent)) {}
+
+ChannelTrace::TraceEvent::TraceEvent(TraceEvent&& other) noexcept
+    : timestamp_(other.timestamp_),
+      severity_(other.severity_),
+      kind_(other.kind_),
+      state_(other.state_),
+      data_(std::exchange(other.data_, grpc_empty_slice())),
+      status_(std::move(other.status_)),
+      memory_usage_(std::exchange(other.memory_usage_, 0)),
+      referenced_entity_(std::move(other.referenced_entity_)) {}
+
+ChannelTrace::TraceEvent& ChannelTrace::TraceEvent::operator=(
+    TraceEvent&& other) noexcept {
+  if (this != &other) {
+    CSliceUnref(data_);
+    timestamp_ = other.timestamp_;
+    severity_ = other.severity_;
+    kind_ = other.kind_;
+    state_ = other.state_;
+    data_ = std::exchange(other.data_, grpc_empty_slice());
+    status_ = std::move(other.status_);
+    memory_usage_ = std::exchange(other.memory_usage_, 0);
+    referenced_entity_ = std::move(other.referenced_entity_);
+  }
+  return *this;
+}
 
 ChannelTrace::TraceEvent::~TraceEvent() { CSliceUnref(data_); }
 
@@ -70,13 +106,28 @@ const char* SeverityString(ChannelTrace::Severity severity) {
 }  // anonymous namespace
 
 Json ChannelTrace::TraceEvent::RenderTraceEvent() const {
-  char* description = grpc_slice_to_c_string(data_);
+  std::string description;
+  switch (kind_) {
+    case Kind::kText:
+      description = std::string(StringViewFromSlice(data_));
+      break;
+    case Kind::kChannelStateChange:
+      description =
+          ChannelNode::GetChannelConnectivityStateChangeString(state_);
+      break;
+    case Kind::kSubchannelStateChange:
+      description = absl::StrCat(
+          "Subchannel connectivity state changed to ",
+          ConnectivityStateName(state_),
+          status_.ok() ? "" : absl::StrCat(": ", status_.ToString()));
+      break;
+  }
   Json::Object object = {
-      {"description", Json::FromString(description)},
+      {"description", Json::FromString(std::move(description))},
       {"severity", Json::FromString(SeverityString(severity_))},
-      {"timestamp", Json::FromString(gpr_format_timespec(timestamp_))},
+      {"timestamp", Json::FromString(gpr_format_timespec(
+                        timestamp_.as_timespec(GPR_CLOCK_REALTIME)))},
   };
-  gpr_free(description);
   if (referenced_entity_ != nullptr) {
     const bool is_channel =
         (referenced_entity_->type() == BaseNode::EntityType::kTopLevelChannel ||
@@ -97,37 +148,41 @@ ChannelTrace::ChannelTrace(size_t max_event_memory)
     : max_event_memory_(max_event_memory),
       time_created_(Timestamp::Now().as_timespec(GPR_CLOCK_REALTIME)) {}
 
-ChannelTrace::~ChannelTrace() {
-  if (max_event_memory_ == 0) {
-    return;  // tracing is disabled if max_event_memory_ == 0
-  }
-  TraceEvent* it = head_trace_;
-  while (it != nullptr) {
-    TraceEvent* to_free = it;
-    it = it->next();
-    delete to_free;
-  }
-}
+ChannelTrace::~ChannelTrace() = default;
 
-void ChannelTrace::AddTraceEventHelper(TraceEvent* new_trace_event) {
+void ChannelTrace::AddTraceEventHelper(TraceEvent new_trace_event) {
   MutexLock lock(&mu_);
   ++num_events_logged_;
-  // first event case
-  if (head_trace_ == nullptr) {
-    head_trace_ = tail_trace_ = new_trace_event;
+  // Grow the ring geometrically up to the most events that fit in
+  // max_event_memory_, so that nodes with few events stay small.
+  const size_t max_events =
+      std::max<size_t>(1, max_event_memory_ / sizeof(TraceEvent));
+  if (num_events_ == ring_.size() && ring_.size() < max_events) {
+    std::vector<TraceEvent> ring(
+        std::min(max_events, std::max<size_t>(4, 2 * ring_.size())));
+    for (size_t i = 0; i < num_events_; ++i) {
+      ring[i] = std::move(ring_[(head_ + i) % ring_.size()]);
+    }
+    ring_ = std::move(ring);
+    head_ = 0;
   }
-  // regular event add case
-  else {
-    tail_trace_->set_next(new_trace_event);
-    tail_trace_ = tail_trace_->next();
+  // Make room for the new event, evicting the oldest one.
+  if (num_events_ == ring_.size()) {
+    event_list_memory_usage_ -= ring_[head_].memory_usage();
+    ring_[head_] = TraceEvent();
+    head_ = (head_ + 1) % ring_.size();
+    --num_events_;
   }
-  event_list_memory_usage_ += new_trace_event->memory_usage();
-  // maybe garbage collect the tail until we are under the memory limit.
-  while (event_list_memory_usage_ > max_event_memory_) {
-    TraceEvent* to_free = head_trace_;
-    event_list_memory_usage_ -= to_free->memory_usage();
-    head_trace_ = head_trace_->next();
-    delete to_free;
+  event_list_memory_usage_ += new_trace_event.memory_usage();
+  ring_[(head_ + num_events_) % ring_.size()] = std::move(new_trace_event);
+  ++num_events_;
+  // maybe garbage collect the oldest events until we are under the memory
+  // limit.
+  while (event_list_memory_usage_ > max_event_memory_ && num_events_ > 0) {
+    event_list_memory_usage_ -= ring_[head_].memory_usage();
+    ring_[head_] = TraceEvent();
+    head_ = (head_ + 1) % ring_.size();
+    --num_events_;
   }
 }
 
@@ -136,7 +191,8 @@ void ChannelTrace::AddTraceEvent(Severity severity, const grpc_slice& data) {
     CSliceUnref(data);
     return;  // tracing is disabled if max_event_memory_ == 0
   }
-  AddTraceEventHelper(new TraceEvent(severity, data));
+  AddTraceEventHelper(
+      TraceEvent(severity, TraceEvent::Kind::kText, data, nullptr));
 }
 
 void ChannelTrace::AddTraceEventWithReference(
@@ -147,8 +203,21 @@ void ChannelTrace::AddTraceEventWithReference(
     return;  // tracing is disabled if max_event_memory_ == 0
   }
   // create and fill up the new event
-  AddTraceEventHelper(
-      new TraceEvent(severity, data, std::move(referenced_entity)));
+  AddTraceEventHelper(TraceEvent(severity, TraceEvent::Kind::kText, data,
+                                 std::move(referenced_entity)));
+}
+
+void ChannelTrace::AddChannelStateChangeEvent(grpc_connectivity_state state) {
+  if (max_event_memory_ == 0) return;
+  AddTraceEventHelper(TraceEvent(
+      Info, TraceEvent::Kind::kChannelStateChange, state, absl::OkStatus()));
+}
+
+void ChannelTrace::AddSubchannelStateChangeEvent(grpc_connectivity_state state,
+                                                 const absl::Status& status) {
+  if (max_event_memory_ == 0) return;
+  AddTraceEventHelper(TraceEvent(
+      Info, TraceEvent::Kind::kSubchannelStateChange, state, status));
 }
 
 Json ChannelTrace::RenderJson() const {
@@ -166,10 +235,12 @@ Json ChannelTrace::RenderJson() const {
         Json::FromString(absl::StrCat(num_events_logged_));
   }
   // Only add in the event list if it is non-empty.
-  if (head_trace_ != nullptr) {
+  if (num_events_ > 0) {
     Json::Array array;
-    for (TraceEvent* it = head_trace_; it != nullptr; it = it->next()) {
-      array.emplace_back(it->RenderTraceEvent());
+    array.reserve(num_events_);
+    for (size_t i = 0; i < num_events_; ++i) {
+      array.emplace_back(
+          ring_[(head_ + i) % ring_.size()].RenderTraceEvent());
     }
     object["events"] = Json::FromArray(std::move(array));
   }
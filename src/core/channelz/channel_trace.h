@@ -19,16 +19,21 @@
 #ifndef GRPC_SRC_CORE_CHANNELZ_CHANNEL_TRACE_H
 #define GRPC_SRC_CORE_CHANNELZ_CHANNEL_TRACE_H
 
+#include <grpc/impl/connectivity_state.h>
 #include <grpc/slice.h>
 #include <grpc/support/port_platform.h>
 #include <grpc/support/time.h>
 #include <stddef.h>
 #include <stdint.h>
 
+#include <vector>
+
 #include "absl/base/thread_annotations.h"
+#include "absl/status/status.h"
 #include "src/core/util/json/json.h"
 #include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/sync.h"
+#include "src/core/util/time.h"
 
 namespace grpc_core {
 namespace channelz {
@@ -42,6 +47,12 @@ class BaseNode;
 // Object used to hold live data for a channel. This data is exposed via the
 // channelz service:
 // https://github.com/grpc/proposal/blob/master/A14-channelz.md
+//
+// Events are kept in a ring of fixed-size slots, which grows up to the most
+// events that fit in the memory limit, so that adding an event allocates
+// nothing once the ring is full. Events that stand for common transitions,
+// such as connectivity state changes, are stored in structured form and only
+// turned into strings when the trace is rendered.
 class ChannelTrace {
  public:
   explicit ChannelTrace(size_t max_event_memory);
@@ -78,6 +89,16 @@ class ChannelTrace {
   void AddTraceEventWithReference(Severity severity, const grpc_slice& data,
                                   RefCountedPtr<BaseNode> referenced_entity);
 
+  // Records a channel connectivity state change, rendered as "Channel state
+  // change to <state>".
+  void AddChannelStateChangeEvent(grpc_connectivity_state state);
+
+  // Records a subchannel connectivity state change, rendered as "Subchannel
+  // connectivity state changed to <state>", followed by status if it is not
+  // OK.
+  void AddSubchannelStateChangeEvent(grpc_connectivity_state state,
+                                     const absl::Status& status);
+
   // Creates and returns the raw Json object, so a parent channelz
   // object may incorporate the json before rendering.
   Json RenderJson() const;
@@ -89,38 +110,42 @@ class ChannelTrace {
   // a trace event.
   class TraceEvent {
    public:
-    // Constructor for a TraceEvent that references a channel.
-    TraceEvent(Severity severity, const grpc_slice& data,
-               RefCountedPtr<BaseNode> referenced_entity_);
-
-    // Constructor for a TraceEvent that does not reverence a different
-    // channel.
-    TraceEvent(Severity severity, const grpc_slice& data);
-
+    enum class Kind : uint8_t {
+      // data_ holds the description.
+      kText,
+      kChannelStateChange,
+      kSubchannelStateChange,
+    };
+
+    TraceEvent() = default;
+    TraceEvent(Severity severity, Kind kind, const grpc_slice& data,
+               RefCountedPtr<BaseNode> referenced_entity);
+    TraceEvent(Severity severity, Kind kind, grpc_connectivity_state state,
+               absl::Status status);
+    TraceEvent(TraceEvent&& other) noexcept;
+    TraceEvent& operator=(TraceEvent&& other) noexcept;
     ~TraceEvent();
 
     // Renders the data inside of this TraceEvent into a json object. This is
     // used by the ChannelTrace, when it is rendering itself.
     Json RenderTraceEvent() const;
 
-    // set and get for the next_ pointer.
-    TraceEvent* next() const { return next_; }
-    void set_next(TraceEvent* next) { next_ = next; }
-
     size_t memory_usage() const { return memory_usage_; }
 
    private:
-    const gpr_timespec timestamp_;
-    const Severity severity_;
-    const grpc_slice data_;
-    const size_t memory_usage_;
+    Timestamp timestamp_;
+    Severity severity_ = Unset;
+    Kind kind_ = Kind::kText;
+    grpc_connectivity_state state_ = GRPC_CHANNEL_IDLE;
+    grpc_slice data_ = grpc_empty_slice();
+    absl::Status status_;
+    size_t memory_usage_ = 0;
     // the tracer object for the (sub)channel that this trace event refers to.
-    const RefCountedPtr<BaseNode> referenced_entity_;
-    TraceEvent* next_ = nullptr;
+    RefCountedPtr<BaseNode> referenced_entity_;
   };  // TraceEvent
 
-  // Internal helper to add and link in a trace event
-  void AddTraceEventHelper(TraceEvent* new_trace_event);
+  // Internal helper to add a trace event to the ring
+  void AddTraceEventHelper(TraceEvent new_trace_event);
 
   const size_t max_event_memory_;
   const gpr_timespec time_created_;
@@ -128,8 +153,11 @@ class ChannelTrace {
   mutable Mutex mu_;
   uint64_t num_events_logged_ ABSL_GUARDED_BY(mu_) = 0;
   size_t event_list_memory_usage_ ABSL_GUARDED_BY(mu_) = 0;
-  TraceEvent* head_trace_ ABSL_GUARDED_BY(mu_) = nullptr;
-  TraceEvent* tail_trace_ ABSL_GUARDED_BY(mu_) = nullptr;
+  // The retained events, oldest first starting at head_. Its size grows up
+  // to the most events that fit in max_event_memory_.
+  std::vector<TraceEvent> ring_ ABSL_GUARDED_BY(mu_);
+  size_t head_ ABSL_GUARDED_BY(mu_) = 0;
+  size_t num_events_ ABSL_GUARDED_BY(mu_) = 0;
 };
 
 }  // namespace channelz
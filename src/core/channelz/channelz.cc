@@ -25,11 +25,14 @@
 #include <algorithm>
 #include <atomic>
 #include <cstdint>
+#include <string>
+#include <vector>
 
 #include "absl/log/absl_check.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/escaping.h"
 #include "absl/strings/str_cat.h"
+#include "absl/strings/str_join.h"
 #include "absl/strings/strip.h"
 #include "src/core/channelz/channelz_registry.h"
 #include "src/core/lib/address_utils/parse_address.h"
@@ -55,7 +58,7 @@ BaseNode::BaseNode(EntityType type, std::string name)
   ChannelzRegistry::Register(this);
 }
 
-BaseNode::~BaseNode() { ChannelzRegistry::Unregister(uuid_); }
+BaseNode::~BaseNode() { ChannelzRegistry::Unregister(this); }
 
 std::string BaseNode::RenderJsonString() {
   Json json = RenderJson();
@@ -568,6 +571,57 @@ void SocketNode::RecordMessageReceived() {
                                      std::memory_order_relaxed);
 }
 
+void SocketNode::RecordTcpInfo(TcpTracerInterface::ConnectionMetrics metrics) {
+  MutexLock lock(&tcp_info_mu_);
+  tcp_info_ = std::move(metrics);
+}
+
+namespace {
+
+// Renders a TCP_INFO sample as a channelz SocketOption, with the fields
+// that SocketOptionTcpInfo has in "additional" and the rest in "value".
+Json RenderTcpInfoOption(const TcpTracerInterface::ConnectionMetrics& m) {
+  Json::Object tcp_info = {
+      {"@type",
+       Json::FromString(
+           "type.googleapis.com/grpc.channelz.v1.SocketOptionTcpInfo")},
+  };
+  std::vector<std::string> summary;
+  if (m.srtt.has_value()) {
+    tcp_info["tcpiRtt"] = Json::FromNumber(*m.srtt);
+    summary.push_back(absl::StrCat("srtt_us=", *m.srtt));
+  }
+  if (m.min_rtt.has_value()) {
+    summary.push_back(absl::StrCat("min_rtt_us=", *m.min_rtt));
+  }
+  if (m.congestion_window.has_value()) {
+    tcp_info["tcpiSndCwnd"] = Json::FromNumber(*m.congestion_window);
+    summary.push_back(absl::StrCat("cwnd=", *m.congestion_window));
+  }
+  if (m.snd_ssthresh.has_value()) {
+    tcp_info["tcpiSndSsthresh"] = Json::FromNumber(*m.snd_ssthresh);
+  }
+  if (m.reordering.has_value()) {
+    tcp_info["tcpiReordering"] = Json::FromNumber(*m.reordering);
+  }
+  if (m.recurring_retrans.has_value()) {
+    tcp_info["tcpiRetransmits"] = Json::FromNumber(*m.recurring_retrans);
+  }
+  if (m.packet_retx.has_value()) {
+    summary.push_back(absl::StrCat("total_retrans=", *m.packet_retx));
+  }
+  if (m.delivery_rate.has_value()) {
+    summary.push_back(absl::StrCat("delivery_rate_Bps=", *m.delivery_rate));
+  }
+  return Json::FromObject({
+      {"name", Json::FromString("TCP_INFO")},
+      {"value", Json::FromString(absl::StrJoin(summary, " "))},
+      {"additional", Json::FromObject(std::move(tcp_info))},
+  });
+}
+
+}  // namespace
+
 Json SocketNode::RenderJson() {
   // Create and fill the data child.
   Json::Object data;
@@ -630,6 +684,12 @@ Json SocketNode::RenderJson() {
   if (keepalives_sent != 0) {
     data["keepAlivesSent"] = Json::FromString(absl::StrCat(keepalives_sent));
   }
+  {
+    MutexLock lock(&tcp_info_mu_);
+    if (tcp_info_.has_value()) {
+      data["option"] = Json::FromArray({RenderTcpInfoOption(*tcp_info_)});
+    }
+  }
   // Create and fill the parent object.
   Json::Object object = {
       {"ref", Json::FromObject({
@@ -34,8 +34,10 @@
 #include <utility>
 
 #include "absl/base/thread_annotations.h"
+#include "absl/status/status.h"
 #include "absl/strings/string_view.h"
 #include "src/core/channelz/channel_trace.h"
+#include "src/core/telemetry/tcp_tracer.h"
 #include "src/core/util/json/json.h"
 #include "src/core/util/per_cpu.h"
 #include "src/core/util/ref_counted.h"
@@ -190,6 +192,9 @@ class ChannelNode final : public BaseNode {
     trace_.AddTraceEventWithReference(severity, data,
                                       std::move(referenced_channel));
   }
+  void AddConnectivityStateChangeTraceEvent(grpc_connectivity_state state) {
+    trace_.AddChannelStateChangeEvent(state);
+  }
   void RecordCallStarted() { call_counter_.RecordCallStarted(); }
   void RecordCallFailed() { call_counter_.RecordCallFailed(); }
   void RecordCallSucceeded() { call_counter_.RecordCallSucceeded(); }
@@ -248,6 +253,10 @@ class SubchannelNode final : public BaseNode {
     trace_.AddTraceEventWithReference(severity, data,
                                       std::move(referenced_channel));
   }
+  void AddConnectivityStateChangeTraceEvent(grpc_connectivity_state state,
+                                            const absl::Status& status) {
+    trace_.AddSubchannelStateChangeEvent(state, status);
+  }
   void RecordCallStarted() { call_counter_.RecordCallStarted(); }
   void RecordCallFailed() { call_counter_.RecordCallFailed(); }
   void RecordCallSucceeded() { call_counter_.RecordCallSucceeded(); }
@@ -365,6 +374,9 @@ class SocketNode final : public BaseNode {
   void RecordKeepaliveSent() {
     keepalives_sent_.fetch_add(1, std::memory_order_relaxed);
   }
+  // Records the latest TCP_INFO sample of the socket, reported as its
+  // TCP_INFO socket option.
+  void RecordTcpInfo(TcpTracerInterface::ConnectionMetrics metrics);
 
   const std::string& remote() { return remote_; }
 
@@ -382,6 +394,9 @@ class SocketNode final : public BaseNode {
   std::string local_;
   std::string remote_;
   RefCountedPtr<Security> const security_;
+  Mutex tcp_info_mu_;
+  std::optional<TcpTracerInterface::ConnectionMetrics> tcp_info_
+      ABSL_GUARDED_BY(tcp_info_mu_);
 };
 
 // Handles channelz bookkeeping for listen sockets
@@ -24,6 +24,8 @@
 #include <grpc/support/string_util.h>
 
 #include <algorithm>
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <utility>
@@ -41,7 +43,7 @@ namespace grpc_core {
 namespace channelz {
 namespace {
 
-const int kPaginationLimit = 100;
+constexpr size_t kPaginationLimit = 100;
 
 }  // anonymous namespace
 
@@ -51,120 +53,111 @@ ChannelzRegistry* ChannelzRegistry::Default() {
 }
 
 void ChannelzRegistry::InternalRegister(BaseNode* node) {
-  MutexLock lock(&mu_);
-  node->uuid_ = ++uuid_generator_;
-  node_map_[node->uuid_] = node;
+  node->uuid_ = uuid_generator_.fetch_add(1, std::memory_order_relaxed) + 1;
+  Shard& shard = ShardFor(node->uuid_);
+  MutexLock lock(&shard.mu);
+  shard.nodes[static_cast<size_t>(node->type())][node->uuid_] = node;
 }
 
-void ChannelzRegistry::InternalUnregister(intptr_t uuid) {
-  ABSL_CHECK_GE(uuid, 1);
-  MutexLock lock(&mu_);
-  ABSL_CHECK(uuid <= uuid_generator_);
-  node_map_.erase(uuid);
+void ChannelzRegistry::InternalUnregister(BaseNode* node) {
+  ABSL_CHECK_GE(node->uuid_, 1);
+  ABSL_CHECK(node->uuid_ <= uuid_generator_.load(std::memory_order_relaxed));
+  Shard& shard = ShardFor(node->uuid_);
+  MutexLock lock(&shard.mu);
+  shard.nodes[static_cast<size_t>(node->type())].erase(node->uuid_);
 }
 
 RefCountedPtr<BaseNode> ChannelzRegistry::InternalGet(intptr_t uuid) {
-  MutexLock lock(&mu_);
-  if (uuid < 1 || uuid > uuid_generator_) {
+  if (uuid < 1 || uuid > uuid_generator_.load(std::memory_order_relaxed)) {
     return nullptr;
   }
-  auto it = node_map_.find(uuid);
-  if (it == node_map_.end()) return nullptr;
-  // Found node.  Return only if its refcount is not zero (i.e., when we
-  // know that there is no other thread about to destroy it).
-  BaseNode* node = it->second;
-  return node->RefIfNonZero();
+  Shard& shard = ShardFor(uuid);
+  MutexLock lock(&shard.mu);
+  for (auto& nodes : shard.nodes) {
+    auto it = nodes.find(uuid);
+    if (it == nodes.end()) continue;
+    // Found node.  Return only if its refcount is not zero (i.e., when we
+    // know that there is no other thread about to destroy it).
+    return it->second->RefIfNonZero();
+  }
+  return nullptr;
 }
 
-std::string ChannelzRegistry::InternalGetTopChannels(
-    intptr_t start_channel_id) {
-  std::vector<RefCountedPtr<BaseNode>> top_level_channels;
-  RefCountedPtr<BaseNode> node_after_pagination_limit;
-  {
-    MutexLock lock(&mu_);
-    for (auto it = node_map_.lower_bound(start_channel_id);
-         it != node_map_.end(); ++it) {
-      BaseNode* node = it->second;
-      RefCountedPtr<BaseNode> node_ref;
-      if (node->type() == BaseNode::EntityType::kTopLevelChannel &&
-          (node_ref = node->RefIfNonZero()) != nullptr) {
-        // Check if we are over pagination limit to determine if we need to set
-        // the "end" element. If we don't go through this block, we know that
-        // when the loop terminates, we have <= to kPaginationLimit.
-        // Note that because we have already increased this node's
-        // refcount, we need to decrease it, but we can't unref while
-        // holding the lock, because this may lead to a deadlock.
-        if (top_level_channels.size() == kPaginationLimit) {
-          node_after_pagination_limit = std::move(node_ref);
-          break;
-        }
-        top_level_channels.emplace_back(std::move(node_ref));
-      }
+std::vector<RefCountedPtr<BaseNode>> ChannelzRegistry::QueryNodes(
+    BaseNode::EntityType type, intptr_t start_id, size_t max_results) {
+  const intptr_t last_id = uuid_generator_.load(std::memory_order_relaxed);
+  std::vector<RefCountedPtr<BaseNode>> nodes;
+  for (Shard& shard : shards_) {
+    // No shard can contribute more than max_results + 1 nodes to the page.
+    size_t taken = 0;
+    MutexLock lock(&shard.mu);
+    const auto& shard_nodes = shard.nodes[static_cast<size_t>(type)];
+    for (auto it = shard_nodes.lower_bound(start_id);
+         it != shard_nodes.end() && it->first <= last_id &&
+         taken <= max_results;
+         ++it) {
+      RefCountedPtr<BaseNode> node = it->second->RefIfNonZero();
+      if (node == nullptr) continue;
+      nodes.emplace_back(std::move(node));
+      ++taken;
     }
   }
+  std::sort(nodes.begin(), nodes.end(),
+            [](const RefCountedPtr<BaseNode>& a,
+               const RefCountedPtr<BaseNode>& b) {
+              return a->uuid() < b->uuid();
+            });
+  // Note that we hold no lock here, so the extra nodes can safely be unreffed.
+  if (nodes.size() > max_results + 1) nodes.resize(max_results + 1);
+  return nodes;
+}
+
+namespace {
+
+// Renders one page of nodes, as returned by QueryNodes, as the JSON form of
+// a GetTopChannelsResponse or GetServersResponse.
+std::string RenderPage(std::vector<RefCountedPtr<BaseNode>> nodes,
+                       const char* field) {
   Json::Object object;
-  if (!top_level_channels.empty()) {
-    // Create list of channels.
+  const bool end = nodes.size() <= kPaginationLimit;
+  if (!end) nodes.pop_back();
+  if (!nodes.empty()) {
     Json::Array array;
-    for (size_t i = 0; i < top_level_channels.size(); ++i) {
-      array.emplace_back(top_level_channels[i]->RenderJson());
+    array.reserve(nodes.size());
+    for (const auto& node : nodes) {
+      array.emplace_back(node->RenderJson());
     }
-    object["channel"] = Json::FromArray(std::move(array));
-  }
-  if (node_after_pagination_limit == nullptr) {
-    object["end"] = Json::FromBool(true);
+    object[field] = Json::FromArray(std::move(array));
   }
+  if (end) object["end"] = Json::FromBool(true);
   return JsonDump(Json::FromObject(std::move(object)));
 }
 
+}  // namespace
+
+std::string ChannelzRegistry::InternalGetTopChannels(
+    intptr_t start_channel_id) {
+  return RenderPage(QueryNodes(BaseNode::EntityType::kTopLevelChannel,
+                               start_channel_id, kPaginationLimit),
+                    "channel");
+}
+
 std::string ChannelzRegistry::InternalGetServers(intptr_t start_server_id) {
-  std::vector<RefCountedPtr<BaseNode>> servers;
-  RefCountedPtr<BaseNode> node_after_pagination_limit;
-  {
-    MutexLock lock(&mu_);
-    for (auto it = node_map_.lower_bound(start_server_id);
-         it != node_map_.end(); ++it) {
-      BaseNode* node = it->second;
-      RefCountedPtr<BaseNode> node_ref;
-      if (node->type() == BaseNode::EntityType::kServer &&
-          (node_ref = node->RefIfNonZero()) != nullptr) {
-        // Check if we are over pagination limit to determine if we need to set
-        // the "end" element. If we don't go through this block, we know that
-        // when the loop terminates, we have <= to kPaginationLimit.
-        // Note that because we have already increased this node's
-        // refcount, we need to decrease it, but we can't unref while
-        // holding the lock, because this may lead to a deadlock.
-        if (servers.size() == kPaginationLimit) {
-          node_after_pagination_limit = std::move(node_ref);
-          break;
-        }
-        servers.emplace_back(std::move(node_ref));
-      }
-    }
-  }
-  Json::Object object;
-  if (!servers.empty()) {
-    // Create list of servers.
-    Json::Array array;
-    for (size_t i = 0; i < servers.size(); ++i) {
-      array.emplace_back(servers[i]->RenderJson());
-    }
-    object["server"] = Json::FromArray(std::move(array));
-  }
-  if (node_after_pagination_limit == nullptr) {
-    object["end"] = Json::FromBool(true);
-  }
-  return JsonDump(Json::FromObject(std::move(object)));
+  return RenderPage(QueryNodes(BaseNode::EntityType::kServer, start_server_id,
+                               kPaginationLimit),
+                    "server");
 }
 
 void ChannelzRegistry::InternalLogAllEntities() {
   std::vector<RefCountedPtr<BaseNode>> nodes;
-  {
-    MutexLock lock(&mu_);
-    for (auto& p : node_map_) {
-      RefCountedPtr<BaseNode> node = p.second->RefIfNonZero();
-      if (node != nullptr) {
-        nodes.emplace_back(std::move(node));
+  for (Shard& shard : shards_) {
+    MutexLock lock(&shard.mu);
+    for (const auto& shard_nodes : shard.nodes) {
+      for (const auto& p : shard_nodes) {
+        RefCountedPtr<BaseNode> node = p.second->RefIfNonZero();
+        if (node != nullptr) {
+          nodes.emplace_back(std::move(node));
+        }
       }
     }
   }
@@ -21,9 +21,13 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <array>
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <map>
 #include <string>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "src/core/channelz/channelz.h"
@@ -35,12 +39,20 @@ namespace channelz {
 
 // singleton registry object to track all objects that are needed to support
 // channelz bookkeeping. All objects share globally distributed uuids.
+//
+// Nodes are spread over kNumShards shards by uuid, and within each shard are
+// kept apart by entity type, so that registering a node contends only with
+// the nodes of its shard and listing the top channels or servers never
+// visits subchannels or sockets. A listing takes each shard's lock only to
+// collect references to one page of nodes, and renders them unlocked.
 class ChannelzRegistry final {
  public:
   static void Register(BaseNode* node) {
     return Default()->InternalRegister(node);
   }
-  static void Unregister(intptr_t uuid) { Default()->InternalUnregister(uuid); }
+  static void Unregister(BaseNode* node) {
+    Default()->InternalUnregister(node);
+  }
   static RefCountedPtr<BaseNode> Get(intptr_t uuid) {
     return Default()->InternalGet(uuid);
   }
@@ -64,21 +76,33 @@ class ChannelzRegistry final {
   // Test only helper function to reset to initial state.
   static void TestOnlyReset() {
     auto* p = Default();
-    MutexLock lock(&p->mu_);
-    p->node_map_.clear();
-    p->uuid_generator_ = 0;
+    for (Shard& shard : p->shards_) {
+      MutexLock lock(&shard.mu);
+      for (auto& nodes : shard.nodes) nodes.clear();
+    }
+    p->uuid_generator_.store(0, std::memory_order_relaxed);
   }
 
  private:
+  static constexpr size_t kNumShards = 16;
+  static constexpr size_t kNumEntityTypes =
+      static_cast<size_t>(BaseNode::EntityType::kSocket) + 1;
+
+  struct Shard {
+    Mutex mu;
+    // The nodes of each entity type, by uuid.
+    std::array<std::map<intptr_t, BaseNode*>, kNumEntityTypes> nodes
+        ABSL_GUARDED_BY(mu);
+  };
+
   // Returned the singleton instance of ChannelzRegistry;
   static ChannelzRegistry* Default();
 
   // globally registers an Entry. Returns its unique uuid
   void InternalRegister(BaseNode* node);
 
-  // globally unregisters the object that is associated to uuid. Also does
-  // sanity check that an object doesn't try to unregister the wrong type.
-  void InternalUnregister(intptr_t uuid);
+  // globally unregisters node.
+  void InternalUnregister(BaseNode* node);
 
   // if object with uuid has previously been registered as the correct type,
   // returns the void* associated with that uuid. Else returns nullptr.
@@ -87,12 +111,20 @@ class ChannelzRegistry final {
   std::string InternalGetTopChannels(intptr_t start_channel_id);
   std::string InternalGetServers(intptr_t start_server_id);
 
+  // Returns references to the live nodes of type with uuids from start_id,
+  // in uuid order: up to max_results of them, plus one more if there are
+  // more. Nodes registered after the call began are left out, so that pages
+  // are not shifted by nodes being created during a scrape.
+  std::vector<RefCountedPtr<BaseNode>> QueryNodes(BaseNode::EntityType type,
+                                                  intptr_t start_id,
+                                                  size_t max_results);
+
   void InternalLogAllEntities();
 
-  // protects members
-  Mutex mu_;
-  std::map<intptr_t, BaseNode*> node_map_ ABSL_GUARDED_BY(mu_);
-  intptr_t uuid_generator_ ABSL_GUARDED_BY(mu_) = 0;
+  Shard& ShardFor(intptr_t uuid) { return shards_[uuid % kNumShards]; }
+
+  std::atomic<intptr_t> uuid_generator_{0};
+  std::array<Shard, kNumShards> shards_;
 };
 
 }  // namespace channelz
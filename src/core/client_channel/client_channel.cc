@@ -606,7 +606,8 @@ ClientChannel::ClientChannel(
     ClientChannelFactory* client_channel_factory,
     CallDestinationFactory* call_destination_factory)
     : Channel(std::move(target), channel_args),
-      channel_args_(std::move(channel_args)),
+      channel_args_(Subchannel::AssignSubchannelCoalescingGroup(
+          std::move(channel_args))),
       event_engine_(channel_args_.GetObjectRef<EventEngine>()),
       uri_to_resolve_(std::move(uri_to_resolve)),
       service_config_parser_index_(
@@ -848,7 +849,8 @@ grpc_call* ClientChannel::CreateCall(
     grpc_call* parent_call, uint32_t propagation_mask,
     grpc_completion_queue* cq, grpc_pollset_set* /*pollset_set_alternative*/,
     Slice path, std::optional<Slice> authority, Timestamp deadline, bool) {
-  auto arena = call_arena_allocator()->MakeArena();
+  auto arena =
+      call_arena_allocator()->MakeArenaForMethod(path.as_string_view());
   arena->SetContext<grpc_event_engine::experimental::EventEngine>(
       event_engine());
   return MakeClientCall(parent_call, propagation_mask, cq, std::move(path),
@@ -1313,11 +1315,7 @@ void ClientChannel::UpdateStateLocked(grpc_connectivity_state state,
   state_tracker_.SetState(state, status, reason);
   if (channelz_node_ != nullptr) {
     channelz_node_->SetConnectivityState(state);
-    channelz_node_->AddTraceEvent(
-        channelz::ChannelTrace::Severity::Info,
-        grpc_slice_from_static_string(
-            channelz::ChannelNode::GetChannelConnectivityStateChangeString(
-                state)));
+    channelz_node_->AddConnectivityStateChangeTraceEvent(state);
   }
 }
 
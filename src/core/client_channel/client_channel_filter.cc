@@ -1042,7 +1042,8 @@ RefCountedPtr<SubchannelPoolInterface> GetSubchannelPool(
 
 ClientChannelFilter::ClientChannelFilter(grpc_channel_element_args* args,
                                          grpc_error_handle* error)
-    : channel_args_(args->channel_args),
+    : channel_args_(
+          Subchannel::AssignSubchannelCoalescingGroup(args->channel_args)),
       owning_stack_(args->channel_stack),
       client_channel_factory_(channel_args_.GetObject<ClientChannelFactory>()),
       channelz_node_(channel_args_.GetObject<channelz::ChannelNode>()),
@@ -1557,11 +1558,7 @@ void ClientChannelFilter::UpdateStateLocked(grpc_connectivity_state state,
   state_tracker_.SetState(state, status, reason);
   if (channelz_node_ != nullptr) {
     channelz_node_->SetConnectivityState(state);
-    channelz_node_->AddTraceEvent(
-        channelz::ChannelTrace::Severity::Info,
-        grpc_slice_from_static_string(
-            channelz::ChannelNode::GetChannelConnectivityStateChangeString(
-                state)));
+    channelz_node_->AddConnectivityStateChangeTraceEvent(state);
   }
 }
 
@@ -1575,6 +1572,21 @@ void ClientChannelFilter::UpdateStateAndPickerLocked(
   // Old picker will be unreffed after releasing the lock.
   MutexLock lock(&lb_mu_);
   picker_.swap(picker);
+  // If the new picker would just queue every pick again, retrying them all
+  // only wakes up every queued call for nothing, which adds up when a
+  // channel sits in CONNECTING with many calls queued.  Retry just one of
+  // them, so that a QueuePicker still gets a pick to kick its policy out of
+  // IDLE with.
+  if (picker_ != nullptr && picker_->QueuesAllPicks()) {
+    if (!lb_queued_calls_.empty()) {
+      auto it = lb_queued_calls_.begin();
+      RefCountedPtr<LoadBalancedCall> call = *it;
+      lb_queued_calls_.erase(it);
+      call->RemoveCallFromLbQueuedCallsLocked();
+      call->RetryPickLocked();
+    }
+    return;
+  }
   // Reprocess queued picks.
   for (auto& call : lb_queued_calls_) {
     call->RemoveCallFromLbQueuedCallsLocked();
@@ -72,7 +72,8 @@ grpc_call* DirectChannel::CreateCall(
     grpc_completion_queue* cq, grpc_pollset_set* /*pollset_set_alternative*/,
     Slice path, std::optional<Slice> authority, Timestamp deadline,
     bool /*registered_method*/) {
-  auto arena = call_arena_allocator()->MakeArena();
+  auto arena =
+      call_arena_allocator()->MakeArenaForMethod(path.as_string_view());
   arena->SetContext<grpc_event_engine::experimental::EventEngine>(
       event_engine_.get());
   return MakeClientCall(parent_call, propagation_mask, cq, std::move(path),
@@ -20,6 +20,8 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <algorithm>
+#include <string>
 #include <utility>
 
 #include "src/core/client_channel/subchannel.h"
@@ -62,4 +64,31 @@ RefCountedPtr<Subchannel> GlobalSubchannelPool::FindSubchannel(
   return it->second->RefIfNonZero();
 }
 
+Duration GlobalSubchannelPool::ReserveConnectAttempt(
+    const grpc_resolved_address& address, double attempts_per_second,
+    int burst) {
+  const Duration interval = Duration::FromSecondsAsDouble(
+      1.0 / std::max(attempts_per_second, 1e-3));
+  const Timestamp now = Timestamp::Now();
+  MutexLock lock(&connect_mu_);
+  if (connect_buckets_.size() > kMaxIdleConnectBuckets) {
+    for (auto it = connect_buckets_.begin(); it != connect_buckets_.end();) {
+      if (it->second <= now) {
+        it = connect_buckets_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+  Timestamp& full_at =
+      connect_buckets_
+          .emplace(std::string(address.addr, address.len), Timestamp())
+          .first->second;
+  full_at = std::max(full_at, now);
+  const Timestamp start =
+      std::max(now, full_at - interval * (std::max(burst, 1) - 1));
+  full_at += interval;
+  return start - now;
+}
+
 }  // namespace grpc_core
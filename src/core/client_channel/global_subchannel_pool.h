@@ -22,11 +22,14 @@
 #include <grpc/support/port_platform.h>
 
 #include <map>
+#include <string>
 
 #include "absl/base/thread_annotations.h"
 #include "src/core/client_channel/subchannel_pool_interface.h"
+#include "src/core/lib/iomgr/resolved_address.h"
 #include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/sync.h"
+#include "src/core/util/time.h"
 
 namespace grpc_core {
 
@@ -47,7 +50,20 @@ class GlobalSubchannelPool final : public SubchannelPoolInterface {
   RefCountedPtr<Subchannel> FindSubchannel(const SubchannelKey& key) override
       ABSL_LOCKS_EXCLUDED(mu_);
 
+  // Reserves a connection attempt to address from a token bucket shared by
+  // every subchannel in the process, whichever pool it is in. The bucket
+  // holds up to burst attempts and refills at attempts_per_second, using the
+  // values of whichever caller draws from it. Returns how long the caller
+  // must wait before starting the attempt, so that after a backend restart
+  // the reconnects from all channels reach it spread out over time.
+  Duration ReserveConnectAttempt(const grpc_resolved_address& address,
+                                 double attempts_per_second, int burst)
+      ABSL_LOCKS_EXCLUDED(connect_mu_);
+
  private:
+  // Past this many buckets, full ones are dropped.
+  static constexpr size_t kMaxIdleConnectBuckets = 1024;
+
   GlobalSubchannelPool() {}
   ~GlobalSubchannelPool() override {}
 
@@ -55,6 +71,12 @@ class GlobalSubchannelPool final : public SubchannelPoolInterface {
   std::map<SubchannelKey, Subchannel*> subchannel_map_ ABSL_GUARDED_BY(mu_);
   // To protect subchannel_map_.
   Mutex mu_;
+
+  // Per address, when the bucket next becomes full again. Each reserved
+  // attempt pushes this out by one refill interval.
+  std::map<std::string, Timestamp> connect_buckets_
+      ABSL_GUARDED_BY(connect_mu_);
+  Mutex connect_mu_;
 };
 
 }  // namespace grpc_core
@@ -129,8 +129,14 @@ RetryFilter::RetryFilter(const ChannelArgs& args, grpc_error_handle* error)
 const RetryMethodConfig* RetryFilter::GetRetryPolicy(Arena* arena) {
   auto* svc_cfg_call_data = arena->GetContext<ServiceConfigCallData>();
   if (svc_cfg_call_data == nullptr) return nullptr;
-  return static_cast<const RetryMethodConfig*>(
+  auto* method_config = static_cast<const RetryMethodConfig*>(
       svc_cfg_call_data->GetMethodParsedConfig(service_config_parser_index_));
+  // This filter does not implement hedging, so methods with a hedging
+  // policy are sent as a single attempt.
+  if (method_config != nullptr && method_config->hedging_policy().has_value()) {
+    return nullptr;
+  }
+  return method_config;
 }
 
 const grpc_channel_filter RetryFilter::kVtable = {
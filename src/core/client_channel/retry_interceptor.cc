@@ -14,10 +14,14 @@
 
 #include "src/core/client_channel/retry_interceptor.h"
 
+#include <algorithm>
+
 #include "src/core/lib/promise/cancel_callback.h"
 #include "src/core/lib/promise/for_each.h"
+#include "src/core/lib/promise/loop.h"
 #include "src/core/lib/promise/map.h"
 #include "src/core/lib/promise/sleep.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
 #include "src/core/service_config/service_config_call_data.h"
 
 namespace grpc_core {
@@ -31,6 +35,21 @@ size_t GetMaxPerRpcRetryBufferSize(const ChannelArgs& args) {
                    .value_or(kDefaultPerRpcRetryBufferSize),
                0, INT_MAX);
 }
+
+size_t GetPerRpcRetryBufferMaxSize(const ChannelArgs& args,
+                                   size_t per_rpc_retry_buffer_size) {
+  return std::max<size_t>(
+      per_rpc_retry_buffer_size,
+      Clamp(args.GetInt(GRPC_ARG_EXPERIMENTAL_PER_RPC_RETRY_BUFFER_MAX_SIZE)
+                .value_or(0),
+            0, INT_MAX));
+}
+
+MemoryQuotaRefPtr GetMemoryQuota(const ChannelArgs& args) {
+  auto* resource_quota = args.GetObject<ResourceQuota>();
+  if (resource_quota == nullptr) return nullptr;
+  return resource_quota->memory_quota();
+}
 }  // namespace
 
 namespace retry_detail {
@@ -131,6 +150,44 @@ std::optional<Duration> RetryState::ShouldRetry(
   return next_attempt_timeout;
 }
 
+bool RetryState::IsNonFatalHedgingFailure(
+    const ServerMetadata& md,
+    absl::FunctionRef<std::string()> lazy_attempt_debug_string) {
+  const auto status = md.get(GrpcStatusMetadata());
+  if (status.has_value()) {
+    if (GPR_LIKELY(*status == GRPC_STATUS_OK)) {
+      if (retry_throttle_data_ != nullptr) {
+        retry_throttle_data_->RecordSuccess();
+      }
+      GRPC_TRACE_LOG(retry, INFO)
+          << lazy_attempt_debug_string() << " call succeeded";
+      return false;
+    }
+    if (!hedging_policy()->non_fatal_status_codes().Contains(*status)) {
+      GRPC_TRACE_LOG(retry, INFO) << lazy_attempt_debug_string() << ": status "
+                                  << grpc_status_code_to_string(*status)
+                                  << " not configured as non-fatal";
+      return false;
+    }
+  }
+  // As for retries, only failures with a non-fatal status are recorded.
+  // Once hedging is throttled, the attempts already started carry on, but
+  // no more are started.
+  if (retry_throttle_data_ != nullptr &&
+      !retry_throttle_data_->RecordFailure()) {
+    GRPC_TRACE_LOG(retry, INFO)
+        << lazy_attempt_debug_string() << " hedging throttled";
+    hedging_stopped_ = true;
+  }
+  const auto server_pushback = md.get(GrpcRetryPushbackMsMetadata());
+  if (server_pushback.has_value() && server_pushback < Duration::Zero()) {
+    GRPC_TRACE_LOG(retry, INFO) << lazy_attempt_debug_string()
+                                << " not hedging due to server push-back";
+    hedging_stopped_ = true;
+  }
+  return true;
+}
+
 absl::StatusOr<RefCountedPtr<internal::ServerRetryThrottleData>>
 ServerRetryThrottleDataFromChannelArgs(const ChannelArgs& args) {
   // Get retry throttling parameters from service config.
@@ -177,6 +234,9 @@ RetryInterceptor::RetryInterceptor(
     const ChannelArgs& args,
     RefCountedPtr<internal::ServerRetryThrottleData> retry_throttle_data)
     : per_rpc_retry_buffer_size_(GetMaxPerRpcRetryBufferSize(args)),
+      per_rpc_retry_buffer_max_size_(
+          GetPerRpcRetryBufferMaxSize(args, per_rpc_retry_buffer_size_)),
+      memory_quota_(GetMemoryQuota(args)),
       service_config_parser_index_(
           internal::RetryServiceConfigParser::ParserIndex()),
       retry_throttle_data_(std::move(retry_throttle_data)) {}
@@ -206,7 +266,8 @@ RetryInterceptor::Call::Call(RefCountedPtr<RetryInterceptor> interceptor,
     : call_handler_(std::move(call_handler)),
       interceptor_(std::move(interceptor)),
       retry_state_(interceptor_->GetRetryPolicy(),
-                   interceptor_->retry_throttle_data_) {
+                   interceptor_->retry_throttle_data_),
+      hedging_policy_(retry_state_.hedging_policy()) {
   GRPC_TRACE_LOG(retry, INFO)
       << DebugTag() << " retry call created: " << retry_state_;
 }
@@ -238,6 +299,19 @@ auto RetryInterceptor::Call::ClientToBuffer() {
       });
 }
 
+// Starts another attempt every hedging delay, for as long as the call may
+// have more attempts.
+auto RetryInterceptor::Call::HedgingDelayLoop() {
+  return Loop([self = Ref()]() {
+    return Map(Sleep(self->hedging_policy_->hedging_delay()),
+               [self](absl::Status) -> LoopCtl<absl::Status> {
+                 if (!self->CanStartHedgedAttempt()) return absl::OkStatus();
+                 self->StartHedgedAttempt();
+                 return Continue{};
+               });
+  });
+}
+
 void RetryInterceptor::Call::Start() {
   call_handler_.SpawnGuarded("client_to_buffer", [self = Ref()]() {
     return OnCancel(Map(self->ClientToBuffer(),
@@ -251,9 +325,17 @@ void RetryInterceptor::Call::Start() {
                         }),
                     [self]() { self->request_buffer_.Cancel(); });
   });
+  if (hedging_policy_ != nullptr) {
+    call_handler_.SpawnGuardedUntilCallCompletes(
+        "hedging_delay", [self = Ref()]() { return self->HedgingDelayLoop(); });
+  }
 }
 
 void RetryInterceptor::Call::StartAttempt() {
+  if (hedging_policy_ != nullptr) {
+    StartHedgedAttempt();
+    return;
+  }
   if (current_attempt_ != nullptr) {
     current_attempt_->Cancel();
   }
@@ -265,9 +347,79 @@ void RetryInterceptor::Call::StartAttempt() {
 void RetryInterceptor::Call::MaybeCommit(size_t buffered) {
   GRPC_TRACE_LOG(retry, INFO) << DebugTag() << " buffered:" << buffered << "/"
                               << interceptor_->per_rpc_retry_buffer_size_;
-  if (buffered >= interceptor_->per_rpc_retry_buffer_size_) {
-    std::ignore = current_attempt_->Commit();
+  if (buffered < interceptor_->per_rpc_retry_buffer_size_) return;
+  // Up to the max size, a call that outgrows the buffer size stays
+  // retryable unless memory is short.  The buffered payloads share their
+  // slices with the attempts, so holding on to them costs no copies.
+  if (buffered < interceptor_->per_rpc_retry_buffer_max_size_ &&
+      interceptor_->memory_quota_ != nullptr &&
+      !interceptor_->memory_quota_->IsMemoryPressureHigh()) {
+    GRPC_TRACE_LOG(retry, INFO)
+        << DebugTag() << " over buffer size, but memory pressure is low";
+    return;
   }
+  // A hedged call commits to its oldest attempt.
+  Attempt* attempt = hedging_policy_ == nullptr ? current_attempt_
+                     : hedged_attempts_.empty() ? nullptr
+                                                : hedged_attempts_.front();
+  if (attempt != nullptr) std::ignore = attempt->Commit();
+}
+
+bool RetryInterceptor::Call::CanStartHedgedAttempt() const {
+  return !request_buffer_.committed() && !retry_state_.hedging_stopped() &&
+         num_attempts_started_ < hedging_policy_->max_attempts();
+}
+
+void RetryInterceptor::Call::StartHedgedAttempt() {
+  auto attempt = call_handler_.arena()->MakeRefCounted<Attempt>(Ref());
+  ++num_attempts_started_;
+  hedged_attempts_.push_back(attempt.get());
+  attempt->Start();
+}
+
+void RetryInterceptor::Call::RemoveHedgedAttempt(Attempt* attempt) {
+  auto it = std::find(hedged_attempts_.begin(), hedged_attempts_.end(),
+                      attempt);
+  if (it != hedged_attempts_.end()) hedged_attempts_.erase(it);
+}
+
+bool RetryInterceptor::Call::CanCommit(Attempt* attempt) {
+  ABSL_CHECK(attempt != nullptr);
+  if (hedging_policy_ == nullptr) return current_attempt_ == attempt;
+  return !request_buffer_.committed() &&
+         std::find(hedged_attempts_.begin(), hedged_attempts_.end(),
+                   attempt) != hedged_attempts_.end();
+}
+
+void RetryInterceptor::Call::OnCommitted(Attempt* attempt) {
+  if (hedging_policy_ == nullptr) return;
+  // The other attempts of a hedged call lose.  Those that have not yet
+  // started their child call see the request buffer fail instead.
+  for (Attempt* other : hedged_attempts_) {
+    if (other != attempt) other->Cancel();
+  }
+}
+
+absl::Status RetryInterceptor::Call::FinishHedgedAttempt(
+    Attempt* attempt, ServerMetadataHandle md) {
+  // Once the call is committed, only the winning attempt's status counts.
+  if (!request_buffer_.committed() &&
+      retry_state_.IsNonFatalHedgingFailure(
+          *md, [attempt]() -> std::string { return attempt->DebugTag(); })) {
+    // The last attempt standing reports its status to the client.
+    const bool last =
+        hedged_attempts_.size() == 1 && !CanStartHedgedAttempt();
+    if (!last) {
+      RemoveHedgedAttempt(attempt);
+      // A non-fatal failure starts the next attempt without waiting out the
+      // hedging delay.
+      if (CanStartHedgedAttempt()) StartHedgedAttempt();
+      return absl::OkStatus();
+    }
+  }
+  if (!attempt->Commit()) return absl::CancelledError();
+  call_handler_.SpawnPushServerTrailingMetadata(std::move(md));
+  return absl::OkStatus();
 }
 
 std::string RetryInterceptor::Call::DebugTag() {
@@ -278,7 +430,9 @@ std::string RetryInterceptor::Call::DebugTag() {
 // RetryInterceptor::Attempt
 
 RetryInterceptor::Attempt::Attempt(RefCountedPtr<Call> call)
-    : call_(std::move(call)), reader_(call_->request_buffer()) {
+    : call_(std::move(call)),
+      num_previous_attempts_(call_->num_previous_attempts()),
+      reader_(call_->request_buffer()) {
   GRPC_TRACE_LOG(retry, INFO) << DebugTag() << " retry attempt created";
 }
 
@@ -324,22 +478,33 @@ auto RetryInterceptor::Attempt::ServerToClientGotTrailersOnlyResponse() {
         GRPC_TRACE_LOG(retry, INFO)
             << self->DebugTag()
             << " got server trailing metadata: " << md->DebugString();
-        auto delay = self->call_->ShouldRetry(
-            *md,
-            [self = self.get()]() -> std::string { return self->DebugTag(); });
+        const bool hedged = self->call_->hedging_policy() != nullptr;
         return If(
-            delay.has_value(),
-            [self, delay]() {
-              return Map(Sleep(*delay), [call = self->call_](absl::Status) {
-                call->StartAttempt();
-                return absl::OkStatus();
-              });
+            hedged,
+            [&]() {
+              return self->call_->FinishHedgedAttempt(self.get(),
+                                                      std::move(md));
             },
-            [self, md = std::move(md)]() mutable {
-              if (!self->Commit()) return absl::CancelledError();
-              self->call_->call_handler()->SpawnPushServerTrailingMetadata(
-                  std::move(md));
-              return absl::OkStatus();
+            [&]() {
+              auto delay = self->call_->ShouldRetry(
+                  *md, [self = self.get()]() -> std::string {
+                    return self->DebugTag();
+                  });
+              return If(
+                  delay.has_value(),
+                  [self, delay]() {
+                    return Map(Sleep(*delay),
+                               [call = self->call_](absl::Status) {
+                                 call->StartAttempt();
+                                 return absl::OkStatus();
+                               });
+                  },
+                  [self, md = std::move(md)]() mutable {
+                    if (!self->Commit()) return absl::CancelledError();
+                    self->call_->call_handler()
+                        ->SpawnPushServerTrailingMetadata(std::move(md));
+                    return absl::OkStatus();
+                  });
             });
       });
 }
@@ -364,9 +529,10 @@ bool RetryInterceptor::Attempt::Commit(SourceLocation whence) {
   if (committed_) return true;
   GRPC_TRACE_LOG(retry, INFO) << DebugTag() << " commit attempt from "
                               << whence.file() << ":" << whence.line();
-  if (!call_->IsCurrentAttempt(this)) return false;
+  if (!call_->CanCommit(this)) return false;
   committed_ = true;
   call_->request_buffer()->Commit(reader());
+  call_->OnCommitted(this);
   return true;
 }
 
@@ -374,10 +540,9 @@ auto RetryInterceptor::Attempt::ClientToServer() {
   return TrySeq(
       reader_.PullClientInitialMetadata(),
       [self = Ref()](ClientMetadataHandle metadata) {
-        int num_attempts_completed = self->call_->num_attempts_completed();
-        if (GPR_UNLIKELY(num_attempts_completed > 0)) {
+        if (GPR_UNLIKELY(self->num_previous_attempts_ > 0)) {
           metadata->Set(GrpcPreviousRpcAttemptsMetadata(),
-                        num_attempts_completed);
+                        self->num_previous_attempts_);
         } else {
           metadata->Remove(GrpcPreviousRpcAttemptsMetadata());
         }
@@ -399,7 +564,12 @@ void RetryInterceptor::Attempt::Start() {
       "buffer_to_server", [self = Ref()]() { return self->ClientToServer(); });
 }
 
-void RetryInterceptor::Attempt::Cancel() { initiator_.SpawnCancel(); }
+void RetryInterceptor::Attempt::Cancel() {
+  // An attempt that has not yet started its child call has nothing to
+  // cancel.
+  if (initiator_.party() == nullptr) return;
+  initiator_.SpawnCancel();
+}
 
 std::string RetryInterceptor::Attempt::DebugTag() const {
   return absl::StrFormat("%s attempt:%p", call_->DebugTag(), this);
@@ -15,11 +15,14 @@
 #ifndef GRPC_SRC_CORE_CLIENT_CHANNEL_RETRY_INTERCEPTOR_H
 #define GRPC_SRC_CORE_CLIENT_CHANNEL_RETRY_INTERCEPTOR_H
 
+#include <vector>
+
 #include "src/core/call/request_buffer.h"
 #include "src/core/client_channel/client_channel_args.h"
 #include "src/core/client_channel/retry_service_config.h"
 #include "src/core/client_channel/retry_throttle.h"
 #include "src/core/filter/filter_args.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
 #include "src/core/lib/transport/interception_chain.h"
 #include "src/core/util/backoff.h"
 
@@ -39,6 +42,24 @@ class RetryState {
       absl::FunctionRef<std::string()> lazy_attempt_debug_string);
   int num_attempts_completed() const { return num_attempts_completed_; }
 
+  // Set if the call is hedged rather than retried.
+  const internal::HedgingPolicy* hedging_policy() const {
+    if (retry_policy_ == nullptr ||
+        !retry_policy_->hedging_policy().has_value()) {
+      return nullptr;
+    }
+    return &*retry_policy_->hedging_policy();
+  }
+  // For hedged calls: records the outcome of an attempt that got a
+  // trailers-only response, and returns true if it failed with a non-fatal
+  // status, in which case the call goes on with its other attempts.
+  bool IsNonFatalHedgingFailure(
+      const ServerMetadata& md,
+      absl::FunctionRef<std::string()> lazy_attempt_debug_string);
+  // For hedged calls: true once retry throttling or server push-back has
+  // ruled out starting any more attempts.
+  bool hedging_stopped() const { return hedging_stopped_; }
+
   template <typename Sink>
   friend void AbslStringify(Sink& sink, const RetryState& state) {
     sink.Append(absl::StrCat(
@@ -53,6 +74,7 @@ class RetryState {
   const internal::RetryMethodConfig* const retry_policy_;
   RefCountedPtr<internal::ServerRetryThrottleData> retry_throttle_data_;
   int num_attempts_completed_ = 0;
+  bool hedging_stopped_ = false;
   BackOff retry_backoff_;
 };
 
@@ -96,28 +118,45 @@ class RetryInterceptor : public Interceptor {
       return retry_state_.ShouldRetry(md, request_buffer_.committed(),
                                       lazy_attempt_debug_string);
     }
-    int num_attempts_completed() const {
-      return retry_state_.num_attempts_completed();
+    // The value of grpc-previous-rpc-attempts for the next attempt.
+    int num_previous_attempts() const {
+      return hedging_policy_ != nullptr
+                 ? num_attempts_started_
+                 : retry_state_.num_attempts_completed();
+    }
+    const internal::HedgingPolicy* hedging_policy() const {
+      return hedging_policy_;
     }
     void RemoveAttempt(Attempt* attempt) {
       if (current_attempt_ == attempt) current_attempt_ = nullptr;
+      RemoveHedgedAttempt(attempt);
     }
-    bool IsCurrentAttempt(Attempt* attempt) {
-      ABSL_CHECK(attempt != nullptr);
-      return current_attempt_ == attempt;
-    }
+    bool CanCommit(Attempt* attempt);
+    void OnCommitted(Attempt* attempt);
+    // Handles the trailers-only response of an attempt of a hedged call.
+    absl::Status FinishHedgedAttempt(Attempt* attempt,
+                                     ServerMetadataHandle md);
 
     std::string DebugTag();
 
    private:
     void MaybeCommit(size_t buffered);
     auto ClientToBuffer();
+    auto HedgingDelayLoop();
+    bool CanStartHedgedAttempt() const;
+    void StartHedgedAttempt();
+    void RemoveHedgedAttempt(Attempt* attempt);
 
     RequestBuffer request_buffer_;
     CallHandler call_handler_;
     RefCountedPtr<RetryInterceptor> interceptor_;
     Attempt* current_attempt_ = nullptr;
     retry_detail::RetryState retry_state_;
+    const internal::HedgingPolicy* const hedging_policy_;
+    // For hedged calls: the attempts that are still in the running, in the
+    // order they were started, and the number of attempts started so far.
+    std::vector<Attempt*> hedged_attempts_;
+    int num_attempts_started_ = 0;
   };
 
   class Attempt final
@@ -140,6 +179,7 @@ class RetryInterceptor : public Interceptor {
     auto ServerToClientGotTrailersOnlyResponse();
 
     RefCountedPtr<Call> call_;
+    const int num_previous_attempts_;
     RequestBuffer::Reader reader_;
     CallInitiator initiator_;
     bool committed_ = false;
@@ -148,6 +188,9 @@ class RetryInterceptor : public Interceptor {
   const internal::RetryMethodConfig* GetRetryPolicy();
 
   const size_t per_rpc_retry_buffer_size_;
+  const size_t per_rpc_retry_buffer_max_size_;
+  // Null if the channel has no resource quota.
+  const MemoryQuotaRefPtr memory_quota_;
   const size_t service_config_parser_index_;
   const RefCountedPtr<internal::ServerRetryThrottleData> retry_throttle_data_;
 };
@@ -52,8 +52,43 @@ class RetryGlobalConfig final : public ServiceConfigParser::ParsedConfig {
   uintptr_t milli_token_ratio_ = 0;
 };
 
+// A hedging policy, as described in gRFC A6: up to max_attempts attempts
+// are started, one every hedging_delay, until one of them gets a response
+// that is not a failure with one of non_fatal_status_codes.
+class HedgingPolicy final {
+ public:
+  int max_attempts() const { return max_attempts_; }
+  Duration hedging_delay() const { return hedging_delay_; }
+  StatusCodeSet non_fatal_status_codes() const {
+    return non_fatal_status_codes_;
+  }
+
+  static const JsonLoaderInterface* JsonLoader(const JsonArgs&);
+  void JsonPostLoad(const Json& json, const JsonArgs& args,
+                    ValidationErrors* errors);
+
+  template <typename Sink>
+  friend void AbslStringify(Sink& sink, const HedgingPolicy& policy) {
+    sink.Append(absl::StrCat(
+        "max_attempts:", policy.max_attempts_,
+        " hedging_delay:", policy.hedging_delay_, " non_fatal_status_codes:",
+        policy.non_fatal_status_codes_.ToString()));
+  }
+
+ private:
+  int max_attempts_ = 0;
+  Duration hedging_delay_;
+  StatusCodeSet non_fatal_status_codes_;
+};
+
 class RetryMethodConfig final : public ServiceConfigParser::ParsedConfig {
  public:
+  RetryMethodConfig() = default;
+  // Creates the config for a method that uses hedging instead of retries.
+  explicit RetryMethodConfig(const HedgingPolicy& hedging_policy)
+      : max_attempts_(hedging_policy.max_attempts()),
+        hedging_policy_(hedging_policy) {}
+
   int max_attempts() const { return max_attempts_; }
   Duration initial_backoff() const { return initial_backoff_; }
   Duration max_backoff() const { return max_backoff_; }
@@ -64,6 +99,11 @@ class RetryMethodConfig final : public ServiceConfigParser::ParsedConfig {
   std::optional<Duration> per_attempt_recv_timeout() const {
     return per_attempt_recv_timeout_;
   }
+  // Set if the method uses hedging instead of retries, in which case only
+  // max_attempts() is also set.
+  const std::optional<HedgingPolicy>& hedging_policy() const {
+    return hedging_policy_;
+  }
 
   static const JsonLoaderInterface* JsonLoader(const JsonArgs&);
   void JsonPostLoad(const Json& json, const JsonArgs& args,
@@ -79,6 +119,10 @@ class RetryMethodConfig final : public ServiceConfigParser::ParsedConfig {
         " per_attempt_recv_timeout:",
         config.per_attempt_recv_timeout_.has_value()
             ? absl::StrCat(*config.per_attempt_recv_timeout_)
+            : "none",
+        " hedging_policy:",
+        config.hedging_policy_.has_value()
+            ? absl::StrCat(*config.hedging_policy_)
             : "none"));
   }
 
@@ -89,6 +133,7 @@ class RetryMethodConfig final : public ServiceConfigParser::ParsedConfig {
   float backoff_multiplier_ = 0;
   StatusCodeSet retryable_status_codes_;
   std::optional<Duration> per_attempt_recv_timeout_;
+  std::optional<HedgingPolicy> hedging_policy_;
 };
 
 class RetryServiceConfigParser final : public ServiceConfigParser::Parser {
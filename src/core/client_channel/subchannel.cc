@@ -24,6 +24,8 @@
 #include <limits.h>
 
 #include <algorithm>
+#include <atomic>
+#include <limits>
 #include <memory>
 #include <new>
 #include <optional>
@@ -33,11 +35,14 @@
 #include "absl/log/absl_log.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/cord.h"
+#include "absl/strings/ascii.h"
 #include "absl/strings/str_cat.h"
+#include "absl/strings/str_split.h"
 #include "absl/strings/string_view.h"
 #include "src/core/channelz/channel_trace.h"
 #include "src/core/channelz/channelz.h"
 #include "src/core/client_channel/client_channel_internal.h"
+#include "src/core/client_channel/global_subchannel_pool.h"
 #include "src/core/client_channel/subchannel_pool_interface.h"
 #include "src/core/config/core_configuration.h"
 #include "src/core/handshaker/proxy_mapper_registry.h"
@@ -106,12 +111,15 @@ ConnectedSubchannel::ConnectedSubchannel(const ChannelArgs& args)
 
 class LegacyConnectedSubchannel : public ConnectedSubchannel {
  public:
+  // transport is owned by channel_stack.
   LegacyConnectedSubchannel(
-      RefCountedPtr<grpc_channel_stack> channel_stack, const ChannelArgs& args,
+      RefCountedPtr<grpc_channel_stack> channel_stack, Transport* transport,
+      const ChannelArgs& args,
       RefCountedPtr<channelz::SubchannelNode> channelz_node)
       : ConnectedSubchannel(args),
         channelz_node_(std::move(channelz_node)),
-        channel_stack_(std::move(channel_stack)) {}
+        channel_stack_(std::move(channel_stack)),
+        transport_(transport) {}
 
   ~LegacyConnectedSubchannel() override {
     channel_stack_.reset(DEBUG_LOCATION, "ConnectedSubchannel");
@@ -160,9 +168,24 @@ class LegacyConnectedSubchannel : public ConnectedSubchannel {
     elem->filter->start_transport_op(elem, op);
   }
 
+  uint32_t GetSpareStreamCapacity() const override {
+    const std::optional<uint32_t> limit =
+        transport_->PeerMaxConcurrentStreams();
+    if (!limit.has_value()) return std::numeric_limits<uint32_t>::max();
+    const uint32_t active_calls = active_calls_.load(std::memory_order_relaxed);
+    return active_calls >= *limit ? 0 : *limit - active_calls;
+  }
+
+  void CallStarted() { active_calls_.fetch_add(1, std::memory_order_relaxed); }
+  void CallFinished() {
+    active_calls_.fetch_sub(1, std::memory_order_relaxed);
+  }
+
  private:
   RefCountedPtr<channelz::SubchannelNode> channelz_node_;
   RefCountedPtr<grpc_channel_stack> channel_stack_;
+  Transport* const transport_;
+  std::atomic<uint32_t> active_calls_{0};
 };
 
 //
@@ -220,6 +243,11 @@ class NewConnectedSubchannel : public ConnectedSubchannel {
     Crash("legacy ping method called in call v3 impl");
   }
 
+  // TODO(roth): Count calls on the v3 stack too.
+  uint32_t GetSpareStreamCapacity() const override {
+    return std::numeric_limits<uint32_t>::max();
+  }
+
  private:
   RefCountedPtr<UnstartedCallDestination> call_destination_;
   RefCountedPtr<TransportCallDestination> transport_;
@@ -242,6 +270,7 @@ SubchannelCall::SubchannelCall(Args args, grpc_error_handle* error)
     : connected_subchannel_(args.connected_subchannel
                                 .TakeAsSubclass<LegacyConnectedSubchannel>()),
       deadline_(args.deadline) {
+  connected_subchannel_->CallStarted();
   grpc_call_stack* callstk = SUBCHANNEL_CALL_TO_CALL_STACK(this);
   const grpc_call_element_args call_args = {
       callstk,              // call_stack
@@ -310,6 +339,7 @@ void SubchannelCall::Destroy(void* arg, grpc_error_handle /*error*/) {
   SubchannelCall* self = static_cast<SubchannelCall*>(arg);
   // Keep some members before destroying the subchannel call.
   grpc_closure* after_call_stack_destroy = self->after_call_stack_destroy_;
+  self->connected_subchannel_->CallFinished();
   RefCountedPtr<ConnectedSubchannel> connected_subchannel =
       std::move(self->connected_subchannel_);
   // Destroy the subchannel call.
@@ -390,8 +420,10 @@ class Subchannel::ConnectedSubchannelStateWatcher final
     : public AsyncConnectivityStateWatcherInterface {
  public:
   // Must be instantiated while holding c->mu.
-  explicit ConnectedSubchannelStateWatcher(WeakRefCountedPtr<Subchannel> c)
-      : subchannel_(std::move(c)) {}
+  ConnectedSubchannelStateWatcher(WeakRefCountedPtr<Subchannel> c,
+                                  ConnectedSubchannel* connected_subchannel)
+      : subchannel_(std::move(c)),
+        connected_subchannel_(connected_subchannel) {}
 
   ~ConnectedSubchannelStateWatcher() override {
     subchannel_.reset(DEBUG_LOCATION, "state_watcher");
@@ -403,37 +435,19 @@ class Subchannel::ConnectedSubchannelStateWatcher final
     Subchannel* c = subchannel_.get();
     {
       MutexLock lock(&c->mu_);
-      // If we're either shutting down or have already seen this connection
-      // failure (i.e., c->connected_subchannel_ is null), do nothing.
-      //
-      // The transport reports TRANSIENT_FAILURE upon GOAWAY but SHUTDOWN
-      // upon connection close.  So if the server gracefully shuts down,
-      // we will see TRANSIENT_FAILURE followed by SHUTDOWN, but if not, we
-      // will see only SHUTDOWN.  Either way, we react to the first one we
-      // see, ignoring anything that happens after that.
-      if (c->connected_subchannel_ == nullptr) return;
-      if (new_state == GRPC_CHANNEL_TRANSIENT_FAILURE ||
-          new_state == GRPC_CHANNEL_SHUTDOWN) {
-        GRPC_TRACE_LOG(subchannel, INFO)
-            << "subchannel " << c << " " << c->key_.ToString()
-            << ": Connected subchannel " << c->connected_subchannel_.get()
-            << " reports " << ConnectivityStateName(new_state) << ": "
-            << status;
-        c->connected_subchannel_.reset();
-        if (c->channelz_node() != nullptr) {
-          c->channelz_node()->SetChildSocket(nullptr);
-        }
-        // Even though we're reporting IDLE instead of TRANSIENT_FAILURE here,
-        // pass along the status from the transport, since it may have
-        // keepalive info attached to it that the channel needs.
-        // TODO(roth): Consider whether there's a cleaner way to do this.
-        c->SetConnectivityStateLocked(GRPC_CHANNEL_IDLE, status);
-        c->backoff_.Reset();
+      if (!lost_ && (new_state == GRPC_CHANNEL_TRANSIENT_FAILURE ||
+                     new_state == GRPC_CHANNEL_SHUTDOWN)) {
+        lost_ = true;
+        c->OnConnectionLostLocked(connected_subchannel_, new_state, status);
       }
     }
   }
 
   WeakRefCountedPtr<Subchannel> subchannel_;
+  // Only compared against, never dereferenced.
+  ConnectedSubchannel* const connected_subchannel_;
+  // Guarded by subchannel_->mu_.
+  bool lost_ = false;
 };
 
 //
@@ -517,6 +531,15 @@ Subchannel::Subchannel(SubchannelKey key,
       connector_(std::move(connector)),
       watcher_list_(this),
       work_serializer_(args_.GetObjectRef<EventEngine>()),
+      max_connections_(std::max(
+          1, args_.GetInt(GRPC_ARG_MAX_CONNECTIONS_PER_SUBCHANNEL)
+                 .value_or(1))),
+      connect_attempts_per_second_(std::max(
+          0, args_.GetInt(GRPC_ARG_SUBCHANNEL_CONNECT_ATTEMPTS_PER_SECOND)
+                 .value_or(0))),
+      connect_attempts_burst_(std::max(
+          1, args_.GetInt(GRPC_ARG_SUBCHANNEL_CONNECT_ATTEMPTS_BURST)
+                 .value_or(16))),
       backoff_(ParseArgsForBackoffValues(args_, &min_connect_timeout_)),
       event_engine_(args_.GetObjectRef<EventEngine>()) {
   // A grpc_init is added here to ensure that grpc_shutdown does not happen
@@ -666,6 +689,7 @@ void Subchannel::Orphaned() {
   shutdown_ = true;
   connector_.reset();
   connected_subchannel_.reset();
+  extra_connections_.clear();
 }
 
 void Subchannel::GetOrAddDataProducer(
@@ -705,12 +729,7 @@ void Subchannel::SetConnectivityStateLocked(grpc_connectivity_state state,
   }
   if (channelz_node_ != nullptr) {
     channelz_node_->UpdateConnectivityState(state);
-    channelz_node_->AddTraceEvent(
-        channelz::ChannelTrace::Severity::Info,
-        grpc_slice_from_cpp_string(absl::StrCat(
-            "Subchannel connectivity state changed to ",
-            ConnectivityStateName(state),
-            status.ok() ? "" : absl::StrCat(": ", status_.ToString()))));
+    channelz_node_->AddConnectivityStateChangeTraceEvent(state, status_);
   }
   // Notify watchers.
   watcher_list_.NotifyLocked(state, status_);
@@ -732,15 +751,52 @@ void Subchannel::OnRetryTimerLocked() {
 void Subchannel::StartConnectingLocked() {
   // Set next attempt time.
   const Timestamp now = Timestamp::Now();
-  const Timestamp min_deadline = now + min_connect_timeout_;
   next_attempt_time_ = now + backoff_.NextAttemptDelay();
   // Report CONNECTING.
   SetConnectivityStateLocked(GRPC_CHANNEL_CONNECTING, absl::OkStatus());
+  // If the connector is still busy opening an extra connection, that attempt
+  // becomes this one.
+  if (scaling_connection_attempt_) {
+    scaling_connection_attempt_ = false;
+    return;
+  }
+  // Wait for our turn if too many subchannels in the process are connecting
+  // to this address.
+  if (connect_attempts_per_second_ > 0) {
+    const Duration delay =
+        GlobalSubchannelPool::instance()->ReserveConnectAttempt(
+            key_.address(), connect_attempts_per_second_,
+            connect_attempts_burst_);
+    if (delay > Duration::Zero()) {
+      GRPC_TRACE_LOG(subchannel, INFO)
+          << "subchannel " << this << " " << key_.ToString()
+          << ": delaying connection attempt by " << delay.millis()
+          << " ms to stay under the per-address limit";
+      next_attempt_time_ += delay;
+      event_engine_->RunAfter(
+          delay, [self = WeakRef(DEBUG_LOCATION, "ConnectDelay")]() mutable {
+            ApplicationCallbackExecCtx callback_exec_ctx;
+            ExecCtx exec_ctx;
+            {
+              MutexLock lock(&self->mu_);
+              if (!self->shutdown_) self->ConnectLocked();
+            }
+            // Reset before the ExecCtx goes away, as in the retry timer.
+            self.reset();
+          });
+      return;
+    }
+  }
+  ConnectLocked();
+}
+
+void Subchannel::ConnectLocked() {
   // Start connection attempt.
   SubchannelConnector::Args args;
   args.address = &address_for_connect_;
   args.interested_parties = pollset_set_;
-  args.deadline = std::max(next_attempt_time_, min_deadline);
+  args.deadline =
+      std::max(next_attempt_time_, Timestamp::Now() + min_connect_timeout_);
   args.channel_args = args_;
   WeakRef(DEBUG_LOCATION, "Connect").release();  // Ref held by callback.
   connector_->Connect(args, &connecting_result_, &on_connecting_finished_);
@@ -760,6 +816,18 @@ void Subchannel::OnConnectingFinishedLocked(grpc_error_handle error) {
     connecting_result_.Reset();
     return;
   }
+  // A failed attempt to open an extra connection leaves the subchannel as it
+  // was; the next pick that finds every connection full tries again.
+  if (scaling_connection_attempt_) {
+    scaling_connection_attempt_ = false;
+    if (connecting_result_.transport == nullptr || !PublishTransportLocked()) {
+      GRPC_TRACE_LOG(subchannel, INFO)
+          << "subchannel " << this << " " << key_.ToString()
+          << ": extra connection failed (" << StatusToString(error) << ")";
+      connecting_result_.Reset();
+    }
+    return;
+  }
   // If we didn't get a transport or we fail to publish it, report
   // TRANSIENT_FAILURE and start the retry timer.
   // Note that if the connection attempt took longer than the backoff
@@ -795,7 +863,9 @@ void Subchannel::OnConnectingFinishedLocked(grpc_error_handle error) {
 
 bool Subchannel::PublishTransportLocked() {
   auto socket_node = std::move(connecting_result_.socket_node);
+  RefCountedPtr<ConnectedSubchannel> connected_subchannel;
   if (connecting_result_.transport->filter_stack_transport() != nullptr) {
+    Transport* transport = connecting_result_.transport;
     // Construct channel stack.
     // Builder takes ownership of transport.
     ChannelStackBuilderImpl builder(
@@ -812,8 +882,8 @@ bool Subchannel::PublishTransportLocked() {
                  << ": error initializing subchannel stack: " << stack.status();
       return false;
     }
-    connected_subchannel_ = MakeRefCounted<LegacyConnectedSubchannel>(
-        std::move(*stack), args_, channelz_node_);
+    connected_subchannel = MakeRefCounted<LegacyConnectedSubchannel>(
+        std::move(*stack), transport, args_, channelz_node_);
   } else {
     OrphanablePtr<ClientTransport> transport(
         std::exchange(connecting_result_.transport, nullptr)
@@ -851,26 +921,180 @@ bool Subchannel::PublishTransportLocked() {
                  << call_destination.status();
       return false;
     }
-    connected_subchannel_ = MakeRefCounted<NewConnectedSubchannel>(
+    connected_subchannel = MakeRefCounted<NewConnectedSubchannel>(
         std::move(*call_destination), std::move(transport_destination), args_);
   }
   connecting_result_.Reset();
+  // Start watching connected subchannel.
+  connected_subchannel->StartWatch(
+      pollset_set_, MakeOrphanable<ConnectedSubchannelStateWatcher>(
+                        WeakRef(DEBUG_LOCATION, "state_watcher"),
+                        connected_subchannel.get()));
+  // If we already have a connection, this is an extra one. Channelz only
+  // shows the first connection's socket.
+  if (connected_subchannel_ != nullptr) {
+    GRPC_TRACE_LOG(subchannel, INFO)
+        << "subchannel " << this << " " << key_.ToString()
+        << ": extra connected subchannel at " << connected_subchannel.get();
+    extra_connections_.push_back(std::move(connected_subchannel));
+    return true;
+  }
   // Publish.
+  connected_subchannel_ = std::move(connected_subchannel);
   GRPC_TRACE_LOG(subchannel, INFO)
       << "subchannel " << this << " " << key_.ToString()
       << ": new connected subchannel at " << connected_subchannel_.get();
   if (channelz_node_ != nullptr) {
     channelz_node_->SetChildSocket(std::move(socket_node));
   }
-  // Start watching connected subchannel.
-  connected_subchannel_->StartWatch(
-      pollset_set_, MakeOrphanable<ConnectedSubchannelStateWatcher>(
-                        WeakRef(DEBUG_LOCATION, "state_watcher")));
   // Report initial state.
   SetConnectivityStateLocked(GRPC_CHANNEL_READY, absl::Status());
   return true;
 }
 
+RefCountedPtr<ConnectedSubchannel> Subchannel::PickConnectedSubchannelLocked() {
+  if (connected_subchannel_ == nullptr) return nullptr;
+  ConnectedSubchannel* best = connected_subchannel_.get();
+  uint32_t best_capacity = best->GetSpareStreamCapacity();
+  for (const auto& connected_subchannel : extra_connections_) {
+    const uint32_t capacity = connected_subchannel->GetSpareStreamCapacity();
+    if (capacity > best_capacity) {
+      best = connected_subchannel.get();
+      best_capacity = capacity;
+    }
+  }
+  // Every connection is full, so this call will queue in the transport.
+  // Open another connection for the ones after it.
+  if (best_capacity == 0 && !scaling_connection_attempt_ &&
+      extra_connections_.size() + 1 <
+          static_cast<size_t>(max_connections_)) {
+    StartScalingConnectionLocked();
+  }
+  return best->Ref();
+}
+
+void Subchannel::StartScalingConnectionLocked() {
+  GRPC_TRACE_LOG(subchannel, INFO)
+      << "subchannel " << this << " " << key_.ToString()
+      << ": all connections at MAX_CONCURRENT_STREAMS, opening another";
+  scaling_connection_attempt_ = true;
+  SubchannelConnector::Args args;
+  args.address = &address_for_connect_;
+  args.interested_parties = pollset_set_;
+  args.deadline = Timestamp::Now() + min_connect_timeout_;
+  args.channel_args = args_;
+  WeakRef(DEBUG_LOCATION, "Connect").release();  // Ref held by callback.
+  connector_->Connect(args, &connecting_result_, &on_connecting_finished_);
+}
+
+void Subchannel::OnConnectionLostLocked(
+    ConnectedSubchannel* connected_subchannel, grpc_connectivity_state state,
+    const absl::Status& status) {
+  // The transport reports TRANSIENT_FAILURE upon GOAWAY but SHUTDOWN
+  // upon connection close.  So if the server gracefully shuts down,
+  // we will see TRANSIENT_FAILURE followed by SHUTDOWN, but if not, we
+  // will see only SHUTDOWN.  Either way, we react to the first one we
+  // see, ignoring anything that happens after that.
+  auto it = std::find_if(
+      extra_connections_.begin(), extra_connections_.end(),
+      [&](const RefCountedPtr<ConnectedSubchannel>& extra_connection) {
+        return extra_connection.get() == connected_subchannel;
+      });
+  if (it != extra_connections_.end()) {
+    GRPC_TRACE_LOG(subchannel, INFO)
+        << "subchannel " << this << " " << key_.ToString()
+        << ": extra connected subchannel " << connected_subchannel
+        << " reports " << ConnectivityStateName(state) << ": " << status;
+    extra_connections_.erase(it);
+    return;
+  }
+  // If we're either shutting down or have already seen this connection
+  // failure, do nothing.
+  if (connected_subchannel_.get() != connected_subchannel) return;
+  GRPC_TRACE_LOG(subchannel, INFO)
+      << "subchannel " << this << " " << key_.ToString()
+      << ": Connected subchannel " << connected_subchannel << " reports "
+      << ConnectivityStateName(state) << ": " << status;
+  if (channelz_node() != nullptr) channelz_node()->SetChildSocket(nullptr);
+  // If there is another connection, it takes over and we stay READY.
+  if (!extra_connections_.empty()) {
+    connected_subchannel_ = std::move(extra_connections_.back());
+    extra_connections_.pop_back();
+    return;
+  }
+  connected_subchannel_.reset();
+  // Even though we're reporting IDLE instead of TRANSIENT_FAILURE here,
+  // pass along the status from the transport, since it may have
+  // keepalive info attached to it that the channel needs.
+  // TODO(roth): Consider whether there's a cleaner way to do this.
+  SetConnectivityStateLocked(GRPC_CHANNEL_IDLE, status);
+  backoff_.Reset();
+}
+
+namespace {
+
+// Which group of subchannels a coalesced channel uses.
+#define GRPC_ARG_SUBCHANNEL_COALESCING_GROUP \
+  "grpc.internal.subchannel_coalescing_group"
+
+// Channel args that only the client channel and its resolver and LB policy
+// read, and so can differ between channels sharing a subchannel.
+constexpr absl::string_view kChannelOnlyArgs[] = {
+    GRPC_ARG_CHANNEL_ID,
+    GRPC_ARG_CHANNEL_POOL_DOMAIN,
+    GRPC_ARG_CLIENT_IDLE_TIMEOUT_MS,
+    GRPC_ARG_DNS_ARES_QUERY_TIMEOUT_MS,
+    GRPC_ARG_DNS_ENABLE_SRV_QUERIES,
+    GRPC_ARG_DNS_MIN_TIME_BETWEEN_RESOLUTIONS_MS,
+    GRPC_ARG_ENABLE_RETRIES,
+    GRPC_ARG_LB_POLICY_NAME,
+    GRPC_ARG_PER_RPC_RETRY_BUFFER_SIZE,
+    GRPC_ARG_SERVICE_CONFIG,
+    GRPC_ARG_SERVICE_CONFIG_DISABLE_RESOLUTION,
+    GRPC_ARG_SUBCHANNEL_COALESCING,
+    GRPC_ARG_SUBCHANNEL_COALESCING_IGNORED_ARGS,
+    GRPC_ARG_SUBCHANNEL_COALESCING_MAX_CONNECTIONS,
+};
+
+ChannelArgs RemoveArgsIrrelevantToConnection(ChannelArgs args) {
+  std::optional<std::string> ignored =
+      args.GetOwnedString(GRPC_ARG_SUBCHANNEL_COALESCING_IGNORED_ARGS);
+  for (absl::string_view name : kChannelOnlyArgs) {
+    args = args.Remove(name);
+  }
+  if (ignored.has_value()) {
+    for (absl::string_view name :
+         absl::StrSplit(*ignored, ',', absl::SkipWhitespace())) {
+      name = absl::StripAsciiWhitespace(name);
+      // Never let an application drop the args that make up the key.
+      if (name == SubchannelPoolInterface::ChannelArgName() ||
+          name == GRPC_ARG_SUBCHANNEL_COALESCING_GROUP) {
+        continue;
+      }
+      args = args.Remove(name);
+    }
+  }
+  return args;
+}
+
+}  // namespace
+
+ChannelArgs Subchannel::AssignSubchannelCoalescingGroup(
+    ChannelArgs channel_args) {
+  if (!channel_args.GetBool(GRPC_ARG_SUBCHANNEL_COALESCING).value_or(false)) {
+    return channel_args;
+  }
+  const int max_connections =
+      channel_args.GetInt(GRPC_ARG_SUBCHANNEL_COALESCING_MAX_CONNECTIONS)
+          .value_or(1);
+  if (max_connections <= 1) return channel_args;
+  static std::atomic<uint32_t> next_group{0};
+  return channel_args.Set(
+      GRPC_ARG_SUBCHANNEL_COALESCING_GROUP,
+      static_cast<int>(next_group.fetch_add(1, std::memory_order_relaxed) %
+                       static_cast<uint32_t>(max_connections)));
+}
+
 ChannelArgs Subchannel::MakeSubchannelArgs(
     const ChannelArgs& channel_args, const ChannelArgs& address_args,
     const RefCountedPtr<SubchannelPoolInterface>& subchannel_pool,
@@ -881,7 +1105,11 @@ ChannelArgs Subchannel::MakeSubchannelArgs(
   // for the GRPC_ARG_DEFAULT_AUTHORITY arg, which we want to allow
   // resolvers to set on a per-address basis only if the application
   // did not explicitly set it at the channel level.
-  return channel_args.UnionWith(address_args)
+  ChannelArgs args = channel_args.UnionWith(address_args);
+  if (args.GetBool(GRPC_ARG_SUBCHANNEL_COALESCING).value_or(false)) {
+    args = RemoveArgsIrrelevantToConnection(std::move(args));
+  }
+  return args
       .SetObject(subchannel_pool)
       // If we haven't already set the default authority arg (i.e., it
       // was not explicitly set by the application nor overridden by
@@ -21,10 +21,12 @@
 #include <grpc/impl/connectivity_state.h>
 #include <grpc/support/port_platform.h>
 #include <stddef.h>
+#include <stdint.h>
 
 #include <functional>
 #include <map>
 #include <memory>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/container/flat_hash_set.h"
@@ -80,6 +82,10 @@ class ConnectedSubchannel : public RefCounted<ConnectedSubchannel> {
   virtual size_t GetInitialCallSizeEstimate() const = 0;
   virtual void Ping(grpc_closure* on_initiate, grpc_closure* on_ack) = 0;
 
+  // Returns how many more calls the connection can take before they start
+  // queuing in the transport for a stream.
+  virtual uint32_t GetSpareStreamCapacity() const = 0;
+
  protected:
   explicit ConnectedSubchannel(const ChannelArgs& args);
 
@@ -234,10 +240,14 @@ class Subchannel final : public DualRefCounted<Subchannel> {
   void CancelConnectivityStateWatch(ConnectivityStateWatcherInterface* watcher)
       ABSL_LOCKS_EXCLUDED(mu_);
 
+  // With GRPC_ARG_MAX_CONNECTIONS_PER_SUBCHANNEL, returns the connection
+  // with the most spare stream capacity, and opens another one if they are
+  // all full.
   RefCountedPtr<ConnectedSubchannel> connected_subchannel()
       ABSL_LOCKS_EXCLUDED(mu_) {
     MutexLock lock(&mu_);
-    return connected_subchannel_;
+    if (max_connections_ == 1) return connected_subchannel_;
+    return PickConnectedSubchannelLocked();
   }
 
   RefCountedPtr<UnstartedCallDestination> call_destination() {
@@ -275,6 +285,11 @@ class Subchannel final : public DualRefCounted<Subchannel> {
     return event_engine_;
   }
 
+  // With GRPC_ARG_SUBCHANNEL_COALESCING, assigns a new channel to one of the
+  // GRPC_ARG_SUBCHANNEL_COALESCING_MAX_CONNECTIONS groups of subchannels that
+  // coalesced channels are spread over. Called once per channel.
+  static ChannelArgs AssignSubchannelCoalescingGroup(ChannelArgs channel_args);
+
   // Exposed for testing purposes only.
   static ChannelArgs MakeSubchannelArgs(
       const ChannelArgs& channel_args, const ChannelArgs& address_args,
@@ -325,12 +340,23 @@ class Subchannel final : public DualRefCounted<Subchannel> {
   void OnRetryTimer() ABSL_LOCKS_EXCLUDED(mu_);
   void OnRetryTimerLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
   void StartConnectingLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void ConnectLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
   static void OnConnectingFinished(void* arg, grpc_error_handle error)
       ABSL_LOCKS_EXCLUDED(mu_);
   void OnConnectingFinishedLocked(grpc_error_handle error)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
   bool PublishTransportLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
 
+  // Methods for connection scaling.
+  RefCountedPtr<ConnectedSubchannel> PickConnectedSubchannelLocked()
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void StartScalingConnectionLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Called when a connection reports TRANSIENT_FAILURE or SHUTDOWN.
+  void OnConnectionLostLocked(ConnectedSubchannel* connected_subchannel,
+                              grpc_connectivity_state state,
+                              const absl::Status& status)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
   // The subchannel pool this subchannel is in.
   RefCountedPtr<SubchannelPoolInterface> subchannel_pool_;
   // Subchannel key that identifies this subchannel in the subchannel pool.
@@ -346,6 +372,11 @@ class Subchannel final : public DualRefCounted<Subchannel> {
   RefCountedPtr<channelz::SubchannelNode> channelz_node_;
   // Minimum connection timeout.
   Duration min_connect_timeout_;
+  // Most connections to open (GRPC_ARG_MAX_CONNECTIONS_PER_SUBCHANNEL).
+  const int max_connections_;
+  // Process-wide connection attempt rate limit for the address, or 0.
+  const int connect_attempts_per_second_;
+  const int connect_attempts_burst_;
 
   // Connection state.
   OrphanablePtr<SubchannelConnector> connector_;
@@ -373,6 +404,12 @@ class Subchannel final : public DualRefCounted<Subchannel> {
 
   // Active connection, or null.
   RefCountedPtr<ConnectedSubchannel> connected_subchannel_ ABSL_GUARDED_BY(mu_);
+  // Connections opened because connected_subchannel_ ran out of streams.
+  // Only non-empty while connected_subchannel_ is set.
+  std::vector<RefCountedPtr<ConnectedSubchannel>> extra_connections_
+      ABSL_GUARDED_BY(mu_);
+  // Whether the connector is busy with an attempt for extra_connections_.
+  bool scaling_connection_attempt_ ABSL_GUARDED_BY(mu_) = false;
 
   // Backoff state.
   BackOff backoff_ ABSL_GUARDED_BY(mu_);
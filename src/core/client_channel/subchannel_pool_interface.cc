@@ -36,7 +36,7 @@ namespace grpc_core {
 
 SubchannelKey::SubchannelKey(const grpc_resolved_address& address,
                              const ChannelArgs& args)
-    : address_(address), args_(args) {}
+    : address_(address), args_(args), args_hash_(args.Hash()) {}
 
 bool SubchannelKey::operator<(const SubchannelKey& other) const {
   if (address_.len < other.address_.len) return true;
@@ -44,6 +44,7 @@ bool SubchannelKey::operator<(const SubchannelKey& other) const {
   int r = memcmp(address_.addr, other.address_.addr, address_.len);
   if (r < 0) return true;
   if (r > 0) return false;
+  if (args_hash_ != other.args_hash_) return args_hash_ < other.args_hash_;
   return args_ < other.args();
 }
 
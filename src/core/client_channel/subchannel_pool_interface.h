@@ -35,7 +35,9 @@ namespace grpc_core {
 
 class Subchannel;
 
-// A key that can uniquely identify a subchannel.
+// A key that can uniquely identify a subchannel. The hash of the args is
+// computed once up front so that pool lookups only walk the args of keys
+// whose address and hash both match.
 class SubchannelKey final {
  public:
   SubchannelKey(const grpc_resolved_address& address, const ChannelArgs& args);
@@ -56,6 +58,7 @@ class SubchannelKey final {
  private:
   grpc_resolved_address address_;
   ChannelArgs args_;
+  size_t args_hash_;
 };
 
 // Interface for subchannel pool.
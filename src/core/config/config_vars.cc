@@ -42,12 +42,21 @@ ConfigVars::ConfigVars(const Overrides& overrides)
           LoadConfig(std::optional<int32_t>{},
                      "GRPC_CLIENT_CHANNEL_BACKUP_POLL_INTERVAL_MS",
                      overrides.client_channel_backup_poll_interval_ms, 5000)),
+      token_refresh_percent_(LoadConfig(std::optional<int32_t>{},
+                                        "GRPC_TOKEN_REFRESH_PERCENT",
+                                        overrides.token_refresh_percent, 0)),
+      poller_busy_poll_us_(LoadConfig(std::optional<int32_t>{},
+                                      "GRPC_POLLER_BUSY_POLL_US",
+                                      overrides.poller_busy_poll_us, 0)),
       enable_fork_support_(LoadConfig(
           std::optional<bool>{}, "GRPC_ENABLE_FORK_SUPPORT",
           overrides.enable_fork_support, GRPC_ENABLE_FORK_SUPPORT_DEFAULT)),
       abort_on_leaks_(LoadConfig(std::optional<bool>{},
                                  "GRPC_ABORT_ON_LEAKS",
                                  overrides.abort_on_leaks, false)),
+      mutex_profiling_(LoadConfig(std::optional<bool>{},
+                                  "GRPC_MUTEX_PROFILING",
+                                  overrides.mutex_profiling, false)),
       not_use_system_ssl_roots_(LoadConfig(
           std::optional<bool>{}, "GRPC_NOT_USE_SYSTEM_SSL_ROOTS",
           overrides.not_use_system_ssl_roots, false)),
@@ -91,13 +100,17 @@ std::string ConfigVars::ToString() const {
   return absl::StrCat(
       "experiments: ", "\"", absl::CEscape(Experiments()), "\"",
       ", client_channel_backup_poll_interval_ms: ",
-      ClientChannelBackupPollIntervalMs(), ", dns_resolver: ", "\"",
+      ClientChannelBackupPollIntervalMs(),
+      ", token_refresh_percent: ", TokenRefreshPercent(),
+      ", poller_busy_poll_us: ", PollerBusyPollUs(),
+      ", dns_resolver: ", "\"",
       absl::CEscape(DnsResolver()), "\"", ", trace: ", "\"",
       absl::CEscape(Trace()), "\"", ", verbosity: ", "\"",
       absl::CEscape(Verbosity()), "\"",
       ", enable_fork_support: ", EnableForkSupport() ? "true" : "false",
       ", poll_strategy: ", "\"", absl::CEscape(PollStrategy()), "\"",
       ", abort_on_leaks: ", AbortOnLeaks() ? "true" : "false",
+      ", mutex_profiling: ", MutexProfiling() ? "true" : "false",
       ", system_ssl_roots_dir: ", "\"", absl::CEscape(SystemSslRootsDir()),
       "\"", ", default_ssl_roots_file_path: ", "\"",
       absl::CEscape(DefaultSslRootsFilePath()), "\"",
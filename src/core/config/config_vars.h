@@ -35,8 +35,11 @@ class GPR_DLL ConfigVars {
  public:
   struct Overrides {
     absl::optional<int32_t> client_channel_backup_poll_interval_ms;
+    absl::optional<int32_t> token_refresh_percent;
+    absl::optional<int32_t> poller_busy_poll_us;
     absl::optional<bool> enable_fork_support;
     absl::optional<bool> abort_on_leaks;
+    absl::optional<bool> mutex_profiling;
     absl::optional<bool> not_use_system_ssl_roots;
     absl::optional<bool> cpp_experimental_disable_reflection;
     absl::optional<std::string> dns_resolver;
@@ -72,6 +75,16 @@ class GPR_DLL ConfigVars {
   int32_t ClientChannelBackupPollIntervalMs() const {
     return client_channel_backup_poll_interval_ms_;
   }
+  // If non-zero, call credentials that fetch tokens refresh each token in the
+  // background once this percentage of its lifetime has passed, with 10%
+  // jitter, rather than when a call arrives shortly before it expires. Set to 0
+  // to refresh only when a call needs it.
+  int32_t TokenRefreshPercent() const { return token_refresh_percent_; }
+  // If non-zero, EventEngine epoll1 pollers keep checking for events for up
+  // to this many microseconds before blocking, and ask the kernel to busy poll
+  // their sockets for as long. This trades CPU for wakeup latency and is meant
+  // for deployments with cores dedicated to polling.
+  int32_t PollerBusyPollUs() const { return poller_busy_poll_us_; }
   // Declares which DNS resolver to use. The default is ares if gRPC is built
   // with c-ares support. Otherwise, the value of this environment variable is
   // ignored.
@@ -90,6 +103,10 @@ class GPR_DLL ConfigVars {
   // A debugging aid to cause a call to abort() when gRPC objects are leaked
   // past grpc_shutdown()
   bool AbortOnLeaks() const { return abort_on_leaks_; }
+  // Record how long each contended mutex acquisition waits in the
+  // mutex_contention_wait_kcycles stats histogram. Only affects builds where
+  // mutexes are absl::Mutex.
+  bool MutexProfiling() const { return mutex_profiling_; }
   // Custom directory to SSL Roots
   std::string SystemSslRootsDir() const;
   // Path to the default SSL roots file.
@@ -110,8 +127,11 @@ class GPR_DLL ConfigVars {
   static const ConfigVars& Load();
   static std::atomic<ConfigVars*> config_vars_;
   int32_t client_channel_backup_poll_interval_ms_;
+  int32_t token_refresh_percent_;
+  int32_t poller_busy_poll_us_;
   bool enable_fork_support_;
   bool abort_on_leaks_;
+  bool mutex_profiling_;
   bool not_use_system_ssl_roots_;
   bool cpp_experimental_disable_reflection_;
   std::string dns_resolver_;
@@ -19,10 +19,13 @@
 #include <inttypes.h>
 #include <stddef.h>
 
+#include <algorithm>
 #include <functional>
 #include <map>
 #include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "absl/log/absl_log.h"
 #include "absl/strings/string_view.h"
@@ -45,11 +48,76 @@
 namespace grpc_core {
 
 namespace {
-std::optional<std::string> MaybeSerializeBackendMetrics(
+
+// Most servers report the same values for many calls in a row, so each thread
+// remembers the last report it serialized and hands out another ref to it
+// while the values don't change.
+class SerializedBackendMetricsCache {
+ public:
+  std::optional<Slice> Lookup(const BackendMetricData& data) const {
+    if (!serialized_.has_value() ||
+        data.cpu_utilization != cpu_utilization_ ||
+        data.mem_utilization != mem_utilization_ ||
+        data.application_utilization != application_utilization_ ||
+        data.qps != qps_ || data.eps != eps_ ||
+        !Equal(data.request_cost, request_cost_) ||
+        !Equal(data.utilization, utilization_) ||
+        !Equal(data.named_metrics, named_metrics_)) {
+      return std::nullopt;
+    }
+    return serialized_->Ref();
+  }
+
+  void Update(const BackendMetricData& data, const Slice& serialized) {
+    cpu_utilization_ = data.cpu_utilization;
+    mem_utilization_ = data.mem_utilization;
+    application_utilization_ = data.application_utilization;
+    qps_ = data.qps;
+    eps_ = data.eps;
+    Assign(data.request_cost, &request_cost_);
+    Assign(data.utilization, &utilization_);
+    Assign(data.named_metrics, &named_metrics_);
+    serialized_ = serialized.Ref();
+  }
+
+ private:
+  using Metrics = std::vector<std::pair<std::string, double>>;
+
+  static bool Equal(const std::map<absl::string_view, double>& a,
+                    const Metrics& b) {
+    return std::equal(a.begin(), a.end(), b.begin(), b.end(),
+                      [](const auto& x, const auto& y) {
+                        return x.first == y.first && x.second == y.second;
+                      });
+  }
+
+  static void Assign(const std::map<absl::string_view, double>& from,
+                     Metrics* to) {
+    to->clear();
+    for (const auto& [name, value] : from) to->emplace_back(name, value);
+  }
+
+  double cpu_utilization_ = -1;
+  double mem_utilization_ = -1;
+  double application_utilization_ = -1;
+  double qps_ = -1;
+  double eps_ = -1;
+  Metrics request_cost_;
+  Metrics utilization_;
+  Metrics named_metrics_;
+  std::optional<Slice> serialized_;
+};
+
+thread_local SerializedBackendMetricsCache g_serialized_backend_metrics;
+
+std::optional<Slice> MaybeSerializeBackendMetrics(
     BackendMetricProvider* provider) {
   if (provider == nullptr) return std::nullopt;
   BackendMetricData data = provider->GetBackendMetricData();
-  upb::Arena arena;
+  std::optional<Slice> cached = g_serialized_backend_metrics.Lookup(data);
+  if (cached.has_value()) return cached;
+  // Sized so that typical reports are built without touching the heap.
+  upb::InlinedArena<1024> arena;
   xds_data_orca_v3_OrcaLoadReport* response =
       xds_data_orca_v3_OrcaLoadReport_new(arena.ptr());
   bool has_data = false;
@@ -103,8 +171,11 @@ std::optional<std::string> MaybeSerializeBackendMetrics(
   size_t len;
   char* buf =
       xds_data_orca_v3_OrcaLoadReport_serialize(response, arena.ptr(), &len);
-  return std::string(buf, len);
+  Slice serialized = Slice::FromCopiedBuffer(buf, len);
+  g_serialized_backend_metrics.Update(data, serialized);
+  return serialized;
 }
+
 }  // namespace
 
 const grpc_channel_filter BackendMetricFilter::kFilter =
@@ -125,13 +196,12 @@ void BackendMetricFilter::Call::OnServerTrailingMetadata(ServerMetadata& md) {
         << "[" << this << "] No BackendMetricProvider.";
     return;
   }
-  std::optional<std::string> serialized = MaybeSerializeBackendMetrics(ctx);
+  std::optional<Slice> serialized = MaybeSerializeBackendMetrics(ctx);
   if (serialized.has_value() && !serialized->empty()) {
     GRPC_TRACE_LOG(backend_metric_filter, INFO)
         << "[" << this
         << "] Backend metrics serialized. size: " << serialized->size();
-    md.Set(EndpointLoadMetricsBinMetadata(),
-           Slice::FromCopiedString(std::move(*serialized)));
+    md.Set(EndpointLoadMetricsBinMetadata(), std::move(*serialized));
   } else {
     GRPC_TRACE_LOG(backend_metric_filter, INFO)
         << "[" << this << "] No backend metrics.";
@@ -21,7 +21,9 @@
 #include <grpc/support/port_platform.h>
 #include <inttypes.h>
 
+#include <chrono>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <optional>
 #include <utility>
@@ -37,6 +39,8 @@
 #include "src/core/lib/compression/compression_internal.h"
 #include "src/core/lib/compression/message_compress.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/promise/activity.h"
 #include "src/core/lib/promise/context.h"
 #include "src/core/lib/promise/latch.h"
@@ -82,11 +86,28 @@ ChannelCompression::ChannelCompression(const ChannelArgs& args)
               GRPC_COMPRESS_NONE)),
       enabled_compression_algorithms_(
           CompressionAlgorithmSet::FromChannelArgs(args)),
+      zstd_compression_level_(
+          args.GetInt(GRPC_ARG_ZSTD_COMPRESSION_LEVEL).value_or(0)),
       enable_compression_(
           args.GetBool(GRPC_ARG_ENABLE_PER_MESSAGE_COMPRESSION).value_or(true)),
       enable_decompression_(
           args.GetBool(GRPC_ARG_ENABLE_PER_MESSAGE_DECOMPRESSION)
-              .value_or(true)) {
+              .value_or(true)),
+      reuse_compression_contexts_(
+          args.GetBool(GRPC_ARG_EXPERIMENTAL_REUSE_COMPRESSION_CONTEXTS)
+              .value_or(false)) {
+  if (enable_compression_ && IsSkipIncompressibleMethodsEnabled()) {
+    adaptive_compression_ = std::make_unique<AdaptiveCompression>();
+  }
+  if (args.GetBool(GRPC_ARG_EXPERIMENTAL_PARALLEL_COMPRESSION)
+          .value_or(false)) {
+    parallel_event_engine_ =
+        args.GetObjectRef<grpc_event_engine::experimental::EventEngine>();
+    if (parallel_event_engine_ == nullptr) {
+      parallel_event_engine_ =
+          grpc_event_engine::experimental::GetDefaultEventEngine();
+    }
+  }
   // Make sure the default is enabled.
   if (!enabled_compression_algorithms_.IsSet(default_compression_algorithm_)) {
     const char* name;
@@ -100,8 +121,17 @@ ChannelCompression::ChannelCompression(const ChannelArgs& args)
   }
 }
 
+AdaptiveCompression::Method* ChannelCompression::AdaptiveMethod(
+    const grpc_metadata_batch& client_initial_metadata) const {
+  if (adaptive_compression_ == nullptr) return nullptr;
+  const Slice* path = client_initial_metadata.get_pointer(HttpPathMetadata());
+  if (path == nullptr) return nullptr;
+  return adaptive_compression_->GetMethod(path->as_string_view());
+}
+
 MessageHandle ChannelCompression::CompressMessage(
-    MessageHandle message, grpc_compression_algorithm algorithm) const {
+    MessageHandle message, grpc_compression_algorithm algorithm,
+    MessageCompressor* compressor, AdaptiveCompression::Method* method) const {
   GRPC_TRACE_LOG(compression, INFO)
       << "CompressMessage: len=" << message->payload()->Length()
       << " alg=" << algorithm << " flags=" << message->flags();
@@ -117,11 +147,43 @@ MessageHandle ChannelCompression::CompressMessage(
       (flags & (GRPC_WRITE_NO_COMPRESS | GRPC_WRITE_INTERNAL_COMPRESS))) {
     return message;
   }
+  const AdaptiveCompression::Action action =
+      method != nullptr ? method->Next()
+                        : AdaptiveCompression::Action::kCompress;
+  if (action == AdaptiveCompression::Action::kSkip) {
+    GRPC_TRACE_LOG(compression, INFO)
+        << "Not compressing: method does not compress well";
+    return message;
+  }
+  const auto start = action == AdaptiveCompression::Action::kCompressAndRecord
+                         ? std::chrono::steady_clock::now()
+                         : std::chrono::steady_clock::time_point();
   // Try to compress the payload.
   SliceBuffer tmp;
   SliceBuffer* payload = message->payload();
-  bool did_compress = grpc_msg_compress(algorithm, payload->c_slice_buffer(),
-                                        tmp.c_slice_buffer());
+  bool did_compress;
+  if (parallel_event_engine_ != nullptr &&
+      payload->Length() >= 2 * kParallelCompressionChunkSize) {
+    did_compress = ParallelCompress(
+        algorithm, zstd_compression_level_, payload->c_slice_buffer(),
+        tmp.c_slice_buffer(), parallel_event_engine_.get());
+  } else {
+    did_compress =
+        compressor != nullptr
+            ? compressor->Compress(algorithm, zstd_compression_level_,
+                                   payload->c_slice_buffer(),
+                                   tmp.c_slice_buffer())
+            : grpc_msg_compress_with_level(algorithm, zstd_compression_level_,
+                                           payload->c_slice_buffer(),
+                                           tmp.c_slice_buffer());
+  }
+  if (action == AdaptiveCompression::Action::kCompressAndRecord) {
+    method->Record(payload->Length(),
+                   did_compress ? tmp.Length() : payload->Length(),
+                   std::chrono::duration_cast<std::chrono::nanoseconds>(
+                       std::chrono::steady_clock::now() - start)
+                       .count());
+  }
   // If we achieved compression send it as compressed, otherwise send it as (to
   // avoid spending cycles on the receiver decompressing).
   if (did_compress) {
@@ -155,7 +217,8 @@ MessageHandle ChannelCompression::CompressMessage(
 }
 
 absl::StatusOr<MessageHandle> ChannelCompression::DecompressMessage(
-    bool is_client, MessageHandle message, DecompressArgs args) const {
+    bool is_client, MessageHandle message, DecompressArgs args,
+    MessageCompressor* compressor) const {
   GRPC_TRACE_LOG(compression, INFO)
       << "DecompressMessage: len=" << message->payload()->Length()
       << " max=" << args.max_recv_message_length.value_or(-1)
@@ -181,8 +244,24 @@ absl::StatusOr<MessageHandle> ChannelCompression::DecompressMessage(
   }
   // Try to decompress the payload.
   SliceBuffer decompressed_slices;
-  if (grpc_msg_decompress(args.algorithm, message->payload()->c_slice_buffer(),
-                          decompressed_slices.c_slice_buffer()) == 0) {
+  grpc_slice_buffer* payload = message->payload()->c_slice_buffer();
+  int did_decompress;
+  if (parallel_event_engine_ != nullptr &&
+      args.algorithm == GRPC_COMPRESS_ZSTD) {
+    did_decompress = ParallelDecompress(
+        args.algorithm, payload, decompressed_slices.c_slice_buffer(),
+        args.max_recv_message_length.value_or(
+            std::numeric_limits<uint32_t>::max()),
+        parallel_event_engine_.get());
+  } else {
+    did_decompress =
+        compressor != nullptr
+            ? compressor->Decompress(args.algorithm, payload,
+                                     decompressed_slices.c_slice_buffer())
+            : grpc_msg_decompress(args.algorithm, payload,
+                                  decompressed_slices.c_slice_buffer());
+  }
+  if (did_decompress == 0) {
     return absl::InternalError(
         absl::StrCat("Unexpected error decompressing data for algorithm ",
                      CompressionAlgorithmAsString(args.algorithm)));
@@ -210,6 +289,105 @@ grpc_compression_algorithm ChannelCompression::HandleOutgoingMetadata(
   return algorithm;
 }
 
+ChannelCompression::MessagePromise ChannelCompression::CompressMessageAsync(
+    MessageHandle message, grpc_compression_algorithm algorithm,
+    MessageCompressor* compressor, AdaptiveCompression::Method* method) const {
+  std::shared_ptr<CompressionEngine> engine;
+  if (algorithm != GRPC_COMPRESS_NONE && enable_compression_ &&
+      (message->flags() &
+       (GRPC_WRITE_NO_COMPRESS | GRPC_WRITE_INTERNAL_COMPRESS)) == 0) {
+    engine = CompressionEngineRegistry::Global().Find(
+        CompressionEngine::Direction::kCompress, algorithm,
+        message->payload()->Length());
+  }
+  if (engine == nullptr) {
+    return MessagePromise(
+        CompressMessage(std::move(message), algorithm, compressor, method));
+  }
+  GRPC_TRACE_LOG(compression, INFO)
+      << "CompressMessageAsync: len=" << message->payload()->Length()
+      << " alg=" << algorithm << " engine=" << engine->name();
+  auto* call_tracer = MaybeGetContext<CallTracerInterface>();
+  if (call_tracer != nullptr) {
+    call_tracer->RecordSendMessage(*message);
+  }
+  SliceBuffer input;
+  input.Swap(message->payload());
+  auto operation = CompressionEngineOperation::Start(
+      std::move(engine), CompressionEngine::Direction::kCompress, algorithm,
+      zstd_compression_level_, std::move(input));
+  return MessagePromise(CompressionEngine::Direction::kCompress, algorithm,
+                        std::move(message), std::move(operation));
+}
+
+ChannelCompression::MessagePromise ChannelCompression::DecompressMessageAsync(
+    bool is_client, MessageHandle message, DecompressArgs args,
+    MessageCompressor* compressor) const {
+  std::shared_ptr<CompressionEngine> engine;
+  if (enable_decompression_ &&
+      (message->flags() & GRPC_WRITE_INTERNAL_COMPRESS) != 0 &&
+      (!args.max_recv_message_length.has_value() ||
+       message->payload()->Length() <= *args.max_recv_message_length)) {
+    engine = CompressionEngineRegistry::Global().Find(
+        CompressionEngine::Direction::kDecompress, args.algorithm,
+        message->payload()->Length());
+  }
+  if (engine == nullptr) {
+    return MessagePromise(DecompressMessage(is_client, std::move(message),
+                                            args, compressor));
+  }
+  GRPC_TRACE_LOG(compression, INFO)
+      << "DecompressMessageAsync: len=" << message->payload()->Length()
+      << " alg=" << args.algorithm << " engine=" << engine->name();
+  auto* call_tracer = MaybeGetContext<CallTracerInterface>();
+  if (call_tracer != nullptr) {
+    call_tracer->RecordReceivedMessage(*message);
+  }
+  SliceBuffer input;
+  input.Swap(message->payload());
+  auto operation = CompressionEngineOperation::Start(
+      std::move(engine), CompressionEngine::Direction::kDecompress,
+      args.algorithm, 0, std::move(input));
+  return MessagePromise(CompressionEngine::Direction::kDecompress,
+                        args.algorithm, std::move(message),
+                        std::move(operation));
+}
+
+Poll<absl::StatusOr<MessageHandle>>
+ChannelCompression::MessagePromise::operator()() {
+  if (result_.has_value()) return std::move(*result_);
+  auto done = operation_->PollDone();
+  if (done.pending()) return Pending{};
+  const bool ok = done.value();
+  auto* call_tracer = MaybeGetContext<CallTracerInterface>();
+  uint32_t& flags = message_->mutable_flags();
+  if (direction_ == CompressionEngine::Direction::kCompress) {
+    // A failed compression sends the message as it was.
+    message_->payload()->Swap(ok ? &operation_->output()
+                                 : &operation_->input());
+    if (ok) {
+      flags |= GRPC_WRITE_INTERNAL_COMPRESS;
+      if (call_tracer != nullptr) {
+        call_tracer->RecordSendCompressedMessage(*message_);
+      }
+    }
+  } else {
+    if (!ok) {
+      return absl::InternalError(
+          absl::StrCat("Unexpected error decompressing data for algorithm ",
+                       CompressionAlgorithmAsString(algorithm_)));
+    }
+    message_->payload()->Swap(&operation_->output());
+    flags &= ~GRPC_WRITE_INTERNAL_COMPRESS;
+    flags |= GRPC_WRITE_INTERNAL_TEST_ONLY_WAS_COMPRESSED;
+    if (call_tracer != nullptr) {
+      call_tracer->RecordReceivedDecompressedMessage(*message_);
+    }
+  }
+  operation_.reset();
+  return std::move(message_);
+}
+
 ChannelCompression::DecompressArgs ChannelCompression::HandleIncomingMetadata(
     const grpc_metadata_batch& incoming_metadata) {
   // Configure max receive size.
@@ -233,14 +411,17 @@ void ClientCompressionFilter::Call::OnClientInitialMetadata(
       "ClientCompressionFilter::Call::OnClientInitialMetadata");
   compression_algorithm_ =
       filter->compression_engine_.HandleOutgoingMetadata(md);
+  adaptive_method_ = filter->compression_engine_.AdaptiveMethod(md);
 }
 
-MessageHandle ClientCompressionFilter::Call::OnClientToServerMessage(
+ChannelCompression::MessagePromise
+ClientCompressionFilter::Call::OnClientToServerMessage(
     MessageHandle message, ClientCompressionFilter* filter) {
   GRPC_LATENT_SEE_INNER_SCOPE(
       "ClientCompressionFilter::Call::OnClientToServerMessage");
-  return filter->compression_engine_.CompressMessage(std::move(message),
-                                                     compression_algorithm_);
+  return filter->compression_engine_.CompressMessageAsync(
+      std::move(message), compression_algorithm_,
+      compressor_.Get(filter->compression_engine_), adaptive_method_);
 }
 
 void ClientCompressionFilter::Call::OnServerInitialMetadata(
@@ -250,13 +431,14 @@ void ClientCompressionFilter::Call::OnServerInitialMetadata(
   decompress_args_ = filter->compression_engine_.HandleIncomingMetadata(md);
 }
 
-absl::StatusOr<MessageHandle>
+ChannelCompression::MessagePromise
 ClientCompressionFilter::Call::OnServerToClientMessage(
     MessageHandle message, ClientCompressionFilter* filter) {
   GRPC_LATENT_SEE_INNER_SCOPE(
       "ClientCompressionFilter::Call::OnServerToClientMessage");
-  return filter->compression_engine_.DecompressMessage(
-      /*is_client=*/true, std::move(message), decompress_args_);
+  return filter->compression_engine_.DecompressMessageAsync(
+      /*is_client=*/true, std::move(message), decompress_args_,
+      compressor_.Get(filter->compression_engine_));
 }
 
 void ServerCompressionFilter::Call::OnClientInitialMetadata(
@@ -264,15 +446,17 @@ void ServerCompressionFilter::Call::OnClientInitialMetadata(
   GRPC_LATENT_SEE_INNER_SCOPE(
       "ServerCompressionFilter::Call::OnClientInitialMetadata");
   decompress_args_ = filter->compression_engine_.HandleIncomingMetadata(md);
+  adaptive_method_ = filter->compression_engine_.AdaptiveMethod(md);
 }
 
-absl::StatusOr<MessageHandle>
+ChannelCompression::MessagePromise
 ServerCompressionFilter::Call::OnClientToServerMessage(
     MessageHandle message, ServerCompressionFilter* filter) {
   GRPC_LATENT_SEE_INNER_SCOPE(
       "ServerCompressionFilter::Call::OnClientToServerMessage");
-  return filter->compression_engine_.DecompressMessage(
-      /*is_client=*/false, std::move(message), decompress_args_);
+  return filter->compression_engine_.DecompressMessageAsync(
+      /*is_client=*/false, std::move(message), decompress_args_,
+      compressor_.Get(filter->compression_engine_));
 }
 
 void ServerCompressionFilter::Call::OnServerInitialMetadata(
@@ -283,12 +467,14 @@ void ServerCompressionFilter::Call::OnServerInitialMetadata(
       filter->compression_engine_.HandleOutgoingMetadata(md);
 }
 
-MessageHandle ServerCompressionFilter::Call::OnServerToClientMessage(
+ChannelCompression::MessagePromise
+ServerCompressionFilter::Call::OnServerToClientMessage(
     MessageHandle message, ServerCompressionFilter* filter) {
   GRPC_LATENT_SEE_INNER_SCOPE(
       "ServerCompressionFilter::Call::OnServerToClientMessage");
-  return filter->compression_engine_.CompressMessage(std::move(message),
-                                                     compression_algorithm_);
+  return filter->compression_engine_.CompressMessageAsync(
+      std::move(message), compression_algorithm_,
+      compressor_.Get(filter->compression_engine_), adaptive_method_);
 }
 
 }  // namespace grpc_core
@@ -19,11 +19,13 @@
 #ifndef GRPC_SRC_CORE_EXT_FILTERS_HTTP_MESSAGE_COMPRESS_COMPRESSION_FILTER_H
 #define GRPC_SRC_CORE_EXT_FILTERS_HTTP_MESSAGE_COMPRESS_COMPRESSION_FILTER_H
 
+#include <grpc/event_engine/event_engine.h>
 #include <grpc/impl/compression_types.h>
 #include <grpc/support/port_platform.h>
 #include <stddef.h>
 #include <stdint.h>
 
+#include <memory>
 #include <optional>
 
 #include "absl/status/statusor.h"
@@ -31,8 +33,12 @@
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channel_fwd.h"
 #include "src/core/lib/channel/promise_based_filter.h"
+#include "src/core/lib/compression/adaptive_compression.h"
+#include "src/core/lib/compression/compression_engine.h"
 #include "src/core/lib/compression/compression_internal.h"
+#include "src/core/lib/compression/message_compress.h"
 #include "src/core/lib/promise/arena_promise.h"
+#include "src/core/lib/promise/poll.h"
 #include "src/core/lib/transport/metadata_batch.h"
 #include "src/core/lib/transport/transport.h"
 
@@ -59,6 +65,14 @@ namespace grpc_core {
 /// to incorporate GRPC_WRITE_INTERNAL_COMPRESS. Otherwise, and regardless of
 /// the aforementioned 'grpc-encoding' metadata value, data will pass through
 /// uncompressed.
+///
+/// Messages that a CompressionEngine in CompressionEngineRegistry::Global()
+/// accepts are handed to it, and the call waits for the engine without blocking
+/// a thread.
+///
+/// With the skip_incompressible_methods experiment, messages of methods that
+/// AdaptiveCompression found not worth compressing also pass through
+/// uncompressed.
 
 class ChannelCompression {
  public:
@@ -69,6 +83,23 @@ class ChannelCompression {
     std::optional<uint32_t> max_recv_message_length;
   };
 
+  // Per-call compression state: when context reuse is enabled on the channel
+  // this owns a MessageCompressor for the lifetime of the call, otherwise it
+  // is empty and every message uses a fresh context.
+  class CallCompressor {
+   public:
+    MessageCompressor* Get(const ChannelCompression& compression) {
+      if (!compression.reuse_compression_contexts_) return nullptr;
+      if (compressor_ == nullptr) {
+        compressor_ = std::make_unique<MessageCompressor>();
+      }
+      return compressor_.get();
+    }
+
+   private:
+    std::unique_ptr<MessageCompressor> compressor_;
+  };
+
   grpc_compression_algorithm default_compression_algorithm() const {
     return default_compression_algorithm_;
   }
@@ -81,14 +112,62 @@ class ChannelCompression {
       grpc_metadata_batch& outgoing_metadata);
   DecompressArgs HandleIncomingMetadata(
       const grpc_metadata_batch& incoming_metadata);
+  // Returns the adaptive compression state for the method of a call, given
+  // its client initial metadata, or nullptr if the call should not adapt.
+  AdaptiveCompression::Method* AdaptiveMethod(
+      const grpc_metadata_batch& client_initial_metadata) const;
+
+  // Compress one message synchronously. If compressor is non-null its
+  // contexts are reused. If method is non-null it decides whether the message
+  // is compressed at all.
+  MessageHandle CompressMessage(
+      MessageHandle message, grpc_compression_algorithm algorithm,
+      MessageCompressor* compressor = nullptr,
+      AdaptiveCompression::Method* method = nullptr) const;
+  // Decompress one message synchronously. If compressor is non-null its
+  // contexts are reused.
+  absl::StatusOr<MessageHandle> DecompressMessage(
+      bool is_client, MessageHandle message, DecompressArgs args,
+      MessageCompressor* compressor = nullptr) const;
+
+  // Resolves to a message once a CompressionEngine is done with it, or
+  // straight away to a result computed by the software path.
+  class MessagePromise {
+   public:
+    explicit MessagePromise(absl::StatusOr<MessageHandle> result)
+        : result_(std::move(result)) {}
+    MessagePromise(CompressionEngine::Direction direction,
+                   grpc_compression_algorithm algorithm, MessageHandle message,
+                   RefCountedPtr<CompressionEngineOperation> operation)
+        : direction_(direction),
+          algorithm_(algorithm),
+          message_(std::move(message)),
+          operation_(std::move(operation)) {}
+
+    Poll<absl::StatusOr<MessageHandle>> operator()();
 
-  // Compress one message synchronously.
-  MessageHandle CompressMessage(MessageHandle message,
-                                grpc_compression_algorithm algorithm) const;
-  // Decompress one message synchronously.
-  absl::StatusOr<MessageHandle> DecompressMessage(bool is_client,
-                                                  MessageHandle message,
-                                                  DecompressArgs args) const;
+   private:
+    std::optional<absl::StatusOr<MessageHandle>> result_;
+    // The rest is only used while an engine works on the payload of
+    // message_, which the operation holds meanwhile.
+    CompressionEngine::Direction direction_ =
+        CompressionEngine::Direction::kCompress;
+    grpc_compression_algorithm algorithm_ = GRPC_COMPRESS_NONE;
+    MessageHandle message_;
+    RefCountedPtr<CompressionEngineOperation> operation_;
+  };
+
+  // As CompressMessage, but messages that a registered CompressionEngine
+  // accepts are compressed by it.
+  MessagePromise CompressMessageAsync(
+      MessageHandle message, grpc_compression_algorithm algorithm,
+      MessageCompressor* compressor = nullptr,
+      AdaptiveCompression::Method* method = nullptr) const;
+  // As DecompressMessage, but messages that a registered CompressionEngine
+  // accepts are decompressed by it.
+  MessagePromise DecompressMessageAsync(
+      bool is_client, MessageHandle message, DecompressArgs args,
+      MessageCompressor* compressor = nullptr) const;
 
  private:
   // Max receive message length, if set.
@@ -98,10 +177,19 @@ class ChannelCompression {
   grpc_compression_algorithm default_compression_algorithm_;
   // Enabled compression algorithms.
   CompressionAlgorithmSet enabled_compression_algorithms_;
+  // Level passed to zstd when compressing with GRPC_COMPRESS_ZSTD.
+  int zstd_compression_level_;
   // Is compression enabled?
   bool enable_compression_;
   // Is decompression enabled?
   bool enable_decompression_;
+  // Keep compression contexts alive across messages on a call?
+  bool reuse_compression_contexts_;
+  // Per-method compression decisions; null unless the experiment is enabled.
+  std::unique_ptr<AdaptiveCompression> adaptive_compression_;
+  // Runs chunks of large messages in parallel; null unless enabled.
+  std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+      parallel_event_engine_;
 };
 
 class ClientCompressionFilter final
@@ -122,12 +210,12 @@ class ClientCompressionFilter final
    public:
     void OnClientInitialMetadata(ClientMetadata& md,
                                  ClientCompressionFilter* filter);
-    MessageHandle OnClientToServerMessage(MessageHandle message,
-                                          ClientCompressionFilter* filter);
+    ChannelCompression::MessagePromise OnClientToServerMessage(
+        MessageHandle message, ClientCompressionFilter* filter);
 
     void OnServerInitialMetadata(ServerMetadata& md,
                                  ClientCompressionFilter* filter);
-    absl::StatusOr<MessageHandle> OnServerToClientMessage(
+    ChannelCompression::MessagePromise OnServerToClientMessage(
         MessageHandle message, ClientCompressionFilter* filter);
 
     static inline const NoInterceptor OnClientToServerHalfClose;
@@ -137,6 +225,8 @@ class ClientCompressionFilter final
    private:
     grpc_compression_algorithm compression_algorithm_;
     ChannelCompression::DecompressArgs decompress_args_;
+    ChannelCompression::CallCompressor compressor_;
+    AdaptiveCompression::Method* adaptive_method_ = nullptr;
   };
 
  private:
@@ -161,13 +251,13 @@ class ServerCompressionFilter final
    public:
     void OnClientInitialMetadata(ClientMetadata& md,
                                  ServerCompressionFilter* filter);
-    absl::StatusOr<MessageHandle> OnClientToServerMessage(
+    ChannelCompression::MessagePromise OnClientToServerMessage(
         MessageHandle message, ServerCompressionFilter* filter);
 
     void OnServerInitialMetadata(ServerMetadata& md,
                                  ServerCompressionFilter* filter);
-    MessageHandle OnServerToClientMessage(MessageHandle message,
-                                          ServerCompressionFilter* filter);
+    ChannelCompression::MessagePromise OnServerToClientMessage(
+        MessageHandle message, ServerCompressionFilter* filter);
 
     static inline const NoInterceptor OnClientToServerHalfClose;
     static inline const NoInterceptor OnServerTrailingMetadata;
@@ -176,6 +266,8 @@ class ServerCompressionFilter final
    private:
     ChannelCompression::DecompressArgs decompress_args_;
     grpc_compression_algorithm compression_algorithm_;
+    ChannelCompression::CallCompressor compressor_;
+    AdaptiveCompression::Method* adaptive_method_ = nullptr;
   };
 
  private:
@@ -0,0 +1,298 @@
+//
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "src/core/ext/filters/logging/async_logging_sink.h"
+
+#include <grpc/support/port_platform.h>
+#include <grpc/support/time.h>
+
+#include "absl/numeric/int128.h"
+
+namespace grpc_core {
+
+namespace {
+
+using Entry = LoggingSink::Entry;
+
+// Flags byte.
+constexpr uint8_t kPayloadTruncated = 1;
+constexpr uint8_t kIsSampled = 2;
+constexpr uint8_t kIsTrailerOnly = 4;
+
+void PutVarint(uint64_t value, std::string* out) {
+  while (value >= 0x80) {
+    out->push_back(static_cast<char>((value & 0x7f) | 0x80));
+    value >>= 7;
+  }
+  out->push_back(static_cast<char>(value));
+}
+
+void PutSignedVarint(int64_t value, std::string* out) {
+  PutVarint((static_cast<uint64_t>(value) << 1) ^
+                static_cast<uint64_t>(value >> 63),
+            out);
+}
+
+void PutString(absl::string_view value, std::string* out) {
+  PutVarint(value.size(), out);
+  out->append(value.data(), value.size());
+}
+
+void PutFixed64(uint64_t value, std::string* out) {
+  for (int i = 0; i < 8; ++i) {
+    out->push_back(static_cast<char>(value >> (8 * i)));
+  }
+}
+
+class Reader {
+ public:
+  explicit Reader(absl::string_view data) : data_(data) {}
+
+  bool empty() const { return data_.empty(); }
+
+  bool GetVarint(uint64_t* value) {
+    *value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+      if (data_.empty()) return false;
+      const uint8_t byte = data_[0];
+      data_.remove_prefix(1);
+      *value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+      if ((byte & 0x80) == 0) return true;
+    }
+    return false;
+  }
+
+  template <typename T>
+  bool GetVarint(T* value) {
+    uint64_t v;
+    if (!GetVarint(&v)) return false;
+    *value = static_cast<T>(v);
+    return true;
+  }
+
+  bool GetSignedVarint(int64_t* value) {
+    uint64_t v;
+    if (!GetVarint(&v)) return false;
+    *value = static_cast<int64_t>((v >> 1) ^ (~(v & 1) + 1));
+    return true;
+  }
+
+  bool GetBytes(size_t length, absl::string_view* value) {
+    if (data_.size() < length) return false;
+    *value = data_.substr(0, length);
+    data_.remove_prefix(length);
+    return true;
+  }
+
+  bool GetString(std::string* value) {
+    uint64_t length;
+    absl::string_view bytes;
+    if (!GetVarint(&length) || !GetBytes(length, &bytes)) return false;
+    value->assign(bytes.data(), bytes.size());
+    return true;
+  }
+
+  bool GetFixed64(uint64_t* value) {
+    absl::string_view bytes;
+    if (!GetBytes(8, &bytes)) return false;
+    *value = 0;
+    for (int i = 0; i < 8; ++i) {
+      *value |= static_cast<uint64_t>(static_cast<uint8_t>(bytes[i]))
+                << (8 * i);
+    }
+    return true;
+  }
+
+ private:
+  absl::string_view data_;
+};
+
+void EncodeFields(const Entry& entry, std::string* out) {
+  PutFixed64(absl::Uint128High64(entry.call_id), out);
+  PutFixed64(absl::Uint128Low64(entry.call_id), out);
+  PutVarint(entry.sequence_id, out);
+  PutVarint(static_cast<uint64_t>(entry.type), out);
+  PutVarint(static_cast<uint64_t>(entry.logger), out);
+  PutVarint(entry.payload.metadata.size(), out);
+  for (const auto& [key, value] : entry.payload.metadata) {
+    PutString(key, out);
+    PutString(value, out);
+  }
+  PutSignedVarint(entry.payload.timeout.millis(), out);
+  PutVarint(entry.payload.status_code, out);
+  PutString(entry.payload.status_message, out);
+  PutString(entry.payload.status_details, out);
+  PutVarint(entry.payload.message_length, out);
+  PutString(entry.payload.message, out);
+  PutVarint(static_cast<uint64_t>(entry.peer.type), out);
+  PutString(entry.peer.address, out);
+  PutVarint(entry.peer.ip_port, out);
+  PutString(entry.authority, out);
+  PutString(entry.service_name, out);
+  PutString(entry.method_name, out);
+  // Timestamps are process-local, so the wall clock time is what goes out.
+  const gpr_timespec timestamp =
+      entry.timestamp.as_timespec(GPR_CLOCK_REALTIME);
+  PutSignedVarint(timestamp.tv_sec, out);
+  PutVarint(timestamp.tv_nsec, out);
+  PutString(entry.trace_id, out);
+  PutString(entry.span_id, out);
+  out->push_back(static_cast<char>(
+      (entry.payload_truncated ? kPayloadTruncated : 0) |
+      (entry.is_sampled ? kIsSampled : 0) |
+      (entry.is_trailer_only ? kIsTrailerOnly : 0)));
+}
+
+bool DecodeFields(Reader& reader, Entry* entry) {
+  uint64_t call_id_high;
+  uint64_t call_id_low;
+  if (!reader.GetFixed64(&call_id_high) || !reader.GetFixed64(&call_id_low) ||
+      !reader.GetVarint(&entry->sequence_id) ||
+      !reader.GetVarint(&entry->type) || !reader.GetVarint(&entry->logger)) {
+    return false;
+  }
+  entry->call_id = absl::MakeUint128(call_id_high, call_id_low);
+  uint64_t num_metadata;
+  if (!reader.GetVarint(&num_metadata)) return false;
+  for (uint64_t i = 0; i < num_metadata; ++i) {
+    std::string key;
+    std::string value;
+    if (!reader.GetString(&key) || !reader.GetString(&value)) return false;
+    entry->payload.metadata.emplace(std::move(key), std::move(value));
+  }
+  int64_t timeout_millis;
+  if (!reader.GetSignedVarint(&timeout_millis)) return false;
+  entry->payload.timeout = Duration::Milliseconds(timeout_millis);
+  int64_t timestamp_sec;
+  int32_t timestamp_nsec;
+  uint8_t flags;
+  if (!reader.GetVarint(&entry->payload.status_code) ||
+      !reader.GetString(&entry->payload.status_message) ||
+      !reader.GetString(&entry->payload.status_details) ||
+      !reader.GetVarint(&entry->payload.message_length) ||
+      !reader.GetString(&entry->payload.message) ||
+      !reader.GetVarint(&entry->peer.type) ||
+      !reader.GetString(&entry->peer.address) ||
+      !reader.GetVarint(&entry->peer.ip_port) ||
+      !reader.GetString(&entry->authority) ||
+      !reader.GetString(&entry->service_name) ||
+      !reader.GetString(&entry->method_name) ||
+      !reader.GetSignedVarint(&timestamp_sec) ||
+      !reader.GetVarint(&timestamp_nsec) ||
+      !reader.GetString(&entry->trace_id) ||
+      !reader.GetString(&entry->span_id) || !reader.GetVarint(&flags)) {
+    return false;
+  }
+  entry->timestamp = Timestamp::FromTimespecRoundDown(
+      gpr_timespec{timestamp_sec, timestamp_nsec, GPR_CLOCK_REALTIME});
+  entry->payload_truncated = (flags & kPayloadTruncated) != 0;
+  entry->is_sampled = (flags & kIsSampled) != 0;
+  entry->is_trailer_only = (flags & kIsTrailerOnly) != 0;
+  return reader.empty();
+}
+
+}  // namespace
+
+void EncodeLoggingEntry(const LoggingSink::Entry& entry, std::string* out) {
+  std::string fields;
+  EncodeFields(entry, &fields);
+  PutString(fields, out);
+}
+
+std::optional<std::vector<LoggingSink::Entry>> DecodeLoggingEntries(
+    absl::string_view batch) {
+  std::vector<LoggingSink::Entry> entries;
+  Reader reader(batch);
+  while (!reader.empty()) {
+    uint64_t length;
+    absl::string_view fields;
+    if (!reader.GetVarint(&length) || !reader.GetBytes(length, &fields)) {
+      return std::nullopt;
+    }
+    Reader fields_reader(fields);
+    if (!DecodeFields(fields_reader, &entries.emplace_back())) {
+      return std::nullopt;
+    }
+  }
+  return entries;
+}
+
+//
+// AsyncLoggingSink::State
+//
+
+AsyncLoggingSink::State::~State() {
+  bool empty = false;
+  while (!empty) {
+    delete static_cast<QueuedEntry*>(queue.PopAndCheckEnd(&empty));
+  }
+}
+
+void AsyncLoggingSink::State::Flush() {
+  MutexLock lock(&flush_mu_);
+  while (auto* node = static_cast<QueuedEntry*>(queue.Pop())) {
+    std::unique_ptr<QueuedEntry> entry(node);
+    queued_bytes.fetch_sub(entry->encoded.size(), std::memory_order_relaxed);
+    if (!batch_.empty() &&
+        batch_.size() + entry->encoded.size() > options.max_batch_bytes) {
+      writer_->WriteBatch(batch_);
+      batch_.clear();
+    }
+    batch_.append(entry->encoded);
+  }
+  if (!batch_.empty()) {
+    writer_->WriteBatch(batch_);
+    batch_.clear();
+  }
+}
+
+//
+// AsyncLoggingSink
+//
+
+AsyncLoggingSink::AsyncLoggingSink(
+    Options options, std::unique_ptr<BatchWriter> writer,
+    std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+        event_engine)
+    : state_(MakeRefCounted<State>(options, std::move(writer))),
+      event_engine_(std::move(event_engine)) {}
+
+AsyncLoggingSink::~AsyncLoggingSink() { state_->Flush(); }
+
+void AsyncLoggingSink::LogEntry(Entry entry) {
+  auto queued = std::make_unique<QueuedEntry>();
+  EncodeLoggingEntry(entry, &queued->encoded);
+  const size_t size = queued->encoded.size();
+  if (state_->queued_bytes.fetch_add(size, std::memory_order_relaxed) + size >
+      state_->options.max_queued_bytes) {
+    state_->queued_bytes.fetch_sub(size, std::memory_order_relaxed);
+    state_->dropped_entries.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  state_->queue.Push(queued.release());
+  if (state_->flush_scheduled.exchange(true, std::memory_order_acq_rel)) {
+    return;
+  }
+  event_engine_->RunAfter(
+      state_->options.flush_interval, [state = state_]() mutable {
+        state->flush_scheduled.store(false, std::memory_order_release);
+        state->Flush();
+      });
+}
+
+}  // namespace grpc_core
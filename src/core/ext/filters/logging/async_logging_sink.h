@@ -0,0 +1,129 @@
+//
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPC_SRC_CORE_EXT_FILTERS_LOGGING_ASYNC_LOGGING_SINK_H
+#define GRPC_SRC_CORE_EXT_FILTERS_LOGGING_ASYNC_LOGGING_SINK_H
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/strings/string_view.h"
+#include "src/core/ext/filters/logging/logging_sink.h"
+#include "src/core/util/mpscq.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/time.h"
+
+namespace grpc_core {
+
+// Appends the binary encoding of entry to out. Each entry is a varint length
+// followed by its fields, with integers as varints and strings as a varint
+// length followed by their bytes, so that a batch is just the concatenation
+// of its entries.
+void EncodeLoggingEntry(const LoggingSink::Entry& entry, std::string* out);
+
+// Decodes a batch of entries written by EncodeLoggingEntry(), or returns
+// nullopt if it is malformed.
+std::optional<std::vector<LoggingSink::Entry>> DecodeLoggingEntries(
+    absl::string_view batch);
+
+// A LoggingSink that keeps the cost of logging off the call path.
+// LogEntry() encodes the entry into a single buffer and pushes it onto a
+// lock-free queue. A flush on the event engine runs flush_interval after the
+// first entry following the previous flush, and hands the queued entries to
+// the BatchWriter in batches of up to max_batch_bytes. Entries that would
+// take the queue past max_queued_bytes are dropped and counted.
+//
+// Subclasses choose what to log by implementing FindMatch().
+class AsyncLoggingSink : public LoggingSink {
+ public:
+  // Where the batches go. WriteBatch() is never called concurrently.
+  class BatchWriter {
+   public:
+    virtual ~BatchWriter() = default;
+    virtual void WriteBatch(absl::string_view batch) = 0;
+  };
+
+  struct Options {
+    size_t max_queued_bytes = 16 * 1024 * 1024;
+    size_t max_batch_bytes = 1024 * 1024;
+    Duration flush_interval = Duration::Seconds(1);
+  };
+
+  AsyncLoggingSink(
+      Options options, std::unique_ptr<BatchWriter> writer,
+      std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+          event_engine);
+  // Writes out whatever is still queued.
+  ~AsyncLoggingSink() override;
+
+  void LogEntry(Entry entry) final;
+
+  // Writes out the queued entries now, on the calling thread.
+  void Flush() { state_->Flush(); }
+
+  uint64_t dropped_entries() const {
+    return state_->dropped_entries.load(std::memory_order_relaxed);
+  }
+
+ private:
+  struct QueuedEntry : public MultiProducerSingleConsumerQueue::Node {
+    std::string encoded;
+  };
+
+  // Shared with the scheduled flushes, which may outlive the sink.
+  class State : public RefCounted<State> {
+   public:
+    State(Options options, std::unique_ptr<BatchWriter> writer)
+        : options(options), writer_(std::move(writer)) {}
+    ~State() override;
+
+    void Flush();
+
+    const Options options;
+    MultiProducerSingleConsumerQueue queue;
+    std::atomic<size_t> queued_bytes{0};
+    std::atomic<uint64_t> dropped_entries{0};
+    std::atomic<bool> flush_scheduled{false};
+
+   private:
+    // Makes the flushing thread the queue's single consumer.
+    Mutex flush_mu_;
+    const std::unique_ptr<BatchWriter> writer_ ABSL_GUARDED_BY(flush_mu_);
+    std::string batch_ ABSL_GUARDED_BY(flush_mu_);
+  };
+
+  const RefCountedPtr<State> state_;
+  const std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+      event_engine_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_FILTERS_LOGGING_ASYNC_LOGGING_SINK_H
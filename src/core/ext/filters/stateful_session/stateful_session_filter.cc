@@ -168,20 +168,32 @@ std::string GetCookieValue(const ClientMetadata& client_initial_metadata,
   auto header_value = client_initial_metadata.GetStringValue("cookie", &buffer);
   if (!header_value.has_value()) return "";
   // Parse cookie header.
-  std::vector<absl::string_view> values;
+  // TODO(roth): Figure out the right behavior for multiple cookies.
+  // For now, just choose the first value.
+  std::optional<absl::string_view> value;
   for (absl::string_view cookie : absl::StrSplit(*header_value, "; ")) {
     std::pair<absl::string_view, absl::string_view> kv =
         absl::StrSplit(cookie, absl::MaxSplits('=', 1));
-    if (kv.first == cookie_name) values.push_back(kv.second);
+    if (kv.first == cookie_name) {
+      value = kv.second;
+      break;
+    }
   }
-  if (values.empty()) return "";
-  // TODO(roth): Figure out the right behavior for multiple cookies.
-  // For now, just choose the first value.
-  std::string decoded;
-  if (absl::Base64Unescape(values.front(), &decoded)) {
-    return decoded;
+  if (!value.has_value()) return "";
+  // A client with session affinity sends the same cookie on every call, so
+  // remember the last value decoded on this thread.
+  struct DecodedCookie {
+    std::string encoded;
+    std::string decoded;
+  };
+  static thread_local DecodedCookie last_cookie;
+  if (*value != last_cookie.encoded) {
+    std::string decoded;
+    if (!absl::Base64Unescape(*value, &decoded)) return "";
+    last_cookie.encoded = std::string(*value);
+    last_cookie.decoded = std::move(decoded);
   }
-  return "";
+  return last_cookie.decoded;
 }
 
 bool IsConfiguredPath(absl::string_view configured_path,
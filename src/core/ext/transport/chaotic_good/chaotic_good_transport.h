@@ -17,10 +17,13 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <limits>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "absl/strings/escaping.h"
 #include "src/core/ext/transport/chaotic_good/control_endpoint.h"
@@ -29,11 +32,15 @@
 #include "src/core/ext/transport/chaotic_good/frame_header.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/event_engine/event_engine_context.h"
+#include "src/core/lib/event_engine/extensions/chaotic_good_extension.h"
 #include "src/core/lib/event_engine/tcp_socket_utils.h"
+#include "src/core/lib/promise/if.h"
 #include "src/core/lib/promise/loop.h"
+#include "src/core/lib/promise/map.h"
 #include "src/core/lib/promise/match_promise.h"
 #include "src/core/lib/promise/mpsc.h"
 #include "src/core/lib/promise/seq.h"
+#include "src/core/lib/promise/sleep.h"
 #include "src/core/lib/promise/try_join.h"
 #include "src/core/lib/promise/try_seq.h"
 #include "src/core/lib/transport/call_spine.h"
@@ -90,8 +97,22 @@ class ChaoticGoodTransport : public RefCounted<ChaoticGoodTransport> {
     uint32_t encode_alignment = 64;
     uint32_t decode_alignment = 64;
     uint32_t inlined_payload_size_threshold = 8 * 1024;
+    // 0: the set of data connections is fixed at handshake.
+    uint32_t max_data_connections = 0;
+    // If set, large payloads are received into buffers from this allocator.
+    std::shared_ptr<
+        grpc_event_engine::experimental::ChaoticGoodReceiveBufferAllocator>
+        receive_buffer_allocator;
   };
 
+  // How often the data connection maintenance loop runs, and how long writes
+  // must be blocked during one period for the data connections to count as
+  // saturated.
+  static constexpr Duration kDataEndpointsMaintenancePeriod =
+      Duration::Seconds(1);
+  static constexpr Duration kDataEndpointsSaturatedTime =
+      Duration::Milliseconds(500);
+
   ChaoticGoodTransport(
       PromiseEndpoint control_endpoint,
       std::vector<PendingConnection> pending_data_endpoints,
@@ -101,20 +122,20 @@ class ChaoticGoodTransport : public RefCounted<ChaoticGoodTransport> {
       : event_engine_(std::move(event_engine)),
         control_endpoint_(std::move(control_endpoint), event_engine_.get()),
         data_endpoints_(std::move(pending_data_endpoints), event_engine_.get(),
-                        enable_tracing),
-        options_(options) {}
+                        enable_tracing, /*scheduler=*/nullptr,
+                        options.receive_buffer_allocator,
+                        options.decode_alignment),
+        options_(std::move(options)) {}
+
+  // Most frames that can be sent per write loop iteration.
+  static constexpr size_t kMaxWriteBatchSize = 64;
 
   auto WriteFrame(const FrameInterface& frame) {
     FrameHeader header = frame.MakeHeader();
-    GRPC_TRACE_LOG(chaotic_good, INFO)
-        << "CHAOTIC_GOOD: WriteFrame to:"
-        << ResolvedAddressToString(control_endpoint_.GetPeerAddress())
-               .value_or("<<unknown peer address>>")
-        << " " << frame.ToString();
+    TraceWriteFrame(frame);
     return If(
         // If we have no data endpoints, OR this is a small payload
-        data_endpoints_.empty() ||
-            header.payload_length <= options_.inlined_payload_size_threshold,
+        IsInlined(header),
         // ... then write it to the control endpoint
         [this, &header, &frame]() {
           SliceBuffer output;
@@ -149,18 +170,54 @@ class ChaoticGoodTransport : public RefCounted<ChaoticGoodTransport> {
         });
   }
 
+  // Write out a batch of frames in order.
+  // Each run of consecutive frames small enough to be inlined is serialized
+  // into a single control endpoint write; larger frames go through
+  // WriteFrame.
+  template <typename Frame>
+  auto WriteFrames(std::vector<Frame> frames) {
+    return Loop([this, frames = std::move(frames), next = size_t{0}]() mutable {
+      SliceBuffer output;
+      while (next < frames.size()) {
+        const FrameInterface& frame =
+            absl::ConvertVariantTo<FrameInterface&>(frames[next]);
+        const FrameHeader header = frame.MakeHeader();
+        if (!IsInlined(header)) break;
+        TraceWriteFrame(frame);
+        header.Serialize(output.AddTiny(FrameHeader::kFrameHeaderSize));
+        frame.SerializePayload(output);
+        ++next;
+      }
+      const bool inlined = output.Length() != 0;
+      const FrameInterface* frame =
+          inlined ? nullptr
+                  : &absl::ConvertVariantTo<FrameInterface&>(frames[next++]);
+      const bool done = next == frames.size();
+      return Map(If(
+                     inlined,
+                     [this, output = std::move(output)]() mutable {
+                       return control_endpoint_.Write(std::move(output));
+                     },
+                     [this, frame]() { return WriteFrame(*frame); }),
+                 [done](Empty) -> LoopCtl<absl::Status> {
+                   if (done) return absl::OkStatus();
+                   return Continue();
+                 });
+    });
+  }
+
   // Common outbound loop for both client and server (these vary only over the
   // frame type).
   template <typename Frame>
   auto TransportWriteLoop(MpscReceiver<Frame>& outgoing_frames) {
     return Loop([self = Ref(), &outgoing_frames] {
       return TrySeq(
-          // Get next outgoing frame.
-          outgoing_frames.Next(),
-          // Serialize and write it out.
-          [self = self.get()](Frame client_frame) {
-            return self->WriteFrame(
-                absl::ConvertVariantTo<FrameInterface&>(client_frame));
+          // Get every queued outgoing frame, so that a burst is written with
+          // one wakeup of the write loop and as few writes as possible.
+          outgoing_frames.NextBatch(kMaxWriteBatchSize),
+          // Serialize and write them out.
+          [self = self.get()](std::vector<Frame> frames) {
+            return self->WriteFrames(std::move(frames));
           },
           []() -> LoopCtl<absl::Status> {
             // The write failures will be caught in TrySeq and exit loop.
@@ -223,6 +280,61 @@ class ChaoticGoodTransport : public RefCounted<ChaoticGoodTransport> {
         });
   }
 
+  // Add a data connection to the running transport.
+  absl::Status AddDataEndpoint(PendingConnection endpoint) {
+    return data_endpoints_.AddEndpoint(std::move(endpoint)).status();
+  }
+
+  // Record data connections requested by the peer; the maintenance loop opens
+  // them, within max_data_connections.
+  void RequestDataEndpoints(uint32_t count) {
+    requested_data_endpoints_.fetch_add(count, std::memory_order_relaxed);
+  }
+
+  // Apply the retired_connection_id list from a settings frame received after
+  // the handshake. Connections we had not retired yet are added to `reply`,
+  // which must be sent back to the peer.
+  absl::Status ReceiveRetiredDataEndpoints(
+      const chaotic_good_frame::Settings& settings,
+      chaotic_good_frame::Settings& reply) {
+    for (const uint32_t id : settings.retired_connection_id()) {
+      if (id == 0 || !data_endpoints_.IsValidConnectionId(id - 1)) {
+        return absl::InternalError(
+            absl::StrCat("Peer retired unknown data connection ", id));
+      }
+      if (data_endpoints_.RetireSending(id - 1)) {
+        reply.add_retired_connection_id(id);
+      }
+      data_endpoints_.RetireReceiving(id - 1);
+    }
+    return absl::OkStatus();
+  }
+
+  // Grow the set of data connections while writes are backed up on all of
+  // them, and retire connections added that way once they go idle.
+  // `grow(transport, settings, count)` opens (server) or asks the peer for
+  // (client) `count` more data connections, describing them in `settings`,
+  // which is then sent to the peer.
+  template <typename Frame, typename Grow>
+  auto DataEndpointsMaintenanceLoop(MpscSender<Frame> outgoing_frames,
+                                    Grow grow) {
+    return Loop([self = Ref(), outgoing_frames = std::move(outgoing_frames),
+                 grow = std::move(grow)]() mutable {
+      return Seq(Sleep(kDataEndpointsMaintenancePeriod),
+                 [self = self.get(), &outgoing_frames,
+                  &grow]() -> LoopCtl<absl::Status> {
+                   SettingsFrame frame;
+                   self->MaintainDataEndpoints(frame.body, grow);
+                   if (frame.body.ByteSizeLong() == 0) return Continue{};
+                   if (!outgoing_frames.UnbufferedImmediateSend(
+                           std::move(frame))) {
+                     return absl::UnavailableError("Transport closed");
+                   }
+                   return Continue{};
+                 });
+    });
+  }
+
   template <typename T>
   absl::StatusOr<T> DeserializeFrame(const FrameHeader& header,
                                      SliceBuffer payload) {
@@ -240,10 +352,53 @@ class ChaoticGoodTransport : public RefCounted<ChaoticGoodTransport> {
   }
 
  private:
+  // Whether a frame with this header is written to the control endpoint,
+  // rather than having its payload sent on a data endpoint.
+  bool IsInlined(const FrameHeader& header) const {
+    return data_endpoints_.empty() ||
+           header.payload_length <= options_.inlined_payload_size_threshold;
+  }
+
+  void TraceWriteFrame(const FrameInterface& frame) {
+    GRPC_TRACE_LOG(chaotic_good, INFO)
+        << "CHAOTIC_GOOD: WriteFrame to:"
+        << ResolvedAddressToString(control_endpoint_.GetPeerAddress())
+               .value_or("<<unknown peer address>>")
+        << " " << frame.ToString();
+  }
+
+  template <typename Grow>
+  void MaintainDataEndpoints(chaotic_good_frame::Settings& settings,
+                             Grow& grow) {
+    const auto report = data_endpoints_.TakeLoadReport();
+    uint32_t wanted =
+        requested_data_endpoints_.exchange(0, std::memory_order_relaxed);
+    if (report.blocked_time >= kDataEndpointsSaturatedTime) ++wanted;
+    GRPC_TRACE_LOG(chaotic_good, INFO)
+        << "CHAOTIC_GOOD: Data endpoints blocked for " << report.blocked_time
+        << "; " << report.idle_connections.size() << " idle; want " << wanted
+        << " more";
+    if (wanted > 0) {
+      const size_t active = data_endpoints_.ActiveEndpoints();
+      if (active < options_.max_data_connections) {
+        grow(*this, settings,
+             std::min<uint32_t>(wanted,
+                                options_.max_data_connections - active));
+      }
+      return;
+    }
+    for (const uint32_t id : report.idle_connections) {
+      if (data_endpoints_.RetireSending(id)) {
+        settings.add_retired_connection_id(id + 1);
+      }
+    }
+  }
+
   std::shared_ptr<grpc_event_engine::experimental::EventEngine> event_engine_;
   ControlEndpoint control_endpoint_;
   DataEndpoints data_endpoints_;
   const Options options_;
+  std::atomic<uint32_t> requested_data_endpoints_{0};
 };
 
 }  // namespace chaotic_good
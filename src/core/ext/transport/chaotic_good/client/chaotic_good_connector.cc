@@ -33,6 +33,7 @@
 #include "src/core/ext/transport/chaotic_good/client_transport.h"
 #include "src/core/ext/transport/chaotic_good/frame.h"
 #include "src/core/ext/transport/chaotic_good/frame_header.h"
+#include "src/core/ext/transport/chaotic_good/shared_memory_endpoint.h"
 #include "src/core/handshaker/handshaker.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/event_engine/channel_args_endpoint_config.h"
@@ -269,16 +270,44 @@ PendingConnection ChaoticGoodConnector::ConnectionCreator::Connect(
   chaotic_good_frame::Settings settings;
   settings.set_data_channel(true);
   settings.add_connection_id(id);
+  std::shared_ptr<SharedMemoryRegion> shared_memory;
+  if (IsUnixSocketAddress(address_) &&
+      args_.GetBool(GRPC_ARG_CHAOTIC_GOOD_SHARED_MEMORY_DATA_ENDPOINTS)
+          .value_or(false)) {
+    auto region = SharedMemoryRegion::Create();
+    if (region.ok()) {
+      shared_memory = std::move(*region);
+      settings.set_shared_memory_name(shared_memory->name());
+    } else {
+      GRPC_TRACE_LOG(chaotic_good, INFO)
+          << "CHAOTIC_GOOD: no shared memory for data connection: "
+          << region.status();
+    }
+  }
   return PendingConnection(
       id,
       Map(ConnectChaoticGood(
               address_, args_,
               Timestamp::Now() + Duration::FromSecondsAsDouble(kTimeoutSecs),
               std::move(settings)),
-          [](absl::StatusOr<ConnectChaoticGoodResult> result)
-              -> absl::StatusOr<PromiseEndpoint> {
+          [shared_memory = std::move(shared_memory),
+           event_engine = args_.GetObjectRef<EventEngine>()](
+              absl::StatusOr<ConnectChaoticGoodResult> result) mutable
+          -> absl::StatusOr<PromiseEndpoint> {
             if (!result.ok()) return result.status();
-            return std::move(result->connect_result.endpoint);
+            if (shared_memory == nullptr) {
+              return std::move(result->connect_result.endpoint);
+            }
+            // The server has either mapped the region or refused it by now.
+            shared_memory->Unlink();
+            if (result->server_settings.shared_memory_name() !=
+                shared_memory->name()) {
+              return std::move(result->connect_result.endpoint);
+            }
+            return MakeSharedMemoryEndpoint(
+                std::move(result->connect_result.endpoint),
+                std::move(shared_memory), /*is_client=*/true,
+                std::move(event_engine));
           }));
 }
 
@@ -32,11 +32,13 @@
 #include "absl/random/random.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
+#include "src/core/ext/filters/message_size/message_size_filter.h"
 #include "src/core/ext/transport/chaotic_good/chaotic_good_transport.h"
 #include "src/core/ext/transport/chaotic_good/frame.h"
 #include "src/core/ext/transport/chaotic_good/frame_header.h"
 #include "src/core/lib/event_engine/event_engine_context.h"
 #include "src/core/lib/event_engine/query_extensions.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/promise/loop.h"
 #include "src/core/lib/promise/map.h"
@@ -184,6 +186,27 @@ auto ChaoticGoodClientTransport::TransportReadLoop(
                           return DispatchFrame<MessageChunkFrame>(
                               std::move(transport), std::move(incoming_frame));
                         }),
+                        Case<FrameType::kCompressedMessageChunk>(
+                            [&, this]() {
+                              // Map just gives this case a promise type that
+                              // differs from the kMessageChunk case.
+                              return Map(DispatchFrame<MessageChunkFrame>(
+                                             std::move(transport),
+                                             std::move(incoming_frame)),
+                                         [](absl::Status status) {
+                                           return status;
+                                         });
+                            }),
+                        Case<FrameType::kSettings>([&, this]() {
+                          return TrySeq(
+                              incoming_frame.Payload(),
+                              [this, transport = std::move(transport),
+                               header = incoming_frame.header()](
+                                  SliceBuffer payload) {
+                                return OnSettingsFrame(*transport, header,
+                                                       std::move(payload));
+                              });
+                        }),
                         Default([&]() {
                           ABSL_LOG_EVERY_N_SEC(INFO, 10)
                               << "Bad frame type: "
@@ -195,6 +218,30 @@ auto ChaoticGoodClientTransport::TransportReadLoop(
   });
 }
 
+absl::Status ChaoticGoodClientTransport::OnSettingsFrame(
+    ChaoticGoodTransport& transport, const FrameHeader& header,
+    SliceBuffer payload) {
+  auto frame =
+      transport.DeserializeFrame<SettingsFrame>(header, std::move(payload));
+  if (!frame.ok()) return frame.status();
+  SettingsFrame reply;
+  auto status = transport.ReceiveRetiredDataEndpoints(frame->body, reply.body);
+  if (!status.ok()) return status;
+  // The server adds data connections in the order it lists them, so that both
+  // sides agree on their connection ids.
+  for (const auto& connection_id : frame->body.connection_id()) {
+    if (connector_ == nullptr) {
+      return absl::InternalError("No connector for new data connections");
+    }
+    status = transport.AddDataEndpoint(connector_->Connect(connection_id));
+    if (!status.ok()) return status;
+  }
+  if (reply.body.retired_connection_id_size() != 0) {
+    outgoing_frames_.MakeSender().UnbufferedImmediateSend(std::move(reply));
+  }
+  return absl::OkStatus();
+}
+
 auto ChaoticGoodClientTransport::OnTransportActivityDone(
     absl::string_view what) {
   return [self = RefAsSubclass<ChaoticGoodClientTransport>(),
@@ -208,12 +255,16 @@ auto ChaoticGoodClientTransport::OnTransportActivityDone(
 
 ChaoticGoodClientTransport::ChaoticGoodClientTransport(
     const ChannelArgs& args, PromiseEndpoint control_endpoint, Config config,
-    RefCountedPtr<ClientConnectionFactory>)
+    RefCountedPtr<ClientConnectionFactory> connector)
     : allocator_(args.GetObject<ResourceQuota>()
                      ->memory_quota()
                      ->CreateMemoryAllocator("chaotic-good")),
+      connector_(std::move(connector)),
       outgoing_frames_(4),
-      message_chunker_(config.MakeMessageChunker()) {
+      message_chunker_(config.MakeMessageChunker()),
+      max_recv_message_length_(IsTransportMessageSizeCheckEnabled()
+                                   ? GetMaxRecvSizeFromChannelArgs(args)
+                                   : std::nullopt) {
   auto event_engine =
       args.GetObjectRef<grpc_event_engine::experimental::EventEngine>();
   auto transport = MakeRefCounted<ChaoticGoodTransport>(
@@ -228,6 +279,17 @@ ChaoticGoodClientTransport::ChaoticGoodClientTransport(
       GRPC_LATENT_SEE_PROMISE("ClientTransportWriteLoop",
                               transport->TransportWriteLoop(outgoing_frames_)),
       OnTransportActivityDone("write_loop"));
+  if (config.max_data_connections() > 0) {
+    party_->Spawn(
+        "client-chaotic-data-endpoints",
+        transport->DataEndpointsMaintenanceLoop(
+            outgoing_frames_.MakeSender(),
+            [](ChaoticGoodTransport&, chaotic_good_frame::Settings& settings,
+               uint32_t count) {
+              settings.set_requested_data_connections(count);
+            }),
+        [](absl::Status) {});
+  }
   party_->Spawn(
       "client-chaotic-reader",
       GRPC_LATENT_SEE_PROMISE("ClientTransportReadLoop",
@@ -276,7 +338,8 @@ uint32_t ChaoticGoodClientTransport::MakeStream(CallHandler call_handler) {
       });
   if (!on_done_added) return 0;
   stream_map_.emplace(stream_id,
-                      MakeRefCounted<Stream>(std::move(call_handler)));
+                      MakeRefCounted<Stream>(std::move(call_handler),
+                                             max_recv_message_length_));
   return stream_id;
 }
 
@@ -85,7 +85,8 @@ class ChaoticGoodClientTransport final : public ClientTransport {
 
  private:
   struct Stream : public RefCounted<Stream> {
-    explicit Stream(CallHandler call) : call(std::move(call)) {}
+    Stream(CallHandler call, std::optional<uint32_t> max_recv_message_length)
+        : call(std::move(call)), message_reassembly(max_recv_message_length) {}
     CallHandler call;
     MessageReassembly message_reassembly;
   };
@@ -99,6 +100,9 @@ class ChaoticGoodClientTransport final : public ClientTransport {
   auto DispatchFrame(RefCountedPtr<ChaoticGoodTransport> transport,
                      IncomingFrame incoming_frame);
   auto TransportReadLoop(RefCountedPtr<ChaoticGoodTransport> transport);
+  // Handle a settings frame received after the handshake.
+  absl::Status OnSettingsFrame(ChaoticGoodTransport& transport,
+                               const FrameHeader& header, SliceBuffer payload);
   // Push one frame into a call
   auto PushFrameIntoCall(ServerInitialMetadataFrame frame,
                          RefCountedPtr<Stream> stream);
@@ -109,6 +113,8 @@ class ChaoticGoodClientTransport final : public ClientTransport {
   auto PushFrameIntoCall(MessageChunkFrame frame, RefCountedPtr<Stream> stream);
 
   grpc_event_engine::experimental::MemoryAllocator allocator_;
+  // Opens the data connections the server adds after the handshake.
+  const RefCountedPtr<ClientConnectionFactory> connector_;
   // Max buffer is set to 4, so that for stream writes each time it will queue
   // at most 2 frames.
   MpscReceiver<ClientFrame> outgoing_frames_;
@@ -120,6 +126,8 @@ class ChaoticGoodClientTransport final : public ClientTransport {
   ConnectivityStateTracker state_tracker_ ABSL_GUARDED_BY(mu_){
       "chaotic_good_client", GRPC_CHANNEL_READY};
   MessageChunker message_chunker_;
+  // Set when the transport_message_size_check experiment is enabled.
+  const std::optional<uint32_t> max_recv_message_length_;
 };
 
 }  // namespace chaotic_good
@@ -15,6 +15,9 @@
 #ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_CONFIG_H
 #define GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_CONFIG_H
 
+#include <grpc/impl/compression_types.h>
+
+#include <memory>
 #include <vector>
 
 #include "absl/container/flat_hash_set.h"
@@ -23,6 +26,7 @@
 #include "src/core/ext/transport/chaotic_good/message_chunker.h"
 #include "src/core/ext/transport/chaotic_good/pending_connection.h"
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/event_engine/extensions/chaotic_good_extension.h"
 #include "src/core/lib/event_engine/extensions/tcp_trace.h"
 
 namespace grpc_core {
@@ -35,6 +39,18 @@ namespace chaotic_good {
   "grpc.chaotic_good.max_send_chunk_size"
 #define GRPC_ARG_CHAOTIC_GOOD_INLINED_PAYLOAD_SIZE_THRESHOLD \
   "grpc.chaotic_good.inlined_payload_size_threshold"
+// Upper bound on data connections for one transport. If set, connections are
+// added while writes are backed up on all of the current ones, and the added
+// connections are retired again once idle. 0 (the default) fixes the set of
+// data connections at handshake.
+#define GRPC_ARG_CHAOTIC_GOOD_MAX_DATA_CONNECTIONS \
+  "grpc.chaotic_good.max_data_connections"
+// Compression algorithm (a grpc_compression_algorithm value) applied to each
+// chunk of a chunked message. Chunks are compressed independently, so they can
+// be compressed in parallel and decompressed as they arrive. Only used if the
+// peer supports it; defaults to GRPC_COMPRESS_NONE.
+#define GRPC_ARG_CHAOTIC_GOOD_CHUNK_COMPRESSION_ALGORITHM \
+  "grpc.chaotic_good.chunk_compression_algorithm"
 
 // Transport configuration.
 // Most of our configuration is derived from channel args, and then exchanged
@@ -50,6 +66,8 @@ class Config {
     decode_alignment_ =
         std::max(1, channel_args.GetInt(GRPC_ARG_CHAOTIC_GOOD_ALIGNMENT)
                         .value_or(decode_alignment_));
+    receive_buffer_allocator_ = channel_args.GetObjectRef<
+        grpc_event_engine::experimental::ChaoticGoodReceiveBufferAllocator>();
     max_recv_chunk_size_ = std::max(
         0, channel_args.GetInt(GRPC_ARG_CHAOTIC_GOOD_MAX_RECV_CHUNK_SIZE)
                .value_or(max_recv_chunk_size_));
@@ -66,6 +84,21 @@ class Config {
                .value_or(inline_payload_size_threshold_));
     tracing_enabled_ =
         channel_args.GetBool(GRPC_ARG_TCP_TRACING_ENABLED).value_or(false);
+    max_data_connections_ = std::max(
+        0, channel_args.GetInt(GRPC_ARG_CHAOTIC_GOOD_MAX_DATA_CONNECTIONS)
+               .value_or(max_data_connections_));
+    const int chunk_compression =
+        channel_args
+            .GetInt(GRPC_ARG_CHAOTIC_GOOD_CHUNK_COMPRESSION_ALGORITHM)
+            .value_or(GRPC_COMPRESS_NONE);
+    if (chunk_compression > GRPC_COMPRESS_NONE &&
+        chunk_compression < GRPC_COMPRESS_ALGORITHMS_COUNT) {
+      chunk_compression_ =
+          static_cast<grpc_compression_algorithm>(chunk_compression);
+      // Only advertised when enabled: older peers reject unknown features.
+      supported_features_.insert(
+          chaotic_good_frame::Settings::CHUNK_COMPRESSION);
+    }
   }
 
   Config(const Config&) = delete;
@@ -128,7 +161,10 @@ class Config {
       }
       const auto valid_feature =
           static_cast<chaotic_good_frame::Settings::Features>(feature);
-      if (!supported_features_.contains(valid_feature)) {
+      // Any server can decompress chunks, whether or not it compresses the
+      // chunks it sends.
+      if (!supported_features_.contains(valid_feature) &&
+          valid_feature != chaotic_good_frame::Settings::CHUNK_COMPRESSION) {
         return absl::InternalError(absl::StrCat(
             "Unsupported feature present in chaotic-good handshake: ",
             chaotic_good_frame::Settings::Features_Name(valid_feature)));
@@ -148,12 +184,16 @@ class Config {
     options.encode_alignment = encode_alignment_;
     options.decode_alignment = decode_alignment_;
     options.inlined_payload_size_threshold = inline_payload_size_threshold_;
+    options.max_data_connections = max_data_connections_;
+    options.receive_buffer_allocator = receive_buffer_allocator_;
     return options;
   }
 
   // Factory: create a message chunker based on negotiated settings.
   MessageChunker MakeMessageChunker() const {
-    return MessageChunker(max_send_chunk_size_, encode_alignment_);
+    return MessageChunker(max_send_chunk_size_, encode_alignment_,
+                          supports_chunk_compression() ? chunk_compression_
+                                                       : GRPC_COMPRESS_NONE);
   }
 
   bool tracing_enabled() const { return tracing_enabled_; }
@@ -171,12 +211,15 @@ class Config {
   uint32_t inline_payload_size_threshold() const {
     return inline_payload_size_threshold_;
   }
+  uint32_t max_data_connections() const { return max_data_connections_; }
 
   std::string ToString() const {
     return absl::StrCat(GRPC_DUMP_ARGS(tracing_enabled_, encode_alignment_,
                                        decode_alignment_, max_send_chunk_size_,
                                        max_recv_chunk_size_,
-                                       inline_payload_size_threshold_));
+                                       inline_payload_size_threshold_,
+                                       max_data_connections_,
+                                       chunk_compression_));
   }
 
   template <typename Sink>
@@ -187,6 +230,10 @@ class Config {
   bool supports_chunking() const {
     return supported_features_.contains(chaotic_good_frame::Settings::CHUNKING);
   }
+  bool supports_chunk_compression() const {
+    return supported_features_.contains(
+        chaotic_good_frame::Settings::CHUNK_COMPRESSION);
+  }
 
  private:
   // Fill-in a settings frame to be sent with the results of the negotiation so
@@ -196,6 +243,9 @@ class Config {
   void PrepareOutgoingSettings(chaotic_good_frame::Settings& settings) const {
     settings.set_alignment(decode_alignment_);
     settings.set_max_chunk_size(max_recv_chunk_size_);
+    for (const auto feature : supported_features_) {
+      settings.add_supported_features(feature);
+    }
   }
 
   // Receive a settings frame from our peer and integrate its settings with our
@@ -218,6 +268,11 @@ class Config {
   uint32_t max_send_chunk_size_ = 1024 * 1024;
   uint32_t max_recv_chunk_size_ = 1024 * 1024;
   uint32_t inline_payload_size_threshold_ = 8 * 1024;
+  uint32_t max_data_connections_ = 0;
+  grpc_compression_algorithm chunk_compression_ = GRPC_COMPRESS_NONE;
+  std::shared_ptr<
+      grpc_event_engine::experimental::ChaoticGoodReceiveBufferAllocator>
+      receive_buffer_allocator_;
   std::vector<PendingConnection> pending_data_endpoints_;
   absl::flat_hash_set<chaotic_good_frame::Settings::Features>
       supported_features_;
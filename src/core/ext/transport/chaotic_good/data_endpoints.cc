@@ -14,17 +14,24 @@
 
 #include "src/core/ext/transport/chaotic_good/data_endpoints.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
+#include <utility>
 
 #include "absl/cleanup/cleanup.h"
+#include "absl/container/inlined_vector.h"
 #include "absl/strings/escaping.h"
 #include "src/core/ext/transport/chaotic_good/pending_connection.h"
 #include "src/core/lib/event_engine/event_engine_context.h"
+#include "src/core/lib/event_engine/extensions/chaotic_good_extension.h"
 #include "src/core/lib/event_engine/extensions/tcp_trace.h"
 #include "src/core/lib/event_engine/query_extensions.h"
 #include "src/core/lib/event_engine/tcp_socket_utils.h"
+#include "src/core/lib/promise/if.h"
+#include "src/core/lib/promise/inter_activity_latch.h"
 #include "src/core/lib/promise/loop.h"
 #include "src/core/lib/promise/seq.h"
 #include "src/core/lib/promise/try_seq.h"
@@ -38,14 +45,90 @@ namespace data_endpoints_detail {
 // OutputBuffer
 
 bool OutputBuffer::Accept(SliceBuffer& buffer) {
-  if (pending_.Length() != 0 &&
-      pending_.Length() + buffer.Length() > pending_max_) {
-    return false;
-  }
+  if (!CanAccept(buffer.Length())) return false;
   pending_.Append(buffer);
   return true;
 }
 
+SliceBuffer OutputBuffer::TakePending(Timestamp now) {
+  in_flight_bytes_ = pending_.Length();
+  write_start_ = now;
+  MarkActive(now);
+  return std::move(pending_);
+}
+
+void OutputBuffer::WriteCompleted(Timestamp now) {
+  const size_t written = std::exchange(in_flight_bytes_, 0);
+  MarkActive(now);
+  const double seconds = (now - write_start_).seconds();
+  if (written < kMinSampleBytes || seconds <= 0) return;
+  const double sample = written / seconds;
+  // Exponentially weighted so that one slow write moves the estimate, but
+  // a single outlier does not dominate it.
+  bytes_per_second_ = bytes_per_second_.has_value()
+                          ? 0.75 * *bytes_per_second_ + 0.25 * sample
+                          : sample;
+  const double target = *bytes_per_second_ * kTargetQueueDelay.seconds();
+  pending_max_ = static_cast<size_t>(
+      std::clamp(target, static_cast<double>(kMinPendingMax),
+                 static_cast<double>(kMaxPendingMax)));
+}
+
+bool OutputBuffer::TakeTcpInfoSample(Timestamp now) {
+  if (now < next_tcp_info_sample_) return false;
+  next_tcp_info_sample_ = now + kTcpInfoSamplePeriod;
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Schedulers
+
+namespace {
+
+class FirstFitScheduler final : public Scheduler {
+ public:
+  uint32_t Choose(absl::Span<const Candidate> candidates, size_t) override {
+    return candidates.front().connection_id;
+  }
+};
+
+class DrainTimeScheduler final : public Scheduler {
+ public:
+  uint32_t Choose(absl::Span<const Candidate> candidates,
+                  size_t bytes) override {
+    // Endpoints that have not been measured yet are assumed to be as fast as
+    // the fastest measured one, so that they receive traffic and get
+    // measured. If nothing is measured, this degrades to least-queued.
+    double fastest = 0;
+    for (const auto& candidate : candidates) {
+      fastest = std::max(fastest, candidate.bytes_per_second.value_or(0));
+    }
+    if (fastest == 0) fastest = 1;
+    uint32_t best = candidates.front().connection_id;
+    double best_drain_time = std::numeric_limits<double>::infinity();
+    for (const auto& candidate : candidates) {
+      double rate = candidate.bytes_per_second.value_or(fastest);
+      if (rate <= 0) rate = fastest;
+      const double drain_time = (candidate.queued_bytes + bytes) / rate;
+      if (drain_time < best_drain_time) {
+        best_drain_time = drain_time;
+        best = candidate.connection_id;
+      }
+    }
+    return best;
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<Scheduler> MakeFirstFitScheduler() {
+  return std::make_unique<FirstFitScheduler>();
+}
+
+std::unique_ptr<Scheduler> MakeDrainTimeScheduler() {
+  return std::make_unique<DrainTimeScheduler>();
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // OutputBuffers
 
@@ -54,23 +137,40 @@ Poll<uint32_t> OutputBuffers::PollWrite(SliceBuffer& output_buffer) {
   auto cleanup = absl::MakeCleanup([&waker]() { waker.Wakeup(); });
   const auto length = output_buffer.Length();
   MutexLock lock(&mu_);
+  absl::InlinedVector<Scheduler::Candidate, 8> candidates;
   for (size_t i = 0; i < buffers_.size(); ++i) {
-    if (buffers_[i].has_value() && buffers_[i]->Accept(output_buffer)) {
-      GRPC_TRACE_LOG(chaotic_good, INFO)
-          << "CHAOTIC_GOOD: Queue " << length << " data onto endpoint " << i
-          << " queue " << this;
-      waker = buffers_[i]->TakeWaker();
-      return i;
+    if (buffers_[i].has_value() && !retired_.contains(i) &&
+        buffers_[i]->CanAccept(length)) {
+      candidates.push_back({static_cast<uint32_t>(i),
+                            buffers_[i]->queued_bytes(),
+                            buffers_[i]->bytes_per_second()});
     }
   }
+  if (!candidates.empty()) {
+    const uint32_t i = scheduler_->Choose(candidates, length);
+    ABSL_CHECK_LT(i, buffers_.size());
+    ABSL_CHECK(buffers_[i].has_value());
+    ABSL_CHECK(buffers_[i]->Accept(output_buffer));
+    GRPC_TRACE_LOG(chaotic_good, INFO)
+        << "CHAOTIC_GOOD: Queue " << length << " data onto endpoint " << i
+        << " queue " << this;
+    waker = buffers_[i]->TakeWaker();
+    if (blocked_since_.has_value()) {
+      blocked_time_ += Timestamp::Now() - *blocked_since_;
+      blocked_since_.reset();
+    }
+    return i;
+  }
   GRPC_TRACE_LOG(chaotic_good, INFO)
       << "CHAOTIC_GOOD: No data endpoint ready for " << length
       << " bytes on queue " << this;
   write_waker_ = GetContext<Activity>()->MakeNonOwningWaker();
+  if (!blocked_since_.has_value()) blocked_since_ = Timestamp::Now();
   return Pending{};
 }
 
-Poll<SliceBuffer> OutputBuffers::PollNext(uint32_t connection_id) {
+Poll<std::optional<SliceBuffer>> OutputBuffers::PollNext(
+    uint32_t connection_id) {
   Waker waker;
   auto cleanup = absl::MakeCleanup([&waker]() { waker.Wakeup(); });
   MutexLock lock(&mu_);
@@ -78,7 +178,15 @@ Poll<SliceBuffer> OutputBuffers::PollNext(uint32_t connection_id) {
   ABSL_CHECK(buffer.has_value());
   if (buffer->HavePending()) {
     waker = std::move(write_waker_);
-    return buffer->TakePending();
+    return std::optional<SliceBuffer>(buffer->TakePending(Timestamp::Now()));
+  }
+  if (retired_.contains(connection_id)) {
+    GRPC_TRACE_LOG(chaotic_good, INFO)
+        << "CHAOTIC_GOOD: Data endpoint #" << connection_id
+        << " retired and flushed on queue " << this;
+    buffer.reset();
+    ready_endpoints_.fetch_sub(1, std::memory_order_relaxed);
+    return std::optional<SliceBuffer>();
   }
   buffer->SetWaker();
   return Pending{};
@@ -93,10 +201,69 @@ void OutputBuffers::AddEndpoint(uint32_t connection_id) {
   }
   ABSL_CHECK(!buffers_[connection_id].has_value()) << GRPC_DUMP_ARGS(connection_id);
   buffers_[connection_id].emplace();
+  buffers_[connection_id]->MarkActive(Timestamp::Now());
   waker = std::move(write_waker_);
   ready_endpoints_.fetch_add(1, std::memory_order_relaxed);
 }
 
+void OutputBuffers::WriteCompleted(
+    uint32_t connection_id,
+    grpc_event_engine::experimental::TcpInfoExtension* tcp_info) {
+  Waker waker;
+  auto cleanup = absl::MakeCleanup([&waker]() { waker.Wakeup(); });
+  MutexLock lock(&mu_);
+  auto& buffer = buffers_[connection_id];
+  ABSL_CHECK(buffer.has_value());
+  const Timestamp now = Timestamp::Now();
+  buffer->WriteCompleted(now);
+  if (tcp_info != nullptr && buffer->TakeTcpInfoSample(now)) {
+    auto metrics = tcp_info->GetTcpInfo();
+    if (metrics.has_value() && metrics->delivery_rate.has_value()) {
+      buffer->RecordTcpDeliveryRate(*metrics->delivery_rate);
+    }
+  }
+  GRPC_TRACE_LOG(chaotic_good, INFO)
+      << "CHAOTIC_GOOD: Data endpoint #" << connection_id
+      << " throughput estimate "
+      << buffer->bytes_per_second().value_or(0) << "B/s; pending limit "
+      << buffer->pending_max() << "b";
+  // The limit may have grown: give a blocked writer another chance.
+  waker = std::move(write_waker_);
+}
+
+bool OutputBuffers::Retire(uint32_t connection_id) {
+  Waker waker;
+  auto cleanup = absl::MakeCleanup([&waker]() { waker.Wakeup(); });
+  MutexLock lock(&mu_);
+  if (!retired_.insert(connection_id).second) return false;
+  GRPC_TRACE_LOG(chaotic_good, INFO)
+      << "CHAOTIC_GOOD: Retire data endpoint #" << connection_id
+      << " on queue " << this;
+  // Wake the write loop so that it notices once the buffer is flushed.
+  if (connection_id < buffers_.size() && buffers_[connection_id].has_value()) {
+    waker = buffers_[connection_id]->TakeWaker();
+  }
+  return true;
+}
+
+LoadReport OutputBuffers::TakeLoadReport(Duration idle_timeout) {
+  const Timestamp now = Timestamp::Now();
+  MutexLock lock(&mu_);
+  if (blocked_since_.has_value()) {
+    blocked_time_ += now - *blocked_since_;
+    blocked_since_ = now;
+  }
+  LoadReport report;
+  report.blocked_time = std::exchange(blocked_time_, Duration::Zero());
+  for (size_t i = 0; i < buffers_.size(); ++i) {
+    if (!buffers_[i].has_value() || retired_.contains(i)) continue;
+    if (buffers_[i]->queued_bytes() != 0) continue;
+    if (now - buffers_[i]->last_activity() < idle_timeout) continue;
+    report.idle_connections.push_back(i);
+  }
+  return report;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // InputQueues
 
@@ -111,6 +278,10 @@ absl::StatusOr<uint64_t> InputQueues::CreateTicket(uint32_t connection_id,
     return absl::UnavailableError(
         absl::StrCat("Invalid connection id: ", connection_id));
   }
+  if (retired_.contains(connection_id)) {
+    return absl::UnavailableError(
+        absl::StrCat("Read from retired connection id: ", connection_id));
+  }
   uint64_t ticket = next_ticket_id_;
   ++next_ticket_id_;
   auto r = ReadRequest{length, ticket};
@@ -138,18 +309,21 @@ Poll<absl::StatusOr<SliceBuffer>> InputQueues::PollRead(uint64_t ticket) {
   return result;
 }
 
-Poll<std::vector<InputQueues::ReadRequest>> InputQueues::PollNext(
-    uint32_t connection_id) {
+Poll<std::optional<std::vector<InputQueues::ReadRequest>>>
+InputQueues::PollNext(uint32_t connection_id) {
   MutexLock lock(&mu_);
   auto& q = read_requests_[connection_id];
   if (q.empty()) {
+    if (retired_.contains(connection_id)) {
+      return std::optional<std::vector<ReadRequest>>();
+    }
     read_request_waker_[connection_id] =
         GetContext<Activity>()->MakeNonOwningWaker();
     return Pending{};
   }
   auto r = std::move(q);
   q.clear();
-  return r;
+  return std::optional<std::vector<ReadRequest>>(std::move(r));
 }
 
 void InputQueues::CompleteRead(uint64_t ticket,
@@ -179,6 +353,16 @@ void InputQueues::AddEndpoint(uint32_t connection_id) {
   }
 }
 
+void InputQueues::Retire(uint32_t connection_id) {
+  Waker waker;
+  auto cleanup = absl::MakeCleanup([&waker]() { waker.Wakeup(); });
+  MutexLock lock(&mu_);
+  retired_.insert(connection_id);
+  if (connection_id < read_request_waker_.size()) {
+    waker = std::move(read_request_waker_[connection_id]);
+  }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Endpoint
 
@@ -186,17 +370,34 @@ auto Endpoint::WriteLoop(uint32_t id,
                          RefCountedPtr<OutputBuffers> output_buffers,
                          std::shared_ptr<PromiseEndpoint> endpoint) {
   output_buffers->AddEndpoint(id);
+  auto* tcp_info = grpc_event_engine::experimental::QueryExtension<
+      grpc_event_engine::experimental::TcpInfoExtension>(
+      endpoint->GetEventEngineEndpoint().get());
   return Loop([id, endpoint = std::move(endpoint),
-               output_buffers = std::move(output_buffers)]() {
+               output_buffers = std::move(output_buffers), tcp_info]() {
     return TrySeq(
         output_buffers->Next(id),
-        [endpoint, id](SliceBuffer buffer) {
-          GRPC_TRACE_LOG(chaotic_good, INFO)
-              << "CHAOTIC_GOOD: Write " << buffer.Length()
-              << "b to data endpoint #" << id;
-          return endpoint->Write(std::move(buffer));
-        },
-        []() -> LoopCtl<absl::Status> { return Continue{}; });
+        [endpoint, id, output_buffers,
+         tcp_info](std::optional<SliceBuffer> buffer) {
+          return If(
+              buffer.has_value(),
+              [&]() {
+                GRPC_TRACE_LOG(chaotic_good, INFO)
+                    << "CHAOTIC_GOOD: Write " << buffer->Length()
+                    << "b to data endpoint #" << id;
+                return Map(endpoint->Write(std::move(*buffer)),
+                           [output_buffers, id, tcp_info](absl::Status status)
+                               -> LoopCtl<absl::Status> {
+                             if (!status.ok()) return status;
+                             output_buffers->WriteCompleted(id, tcp_info);
+                             return Continue{};
+                           });
+              },
+              // Retired and flushed: we're done writing to this endpoint.
+              []() {
+                return Immediate(LoopCtl<absl::Status>(absl::OkStatus()));
+              });
+        });
   });
 }
 
@@ -206,31 +407,46 @@ auto Endpoint::ReadLoop(uint32_t id, RefCountedPtr<InputQueues> input_queues,
     return TrySeq(
         input_queues->Next(id),
         [endpoint, input_queues](
-            std::vector<data_endpoints_detail::InputQueues::ReadRequest>
+            std::optional<
+                std::vector<data_endpoints_detail::InputQueues::ReadRequest>>
                 requests) {
-          return TrySeqContainer(
-              std::move(requests), Empty{},
-              [endpoint, input_queues](
-                  data_endpoints_detail::InputQueues::ReadRequest read_request,
-                  Empty) {
-                return Seq(endpoint->Read(read_request.length),
-                           [ticket = read_request.ticket,
-
-                            input_queues](absl::StatusOr<SliceBuffer> buffer) {
-                             input_queues->CompleteRead(ticket,
-                                                        std::move(buffer));
-                             return Empty{};
-                           });
+          return If(
+              requests.has_value(),
+              [&]() {
+                return Seq(
+                    TrySeqContainer(
+                        std::move(*requests), Empty{},
+                        [endpoint, input_queues](
+                            data_endpoints_detail::InputQueues::ReadRequest
+                                read_request,
+                            Empty) {
+                          return Seq(
+                              endpoint->Read(read_request.length),
+                              [ticket = read_request.ticket, input_queues](
+                                  absl::StatusOr<SliceBuffer> buffer) {
+                                input_queues->CompleteRead(ticket,
+                                                           std::move(buffer));
+                                return Empty{};
+                              });
+                        }),
+                    [](Empty) -> LoopCtl<absl::Status> { return Continue{}; });
+              },
+              // Retired by the peer, and all announced reads are done.
+              []() {
+                return Immediate(LoopCtl<absl::Status>(absl::OkStatus()));
               });
-        },
-        []() -> LoopCtl<absl::Status> { return Continue{}; });
+        });
   });
 }
 
 Endpoint::Endpoint(uint32_t id, RefCountedPtr<OutputBuffers> output_buffers,
                    RefCountedPtr<InputQueues> input_queues,
                    PendingConnection pending_connection, bool enable_tracing,
-                   grpc_event_engine::experimental::EventEngine* event_engine) {
+                   grpc_event_engine::experimental::EventEngine* event_engine,
+                   std::shared_ptr<grpc_event_engine::experimental::
+                                       ChaoticGoodReceiveBufferAllocator>
+                       receive_buffer_allocator,
+                   uint32_t receive_buffer_alignment) {
   input_queues->AddEndpoint(id);
   auto arena = SimpleArenaAllocator(0)->MakeArena();
   arena->SetContext(event_engine);
@@ -240,12 +456,15 @@ Endpoint::Endpoint(uint32_t id, RefCountedPtr<OutputBuffers> output_buffers,
       [id, enable_tracing, output_buffers = std::move(output_buffers),
        input_queues = std::move(input_queues),
        pending_connection = std::move(pending_connection),
-       arena = std::move(arena)]() mutable {
+       arena = std::move(arena),
+       receive_buffer_allocator = std::move(receive_buffer_allocator),
+       receive_buffer_alignment]() mutable {
         return TrySeq(
             pending_connection.Await(),
             [id, enable_tracing, output_buffers = std::move(output_buffers),
-             input_queues = std::move(input_queues),
-             arena = std::move(arena)](PromiseEndpoint ep) mutable {
+             input_queues = std::move(input_queues), arena = std::move(arena),
+             receive_buffer_allocator = std::move(receive_buffer_allocator),
+             receive_buffer_alignment](PromiseEndpoint ep) mutable {
               GRPC_TRACE_LOG(chaotic_good, INFO)
                   << "CHAOTIC_GOOD: data endpoint " << id << " to "
                   << grpc_event_engine::experimental::ResolvedAddressToString(
@@ -257,6 +476,17 @@ Endpoint::Endpoint(uint32_t id, RefCountedPtr<OutputBuffers> output_buffers,
               // transport setup is complete. At this point all the settings
               // frames should have been read.
               endpoint->EnforceRxMemoryAlignmentAndCoalescing();
+              if (receive_buffer_allocator != nullptr) {
+                auto* chaotic_good_ext =
+                    grpc_event_engine::experimental::QueryExtension<
+                        grpc_event_engine::experimental::ChaoticGoodExtension>(
+                        endpoint->GetEventEngineEndpoint().get());
+                if (chaotic_good_ext != nullptr) {
+                  chaotic_good_ext->UseReceiveBufferAllocator(
+                      std::move(receive_buffer_allocator),
+                      receive_buffer_alignment);
+                }
+              }
               if (enable_tracing) {
                 auto* epte = grpc_event_engine::experimental::QueryExtension<
                     grpc_event_engine::experimental::TcpTraceExtension>(
@@ -264,14 +494,29 @@ Endpoint::Endpoint(uint32_t id, RefCountedPtr<OutputBuffers> output_buffers,
                 if (epte != nullptr) epte->InitializeAndReturnTcpTracer();
               }
               auto read_party = Party::Make(std::move(arena));
+              auto read_done = std::make_shared<InterActivityLatch<void>>();
               read_party->Spawn(
                   "read",
                   [id, input_queues = std::move(input_queues), endpoint]() {
                     return ReadLoop(id, input_queues, endpoint);
                   },
-                  [](absl::Status) {});
+                  [read_done](absl::Status) { read_done->Set(); });
+              // A write loop that ends cleanly means the endpoint was retired:
+              // keep the read party alive until the peer's last reads land.
+              // On failure, tear everything down immediately.
               return Map(
-                  WriteLoop(id, std::move(output_buffers), std::move(endpoint)),
+                  Seq(WriteLoop(id, std::move(output_buffers),
+                                std::move(endpoint)),
+                      [read_done](absl::Status status) {
+                        return If(
+                            status.ok(),
+                            [&]() {
+                              return Map(read_done->Wait(), [](Empty) {
+                                return absl::OkStatus();
+                              });
+                            },
+                            [&]() { return Immediate(std::move(status)); });
+                      }),
                   [read_party](auto x) { return x; });
             });
       },
@@ -286,16 +531,67 @@ Endpoint::Endpoint(uint32_t id, RefCountedPtr<OutputBuffers> output_buffers,
 DataEndpoints::DataEndpoints(
     std::vector<PendingConnection> endpoints_vec,
     grpc_event_engine::experimental::EventEngine* event_engine,
-    bool enable_tracing)
-    : output_buffers_(MakeRefCounted<data_endpoints_detail::OutputBuffers>()),
-      input_queues_(MakeRefCounted<data_endpoints_detail::InputQueues>()) {
+    bool enable_tracing,
+    std::unique_ptr<data_endpoints_detail::Scheduler> scheduler,
+    std::shared_ptr<
+        grpc_event_engine::experimental::ChaoticGoodReceiveBufferAllocator>
+        receive_buffer_allocator,
+    uint32_t receive_buffer_alignment)
+    : output_buffers_(MakeRefCounted<data_endpoints_detail::OutputBuffers>(
+          scheduler != nullptr
+              ? std::move(scheduler)
+              : data_endpoints_detail::MakeDrainTimeScheduler())),
+      input_queues_(MakeRefCounted<data_endpoints_detail::InputQueues>()),
+      event_engine_(event_engine),
+      enable_tracing_(enable_tracing),
+      receive_buffer_allocator_(std::move(receive_buffer_allocator)),
+      receive_buffer_alignment_(receive_buffer_alignment),
+      initial_endpoints_(endpoints_vec.size()) {
   ABSL_CHECK(event_engine != nullptr);
   for (size_t i = 0; i < endpoints_vec.size(); ++i) {
     endpoints_.emplace_back(i, output_buffers_, input_queues_,
                             std::move(endpoints_vec[i]), enable_tracing,
-                            event_engine);
+                            event_engine, receive_buffer_allocator_,
+                            receive_buffer_alignment_);
   }
 }
 
+absl::StatusOr<uint32_t> DataEndpoints::AddEndpoint(
+    PendingConnection endpoint) {
+  MutexLock lock(&mu_);
+  // Frame headers carry the connection id plus one in 16 bits.
+  if (endpoints_.size() >= std::numeric_limits<uint16_t>::max()) {
+    return absl::ResourceExhaustedError("Too many data connections");
+  }
+  const uint32_t id = endpoints_.size();
+  endpoints_.emplace_back(id, output_buffers_, input_queues_,
+                          std::move(endpoint), enable_tracing_, event_engine_,
+                          receive_buffer_allocator_, receive_buffer_alignment_);
+  return id;
+}
+
+bool DataEndpoints::RetireSending(uint32_t connection_id) {
+  MutexLock lock(&mu_);
+  if (connection_id >= endpoints_.size()) return false;
+  if (!output_buffers_->Retire(connection_id)) return false;
+  ++retired_sending_;
+  return true;
+}
+
+void DataEndpoints::RetireReceiving(uint32_t connection_id) {
+  input_queues_->Retire(connection_id);
+}
+
+data_endpoints_detail::LoadReport DataEndpoints::TakeLoadReport() {
+  auto report = output_buffers_->TakeLoadReport(kIdleTimeout);
+  auto& idle = report.idle_connections;
+  idle.erase(std::remove_if(idle.begin(), idle.end(),
+                            [this](uint32_t id) {
+                              return id < initial_endpoints_;
+                            }),
+             idle.end());
+  return report;
+}
+
 }  // namespace chaotic_good
 }  // namespace grpc_core
@@ -17,12 +17,20 @@
 
 #include <atomic>
 #include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
 
+#include "absl/container/flat_hash_set.h"
+#include "absl/types/span.h"
 #include "src/core/ext/transport/chaotic_good/pending_connection.h"
+#include "src/core/lib/event_engine/extensions/chaotic_good_extension.h"
+#include "src/core/lib/event_engine/extensions/tcp_info.h"
 #include "src/core/lib/promise/party.h"
 #include "src/core/lib/promise/promise.h"
 #include "src/core/lib/slice/slice_buffer.h"
 #include "src/core/lib/transport/promise_endpoint.h"
+#include "src/core/util/time.h"
 
 namespace grpc_core {
 namespace chaotic_good {
@@ -32,46 +40,151 @@ namespace data_endpoints_detail {
 // Buffered writes for one data endpoint
 class OutputBuffer {
  public:
+  // Per-buffer limits before throughput has been measured, and the bounds an
+  // adaptive limit is clamped to.
+  static constexpr size_t kDefaultPendingMax = 1024 * 1024;
+  static constexpr size_t kMinPendingMax = 64 * 1024;
+  static constexpr size_t kMaxPendingMax = 16 * 1024 * 1024;
+  // How long we are willing to let a payload sit in this buffer: the limit
+  // tracks the amount of data the endpoint drains in this time.
+  static constexpr Duration kTargetQueueDelay = Duration::Milliseconds(50);
+  // Writes smaller than this complete too quickly to give a useful
+  // throughput sample.
+  static constexpr size_t kMinSampleBytes = 16 * 1024;
+  // The least time between two TCP_INFO samples of the endpoint.
+  static constexpr Duration kTcpInfoSamplePeriod = Duration::Seconds(1);
+
+  bool CanAccept(size_t bytes) const {
+    return pending_.Length() == 0 || pending_.Length() + bytes <= pending_max_;
+  }
   bool Accept(SliceBuffer& buffer);
   Waker TakeWaker() { return std::move(flush_waker_); }
   void SetWaker() {
     flush_waker_ = GetContext<Activity>()->MakeNonOwningWaker();
   }
   bool HavePending() const { return pending_.Length() > 0; }
-  SliceBuffer TakePending() { return std::move(pending_); }
+  // Hand the pending bytes to the endpoint; `now` marks the start of the
+  // write so that its completion can be turned into a throughput sample.
+  SliceBuffer TakePending(Timestamp now);
+  // The endpoint finished writing the bytes last returned by TakePending.
+  void WriteCompleted(Timestamp now);
+  // Whether a TCP_INFO sample is due at `now`; if so, the next one is due
+  // kTcpInfoSamplePeriod later.
+  bool TakeTcpInfoSample(Timestamp now);
+  // Record the delivery rate the kernel measured for the connection.
+  void RecordTcpDeliveryRate(double bytes_per_second) {
+    tcp_delivery_rate_ = bytes_per_second;
+  }
+
+  // Record that the endpoint was in use at `now`.
+  void MarkActive(Timestamp now) { last_activity_ = now; }
+  Timestamp last_activity() const { return last_activity_; }
+
+  // Bytes queued here or still being written by the endpoint.
+  size_t queued_bytes() const { return pending_.Length() + in_flight_bytes_; }
+  // Smoothed write throughput of the endpoint. Before the first usable
+  // sample, the last TCP_INFO delivery rate if there is one, else nullopt.
+  std::optional<double> bytes_per_second() const {
+    return bytes_per_second_.has_value() ? bytes_per_second_
+                                         : tcp_delivery_rate_;
+  }
+  size_t pending_max() const { return pending_max_; }
 
  private:
   Waker flush_waker_;
-  size_t pending_max_ = 1024 * 1024;
+  size_t pending_max_ = kDefaultPendingMax;
   SliceBuffer pending_;
+  size_t in_flight_bytes_ = 0;
+  Timestamp write_start_ = Timestamp::InfPast();
+  Timestamp last_activity_ = Timestamp::InfPast();
+  Timestamp next_tcp_info_sample_ = Timestamp::InfPast();
+  std::optional<double> bytes_per_second_;
+  std::optional<double> tcp_delivery_rate_;
+};
+
+// Decides which data endpoint receives each outgoing payload.
+// Called with the OutputBuffers lock held, so implementations must not block.
+class Scheduler {
+ public:
+  // One endpoint able to take the payload right now.
+  struct Candidate {
+    uint32_t connection_id;
+    // Bytes already queued or in flight on this endpoint.
+    size_t queued_bytes;
+    // Throughput estimate for the endpoint; nullopt if not yet measured.
+    std::optional<double> bytes_per_second;
+  };
+
+  virtual ~Scheduler() = default;
+  // Return the connection id of one of `candidates` (which is never empty)
+  // to carry a payload of `bytes` bytes.
+  virtual uint32_t Choose(absl::Span<const Candidate> candidates,
+                          size_t bytes) = 0;
+};
+
+// Place each payload on the first endpoint that has room for it.
+std::unique_ptr<Scheduler> MakeFirstFitScheduler();
+// Place each payload on the endpoint expected to finish sending it soonest,
+// given the bytes already queued there and its measured throughput.
+std::unique_ptr<Scheduler> MakeDrainTimeScheduler();
+
+// Summary of how busy the data endpoints have been since the last report.
+struct LoadReport {
+  // Time during which some write could not be placed on any data endpoint.
+  Duration blocked_time;
+  // Connected endpoints that have written nothing for the idle timeout.
+  std::vector<uint32_t> idle_connections;
 };
 
 // The set of output buffers for all connected data endpoints
 class OutputBuffers : public RefCounted<OutputBuffers> {
  public:
+  explicit OutputBuffers(std::unique_ptr<Scheduler> scheduler)
+      : scheduler_(std::move(scheduler)) {}
+
   auto Write(SliceBuffer output_buffer) {
     return [output_buffer = std::move(output_buffer), this]() mutable {
       return PollWrite(output_buffer);
     };
   }
 
+  // Resolves to the next buffer to write to the endpoint, or to nullopt once
+  // the endpoint has been retired and everything queued on it was written.
   auto Next(uint32_t connection_id) {
     return [this, connection_id]() { return PollNext(connection_id); };
   }
 
   void AddEndpoint(uint32_t connection_id);
 
+  // The endpoint finished writing the last buffer returned by Next().
+  // If tcp_info is set, the connection's TCP_INFO is sampled from it now and
+  // then to seed the throughput estimate.
+  void WriteCompleted(
+      uint32_t connection_id,
+      grpc_event_engine::experimental::TcpInfoExtension* tcp_info = nullptr);
+
+  // Stop placing new writes on an endpoint. Returns false if it was already
+  // retired.
+  bool Retire(uint32_t connection_id);
+
+  LoadReport TakeLoadReport(Duration idle_timeout);
+
   uint32_t ReadyEndpoints() const {
     return ready_endpoints_.load(std::memory_order_relaxed);
   }
 
  private:
   Poll<uint32_t> PollWrite(SliceBuffer& output_buffer);
-  Poll<SliceBuffer> PollNext(uint32_t connection_id);
+  Poll<std::optional<SliceBuffer>> PollNext(uint32_t connection_id);
 
   Mutex mu_;
   std::vector<std::optional<OutputBuffer>> buffers_ ABSL_GUARDED_BY(mu_);
+  absl::flat_hash_set<uint32_t> retired_ ABSL_GUARDED_BY(mu_);
   Waker write_waker_ ABSL_GUARDED_BY(mu_);
+  // Set while a write is waiting for room, to accumulate blocked_time_.
+  std::optional<Timestamp> blocked_since_ ABSL_GUARDED_BY(mu_);
+  Duration blocked_time_ ABSL_GUARDED_BY(mu_);
+  const std::unique_ptr<Scheduler> scheduler_ ABSL_PT_GUARDED_BY(mu_);
   std::atomic<uint32_t> ready_endpoints_{0};
 };
 
@@ -142,6 +255,8 @@ class InputQueues : public RefCounted<InputQueues> {
     return ReadTicket(CreateTicket(connection_id, length), Ref());
   }
 
+  // Resolves to the next batch of reads for the endpoint, or to nullopt once
+  // the peer has retired the endpoint and every read on it was issued.
   auto Next(uint32_t connection_id) {
     return [this, connection_id]() { return PollNext(connection_id); };
   }
@@ -152,16 +267,21 @@ class InputQueues : public RefCounted<InputQueues> {
 
   void AddEndpoint(uint32_t connection_id);
 
+  // The peer will send nothing more on this endpoint.
+  void Retire(uint32_t connection_id);
+
  private:
   using ReadState = std::variant<absl::StatusOr<SliceBuffer>, Waker>;
 
   absl::StatusOr<uint64_t> CreateTicket(uint32_t connection_id, size_t length);
   Poll<absl::StatusOr<SliceBuffer>> PollRead(uint64_t ticket);
-  Poll<std::vector<ReadRequest>> PollNext(uint32_t connection_id);
+  Poll<std::optional<std::vector<ReadRequest>>> PollNext(
+      uint32_t connection_id);
 
   Mutex mu_;
   uint64_t next_ticket_id_ ABSL_GUARDED_BY(mu_) = 0;
   std::vector<std::vector<ReadRequest>> read_requests_ ABSL_GUARDED_BY(mu_);
+  absl::flat_hash_set<uint32_t> retired_ ABSL_GUARDED_BY(mu_);
   std::vector<Waker> read_request_waker_;
   absl::flat_hash_map<uint64_t, ReadState> outstanding_reads_
       ABSL_GUARDED_BY(mu_);
@@ -172,7 +292,11 @@ class Endpoint final {
   Endpoint(uint32_t id, RefCountedPtr<OutputBuffers> output_buffers,
            RefCountedPtr<InputQueues> input_queues,
            PendingConnection pending_connection, bool enable_tracing,
-           grpc_event_engine::experimental::EventEngine* event_engine);
+           grpc_event_engine::experimental::EventEngine* event_engine,
+           std::shared_ptr<grpc_event_engine::experimental::
+                               ChaoticGoodReceiveBufferAllocator>
+               receive_buffer_allocator,
+           uint32_t receive_buffer_alignment);
 
  private:
   static auto WriteLoop(uint32_t id,
@@ -191,10 +315,22 @@ class DataEndpoints {
  public:
   using ReadTicket = data_endpoints_detail::InputQueues::ReadTicket;
 
+  // Endpoints added after construction that stay idle for this long are
+  // candidates for retirement.
+  static constexpr Duration kIdleTimeout = Duration::Seconds(30);
+
+  // If `scheduler` is null, payloads are placed by the drain time scheduler.
+  // If `receive_buffer_allocator` is set, endpoints that support it receive
+  // payloads into buffers from it, aligned to `receive_buffer_alignment`.
   explicit DataEndpoints(
       std::vector<PendingConnection> endpoints,
       grpc_event_engine::experimental::EventEngine* event_engine,
-      bool enable_tracing);
+      bool enable_tracing,
+      std::unique_ptr<data_endpoints_detail::Scheduler> scheduler = nullptr,
+      std::shared_ptr<
+          grpc_event_engine::experimental::ChaoticGoodReceiveBufferAllocator>
+          receive_buffer_allocator = nullptr,
+      uint32_t receive_buffer_alignment = 1);
 
   // Try to queue output_buffer against a data endpoint.
   // Returns a promise that resolves to the data endpoint connection id
@@ -212,11 +348,47 @@ class DataEndpoints {
 
   bool empty() const { return output_buffers_->ReadyEndpoints() == 0; }
 
+  // Add a data connection after construction. The new endpoint gets the next
+  // connection id, so both peers must add connections in the same order.
+  absl::StatusOr<uint32_t> AddEndpoint(PendingConnection endpoint);
+
+  // Retiring a data endpoint takes one call for each direction: RetireSending
+  // once we have decided to put nothing more on it, RetireReceiving once the
+  // peer has said the same. The connection is closed when queued writes have
+  // been flushed and all reads the peer announced have completed.
+  // RetireSending returns false if the endpoint was already retired.
+  bool RetireSending(uint32_t connection_id);
+  void RetireReceiving(uint32_t connection_id);
+
+  bool IsValidConnectionId(uint32_t connection_id) {
+    MutexLock lock(&mu_);
+    return connection_id < endpoints_.size();
+  }
+  // Number of endpoints we may still write to, including those still
+  // connecting.
+  size_t ActiveEndpoints() {
+    MutexLock lock(&mu_);
+    return endpoints_.size() - retired_sending_;
+  }
+
+  // Load since the last call; idle connections are only reported for
+  // endpoints added after construction.
+  data_endpoints_detail::LoadReport TakeLoadReport();
+
  private:
   RefCountedPtr<data_endpoints_detail::OutputBuffers> output_buffers_;
   RefCountedPtr<data_endpoints_detail::InputQueues> input_queues_;
+  grpc_event_engine::experimental::EventEngine* const event_engine_;
+  const bool enable_tracing_;
+  const std::shared_ptr<
+      grpc_event_engine::experimental::ChaoticGoodReceiveBufferAllocator>
+      receive_buffer_allocator_;
+  const uint32_t receive_buffer_alignment_;
+  // Endpoints handed to the constructor are never reported idle.
+  const size_t initial_endpoints_;
   Mutex mu_;
   std::vector<data_endpoints_detail::Endpoint> endpoints_ ABSL_GUARDED_BY(mu_);
+  size_t retired_sending_ ABSL_GUARDED_BY(mu_) = 0;
 };
 
 }  // namespace chaotic_good
@@ -49,6 +49,13 @@ absl::Status ReadProto(SliceBuffer payload,
 
 void WriteProto(const google::protobuf::MessageLite& msg, SliceBuffer& output) {
   auto length = msg.ByteSizeLong();
+  // Small messages (most metadata frames) go into the same inline slice as
+  // whatever precedes them, typically the frame header, rather than a slice
+  // of their own.
+  if (length <= GRPC_SLICE_INLINED_SIZE) {
+    ABSL_CHECK(msg.SerializeToArray(output.AddTiny(length), length));
+    return;
+  }
   auto slice = MutableSlice::CreateUninitialized(length);
   ABSL_CHECK(msg.SerializeToArray(slice.data(), length));
   output.AppendIndexed(Slice(std::move(slice)));
@@ -165,6 +172,15 @@ struct ServerMetadataEncoder {
   chaotic_good_frame::ServerMetadata out;
 };
 
+template <typename Encoder>
+void EncodeTemplate(const grpc_metadata_batch& md, Encoder* e) {
+  const auto* metadata_template = md.get_pointer(GrpcMetadataTemplate());
+  if (metadata_template == nullptr) return;
+  for (const auto& [key, value] : (*metadata_template)->entries()) {
+    e->Encode(key, value);
+  }
+}
+
 template <typename T, typename M>
 absl::StatusOr<T> ReadUnknownFields(const M& msg, T md) {
   absl::Status error = absl::OkStatus();
@@ -185,6 +201,7 @@ chaotic_good_frame::ClientMetadata ClientMetadataProtoFromGrpc(
     const ClientMetadata& md) {
   ClientMetadataEncoder e;
   md.Encode(&e);
+  EncodeTemplate(md, &e);
   return std::move(e.out);
 }
 
@@ -210,6 +227,7 @@ chaotic_good_frame::ServerMetadata ServerMetadataProtoFromGrpc(
     const ServerMetadata& md) {
   ServerMetadataEncoder e;
   md.Encode(&e);
+  EncodeTemplate(md, &e);
   return std::move(e.out);
 }
 
@@ -261,30 +279,58 @@ std::string MessageFrame::ToString() const {
 
 absl::Status MessageChunkFrame::Deserialize(const FrameHeader& header,
                                             SliceBuffer payload) {
-  ABSL_CHECK_EQ(header.type, FrameType::kMessageChunk);
+  ABSL_CHECK(header.type == FrameType::kMessageChunk ||
+             header.type == FrameType::kCompressedMessageChunk);
   if (header.stream_id == 0) {
     return absl::InternalError("Expected non-zero stream id");
   }
   stream_id = header.stream_id;
+  compression = GRPC_COMPRESS_NONE;
+  if (header.type == FrameType::kCompressedMessageChunk) {
+    if (payload.Length() == 0) {
+      return absl::InternalError("Missing compression algorithm");
+    }
+    uint8_t algorithm;
+    payload.MoveFirstNBytesIntoBuffer(1, &algorithm);
+    if (algorithm == GRPC_COMPRESS_NONE ||
+        algorithm >= GRPC_COMPRESS_ALGORITHMS_COUNT) {
+      return absl::InternalError(absl::StrCat(
+          "Invalid compression algorithm: ", static_cast<int>(algorithm)));
+    }
+    compression = static_cast<grpc_compression_algorithm>(algorithm);
+  }
   this->payload = std::move(payload);
   return absl::OkStatus();
 }
 
 FrameHeader MessageChunkFrame::MakeHeader() const {
   auto length = payload.Length();
-  ABSL_CHECK_LE(length, std::numeric_limits<uint32_t>::max());
-  return FrameHeader{FrameType::kMessageChunk, 0, stream_id,
-                     static_cast<uint32_t>(length)};
+  if (compression == GRPC_COMPRESS_NONE) {
+    ABSL_CHECK_LE(length, std::numeric_limits<uint32_t>::max());
+    return FrameHeader{FrameType::kMessageChunk, 0, stream_id,
+                       static_cast<uint32_t>(length)};
+  }
+  ABSL_CHECK_LT(length, std::numeric_limits<uint32_t>::max());
+  return FrameHeader{FrameType::kCompressedMessageChunk, 0, stream_id,
+                     static_cast<uint32_t>(length + 1)};
 }
 
 void MessageChunkFrame::SerializePayload(SliceBuffer& payload) const {
   ABSL_CHECK_NE(stream_id, 0u);
+  if (compression != GRPC_COMPRESS_NONE) {
+    *payload.AddTiny(1) = static_cast<uint8_t>(compression);
+  }
   payload.Append(this->payload);
 }
 
 std::string MessageChunkFrame::ToString() const {
-  return absl::StrCat("MessageChunk{stream_id=", stream_id,
-                      ", payload=", payload.Length(), "b}");
+  std::string out = absl::StrCat("MessageChunk{stream_id=", stream_id,
+                                 ", payload=", payload.Length(), "b");
+  if (compression != GRPC_COMPRESS_NONE) {
+    absl::StrAppend(&out, ", compression=", static_cast<int>(compression));
+  }
+  absl::StrAppend(&out, "}");
+  return out;
 }
 
 }  // namespace chaotic_good
@@ -15,6 +15,7 @@
 #ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_FRAME_H
 #define GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_FRAME_H
 
+#include <grpc/impl/compression_types.h>
 #include <grpc/support/port_platform.h>
 
 #include <cstdint>
@@ -168,6 +169,10 @@ struct MessageFrame final : public FrameInterface {
   MessageHandle message;
 };
 
+// One chunk of a chunked message.
+// If compression is set the chunk is sent as a CompressedMessageChunk frame:
+// payload holds the chunk compressed with that algorithm, and is prefixed on
+// the wire with one byte naming the algorithm.
 struct MessageChunkFrame final : public FrameInterface {
   absl::Status Deserialize(const FrameHeader& header,
                            SliceBuffer payload) override;
@@ -177,14 +182,16 @@ struct MessageChunkFrame final : public FrameInterface {
 
   uint32_t stream_id;
   SliceBuffer payload;
+  grpc_compression_algorithm compression = GRPC_COMPRESS_NONE;
 };
 
 using ClientFrame =
     std::variant<ClientInitialMetadataFrame, MessageFrame, BeginMessageFrame,
-                 MessageChunkFrame, ClientEndOfStream, CancelFrame>;
+                 MessageChunkFrame, ClientEndOfStream, CancelFrame,
+                 SettingsFrame>;
 using ServerFrame =
     std::variant<ServerInitialMetadataFrame, MessageFrame, BeginMessageFrame,
-                 MessageChunkFrame, ServerTrailingMetadataFrame>;
+                 MessageChunkFrame, ServerTrailingMetadataFrame, SettingsFrame>;
 
 }  // namespace chaotic_good
 }  // namespace grpc_core
@@ -89,6 +89,8 @@ std::string FrameTypeString(FrameType type) {
       return "BeginMessage";
     case FrameType::kMessageChunk:
       return "MessageChunk";
+    case FrameType::kCompressedMessageChunk:
+      return "CompressedMessageChunk";
   }
   return absl::StrCat("Unknown[", static_cast<int>(type), "]");
 }
@@ -36,6 +36,7 @@ enum class FrameType : uint8_t {
   kMessage = 0xa0,
   kBeginMessage = 0xa1,
   kMessageChunk = 0xa2,
+  kCompressedMessageChunk = 0xa3,
   kCancel = 0xff,
 };
 
@@ -15,10 +15,19 @@
 #ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_MESSAGE_CHUNKER_H
 #define GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_MESSAGE_CHUNKER_H
 
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/impl/compression_types.h>
+
 #include <cstdint>
+#include <memory>
+#include <vector>
 
 #include "src/core/ext/transport/chaotic_good/frame.h"
+#include "src/core/lib/compression/message_compress.h"
+#include "src/core/lib/event_engine/event_engine_context.h"
+#include "src/core/lib/promise/context.h"
 #include "src/core/lib/promise/if.h"
+#include "src/core/lib/promise/inter_activity_latch.h"
 #include "src/core/lib/promise/loop.h"
 #include "src/core/lib/promise/map.h"
 #include "src/core/lib/promise/seq.h"
@@ -82,13 +91,79 @@ class PayloadChunker {
   uint32_t stream_id_;
   SliceBuffer payload_;
 };
+
+// Splits a payload into chunks and compresses each chunk independently.
+// Chunks are compressed on the EventEngine thread pool (or inline if there's
+// no EventEngine in context), so that the chunks of a large message are
+// compressed in parallel and the first chunks can be sent while later ones
+// are still being compressed.
+class ChunkCompressor
+    : public std::enable_shared_from_this<ChunkCompressor> {
+ public:
+  ChunkCompressor(grpc_compression_algorithm algorithm, PayloadChunker chunker)
+      : algorithm_(algorithm) {
+    while (true) {
+      auto next = chunker.NextChunk();
+      chunks_.emplace_back(std::make_unique<Chunk>(std::move(next.frame)));
+      if (next.done) break;
+    }
+  }
+
+  void Start() {
+    auto* event_engine =
+        MaybeGetContext<grpc_event_engine::experimental::EventEngine>();
+    for (auto& chunk : chunks_) {
+      if (event_engine == nullptr) {
+        Compress(*chunk);
+        continue;
+      }
+      event_engine->Run([self = shared_from_this(), chunk = chunk.get()]() {
+        self->Compress(*chunk);
+      });
+    }
+  }
+
+  size_t num_chunks() const { return chunks_.size(); }
+
+  // Wait for chunk `index` to be compressed, then take it.
+  auto TakeChunk(size_t index) {
+    Chunk* chunk = chunks_[index].get();
+    return Map(chunk->compressed.Wait(),
+               [chunk](Empty) { return std::move(chunk->frame); });
+  }
+
+ private:
+  struct Chunk {
+    explicit Chunk(MessageChunkFrame frame) : frame(std::move(frame)) {}
+    MessageChunkFrame frame;
+    InterActivityLatch<void> compressed;
+  };
+
+  void Compress(Chunk& chunk) {
+    // Chunks that don't shrink are sent uncompressed.
+    SliceBuffer output;
+    if (grpc_msg_compress(algorithm_, chunk.frame.payload.c_slice_buffer(),
+                          output.c_slice_buffer())) {
+      chunk.frame.payload.Swap(&output);
+      chunk.frame.compression = algorithm_;
+    }
+    chunk.compressed.Set();
+  }
+
+  const grpc_compression_algorithm algorithm_;
+  std::vector<std::unique_ptr<Chunk>> chunks_;
+};
 }  // namespace message_chunker_detail
 
 // Helper to send message payloads (possibly chunked!) between client & server.
 class MessageChunker {
  public:
-  MessageChunker(uint32_t max_chunk_size, uint32_t alignment)
-      : max_chunk_size_(max_chunk_size), alignment_(alignment) {}
+  MessageChunker(uint32_t max_chunk_size, uint32_t alignment,
+                 grpc_compression_algorithm chunk_compression =
+                     GRPC_COMPRESS_NONE)
+      : max_chunk_size_(max_chunk_size),
+        alignment_(alignment),
+        chunk_compression_(chunk_compression) {}
 
   template <typename Output>
   auto Send(MessageHandle message, uint32_t stream_id, Output& output) {
@@ -98,18 +173,19 @@ class MessageChunker {
           BeginMessageFrame begin;
           begin.body.set_length(message->payload()->Length());
           begin.stream_id = stream_id;
+          message_chunker_detail::PayloadChunker chunker(
+              max_chunk_size_, alignment_, stream_id,
+              std::move(*message->payload()));
           return Seq(output.Send(std::move(begin)),
-                     Loop([chunker = message_chunker_detail::PayloadChunker(
-                               max_chunk_size_, alignment_, stream_id,
-                               std::move(*message->payload())),
-                           &output]() mutable {
-                       auto next = chunker.NextChunk();
-                       return Map(output.Send(std::move(next.frame)),
-                                  [done = next.done](bool x) -> LoopCtl<bool> {
-                                    if (!done) return Continue{};
-                                    return x;
-                                  });
-                     }));
+                     If(
+                         ShouldCompressChunks(*message),
+                         [&]() {
+                           return SendCompressedChunks(std::move(chunker),
+                                                       output);
+                         },
+                         [&]() {
+                           return SendChunks(std::move(chunker), output);
+                         }));
         },
         [&]() {
           MessageFrame frame;
@@ -121,6 +197,9 @@ class MessageChunker {
 
   uint32_t max_chunk_size() const { return max_chunk_size_; }
   uint32_t alignment() const { return alignment_; }
+  grpc_compression_algorithm chunk_compression() const {
+    return chunk_compression_;
+  }
 
  private:
   bool ShouldChunk(Message& message) {
@@ -128,8 +207,48 @@ class MessageChunker {
            message.payload()->Length() > max_chunk_size_;
   }
 
+  // Messages already compressed by the compression filter are left alone.
+  bool ShouldCompressChunks(Message& message) {
+    return chunk_compression_ != GRPC_COMPRESS_NONE &&
+           (message.flags() & GRPC_WRITE_INTERNAL_COMPRESS) == 0;
+  }
+
+  template <typename Output>
+  static auto SendChunks(message_chunker_detail::PayloadChunker chunker,
+                         Output& output) {
+    return Loop([chunker = std::move(chunker), &output]() mutable {
+      auto next = chunker.NextChunk();
+      return Map(output.Send(std::move(next.frame)),
+                 [done = next.done](bool x) -> LoopCtl<bool> {
+                   if (!done) return Continue{};
+                   return x;
+                 });
+    });
+  }
+
+  template <typename Output>
+  auto SendCompressedChunks(message_chunker_detail::PayloadChunker chunker,
+                            Output& output) {
+    auto compressor = std::make_shared<message_chunker_detail::ChunkCompressor>(
+        chunk_compression_, std::move(chunker));
+    compressor->Start();
+    return Loop([compressor = std::move(compressor), index = size_t{0},
+                 &output]() mutable {
+      const bool done = index + 1 == compressor->num_chunks();
+      return Seq(compressor->TakeChunk(index++),
+                 [&output, done](MessageChunkFrame frame) {
+                   return Map(output.Send(std::move(frame)),
+                              [done](bool x) -> LoopCtl<bool> {
+                                if (!done) return Continue{};
+                                return x;
+                              });
+                 });
+    });
+  }
+
   const uint32_t max_chunk_size_;
   const uint32_t alignment_;
+  const grpc_compression_algorithm chunk_compression_;
 };
 
 }  // namespace chaotic_good
@@ -15,8 +15,17 @@
 #ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_MESSAGE_REASSEMBLY_H
 #define GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_MESSAGE_REASSEMBLY_H
 
+#include <grpc/impl/compression_types.h>
+#include <stdint.h>
+
+#include <optional>
+#include <type_traits>
+
 #include "absl/log/absl_log.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_format.h"
 #include "src/core/ext/transport/chaotic_good/frame.h"
+#include "src/core/lib/compression/message_compress.h"
 #include "src/core/lib/transport/call_spine.h"
 
 namespace grpc_core {
@@ -24,8 +33,15 @@ namespace chaotic_good {
 
 // Reassemble chunks of messages into messages, and enforce invariants about
 // never having two messages in flight on the same stream.
+// Messages longer than max_recv_message_length fail the call as soon as their
+// length is known, so a chunked message is rejected at its BeginMessage
+// rather than once all its chunks are buffered.
 class MessageReassembly {
  public:
+  explicit MessageReassembly(
+      std::optional<uint32_t> max_recv_message_length = std::nullopt)
+      : max_recv_message_length_(max_recv_message_length) {}
+
   void FailCall(CallInitiator& call, absl::string_view msg) {
     ABSL_LOG_EVERY_N_SEC(INFO, 10) << "Call failed during reassembly: " << msg;
     call.Cancel();
@@ -38,15 +54,17 @@ class MessageReassembly {
 
   template <typename Sink>
   auto PushFrameInto(MessageFrame frame, Sink& sink) {
+    bool ok = false;
+    if (!in_message_boundary()) {
+      FailCall(sink,
+               "Received full message without completing previous chunked "
+               "message");
+    } else {
+      ok = CheckLength(frame.message->payload()->Length(), sink);
+    }
     return If(
-        in_message_boundary(),
-        [&]() { return sink.PushMessage(std::move(frame.message)); },
-        [&]() {
-          FailCall(sink,
-                   "Received full message without completing previous chunked "
-                   "message");
-          return Immediate(StatusFlag(Failure{}));
-        });
+        ok, [&]() { return sink.PushMessage(std::move(frame.message)); },
+        []() { return Immediate(StatusFlag(Failure{})); });
   }
 
   template <typename Sink>
@@ -61,7 +79,7 @@ class MessageReassembly {
                "Received begin message for an empty message (not allowed)");
     } else if (frame.body.length() > std::numeric_limits<size_t>::max() / 2) {
       FailCall(sink, "Received too large begin message");
-    } else {
+    } else if (CheckLength(frame.body.length(), sink)) {
       GRPC_TRACE_LOG(chaotic_good, INFO)
           << this << " begin message " << frame.body.ShortDebugString();
       chunk_receiver_ = std::make_unique<ChunkReceiver>();
@@ -77,6 +95,8 @@ class MessageReassembly {
     bool done = false;
     if (in_message_boundary()) {
       FailCall(sink, "Received message chunk without BeginMessage");
+    } else if (!Decompress(frame)) {
+      FailCall(sink, "Failed to decompress message chunk");
     } else if (chunk_receiver_->bytes_remaining < frame.payload.Length()) {
       FailCall(sink, "Message chunks are longer than BeginMessage declared");
     } else {
@@ -105,10 +125,49 @@ class MessageReassembly {
   bool in_message_boundary() { return chunk_receiver_ == nullptr; }
 
  private:
+  // Fails the call, with the status MessageSizeFilter would have given it, if
+  // a message of `length` bytes is over the limit.
+  template <typename Sink>
+  bool CheckLength(uint64_t length, Sink& sink) {
+    if (!max_recv_message_length_.has_value() ||
+        length <= *max_recv_message_length_) {
+      return true;
+    }
+    constexpr bool kIsClient = std::is_same_v<Sink, CallHandler>;
+    ABSL_LOG_EVERY_N_SEC(INFO, 10)
+        << "Call failed during reassembly: message of " << length
+        << "b is over the limit of " << *max_recv_message_length_ << "b";
+    auto status = absl::ResourceExhaustedError(absl::StrFormat(
+        "%s: Received message larger than max (%u vs. %d)",
+        kIsClient ? "CLIENT" : "SERVER", length, *max_recv_message_length_));
+    if constexpr (kIsClient) {
+      sink.PushServerTrailingMetadata(
+          CancelledServerMetadataFromStatus(status));
+    } else {
+      sink.Cancel(std::move(status));
+    }
+    return false;
+  }
+
+  // Chunks are compressed independently, so each one is decompressed as it
+  // arrives rather than once the whole message is in.
+  static bool Decompress(MessageChunkFrame& frame) {
+    if (frame.compression == GRPC_COMPRESS_NONE) return true;
+    SliceBuffer decompressed;
+    if (!grpc_msg_decompress(frame.compression, frame.payload.c_slice_buffer(),
+                             decompressed.c_slice_buffer())) {
+      return false;
+    }
+    frame.payload.Swap(&decompressed);
+    frame.compression = GRPC_COMPRESS_NONE;
+    return true;
+  }
+
   struct ChunkReceiver {
     size_t bytes_remaining;
     SliceBuffer incoming;
   };
+  const std::optional<uint32_t> max_recv_message_length_;
   std::unique_ptr<ChunkReceiver> chunk_receiver_;
 };
 
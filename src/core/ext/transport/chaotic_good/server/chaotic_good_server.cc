@@ -321,8 +321,11 @@ auto ChaoticGoodServerListener::ActiveConnection::HandshakingState::
                             " connection ids in data endpoint "
                             "settings frame (expect one)"));
                       }
-                      self->data_.emplace<DataConnection>(
-                          frame.body.connection_id()[0]);
+                      auto& data_connection =
+                          self->data_.emplace<DataConnection>(
+                              frame.body.connection_id()[0]);
+                      self->MaybeMapSharedMemory(
+                          data_connection, frame.body.shared_memory_name());
                     } else {
                       Config config{self->connection_->args()};
                       auto settings_status =
@@ -352,6 +355,24 @@ auto ChaoticGoodServerListener::ActiveConnection::HandshakingState::
       });
 }
 
+void ChaoticGoodServerListener::ActiveConnection::HandshakingState::
+    MaybeMapSharedMemory(DataConnection& data_connection,
+                         absl::string_view name) {
+  if (name.empty() ||
+      !IsUnixSocketAddress(connection_->endpoint_.GetPeerAddress())) {
+    return;
+  }
+  auto region = SharedMemoryRegion::Open(name);
+  if (!region.ok()) {
+    GRPC_TRACE_LOG(chaotic_good, INFO)
+        << "CHAOTIC_GOOD: not using shared memory for data connection: "
+        << region.status();
+    return;
+  }
+  (*region)->Unlink();
+  data_connection.shared_memory = std::move(*region);
+}
+
 auto ChaoticGoodServerListener::ActiveConnection::HandshakingState::
     ControlEndpointWriteSettingsFrame(RefCountedPtr<HandshakingState> self) {
   SettingsFrame frame;
@@ -379,19 +400,30 @@ auto ChaoticGoodServerListener::ActiveConnection::HandshakingState::
   // Send data endpoint setting frame
   SettingsFrame frame;
   frame.body.set_data_channel(true);
+  auto& data_connection = std::get<DataConnection>(self->data_);
+  if (data_connection.shared_memory != nullptr) {
+    frame.body.set_shared_memory_name(data_connection.shared_memory->name());
+  }
   SliceBuffer write_buffer;
   frame.MakeHeader().Serialize(
       write_buffer.AddTiny(FrameHeader::kFrameHeaderSize));
   frame.SerializePayload(write_buffer);
   // ignore encoding errors: they will be logged separately already
-  return TrySeq(self->connection_->endpoint_.Write(std::move(write_buffer)),
-                [self]() mutable {
-                  self->connection_->listener_->data_connection_listener_
-                      ->FinishDataConnection(
-                          std::get<DataConnection>(self->data_).connection_id,
-                          std::move(self->connection_->endpoint_));
-                  return absl::OkStatus();
-                });
+  return TrySeq(
+      self->connection_->endpoint_.Write(std::move(write_buffer)),
+      [self]() mutable {
+        auto& data_connection = std::get<DataConnection>(self->data_);
+        auto& endpoint = self->connection_->endpoint_;
+        if (data_connection.shared_memory != nullptr) {
+          endpoint = MakeSharedMemoryEndpoint(
+              std::move(endpoint), std::move(data_connection.shared_memory),
+              /*is_client=*/false, self->connection_->listener_->event_engine_);
+        }
+        self->connection_->listener_->data_connection_listener_
+            ->FinishDataConnection(data_connection.connection_id,
+                                   std::move(endpoint));
+        return absl::OkStatus();
+      });
 }
 
 auto ChaoticGoodServerListener::ActiveConnection::HandshakingState::
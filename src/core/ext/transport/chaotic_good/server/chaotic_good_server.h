@@ -31,6 +31,7 @@
 #include "src/core/channelz/channelz.h"
 #include "src/core/ext/transport/chaotic_good/config.h"
 #include "src/core/ext/transport/chaotic_good/pending_connection.h"
+#include "src/core/ext/transport/chaotic_good/shared_memory_endpoint.h"
 #include "src/core/handshaker/handshaker.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/iomgr/closure.h"
@@ -101,6 +102,8 @@ class ChaoticGoodServerListener final : public Server::ListenerInterface {
         explicit DataConnection(std::string connection_id)
             : connection_id(std::move(connection_id)) {}
         std::string connection_id;
+        // Set if the client asked for, and we mapped, shared memory.
+        std::shared_ptr<SharedMemoryRegion> shared_memory;
       };
       struct ControlConnection {
         explicit ControlConnection(Config config) : config(std::move(config)) {}
@@ -116,6 +119,10 @@ class ChaoticGoodServerListener final : public Server::ListenerInterface {
       static auto DataEndpointWriteSettingsFrame(
           RefCountedPtr<HandshakingState> self);
 
+      // Map the client's shared memory region for a data connection, if it
+      // sent one and is on a unix socket.
+      void MaybeMapSharedMemory(DataConnection& data_connection,
+                                absl::string_view name);
       void OnHandshakeDone(absl::StatusOr<HandshakerArgs*> result);
       const RefCountedPtr<ActiveConnection> connection_;
       const RefCountedPtr<HandshakeManager> handshake_mgr_;
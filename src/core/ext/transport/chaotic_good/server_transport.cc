@@ -30,15 +30,18 @@
 #include "absl/random/random.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
+#include "src/core/ext/filters/message_size/message_size_filter.h"
 #include "src/core/ext/transport/chaotic_good/chaotic_good_transport.h"
 #include "src/core/ext/transport/chaotic_good/frame.h"
 #include "src/core/ext/transport/chaotic_good/frame_header.h"
 #include "src/core/lib/event_engine/event_engine_context.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/promise/activity.h"
 #include "src/core/lib/promise/event_engine_wakeup_scheduler.h"
 #include "src/core/lib/promise/for_each.h"
 #include "src/core/lib/promise/loop.h"
+#include "src/core/lib/promise/map.h"
 #include "src/core/lib/promise/switch.h"
 #include "src/core/lib/promise/try_seq.h"
 #include "src/core/lib/resource_quota/arena.h"
@@ -278,10 +281,27 @@ auto ChaoticGoodServerTransport::ReadOneFrame(
                   return DispatchFrame<MessageChunkFrame>(
                       std::move(transport), std::move(incoming_frame));
                 }),
+                Case<FrameType::kCompressedMessageChunk>([&, this]() mutable {
+                  // Map just gives this case a promise type that differs from
+                  // the kMessageChunk case.
+                  return Map(DispatchFrame<MessageChunkFrame>(
+                                 std::move(transport),
+                                 std::move(incoming_frame)),
+                             [](absl::Status status) { return status; });
+                }),
                 Case<FrameType::kClientEndOfStream>([&, this]() mutable {
                   return DispatchFrame<ClientEndOfStream>(
                       std::move(transport), std::move(incoming_frame));
                 }),
+                Case<FrameType::kSettings>([&, this]() {
+                  return TrySeq(incoming_frame.Payload(),
+                                [this, transport = std::move(transport),
+                                 header = incoming_frame.header()](
+                                    SliceBuffer payload) mutable {
+                                  return OnSettingsFrame(*transport, header,
+                                                         std::move(payload));
+                                });
+                }),
                 Case<FrameType::kCancel>([&, this]() {
                   auto stream =
                       ExtractStream(incoming_frame.header().stream_id);
@@ -309,6 +329,42 @@ auto ChaoticGoodServerTransport::ReadOneFrame(
           []() -> LoopCtl<absl::Status> { return Continue{}; }));
 }
 
+absl::Status ChaoticGoodServerTransport::OnSettingsFrame(
+    ChaoticGoodTransport& transport, const FrameHeader& header,
+    SliceBuffer payload) {
+  auto frame =
+      transport.DeserializeFrame<SettingsFrame>(header, std::move(payload));
+  if (!frame.ok()) return frame.status();
+  if (frame->body.connection_id_size() != 0) {
+    return absl::InternalError("Client cannot specify connection ids");
+  }
+  SettingsFrame reply;
+  auto status = transport.ReceiveRetiredDataEndpoints(frame->body, reply.body);
+  if (!status.ok()) return status;
+  if (max_data_connections_ > 0) {
+    transport.RequestDataEndpoints(frame->body.requested_data_connections());
+  }
+  if (reply.body.retired_connection_id_size() != 0) {
+    outgoing_frames_.MakeSender().UnbufferedImmediateSend(std::move(reply));
+  }
+  return absl::OkStatus();
+}
+
+void ChaoticGoodServerTransport::AddDataEndpoints(
+    ChaoticGoodTransport& transport, chaotic_good_frame::Settings& settings,
+    uint32_t count) {
+  auto factory = data_connection_factory_ == nullptr
+                     ? nullptr
+                     : data_connection_factory_->RefIfNonZero();
+  if (factory == nullptr) return;
+  for (uint32_t i = 0; i < count; ++i) {
+    auto pending = factory->RequestDataConnection();
+    std::string connection_id(pending.id());
+    if (!transport.AddDataEndpoint(std::move(pending)).ok()) break;
+    settings.add_connection_id(std::move(connection_id));
+  }
+}
+
 auto ChaoticGoodServerTransport::TransportReadLoop(
     RefCountedPtr<ChaoticGoodTransport> transport) {
   return Seq(got_acceptor_.Wait(),
@@ -330,7 +386,7 @@ auto ChaoticGoodServerTransport::OnTransportActivityDone(
 
 ChaoticGoodServerTransport::ChaoticGoodServerTransport(
     const ChannelArgs& args, PromiseEndpoint control_endpoint, Config config,
-    RefCountedPtr<ServerConnectionFactory>)
+    RefCountedPtr<ServerConnectionFactory> data_connection_factory)
     : call_arena_allocator_(MakeRefCounted<CallArenaAllocator>(
           args.GetObject<ResourceQuota>()
               ->memory_quota()
@@ -338,8 +394,15 @@ ChaoticGoodServerTransport::ChaoticGoodServerTransport(
           1024)),
       event_engine_(
           args.GetObjectRef<grpc_event_engine::experimental::EventEngine>()),
+      data_connection_factory_(data_connection_factory == nullptr
+                                   ? nullptr
+                                   : data_connection_factory->WeakRef()),
+      max_data_connections_(config.max_data_connections()),
       outgoing_frames_(4),
-      message_chunker_(config.MakeMessageChunker()) {
+      message_chunker_(config.MakeMessageChunker()),
+      max_recv_message_length_(IsTransportMessageSizeCheckEnabled()
+                                   ? GetMaxRecvSizeFromChannelArgs(args)
+                                   : std::nullopt) {
   auto transport = MakeRefCounted<ChaoticGoodTransport>(
       std::move(control_endpoint), config.TakePendingDataEndpoints(),
       event_engine_, config.MakeTransportOptions(), false);
@@ -352,6 +415,17 @@ ChaoticGoodServerTransport::ChaoticGoodServerTransport(
       GRPC_LATENT_SEE_PROMISE("ServerTransportWriteLoop",
                               transport->TransportWriteLoop(outgoing_frames_)),
       OnTransportActivityDone("writer"));
+  if (max_data_connections_ > 0) {
+    party_->Spawn("server-chaotic-data-endpoints",
+                  transport->DataEndpointsMaintenanceLoop(
+                      outgoing_frames_.MakeSender(),
+                      [this](ChaoticGoodTransport& transport,
+                             chaotic_good_frame::Settings& settings,
+                             uint32_t count) {
+                        AddDataEndpoints(transport, settings, count);
+                      }),
+                  [](absl::Status) {});
+  }
   party_->Spawn("server-chaotic-reader",
                 GRPC_LATENT_SEE_PROMISE("ServerTransportReadLoop",
                                         TransportReadLoop(transport)),
@@ -452,7 +526,8 @@ absl::Status ChaoticGoodServerTransport::NewStream(
     return absl::CancelledError();
   }
   stream_map_.emplace(stream_id,
-                      MakeRefCounted<Stream>(std::move(call_initiator)));
+                      MakeRefCounted<Stream>(std::move(call_initiator),
+                                             max_recv_message_length_));
   return absl::OkStatus();
 }
 
@@ -96,7 +96,8 @@ class ChaoticGoodServerTransport final : public ServerTransport {
 
  private:
   struct Stream : public RefCounted<Stream> {
-    explicit Stream(CallInitiator call) : call(std::move(call)) {}
+    Stream(CallInitiator call, std::optional<uint32_t> max_recv_message_length)
+        : call(std::move(call)), message_reassembly(max_recv_message_length) {}
     CallInitiator call;
     MessageReassembly message_reassembly;
   };
@@ -114,6 +115,14 @@ class ChaoticGoodServerTransport final : public ServerTransport {
   auto OnTransportActivityDone(absl::string_view activity);
   auto TransportReadLoop(RefCountedPtr<ChaoticGoodTransport> transport);
   auto ReadOneFrame(RefCountedPtr<ChaoticGoodTransport> transport);
+  // Handle a settings frame received after the handshake.
+  absl::Status OnSettingsFrame(ChaoticGoodTransport& transport,
+                               const FrameHeader& header, SliceBuffer payload);
+  // Open `count` more data connections, listing them in `settings` for the
+  // client.
+  void AddDataEndpoints(ChaoticGoodTransport& transport,
+                        chaotic_good_frame::Settings& settings,
+                        uint32_t count);
   // Read different parts of the server frame from control/data endpoints
   // based on frame header.
   // Resolves to a StatusOr<tuple<SliceBuffer, SliceBuffer>>
@@ -139,6 +148,10 @@ class ChaoticGoodServerTransport final : public ServerTransport {
   const RefCountedPtr<CallArenaAllocator> call_arena_allocator_;
   const std::shared_ptr<grpc_event_engine::experimental::EventEngine>
       event_engine_;
+  // Source of data connections added after the handshake. Weak, so as not to
+  // keep the listener's connection factory alive past server shutdown.
+  const WeakRefCountedPtr<ServerConnectionFactory> data_connection_factory_;
+  const uint32_t max_data_connections_;
   InterActivityLatch<void> got_acceptor_;
   MpscReceiver<ServerFrame> outgoing_frames_;
   Mutex mu_;
@@ -150,6 +163,8 @@ class ChaoticGoodServerTransport final : public ServerTransport {
   ConnectivityStateTracker state_tracker_ ABSL_GUARDED_BY(mu_){
       "chaotic_good_server", GRPC_CHANNEL_READY};
   MessageChunker message_chunker_;
+  // Set when the transport_message_size_check experiment is enabled.
+  const std::optional<uint32_t> max_recv_message_length_;
 };
 
 }  // namespace chaotic_good
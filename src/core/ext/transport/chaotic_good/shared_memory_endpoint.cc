@@ -0,0 +1,526 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chaotic_good/shared_memory_endpoint.h"
+
+#include <grpc/event_engine/slice.h>
+#include <grpc/support/port_platform.h>
+#include <string.h>
+
+#include <algorithm>
+#include <new>
+#include <utility>
+
+#include "absl/functional/any_invocable.h"
+#include "absl/log/absl_check.h"
+#include "absl/random/random.h"
+#include "absl/status/status.h"
+#include "absl/strings/match.h"
+#include "absl/strings/str_cat.h"
+#include "src/core/util/strerror.h"
+#include "src/core/util/sync.h"
+
+#ifdef GPR_LINUX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace grpc_core {
+namespace chaotic_good {
+
+using grpc_event_engine::experimental::EventEngine;
+
+namespace {
+
+constexpr absl::string_view kNamePrefix = "/grpc_chaotic_good_";
+constexpr uint64_t kRegionMagic = 0x6772706363677368;  // "grpccgsh"
+
+// Start of the region. Followed by the client->server and server->client
+// ring headers, and then by the data of the two rings in the same order.
+struct alignas(64) RegionHeader {
+  uint64_t magic;
+  uint64_t ring_size;
+};
+
+size_t RegionSize(size_t ring_size) {
+  return sizeof(RegionHeader) + 2 * sizeof(SharedMemoryRing::Header) +
+         2 * ring_size;
+}
+
+SharedMemoryRing RingAt(void* base, size_t index) {
+  auto* region = static_cast<RegionHeader*>(base);
+  auto* headers = reinterpret_cast<SharedMemoryRing::Header*>(region + 1);
+  auto* data = reinterpret_cast<uint8_t*>(headers + 2);
+  return SharedMemoryRing(&headers[index], data + index * region->ring_size,
+                          region->ring_size);
+}
+
+}  // namespace
+
+///////////////////////////////////////////////////////////////////////////////
+// SharedMemoryRing
+
+size_t SharedMemoryRing::Write(
+    grpc_event_engine::experimental::SliceBuffer& data) {
+  const uint64_t head = header_->head.load(std::memory_order_acquire);
+  const uint64_t tail = header_->tail.load(std::memory_order_relaxed);
+  const size_t n = std::min<size_t>(data.Length(), capacity_ - (tail - head));
+  if (n == 0) return 0;
+  const size_t offset = tail & (capacity_ - 1);
+  const size_t first = std::min(n, capacity_ - offset);
+  data.MoveFirstNBytesIntoBuffer(first, data_ + offset);
+  if (n > first) data.MoveFirstNBytesIntoBuffer(n - first, data_);
+  header_->tail.store(tail + n, std::memory_order_release);
+  return n;
+}
+
+size_t SharedMemoryRing::Read(grpc_event_engine::experimental::SliceBuffer& out,
+                              size_t max_bytes) {
+  const uint64_t tail = header_->tail.load(std::memory_order_acquire);
+  const uint64_t head = header_->head.load(std::memory_order_relaxed);
+  const size_t n = std::min<size_t>(tail - head, max_bytes);
+  if (n == 0) return 0;
+  auto slice =
+      grpc_event_engine::experimental::MutableSlice::CreateUninitialized(n);
+  const size_t offset = head & (capacity_ - 1);
+  const size_t first = std::min(n, capacity_ - offset);
+  memcpy(slice.data(), data_ + offset, first);
+  if (n > first) memcpy(slice.data() + first, data_, n - first);
+  header_->head.store(head + n, std::memory_order_release);
+  out.Append(grpc_event_engine::experimental::Slice(std::move(slice)));
+  return n;
+}
+
+size_t SharedMemoryRing::ReadableBytes() const {
+  return header_->tail.load(std::memory_order_acquire) -
+         header_->head.load(std::memory_order_acquire);
+}
+
+size_t SharedMemoryRing::WritableBytes() const {
+  return capacity_ - ReadableBytes();
+}
+
+// The fences order the flag against the ring indices (in both directions),
+// so that either the sleeper sees the change to the ring or the other side
+// sees the flag.
+void SharedMemoryRing::SetConsumerWaiting() {
+  header_->consumer_waiting.store(1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+bool SharedMemoryRing::TakeConsumerWaiting() {
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  return header_->consumer_waiting.exchange(0, std::memory_order_relaxed) != 0;
+}
+
+void SharedMemoryRing::SetProducerWaiting() {
+  header_->producer_waiting.store(1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+bool SharedMemoryRing::TakeProducerWaiting() {
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  return header_->producer_waiting.exchange(0, std::memory_order_relaxed) != 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// SharedMemoryRegion
+
+SharedMemoryRegion::SharedMemoryRegion(std::string name, void* base,
+                                       size_t size)
+    : name_(std::move(name)), base_(base), size_(size) {}
+
+#ifdef GPR_LINUX
+
+absl::StatusOr<std::shared_ptr<SharedMemoryRegion>> SharedMemoryRegion::Create(
+    size_t ring_size) {
+  ABSL_CHECK_NE(ring_size, 0u);
+  ABSL_CHECK_EQ(ring_size & (ring_size - 1), 0u);
+  const std::string name =
+      absl::StrCat(kNamePrefix, getpid(), "_",
+                   absl::Hex(absl::Uniform<uint64_t>(absl::BitGen())));
+  const int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  if (fd < 0) {
+    return absl::InternalError(
+        absl::StrCat("shm_open(", name, "): ", StrError(errno)));
+  }
+  const size_t size = RegionSize(ring_size);
+  if (ftruncate(fd, size) != 0) {
+    const int err = errno;
+    close(fd);
+    shm_unlink(name.c_str());
+    return absl::InternalError(absl::StrCat("ftruncate: ", StrError(err)));
+  }
+  void* base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  const int err = errno;
+  close(fd);
+  if (base == MAP_FAILED) {
+    shm_unlink(name.c_str());
+    return absl::InternalError(absl::StrCat("mmap: ", StrError(err)));
+  }
+  // The region starts out zeroed, so only the headers need constructing.
+  auto* region = new (base) RegionHeader{kRegionMagic, ring_size};
+  auto* headers = reinterpret_cast<SharedMemoryRing::Header*>(region + 1);
+  new (&headers[0]) SharedMemoryRing::Header{};
+  new (&headers[1]) SharedMemoryRing::Header{};
+  return std::shared_ptr<SharedMemoryRegion>(
+      new SharedMemoryRegion(name, base, size));
+}
+
+absl::StatusOr<std::shared_ptr<SharedMemoryRegion>> SharedMemoryRegion::Open(
+    absl::string_view name) {
+  // Only ever open regions created by a chaotic_good client.
+  if (!absl::StartsWith(name, kNamePrefix) ||
+      name.find('/', 1) != absl::string_view::npos) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("Bad shared memory name: ", name));
+  }
+  const std::string name_str(name);
+  const int fd = shm_open(name_str.c_str(), O_RDWR, 0);
+  if (fd < 0) {
+    return absl::InternalError(
+        absl::StrCat("shm_open(", name, "): ", StrError(errno)));
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0 ||
+      static_cast<size_t>(st.st_size) < sizeof(RegionHeader)) {
+    close(fd);
+    return absl::InternalError("Shared memory region too small");
+  }
+  const size_t size = st.st_size;
+  void* base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  const int err = errno;
+  close(fd);
+  if (base == MAP_FAILED) {
+    return absl::InternalError(absl::StrCat("mmap: ", StrError(err)));
+  }
+  const auto* region = static_cast<const RegionHeader*>(base);
+  const uint64_t ring_size = region->ring_size;
+  if (region->magic != kRegionMagic || ring_size == 0 ||
+      (ring_size & (ring_size - 1)) != 0 || RegionSize(ring_size) != size) {
+    munmap(base, size);
+    return absl::InternalError("Malformed shared memory region");
+  }
+  return std::shared_ptr<SharedMemoryRegion>(
+      new SharedMemoryRegion(name_str, base, size));
+}
+
+SharedMemoryRegion::~SharedMemoryRegion() {
+  Unlink();
+  munmap(base_, size_);
+}
+
+void SharedMemoryRegion::Unlink() {
+  if (!std::exchange(linked_, false)) return;
+  shm_unlink(name_.c_str());
+}
+
+bool IsUnixSocketAddress(const EventEngine::ResolvedAddress& address) {
+  return address.size() >= sizeof(sa_family_t) &&
+         address.address()->sa_family == AF_UNIX;
+}
+
+#else  // GPR_LINUX
+
+absl::StatusOr<std::shared_ptr<SharedMemoryRegion>> SharedMemoryRegion::Create(
+    size_t) {
+  return absl::UnimplementedError("Shared memory needs Linux");
+}
+
+absl::StatusOr<std::shared_ptr<SharedMemoryRegion>> SharedMemoryRegion::Open(
+    absl::string_view) {
+  return absl::UnimplementedError("Shared memory needs Linux");
+}
+
+SharedMemoryRegion::~SharedMemoryRegion() {}
+
+void SharedMemoryRegion::Unlink() {}
+
+bool IsUnixSocketAddress(const EventEngine::ResolvedAddress&) { return false; }
+
+#endif  // GPR_LINUX
+
+SharedMemoryRing SharedMemoryRegion::client_to_server() {
+  return RingAt(base_, 0);
+}
+
+SharedMemoryRing SharedMemoryRegion::server_to_client() {
+  return RingAt(base_, 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// SharedMemoryEndpoint
+
+namespace {
+
+// Most bytes handed to one read callback.
+constexpr size_t kMaxReadBytes = 1024 * 1024;
+
+// EventEngine endpoint moving bytes through a pair of shared memory rings.
+// The wrapped endpoint (the unix socket the data connection was set up on)
+// only carries one byte wakeups, sent when the peer is waiting for data or
+// for space and we changed the ring; it is always being read, both for those
+// wakeups and to notice the peer going away.
+class SharedMemoryEndpoint final : public EventEngine::Endpoint {
+ public:
+  SharedMemoryEndpoint(std::shared_ptr<EventEngine::Endpoint> wakeups,
+                       std::shared_ptr<SharedMemoryRegion> region,
+                       bool is_client,
+                       std::shared_ptr<EventEngine> event_engine)
+      : state_(std::make_shared<State>(std::move(wakeups), std::move(region),
+                                       is_client, std::move(event_engine))) {
+    State::StartReadingWakeups(state_);
+  }
+
+  ~SharedMemoryEndpoint() override { state_->Shutdown(); }
+
+  bool Read(absl::AnyInvocable<void(absl::Status)> on_read,
+            grpc_event_engine::experimental::SliceBuffer* buffer,
+            const ReadArgs*) override {
+    return state_->Read(std::move(on_read), buffer);
+  }
+
+  bool Write(absl::AnyInvocable<void(absl::Status)> on_writable,
+             grpc_event_engine::experimental::SliceBuffer* data,
+             const WriteArgs*) override {
+    return state_->Write(std::move(on_writable), data);
+  }
+
+  const EventEngine::ResolvedAddress& GetPeerAddress() const override {
+    return state_->peer_address;
+  }
+  const EventEngine::ResolvedAddress& GetLocalAddress() const override {
+    return state_->local_address;
+  }
+
+ private:
+  // Outlives the endpoint until the wrapped endpoint's callbacks are done.
+  class State : public std::enable_shared_from_this<State> {
+   public:
+    State(std::shared_ptr<EventEngine::Endpoint> wakeups,
+          std::shared_ptr<SharedMemoryRegion> region, bool is_client,
+          std::shared_ptr<EventEngine> event_engine)
+        : peer_address(wakeups->GetPeerAddress()),
+          local_address(wakeups->GetLocalAddress()),
+          event_engine_(std::move(event_engine)),
+          region_(std::move(region)),
+          tx_(is_client ? region_->client_to_server()
+                        : region_->server_to_client()),
+          rx_(is_client ? region_->server_to_client()
+                        : region_->client_to_server()),
+          wakeups_(std::move(wakeups)) {}
+
+    bool Read(absl::AnyInvocable<void(absl::Status)> on_read,
+              grpc_event_engine::experimental::SliceBuffer* buffer) {
+      MutexLock lock(&mu_);
+      if (ReadLocked(*buffer)) return true;
+      if (!status_.ok()) {
+        FailAsync(std::move(on_read), status_);
+        return false;
+      }
+      rx_.SetConsumerWaiting();
+      // Data may have landed before the flag was visible to the peer.
+      if (ReadLocked(*buffer)) return true;
+      on_read_ = std::move(on_read);
+      read_buffer_ = buffer;
+      return false;
+    }
+
+    bool Write(absl::AnyInvocable<void(absl::Status)> on_writable,
+               grpc_event_engine::experimental::SliceBuffer* data) {
+      MutexLock lock(&mu_);
+      if (!status_.ok()) {
+        data->Clear();
+        FailAsync(std::move(on_writable), status_);
+        return false;
+      }
+      if (WriteLocked(*data)) return true;
+      write_buffer_.Swap(*data);
+      on_writable_ = std::move(on_writable);
+      return false;
+    }
+
+    static void StartReadingWakeups(std::shared_ptr<State> self) {
+      while (true) {
+        std::shared_ptr<EventEngine::Endpoint> endpoint;
+        {
+          MutexLock lock(&self->mu_);
+          endpoint = self->wakeups_;
+        }
+        if (endpoint == nullptr) return;
+        self->wakeup_read_buffer_.Clear();
+        EventEngine::Endpoint::ReadArgs args;
+        args.read_hint_bytes = 1;
+        if (!endpoint->Read(
+                [self](absl::Status status) mutable {
+                  if (self->OnWakeup(std::move(status))) {
+                    StartReadingWakeups(std::move(self));
+                  }
+                },
+                &self->wakeup_read_buffer_, &args)) {
+          return;
+        }
+        if (!self->OnWakeup(absl::OkStatus())) return;
+      }
+    }
+
+    // Destroying the wrapped endpoint fails the outstanding wakeup read,
+    // which fails any pending read or write and then drops the last
+    // reference to this state.
+    void Shutdown() {
+      std::shared_ptr<EventEngine::Endpoint> endpoint;
+      MutexLock lock(&mu_);
+      if (status_.ok()) status_ = absl::CancelledError("Endpoint shutdown");
+      endpoint = std::move(wakeups_);
+    }
+
+    const EventEngine::ResolvedAddress peer_address;
+    const EventEngine::ResolvedAddress local_address;
+
+   private:
+    // Returns false once the wrapped endpoint has failed.
+    bool OnWakeup(absl::Status wakeup_status) {
+      absl::AnyInvocable<void(absl::Status)> read_cb;
+      absl::AnyInvocable<void(absl::Status)> write_cb;
+      absl::Status read_status;
+      absl::Status write_status;
+      {
+        MutexLock lock(&mu_);
+        if (!wakeup_status.ok() && status_.ok()) status_ = wakeup_status;
+        // Bytes already in the ring are still delivered after a failure.
+        if (on_read_ != nullptr &&
+            (ReadLocked(*read_buffer_) || !status_.ok())) {
+          if (read_buffer_->Length() == 0) read_status = status_;
+          read_cb = std::move(on_read_);
+          on_read_ = nullptr;
+          read_buffer_ = nullptr;
+        }
+        if (on_writable_ != nullptr &&
+            (!status_.ok() || WriteLocked(write_buffer_))) {
+          write_status = status_;
+          write_buffer_.Clear();
+          write_cb = std::move(on_writable_);
+          on_writable_ = nullptr;
+        }
+      }
+      if (read_cb != nullptr) read_cb(std::move(read_status));
+      if (write_cb != nullptr) write_cb(std::move(write_status));
+      return wakeup_status.ok();
+    }
+
+    // Read whatever is in the ring; wakes the peer if it waits for space.
+    bool ReadLocked(grpc_event_engine::experimental::SliceBuffer& buffer)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+      if (rx_.Read(buffer, kMaxReadBytes) == 0) return false;
+      if (rx_.TakeProducerWaiting()) WakePeerLocked();
+      return true;
+    }
+
+    // Write as much as fits; wakes the peer if it waits for data. Returns
+    // true once all of `data` is in the ring.
+    bool WriteLocked(grpc_event_engine::experimental::SliceBuffer& data)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+      while (true) {
+        if (tx_.Write(data) != 0 && tx_.TakeConsumerWaiting()) {
+          WakePeerLocked();
+        }
+        if (data.Length() == 0) return true;
+        tx_.SetProducerWaiting();
+        // Space may have been freed before the flag was visible to the peer.
+        if (tx_.WritableBytes() == 0) return false;
+      }
+    }
+
+    // At most one wakeup write is in flight; wakeups asked for meanwhile
+    // are folded into one more write once it completes.
+    void WakePeerLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+      if (wakeups_ == nullptr) return;
+      if (wakeup_write_in_flight_) {
+        wakeup_write_wanted_ = true;
+        return;
+      }
+      wakeup_write_in_flight_ = true;
+      do {
+        wakeup_write_wanted_ = false;
+        wakeup_write_buffer_.Clear();
+        wakeup_write_buffer_.Append(
+            grpc_event_engine::experimental::Slice::FromCopiedString("w"));
+        EventEngine::Endpoint::WriteArgs args;
+        args.max_frame_size = 1;
+        if (!wakeups_->Write(
+                [self = shared_from_this(), keep_alive = wakeups_](
+                    absl::Status) {
+                  MutexLock lock(&self->mu_);
+                  self->wakeup_write_in_flight_ = false;
+                  if (self->wakeup_write_wanted_) self->WakePeerLocked();
+                },
+                &wakeup_write_buffer_, &args)) {
+          return;
+        }
+      } while (wakeup_write_wanted_);
+      wakeup_write_in_flight_ = false;
+    }
+
+    void FailAsync(absl::AnyInvocable<void(absl::Status)> cb,
+                   absl::Status status) {
+      event_engine_->Run([cb = std::move(cb), status]() mutable {
+        cb(std::move(status));
+      });
+    }
+
+    const std::shared_ptr<EventEngine> event_engine_;
+    const std::shared_ptr<SharedMemoryRegion> region_;
+    SharedMemoryRing tx_;
+    SharedMemoryRing rx_;
+    Mutex mu_;
+    std::shared_ptr<EventEngine::Endpoint> wakeups_ ABSL_GUARDED_BY(mu_);
+    absl::Status status_ ABSL_GUARDED_BY(mu_);
+    absl::AnyInvocable<void(absl::Status)> on_read_ ABSL_GUARDED_BY(mu_);
+    grpc_event_engine::experimental::SliceBuffer* read_buffer_
+        ABSL_GUARDED_BY(mu_) = nullptr;
+    absl::AnyInvocable<void(absl::Status)> on_writable_ ABSL_GUARDED_BY(mu_);
+    grpc_event_engine::experimental::SliceBuffer write_buffer_
+        ABSL_GUARDED_BY(mu_);
+    // Only touched by the wakeup read loop.
+    grpc_event_engine::experimental::SliceBuffer wakeup_read_buffer_;
+    grpc_event_engine::experimental::SliceBuffer wakeup_write_buffer_
+        ABSL_GUARDED_BY(mu_);
+    bool wakeup_write_in_flight_ ABSL_GUARDED_BY(mu_) = false;
+    bool wakeup_write_wanted_ ABSL_GUARDED_BY(mu_) = false;
+  };
+
+  const std::shared_ptr<State> state_;
+};
+
+}  // namespace
+
+PromiseEndpoint MakeSharedMemoryEndpoint(
+    PromiseEndpoint endpoint, std::shared_ptr<SharedMemoryRegion> region,
+    bool is_client, std::shared_ptr<EventEngine> event_engine) {
+  auto wakeups = endpoint.GetEventEngineEndpoint();
+  // Drop the promise endpoint's reference: from here on the shared memory
+  // endpoint owns the socket.
+  endpoint = PromiseEndpoint();
+  return PromiseEndpoint(
+      std::make_unique<SharedMemoryEndpoint>(std::move(wakeups),
+                                             std::move(region), is_client,
+                                             std::move(event_engine)),
+      SliceBuffer());
+}
+
+}  // namespace chaotic_good
+}  // namespace grpc_core
@@ -0,0 +1,135 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_SHARED_MEMORY_ENDPOINT_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_SHARED_MEMORY_ENDPOINT_H
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/event_engine/slice_buffer.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "src/core/lib/transport/promise_endpoint.h"
+
+// If true, a client whose data connections are on a unix socket asks the
+// server to move their payloads through shared memory instead, leaving the
+// socket to carry wakeups only. Defaults to false.
+#define GRPC_ARG_CHAOTIC_GOOD_SHARED_MEMORY_DATA_ENDPOINTS \
+  "grpc.chaotic_good.shared_memory_data_endpoints"
+
+namespace grpc_core {
+namespace chaotic_good {
+
+// Single producer, single consumer byte ring living in shared memory.
+// The producer and consumer may be in different processes.
+class SharedMemoryRing {
+ public:
+  struct alignas(64) Header {
+    // Total bytes ever consumed; written by the consumer.
+    std::atomic<uint64_t> head;
+    // Total bytes ever produced; written by the producer.
+    std::atomic<uint64_t> tail;
+    // Set by a side that found nothing to do and needs a wakeup from the
+    // other side before it will look at the ring again.
+    std::atomic<uint32_t> consumer_waiting;
+    std::atomic<uint32_t> producer_waiting;
+  };
+
+  // capacity must be a power of two.
+  SharedMemoryRing(Header* header, uint8_t* data, size_t capacity)
+      : header_(header), data_(data), capacity_(capacity) {}
+
+  // Producer: move as many bytes from the front of `data` into the ring as
+  // fit. Returns the number of bytes moved.
+  size_t Write(grpc_event_engine::experimental::SliceBuffer& data);
+  // Consumer: append up to `max_bytes` of the bytes in the ring to `out`.
+  // Returns the number of bytes read.
+  size_t Read(grpc_event_engine::experimental::SliceBuffer& out,
+              size_t max_bytes);
+
+  size_t ReadableBytes() const;
+  size_t WritableBytes() const;
+
+  // Waiting protocol: a side with nothing to do sets its waiting flag and
+  // then checks the ring once more before sleeping; the other side takes the
+  // flag after changing the ring, and if it was set wakes the sleeper.
+  void SetConsumerWaiting();
+  bool TakeConsumerWaiting();
+  void SetProducerWaiting();
+  bool TakeProducerWaiting();
+
+ private:
+  Header* const header_;
+  uint8_t* const data_;
+  const size_t capacity_;
+};
+
+// A shared memory region holding the two rings of one data connection.
+// Created by the client, which sends its name to the server during the data
+// connection handshake; the server then opens it by name.
+class SharedMemoryRegion {
+ public:
+  static constexpr size_t kDefaultRingSize = 4 * 1024 * 1024;
+
+  static absl::StatusOr<std::shared_ptr<SharedMemoryRegion>> Create(
+      size_t ring_size = kDefaultRingSize);
+  static absl::StatusOr<std::shared_ptr<SharedMemoryRegion>> Open(
+      absl::string_view name);
+
+  SharedMemoryRegion(const SharedMemoryRegion&) = delete;
+  SharedMemoryRegion& operator=(const SharedMemoryRegion&) = delete;
+  ~SharedMemoryRegion();
+
+  const std::string& name() const { return name_; }
+  // Remove the name; the mapping stays valid. Both sides call this as soon
+  // as the handshake is over, so nothing outlives the connection.
+  void Unlink();
+
+  SharedMemoryRing client_to_server();
+  SharedMemoryRing server_to_client();
+
+ private:
+  SharedMemoryRegion(std::string name, void* base, size_t size);
+
+  const std::string name_;
+  void* const base_;
+  const size_t size_;
+  bool linked_ = true;
+};
+
+// True if `address` is a unix domain socket address: only then can the peer
+// be expected to share memory with us.
+bool IsUnixSocketAddress(
+    const grpc_event_engine::experimental::EventEngine::ResolvedAddress&
+        address);
+
+// Wrap a data connection that finished its handshake so that payloads go
+// through the rings in `region`. The original endpoint only carries wakeups
+// from then on, and closing it closes the shared memory endpoint.
+PromiseEndpoint MakeSharedMemoryEndpoint(
+    PromiseEndpoint endpoint, std::shared_ptr<SharedMemoryRegion> region,
+    bool is_client,
+    std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+        event_engine);
+
+}  // namespace chaotic_good
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_SHARED_MEMORY_ENDPOINT_H
@@ -52,6 +52,7 @@
 #include "src/core/lib/channel/channel_args_preconditioning.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/event_engine/channel_args_endpoint_config.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/endpoint.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/iomgr/resolved_address.h"
@@ -141,6 +142,26 @@ void Chttp2Connector::OnHandshakeDone(absl::StatusOr<HandshakerArgs*> result) {
     }
     result_->Reset();
     NullThenSchedClosure(DEBUG_LOCATION, &notify_, result.status());
+  } else if ((*result)->endpoint != nullptr &&
+             IsChttp2OptimisticConnectEnabled()) {
+    // HTTP/2 lets the client send requests before it has seen the server's
+    // SETTINGS, so hand the transport over right away: the first RPC then
+    // goes out in the same flight as the connection preface. A server that
+    // turns out not to speak HTTP/2 fails the transport (and any RPC on it)
+    // rather than the connection attempt.
+    grpc_endpoint_delete_from_pollset_set((*result)->endpoint.get(),
+                                          args_.interested_parties);
+    result_->transport = grpc_create_chttp2_transport(
+        (*result)->args, std::move((*result)->endpoint), true);
+    ABSL_CHECK_NE(result_->transport, nullptr);
+    result_->socket_node =
+        grpc_chttp2_transport_get_socket_node(result_->transport);
+    result_->channel_args = std::move((*result)->args);
+    grpc_chttp2_transport_start_reading(
+        result_->transport, (*result)->read_buffer.c_slice_buffer(),
+        /*notify_on_receive_settings=*/nullptr,
+        /*interested_parties_until_recv_settings=*/nullptr, nullptr);
+    NullThenSchedClosure(DEBUG_LOCATION, &notify_, absl::OkStatus());
   } else if ((*result)->endpoint != nullptr) {
     result_->transport = grpc_create_chttp2_transport(
         (*result)->args, std::move((*result)->endpoint), true);
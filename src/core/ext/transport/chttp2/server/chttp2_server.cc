@@ -791,6 +791,12 @@ Chttp2ServerListener::Chttp2ServerListener(
     connection_quota_->SetMaxIncomingConnections(
         max_allowed_incoming_connections.value());
   }
+  auto max_incoming_connection_rate =
+      args.GetInt(GRPC_ARG_MAX_INCOMING_CONNECTION_RATE);
+  if (max_incoming_connection_rate.has_value()) {
+    connection_quota_->SetMaxIncomingConnectionRate(
+        max_incoming_connection_rate.value());
+  }
   GRPC_CLOSURE_INIT(&tcp_server_shutdown_complete_, TcpServerShutdownComplete,
                     this, grpc_schedule_on_exec_ctx);
 }
@@ -57,12 +57,15 @@ grpc_slice grpc_chttp2_base64_encode(const grpc_slice& input) {
   char* out = reinterpret_cast<char*> GRPC_SLICE_START_PTR(output);
   size_t i;
 
-  // encode full triplets
+  // encode full triplets: gather each into one 24-bit word and split that into
+  // four 6-bit symbols
   for (i = 0; i < input_triplets; i++) {
-    out[0] = alphabet[in[0] >> 2];
-    out[1] = alphabet[((in[0] & 0x3) << 4) | (in[1] >> 4)];
-    out[2] = alphabet[((in[1] & 0xf) << 2) | (in[2] >> 6)];
-    out[3] = alphabet[in[2] & 0x3f];
+    const uint32_t bits = (static_cast<uint32_t>(in[0]) << 16) |
+                          (static_cast<uint32_t>(in[1]) << 8) | in[2];
+    out[0] = alphabet[bits >> 18];
+    out[1] = alphabet[(bits >> 12) & 0x3f];
+    out[2] = alphabet[(bits >> 6) & 0x3f];
+    out[3] = alphabet[bits & 0x3f];
     out += 4;
     in += 3;
   }
@@ -114,12 +117,24 @@ grpc_slice grpc_chttp2_huffman_compress(const grpc_slice& input) {
     temp |= grpc_chttp2_huffsyms[sym].bits;
     temp_length += grpc_chttp2_huffsyms[sym].length;
 
-    while (temp_length > 8) {
-      temp_length -= 8;
-      *out++ = static_cast<uint8_t>(temp >> temp_length);
+    // Codes are at most 30 bits, so with fewer than 32 bits pending the
+    // accumulator can always take another symbol: flush four bytes at a time.
+    if (temp_length >= 32) {
+      temp_length -= 32;
+      const uint32_t word = static_cast<uint32_t>(temp >> temp_length);
+      out[0] = static_cast<uint8_t>(word >> 24);
+      out[1] = static_cast<uint8_t>(word >> 16);
+      out[2] = static_cast<uint8_t>(word >> 8);
+      out[3] = static_cast<uint8_t>(word);
+      out += 4;
     }
   }
 
+  while (temp_length >= 8) {
+    temp_length -= 8;
+    *out++ = static_cast<uint8_t>(temp >> temp_length);
+  }
+
   if (temp_length) {
     // NB: the following integer arithmetic operation needs to be in its
     // expanded form due to the "integral promotion" performed (see section
@@ -136,23 +151,42 @@ grpc_slice grpc_chttp2_huffman_compress(const grpc_slice& input) {
 }
 
 struct huff_out {
-  uint32_t temp;
+  uint64_t temp;
   uint32_t temp_length;
   uint8_t* out;
 };
 static void enc_flush_some(huff_out* out) {
-  while (out->temp_length > 8) {
+  while (out->temp_length >= 8) {
     out->temp_length -= 8;
     *out->out++ = static_cast<uint8_t>(out->temp >> out->temp_length);
   }
 }
 
+// Encode one full base64 triplet: four symbols of at most 11 bits each, which
+// always fit in the accumulator alongside the (< 8) bits left by the last
+// flush.
+static void enc_add4(huff_out* out, uint8_t a, uint8_t b, uint8_t c, uint8_t d,
+                     uint32_t* wire_size) {
+  *wire_size += 4;
+  b64_huff_sym sa = huff_alphabet[a];
+  b64_huff_sym sb = huff_alphabet[b];
+  b64_huff_sym sc = huff_alphabet[c];
+  b64_huff_sym sd = huff_alphabet[d];
+  out->temp = (out->temp << sa.length) | sa.bits;
+  out->temp = (out->temp << sb.length) | sb.bits;
+  out->temp = (out->temp << sc.length) | sc.bits;
+  out->temp = (out->temp << sd.length) | sd.bits;
+  out->temp_length += static_cast<uint32_t>(sa.length) + sb.length +
+                      sc.length + sd.length;
+  enc_flush_some(out);
+}
+
 static void enc_add2(huff_out* out, uint8_t a, uint8_t b, uint32_t* wire_size) {
   *wire_size += 2;
   b64_huff_sym sa = huff_alphabet[a];
   b64_huff_sym sb = huff_alphabet[b];
   out->temp = (out->temp << (sa.length + sb.length)) |
-              (static_cast<uint32_t>(sa.bits) << sb.length) | sb.bits;
+              (static_cast<uint64_t>(sa.bits) << sb.length) | sb.bits;
   out->temp_length +=
       static_cast<uint32_t>(sa.length) + static_cast<uint32_t>(sb.length);
   enc_flush_some(out);
@@ -189,11 +223,10 @@ grpc_slice grpc_chttp2_base64_encode_and_huffman_compress(
   for (i = 0; i < input_triplets; i++) {
     const uint8_t low_to_high = static_cast<uint8_t>((in[0] & 0x3) << 4);
     const uint8_t high_to_low = in[1] >> 4;
-    enc_add2(&out, in[0] >> 2, low_to_high | high_to_low, wire_size);
-
     const uint8_t a = static_cast<uint8_t>((in[1] & 0xf) << 2);
     const uint8_t b = (in[2] >> 6);
-    enc_add2(&out, a | b, in[2] & 0x3f, wire_size);
+    enc_add4(&out, in[0] >> 2, low_to_high | high_to_low, a | b, in[2] & 0x3f,
+             wire_size);
     in += 3;
   }
 
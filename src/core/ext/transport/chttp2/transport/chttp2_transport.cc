@@ -56,6 +56,7 @@
 #include "absl/strings/str_format.h"
 #include "absl/strings/string_view.h"
 #include "src/core/config/config_vars.h"
+#include "src/core/ext/filters/message_size/message_size_filter.h"
 #include "src/core/ext/transport/chttp2/transport/call_tracer_wrapper.h"
 #include "src/core/ext/transport/chttp2/transport/context_list_entry.h"
 #include "src/core/ext/transport/chttp2/transport/flow_control.h"
@@ -89,6 +90,7 @@
 #include "src/core/lib/resource_quota/arena.h"
 #include "src/core/lib/resource_quota/memory_quota.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/slice/arena_slice.h"
 #include "src/core/lib/slice/slice.h"
 #include "src/core/lib/slice/slice_buffer.h"
 #include "src/core/lib/slice/slice_internal.h"
@@ -113,6 +115,7 @@
 #include "src/core/util/status_helper.h"
 #include "src/core/util/string.h"
 #include "src/core/util/time.h"
+#include "src/core/util/time_precise.h"
 #include "src/core/util/useful.h"
 
 #define DEFAULT_CONNECTION_WINDOW_TARGET (1024 * 1024)
@@ -137,6 +140,23 @@ static grpc_core::Duration g_default_server_keepalive_timeout =
 static bool g_default_client_keepalive_permit_without_calls = false;
 static bool g_default_server_keepalive_permit_without_calls = false;
 
+// How long a write of only control frames may wait for other data under
+// chttp2_coalesce_control_frames.
+constexpr grpc_core::Duration kControlFrameCoalesceDelay =
+    grpc_core::Duration::Milliseconds(1);
+
+// The largest GrpcWriteWeight honored, so that one call cannot take every
+// write.
+constexpr uint32_t kMaxWriteWeight = 64;
+
+// The least time between two TCP_INFO samples of one transport.
+constexpr grpc_core::Duration kTcpInfoSamplePeriod =
+    grpc_core::Duration::Seconds(1);
+// The least time between two samples for the flow control path model, which
+// otherwise samples once per min RTT.
+constexpr grpc_core::Duration kMinFlowControlSamplePeriod =
+    grpc_core::Duration::Milliseconds(5);
+
 // EXPERIMENTAL: control tarpitting in chttp2
 #define GRPC_ARG_HTTP_ALLOW_TARPIT "grpc.http.tarpit"
 #define GRPC_ARG_HTTP_TARPIT_MIN_DURATION_MS "grpc.http.tarpit_min_duration_ms"
@@ -147,6 +167,8 @@ static bool g_default_server_keepalive_permit_without_calls = false;
 // forward declarations of various callbacks that we'll build closures around
 static void write_action_begin_locked(
     grpc_core::RefCountedPtr<grpc_chttp2_transport>, grpc_error_handle error);
+static void coalesced_write_locked(
+    grpc_core::RefCountedPtr<grpc_chttp2_transport>, grpc_error_handle error);
 static void write_action(grpc_chttp2_transport* t);
 static void write_action_end(grpc_core::RefCountedPtr<grpc_chttp2_transport>,
                              grpc_error_handle error);
@@ -215,6 +237,10 @@ static void finish_keepalive_ping(
 static void finish_keepalive_ping_locked(
     grpc_core::RefCountedPtr<grpc_chttp2_transport> t, grpc_error_handle error);
 static void maybe_reset_keepalive_ping_timer_locked(grpc_chttp2_transport* t);
+static void schedule_keepalive_ping_timer_locked(grpc_chttp2_transport* t,
+                                                 grpc_core::Duration delay);
+static void cancel_keepalive_ping_timer_locked(grpc_chttp2_transport* t);
+static void maybe_compact_idle_transport_locked(grpc_chttp2_transport* t);
 
 static void send_goaway(grpc_chttp2_transport* t, grpc_error_handle error,
                         bool immediate_disconnect_hint);
@@ -434,6 +460,18 @@ static void read_channel_args(grpc_chttp2_transport* t,
   if (max_hpack_table_size >= 0) {
     t->hpack_compressor.SetMaxUsableSize(max_hpack_table_size);
   }
+  t->hpack_compressor.SetAdaptiveIndexing(
+      channel_args.GetBool(GRPC_ARG_HTTP2_HPACK_ADAPTIVE_INDEXING)
+          .value_or(false));
+  t->hpack_parser.SetZeroCopyMetadata(
+      channel_args.GetBool(GRPC_ARG_HTTP2_ZERO_COPY_METADATA).value_or(false));
+  t->arena_payload_max_bytes = static_cast<uint32_t>(std::max(
+      0,
+      channel_args.GetInt(GRPC_ARG_HTTP2_ARENA_PAYLOAD_MAX_BYTES).value_or(0)));
+  if (grpc_core::IsTransportMessageSizeCheckEnabled()) {
+    t->max_recv_message_length =
+        grpc_core::GetMaxRecvSizeFromChannelArgs(channel_args);
+  }
 
   t->write_buffer_size =
       std::max(0, channel_args.GetInt(GRPC_ARG_HTTP2_WRITE_BUFFER_SIZE)
@@ -575,12 +613,11 @@ static void init_keepalive_pings_if_enabled_locked(
   ABSL_DCHECK(error.ok());
   if (t->keepalive_time != grpc_core::Duration::Infinity()) {
     t->keepalive_state = GRPC_CHTTP2_KEEPALIVE_STATE_WAITING;
-    t->keepalive_ping_timer_handle =
-        t->event_engine->RunAfter(t->keepalive_time, [t = t->Ref()]() mutable {
-          grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
-          grpc_core::ExecCtx exec_ctx;
-          init_keepalive_ping(std::move(t));
-        });
+    if (grpc_core::IsChttp2KeepaliveTickerEnabled() &&
+        t->keepalive_time >= grpc_core::KeepaliveTicker::kMinDelay) {
+      t->keepalive_ticker = grpc_core::KeepaliveTicker::Get(t->event_engine);
+    }
+    schedule_keepalive_ping_timer_locked(t.get(), t->keepalive_time);
   } else {
     // Use GRPC_CHTTP2_KEEPALIVE_STATE_DISABLED to indicate there are no
     // inflight keepalive timers
@@ -619,6 +656,7 @@ void grpc_chttp2_transport::WriteSecurityFrameLocked(
 }
 
 using grpc_event_engine::experimental::QueryExtension;
+using grpc_event_engine::experimental::TcpInfoExtension;
 using grpc_event_engine::experimental::TcpTraceExtension;
 
 grpc_chttp2_transport::grpc_chttp2_transport(
@@ -660,6 +698,13 @@ grpc_chttp2_transport::grpc_chttp2_transport(
     }
   }
 
+  if (grpc_event_engine::experimental::grpc_is_event_engine_endpoint(
+          ep.get())) {
+    tcp_info_extension = QueryExtension<TcpInfoExtension>(
+        grpc_event_engine::experimental::grpc_get_wrapped_event_engine_endpoint(
+            ep.get()));
+  }
+
   if (channel_args.GetBool(GRPC_ARG_SECURITY_FRAME_ALLOWED).value_or(false)) {
     transport_framing_endpoint_extension = QueryExtension<
         grpc_core::TransportFramingEndpointExtension>(
@@ -779,22 +824,18 @@ static void close_transport_locked(grpc_chttp2_transport* t,
         t->event_engine->Cancel(t->delayed_ping_timer_handle)) {
       t->delayed_ping_timer_handle = TaskHandle::kInvalid;
     }
+    if (t->coalesced_write_timer_handle != TaskHandle::kInvalid &&
+        t->event_engine->Cancel(t->coalesced_write_timer_handle)) {
+      t->coalesced_write_timer_handle = TaskHandle::kInvalid;
+    }
     if (t->next_bdp_ping_timer_handle != TaskHandle::kInvalid &&
         t->event_engine->Cancel(t->next_bdp_ping_timer_handle)) {
       t->next_bdp_ping_timer_handle = TaskHandle::kInvalid;
     }
     switch (t->keepalive_state) {
       case GRPC_CHTTP2_KEEPALIVE_STATE_WAITING:
-        if (t->keepalive_ping_timer_handle != TaskHandle::kInvalid &&
-            t->event_engine->Cancel(t->keepalive_ping_timer_handle)) {
-          t->keepalive_ping_timer_handle = TaskHandle::kInvalid;
-        }
-        break;
       case GRPC_CHTTP2_KEEPALIVE_STATE_PINGING:
-        if (t->keepalive_ping_timer_handle != TaskHandle::kInvalid &&
-            t->event_engine->Cancel(t->keepalive_ping_timer_handle)) {
-          t->keepalive_ping_timer_handle = TaskHandle::kInvalid;
-        }
+        cancel_keepalive_ping_timer_locked(t);
         break;
       case GRPC_CHTTP2_KEEPALIVE_STATE_DYING:
       case GRPC_CHTTP2_KEEPALIVE_STATE_DISABLED:
@@ -876,11 +917,15 @@ grpc_chttp2_stream::grpc_chttp2_stream(grpc_chttp2_transport* t,
         << " [from " << server_data << "]";
     *t->accepting_stream = this;
     t->stream_map.emplace(id, this);
+    t->streams_started_since_idle_check = true;
     post_destructive_reclaimer(t);
   }
 
   grpc_slice_buffer_init(&frame_storage);
   grpc_slice_buffer_init(&flow_controlled_buffer);
+  if (grpc_core::IsChttp2OffloadStreamCallbacksEnabled()) {
+    recv_callback_serializer.emplace(t->event_engine);
+  }
 }
 
 grpc_chttp2_stream::~grpc_chttp2_stream() {
@@ -996,10 +1041,67 @@ static void set_write_state(grpc_chttp2_transport* t,
   }
 }
 
+// Whether a write for reason would carry only control frames, which are small
+// and can wait a moment for data to go with them.
+static bool is_control_frame_write(grpc_chttp2_initiate_write_reason reason) {
+  switch (reason) {
+    case GRPC_CHTTP2_INITIATE_WRITE_STREAM_FLOW_CONTROL:
+    case GRPC_CHTTP2_INITIATE_WRITE_TRANSPORT_FLOW_CONTROL:
+    case GRPC_CHTTP2_INITIATE_WRITE_SETTINGS_ACK:
+    case GRPC_CHTTP2_INITIATE_WRITE_PING_RESPONSE:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// With chttp2_coalesce_control_frames, holds back an idle transport's write of
+// control frames for up to kControlFrameCoalesceDelay, so that the control
+// frames produced by a run of small reads go out together, and with any data
+// written meanwhile. Returns true if the write was held back.
+static bool maybe_coalesce_write(grpc_chttp2_transport* t,
+                                 grpc_chttp2_initiate_write_reason reason) {
+  if (!grpc_core::IsChttp2CoalesceControlFramesEnabled()) return false;
+  if (!is_control_frame_write(reason) ||
+      t->num_pending_induced_frames >= DEFAULT_MAX_PENDING_INDUCED_FRAMES) {
+    // Anything else goes out now, and takes the held back frames with it.
+    if (t->coalesced_write_timer_handle != TaskHandle::kInvalid &&
+        t->event_engine->Cancel(t->coalesced_write_timer_handle)) {
+      t->coalesced_write_timer_handle = TaskHandle::kInvalid;
+    }
+    return false;
+  }
+  if (t->coalesced_write_timer_handle == TaskHandle::kInvalid) {
+    t->coalesced_write_timer_handle = t->event_engine->RunAfter(
+        kControlFrameCoalesceDelay, [t = t->Ref()]() mutable {
+          grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
+          grpc_core::ExecCtx exec_ctx;
+          auto* tp = t.get();
+          tp->combiner->Run(
+              grpc_core::InitTransportClosure<coalesced_write_locked>(
+                  std::move(t), &tp->coalesced_write_locked),
+              absl::OkStatus());
+        });
+  }
+  return true;
+}
+
+static void coalesced_write_locked(
+    grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
+    GRPC_UNUSED grpc_error_handle error) {
+  // The handle is cleared if another write went out before the timer ran.
+  if (t->coalesced_write_timer_handle == TaskHandle::kInvalid) return;
+  t->coalesced_write_timer_handle = TaskHandle::kInvalid;
+  if (!t->closed_with_error.ok()) return;
+  grpc_chttp2_initiate_write(
+      t.get(), GRPC_CHTTP2_INITIATE_WRITE_COALESCED_CONTROL_FRAMES);
+}
+
 void grpc_chttp2_initiate_write(grpc_chttp2_transport* t,
                                 grpc_chttp2_initiate_write_reason reason) {
   switch (t->write_state) {
     case GRPC_CHTTP2_WRITE_STATE_IDLE:
+      if (maybe_coalesce_write(t, reason)) break;
       set_write_state(t, GRPC_CHTTP2_WRITE_STATE_WRITING,
                       grpc_chttp2_initiate_write_reason_string(reason));
       // Note that the 'write_action_begin_locked' closure is being scheduled
@@ -1108,6 +1210,7 @@ static void write_action(grpc_chttp2_transport* t) {
       << (t->is_client ? "CLIENT" : "SERVER") << "[" << t << "]: Write "
       << t->outbuf.Length() << " bytes";
   t->write_size_policy.BeginWrite(t->outbuf.Length());
+  t->write_start_cycles = gpr_get_cycle_counter();
   grpc_endpoint_write(t->ep.get(), t->outbuf.c_slice_buffer(),
                       grpc_core::InitTransportClosure<write_action_end>(
                           t->Ref(), &t->write_action_end_locked),
@@ -1124,12 +1227,68 @@ static void write_action_end(grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
                     error);
 }
 
+// Feeds the flow control path model with the min RTT from TCP_INFO, and
+// schedules the next sample one min RTT later.
+static void sample_flow_control_path(
+    grpc_chttp2_transport* t, grpc_core::Timestamp now,
+    const grpc_core::TcpTracerInterface::ConnectionMetrics& metrics) {
+  std::optional<grpc_core::Duration> min_rtt;
+  if (metrics.min_rtt.has_value()) {
+    min_rtt = grpc_core::Duration::MicrosecondsRoundUp(*metrics.min_rtt);
+  } else if (metrics.srtt.has_value()) {
+    min_rtt = grpc_core::Duration::MicrosecondsRoundUp(*metrics.srtt);
+  }
+  grpc_chttp2_act_on_flowctl_action(
+      t->flow_control.AddPathSample(now, min_rtt), t, nullptr);
+  t->next_flow_control_sample =
+      now + std::clamp(min_rtt.value_or(kTcpInfoSamplePeriod),
+                       kMinFlowControlSamplePeriod, kTcpInfoSamplePeriod);
+}
+
+// Samples TCP_INFO from the endpoint, if it supports that and the last sample
+// is more than kTcpInfoSamplePeriod old, for channelz and global stats.
+static void maybe_sample_tcp_info(grpc_chttp2_transport* t) {
+  if (t->tcp_info_extension == nullptr) return;
+  const grpc_core::Timestamp now = grpc_core::Timestamp::Now();
+  const bool sample_flow_control =
+      t->flow_control.bdp_probe() &&
+      grpc_core::IsChttp2ModelBasedFlowControlEnabled() &&
+      now >= t->next_flow_control_sample;
+  if (now < t->next_tcp_info_sample && !sample_flow_control) return;
+  auto metrics = t->tcp_info_extension->GetTcpInfo();
+  if (!metrics.has_value()) return;
+  if (sample_flow_control) sample_flow_control_path(t, now, *metrics);
+  if (now < t->next_tcp_info_sample) return;
+  t->next_tcp_info_sample = now + kTcpInfoSamplePeriod;
+  if (metrics->srtt.has_value()) {
+    grpc_core::global_stats().IncrementTcpInfoSrttUs(*metrics->srtt);
+  }
+  if (metrics->congestion_window.has_value()) {
+    grpc_core::global_stats().IncrementTcpInfoCongestionWindow(
+        *metrics->congestion_window);
+  }
+  if (metrics->delivery_rate.has_value()) {
+    grpc_core::global_stats().IncrementTcpInfoDeliveryRateKbps(
+        static_cast<int>(std::min<uint64_t>(*metrics->delivery_rate / 1024,
+                                            std::numeric_limits<int>::max())));
+  }
+  if (t->channelz_socket != nullptr) {
+    t->channelz_socket->RecordTcpInfo(*std::move(metrics));
+  }
+}
+
 // Callback from the grpc_endpoint after bytes have been written by calling
 // sendmsg
 static void write_action_end_locked(
     grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
     grpc_error_handle error) {
   t->write_size_policy.EndWrite(error.ok());
+  if (error.ok()) {
+    grpc_core::global_stats().IncrementHttp2WriteLatencyUs(
+        gpr_cycle_counter_sub_micros(gpr_get_cycle_counter(),
+                                     t->write_start_cycles));
+    maybe_sample_tcp_info(t.get());
+  }
 
   bool closed = false;
   if (!error.ok()) {
@@ -1286,6 +1445,7 @@ static void maybe_start_some_streams(grpc_chttp2_transport* t) {
     }
 
     t->stream_map.emplace(s->id, s);
+    t->streams_started_since_idle_check = true;
     post_destructive_reclaimer(t);
     grpc_chttp2_mark_stream_writable(t, s);
     grpc_chttp2_initiate_write(t, GRPC_CHTTP2_INITIATE_WRITE_START_NEW_STREAM);
@@ -1323,6 +1483,24 @@ static void null_then_sched_closure(grpc_closure** closure) {
   grpc_core::ExecCtx::Run(DEBUG_LOCATION, c, absl::OkStatus());
 }
 
+// Schedules one of s's recv closures. With chttp2_offload_stream_callbacks
+// these go to the stream's serializer, so that the filters processing what
+// the stream received run on the EventEngine pool, in parallel with other
+// streams, while the combiner only parses frames.
+static void null_then_sched_recv_closure(grpc_chttp2_stream* s,
+                                         grpc_closure** closure) {
+  if (!s->recv_callback_serializer.has_value()) {
+    null_then_sched_closure(closure);
+    return;
+  }
+  grpc_closure* c = std::exchange(*closure, nullptr);
+  s->recv_callback_serializer->Run([c]() {
+    grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
+    grpc_core::ExecCtx exec_ctx;
+    grpc_core::Closure::Run(DEBUG_LOCATION, c, absl::OkStatus());
+  });
+}
+
 void grpc_chttp2_complete_closure_step(grpc_chttp2_transport* t,
                                        grpc_closure** pclosure,
                                        grpc_error_handle error,
@@ -1422,6 +1600,9 @@ static void send_initial_metadata_locked(
   s->send_initial_metadata_finished = add_closure_barrier(on_complete);
   s->send_initial_metadata =
       op_payload->send_initial_metadata.send_initial_metadata;
+  s->write_weight = std::clamp<uint32_t>(
+      s->send_initial_metadata->get(grpc_core::GrpcWriteWeight()).value_or(1),
+      1, kMaxWriteWeight);
   if (t->is_client) {
     s->deadline =
         std::min(s->deadline,
@@ -2139,7 +2320,7 @@ void grpc_chttp2_maybe_complete_recv_initial_metadata(grpc_chttp2_transport* t,
       t->registered_method_matcher_cb(t->accept_stream_cb_user_data,
                                       s->recv_initial_metadata);
     }
-    null_then_sched_closure(&s->recv_initial_metadata_ready);
+    null_then_sched_recv_closure(s, &s->recv_initial_metadata_ready);
   }
 }
 
@@ -2191,6 +2372,10 @@ void grpc_chttp2_maybe_complete_recv_message(grpc_chttp2_transport* t,
               if (t->channelz_socket != nullptr) {
                 t->channelz_socket->RecordMessageReceived();
               }
+              if (t->arena_payload_max_bytes != 0) {
+                grpc_core::MoveIntoArenaSlice(**s->recv_message, s->arena,
+                                              t->arena_payload_max_bytes);
+              }
               break;
             }
           }
@@ -2205,18 +2390,20 @@ void grpc_chttp2_maybe_complete_recv_message(grpc_chttp2_transport* t,
     // save the length of the buffer before handing control back to application
     // threads. Needed to support correct flow control bookkeeping
     if (error.ok() && s->recv_message->has_value()) {
-      null_then_sched_closure(&s->recv_message_ready);
+      null_then_sched_recv_closure(s, &s->recv_message_ready);
     } else if (s->published_metadata[1] != GRPC_METADATA_NOT_PUBLISHED) {
       if (s->call_failed_before_recv_message != nullptr) {
         *s->call_failed_before_recv_message =
             (s->published_metadata[1] != GRPC_METADATA_PUBLISHED_AT_CLOSE);
       }
-      null_then_sched_closure(&s->recv_message_ready);
+      null_then_sched_recv_closure(s, &s->recv_message_ready);
     }
   }();
 
   upd.SetPendingSize(s->frame_storage.length);
   grpc_chttp2_act_on_flowctl_action(upd.MakeAction(), t, s);
+  // The rest of the stream can't be deframed either, so don't wait for it.
+  if (!error.ok()) grpc_chttp2_cancel_stream(t, s, error, /*tarpit=*/false);
 }
 
 void grpc_chttp2_maybe_complete_recv_trailing_metadata(grpc_chttp2_transport* t,
@@ -2238,7 +2425,7 @@ void grpc_chttp2_maybe_complete_recv_trailing_metadata(grpc_chttp2_transport* t,
       grpc_transport_move_stats(&s->stats, s->collecting_stats);
       s->collecting_stats = nullptr;
       *s->recv_trailing_metadata = std::move(s->trailing_metadata_buffer);
-      null_then_sched_closure(&s->recv_trailing_metadata_finished);
+      null_then_sched_recv_closure(s, &s->recv_trailing_metadata_finished);
     }
   }
 }
@@ -2674,11 +2861,24 @@ static void end_all_the_calls(grpc_chttp2_transport* t,
   }
   cancel_unstarted_streams(t, error, false);
   std::vector<grpc_chttp2_stream*> to_cancel;
+  to_cancel.reserve(t->stream_map.size());
   for (auto id_stream : t->stream_map) {
     to_cancel.push_back(id_stream.second);
   }
   for (auto s : to_cancel) {
-    grpc_chttp2_cancel_stream(t, s, error, false);
+    // Servers still owe these their trailing metadata.
+    if (!t->is_client && !s->sent_trailing_metadata &&
+        grpc_error_has_clear_grpc_status(error) &&
+        !(s->read_closed && s->write_closed)) {
+      grpc_chttp2_cancel_stream(t, s, error, false);
+      continue;
+    }
+    // Closing the connection resets every stream on it, so unlike
+    // grpc_chttp2_cancel_stream don't queue (and compute the error code
+    // for) an RST_STREAM per stream: with thousands of streams that is
+    // most of the cost of dropping the connection.
+    if (!error.ok()) s->seen_error = true;
+    grpc_chttp2_mark_stream_closed(t, s, 1, 1, error);
   }
 }
 
@@ -3044,16 +3244,23 @@ static void init_keepalive_ping_locked(
     GRPC_UNUSED grpc_error_handle error) {
   ABSL_DCHECK(error.ok());
   ABSL_CHECK(t->keepalive_state == GRPC_CHTTP2_KEEPALIVE_STATE_WAITING);
-  ABSL_CHECK(t->keepalive_ping_timer_handle != TaskHandle::kInvalid);
-  t->keepalive_ping_timer_handle = TaskHandle::kInvalid;
+  if (t->keepalive_ticker != nullptr) {
+    ABSL_CHECK(t->keepalive_ticker_pending);
+    t->keepalive_ticker_pending = false;
+  } else {
+    ABSL_CHECK(t->keepalive_ping_timer_handle != TaskHandle::kInvalid);
+    t->keepalive_ping_timer_handle = TaskHandle::kInvalid;
+  }
   grpc_core::Timestamp now = grpc_core::Timestamp::Now();
   grpc_core::Timestamp adjusted_keepalive_timestamp = std::exchange(
       t->next_adjusted_keepalive_timestamp, grpc_core::Timestamp::InfPast());
-  bool delay_callback = grpc_core::IsKeepAlivePingTimerBatchEnabled() &&
+  bool delay_callback = (grpc_core::IsKeepAlivePingTimerBatchEnabled() ||
+                         t->keepalive_ticker != nullptr) &&
                         adjusted_keepalive_timestamp > now;
   if (t->destroying || !t->closed_with_error.ok()) {
     t->keepalive_state = GRPC_CHTTP2_KEEPALIVE_STATE_DYING;
   } else {
+    maybe_compact_idle_transport_locked(t.get());
     if (!delay_callback &&
         (t->keepalive_permit_without_calls || !t->stream_map.empty())) {
       t->keepalive_state = GRPC_CHTTP2_KEEPALIVE_STATE_PINGING;
@@ -3065,16 +3272,83 @@ static void init_keepalive_ping_locked(
       if (delay_callback) {
         extend = adjusted_keepalive_timestamp - now;
       }
-      t->keepalive_ping_timer_handle =
-          t->event_engine->RunAfter(t->keepalive_time + extend, [t] {
-            grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
-            grpc_core::ExecCtx exec_ctx;
-            init_keepalive_ping(t);
-          });
+      schedule_keepalive_ping_timer_locked(t.get(), t->keepalive_time + extend);
     }
   }
 }
 
+static void schedule_keepalive_ping_timer_locked(grpc_chttp2_transport* t,
+                                                 grpc_core::Duration delay) {
+  if (t->keepalive_ticker == nullptr) {
+    t->keepalive_ping_timer_handle =
+        t->event_engine->RunAfter(delay, [t = t->Ref()]() mutable {
+          grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
+          grpc_core::ExecCtx exec_ctx;
+          init_keepalive_ping(std::move(t));
+        });
+    return;
+  }
+  ABSL_CHECK(!t->keepalive_ticker_pending);
+  t->keepalive_ticker_pending = true;
+  // The ticker entry owns this ref until it fires or is cancelled.
+  t->keepalive_ticker->Schedule(
+      &t->keepalive_ticker_entry, delay,
+      [](void* arg) {
+        grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
+        grpc_core::ExecCtx exec_ctx;
+        init_keepalive_ping(grpc_core::RefCountedPtr<grpc_chttp2_transport>(
+            static_cast<grpc_chttp2_transport*>(arg)));
+      },
+      t->Ref().release());
+}
+
+static void cancel_keepalive_ping_timer_locked(grpc_chttp2_transport* t) {
+  if (t->keepalive_ticker == nullptr) {
+    if (t->keepalive_ping_timer_handle != TaskHandle::kInvalid &&
+        t->event_engine->Cancel(t->keepalive_ping_timer_handle)) {
+      t->keepalive_ping_timer_handle = TaskHandle::kInvalid;
+    }
+    return;
+  }
+  if (t->keepalive_ticker_pending &&
+      t->keepalive_ticker->Cancel(&t->keepalive_ticker_entry)) {
+    t->keepalive_ticker_pending = false;
+    // Adopt and drop the ref the entry owned.
+    grpc_core::RefCountedPtr<grpc_chttp2_transport> entry_ref(t);
+  }
+}
+
+static void maybe_compact_idle_transport_locked(grpc_chttp2_transport* t) {
+  if (!grpc_core::IsChttp2IdleCompactionEnabled()) return;
+  // Only compact connections that have not started a stream for a whole
+  // keepalive interval; busy connections would just have to rebuild state.
+  if (std::exchange(t->streams_started_since_idle_check, false) ||
+      !t->stream_map.empty()) {
+    return;
+  }
+  GRPC_TRACE_LOG(http, INFO)
+      << t->peer_string.as_string_view() << ": compacting idle transport";
+  // Drop slice arrays that grew to hold earlier bursts of frames.
+  if (t->qbuf.count == 0 && t->qbuf.base_slices != t->qbuf.inlined) {
+    grpc_slice_buffer_destroy(&t->qbuf);
+    grpc_slice_buffer_init(&t->qbuf);
+  }
+  if (t->write_state == GRPC_CHTTP2_WRITE_STATE_IDLE &&
+      t->outbuf.Length() == 0) {
+    t->outbuf = grpc_core::SliceBuffer();
+  }
+  // Advertise an empty HPACK table so that the decoder table can be freed
+  // once the peer acks it. The previous size is advertised again right after,
+  // so the peer can rebuild the table when the connection is used again.
+  const uint32_t header_table_size = t->settings.local().header_table_size();
+  if (!t->idle_compaction_header_table_size.has_value() &&
+      header_table_size != 0) {
+    t->idle_compaction_header_table_size = header_table_size;
+    t->settings.mutable_local().SetHeaderTableSize(0);
+    grpc_chttp2_initiate_write(t, GRPC_CHTTP2_INITIATE_WRITE_SEND_SETTINGS);
+  }
+}
+
 static void finish_keepalive_ping(
     grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
     grpc_error_handle error) {
@@ -3097,12 +3371,8 @@ static void finish_keepalive_ping_locked(
       }
       t->keepalive_state = GRPC_CHTTP2_KEEPALIVE_STATE_WAITING;
       ABSL_CHECK(t->keepalive_ping_timer_handle == TaskHandle::kInvalid);
-      t->keepalive_ping_timer_handle =
-          t->event_engine->RunAfter(t->keepalive_time, [t] {
-            grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
-            grpc_core::ExecCtx exec_ctx;
-            init_keepalive_ping(t);
-          });
+      ABSL_CHECK(!t->keepalive_ticker_pending);
+      schedule_keepalive_ping_timer_locked(t.get(), t->keepalive_time);
     }
   }
 }
@@ -3117,7 +3387,7 @@ static bool ExtendScheduledTimer(grpc_chttp2_transport* t, TaskHandle& handle,
   }
   if (grpc_core::IsKeepAlivePingTimerBatchEnabled()) {
     t->next_adjusted_keepalive_timestamp =
-        grpc_core::Timestamp::Now() + duration;
+        grpc_core::Timestamp::CoarseNow() + duration;
     return true;
   }
   if (t->event_engine->Cancel(handle)) {
@@ -3128,6 +3398,16 @@ static bool ExtendScheduledTimer(grpc_chttp2_transport* t, TaskHandle& handle,
 }
 
 static void maybe_reset_keepalive_ping_timer_locked(grpc_chttp2_transport* t) {
+  if (t->keepalive_ticker != nullptr) {
+    // The ticker is shared by every connection, so rather than move the
+    // entry on each read just note the new deadline; init_keepalive_ping
+    // pushes the timer back when it fires.
+    if (t->keepalive_ticker_pending) {
+      t->next_adjusted_keepalive_timestamp =
+          grpc_core::Timestamp::CoarseNow() + t->keepalive_time;
+    }
+    return;
+  }
   if (ExtendScheduledTimer(
           t, t->keepalive_ping_timer_handle, t->keepalive_time,
           [t = t->Ref()]() mutable {
@@ -3332,6 +3612,8 @@ const char* grpc_chttp2_initiate_write_reason_string(
       return "PING_RESPONSE";
     case GRPC_CHTTP2_INITIATE_WRITE_FORCE_RST_STREAM:
       return "FORCE_RST_STREAM";
+    case GRPC_CHTTP2_INITIATE_WRITE_COALESCED_CONTROL_FRAMES:
+      return "COALESCED_CONTROL_FRAMES";
   }
   GPR_UNREACHABLE_CODE(return "unknown");
 }
@@ -3349,6 +3631,11 @@ absl::string_view grpc_chttp2_transport::GetTransportName() const {
   return "chttp2";
 }
 
+std::optional<uint32_t> grpc_chttp2_transport::PeerMaxConcurrentStreams()
+    const {
+  return peer_max_concurrent_streams.load(std::memory_order_relaxed);
+}
+
 grpc_core::RefCountedPtr<grpc_core::channelz::SocketNode>
 grpc_chttp2_transport_get_socket_node(grpc_core::Transport* transport) {
   grpc_chttp2_transport* t =
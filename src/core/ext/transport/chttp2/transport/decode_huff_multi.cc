@@ -0,0 +1,90 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chttp2/transport/decode_huff_multi.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "src/core/ext/transport/chttp2/transport/huffsyms.h"
+
+namespace grpc_core {
+namespace huff_multi_detail {
+
+namespace {
+
+Tables* BuildTables() {
+  Tables* t = new Tables();
+  // first_symbol[i] is the symbol whose code prefixes the kPeekBits bits of i,
+  // or -1 when that code is longer than kPeekBits.
+  std::vector<int16_t> first_symbol(1 << kPeekBits, -1);
+  for (int sym = 0; sym < GRPC_CHTTP2_NUM_HUFFSYMS; ++sym) {
+    const int len = static_cast<int>(grpc_chttp2_huffsyms[sym].length);
+    if (len > kPeekBits) continue;
+    const uint32_t start = grpc_chttp2_huffsyms[sym].bits << (kPeekBits - len);
+    std::fill_n(first_symbol.begin() + start, 1u << (kPeekBits - len), sym);
+  }
+  for (uint32_t i = 0; i < (1u << kPeekBits); ++i) {
+    uint32_t entry = 0;
+    int used = 0;
+    for (int n = 0; n < 3; ++n) {
+      // Left align the unused bits; the zero fill can never complete a code
+      // that fits in the real bits, so it does not change the match.
+      const int sym = first_symbol[(i << used) & ((1u << kPeekBits) - 1)];
+      if (sym < 0) break;
+      const int len = static_cast<int>(grpc_chttp2_huffsyms[sym].length);
+      if (used + len > kPeekBits) break;
+      used += len;
+      entry |= static_cast<uint32_t>(sym) << (8 * n);
+      entry = (entry & 0x00ffffff) | (static_cast<uint32_t>(n + 1) << 24) |
+              (static_cast<uint32_t>(used) << 26);
+    }
+    t->primary[i] = entry;
+  }
+  // HPACK's code is canonical: within a length, codes increase with the
+  // symbol value, and each length continues where the previous one ended.
+  uint16_t order[GRPC_CHTTP2_NUM_HUFFSYMS];
+  for (int i = 0; i < GRPC_CHTTP2_NUM_HUFFSYMS; ++i) order[i] = i;
+  std::stable_sort(order, order + GRPC_CHTTP2_NUM_HUFFSYMS,
+                   [](uint16_t a, uint16_t b) {
+                     return grpc_chttp2_huffsyms[a].length <
+                            grpc_chttp2_huffsyms[b].length;
+                   });
+  for (int i = 0; i < GRPC_CHTTP2_NUM_HUFFSYMS; ++i) {
+    const auto& sym = grpc_chttp2_huffsyms[order[i]];
+    if (t->count[sym.length] == 0) {
+      t->first_code[sym.length] = sym.bits;
+      t->offset[sym.length] = i;
+    }
+    ++t->count[sym.length];
+    t->symbols[i] = order[i];
+  }
+  return t;
+}
+
+}  // namespace
+
+int CodeLength(uint8_t symbol) {
+  return static_cast<int>(grpc_chttp2_huffsyms[symbol].length);
+}
+
+const Tables& GetTables() {
+  static const Tables* const tables = BuildTables();
+  return *tables;
+}
+
+}  // namespace huff_multi_detail
+}  // namespace grpc_core
@@ -0,0 +1,167 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_DECODE_HUFF_MULTI_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_DECODE_HUFF_MULTI_H
+
+#include <grpc/support/port_platform.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace grpc_core {
+
+namespace huff_multi_detail {
+
+// Number of input bits resolved by one primary table lookup.
+inline constexpr int kPeekBits = 14;
+
+// Primary table entry layout:
+//   bits  0..23  up to three decoded symbols, first symbol in the low byte
+//   bits 24..25  number of symbols decoded (0 => code longer than kPeekBits)
+//   bits 26..30  total bits consumed
+struct Tables {
+  uint32_t primary[1 << kPeekBits];
+  // Canonical decoding of codes longer than kPeekBits, by code length.
+  uint32_t first_code[31];
+  uint16_t count[31];
+  uint16_t offset[31];
+  uint16_t symbols[257];
+};
+
+const Tables& GetTables();
+int CodeLength(uint8_t symbol);
+
+}  // namespace huff_multi_detail
+
+// HPACK Huffman decoder with the same interface as HuffDecoder (see
+// decode_huff.h) that keeps a 64 bit bit-reservoir and resolves up to three
+// symbols per table lookup, falling back to canonical decoding for the rare
+// codes longer than kPeekBits bits.
+// F is a functor taking a uint8_t, called once per decoded byte.
+template <typename F>
+class MultiSymbolHuffDecoder {
+ public:
+  MultiSymbolHuffDecoder(F sink, const uint8_t* begin, const uint8_t* end)
+      : sink_(sink),
+        begin_(begin),
+        end_(end),
+        tables_(huff_multi_detail::GetTables()) {}
+
+  // Decode the whole input; returns false on a malformed encoding. Matches
+  // HuffDecoder exactly: trailing bits must be all ones (a prefix of EOS),
+  // and an encoded EOS ends decoding successfully.
+  bool Run() {
+    using huff_multi_detail::kPeekBits;
+    while (true) {
+      Refill();
+      if (bits_ < kPeekBits) return Finish();
+      const uint32_t entry = tables_.primary[buffer_ >> (64 - kPeekBits)];
+      switch ((entry >> 24) & 3) {
+        case 3:
+          sink_(entry & 0xff);
+          sink_((entry >> 8) & 0xff);
+          sink_((entry >> 16) & 0xff);
+          break;
+        case 2:
+          sink_(entry & 0xff);
+          sink_((entry >> 8) & 0xff);
+          break;
+        case 1:
+          sink_(entry & 0xff);
+          break;
+        default:
+          switch (DecodeLong()) {
+            case LongResult::kOk:
+              continue;
+            case LongResult::kError:
+              return false;
+            case LongResult::kEos:
+              return true;
+            case LongResult::kTruncated:
+              return Finish();
+          }
+      }
+      Consume((entry >> 26) & 31);
+    }
+  }
+
+ private:
+  enum class LongResult { kOk, kError, kEos, kTruncated };
+
+  void Refill() {
+    if (end_ - begin_ >= 8) {
+      uint64_t next = 0;
+      for (int i = 0; i < 8; ++i) next = (next << 8) | begin_[i];
+      buffer_ |= next >> bits_;
+      const int bytes = (63 - bits_) >> 3;
+      begin_ += bytes;
+      bits_ += bytes * 8;
+      return;
+    }
+    while (bits_ <= 56 && begin_ != end_) {
+      buffer_ |= static_cast<uint64_t>(*begin_++) << (56 - bits_);
+      bits_ += 8;
+    }
+  }
+
+  void Consume(int n) {
+    buffer_ <<= n;
+    bits_ -= n;
+  }
+
+  LongResult DecodeLong() {
+    for (int len = huff_multi_detail::kPeekBits + 1; len <= 30; ++len) {
+      if (len > bits_) return LongResult::kTruncated;
+      const uint32_t code = static_cast<uint32_t>(buffer_ >> (64 - len));
+      const uint32_t index = code - tables_.first_code[len];
+      if (index < tables_.count[len]) {
+        const uint16_t symbol = tables_.symbols[tables_.offset[len] + index];
+        if (symbol == 256) return LongResult::kEos;
+        sink_(static_cast<uint8_t>(symbol));
+        Consume(len);
+        return LongResult::kOk;
+      }
+    }
+    return LongResult::kError;
+  }
+
+  // Input is exhausted: decode whatever whole symbols remain, then validate
+  // that the rest is a prefix of EOS (all ones).
+  bool Finish() {
+    using huff_multi_detail::kPeekBits;
+    while (bits_ > 0) {
+      const uint32_t entry = tables_.primary[buffer_ >> (64 - kPeekBits)];
+      if (((entry >> 24) & 3) == 0) break;
+      const int first_len = huff_multi_detail::CodeLength(entry & 0xff);
+      if (first_len > bits_) break;
+      sink_(entry & 0xff);
+      Consume(first_len);
+    }
+    if (bits_ == 0) return true;
+    return (buffer_ >> (64 - bits_)) == (uint64_t{1} << bits_) - 1;
+  }
+
+  F sink_;
+  const uint8_t* begin_;
+  const uint8_t* const end_;
+  const huff_multi_detail::Tables& tables_;
+  // Unconsumed input, left aligned: the next bit to decode is the MSB.
+  uint64_t buffer_ = 0;
+  int bits_ = 0;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_DECODE_HUFF_MULTI_H
@@ -95,6 +95,49 @@ std::ostream& operator<<(std::ostream& out, const FlowControlAction& action) {
   return out << action.DebugString();
 }
 
+void PathModel::AddSample(Timestamp now, int64_t bytes_received,
+                          std::optional<Duration> min_rtt) {
+  if (min_rtt.has_value() && *min_rtt > Duration::Zero() &&
+      (!min_rtt_.has_value() || *min_rtt <= *min_rtt_ ||
+       now - min_rtt_time_ > kMinRttExpiry)) {
+    min_rtt_ = *min_rtt;
+    min_rtt_time_ = now;
+  }
+  if (!last_sample_time_.has_value()) {
+    last_sample_time_ = now;
+    last_bytes_received_ = bytes_received;
+    return;
+  }
+  const Duration elapsed = now - *last_sample_time_;
+  if (elapsed < kMinSampleInterval) return;
+  const double rate = (bytes_received - last_bytes_received_) /
+                      elapsed.seconds();
+  last_sample_time_ = now;
+  last_bytes_received_ = bytes_received;
+  rate_samples_[next_rate_sample_] = rate;
+  next_rate_sample_ = (next_rate_sample_ + 1) % kBandwidthSamples;
+  bandwidth_ = *std::max_element(rate_samples_.begin(), rate_samples_.end());
+  if (!in_startup_) return;
+  // Leave startup once the peak rate has stopped growing: the window is no
+  // longer what limits the peer.
+  if (bandwidth_ >= startup_bandwidth_ * 1.25) {
+    startup_bandwidth_ = bandwidth_;
+    rounds_without_growth_ = 0;
+  } else if (++rounds_without_growth_ >= kRoundsWithoutGrowthToLeaveStartup) {
+    in_startup_ = false;
+  }
+}
+
+double PathModel::EstimateBdp() const {
+  if (!has_estimate()) return 0;
+  return bandwidth_ * min_rtt_->seconds();
+}
+
+std::optional<double> PathModel::TargetWindow() const {
+  if (!has_estimate()) return std::nullopt;
+  return EstimateBdp() * (in_startup_ ? kStartupGain : kSteadyGain);
+}
+
 TransportFlowControl::TransportFlowControl(absl::string_view name,
                                            bool enable_bdp_probe,
                                            MemoryOwner* memory_owner)
@@ -148,6 +191,7 @@ absl::Status TransportFlowControl::IncomingUpdateContext::RecvData(
   absl::Status error = stream();
   if (!error.ok()) return error;
   tfc_->announced_window_ -= incoming_frame_size;
+  tfc_->bytes_received_ += incoming_frame_size;
   return absl::OkStatus();
 }
 
@@ -174,7 +218,18 @@ FlowControlAction TransportFlowControl::UpdateAction(FlowControlAction action) {
 double
 TransportFlowControl::TargetInitialWindowSizeBasedOnMemoryPressureAndBdp()
     const {
-  const double bdp = bdp_estimator_.EstimateBdp() * 2.0;
+  if (IsChttp2ModelBasedFlowControlEnabled()) {
+    std::optional<double> window = path_model_.TargetWindow();
+    if (window.has_value()) {
+      return TargetInitialWindowSizeBasedOnMemoryPressure(*window);
+    }
+  }
+  return TargetInitialWindowSizeBasedOnMemoryPressure(
+      bdp_estimator_.EstimateBdp() * 2.0);
+}
+
+double TransportFlowControl::TargetInitialWindowSizeBasedOnMemoryPressure(
+    double bdp) const {
   const double memory_pressure =
       memory_owner_->GetPressureInfo().pressure_control_value;
   // Linear interpolation between two values.
@@ -192,7 +247,8 @@ TransportFlowControl::TargetInitialWindowSizeBasedOnMemoryPressureAndBdp()
   //    is arguably more considered.
   // 3. High memory pressure - past 50% we linearly ramp down window size from
   //    BDP to 0 - at which point senders effectively must request to send bytes
-  //    to us.
+  //    to us. Endpoint read buffers shrink along the same curve
+  //    (BufferSizeUnderMemoryPressure).
   //
   //          ▲
   //          │
@@ -210,7 +266,7 @@ TransportFlowControl::TargetInitialWindowSizeBasedOnMemoryPressureAndBdp()
   //          0%        20%           50%                      100% memory
   //                                                                pressure
   const double kAnythingGoesPressure = 0.2;
-  const double kAdjustedToBdpPressure = 0.5;
+  const double kAdjustedToBdpPressure = kBufferShrinkStartPressure;
   const double kOneMegabyte = 1024.0 * 1024.0;
   const double kAnythingGoesWindow = std::max(4.0 * kOneMegabyte, bdp);
   if (memory_pressure < kAnythingGoesPressure) {
@@ -218,10 +274,8 @@ TransportFlowControl::TargetInitialWindowSizeBasedOnMemoryPressureAndBdp()
   } else if (memory_pressure < kAdjustedToBdpPressure) {
     return lerp(memory_pressure, kAnythingGoesPressure, kAdjustedToBdpPressure,
                 kAnythingGoesWindow, bdp);
-  } else if (memory_pressure < 1.0) {
-    return lerp(memory_pressure, kAdjustedToBdpPressure, 1.0, bdp, 0);
   } else {
-    return 0;
+    return BufferSizeUnderMemoryPressure(memory_pressure, 0, bdp);
   }
 }
 
@@ -262,6 +316,18 @@ FlowControlAction TransportFlowControl::SetAckedInitialWindow(uint32_t value) {
   return action;
 }
 
+FlowControlAction TransportFlowControl::AddPathSample(
+    Timestamp now, std::optional<Duration> min_rtt) {
+  path_model_.AddSample(now, bytes_received_, min_rtt);
+  GRPC_TRACE_LOG(flowctl, INFO)
+      << "[flowctl] path model: bw=" << path_model_.bandwidth()
+      << "B/s min_rtt="
+      << path_model_.min_rtt().value_or(Duration::Zero()).ToString()
+      << " bdp=" << path_model_.EstimateBdp()
+      << (path_model_.in_startup() ? " startup" : " steady");
+  return PeriodicUpdate();
+}
+
 FlowControlAction TransportFlowControl::PeriodicUpdate() {
   FlowControlAction action;
   if (enable_bdp_probe_) {
@@ -325,7 +391,11 @@ std::string TransportFlowControl::Stats::ToString() const {
                       announced_stream_total_over_incoming_window,
                       " bdp_accumulator: ", bdp_accumulator,
                       " bdp_estimate: ", bdp_estimate,
-                      " bdp_bw_est: ", bdp_bw_est);
+                      " bdp_bw_est: ", bdp_bw_est,
+                      " model_bw_est: ", model_bw_est,
+                      " model_min_rtt_ms: ", model_min_rtt_ms,
+                      " model_bdp: ", model_bdp,
+                      " model_in_startup: ", model_in_startup);
 }
 
 void StreamFlowControl::SentUpdate(uint32_t announce) {
@@ -23,6 +23,7 @@
 #include <limits.h>
 #include <stdint.h>
 
+#include <array>
 #include <iosfwd>
 #include <optional>
 #include <string>
@@ -159,6 +160,55 @@ class GRPC_MUST_USE_RESULT FlowControlAction {
 std::ostream& operator<<(std::ostream& out, FlowControlAction::Urgency urgency);
 std::ostream& operator<<(std::ostream& out, const FlowControlAction& action);
 
+// A BBR style model of the path our peer sends to us over. The bottleneck
+// bandwidth is the peak rate at which data arrived over the last few samples,
+// and the propagation delay is the minimum RTT seen over the last ten
+// seconds; their product is what the stream windows must cover for the peer
+// to keep the path full.
+//
+// Like BBR's startup phase, while the peak rate keeps growing by a quarter
+// or more per sample the model asks for kStartupGain times the BDP, so that a
+// window limited sender can double its rate every RTT. Once it stops growing
+// the model settles at kSteadyGain times the BDP.
+class PathModel {
+ public:
+  static constexpr double kStartupGain = 2.885;  // 2 / ln(2)
+  static constexpr double kSteadyGain = 2.0;
+
+  // Records that `bytes_received` bytes had arrived in total by `now`, and
+  // the connection's minimum RTT if the endpoint reports one.
+  void AddSample(Timestamp now, int64_t bytes_received,
+                 std::optional<Duration> min_rtt);
+
+  bool has_estimate() const { return bandwidth_ > 0 && min_rtt_.has_value(); }
+  // Bytes per second.
+  double bandwidth() const { return bandwidth_; }
+  std::optional<Duration> min_rtt() const { return min_rtt_; }
+  double EstimateBdp() const;
+  bool in_startup() const { return in_startup_; }
+  // The window the model wants advertised, if it has an estimate.
+  std::optional<double> TargetWindow() const;
+
+ private:
+  static constexpr size_t kBandwidthSamples = 10;
+  static constexpr Duration kMinRttExpiry = Duration::Seconds(10);
+  // Samples closer together than this say more about scheduling than about
+  // the path.
+  static constexpr Duration kMinSampleInterval = Duration::Milliseconds(1);
+  static constexpr int kRoundsWithoutGrowthToLeaveStartup = 3;
+
+  std::optional<Timestamp> last_sample_time_;
+  int64_t last_bytes_received_ = 0;
+  std::array<double, kBandwidthSamples> rate_samples_{};
+  size_t next_rate_sample_ = 0;
+  double bandwidth_ = 0;
+  std::optional<Duration> min_rtt_;
+  Timestamp min_rtt_time_;
+  bool in_startup_ = true;
+  double startup_bandwidth_ = 0;
+  int rounds_without_growth_ = 0;
+};
+
 // Implementation of flow control that abides to HTTP/2 spec and attempts
 // to be as performant as possible.
 class TransportFlowControl final {
@@ -255,6 +305,13 @@ class TransportFlowControl final {
   // to let chttp2 change its parameters
   FlowControlAction PeriodicUpdate();
 
+  // Feeds the path model with a sample taken at `now`, and re-targets the
+  // windows from it. Only used when chttp2_model_based_flow_control is on;
+  // call about once per RTT.
+  FlowControlAction AddPathSample(Timestamp now,
+                                  std::optional<Duration> min_rtt);
+  const PathModel& path_model() const { return path_model_; }
+
   int64_t target_window() const;
   int64_t target_frame_size() const { return target_frame_size_; }
   int64_t target_preferred_rx_crypto_frame_size() const {
@@ -300,6 +357,11 @@ class TransportFlowControl final {
     int64_t bdp_accumulator;
     int64_t bdp_estimate;
     double bdp_bw_est;
+    // Path model stats.
+    double model_bw_est;
+    int64_t model_min_rtt_ms;
+    int64_t model_bdp;
+    bool model_in_startup;
 
     std::string ToString() const;
   };
@@ -320,11 +382,17 @@ class TransportFlowControl final {
     stats.bdp_accumulator = bdp_estimator_.accumulator();
     stats.bdp_estimate = bdp_estimator_.EstimateBdp();
     stats.bdp_bw_est = bdp_estimator_.EstimateBandwidth();
+    stats.model_bw_est = path_model_.bandwidth();
+    stats.model_min_rtt_ms =
+        path_model_.min_rtt().value_or(Duration::Zero()).millis();
+    stats.model_bdp = static_cast<int64_t>(path_model_.EstimateBdp());
+    stats.model_in_startup = path_model_.in_startup();
     return stats;
   }
 
  private:
   double TargetInitialWindowSizeBasedOnMemoryPressureAndBdp() const;
+  double TargetInitialWindowSizeBasedOnMemoryPressure(double window) const;
   static void UpdateSetting(absl::string_view name, int64_t* desired_value,
                             uint32_t new_desired_value,
                             FlowControlAction* action,
@@ -350,6 +418,9 @@ class TransportFlowControl final {
 
   // bdp estimation
   BdpEstimator bdp_estimator_;
+  PathModel path_model_;
+  // Total bytes received on the transport, for path_model_.
+  int64_t bytes_received_ = 0;
 
   int64_t remote_window_ = kDefaultWindow;
   int64_t target_initial_window_size_ = kDefaultWindow;
@@ -17,6 +17,7 @@
 #include <grpc/support/port_platform.h>
 #include <stddef.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <utility>
 
@@ -520,4 +521,59 @@ absl::StatusOr<Http2Frame> ParseFramePayload(const Http2FrameHeader& hdr,
   }
 }
 
+void AppendDataFrames(uint32_t stream_id, SliceBuffer& payload,
+                      uint32_t max_frame_size, bool end_stream,
+                      std::vector<Http2Frame>& frames) {
+  ABSL_CHECK_GT(max_frame_size, 0u);
+  do {
+    Http2DataFrame frame{stream_id, false, SliceBuffer()};
+    payload.MoveFirstNBytesIntoSliceBuffer(
+        std::min<size_t>(payload.Length(), max_frame_size), frame.payload);
+    frame.end_stream = end_stream && payload.Length() == 0;
+    frames.emplace_back(std::move(frame));
+  } while (payload.Length() != 0);
+}
+
+void AppendHeaderFrames(uint32_t stream_id, SliceBuffer& header_block,
+                        uint32_t max_frame_size, bool end_stream,
+                        std::vector<Http2Frame>& frames) {
+  ABSL_CHECK_GT(max_frame_size, 0u);
+  Http2HeaderFrame header{stream_id, false, end_stream, SliceBuffer()};
+  header_block.MoveFirstNBytesIntoSliceBuffer(
+      std::min<size_t>(header_block.Length(), max_frame_size), header.payload);
+  header.end_headers = header_block.Length() == 0;
+  frames.emplace_back(std::move(header));
+  while (header_block.Length() != 0) {
+    Http2ContinuationFrame continuation{stream_id, false, SliceBuffer()};
+    header_block.MoveFirstNBytesIntoSliceBuffer(
+        std::min<size_t>(header_block.Length(), max_frame_size),
+        continuation.payload);
+    continuation.end_headers = header_block.Length() == 0;
+    frames.emplace_back(std::move(continuation));
+  }
+}
+
+absl::StatusOr<std::vector<Http2Frame>> ParseFrames(SliceBuffer& buffer,
+                                                    uint32_t max_frame_size) {
+  std::vector<Http2Frame> frames;
+  while (buffer.Length() >= kFrameHeaderSize) {
+    uint8_t header_bytes[kFrameHeaderSize];
+    grpc_slice_buffer_copy_first_into_buffer(buffer.c_slice_buffer(),
+                                             kFrameHeaderSize, header_bytes);
+    const Http2FrameHeader header = Http2FrameHeader::Parse(header_bytes);
+    if (header.length > max_frame_size) {
+      return absl::InternalError(
+          absl::StrCat("frame too large: ", header.ToString()));
+    }
+    if (buffer.Length() < kFrameHeaderSize + header.length) break;
+    buffer.MoveFirstNBytesIntoBuffer(kFrameHeaderSize, header_bytes);
+    SliceBuffer payload;
+    buffer.MoveFirstNBytesIntoSliceBuffer(header.length, payload);
+    auto frame = ParseFramePayload(header, std::move(payload));
+    if (!frame.ok()) return frame.status();
+    frames.emplace_back(std::move(*frame));
+  }
+  return frames;
+}
+
 }  // namespace grpc_core
@@ -218,6 +218,27 @@ absl::StatusOr<Http2Frame> ParseFramePayload(const Http2FrameHeader& hdr,
 // move things out of frames)
 void Serialize(absl::Span<Http2Frame> frames, SliceBuffer& out);
 
+// Appends DATA frames carrying payload to frames, each at most
+// max_frame_size bytes long, and sets end_stream on the last one. The frame
+// bodies share payload's slices rather than copying them, so serializing
+// the result with Serialize() only writes the frame headers.
+void AppendDataFrames(uint32_t stream_id, SliceBuffer& payload,
+                      uint32_t max_frame_size, bool end_stream,
+                      std::vector<Http2Frame>& frames);
+
+// Appends a HEADERS frame, followed by CONTINUATION frames if header_block
+// does not fit in max_frame_size, carrying an HPACK encoded header block.
+void AppendHeaderFrames(uint32_t stream_id, SliceBuffer& header_block,
+                        uint32_t max_frame_size, bool end_stream,
+                        std::vector<Http2Frame>& frames);
+
+// Parses every complete frame at the front of buffer, which holds the bytes
+// read from the wire so far, and leaves a trailing partial frame in buffer
+// for the next read to complete. A frame longer than max_frame_size is an
+// error.
+absl::StatusOr<std::vector<Http2Frame>> ParseFrames(SliceBuffer& buffer,
+                                                    uint32_t max_frame_size);
+
 }  // namespace grpc_core
 
 #endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_FRAME_H
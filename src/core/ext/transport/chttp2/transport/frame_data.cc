@@ -117,6 +117,19 @@ grpc_core::Poll<grpc_error_handle> grpc_deframe_unprocessed_incoming_frames(
                   (static_cast<uint32_t>(header[3]) << 8) |
                   static_cast<uint32_t>(header[4]);
 
+  if (s->t->max_recv_message_length.has_value() &&
+      length > *s->t->max_recv_message_length) {
+    error = absl::ResourceExhaustedError(absl::StrFormat(
+        "%s: Received message larger than max (%u vs. %d)",
+        s->t->is_client ? "CLIENT" : "SERVER", length,
+        *s->t->max_recv_message_length));
+    error = grpc_error_set_int(error, grpc_core::StatusIntProperty::kRpcStatus,
+                               GRPC_STATUS_RESOURCE_EXHAUSTED);
+    error = grpc_error_set_int(error, grpc_core::StatusIntProperty::kStreamId,
+                               static_cast<intptr_t>(s->id));
+    return error;
+  }
+
   if (slices->length < length + GRPC_HEADER_SIZE_IN_BYTES) {
     if (min_progress_size != nullptr) {
       *min_progress_size = length + GRPC_HEADER_SIZE_IN_BYTES - slices->length;
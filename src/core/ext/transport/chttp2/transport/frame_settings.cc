@@ -117,6 +117,9 @@ grpc_error_handle grpc_chttp2_settings_parser_parse(void* p,
                 .IncrementHttp2PreferredReceiveCryptoMessageSize(
                     target_settings->preferred_receive_crypto_message_size());
             *parser->target_settings = *parser->incoming_settings;
+            t->peer_max_concurrent_streams.store(
+                parser->target_settings->max_concurrent_streams(),
+                std::memory_order_relaxed);
             t->num_pending_induced_frames++;
             grpc_slice_buffer_add(&t->qbuf, grpc_chttp2_settings_ack_create());
             grpc_chttp2_initiate_write(t,
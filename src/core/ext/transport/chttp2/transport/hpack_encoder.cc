@@ -121,6 +121,17 @@ void HPackCompressor::SetMaxTableSize(uint32_t max_table_size) {
   }
 }
 
+Slice HPackCompressor::EncodeTemplate(
+    const MetadataTemplate& metadata_template) {
+  SliceBuffer raw;
+  // Literals without indexing never touch the compressor's table.
+  hpack_encoder_detail::Encoder encoder(nullptr, false, raw);
+  for (const auto& [key, value] : metadata_template.entries()) {
+    encoder.EmitLitHdrWithNonBinaryStringKeyNotIdx(key.Ref(), value.Ref());
+  }
+  return raw.JoinIntoSlice();
+}
+
 namespace {
 struct WireValue {
   WireValue(uint8_t huffman_prefix, bool insert_null_before_wire_value,
@@ -174,11 +185,26 @@ struct UnsureIfInterned {
   }
 };
 
+// As GetWireValue for a -bin header, but consulting cache (if non-null) for
+// a previous encoding of the same value.
+WireValue GetBinaryWireValue(
+    Slice value, bool true_binary_enabled,
+    hpack_encoder_detail::BinaryValueEncodingCache* cache) {
+  if (true_binary_enabled || cache == nullptr) {
+    return GetWireValue(std::move(value), true_binary_enabled, true);
+  }
+  uint32_t hpack_length;
+  Slice output = cache->Encode(value, &hpack_length);
+  return WireValue(0x80, false, std::move(output), hpack_length);
+}
+
 class BinaryStringValue {
  public:
-  explicit BinaryStringValue(Slice value, bool use_true_binary_metadata)
-      : wire_value_(
-            GetWireValue(std::move(value), use_true_binary_metadata, true)),
+  explicit BinaryStringValue(
+      Slice value, bool use_true_binary_metadata,
+      hpack_encoder_detail::BinaryValueEncodingCache* cache = nullptr)
+      : wire_value_(GetBinaryWireValue(std::move(value),
+                                       use_true_binary_metadata, cache)),
         len_val_(wire_value_.length) {}
 
   size_t prefix_length() const {
@@ -239,6 +265,29 @@ class StringKey {
 }  // namespace
 
 namespace hpack_encoder_detail {
+Slice BinaryValueEncodingCache::Encode(const Slice& value,
+                                       uint32_t* wire_size) {
+  if (value.length() > kMaxValueSize) {
+    return Slice(grpc_chttp2_base64_encode_and_huffman_compress(
+        value.c_slice(), wire_size));
+  }
+  for (Entry& entry : entries_) {
+    if (!entry.encoded.empty() && entry.value == value) {
+      *wire_size = entry.wire_size;
+      return entry.encoded.Ref();
+    }
+  }
+  Entry& entry = entries_[next_entry_];
+  next_entry_ = (next_entry_ + 1) % kNumEntries;
+  entry.encoded = Slice(grpc_chttp2_base64_encode_and_huffman_compress(
+      value.c_slice(), &entry.wire_size));
+  // Keep our own copy of small values so that we never pin a large buffer
+  // that the value happens to be a sub-slice of.
+  entry.value = Slice::FromCopiedString(value.as_string_view());
+  *wire_size = entry.wire_size;
+  return entry.encoded.Ref();
+}
+
 void Encoder::EmitIndexed(uint32_t elem_index) {
   VarintWriter<1> w(elem_index);
   w.Write(0x80, output_.AddTiny(w.length()));
@@ -266,7 +315,8 @@ void Encoder::EmitLitHdrWithBinaryStringKeyNotIdx(Slice key_slice,
   StringKey key(std::move(key_slice));
   key.WritePrefix(0x00, output_.AddTiny(key.prefix_length()));
   output_.Append(key.key());
-  BinaryStringValue emit(std::move(value_slice), use_true_binary_metadata_);
+  BinaryStringValue emit(std::move(value_slice), use_true_binary_metadata_,
+                         &compressor_->binary_value_cache_);
   emit.WritePrefix(output_.AddTiny(emit.prefix_length()));
   output_.Append(emit.data());
 }
@@ -289,7 +339,8 @@ uint32_t Encoder::EmitLitHdrWithBinaryStringKeyIncIdx(Slice key_slice,
 
 void Encoder::EmitLitHdrWithBinaryStringKeyNotIdx(uint32_t key_index,
                                                   Slice value_slice) {
-  BinaryStringValue emit(std::move(value_slice), use_true_binary_metadata_);
+  BinaryStringValue emit(std::move(value_slice), use_true_binary_metadata_,
+                         &compressor_->binary_value_cache_);
   VarintWriter<4> key(key_index);
   uint8_t* data = output_.AddTiny(key.length() + emit.prefix_length());
   key.Write(0x00, data);
@@ -356,7 +407,71 @@ void SliceIndex::EmitTo(absl::string_view key, const Slice& value,
   values_.emplace_back(value.Ref(), index);
 }
 
+void AdaptiveKeyIndex::EmitTo(const Slice& key, const Slice& value,
+                              Encoder* encoder) {
+  const bool is_bin = absl::EndsWith(key.as_string_view(), "-bin");
+  auto emit_literal = [&]() {
+    if (is_bin) {
+      encoder->EmitLitHdrWithBinaryStringKeyNotIdx(key.Ref(), value.Ref());
+    } else {
+      encoder->EmitLitHdrWithNonBinaryStringKeyNotIdx(key.Ref(), value.Ref());
+    }
+  };
+  if (hpack_constants::SizeForEntry(key.size(), value.size()) >
+      HPackEncoderTable::MaxEntrySize()) {
+    emit_literal();
+    return;
+  }
+  KeyStats* stats = nullptr;
+  for (KeyStats& k : keys_) {
+    if (k.key == key) {
+      stats = &k;
+      break;
+    }
+  }
+  if (stats == nullptr) {
+    if (keys_.size() == kMaxTrackedKeys) {
+      emit_literal();
+      return;
+    }
+    keys_.emplace_back(key.Ref());
+    stats = &keys_.back();
+  }
+  if (stats->repeats + stats->changes >= 64) {
+    stats->repeats /= 2;
+    stats->changes /= 2;
+  }
+  auto& table = encoder->hpack_table();
+  if (stats->repeats + stats->changes != 0 && stats->value == value) {
+    ++stats->repeats;
+    if (table.ConvertibleToDynamicIndex(stats->index)) {
+      global_stats().IncrementHttp2HpackHits();
+      encoder->EmitIndexed(table.DynamicIndex(stats->index));
+      return;
+    }
+  } else {
+    ++stats->changes;
+    stats->value = value.Ref();
+    stats->index = 0;
+    // A changed value is only worth a table slot if this key usually repeats.
+    if (stats->repeats <= stats->changes) {
+      global_stats().IncrementHttp2HpackAdaptiveLiterals();
+      emit_literal();
+      return;
+    }
+  }
+  stats->index =
+      is_bin ? encoder->EmitLitHdrWithBinaryStringKeyIncIdx(key.Ref(),
+                                                            value.Ref())
+             : encoder->EmitLitHdrWithNonBinaryStringKeyIncIdx(key.Ref(),
+                                                               value.Ref());
+}
+
 void Encoder::Encode(const Slice& key, const Slice& value) {
+  if (compressor_->adaptive_indexing_) {
+    compressor_->adaptive_key_index_.EmitTo(key, value, this);
+    return;
+  }
   if (absl::EndsWith(key.as_string_view(), "-bin")) {
     EmitLitHdrWithBinaryStringKeyNotIdx(key.Ref(), value.Ref());
   } else {
@@ -40,6 +40,8 @@
 #include "src/core/lib/transport/timeout_encoding.h"
 #include "src/core/lib/transport/transport.h"
 #include "src/core/telemetry/call_tracer.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 #include "src/core/util/time.h"
 
 namespace grpc_core {
@@ -49,6 +51,29 @@ class HPackCompressor;
 
 namespace hpack_encoder_detail {
 
+// Remembers the base64+huffman encoding of recently sent binary header values
+// so that a value repeatedly emitted as a literal-without-indexing is not
+// re-encoded every time it is sent.
+class BinaryValueEncodingCache {
+ public:
+  static constexpr size_t kNumEntries = 4;
+  // Larger values are encoded every time rather than retained.
+  static constexpr size_t kMaxValueSize = 4096;
+
+  // Returns the base64+huffman encoding of value, and sets *wire_size to the
+  // length of the base64 encoding (as needed for hpack table math).
+  Slice Encode(const Slice& value, uint32_t* wire_size);
+
+ private:
+  struct Entry {
+    Slice value;
+    Slice encoded;
+    uint32_t wire_size = 0;
+  };
+  Entry entries_[kNumEntries];
+  size_t next_entry_ = 0;
+};
+
 class Encoder {
  public:
   Encoder(HPackCompressor* compressor, bool use_true_binary_metadata,
@@ -265,6 +290,35 @@ class SliceIndex {
   std::vector<ValueIndex> values_;
 };
 
+// Adaptive indexing for custom (unknown to the metadata system) headers.
+// Tracks, per key, how often the value sent repeats the previous one: keys
+// whose values repeat get them added to the hpack table, while keys with high
+// cardinality values (request ids, trace ids...) stay literals so that they
+// never evict useful entries from the table.
+class AdaptiveKeyIndex {
+ public:
+  // Maximum number of distinct keys we keep statistics for; further keys are
+  // always sent as literals.
+  static constexpr size_t kMaxTrackedKeys = 32;
+
+  void EmitTo(const Slice& key, const Slice& value, Encoder* encoder);
+
+ private:
+  struct KeyStats {
+    explicit KeyStats(Slice key) : key(std::move(key)) {}
+    Slice key;
+    // Last value sent for this key, and its index in the table if it was
+    // added.
+    Slice value;
+    uint32_t index = 0;
+    // Number of sends that repeated, or changed, the previous value; decayed
+    // so that the decision follows the recent behavior of the key.
+    uint32_t repeats = 0;
+    uint32_t changes = 0;
+  };
+  std::vector<KeyStats> keys_;
+};
+
 template <typename MetadataTrait>
 class Compressor<MetadataTrait, SmallSetOfValuesCompressor> {
  public:
@@ -342,6 +396,8 @@ class HPackCompressor {
 
   void SetMaxTableSize(uint32_t max_table_size);
   void SetMaxUsableSize(uint32_t max_table_size);
+  // Enable adaptive indexing of custom headers (see AdaptiveKeyIndex).
+  void SetAdaptiveIndexing(bool enabled) { adaptive_indexing_ = enabled; }
 
   uint32_t test_only_table_size() const {
     return table_.test_only_table_size();
@@ -362,6 +418,9 @@ class HPackCompressor {
     hpack_encoder_detail::Encoder encoder(
         this, options.use_true_binary_metadata, raw);
     headers.Encode(&encoder);
+    AppendTemplate(headers, raw);
+    global_stats().IncrementHttp2MetadataSize(headers.TransportSize());
+    global_stats().IncrementHttp2HpackEncodedSize(raw.Length());
     Frame(options, raw, output);
     return !encoder.saw_encoding_errors();
   }
@@ -370,10 +429,27 @@ class HPackCompressor {
   bool EncodeRawHeaders(const HeaderSet& headers, SliceBuffer& output) {
     hpack_encoder_detail::Encoder encoder(this, true, output);
     headers.Encode(&encoder);
+    AppendTemplate(headers, output);
     return !encoder.saw_encoding_errors();
   }
 
  private:
+  // A MetadataTemplate is sent as literals without indexing, which decode
+  // the same whatever the state of the dynamic table, so its encoding is
+  // computed once and shared by every call and connection.
+  static Slice EncodeTemplate(const MetadataTemplate& metadata_template);
+
+  template <typename HeaderSet>
+  static void AppendTemplate(const HeaderSet& headers, SliceBuffer& output) {
+    if constexpr (std::is_same_v<HeaderSet, grpc_metadata_batch>) {
+      const auto* metadata_template =
+          headers.get_pointer(GrpcMetadataTemplate());
+      if (metadata_template != nullptr) {
+        output.Append((*metadata_template)->Encoded(EncodeTemplate).Ref());
+      }
+    }
+  }
+
   static constexpr size_t kNumFilterValues = 64;
   static constexpr uint32_t kNumCachedGrpcStatusValues = 16;
   friend class hpack_encoder_detail::Encoder;
@@ -387,7 +463,10 @@ class HPackCompressor {
   // if non-zero, advertise to the decoder that we'll start using a table
   // of this size
   bool advertise_table_size_change_ = false;
+  bool adaptive_indexing_ = false;
   HPackEncoderTable table_;
+  hpack_encoder_detail::AdaptiveKeyIndex adaptive_key_index_;
+  hpack_encoder_detail::BinaryValueEncodingCache binary_value_cache_;
 
   grpc_metadata_batch::StatefulCompressor<hpack_encoder_detail::Compressor>
       compression_state_;
@@ -38,7 +38,7 @@
 #include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
 #include "absl/types/span.h"
-#include "src/core/ext/transport/chttp2/transport/decode_huff.h"
+#include "src/core/ext/transport/chttp2/transport/decode_huff_multi.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_constants.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_parse_result.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_parser_table.h"
@@ -362,7 +362,7 @@ HpackParseStatus HPackParser::String::ParseHuff(Input* input, uint32_t length,
   // Grab the byte range, and iterate through it.
   const uint8_t* p = input->cur_ptr();
   input->Advance(length);
-  return HuffDecoder<Out>(output, p, p + length).Run()
+  return MultiSymbolHuffDecoder<Out>(output, p, p + length).Run()
              ? HpackParseStatus::kOk
              : HpackParseStatus::kParseHuffFailed;
 }
@@ -869,7 +869,7 @@ class HPackParser::Parser {
     input_->UpdateFrontier();
     state_.parse_state = ParseState::kParsingValueLength;
     state_.is_binary_header = absl::EndsWith(key.value.string_view(), "-bin");
-    state_.key.emplace<Slice>(key.value.Take());
+    state_.key.emplace<Slice>(TakeString(key.value));
     return ParseValueLength();
   }
 
@@ -994,7 +994,7 @@ class HPackParser::Parser {
         }
       }
     }
-    auto value_slice = value.value.Take();
+    auto value_slice = TakeString(value.value);
     const auto transport_size =
         key_string.size() + value.wire_size + hpack_constants::kEntryOverhead;
     auto md = grpc_metadata_batch::Parse(
@@ -1018,6 +1018,15 @@ class HPackParser::Parser {
     }
   }
 
+  // Take a parsed string: entries that will live in the hpack table are always
+  // copied so that they never pin an input buffer.
+  Slice TakeString(String& s) {
+    if (state_.zero_copy_metadata && !state_.add_to_table) {
+      return s.TakeShared();
+    }
+    return s.Take();
+  }
+
   ValidateMetadataResult ValidateKey(absl::string_view key) {
     if (key == HttpSchemeMetadata::key() || key == HttpMethodMetadata::key() ||
         key == HttpAuthorityMetadata::key() || key == HttpPathMetadata::key() ||
@@ -1082,6 +1091,15 @@ Slice HPackParser::String::Take() {
   GPR_UNREACHABLE_CODE(return Slice());
 }
 
+Slice HPackParser::String::TakeShared() {
+  if (auto* p = std::get_if<Slice>(&value_)) {
+    Slice out = std::move(*p);
+    value_ = absl::Span<const uint8_t>();
+    return out;
+  }
+  return Take();
+}
+
 // PUBLIC INTERFACE
 
 HPackParser::HPackParser() = default;
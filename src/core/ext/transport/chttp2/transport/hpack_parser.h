@@ -116,6 +116,14 @@ class HPackParser {
   // How many bytes are buffered (for tests to assert on)
   size_t buffered_bytes() const { return unparsed_bytes_.size(); }
 
+  // If enabled, non-huffman literals that are not added to the hpack table
+  // are handed out as refcounted sub-slices of the incoming frame rather
+  // than copied. Parsing such headers allocates nothing, at the cost of the
+  // metadata keeping the frame's buffer alive for its lifetime.
+  void SetZeroCopyMetadata(bool enabled) {
+    state_.zero_copy_metadata = enabled;
+  }
+
  private:
   // Helper classes: see implementation
   class Parser;
@@ -142,6 +150,9 @@ class HPackParser {
 
     // Take the value and leave this empty
     Slice Take();
+    // As Take(), but a value that references the input slice is returned as
+    // a reference to it instead of a copy.
+    Slice TakeShared();
 
     // Return a reference to the value as a string view
     absl::string_view string_view() const;
@@ -248,6 +259,9 @@ class HPackParser {
     bool is_binary_header;
     // How many more dynamic table updates are allowed
     uint8_t dynamic_table_updates_allowed;
+    // Hand out references to the input instead of copies (see
+    // SetZeroCopyMetadata)
+    bool zero_copy_metadata = false;
     // Current parse state
     ParseState parse_state = ParseState::kTop;
     std::variant<const HPackTable::Memento*, Slice> key;
@@ -51,6 +51,7 @@
 #include "src/core/ext/transport/chttp2/transport/hpack_encoder.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_parser.h"
 #include "src/core/ext/transport/chttp2/transport/http2_settings.h"
+#include "src/core/ext/transport/chttp2/transport/keepalive_ticker.h"
 #include "src/core/ext/transport/chttp2/transport/legacy_frame.h"
 #include "src/core/ext/transport/chttp2/transport/ping_abuse_policy.h"
 #include "src/core/ext/transport/chttp2/transport/ping_callbacks.h"
@@ -58,6 +59,7 @@
 #include "src/core/ext/transport/chttp2/transport/write_size_policy.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/event_engine/extensions/tcp_info.h"
 #include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/iomgr/combiner.h"
 #include "src/core/lib/iomgr/endpoint.h"
@@ -79,6 +81,8 @@
 #include "src/core/util/ref_counted.h"
 #include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/time.h"
+#include "src/core/util/time_precise.h"
+#include "src/core/util/work_serializer.h"
 
 // Flag that this closure barrier may be covering a write in a pollset, and so
 //   we should not complete this closure until we can prove that the write got
@@ -146,6 +150,7 @@ typedef enum {
   GRPC_CHTTP2_INITIATE_WRITE_TRANSPORT_FLOW_CONTROL_UNSTALLED,
   GRPC_CHTTP2_INITIATE_WRITE_PING_RESPONSE,
   GRPC_CHTTP2_INITIATE_WRITE_FORCE_RST_STREAM,
+  GRPC_CHTTP2_INITIATE_WRITE_COALESCED_CONTROL_FRAMES,
 } grpc_chttp2_initiate_write_reason;
 
 const char* grpc_chttp2_initiate_write_reason_string(
@@ -251,6 +256,7 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
   grpc_core::ServerTransport* server_transport() override { return nullptr; }
 
   absl::string_view GetTransportName() const override;
+  std::optional<uint32_t> PeerMaxConcurrentStreams() const override;
   void InitStream(grpc_stream* gs, grpc_stream_refcount* refcount,
                   const void* server_data, grpc_core::Arena* arena) override;
   void SetPollset(grpc_stream* stream, grpc_pollset* pollset) override;
@@ -269,6 +275,14 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
 
   grpc_core::TransportFramingEndpointExtension*
       transport_framing_endpoint_extension = nullptr;
+  /// set if the endpoint can report TCP_INFO, which is then sampled after
+  /// writes, at most once per kTcpInfoSamplePeriod
+  grpc_event_engine::experimental::TcpInfoExtension* tcp_info_extension =
+      nullptr;
+  grpc_core::Timestamp next_tcp_info_sample;
+  /// with chttp2_model_based_flow_control, TCP_INFO is also sampled about
+  /// once per RTT to feed the flow control path model
+  grpc_core::Timestamp next_flow_control_sample;
 
   grpc_core::MemoryOwner memory_owner;
   const grpc_core::MemoryAllocator::Reservation self_reservation;
@@ -325,6 +339,7 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
 
   grpc_closure write_action_begin_locked;
   grpc_closure write_action_end_locked;
+  grpc_closure coalesced_write_locked;
 
   grpc_closure read_action_locked;
 
@@ -366,6 +381,10 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
 
   /// settings values
   grpc_core::Http2SettingsManager settings;
+  /// copy of settings.peer().max_concurrent_streams() that can be read
+  /// outside the combiner
+  std::atomic<uint32_t> peer_max_concurrent_streams{
+      grpc_core::Http2Settings().max_concurrent_streams()};
 
   grpc_event_engine::experimental::EventEngine::TaskHandle
       settings_ack_watchdog =
@@ -473,6 +492,12 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
       keepalive_ping_timer_handle =
           grpc_event_engine::experimental::EventEngine::TaskHandle::kInvalid;
   ;
+  /// shared ticker used instead of keepalive_ping_timer_handle for long
+  /// keepalive intervals (chttp2_keepalive_ticker experiment)
+  grpc_core::RefCountedPtr<grpc_core::KeepaliveTicker> keepalive_ticker;
+  grpc_core::KeepaliveTicker::Entry keepalive_ticker_entry;
+  /// true while keepalive_ticker_entry owns a ref to this transport
+  bool keepalive_ticker_pending = false;
   /// time duration in between pings
   grpc_core::Duration keepalive_time;
   /// Tracks any adjustments to the absolute timestamp of the next keepalive
@@ -487,6 +512,12 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
   grpc_chttp2_keepalive_state keepalive_state;
   // Soft limit on max header size.
   uint32_t max_header_list_size_soft_limit = 0;
+  // Received messages up to this size are copied into the call arena
+  // (GRPC_ARG_HTTP2_ARENA_PAYLOAD_MAX_BYTES); zero disables this.
+  uint32_t arena_payload_max_bytes = 0;
+  // Received messages declaring a longer length fail their stream as soon as
+  // the length prefix is read, before the payload is buffered.
+  std::optional<uint32_t> max_recv_message_length;
   grpc_core::ContextList* context_list = nullptr;
   grpc_core::RefCountedPtr<grpc_core::channelz::SocketNode> channelz_socket;
   uint32_t num_messages_in_next_write = 0;
@@ -511,9 +542,16 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
 
   /// write execution state of the transport
   grpc_chttp2_write_state write_state = GRPC_CHTTP2_WRITE_STATE_IDLE;
+  /// with chttp2_coalesce_control_frames: the timer that starts a write held
+  /// back because it had only control frames to send
+  grpc_event_engine::experimental::EventEngine::TaskHandle
+      coalesced_write_timer_handle =
+          grpc_event_engine::experimental::EventEngine::TaskHandle::kInvalid;
 
   /// policy for how much data we're willing to put into one http2 write
   grpc_core::Chttp2WriteSizePolicy write_size_policy;
+  /// when the current write was handed to the endpoint
+  gpr_cycle_counter write_start_cycles = 0;
 
   bool reading_paused_on_pending_induced_frames = false;
   /// Based on channel args, preferred_rx_crypto_frame_sizes are advertised to
@@ -528,6 +566,11 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
   bool benign_reclaimer_registered = false;
   /// have we scheduled a destructive cleanup?
   bool destructive_reclaimer_registered = false;
+  /// have streams been started since the last idle compaction check?
+  bool streams_started_since_idle_check = true;
+  /// HPACK table size to advertise again once the peer acks the table being
+  /// dropped for idle compaction
+  std::optional<uint32_t> idle_compaction_header_table_size;
 
   /// if keepalive pings are allowed when there's no outstanding streams
   bool keepalive_permit_without_calls = false;
@@ -615,6 +658,9 @@ struct grpc_chttp2_stream {
   grpc_closure* recv_message_ready = nullptr;
   grpc_metadata_batch* recv_trailing_metadata;
   grpc_closure* recv_trailing_metadata_finished = nullptr;
+  /// With chttp2_offload_stream_callbacks: runs the recv closures above, in
+  /// the order the transport completes them, away from the combiner
+  std::optional<grpc_core::WorkSerializer> recv_callback_serializer;
 
   grpc_transport_stream_stats* collecting_stats = nullptr;
   grpc_transport_stream_stats stats = grpc_transport_stream_stats();
@@ -670,6 +716,12 @@ struct grpc_chttp2_stream {
   /// Number of times written
   int64_t write_counter = 0;
 
+  /// With chttp2_weighted_write_scheduling: the stream's weight, from
+  /// GrpcWriteWeight on its initial metadata, and the bytes of data it may
+  /// still send in its current turn
+  uint32_t write_weight = 1;
+  int64_t write_deficit = 0;
+
   grpc_core::Chttp2CallTracerWrapper call_tracer_wrapper;
 
   /// Only set when enabled.
@@ -682,6 +734,9 @@ struct grpc_chttp2_stream {
 
   // time this stream was created
   gpr_timespec creation_time = gpr_now(GPR_CLOCK_MONOTONIC);
+  // when a client stream's initial metadata was written, until the first
+  // header frame of the response arrives; 0 otherwise
+  gpr_cycle_counter initial_metadata_write_cycles = 0;
 
   bool parsed_trailers_only = false;
 
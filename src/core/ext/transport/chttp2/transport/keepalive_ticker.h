@@ -0,0 +1,105 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_KEEPALIVE_TICKER_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_KEEPALIVE_TICKER_H
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+
+#include <array>
+#include <memory>
+
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/time.h"
+
+namespace grpc_core {
+
+// Runs the keepalive timers of every chttp2 transport sharing an EventEngine
+// off a single EventEngine timer.
+// Deadlines are rounded up to a whole tick and kept in a hashed timing wheel
+// of intrusive entries, so scheduling and cancelling cost no allocation and
+// no EventEngine timer operations. The coarse rounding makes this suitable
+// only for delays of at least kMinDelay.
+class KeepaliveTicker final : public RefCounted<KeepaliveTicker> {
+ public:
+  static constexpr Duration kTick = Duration::Seconds(1);
+  // Shortest delay for which rounding to kTick is an acceptable error.
+  static constexpr Duration kMinDelay = Duration::Seconds(10);
+
+  // Scheduling state, embedded in the object being scheduled.
+  class Entry {
+   public:
+    Entry() = default;
+    Entry(const Entry&) = delete;
+    Entry& operator=(const Entry&) = delete;
+
+   private:
+    friend class KeepaliveTicker;
+    Entry* prev_ = nullptr;
+    Entry* next_ = nullptr;
+    int64_t tick_ = 0;
+    void (*callback_)(void* arg) = nullptr;
+    void* arg_ = nullptr;
+  };
+
+  // Returns the ticker for `event_engine`, creating it if needed.
+  static RefCountedPtr<KeepaliveTicker> Get(
+      std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+          event_engine);
+
+  explicit KeepaliveTicker(
+      std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+          event_engine);
+  ~KeepaliveTicker() override;
+
+  // Runs `callback(arg)` from an EventEngine thread no earlier than `delay`
+  // from now. `entry` must not already be scheduled.
+  void Schedule(Entry* entry, Duration delay, void (*callback)(void* arg),
+                void* arg);
+  // Returns true if `entry` was unscheduled before its callback started.
+  bool Cancel(Entry* entry);
+
+ private:
+  // Number of wheel slots; entries further out than this many ticks stay in
+  // their slot for extra revolutions.
+  static constexpr size_t kSlots = 4096;
+
+  static int64_t TickFor(Timestamp timestamp, bool round_up);
+
+  void Link(Entry* entry) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void Unlink(Entry* entry) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void MaybeStartTimer() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void MaybeStopTimer() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void OnTick();
+
+  const std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+      event_engine_;
+  Mutex mu_;
+  // The last tick whose slot has been processed.
+  int64_t processed_tick_ ABSL_GUARDED_BY(mu_);
+  size_t num_entries_ ABSL_GUARDED_BY(mu_) = 0;
+  // Set while the tick timer is pending.
+  grpc_event_engine::experimental::EventEngine::TaskHandle timer_handle_
+      ABSL_GUARDED_BY(mu_) =
+          grpc_event_engine::experimental::EventEngine::TaskHandle::kInvalid;
+  std::array<Entry*, kSlots> slots_ ABSL_GUARDED_BY(mu_) = {};
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_KEEPALIVE_TICKER_H
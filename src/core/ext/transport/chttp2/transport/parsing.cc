@@ -74,6 +74,7 @@
 #include "src/core/util/random_early_detection.h"
 #include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/status_helper.h"
+#include "src/core/util/time_precise.h"
 
 using grpc_core::HPackParser;
 
@@ -685,7 +686,7 @@ static grpc_error_handle init_header_frame_parser(grpc_chttp2_transport* t,
                             grpc_core::RandomEarlyDetection(
                                 t->settings.local().max_concurrent_streams(),
                                 t->settings.acked().max_concurrent_streams())
-                                .Reject(t->stream_map.size(), t->bitgen))) {
+                                .Reject(t->stream_map.size()))) {
       // We are under the limit of max concurrent streams for the current
       // setting, but are over the next value that will be advertised.
       // Apply some backpressure by randomly not accepting new streams.
@@ -759,6 +760,12 @@ static grpc_error_handle init_header_frame_parser(grpc_chttp2_transport* t,
   if (t->header_eof) {
     s->eos_received = true;
   }
+  if (s->initial_metadata_write_cycles != 0) {
+    grpc_core::global_stats().IncrementHttp2ClientNetworkTimeUs(
+        gpr_cycle_counter_sub_micros(gpr_get_cycle_counter(),
+                                     s->initial_metadata_write_cycles));
+    s->initial_metadata_write_cycles = 0;
+  }
   grpc_metadata_batch* incoming_metadata_buffer = nullptr;
   HPackParser::LogInfo::Type frame_type = HPackParser::LogInfo::kDontKnow;
   switch (s->header_frames_received) {
@@ -874,6 +881,13 @@ static grpc_error_handle init_settings_frame_parser(grpc_chttp2_transport* t) {
     }
     t->hpack_parser.hpack_table()->SetMaxBytes(
         t->settings.acked().header_table_size());
+    if (t->idle_compaction_header_table_size.has_value() &&
+        t->settings.acked().header_table_size() == 0) {
+      // The peer has dropped its view of the table; let it grow it again.
+      t->settings.mutable_local().SetHeaderTableSize(
+          *std::exchange(t->idle_compaction_header_table_size, std::nullopt));
+      grpc_chttp2_initiate_write(t, GRPC_CHTTP2_INITIATE_WRITE_SEND_SETTINGS);
+    }
     grpc_chttp2_act_on_flowctl_action(
         t->flow_control.SetAckedInitialWindow(
             t->settings.acked().initial_window_size()),
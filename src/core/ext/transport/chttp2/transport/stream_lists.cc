@@ -168,11 +168,27 @@ static bool stream_list_prepend(grpc_chttp2_transport* t, grpc_chttp2_stream* s,
 
 // wrappers for specializations
 
+// Streams with at most this much data left before their trailers are
+// written first under chttp2_weighted_write_scheduling.
+static constexpr size_t kSmallFinalWriteBytes = 16384;
+
+// Whether s's next write is small and worth putting ahead of bulk data: only
+// headers, or the end of a short call.
+static bool is_small_write(grpc_chttp2_stream* s) {
+  if (!s->sent_initial_metadata) return s->flow_controlled_buffer.length == 0;
+  return s->send_trailing_metadata != nullptr &&
+         s->flow_controlled_buffer.length <= kSmallFinalWriteBytes;
+}
+
 bool grpc_chttp2_list_add_writable_stream(grpc_chttp2_transport* t,
                                           grpc_chttp2_stream* s) {
   ABSL_CHECK_NE(s->id, 0u);
-  if (grpc_core::IsPrioritizeFinishedRequestsEnabled() &&
-      s->send_trailing_metadata != nullptr) {
+  if (grpc_core::IsChttp2WeightedWriteSchedulingEnabled()) {
+    if (is_small_write(s)) {
+      return stream_list_prepend(t, s, GRPC_CHTTP2_LIST_WRITABLE);
+    }
+  } else if (grpc_core::IsPrioritizeFinishedRequestsEnabled() &&
+             s->send_trailing_metadata != nullptr) {
     return stream_list_prepend(t, s, GRPC_CHTTP2_LIST_WRITABLE);
   }
   return stream_list_add(t, s, GRPC_CHTTP2_LIST_WRITABLE);
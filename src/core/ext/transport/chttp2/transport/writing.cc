@@ -70,6 +70,7 @@
 #include "src/core/util/ref_counted.h"
 #include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/time.h"
+#include "src/core/util/time_precise.h"
 #include "src/core/util/useful.h"
 
 // IWYU pragma: no_include "src/core/util/orphanable.h"
@@ -389,7 +390,10 @@ class DataSendContext {
         std::min<int64_t>(
             {t_->settings.peer().max_frame_size(), stream_remote_window(),
              t_->flow_control.remote_window(),
-             static_cast<int64_t>(write_context_->target_write_size())}),
+             static_cast<int64_t>(write_context_->target_write_size()),
+             grpc_core::IsChttp2WeightedWriteSchedulingEnabled()
+                 ? s_->write_deficit
+                 : std::numeric_limits<int64_t>::max()}),
         0, std::numeric_limits<uint32_t>::max());
   }
 
@@ -407,6 +411,7 @@ class DataSendContext {
                             t_->outbuf.c_slice_buffer());
     sfc_upd_.SentData(send_bytes);
     s_->sending_bytes += send_bytes;
+    s_->write_deficit -= send_bytes;
   }
 
   bool is_last_frame() const { return is_last_frame_; }
@@ -432,6 +437,10 @@ class DataSendContext {
 
 class StreamWriteContext {
  public:
+  // Bytes of data a weight 1 stream may send per turn under
+  // chttp2_weighted_write_scheduling.
+  static constexpr int64_t kWriteQuantum = 65536;
+
   StreamWriteContext(WriteContext* write_context, grpc_chttp2_stream* s)
       : write_context_(write_context), t_(write_context->transport()), s_(s) {
     GRPC_CHTTP2_IF_TRACING(INFO)
@@ -464,6 +473,9 @@ class StreamWriteContext {
               t_->settings.peer().max_frame_size(),  // max_frame_size
               &s_->call_tracer_wrapper},
           *s_->send_initial_metadata, t_->outbuf.c_slice_buffer());
+      if (t_->is_client) {
+        s_->initial_metadata_write_cycles = gpr_get_cycle_counter();
+      }
       grpc_chttp2_reset_ping_clock(t_);
       write_context_->IncInitialMetadataWrites();
     }
@@ -525,6 +537,13 @@ class StreamWriteContext {
       return;  // early out: nothing to do
     }
 
+    if (grpc_core::IsChttp2WeightedWriteSchedulingEnabled()) {
+      // Deficit round robin: each turn adds the stream's quantum to what it
+      // has left from turns cut short by flow control, up to two quanta.
+      const int64_t quantum = kWriteQuantum * s_->write_weight;
+      s_->write_deficit = std::min(s_->write_deficit + quantum, 2 * quantum);
+    }
+
     DataSendContext data_send_context(write_context_, t_, s_);
 
     if (!data_send_context.AnyOutgoing()) {
@@ -553,6 +572,9 @@ class StreamWriteContext {
     if (s_->flow_controlled_buffer.length > 0) {
       GRPC_CHTTP2_STREAM_REF(s_, "chttp2_writing:fork");
       grpc_chttp2_list_add_writable_stream(t_, s_);
+    } else {
+      // An idle stream keeps no credit, as in deficit round robin.
+      s_->write_deficit = 0;
     }
     write_context_->IncMessageWrites();
   }
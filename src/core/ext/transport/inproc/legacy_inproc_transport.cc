@@ -318,33 +318,6 @@ void log_metadata(const grpc_metadata_batch* md_batch, bool is_client,
   });
 }
 
-namespace {
-
-class CopySink {
- public:
-  explicit CopySink(grpc_metadata_batch* dst) : dst_(dst) {}
-
-  void Encode(const grpc_core::Slice& key, const grpc_core::Slice& value) {
-    dst_->Append(key.as_string_view(), value.AsOwned(),
-                 [](absl::string_view, const grpc_core::Slice&) {});
-  }
-
-  template <class T, class V>
-  void Encode(T trait, V value) {
-    dst_->Set(trait, value);
-  }
-
-  template <class T>
-  void Encode(T trait, const grpc_core::Slice& value) {
-    dst_->Set(trait, value.AsOwned());
-  }
-
- private:
-  grpc_metadata_batch* dst_;
-};
-
-}  // namespace
-
 void fill_in_metadata(inproc_stream* s, const grpc_metadata_batch* metadata,
                       grpc_metadata_batch* out_md, bool* markfilled) {
   if (GRPC_TRACE_FLAG_ENABLED(inproc)) {
@@ -356,12 +329,11 @@ void fill_in_metadata(inproc_stream* s, const grpc_metadata_batch* metadata,
     *markfilled = true;
   }
 
-  // TODO(ctiller): copy the metadata batch, don't rely on a bespoke copy
-  // function. Can only do this once mdelems are out of the way though, too
-  // many edge cases otherwise.
+  // Only the encodable fields cross the transport, as they would on the wire.
+  // Unknown keys are shared with the sender rather than looked up by name and
+  // copied.
   out_md->Clear();
-  CopySink sink(out_md);
-  metadata->Encode(&sink);
+  metadata->CopyEncodableTo(out_md);
 }
 
 void inproc_transport::InitStream(grpc_stream* gs,
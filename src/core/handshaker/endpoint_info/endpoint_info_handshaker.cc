@@ -41,14 +41,19 @@ class EndpointInfoHandshaker : public Handshaker {
  public:
   absl::string_view name() const override { return "endpoint_info"; }
 
-  void DoHandshake(
-      HandshakerArgs* args,
-      absl::AnyInvocable<void(absl::Status)> on_handshake_done) override {
+  bool DoHandshakeInline(HandshakerArgs* args) override {
     args->args = args->args
                      .Set(GRPC_ARG_ENDPOINT_LOCAL_ADDRESS,
                           grpc_endpoint_get_local_address(args->endpoint.get()))
                      .Set(GRPC_ARG_ENDPOINT_PEER_ADDRESS,
                           grpc_endpoint_get_peer(args->endpoint.get()));
+    return true;
+  }
+
+  void DoHandshake(
+      HandshakerArgs* args,
+      absl::AnyInvocable<void(absl::Status)> on_handshake_done) override {
+    DoHandshakeInline(args);
     InvokeOnHandshakeDone(args, std::move(on_handshake_done), absl::OkStatus());
   }
 
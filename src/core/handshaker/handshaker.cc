@@ -154,6 +154,16 @@ void HandshakeManager::CallNextHandshakerLocked(absl::Status error) {
       << " shutdown=" << is_shutdown_ << " index=" << index_
       << ", args=" << HandshakerArgsString(&args_);
   ABSL_CHECK(index_ <= handshakers_.size());
+  if (error.ok() && !is_shutdown_) {
+    while (!args_.exit_early && index_ < handshakers_.size() &&
+           handshakers_[index_]->DoHandshakeInline(&args_)) {
+      GRPC_TRACE_LOG(handshaker, INFO)
+          << "handshake_manager " << this << ": handshaker "
+          << handshakers_[index_]->name() << " at index " << index_
+          << " completed inline";
+      ++index_;
+    }
+  }
   // If we got an error or we've been shut down or we're exiting early or
   // we've finished the last handshaker, invoke the on_handshake_done
   // callback.
@@ -92,6 +92,11 @@ class Handshaker : public RefCounted<Handshaker> {
       HandshakerArgs* args,
       absl::AnyInvocable<void(absl::Status)> on_handshake_done) = 0;
   virtual void Shutdown(absl::Status error) = 0;
+  // Completes the handshake synchronously and returns true if it needs no
+  // I/O, in which case DoHandshake() is not called. This lets the
+  // HandshakeManager run past such handshakers without a hop through the
+  // EventEngine for each.
+  virtual bool DoHandshakeInline(HandshakerArgs* /*args*/) { return false; }
 
  protected:
   // Helper function to safely invoke on_handshake_done asynchronously.
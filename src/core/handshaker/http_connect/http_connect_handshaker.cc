@@ -62,6 +62,7 @@ class HttpConnectHandshaker : public Handshaker {
  public:
   HttpConnectHandshaker();
   absl::string_view name() const override { return "http_connect"; }
+  bool DoHandshakeInline(HandshakerArgs* args) override;
   void DoHandshake(
       HandshakerArgs* args,
       absl::AnyInvocable<void(absl::Status)> on_handshake_done) override;
@@ -255,6 +256,11 @@ void HttpConnectHandshaker::Shutdown(absl::Status /*error*/) {
   if (on_handshake_done_ != nullptr) args_->endpoint.reset();
 }
 
+bool HttpConnectHandshaker::DoHandshakeInline(HandshakerArgs* args) {
+  // Without the HTTP CONNECT channel arg there is nothing to do.
+  return !args->args.GetString(GRPC_ARG_HTTP_CONNECT_SERVER).has_value();
+}
+
 void HttpConnectHandshaker::DoHandshake(
     HandshakerArgs* args,
     absl::AnyInvocable<void(absl::Status)> on_handshake_done) {
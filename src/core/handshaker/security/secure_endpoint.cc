@@ -71,10 +71,11 @@ struct secure_endpoint : public grpc_endpoint {
                   grpc_core::OrphanablePtr<grpc_endpoint> endpoint,
                   grpc_slice* leftover_slices,
                   const grpc_channel_args* channel_args,
-                  size_t leftover_nslices)
+                  size_t leftover_nslices, bool kernel_protects_writes)
       : wrapped_ep(std::move(endpoint)),
         protector(protector),
-        zero_copy_protector(zero_copy_protector) {
+        zero_copy_protector(zero_copy_protector),
+        kernel_protects_writes(kernel_protects_writes) {
     this->vtable = vtbl;
     gpr_mu_init(&protector_mu);
     GRPC_CLOSURE_INIT(&on_read, ::on_read, this, grpc_schedule_on_exec_ctx);
@@ -97,7 +98,10 @@ struct secure_endpoint : public grpc_endpoint {
       read_staging_buffer =
           memory_owner.MakeSlice(grpc_core::MemoryRequest(STAGING_BUFFER_SIZE));
       write_staging_buffer =
-          memory_owner.MakeSlice(grpc_core::MemoryRequest(STAGING_BUFFER_SIZE));
+          kernel_protects_writes
+              ? grpc_empty_slice()
+              : memory_owner.MakeSlice(
+                    grpc_core::MemoryRequest(STAGING_BUFFER_SIZE));
     }
     has_posted_reclaimer.store(false, std::memory_order_relaxed);
     min_progress_size = 1;
@@ -120,6 +124,7 @@ struct secure_endpoint : public grpc_endpoint {
   grpc_core::OrphanablePtr<grpc_endpoint> wrapped_ep;
   struct tsi_frame_protector* protector;
   struct tsi_zero_copy_grpc_protector* zero_copy_protector;
+  const bool kernel_protects_writes;
   gpr_mu protector_mu;
   grpc_core::Mutex read_mu;
   grpc_core::Mutex write_mu;
@@ -398,6 +403,11 @@ static void endpoint_write(grpc_endpoint* secure_ep, grpc_slice_buffer* slices,
   tsi_result result = TSI_OK;
   secure_endpoint* ep = reinterpret_cast<secure_endpoint*>(secure_ep);
 
+  if (ep->kernel_protects_writes) {
+    grpc_endpoint_write(ep->wrapped_ep.get(), slices, cb, arg, max_frame_size);
+    return;
+  }
+
   {
     grpc_core::MutexLock l(&ep->write_mu);
     uint8_t* cur = GRPC_SLICE_START_PTR(ep->write_staging_buffer);
@@ -571,8 +581,8 @@ grpc_core::OrphanablePtr<grpc_endpoint> grpc_secure_endpoint_create(
     struct tsi_zero_copy_grpc_protector* zero_copy_protector,
     grpc_core::OrphanablePtr<grpc_endpoint> to_wrap,
     grpc_slice* leftover_slices, const grpc_channel_args* channel_args,
-    size_t leftover_nslices) {
+    size_t leftover_nslices, bool kernel_protects_writes) {
   return grpc_core::MakeOrphanable<secure_endpoint>(
       &vtable, protector, zero_copy_protector, std::move(to_wrap),
-      leftover_slices, channel_args, leftover_nslices);
+      leftover_slices, channel_args, leftover_nslices, kernel_protects_writes);
 }
@@ -30,12 +30,13 @@
 
 // Takes ownership of protector, zero_copy_protector, and to_wrap, and refs
 // leftover_slices. If zero_copy_protector is not NULL, protector will never be
-// used.
+// used. If kernel_protects_writes is true, the write keys have been installed
+// on the socket of to_wrap, and writes are passed to it as they are.
 grpc_core::OrphanablePtr<grpc_endpoint> grpc_secure_endpoint_create(
     struct tsi_frame_protector* protector,
     struct tsi_zero_copy_grpc_protector* zero_copy_protector,
     grpc_core::OrphanablePtr<grpc_endpoint> to_wrap,
     grpc_slice* leftover_slices, const grpc_channel_args* channel_args,
-    size_t leftover_nslices);
+    size_t leftover_nslices, bool kernel_protects_writes = false);
 
 #endif  // GRPC_SRC_CORE_HANDSHAKER_SECURITY_SECURE_ENDPOINT_H
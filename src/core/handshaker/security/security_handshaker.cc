@@ -24,12 +24,15 @@
 #include <grpc/slice.h>
 #include <grpc/slice_buffer.h>
 #include <grpc/support/alloc.h>
+#include <grpc/support/cpu.h>
 #include <grpc/support/port_platform.h>
 #include <limits.h>
 #include <stdint.h>
 #include <string.h>
 
 #include <algorithm>
+#include <atomic>
+#include <deque>
 #include <memory>
 #include <optional>
 #include <string>
@@ -48,6 +51,8 @@
 #include "src/core/handshaker/handshaker_registry.h"
 #include "src/core/handshaker/security/secure_endpoint.h"
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/debug/trace.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/iomgr/endpoint.h"
 #include "src/core/lib/iomgr/error.h"
@@ -71,6 +76,79 @@ namespace grpc_core {
 
 namespace {
 
+// Runs the handshake steps that follow reads from the peer, which is where
+// TLS and ALTS do their public key operations, with at most half of the
+// cores' worth of them running at once, so that a burst of new connections
+// cannot take over every EventEngine thread.  Once the limit is reached,
+// steps are queued, and those of handshakes already under way are run
+// before those that start a handshake: finishing a handshake is what gets
+// a connection serving, and a queued first step has cost its client
+// nothing yet.  Used when the secure_handshake_executor experiment is on.
+class HandshakeExecutor final {
+ public:
+  static HandshakeExecutor& Get() {
+    static HandshakeExecutor* executor = new HandshakeExecutor();
+    return *executor;
+  }
+
+  // Runs fn on event_engine, or queues it to be run once a running step
+  // finishes.
+  void Run(grpc_event_engine::experimental::EventEngine* event_engine,
+           bool starts_handshake, absl::AnyInvocable<void()> fn) {
+    {
+      MutexLock lock(&mu_);
+      if (num_running_ >= max_running_) {
+        (starts_handshake ? new_handshakes_ : continuing_handshakes_)
+            .push_back(std::move(fn));
+        GRPC_TRACE_LOG(handshaker, INFO)
+            << "HandshakeExecutor: " << max_running_
+            << " handshake steps running; queued "
+            << continuing_handshakes_.size() << " continuing and "
+            << new_handshakes_.size() << " new handshake steps";
+        return;
+      }
+      ++num_running_;
+    }
+    event_engine->Run([this, fn = std::move(fn)]() mutable {
+      fn();
+      fn = nullptr;
+      RunQueued();
+    });
+  }
+
+ private:
+  HandshakeExecutor()
+      : max_running_(std::max(1u, gpr_cpu_num_cores() / 2)) {}
+
+  // Runs queued steps on the current thread, which holds one of the
+  // running slots, until there are none left.
+  void RunQueued() {
+    while (true) {
+      absl::AnyInvocable<void()> fn;
+      {
+        MutexLock lock(&mu_);
+        std::deque<absl::AnyInvocable<void()>>* queue =
+            !continuing_handshakes_.empty() ? &continuing_handshakes_
+                                            : &new_handshakes_;
+        if (queue->empty()) {
+          --num_running_;
+          return;
+        }
+        fn = std::move(queue->front());
+        queue->pop_front();
+      }
+      fn();
+    }
+  }
+
+  const size_t max_running_;
+  Mutex mu_;
+  size_t num_running_ ABSL_GUARDED_BY(mu_) = 0;
+  std::deque<absl::AnyInvocable<void()>> continuing_handshakes_
+      ABSL_GUARDED_BY(mu_);
+  std::deque<absl::AnyInvocable<void()>> new_handshakes_ ABSL_GUARDED_BY(mu_);
+};
+
 class SecurityHandshaker : public Handshaker {
  public:
   SecurityHandshaker(tsi_handshaker* handshaker,
@@ -121,12 +199,20 @@ class SecurityHandshaker : public Handshaker {
 
   size_t handshake_buffer_size_;
   unsigned char* handshake_buffer_;
+  // Bytes last passed to the TSI handshaker: either handshake_buffer_ or,
+  // when they arrived in a single slice, handshake_slice_.
+  const unsigned char* handshake_bytes_ = nullptr;
+  Slice handshake_slice_;
   SliceBuffer outgoing_;
   RefCountedPtr<grpc_auth_context> auth_context_;
   tsi_handshaker_result* handshaker_result_ = nullptr;
   size_t max_frame_size_ = 0;
   std::string tsi_handshake_error_;
   grpc_closure* on_peer_checked_ ABSL_GUARDED_BY(mu_) = nullptr;
+  // Whether the TSI handshaker has been invoked, i.e. whether the handshake
+  // is under way.  Read without mu_ by the schedulers, which may run with it
+  // held.
+  std::atomic<bool> handshaker_next_called_{false};
 };
 
 SecurityHandshaker::SecurityHandshaker(tsi_handshaker* handshaker,
@@ -150,10 +236,20 @@ SecurityHandshaker::~SecurityHandshaker() {
 
 size_t SecurityHandshaker::MoveReadBufferIntoHandshakeBuffer() {
   size_t bytes_in_read_buffer = args_->read_buffer.Length();
+  // A read usually lands in one slice; hand that to TSI as is rather than
+  // copying it (and growing handshake_buffer_ to fit).
+  if (args_->read_buffer.Count() == 1) {
+    handshake_slice_ = args_->read_buffer.TakeFirst();
+    handshake_bytes_ = handshake_slice_.data();
+    return bytes_in_read_buffer;
+  }
+  handshake_slice_ = Slice();
+  handshake_bytes_ = handshake_buffer_;
   if (handshake_buffer_size_ < bytes_in_read_buffer) {
     handshake_buffer_ = static_cast<uint8_t*>(
         gpr_realloc(handshake_buffer_, bytes_in_read_buffer));
     handshake_buffer_size_ = bytes_in_read_buffer;
+    handshake_bytes_ = handshake_buffer_;
   }
   size_t offset = 0;
   while (args_->read_buffer.Count() > 0) {
@@ -243,6 +339,22 @@ void SecurityHandshaker::OnPeerCheckedFn(grpc_error_handle error) {
   }
   tsi_zero_copy_grpc_protector* zero_copy_protector = nullptr;
   tsi_frame_protector* protector = nullptr;
+  // The kernel rejects MSG_ZEROCOPY sends on TLS sockets it encrypts in
+  // software, so leave writes to the protector if they are enabled.
+  bool kernel_protects_writes = false;
+  if ((frame_protector_type == TSI_FRAME_PROTECTOR_NORMAL ||
+       frame_protector_type == TSI_FRAME_PROTECTOR_NORMAL_OR_ZERO_COPY) &&
+      IsTlsKernelWriteOffloadEnabled() &&
+      !args_->args.GetBool(GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED).value_or(false)) {
+    const int fd = grpc_endpoint_get_fd(args_->endpoint.get());
+    kernel_protects_writes =
+        fd >= 0 && tsi_handshaker_result_offload_writes_to_kernel(
+                       handshaker_result_, fd) == TSI_OK;
+    // The normal frame protector can be left to only unprotect.
+    if (kernel_protects_writes) {
+      frame_protector_type = TSI_FRAME_PROTECTOR_NORMAL;
+    }
+  }
   switch (frame_protector_type) {
     case TSI_FRAME_PROTECTOR_ZERO_COPY:
       [[fallthrough]];
@@ -282,12 +394,12 @@ void SecurityHandshaker::OnPeerCheckedFn(grpc_error_handle error) {
           reinterpret_cast<const char*>(unused_bytes), unused_bytes_size);
       args_->endpoint = grpc_secure_endpoint_create(
           protector, zero_copy_protector, std::move(args_->endpoint), &slice,
-          args_->args.ToC().get(), 1);
+          args_->args.ToC().get(), 1, kernel_protects_writes);
       CSliceUnref(slice);
     } else {
       args_->endpoint = grpc_secure_endpoint_create(
           protector, zero_copy_protector, std::move(args_->endpoint), nullptr,
-          args_->args.ToC().get(), 0);
+          args_->args.ToC().get(), 0, kernel_protects_writes);
     }
   } else if (unused_bytes_size > 0) {
     // Not wrapping the endpoint, so just pass along unused bytes.
@@ -416,6 +528,7 @@ grpc_error_handle SecurityHandshaker::DoHandshakerNextLocked(
   size_t bytes_to_send_size = 0;
   tsi_handshaker_result* hs_result = nullptr;
   auto self = RefAsSubclass<SecurityHandshaker>();
+  handshaker_next_called_.store(true, std::memory_order_relaxed);
   tsi_result result = tsi_handshaker_next(
       handshaker_, bytes_received, bytes_received_size, &bytes_to_send,
       &bytes_to_send_size, &hs_result, &OnHandshakeNextDoneGrpcWrapper,
@@ -438,14 +551,22 @@ grpc_error_handle SecurityHandshaker::DoHandshakerNextLocked(
 // EventEngine endpoint API.
 void SecurityHandshaker::OnHandshakeDataReceivedFromPeerFnScheduler(
     grpc_error_handle error) {
-  args_->event_engine->Run([self = RefAsSubclass<SecurityHandshaker>(),
-                            error = std::move(error)]() mutable {
+  auto fn = [self = RefAsSubclass<SecurityHandshaker>(),
+             error = std::move(error)]() mutable {
     ApplicationCallbackExecCtx callback_exec_ctx;
     ExecCtx exec_ctx;
     self->OnHandshakeDataReceivedFromPeerFn(std::move(error));
     // Avoid destruction outside of an ExecCtx (since this is non-cancelable).
     self.reset();
-  });
+  };
+  if (IsSecureHandshakeExecutorEnabled()) {
+    HandshakeExecutor::Get().Run(
+        args_->event_engine,
+        !handshaker_next_called_.load(std::memory_order_relaxed),
+        std::move(fn));
+    return;
+  }
+  args_->event_engine->Run(std::move(fn));
 }
 
 void SecurityHandshaker::OnHandshakeDataReceivedFromPeerFn(absl::Status error) {
@@ -458,7 +579,7 @@ void SecurityHandshaker::OnHandshakeDataReceivedFromPeerFn(absl::Status error) {
   // Copy all slices received.
   size_t bytes_received_size = MoveReadBufferIntoHandshakeBuffer();
   // Call TSI handshaker.
-  error = DoHandshakerNextLocked(handshake_buffer_, bytes_received_size);
+  error = DoHandshakerNextLocked(handshake_bytes_, bytes_received_size);
   if (!error.ok()) {
     HandshakeFailedLocked(std::move(error));
   }
@@ -527,7 +648,7 @@ void SecurityHandshaker::DoHandshake(
   on_handshake_done_ = std::move(on_handshake_done);
   size_t bytes_received_size = MoveReadBufferIntoHandshakeBuffer();
   grpc_error_handle error =
-      DoHandshakerNextLocked(handshake_buffer_, bytes_received_size);
+      DoHandshakerNextLocked(handshake_bytes_, bytes_received_size);
   if (!error.ok()) {
     HandshakeFailedLocked(error);
   }
@@ -32,6 +32,7 @@
 #include <string>
 #include <vector>
 
+#include "absl/hash/hash.h"
 #include "absl/log/absl_check.h"
 #include "absl/log/absl_log.h"
 #include "absl/strings/match.h"
@@ -119,6 +120,14 @@ bool ChannelArgs::operator!=(const ChannelArgs& other) const {
   return !(*this == other);
 }
 
+size_t ChannelArgs::Hash() const {
+  size_t hash = 0;
+  args_.ForEach([&hash](const RefCountedStringValue& key, const Value& value) {
+    hash = absl::HashOf(hash, key.as_string_view(), value.Hash());
+  });
+  return hash;
+}
+
 bool ChannelArgs::WantMinimalStack() const {
   return GetBool(GRPC_ARG_MINIMAL_STACK).value_or(false);
 }
@@ -151,6 +160,17 @@ ChannelArgs ChannelArgs::FromC(const grpc_channel_args* args) {
   return result;
 }
 
+size_t ChannelArgs::Value::Hash() const {
+  if (rep_.c_vtable() == &int_vtable_) {
+    return absl::HashOf(0, reinterpret_cast<intptr_t>(rep_.c_pointer()));
+  }
+  if (rep_.c_vtable() == &string_vtable_) {
+    return absl::HashOf(
+        1, static_cast<RefCountedString*>(rep_.c_pointer())->as_string_view());
+  }
+  return absl::HashOf(2);
+}
+
 grpc_arg ChannelArgs::Value::MakeCArg(const char* name) const {
   char* c_name = const_cast<char*>(name);
   if (rep_.c_vtable() == &int_vtable_) {
@@ -371,6 +371,10 @@ class ChannelArgs {
 
     grpc_arg MakeCArg(const char* name) const;
 
+    // Consistent with operator==: pointer values are only equal under their
+    // vtable's cmp, so they all hash alike.
+    size_t Hash() const;
+
     bool operator<(const Value& rhs) const { return rep_ < rhs.rep_; }
     bool operator==(const Value& rhs) const { return rep_ == rhs.rep_; }
     bool operator!=(const Value& rhs) const { return !this->operator==(rhs); }
@@ -551,6 +555,10 @@ class ChannelArgs {
   bool operator<(const ChannelArgs& other) const;
   bool operator==(const ChannelArgs& other) const;
 
+  // Structural hash: equal args hash equally. Walks every arg, so callers that
+  // compare the same args repeatedly (e.g. SubchannelKey) should cache it.
+  size_t Hash() const;
+
   // Helpers for commonly accessed things
 
   bool WantMinimalStack() const;
@@ -69,11 +69,13 @@
 #include "src/core/lib/transport/error_utils.h"
 #include "src/core/lib/transport/metadata_batch.h"
 #include "src/core/lib/transport/transport.h"
+#include "src/core/telemetry/stats.h"
 #include "src/core/util/alloc.h"
 #include "src/core/util/debug_location.h"
 #include "src/core/util/orphanable.h"
 #include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/time.h"
+#include "src/core/util/time_precise.h"
 
 typedef struct connected_channel_channel_data {
   grpc_core::Transport* transport;
@@ -87,6 +89,9 @@ struct callback_state {
 };
 typedef struct connected_channel_call_data {
   grpc_core::CallCombiner* call_combiner;
+  // The creation time of a client call, for client_call_filter_time_us; 0 on
+  // servers, and once its initial metadata has been sent.
+  gpr_cycle_counter client_start_time;
   // Closures used for returning results on the call combiner.
   callback_state on_complete[6];  // Max number of pending batches.
   callback_state recv_initial_metadata_ready;
@@ -144,6 +149,12 @@ static void connected_channel_start_transport_stream_op_batch(
     grpc_call_element* elem, grpc_transport_stream_op_batch* batch) {
   call_data* calld = static_cast<call_data*>(elem->call_data);
   channel_data* chand = static_cast<channel_data*>(elem->channel_data);
+  if (batch->send_initial_metadata && calld->client_start_time != 0) {
+    grpc_core::global_stats().IncrementClientCallFilterTimeUs(
+        gpr_cycle_counter_sub_micros(gpr_get_cycle_counter(),
+                                     calld->client_start_time));
+    calld->client_start_time = 0;
+  }
   if (batch->recv_initial_metadata) {
     callback_state* state = &calld->recv_initial_metadata_ready;
     intercept_callback(
@@ -192,6 +203,8 @@ static grpc_error_handle connected_channel_init_call_elem(
   call_data* calld = static_cast<call_data*>(elem->call_data);
   channel_data* chand = static_cast<channel_data*>(elem->channel_data);
   calld->call_combiner = args->call_combiner;
+  calld->client_start_time =
+      args->server_transport_data == nullptr ? args->start_time : 0;
   chand->transport->filter_stack_transport()->InitStream(
       TRANSPORT_STREAM_FROM_CALL_DATA(calld), &args->call_stack->refcount,
       args->server_transport_data, args->arena);
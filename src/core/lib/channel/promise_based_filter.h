@@ -57,6 +57,7 @@
 #include "src/core/lib/promise/arena_promise.h"
 #include "src/core/lib/promise/cancel_callback.h"
 #include "src/core/lib/promise/context.h"
+#include "src/core/lib/promise/map.h"
 #include "src/core/lib/promise/pipe.h"
 #include "src/core/lib/promise/poll.h"
 #include "src/core/lib/promise/promise.h"
@@ -140,6 +141,15 @@ inline constexpr bool HasAsyncErrorInterceptor(void (T::*)(A...)) {
   return false;
 }
 
+// Promise returning interceptors resolve to one of the types above; the
+// only ones supported resolve to absl::StatusOr<MessageHandle>.
+template <typename Promise, typename T, typename... A,
+          typename = std::enable_if_t<std::is_same_v<
+              absl::StatusOr<MessageHandle>, PromiseResult<Promise>>>>
+inline constexpr bool HasAsyncErrorInterceptor(Promise (T::*)(A...)) {
+  return true;
+}
+
 // For the list case we do two interceptors to avoid amiguities with the single
 // argument forms above.
 template <typename I1, typename I2, typename... Interceptors>
@@ -548,6 +558,27 @@ inline auto InterceptClientToServerMessageHandler(
   };
 }
 
+template <typename Derived, typename Promise,
+          typename = std::enable_if_t<std::is_same_v<
+              absl::StatusOr<MessageHandle>, PromiseResult<Promise>>>>
+inline auto InterceptClientToServerMessageHandler(
+    Promise (Derived::Call::*fn)(MessageHandle, Derived*),
+    FilterCallData<Derived>* call_data, const CallArgs&) {
+  ABSL_DCHECK(fn == &Derived::Call::OnClientToServerMessage);
+  return [call_data](MessageHandle msg) {
+    return Map(call_data->call.OnClientToServerMessage(std::move(msg),
+                                                       call_data->channel),
+               [call_data](absl::StatusOr<MessageHandle> r)
+                   -> std::optional<MessageHandle> {
+                 if (r.ok()) return std::move(*r);
+                 if (call_data->error_latch.is_set()) return std::nullopt;
+                 call_data->error_latch.Set(
+                     ServerMetadataFromStatus(r.status()));
+                 return std::nullopt;
+               });
+  };
+}
+
 template <typename Derived, typename HookFunction>
 inline void InterceptClientToServerMessage(HookFunction hook,
                                            const NoInterceptor*,
@@ -722,6 +753,28 @@ inline void InterceptServerToClientMessage(
       });
 }
 
+template <typename Derived, typename Promise,
+          typename = std::enable_if_t<std::is_same_v<
+              absl::StatusOr<MessageHandle>, PromiseResult<Promise>>>>
+inline void InterceptServerToClientMessage(
+    Promise (Derived::Call::*fn)(MessageHandle, Derived*),
+    FilterCallData<Derived>* call_data, const CallArgs& call_args) {
+  ABSL_DCHECK(fn == &Derived::Call::OnServerToClientMessage);
+  call_args.server_to_client_messages->InterceptAndMap(
+      [call_data](MessageHandle msg) {
+        return Map(call_data->call.OnServerToClientMessage(std::move(msg),
+                                                           call_data->channel),
+                   [call_data](absl::StatusOr<MessageHandle> r)
+                       -> std::optional<MessageHandle> {
+                     if (r.ok()) return std::move(*r);
+                     if (call_data->error_latch.is_set()) return std::nullopt;
+                     call_data->error_latch.Set(
+                         ServerMetadataFromStatus(r.status()));
+                     return std::nullopt;
+                   });
+      });
+}
+
 inline void InterceptFinalize(const NoInterceptor*, void*, void*) {}
 
 template <class Call>
@@ -0,0 +1,90 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/compression/adaptive_compression.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <utility>
+
+#include "src/core/lib/debug/trace.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
+
+namespace grpc_core {
+
+AdaptiveCompression::Action AdaptiveCompression::Method::Next() {
+  const uint64_t n = messages_.fetch_add(1, std::memory_order_relaxed);
+  State state = state_.load(std::memory_order_relaxed);
+  switch (state) {
+    case State::kCompressing:
+      return n % kSampleInterval == 0 ? Action::kCompressAndRecord
+                                      : Action::kCompress;
+    case State::kProbing:
+      return Action::kCompressAndRecord;
+    case State::kSkipping:
+      if (n % kProbeInterval == 0) {
+        state_.compare_exchange_strong(state, State::kProbing,
+                                       std::memory_order_relaxed);
+        return Action::kCompressAndRecord;
+      }
+      global_stats().IncrementCompressionSkippedMessages();
+      return Action::kSkip;
+  }
+  return Action::kCompress;
+}
+
+void AdaptiveCompression::Method::Record(size_t input_bytes,
+                                         size_t output_bytes, int64_t nanos) {
+  MutexLock lock(&mu_);
+  input_bytes_ += input_bytes;
+  output_bytes_ += std::min(output_bytes, input_bytes);
+  nanos_ += nanos;
+  if (++samples_ < kWindow) return;
+  const uint64_t saved = input_bytes_ - output_bytes_;
+  const bool compress =
+      saved * 100 >= input_bytes_ * kMinSavingsPercent &&
+      saved * 1000 >=
+          static_cast<uint64_t>(std::max<int64_t>(nanos_, 0)) *
+              kMinSavedBytesPerMicro;
+  GRPC_TRACE_LOG(compression, INFO)
+      << "AdaptiveCompression[" << this << "]: " << samples_
+      << " messages compressed " << input_bytes_ << " -> " << output_bytes_
+      << " bytes in " << nanos_ << "ns: "
+      << (compress ? "compressing" : "skipping");
+  if (compress != std::exchange(compress_decision_, compress)) {
+    if (compress) {
+      global_stats().IncrementCompressionMethodsEnabled();
+    } else {
+      global_stats().IncrementCompressionMethodsDisabled();
+    }
+  }
+  samples_ = input_bytes_ = output_bytes_ = 0;
+  nanos_ = 0;
+  state_.store(compress ? State::kCompressing : State::kSkipping,
+               std::memory_order_relaxed);
+}
+
+AdaptiveCompression::Method* AdaptiveCompression::GetMethod(
+    absl::string_view method) {
+  MutexLock lock(&mu_);
+  auto it = methods_.find(method);
+  if (it != methods_.end()) return it->second.get();
+  if (methods_.size() >= kMaxMethods) return nullptr;
+  return methods_.emplace(method, std::make_unique<Method>())
+      .first->second.get();
+}
+
+}  // namespace grpc_core
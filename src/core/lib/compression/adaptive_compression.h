@@ -0,0 +1,100 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_COMPRESSION_ADAPTIVE_COMPRESSION_H
+#define GRPC_SRC_CORE_LIB_COMPRESSION_ADAPTIVE_COMPRESSION_H
+
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/strings/string_view.h"
+#include "src/core/util/sync.h"
+
+namespace grpc_core {
+
+// Decides per method whether compressing outgoing messages is worth it.
+//
+// Each method starts out probing: its first kWindow messages are compressed
+// and measured. If those messages saved too little - less than
+// kMinSavingsPercent of their size, or less than kMinSavedBytesPerMicro bytes
+// per microsecond spent compressing - the method stops being compressed.
+// Skipped methods are probed again every kProbeInterval messages, and
+// methods that are being compressed keep being measured on one message in
+// kSampleInterval, so either decision is revisited as payloads change.
+class AdaptiveCompression {
+ public:
+  static constexpr size_t kMaxMethods = 1024;
+  static constexpr uint64_t kWindow = 16;
+  static constexpr uint64_t kSampleInterval = 8;
+  static constexpr uint64_t kProbeInterval = 1024;
+  static constexpr uint64_t kMinSavingsPercent = 10;
+  static constexpr uint64_t kMinSavedBytesPerMicro = 1;
+
+  enum class Action {
+    // Compress without measuring.
+    kCompress,
+    // Compress and report the result to Method::Record().
+    kCompressAndRecord,
+    // Send uncompressed.
+    kSkip,
+  };
+
+  // Decision state for one method.
+  class Method {
+   public:
+    // Returns what to do with the next message of this method.
+    Action Next();
+    // Reports a message that was compressed from `input_bytes` to
+    // `output_bytes` (equal if compression did not help) in `nanos`.
+    void Record(size_t input_bytes, size_t output_bytes, int64_t nanos);
+
+    bool compressing() const {
+      return state_.load(std::memory_order_relaxed) != State::kSkipping;
+    }
+
+   private:
+    enum class State : uint8_t { kCompressing, kProbing, kSkipping };
+
+    std::atomic<State> state_{State::kProbing};
+    std::atomic<uint64_t> messages_{0};
+    Mutex mu_;
+    // Whether the last completed window decided to compress.
+    bool compress_decision_ ABSL_GUARDED_BY(mu_) = true;
+    uint64_t samples_ ABSL_GUARDED_BY(mu_) = 0;
+    uint64_t input_bytes_ ABSL_GUARDED_BY(mu_) = 0;
+    uint64_t output_bytes_ ABSL_GUARDED_BY(mu_) = 0;
+    int64_t nanos_ ABSL_GUARDED_BY(mu_) = 0;
+  };
+
+  // Returns the state for `method`, or nullptr once kMaxMethods methods are
+  // tracked, in which case the caller should always compress.
+  // The result stays valid for the lifetime of this object.
+  Method* GetMethod(absl::string_view method);
+
+ private:
+  Mutex mu_;
+  absl::flat_hash_map<std::string, std::unique_ptr<Method>> methods_
+      ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_COMPRESSION_ADAPTIVE_COMPRESSION_H
@@ -0,0 +1,128 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/compression/compression_dictionary.h"
+
+#include <grpc/support/port_platform.h>
+#include <zlib.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_join.h"
+#include "src/core/util/no_destruct.h"
+
+namespace grpc_core {
+
+namespace {
+uint32_t Adler32(absl::string_view data) {
+  uLong adler = adler32(0L, Z_NULL, 0);
+  // adler32() takes a uInt length: feed very large dictionaries in chunks.
+  while (!data.empty()) {
+    const uInt n = static_cast<uInt>(std::min<size_t>(data.size(), 1u << 30));
+    adler = adler32(adler, reinterpret_cast<const Bytef*>(data.data()), n);
+    data.remove_prefix(n);
+  }
+  return static_cast<uint32_t>(adler);
+}
+}  // namespace
+
+CompressionDictionary::CompressionDictionary(std::string name,
+                                             uint32_t version,
+                                             std::string data)
+    : name_(std::move(name)),
+      version_(version),
+      data_(std::move(data)),
+      deflate_id_(Adler32(data_)) {}
+
+std::string CompressionDictionary::Token() const {
+  return absl::StrCat(name_, ".v", version_);
+}
+
+CompressionDictionaryRegistry& CompressionDictionaryRegistry::Global() {
+  static NoDestruct<CompressionDictionaryRegistry> registry;
+  return *registry;
+}
+
+absl::Status CompressionDictionaryRegistry::Register(std::string name,
+                                                     uint32_t version,
+                                                     std::string data) {
+  if (name.empty()) {
+    return absl::InvalidArgumentError("compression dictionary needs a name");
+  }
+  if (name.find_first_of(",; ") != std::string::npos) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("invalid compression dictionary name: ", name));
+  }
+  if (data.empty()) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("compression dictionary ", name, " is empty"));
+  }
+  auto dictionary = MakeRefCounted<CompressionDictionary>(std::move(name),
+                                                          version,
+                                                          std::move(data));
+  MutexLock lock(&mu_);
+  auto key = std::pair(std::string(dictionary->name()), version);
+  auto it = by_name_.find(key);
+  if (it != by_name_.end()) {
+    if (it->second->data() == dictionary->data()) return absl::OkStatus();
+    return absl::AlreadyExistsError(absl::StrCat(
+        "compression dictionary ", dictionary->Token(),
+        " already registered with different contents"));
+  }
+  auto existing = by_deflate_id_.find(dictionary->deflate_id());
+  if (existing != by_deflate_id_.end()) {
+    return absl::AlreadyExistsError(absl::StrCat(
+        "compression dictionary ", dictionary->Token(), " has the same id as ",
+        existing->second->Token()));
+  }
+  by_deflate_id_.emplace(dictionary->deflate_id(), dictionary);
+  by_name_.emplace(std::move(key), std::move(dictionary));
+  return absl::OkStatus();
+}
+
+RefCountedPtr<CompressionDictionary> CompressionDictionaryRegistry::Find(
+    absl::string_view name, uint32_t version) const {
+  MutexLock lock(&mu_);
+  auto it = by_name_.find(std::pair(std::string(name), version));
+  if (it == by_name_.end()) return nullptr;
+  return it->second;
+}
+
+RefCountedPtr<CompressionDictionary>
+CompressionDictionaryRegistry::FindByDeflateId(uint32_t id) const {
+  MutexLock lock(&mu_);
+  auto it = by_deflate_id_.find(id);
+  if (it == by_deflate_id_.end()) return nullptr;
+  return it->second;
+}
+
+std::string CompressionDictionaryRegistry::AdvertisedTokens() const {
+  MutexLock lock(&mu_);
+  std::vector<std::string> tokens;
+  tokens.reserve(by_name_.size());
+  for (const auto& [key, dictionary] : by_name_) {
+    tokens.push_back(dictionary->Token());
+  }
+  return absl::StrJoin(tokens, ",");
+}
+
+void CompressionDictionaryRegistry::TestOnlyReset() {
+  MutexLock lock(&mu_);
+  by_name_.clear();
+  by_deflate_id_.clear();
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,93 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_COMPRESSION_COMPRESSION_DICTIONARY_H
+#define GRPC_SRC_CORE_LIB_COMPRESSION_COMPRESSION_DICTIONARY_H
+
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+
+#include <map>
+#include <string>
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/sync.h"
+
+namespace grpc_core {
+
+// A pre-trained dictionary, distributed to both peers out of band, that lets
+// small messages (a few hundred bytes) compress usefully with deflate.
+//
+// Dictionaries are identified on the wire by zlib's own DICTID: the adler32
+// of the dictionary bytes, which deflate writes into the stream header. A
+// receiver that has the same dictionary registered decodes such messages
+// transparently; one that does not fails to decompress them, so senders must
+// only use a dictionary the peer has advertised (see Token()).
+class CompressionDictionary final : public RefCounted<CompressionDictionary> {
+ public:
+  CompressionDictionary(std::string name, uint32_t version, std::string data);
+
+  absl::string_view name() const { return name_; }
+  uint32_t version() const { return version_; }
+  absl::string_view data() const { return data_; }
+  // zlib DICTID of data().
+  uint32_t deflate_id() const { return deflate_id_; }
+  // "<name>.v<version>": how this dictionary is named when advertised.
+  std::string Token() const;
+
+ private:
+  const std::string name_;
+  const uint32_t version_;
+  const std::string data_;
+  const uint32_t deflate_id_;
+};
+
+// Process-wide set of known dictionaries.
+class CompressionDictionaryRegistry {
+ public:
+  static CompressionDictionaryRegistry& Global();
+
+  // Adds a dictionary. Registering the same (name, version) twice with
+  // identical contents is a no-op; different contents, or a DICTID that
+  // collides with another registered dictionary, are errors.
+  absl::Status Register(std::string name, uint32_t version, std::string data);
+
+  RefCountedPtr<CompressionDictionary> Find(absl::string_view name,
+                                            uint32_t version) const;
+  RefCountedPtr<CompressionDictionary> FindByDeflateId(uint32_t id) const;
+
+  // Comma separated tokens for every registered dictionary, sorted by name
+  // and version, suitable for advertising to peers.
+  std::string AdvertisedTokens() const;
+
+  void TestOnlyReset();
+
+ private:
+  mutable Mutex mu_;
+  std::map<std::pair<std::string, uint32_t>,
+           RefCountedPtr<CompressionDictionary>>
+      by_name_ ABSL_GUARDED_BY(mu_);
+  absl::flat_hash_map<uint32_t, RefCountedPtr<CompressionDictionary>>
+      by_deflate_id_ ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_COMPRESSION_COMPRESSION_DICTIONARY_H
@@ -0,0 +1,99 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/compression/compression_engine.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <utility>
+
+#include "absl/log/check.h"
+#include "src/core/util/no_destruct.h"
+
+namespace grpc_core {
+
+CompressionEngineRegistry& CompressionEngineRegistry::Global() {
+  static NoDestruct<CompressionEngineRegistry> registry;
+  return *registry;
+}
+
+void CompressionEngineRegistry::Register(
+    std::shared_ptr<CompressionEngine> engine) {
+  CHECK(engine != nullptr);
+  MutexLock lock(&mu_);
+  engines_.insert(engines_.begin(), std::move(engine));
+  has_engines_.store(true, std::memory_order_relaxed);
+}
+
+bool CompressionEngineRegistry::Unregister(const CompressionEngine* engine) {
+  MutexLock lock(&mu_);
+  auto it = std::find_if(
+      engines_.begin(), engines_.end(),
+      [engine](const std::shared_ptr<CompressionEngine>& registered) {
+        return registered.get() == engine;
+      });
+  if (it == engines_.end()) return false;
+  engines_.erase(it);
+  has_engines_.store(!engines_.empty(), std::memory_order_relaxed);
+  return true;
+}
+
+std::shared_ptr<CompressionEngine> CompressionEngineRegistry::Find(
+    CompressionEngine::Direction direction,
+    grpc_compression_algorithm algorithm, size_t length) const {
+  if (!has_engines_.load(std::memory_order_relaxed)) return nullptr;
+  MutexLock lock(&mu_);
+  for (const auto& engine : engines_) {
+    if (engine->Accepts(direction, algorithm, length)) return engine;
+  }
+  return nullptr;
+}
+
+RefCountedPtr<CompressionEngineOperation> CompressionEngineOperation::Start(
+    std::shared_ptr<CompressionEngine> engine,
+    CompressionEngine::Direction direction,
+    grpc_compression_algorithm algorithm, int level, SliceBuffer input) {
+  CompressionEngine* engine_ptr = engine.get();
+  auto operation = MakeRefCounted<CompressionEngineOperation>(
+      std::move(engine), std::move(input));
+  engine_ptr->Run(direction, algorithm, level,
+                  operation->input_.c_slice_buffer(),
+                  operation->output_.c_slice_buffer(),
+                  [operation = operation->Ref()](bool ok) {
+                    operation->Done(ok);
+                  });
+  return operation;
+}
+
+Poll<bool> CompressionEngineOperation::PollDone() {
+  MutexLock lock(&mu_);
+  if (result_.has_value()) return *result_;
+  waker_ = GetContext<Activity>()->MakeOwningWaker();
+  return Pending{};
+}
+
+void CompressionEngineOperation::Done(bool ok) {
+  Waker waker;
+  {
+    MutexLock lock(&mu_);
+    CHECK(!result_.has_value());
+    if (!ok) output_.Clear();
+    result_ = ok;
+    waker = std::move(waker_);
+  }
+  waker.Wakeup();
+}
+
+}  // namespace grpc_core
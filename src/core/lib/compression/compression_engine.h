@@ -0,0 +1,135 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_COMPRESSION_COMPRESSION_ENGINE_H
+#define GRPC_SRC_CORE_LIB_COMPRESSION_COMPRESSION_ENGINE_H
+
+#include <grpc/impl/compression_types.h>
+#include <grpc/slice_buffer.h>
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/functional/any_invocable.h"
+#include "absl/strings/string_view.h"
+#include "src/core/lib/promise/activity.h"
+#include "src/core/lib/promise/poll.h"
+#include "src/core/lib/slice/slice_buffer.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/sync.h"
+
+namespace grpc_core {
+
+// An implementation of message compression that runs outside gRPC's own
+// software path, typically on a hardware accelerator (QAT, IAA...).
+// Engines work asynchronously: the calling party is suspended, not blocked,
+// until the engine reports completion.
+// The output must be what the software path would decode: an engine only
+// changes where the work happens, never the wire format.
+class CompressionEngine {
+ public:
+  enum class Direction { kCompress, kDecompress };
+
+  virtual ~CompressionEngine() = default;
+
+  virtual absl::string_view name() const = 0;
+
+  // Returns true if the engine takes a message of `length` bytes.
+  // Called for every message, so it must be cheap.
+  virtual bool Accepts(Direction direction,
+                       grpc_compression_algorithm algorithm,
+                       size_t length) const = 0;
+
+  // Starts compressing or decompressing input into output, and calls
+  // on_done exactly once, inline or from any thread, when finished.
+  // On success output holds the result; on failure the engine must leave
+  // output empty, and the caller sends the message uncompressed or fails
+  // it as gRPC's software path would. input and output stay valid and
+  // untouched by the caller until on_done has been called.
+  // level is as for grpc_msg_compress_with_level.
+  virtual void Run(Direction direction, grpc_compression_algorithm algorithm,
+                   int level, grpc_slice_buffer* input,
+                   grpc_slice_buffer* output,
+                   absl::AnyInvocable<void(bool ok)> on_done) = 0;
+};
+
+// Engines that messages may be handed to, in addition to the built in
+// software path that is used when none of them accepts a message.
+class CompressionEngineRegistry {
+ public:
+  static CompressionEngineRegistry& Global();
+
+  // Engines registered later are asked first.
+  void Register(std::shared_ptr<CompressionEngine> engine);
+  // Returns false if engine was not registered.
+  bool Unregister(const CompressionEngine* engine);
+
+  // Returns the engine to use for a message, or nullptr for the software
+  // path. Cheap when no engine is registered.
+  std::shared_ptr<CompressionEngine> Find(
+      CompressionEngine::Direction direction,
+      grpc_compression_algorithm algorithm, size_t length) const;
+
+ private:
+  std::atomic<bool> has_engines_{false};
+  mutable Mutex mu_;
+  std::vector<std::shared_ptr<CompressionEngine>> engines_
+      ABSL_GUARDED_BY(mu_);
+};
+
+// One message payload handed to a CompressionEngine, and the wait for its
+// result from within a promise.
+// The operation owns both buffers, so a call that goes away mid-operation
+// leaves the engine with valid memory until it completes.
+class CompressionEngineOperation final
+    : public RefCounted<CompressionEngineOperation> {
+ public:
+  // Hands input to engine.
+  static RefCountedPtr<CompressionEngineOperation> Start(
+      std::shared_ptr<CompressionEngine> engine,
+      CompressionEngine::Direction direction,
+      grpc_compression_algorithm algorithm, int level, SliceBuffer input);
+
+  explicit CompressionEngineOperation(
+      std::shared_ptr<CompressionEngine> engine, SliceBuffer input)
+      : engine_(std::move(engine)), input_(std::move(input)) {}
+
+  // Pending until the engine is done, then whether it succeeded.
+  // Must be polled from an activity, which is woken on completion.
+  Poll<bool> PollDone();
+
+  // Once PollDone() is ready, the untouched input and the engine's output.
+  SliceBuffer& input() { return input_; }
+  SliceBuffer& output() { return output_; }
+
+ private:
+  void Done(bool ok);
+
+  const std::shared_ptr<CompressionEngine> engine_;
+  SliceBuffer input_;
+  SliceBuffer output_;
+  Mutex mu_;
+  std::optional<bool> result_ ABSL_GUARDED_BY(mu_);
+  Waker waker_ ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_COMPRESSION_COMPRESSION_ENGINE_H
@@ -45,12 +45,32 @@ const char* CompressionAlgorithmAsString(grpc_compression_algorithm algorithm) {
       return "deflate";
     case GRPC_COMPRESS_GZIP:
       return "gzip";
+    case GRPC_COMPRESS_ZSTD:
+      return "zstd";
     case GRPC_COMPRESS_ALGORITHMS_COUNT:
     default:
       return nullptr;
   }
 }
 
+bool IsCompressionAlgorithmSupported(grpc_compression_algorithm algorithm) {
+  switch (algorithm) {
+    case GRPC_COMPRESS_NONE:
+    case GRPC_COMPRESS_DEFLATE:
+    case GRPC_COMPRESS_GZIP:
+      return true;
+    case GRPC_COMPRESS_ZSTD:
+#ifdef GRPC_HAVE_ZSTD
+      return true;
+#else
+      return false;
+#endif
+    case GRPC_COMPRESS_ALGORITHMS_COUNT:
+    default:
+      return false;
+  }
+}
+
 namespace {
 class CommaSeparatedLists {
  public:
@@ -85,7 +105,7 @@ class CommaSeparatedLists {
  private:
   static constexpr size_t kNumLists = 1 << GRPC_COMPRESS_ALGORITHMS_COUNT;
   // Experimentally determined (tweak things until it runs).
-  static constexpr size_t kTextBufferSize = 86;
+  static constexpr size_t kTextBufferSize = 218;
   absl::string_view lists_[kNumLists];
   char text_buffer_[kTextBufferSize];
 };
@@ -101,6 +121,8 @@ std::optional<grpc_compression_algorithm> ParseCompressionAlgorithm(
     return GRPC_COMPRESS_DEFLATE;
   } else if (algorithm == "gzip") {
     return GRPC_COMPRESS_GZIP;
+  } else if (algorithm == "zstd") {
+    return GRPC_COMPRESS_ZSTD;
   } else {
     return std::nullopt;
   }
@@ -124,6 +146,8 @@ CompressionAlgorithmSet::CompressionAlgorithmForLevel(
   // compression.
   // This is simplistic and we will probably want to introduce other dimensions
   // in the future (cpu/memory cost, etc).
+  // zstd is deliberately left out of the ranking: it has to be requested
+  // explicitly so that enabling it never changes level-based selection.
   absl::InlinedVector<grpc_compression_algorithm,
                       GRPC_COMPRESS_ALGORITHMS_COUNT>
       algos;
@@ -166,9 +190,21 @@ CompressionAlgorithmSet CompressionAlgorithmSet::FromChannelArgs(
   CompressionAlgorithmSet set;
   static const uint32_t kEverything =
       (1u << GRPC_COMPRESS_ALGORITHMS_COUNT) - 1;
+  // Never advertise algorithms this build cannot decompress.
   return CompressionAlgorithmSet::FromUint32(
       args.GetInt(GRPC_COMPRESSION_CHANNEL_ENABLED_ALGORITHMS_BITSET)
-          .value_or(kEverything));
+          .value_or(kEverything) &
+      SupportedCompressionAlgorithms().ToLegacyBitmask());
+}
+
+CompressionAlgorithmSet
+CompressionAlgorithmSet::SupportedCompressionAlgorithms() {
+  CompressionAlgorithmSet set;
+  for (size_t i = 0; i < GRPC_COMPRESS_ALGORITHMS_COUNT; i++) {
+    auto algorithm = static_cast<grpc_compression_algorithm>(i);
+    if (IsCompressionAlgorithmSupported(algorithm)) set.Set(algorithm);
+  }
+  return set;
 }
 
 CompressionAlgorithmSet::CompressionAlgorithmSet() = default;
@@ -40,6 +40,9 @@ std::optional<grpc_compression_algorithm> ParseCompressionAlgorithm(
 // Convert a compression algorithm to a string. Returns nullptr if a name is not
 // known.
 const char* CompressionAlgorithmAsString(grpc_compression_algorithm algorithm);
+// Returns true if this build of gRPC is able to compress and decompress with
+// algorithm (zstd, for example, is only available with GRPC_HAVE_ZSTD).
+bool IsCompressionAlgorithmSupported(grpc_compression_algorithm algorithm);
 // Retrieve the default compression algorithm from channel args, return nullopt
 // if not found.
 std::optional<grpc_compression_algorithm>
@@ -51,10 +54,13 @@ class CompressionAlgorithmSet {
   // Construct from a uint32_t bitmask - bit 0 => algorithm 0, bit 1 =>
   // algorithm 1, etc.
   static CompressionAlgorithmSet FromUint32(uint32_t value);
-  // Locate in channel args and construct from the found value.
+  // Locate in channel args and construct from the found value. Algorithms
+  // that are not supported by this build are dropped.
   static CompressionAlgorithmSet FromChannelArgs(const ChannelArgs& args);
   // Parse a string of comma-separated compression algorithms.
   static CompressionAlgorithmSet FromString(absl::string_view str);
+  // All algorithms supported by this build.
+  static CompressionAlgorithmSet SupportedCompressionAlgorithms();
   // Construct an empty set.
   CompressionAlgorithmSet();
   // Construct from a std::initializer_list of grpc_compression_algorithm
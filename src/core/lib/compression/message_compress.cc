@@ -20,20 +20,38 @@
 
 #include <grpc/slice_buffer.h>
 #include <grpc/support/alloc.h>
+#include <grpc/support/cpu.h>
 #include <grpc/support/port_platform.h>
 #include <string.h>
 #include <zconf.h>
 #include <zlib.h>
 
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#ifdef GRPC_HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+#include "absl/functional/function_ref.h"
 #include "absl/log/absl_check.h"
 #include "absl/log/absl_log.h"
+#include "src/core/lib/compression/compression_dictionary.h"
 #include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_buffer.h"
+#include "src/core/util/sync.h"
 
 #define OUTPUT_BLOCK_SIZE 1024
 
+// Runs all of input through flate(), flushing with last_flush after the
+// final slice. Only Z_FINISH requires the stream to end.
 static int zlib_body(z_stream* zs, grpc_slice_buffer* input,
                      grpc_slice_buffer* output,
-                     int (*flate)(z_stream* zs, int flush)) {
+                     int (*flate)(z_stream* zs, int flush),
+                     int last_flush = Z_FINISH) {
   int r = Z_STREAM_END;  // Do not fail on an empty input.
   int flush;
   size_t i;
@@ -45,7 +63,7 @@ static int zlib_body(z_stream* zs, grpc_slice_buffer* input,
   zs->next_out = GRPC_SLICE_START_PTR(outbuf);
   flush = Z_NO_FLUSH;
   for (i = 0; i < input->count; i++) {
-    if (i == input->count - 1) flush = Z_FINISH;
+    if (i == input->count - 1) flush = last_flush;
     ABSL_CHECK(GRPC_SLICE_LENGTH(input->slices[i]) <= uint_max);
     zs->avail_in = static_cast<uInt> GRPC_SLICE_LENGTH(input->slices[i]);
     zs->next_in = GRPC_SLICE_START_PTR(input->slices[i]);
@@ -68,7 +86,7 @@ static int zlib_body(z_stream* zs, grpc_slice_buffer* input,
       goto error;
     }
   }
-  if (r != Z_STREAM_END) {
+  if (last_flush == Z_FINISH && r != Z_STREAM_END) {
     ABSL_VLOG(2) << "zlib: Data error";
     goto error;
   }
@@ -84,6 +102,25 @@ error:
   return 0;
 }
 
+// inflate() that resolves preset dictionaries (announced by DICTID in the
+// stream header) from the global CompressionDictionaryRegistry.
+static int inflate_with_dictionary(z_stream* zs, int flush) {
+  int r = inflate(zs, flush);
+  if (r != Z_NEED_DICT) return r;
+  auto dictionary =
+      grpc_core::CompressionDictionaryRegistry::Global().FindByDeflateId(
+          static_cast<uint32_t>(zs->adler));
+  if (dictionary == nullptr) {
+    ABSL_VLOG(2) << "zlib: unknown dictionary " << zs->adler;
+    return Z_DATA_ERROR;
+  }
+  r = inflateSetDictionary(
+      zs, reinterpret_cast<const Bytef*>(dictionary->data().data()),
+      static_cast<uInt>(dictionary->data().size()));
+  if (r != Z_OK) return r;
+  return inflate(zs, flush);
+}
+
 static void* zalloc_gpr(void* /*opaque*/, unsigned int items,
                         unsigned int size) {
   return gpr_malloc(items * size);
@@ -91,54 +128,122 @@ static void* zalloc_gpr(void* /*opaque*/, unsigned int items,
 
 static void zfree_gpr(void* /*opaque*/, void* address) { gpr_free(address); }
 
-static int zlib_compress(grpc_slice_buffer* input, grpc_slice_buffer* output,
-                         int gzip) {
-  z_stream zs;
-  int r;
-  size_t i;
+static void reset_output(grpc_slice_buffer* output, size_t count_before,
+                         size_t length_before) {
+  for (size_t i = count_before; i < output->count; i++) {
+    grpc_core::CSliceUnref(output->slices[i]);
+  }
+  output->count = count_before;
+  output->length = length_before;
+}
+
+static int zlib_compress(z_stream* zs, grpc_slice_buffer* input,
+                         grpc_slice_buffer* output) {
   size_t count_before = output->count;
   size_t length_before = output->length;
-  memset(&zs, 0, sizeof(zs));
-  zs.zalloc = zalloc_gpr;
-  zs.zfree = zfree_gpr;
-  r = deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 | (gzip ? 16 : 0),
-                   8, Z_DEFAULT_STRATEGY);
-  ABSL_CHECK(r == Z_OK);
-  r = zlib_body(&zs, input, output, deflate) && output->length < input->length;
-  if (!r) {
-    for (i = count_before; i < output->count; i++) {
-      grpc_core::CSliceUnref(output->slices[i]);
+  int r = zlib_body(zs, input, output, deflate) &&
+          output->length - length_before < input->length;
+  if (!r) reset_output(output, count_before, length_before);
+  return r;
+}
+
+static int zlib_decompress(z_stream* zs, grpc_slice_buffer* input,
+                           grpc_slice_buffer* output) {
+  size_t count_before = output->count;
+  size_t length_before = output->length;
+  int r = zlib_body(zs, input, output, inflate_with_dictionary);
+  if (!r) reset_output(output, count_before, length_before);
+  return r;
+}
+
+#ifdef GRPC_HAVE_ZSTD
+static void next_zstd_outbuf(grpc_slice_buffer* output, grpc_slice* outbuf,
+                             ZSTD_outBuffer* out) {
+  grpc_slice_buffer_add_indexed(output, *outbuf);
+  *outbuf = GRPC_SLICE_MALLOC(OUTPUT_BLOCK_SIZE);
+  *out = {GRPC_SLICE_START_PTR(*outbuf), GRPC_SLICE_LENGTH(*outbuf), 0};
+}
+
+// Compresses input into a single frame, whether or not that is smaller.
+static int zstd_compress_frame(ZSTD_CCtx* cctx, grpc_slice_buffer* input,
+                               grpc_slice_buffer* output) {
+  size_t count_before = output->count;
+  size_t length_before = output->length;
+  ZSTD_CCtx_setPledgedSrcSize(cctx, input->length);
+  grpc_slice outbuf = GRPC_SLICE_MALLOC(OUTPUT_BLOCK_SIZE);
+  ZSTD_outBuffer out = {GRPC_SLICE_START_PTR(outbuf), GRPC_SLICE_LENGTH(outbuf),
+                        0};
+  int r = 1;
+  for (size_t i = 0; r && i < input->count; i++) {
+    const bool last = i == input->count - 1;
+    ZSTD_inBuffer in = {GRPC_SLICE_START_PTR(input->slices[i]),
+                        GRPC_SLICE_LENGTH(input->slices[i]), 0};
+    for (;;) {
+      if (out.pos == out.size) next_zstd_outbuf(output, &outbuf, &out);
+      size_t remaining = ZSTD_compressStream2(
+          cctx, &out, &in, last ? ZSTD_e_end : ZSTD_e_continue);
+      if (ZSTD_isError(remaining)) {
+        ABSL_VLOG(2) << "zstd error: " << ZSTD_getErrorName(remaining);
+        r = 0;
+        break;
+      }
+      // For the final slice keep going until the frame is fully flushed.
+      if (last ? remaining == 0 : in.pos == in.size) break;
     }
-    output->count = count_before;
-    output->length = length_before;
   }
-  deflateEnd(&zs);
+  outbuf.data.refcounted.length = out.pos;
+  grpc_slice_buffer_add_indexed(output, outbuf);
+  if (!r) reset_output(output, count_before, length_before);
   return r;
 }
 
-static int zlib_decompress(grpc_slice_buffer* input, grpc_slice_buffer* output,
-                           int gzip) {
-  z_stream zs;
-  int r;
-  size_t i;
+static int zstd_compress(ZSTD_CCtx* cctx, grpc_slice_buffer* input,
+                         grpc_slice_buffer* output) {
   size_t count_before = output->count;
   size_t length_before = output->length;
-  memset(&zs, 0, sizeof(zs));
-  zs.zalloc = zalloc_gpr;
-  zs.zfree = zfree_gpr;
-  r = inflateInit2(&zs, 15 | (gzip ? 16 : 0));
-  ABSL_CHECK(r == Z_OK);
-  r = zlib_body(&zs, input, output, inflate);
-  if (!r) {
-    for (i = count_before; i < output->count; i++) {
-      grpc_core::CSliceUnref(output->slices[i]);
+  int r = zstd_compress_frame(cctx, input, output) &&
+          output->length - length_before < input->length;
+  if (!r) reset_output(output, count_before, length_before);
+  return r;
+}
+
+static int zstd_decompress(ZSTD_DCtx* dctx, grpc_slice_buffer* input,
+                           grpc_slice_buffer* output) {
+  size_t count_before = output->count;
+  size_t length_before = output->length;
+  grpc_slice outbuf = GRPC_SLICE_MALLOC(OUTPUT_BLOCK_SIZE);
+  ZSTD_outBuffer out = {GRPC_SLICE_START_PTR(outbuf), GRPC_SLICE_LENGTH(outbuf),
+                        0};
+  bool frame_done = false;
+  int r = 1;
+  for (size_t i = 0; r && i < input->count; i++) {
+    ZSTD_inBuffer in = {GRPC_SLICE_START_PTR(input->slices[i]),
+                        GRPC_SLICE_LENGTH(input->slices[i]), 0};
+    for (;;) {
+      // A partially filled output buffer means zstd flushed all it could.
+      // Input left after a finished frame starts the next one: a zstd stream
+      // may be a sequence of frames.
+      if (in.pos == in.size && (frame_done || out.pos < out.size)) break;
+      if (out.pos == out.size) next_zstd_outbuf(output, &outbuf, &out);
+      size_t hint = ZSTD_decompressStream(dctx, &out, &in);
+      if (ZSTD_isError(hint)) {
+        ABSL_VLOG(2) << "zstd error: " << ZSTD_getErrorName(hint);
+        r = 0;
+        break;
+      }
+      frame_done = hint == 0;
     }
-    output->count = count_before;
-    output->length = length_before;
   }
-  inflateEnd(&zs);
+  if (r && input->length != 0 && !frame_done) {
+    ABSL_VLOG(2) << "zstd: Data error";
+    r = 0;
+  }
+  outbuf.data.refcounted.length = out.pos;
+  grpc_slice_buffer_add_indexed(output, outbuf);
+  if (!r) reset_output(output, count_before, length_before);
   return r;
 }
+#endif  // GRPC_HAVE_ZSTD
 
 static int copy(grpc_slice_buffer* input, grpc_slice_buffer* output) {
   size_t i;
@@ -148,17 +253,125 @@ static int copy(grpc_slice_buffer* input, grpc_slice_buffer* output) {
   return 1;
 }
 
-static int compress_inner(grpc_compression_algorithm algorithm,
-                          grpc_slice_buffer* input, grpc_slice_buffer* output) {
+namespace grpc_core {
+
+// Lazily created per-algorithm state. A context that is already initialized
+// for the right variant is reset rather than torn down between messages.
+struct MessageCompressor::Contexts {
+  ~Contexts() {
+    if (deflate_window_bits != 0) deflateEnd(&deflater);
+    if (inflate_window_bits != 0) inflateEnd(&inflater);
+#ifdef GRPC_HAVE_ZSTD
+    ZSTD_freeCCtx(zstd_compressor);
+    ZSTD_freeDCtx(zstd_decompressor);
+#endif
+  }
+
+  z_stream* Deflater(int gzip) {
+    const int window_bits = 15 | (gzip ? 16 : 0);
+    if (deflate_window_bits == window_bits) {
+      ABSL_CHECK_EQ(deflateReset(&deflater), Z_OK);
+      return &deflater;
+    }
+    if (deflate_window_bits != 0) deflateEnd(&deflater);
+    memset(&deflater, 0, sizeof(deflater));
+    deflater.zalloc = zalloc_gpr;
+    deflater.zfree = zfree_gpr;
+    int r = deflateInit2(&deflater, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
+                         window_bits, 8, Z_DEFAULT_STRATEGY);
+    ABSL_CHECK(r == Z_OK);
+    deflate_window_bits = window_bits;
+    return &deflater;
+  }
+
+  z_stream* Inflater(int gzip) {
+    const int window_bits = 15 | (gzip ? 16 : 0);
+    if (inflate_window_bits == window_bits) {
+      ABSL_CHECK_EQ(inflateReset(&inflater), Z_OK);
+      return &inflater;
+    }
+    if (inflate_window_bits != 0) inflateEnd(&inflater);
+    memset(&inflater, 0, sizeof(inflater));
+    inflater.zalloc = zalloc_gpr;
+    inflater.zfree = zfree_gpr;
+    int r = inflateInit2(&inflater, window_bits);
+    ABSL_CHECK(r == Z_OK);
+    inflate_window_bits = window_bits;
+    return &inflater;
+  }
+
+#ifdef GRPC_HAVE_ZSTD
+  ZSTD_CCtx* ZstdCompressor(int level) {
+    if (zstd_compressor == nullptr) {
+      zstd_compressor = ZSTD_createCCtx();
+      ABSL_CHECK_NE(zstd_compressor, nullptr);
+    } else {
+      ZSTD_CCtx_reset(zstd_compressor, ZSTD_reset_session_only);
+    }
+    ZSTD_CCtx_setParameter(zstd_compressor, ZSTD_c_compressionLevel, level);
+    return zstd_compressor;
+  }
+
+  ZSTD_DCtx* ZstdDecompressor() {
+    if (zstd_decompressor == nullptr) {
+      zstd_decompressor = ZSTD_createDCtx();
+      ABSL_CHECK_NE(zstd_decompressor, nullptr);
+    } else {
+      ZSTD_DCtx_reset(zstd_decompressor, ZSTD_reset_session_only);
+    }
+    return zstd_decompressor;
+  }
+#endif
+
+  // Zero means the stream has not been initialized.
+  int deflate_window_bits = 0;
+  int inflate_window_bits = 0;
+  z_stream deflater;
+  z_stream inflater;
+#ifdef GRPC_HAVE_ZSTD
+  ZSTD_CCtx* zstd_compressor = nullptr;
+  ZSTD_DCtx* zstd_decompressor = nullptr;
+#endif
+};
+
+MessageCompressor::MessageCompressor() = default;
+MessageCompressor::~MessageCompressor() = default;
+
+MessageCompressor::Contexts* MessageCompressor::contexts() {
+  if (contexts_ == nullptr) contexts_ = std::make_unique<Contexts>();
+  return contexts_.get();
+}
+
+int MessageCompressor::CompressInner(grpc_compression_algorithm algorithm,
+                                     int level, grpc_slice_buffer* input,
+                                     grpc_slice_buffer* output,
+                                     const CompressionDictionary* dictionary) {
   switch (algorithm) {
     case GRPC_COMPRESS_NONE:
       // the fallback path always needs to be send uncompressed: we simply
       // rely on that here
       return 0;
-    case GRPC_COMPRESS_DEFLATE:
-      return zlib_compress(input, output, 0);
+    case GRPC_COMPRESS_DEFLATE: {
+      z_stream* zs = contexts()->Deflater(0);
+      // Only the zlib format can announce a preset dictionary; gzip cannot.
+      if (dictionary != nullptr) {
+        int r = deflateSetDictionary(
+            zs, reinterpret_cast<const Bytef*>(dictionary->data().data()),
+            static_cast<uInt>(dictionary->data().size()));
+        ABSL_CHECK(r == Z_OK);
+      }
+      return zlib_compress(zs, input, output);
+    }
     case GRPC_COMPRESS_GZIP:
-      return zlib_compress(input, output, 1);
+      return zlib_compress(contexts()->Deflater(1), input, output);
+    case GRPC_COMPRESS_ZSTD:
+#ifdef GRPC_HAVE_ZSTD
+      return zstd_compress(contexts()->ZstdCompressor(level), input, output);
+#else
+      // Not built in: fall back to sending uncompressed.
+      (void)level;
+      return 0;
+#endif
     case GRPC_COMPRESS_ALGORITHMS_COUNT:
       break;
   }
@@ -166,27 +379,366 @@ static int compress_inner(grpc_compression_algorithm algorithm,
   return 0;
 }
 
-int grpc_msg_compress(grpc_compression_algorithm algorithm,
-                      grpc_slice_buffer* input, grpc_slice_buffer* output) {
-  if (!compress_inner(algorithm, input, output)) {
+int MessageCompressor::Compress(grpc_compression_algorithm algorithm,
+                                int level, grpc_slice_buffer* input,
+                                grpc_slice_buffer* output,
+                                const CompressionDictionary* dictionary) {
+  if (!CompressInner(algorithm, level, input, output, dictionary)) {
     copy(input, output);
     return 0;
   }
   return 1;
 }
 
-int grpc_msg_decompress(grpc_compression_algorithm algorithm,
-                        grpc_slice_buffer* input, grpc_slice_buffer* output) {
+int MessageCompressor::Decompress(grpc_compression_algorithm algorithm,
+                                  grpc_slice_buffer* input,
+                                  grpc_slice_buffer* output) {
   switch (algorithm) {
     case GRPC_COMPRESS_NONE:
       return copy(input, output);
     case GRPC_COMPRESS_DEFLATE:
-      return zlib_decompress(input, output, 0);
+      return zlib_decompress(contexts()->Inflater(0), input, output);
     case GRPC_COMPRESS_GZIP:
-      return zlib_decompress(input, output, 1);
+      return zlib_decompress(contexts()->Inflater(1), input, output);
+    case GRPC_COMPRESS_ZSTD:
+#ifdef GRPC_HAVE_ZSTD
+      return zstd_decompress(contexts()->ZstdDecompressor(), input, output);
+#else
+      ABSL_LOG(ERROR) << "zstd decompression requested but not built in";
+      return 0;
+#endif
     case GRPC_COMPRESS_ALGORITHMS_COUNT:
       break;
   }
   ABSL_LOG(ERROR) << "invalid compression algorithm " << algorithm;
   return 0;
 }
+
+namespace {
+
+using grpc_event_engine::experimental::EventEngine;
+
+// Runs fn(0) ... fn(n - 1) on the calling thread and on up to one EventEngine
+// thread per other core, returning once every call has finished.
+// The caller takes items itself rather than waiting for EventEngine threads to
+// become free, so a busy pool only costs parallelism.
+void ParallelFor(EventEngine* event_engine, size_t n,
+                 absl::FunctionRef<void(size_t)> fn) {
+  struct State {
+    State(size_t n, absl::FunctionRef<void(size_t)> fn) : n(n), fn(fn) {}
+
+    void Work() {
+      for (size_t i; (i = next.fetch_add(1, std::memory_order_relaxed)) < n;) {
+        fn(i);
+        MutexLock lock(&mu);
+        if (++done == n) cv.SignalAll();
+      }
+    }
+
+    const size_t n;
+    // Only called for items taken before ParallelFor returns.
+    const absl::FunctionRef<void(size_t)> fn;
+    std::atomic<size_t> next{0};
+    Mutex mu;
+    CondVar cv;
+    size_t done ABSL_GUARDED_BY(mu) = 0;
+  };
+  auto state = std::make_shared<State>(n, fn);
+  const size_t helpers =
+      n == 0 ? 0 : std::min<size_t>(n, gpr_cpu_num_cores()) - 1;
+  for (size_t i = 0; i < helpers; ++i) {
+    event_engine->Run([state]() { state->Work(); });
+  }
+  state->Work();
+  MutexLock lock(&state->mu);
+  while (state->done < n) state->cv.Wait(&state->mu);
+}
+
+// One kParallelCompressionChunkSize piece of a message and its result.
+struct Chunk {
+  Chunk() {
+    grpc_slice_buffer_init(&input);
+    grpc_slice_buffer_init(&output);
+  }
+  ~Chunk() {
+    grpc_slice_buffer_destroy(&input);
+    grpc_slice_buffer_destroy(&output);
+  }
+  Chunk(const Chunk&) = delete;
+  Chunk& operator=(const Chunk&) = delete;
+
+  grpc_slice_buffer input;
+  grpc_slice_buffer output;
+  // Adler-32 or CRC-32 of input, for deflate and gzip.
+  uLong check = 0;
+  int ok = 0;
+};
+
+// Splits (refs to) input into chunks, without copying any bytes.
+std::vector<Chunk> SplitIntoChunks(grpc_slice_buffer* input) {
+  const size_t n = (input->length + kParallelCompressionChunkSize - 1) /
+                   kParallelCompressionChunkSize;
+  std::vector<Chunk> chunks(n);
+  grpc_slice_buffer rest;
+  grpc_slice_buffer_init(&rest);
+  copy(input, &rest);
+  for (size_t i = 0; i + 1 < n; ++i) {
+    grpc_slice_buffer_move_first(&rest, kParallelCompressionChunkSize,
+                                 &chunks[i].input);
+  }
+  grpc_slice_buffer_move_into(&rest, &chunks[n - 1].input);
+  grpc_slice_buffer_destroy(&rest);
+  return chunks;
+}
+
+void AppendBytes(grpc_slice_buffer* output, const uint8_t* bytes,
+                 size_t length) {
+  grpc_slice_buffer_add(
+      output,
+      grpc_slice_from_copied_buffer(reinterpret_cast<const char*>(bytes),
+                                    length));
+}
+
+// Compresses each chunk as raw deflate data, byte aligned by a sync flush
+// except for the last, so that their concatenation is one deflate stream.
+// The zlib or gzip header and trailer are written around it, with the
+// checksum combined from the per chunk ones, as pigz does.
+int DeflateParallel(bool gzip, grpc_slice_buffer* input,
+                    grpc_slice_buffer* output, EventEngine* event_engine) {
+  std::vector<Chunk> chunks = SplitIntoChunks(input);
+  ParallelFor(event_engine, chunks.size(), [&](size_t i) {
+    Chunk& chunk = chunks[i];
+    z_stream zs;
+    memset(&zs, 0, sizeof(zs));
+    zs.zalloc = zalloc_gpr;
+    zs.zfree = zfree_gpr;
+    int r = deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -15, 8,
+                         Z_DEFAULT_STRATEGY);
+    ABSL_CHECK(r == Z_OK);
+    const bool last = i + 1 == chunks.size();
+    chunk.ok = zlib_body(&zs, &chunk.input, &chunk.output, deflate,
+                         last ? Z_FINISH : Z_SYNC_FLUSH);
+    deflateEnd(&zs);
+    uLong check = gzip ? crc32(0, Z_NULL, 0) : adler32(0, Z_NULL, 0);
+    for (size_t j = 0; j < chunk.input.count; ++j) {
+      const grpc_slice& slice = chunk.input.slices[j];
+      const uInt length = static_cast<uInt>(GRPC_SLICE_LENGTH(slice));
+      check = gzip ? crc32(check, GRPC_SLICE_START_PTR(slice), length)
+                   : adler32(check, GRPC_SLICE_START_PTR(slice), length);
+    }
+    chunk.check = check;
+  });
+  size_t compressed_length = 0;
+  uLong check = chunks[0].check;
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    if (!chunks[i].ok) return 0;
+    compressed_length += chunks[i].output.length;
+    if (i == 0) continue;
+    const z_off_t length = static_cast<z_off_t>(chunks[i].input.length);
+    check = gzip ? crc32_combine(check, chunks[i].check, length)
+                 : adler32_combine(check, chunks[i].check, length);
+  }
+  // 10 bytes of gzip header and 8 of trailer, or 2 and 4 for zlib.
+  if (compressed_length + (gzip ? 18 : 6) >= input->length) return 0;
+  if (gzip) {
+    // No file name or timestamp, unknown OS.
+    static const uint8_t kGzipHeader[] = {0x1f, 0x8b, 8, 0, 0,
+                                          0,    0,    0, 0, 0xff};
+    AppendBytes(output, kGzipHeader, sizeof(kGzipHeader));
+  } else {
+    // 32K window, default compression level.
+    static const uint8_t kZlibHeader[] = {0x78, 0x9c};
+    AppendBytes(output, kZlibHeader, sizeof(kZlibHeader));
+  }
+  for (Chunk& chunk : chunks) {
+    grpc_slice_buffer_move_into(&chunk.output, output);
+  }
+  uint8_t trailer[8];
+  if (gzip) {
+    const uint32_t input_size = static_cast<uint32_t>(input->length);
+    for (int i = 0; i < 4; ++i) {
+      trailer[i] = static_cast<uint8_t>(check >> (8 * i));
+      trailer[4 + i] = static_cast<uint8_t>(input_size >> (8 * i));
+    }
+    AppendBytes(output, trailer, 8);
+  } else {
+    for (int i = 0; i < 4; ++i) {
+      trailer[i] = static_cast<uint8_t>(check >> (8 * (3 - i)));
+    }
+    AppendBytes(output, trailer, 4);
+  }
+  return 1;
+}
+
+#ifdef GRPC_HAVE_ZSTD
+// Compresses each chunk into its own zstd frame; a zstd stream may be a
+// sequence of frames.
+int ZstdParallel(int level, grpc_slice_buffer* input,
+                 grpc_slice_buffer* output, EventEngine* event_engine) {
+  std::vector<Chunk> chunks = SplitIntoChunks(input);
+  ParallelFor(event_engine, chunks.size(), [&](size_t i) {
+    ZSTD_CCtx* cctx = ZSTD_createCCtx();
+    ABSL_CHECK_NE(cctx, nullptr);
+    ZSTD_CCtx_setParameter(cctx, ZSTD_c_compressionLevel, level);
+    chunks[i].ok =
+        zstd_compress_frame(cctx, &chunks[i].input, &chunks[i].output);
+    ZSTD_freeCCtx(cctx);
+  });
+  size_t compressed_length = 0;
+  for (const Chunk& chunk : chunks) {
+    if (!chunk.ok) return 0;
+    compressed_length += chunk.output.length;
+  }
+  if (compressed_length >= input->length) return 0;
+  for (Chunk& chunk : chunks) {
+    grpc_slice_buffer_move_into(&chunk.output, output);
+  }
+  return 1;
+}
+
+// Decompresses the frames of a multi-frame zstd message concurrently.
+// Returns std::nullopt, having touched nothing, unless the input looks like
+// ZstdParallel output: at least two frames, the first declaring a content
+// size of kParallelCompressionChunkSize and none declaring more, with sizes
+// adding up to no more than max_output_size.
+std::optional<int> ZstdDecompressParallel(grpc_slice_buffer* input,
+                                          grpc_slice_buffer* output,
+                                          size_t max_output_size,
+                                          EventEngine* event_engine) {
+  // ZSTD_FRAMEHEADERSIZE_MAX, which zstd.h only exposes for static linking.
+  constexpr size_t kMaxFrameHeaderSize = 18;
+  // Look at the first frame header before making the input contiguous, so
+  // that messages from a serial compressor are left alone cheaply.
+  uint8_t header[kMaxFrameHeaderSize];
+  const size_t header_size = std::min(input->length, sizeof(header));
+  grpc_slice_buffer_copy_first_into_buffer(input, header_size, header);
+  const unsigned long long first_size =
+      ZSTD_getFrameContentSize(header, header_size);
+  if (first_size != kParallelCompressionChunkSize) return std::nullopt;
+  struct Frame {
+    const uint8_t* data;
+    size_t size;
+    grpc_slice decompressed;
+    bool ok = false;
+  };
+  grpc_slice contiguous;
+  if (input->count == 1) {
+    contiguous = CSliceRef(input->slices[0]);
+  } else {
+    contiguous = GRPC_SLICE_MALLOC(input->length);
+    grpc_slice_buffer_copy_first_into_buffer(
+        input, input->length, GRPC_SLICE_START_PTR(contiguous));
+  }
+  Slice flat(contiguous);
+  std::vector<Frame> frames;
+  size_t total = 0;
+  for (size_t offset = 0; offset < flat.size();) {
+    const uint8_t* data = flat.data() + offset;
+    const size_t size =
+        ZSTD_findFrameCompressedSize(data, flat.size() - offset);
+    if (ZSTD_isError(size)) return std::nullopt;
+    const unsigned long long content_size =
+        ZSTD_getFrameContentSize(data, size);
+    if (content_size == ZSTD_CONTENTSIZE_UNKNOWN ||
+        content_size == ZSTD_CONTENTSIZE_ERROR ||
+        content_size > kParallelCompressionChunkSize ||
+        content_size > max_output_size - total) {
+      return std::nullopt;
+    }
+    total += content_size;
+    frames.push_back(Frame{data, size, grpc_empty_slice()});
+    frames.back().decompressed =
+        GRPC_SLICE_MALLOC(static_cast<size_t>(content_size));
+    offset += size;
+  }
+  if (frames.size() < 2) {
+    for (Frame& frame : frames) CSliceUnref(frame.decompressed);
+    return std::nullopt;
+  }
+  ParallelFor(event_engine, frames.size(), [&](size_t i) {
+    Frame& frame = frames[i];
+    const size_t capacity = GRPC_SLICE_LENGTH(frame.decompressed);
+    const size_t r =
+        ZSTD_decompress(GRPC_SLICE_START_PTR(frame.decompressed), capacity,
+                        frame.data, frame.size);
+    frame.ok = !ZSTD_isError(r) && r == capacity;
+  });
+  const bool ok = std::all_of(frames.begin(), frames.end(),
+                              [](const Frame& frame) { return frame.ok; });
+  for (Frame& frame : frames) {
+    if (ok) {
+      grpc_slice_buffer_add(output, frame.decompressed);
+    } else {
+      CSliceUnref(frame.decompressed);
+    }
+  }
+  if (!ok) ABSL_VLOG(2) << "zstd: Data error";
+  return ok ? 1 : 0;
+}
+#endif  // GRPC_HAVE_ZSTD
+
+}  // namespace
+
+int ParallelCompress(grpc_compression_algorithm algorithm, int level,
+                     grpc_slice_buffer* input, grpc_slice_buffer* output,
+                     EventEngine* event_engine) {
+  if (input->length < 2 * kParallelCompressionChunkSize) {
+    return grpc_msg_compress_with_level(algorithm, level, input, output);
+  }
+  int r = 0;
+  switch (algorithm) {
+    case GRPC_COMPRESS_DEFLATE:
+      r = DeflateParallel(/*gzip=*/false, input, output, event_engine);
+      break;
+    case GRPC_COMPRESS_GZIP:
+      r = DeflateParallel(/*gzip=*/true, input, output, event_engine);
+      break;
+    case GRPC_COMPRESS_ZSTD:
+#ifdef GRPC_HAVE_ZSTD
+      r = ZstdParallel(level, input, output, event_engine);
+      break;
+#else
+      return grpc_msg_compress_with_level(algorithm, level, input, output);
+#endif
+    default:
+      return grpc_msg_compress_with_level(algorithm, level, input, output);
+  }
+  if (!r) copy(input, output);
+  return r;
+}
+
+int ParallelDecompress(grpc_compression_algorithm algorithm,
+                       grpc_slice_buffer* input, grpc_slice_buffer* output,
+                       size_t max_output_size, EventEngine* event_engine) {
+#ifdef GRPC_HAVE_ZSTD
+  if (algorithm == GRPC_COMPRESS_ZSTD) {
+    auto r = ZstdDecompressParallel(input, output, max_output_size,
+                                    event_engine);
+    if (r.has_value()) return *r;
+  }
+#else
+  (void)max_output_size;
+  (void)event_engine;
+#endif
+  // The deflate format has no markers to split the work on.
+  return grpc_msg_decompress(algorithm, input, output);
+}
+
+}  // namespace grpc_core
+
+int grpc_msg_compress(grpc_compression_algorithm algorithm,
+                      grpc_slice_buffer* input, grpc_slice_buffer* output) {
+  return grpc_msg_compress_with_level(algorithm, 0, input, output);
+}
+
+int grpc_msg_compress_with_level(grpc_compression_algorithm algorithm,
+                                 int level, grpc_slice_buffer* input,
+                                 grpc_slice_buffer* output) {
+  return grpc_core::MessageCompressor().Compress(algorithm, level, input,
+                                                 output);
+}
+
+int grpc_msg_decompress(grpc_compression_algorithm algorithm,
+                        grpc_slice_buffer* input, grpc_slice_buffer* output) {
+  return grpc_core::MessageCompressor().Decompress(algorithm, input, output);
+}
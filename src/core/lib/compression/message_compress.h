@@ -19,9 +19,13 @@
 #ifndef GRPC_SRC_CORE_LIB_COMPRESSION_MESSAGE_COMPRESS_H
 #define GRPC_SRC_CORE_LIB_COMPRESSION_MESSAGE_COMPRESS_H
 
+#include <grpc/event_engine/event_engine.h>
 #include <grpc/impl/compression_types.h>
 #include <grpc/slice.h>
 #include <grpc/support/port_platform.h>
+#include <stddef.h>
+
+#include <memory>
 
 // compress 'input' to 'output' using 'algorithm'.
 // On success, appends compressed slices to output and returns 1.
@@ -29,10 +33,80 @@
 int grpc_msg_compress(grpc_compression_algorithm algorithm,
                       grpc_slice_buffer* input, grpc_slice_buffer* output);
 
+// As grpc_msg_compress, but with an algorithm specific compression 'level'.
+// Currently only zstd honors it (0 selects the library default); other
+// algorithms ignore it.
+int grpc_msg_compress_with_level(grpc_compression_algorithm algorithm,
+                                 int level, grpc_slice_buffer* input,
+                                 grpc_slice_buffer* output);
+
 // decompress 'input' to 'output' using 'algorithm'.
 // On success, appends slices to output and returns 1.
 // On failure, output is unchanged, and returns 0.
 int grpc_msg_decompress(grpc_compression_algorithm algorithm,
                         grpc_slice_buffer* input, grpc_slice_buffer* output);
 
+namespace grpc_core {
+
+class CompressionDictionary;
+
+// Holds compression state that can be reused across many messages (typically
+// every message on one call), so that each message pays for a cheap reset
+// instead of a full allocation and setup of the algorithm's context.
+// Every message is still compressed independently: the wire format is the
+// same as grpc_msg_compress / grpc_msg_decompress.
+// Not thread safe.
+class MessageCompressor {
+ public:
+  MessageCompressor();
+  ~MessageCompressor();
+  MessageCompressor(const MessageCompressor&) = delete;
+  MessageCompressor& operator=(const MessageCompressor&) = delete;
+
+  // Same contract as grpc_msg_compress_with_level. If dictionary is non-null
+  // and algorithm is GRPC_COMPRESS_DEFLATE the message is compressed against
+  // it; the receiver must have the same dictionary registered.
+  int Compress(grpc_compression_algorithm algorithm, int level,
+               grpc_slice_buffer* input, grpc_slice_buffer* output,
+               const CompressionDictionary* dictionary = nullptr);
+  // Same contract as grpc_msg_decompress. Preset dictionaries are looked up
+  // in CompressionDictionaryRegistry::Global().
+  int Decompress(grpc_compression_algorithm algorithm,
+                 grpc_slice_buffer* input, grpc_slice_buffer* output);
+
+ private:
+  struct Contexts;
+
+  Contexts* contexts();
+  int CompressInner(grpc_compression_algorithm algorithm, int level,
+                    grpc_slice_buffer* input, grpc_slice_buffer* output,
+                    const CompressionDictionary* dictionary);
+
+  std::unique_ptr<Contexts> contexts_;
+};
+
+// Size of the independently compressed pieces of a ParallelCompress message.
+inline constexpr size_t kParallelCompressionChunkSize = 1024 * 1024;
+
+// Same contract as grpc_msg_compress_with_level, but messages of two chunks
+// or more are split into kParallelCompressionChunkSize chunks, compressed
+// concurrently on event_engine and the calling thread.
+// Deflate and gzip output is a single standard stream, at a small cost in
+// compression ratio since every chunk starts with an empty window. zstd
+// output is one frame per chunk, which any zstd decoder accepts.
+int ParallelCompress(
+    grpc_compression_algorithm algorithm, int level, grpc_slice_buffer* input,
+    grpc_slice_buffer* output,
+    grpc_event_engine::experimental::EventEngine* event_engine);
+// Same contract as grpc_msg_decompress. zstd messages as written by
+// ParallelCompress are decompressed a frame per thread, provided their
+// declared size is at most max_output_size; anything else is decompressed
+// serially.
+int ParallelDecompress(
+    grpc_compression_algorithm algorithm, grpc_slice_buffer* input,
+    grpc_slice_buffer* output, size_t max_output_size,
+    grpc_event_engine::experimental::EventEngine* event_engine);
+
+}  // namespace grpc_core
+
 #endif  // GRPC_SRC_CORE_LIB_COMPRESSION_MESSAGE_COMPRESS_H
@@ -95,6 +95,7 @@ TraceFlag http2_ping_trace(false, "http2_ping");
 TraceFlag http2_stream_state_trace(false, "http2_stream_state");
 TraceFlag http_keepalive_trace(false, "http_keepalive");
 TraceFlag inproc_trace(false, "inproc");
+TraceFlag least_request_lb_trace(false, "least_request_lb");
 TraceFlag metadata_query_trace(false, "metadata_query");
 TraceFlag op_failure_trace(false, "op_failure");
 TraceFlag orca_client_trace(false, "orca_client");
@@ -179,6 +180,7 @@ const absl::flat_hash_map<std::string, TraceFlag*>& GetAllTraceFlags() {
           {"http2_stream_state", &http2_stream_state_trace},
           {"http_keepalive", &http_keepalive_trace},
           {"inproc", &inproc_trace},
+          {"least_request_lb", &least_request_lb_trace},
           {"metadata_query", &metadata_query_trace},
           {"op_failure", &op_failure_trace},
           {"orca_client", &orca_client_trace},
@@ -0,0 +1,211 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "src/core/lib/event_engine/caching_dns_resolver.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/functional/any_invocable.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "src/core/lib/debug/trace.h"
+#include "src/core/util/sync.h"
+
+namespace grpc_event_engine::experimental {
+
+namespace {
+
+using grpc_core::Timestamp;
+
+// Past this many entries, expired ones are dropped.
+constexpr size_t kMaxIdleEntries = 4096;
+
+template <typename T>
+class ResultCache {
+ public:
+  using Callback = absl::AnyInvocable<void(absl::StatusOr<T>)>;
+
+  // Hands callback a cached result through event_engine, or queues it for
+  // the next result. Returns true if the caller must start a query for key
+  // and pass its result to Finish().
+  bool Lookup(const std::string& key, Callback callback,
+              EventEngine* event_engine) ABSL_LOCKS_EXCLUDED(mu_) {
+    grpc_core::MutexLock lock(&mu_);
+    const Timestamp now = Timestamp::Now();
+    if (entries_.size() > kMaxIdleEntries) SweepLocked(now);
+    Entry& entry = entries_[key];
+    if (entry.value.has_value() && now < entry.stale_until) {
+      event_engine->Run(
+          [callback = std::move(callback), value = *entry.value]() mutable {
+            callback(std::move(value));
+          });
+      if (now < entry.expires || entry.querying) return false;
+      GRPC_TRACE_LOG(event_engine_dns, INFO)
+          << "(event_engine dns) serving stale result for " << key
+          << " while refreshing it";
+      entry.querying = true;
+      return true;
+    }
+    entry.waiters.push_back(std::move(callback));
+    if (entry.querying) return false;
+    entry.querying = true;
+    return true;
+  }
+
+  void Finish(const std::string& key, absl::StatusOr<T> result,
+              const CachingDNSResolver::Options& options)
+      ABSL_LOCKS_EXCLUDED(mu_) {
+    std::vector<Callback> waiters;
+    {
+      grpc_core::MutexLock lock(&mu_);
+      auto it = entries_.find(key);
+      if (it == entries_.end()) return;
+      Entry& entry = it->second;
+      entry.querying = false;
+      waiters.swap(entry.waiters);
+      if (result.ok()) {
+        entry.value = *result;
+        entry.expires = Timestamp::Now() + options.ttl;
+        entry.stale_until = entry.expires + options.stale_while_revalidate;
+      } else if (!entry.value.has_value()) {
+        entries_.erase(it);
+      }
+    }
+    for (Callback& waiter : waiters) waiter(result);
+  }
+
+  void Clear() ABSL_LOCKS_EXCLUDED(mu_) {
+    grpc_core::MutexLock lock(&mu_);
+    for (auto it = entries_.begin(); it != entries_.end();) {
+      if (it->second.querying) {
+        it->second.value.reset();
+        ++it;
+      } else {
+        entries_.erase(it++);
+      }
+    }
+  }
+
+ private:
+  struct Entry {
+    std::optional<T> value;
+    Timestamp expires;
+    Timestamp stale_until;
+    bool querying = false;
+    std::vector<Callback> waiters;
+  };
+
+  void SweepLocked(Timestamp now) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    for (auto it = entries_.begin(); it != entries_.end();) {
+      if (!it->second.querying && now >= it->second.stale_until) {
+        entries_.erase(it++);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  grpc_core::Mutex mu_;
+  absl::flat_hash_map<std::string, Entry> entries_ ABSL_GUARDED_BY(mu_);
+};
+
+ResultCache<std::vector<EventEngine::ResolvedAddress>>& HostnameCache() {
+  static auto* cache =
+      new ResultCache<std::vector<EventEngine::ResolvedAddress>>();
+  return *cache;
+}
+
+ResultCache<std::vector<EventEngine::DNSResolver::SRVRecord>>& SRVCache() {
+  static auto* cache =
+      new ResultCache<std::vector<EventEngine::DNSResolver::SRVRecord>>();
+  return *cache;
+}
+
+ResultCache<std::vector<std::string>>& TXTCache() {
+  static auto* cache = new ResultCache<std::vector<std::string>>();
+  return *cache;
+}
+
+}  // namespace
+
+CachingDNSResolver::CachingDNSResolver(
+    grpc_core::OrphanablePtr<RefCountedDNSResolverInterface> resolver,
+    absl::string_view dns_server, std::shared_ptr<EventEngine> event_engine,
+    Options options)
+    : resolver_(std::move(resolver)),
+      dns_server_(dns_server),
+      event_engine_(std::move(event_engine)),
+      options_(options) {}
+
+void CachingDNSResolver::LookupHostname(
+    EventEngine::DNSResolver::LookupHostnameCallback on_resolved,
+    absl::string_view name, absl::string_view default_port) {
+  std::string key = absl::StrCat(dns_server_, "|", name, "|", default_port);
+  if (!HostnameCache().Lookup(key, std::move(on_resolved),
+                              event_engine_.get())) {
+    return;
+  }
+  resolver_->LookupHostname(
+      [self = RefAsSubclass<CachingDNSResolver>(), key](
+          absl::StatusOr<std::vector<EventEngine::ResolvedAddress>>
+              result) mutable {
+        HostnameCache().Finish(key, std::move(result), self->options_);
+      },
+      name, default_port);
+}
+
+void CachingDNSResolver::LookupSRV(
+    EventEngine::DNSResolver::LookupSRVCallback on_resolved,
+    absl::string_view name) {
+  std::string key = absl::StrCat(dns_server_, "|", name);
+  if (!SRVCache().Lookup(key, std::move(on_resolved), event_engine_.get())) {
+    return;
+  }
+  resolver_->LookupSRV(
+      [self = RefAsSubclass<CachingDNSResolver>(), key](
+          absl::StatusOr<std::vector<EventEngine::DNSResolver::SRVRecord>>
+              result) mutable {
+        SRVCache().Finish(key, std::move(result), self->options_);
+      },
+      name);
+}
+
+void CachingDNSResolver::LookupTXT(
+    EventEngine::DNSResolver::LookupTXTCallback on_resolved,
+    absl::string_view name) {
+  std::string key = absl::StrCat(dns_server_, "|", name);
+  if (!TXTCache().Lookup(key, std::move(on_resolved), event_engine_.get())) {
+    return;
+  }
+  resolver_->LookupTXT(
+      [self = RefAsSubclass<CachingDNSResolver>(),
+       key](absl::StatusOr<std::vector<std::string>> result) mutable {
+        TXTCache().Finish(key, std::move(result), self->options_);
+      },
+      name);
+}
+
+void CachingDNSResolver::TestOnlyClearCache() {
+  HostnameCache().Clear();
+  SRVCache().Clear();
+  TXTCache().Clear();
+}
+
+}  // namespace grpc_event_engine::experimental
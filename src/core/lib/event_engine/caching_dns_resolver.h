@@ -0,0 +1,85 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_CACHING_DNS_RESOLVER_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_CACHING_DNS_RESOLVER_H
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "absl/strings/string_view.h"
+#include "src/core/lib/event_engine/ref_counted_dns_resolver_interface.h"
+#include "src/core/util/orphanable.h"
+#include "src/core/util/time.h"
+
+namespace grpc_event_engine::experimental {
+
+// Puts a cache shared by the whole process in front of another resolver.
+// Lookups are keyed by query type, DNS server, name and default port, so
+// that resolvers for different servers never share results.
+//
+// A fresh result is returned without a query. Identical lookups that arrive
+// while a query is in flight wait for it instead of starting their own. A
+// result past its TTL but within the stale period is returned as is while a
+// single query refreshes it in the background. Failures are passed to the
+// waiting lookups but never cached.
+//
+// The resolvers underneath do not report record TTLs, so every result lives
+// for Options::ttl.
+class CachingDNSResolver : public RefCountedDNSResolverInterface {
+ public:
+  struct Options {
+    grpc_core::Duration ttl = grpc_core::Duration::Seconds(30);
+    grpc_core::Duration stale_while_revalidate =
+        grpc_core::Duration::Seconds(30);
+  };
+
+  CachingDNSResolver(
+      grpc_core::OrphanablePtr<RefCountedDNSResolverInterface> resolver,
+      absl::string_view dns_server, std::shared_ptr<EventEngine> event_engine,
+      Options options);
+  CachingDNSResolver(
+      grpc_core::OrphanablePtr<RefCountedDNSResolverInterface> resolver,
+      absl::string_view dns_server, std::shared_ptr<EventEngine> event_engine)
+      : CachingDNSResolver(std::move(resolver), dns_server,
+                           std::move(event_engine), Options()) {}
+
+  // Queries still in flight keep the wrapped resolver alive until they
+  // finish, since other resolvers' lookups may be waiting on them.
+  void Orphan() override { Unref(); }
+
+  void LookupHostname(
+      EventEngine::DNSResolver::LookupHostnameCallback on_resolved,
+      absl::string_view name, absl::string_view default_port) override;
+  void LookupSRV(EventEngine::DNSResolver::LookupSRVCallback on_resolved,
+                 absl::string_view name) override;
+  void LookupTXT(EventEngine::DNSResolver::LookupTXTCallback on_resolved,
+                 absl::string_view name) override;
+
+  // Empties the process-wide cache.
+  static void TestOnlyClearCache();
+
+ private:
+  grpc_core::OrphanablePtr<RefCountedDNSResolverInterface> resolver_;
+  const std::string dns_server_;
+  const std::shared_ptr<EventEngine> event_engine_;
+  const Options options_;
+};
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_CACHING_DNS_RESOLVER_H
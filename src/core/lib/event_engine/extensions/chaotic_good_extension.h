@@ -15,13 +15,38 @@
 #ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_EXTENSIONS_CHAOTIC_GOOD_EXTENSION_H
 #define GRPC_SRC_CORE_LIB_EVENT_ENGINE_EXTENSIONS_CHAOTIC_GOOD_EXTENSION_H
 
+#include <grpc/event_engine/slice.h>
 #include <grpc/support/port_platform.h>
+#include <stddef.h>
+
+#include <memory>
 
 #include "absl/strings/string_view.h"
 #include "src/core/lib/resource_quota/memory_quota.h"
 
 namespace grpc_event_engine::experimental {
 
+/// Supplies the memory that a ChaoticGood data endpoint receives rpcs into,
+/// so that large payloads can land directly in buffers the application
+/// chose (pinned host memory for a device upload, hugepages, ...) instead of
+/// being copied there out of endpoint-owned slices.
+/// Set on the channel or server args to use it for all ChaoticGood
+/// connections.
+class ChaoticGoodReceiveBufferAllocator
+    : public std::enable_shared_from_this<ChaoticGoodReceiveBufferAllocator> {
+ public:
+  virtual ~ChaoticGoodReceiveBufferAllocator() = default;
+  static absl::string_view ChannelArgName() {
+    return "grpc.internal.chaotic_good_receive_buffer_allocator";
+  }
+
+  /// Returns a buffer of exactly \a length bytes whose start is aligned to
+  /// \a alignment, or an empty slice to receive into endpoint memory (for
+  /// instance because \a length is too small to be worth it). May be called
+  /// from any thread; the buffer is released when the slice is unreffed.
+  virtual Slice Allocate(size_t length, size_t alignment) = 0;
+};
+
 /// An Endpoint extension class that will be supported by EventEngine endpoints
 /// which need to work with the ChaoticGood transport.
 class ChaoticGoodExtension {
@@ -55,6 +80,14 @@ class ChaoticGoodExtension {
   /// If invoked, the endpoint tries to preserve proper order and alignment of
   /// any memory that maybe shared across reads.
   virtual void EnforceRxMemoryAlignment() = 0;
+
+  /// While rpc receive coalescing is enabled, asks \a allocator for the
+  /// contiguous block each rpc is received into, aligned to \a alignment.
+  /// It is safe to call this only when there are no outstanding Reads on the
+  /// Endpoint. Endpoints that can't read into foreign memory may ignore this.
+  virtual void UseReceiveBufferAllocator(
+      std::shared_ptr<ChaoticGoodReceiveBufferAllocator> /*allocator*/,
+      size_t /*alignment*/) {}
 };
 
 }  // namespace grpc_event_engine::experimental
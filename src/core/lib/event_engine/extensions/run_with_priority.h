@@ -0,0 +1,57 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_EXTENSIONS_RUN_WITH_PRIORITY_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_EXTENSIONS_RUN_WITH_PRIORITY_H
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#include <utility>
+
+#include "absl/functional/any_invocable.h"
+#include "absl/strings/string_view.h"
+#include "src/core/lib/event_engine/query_extensions.h"
+#include "src/core/lib/event_engine/work_priority.h"
+
+namespace grpc_event_engine::experimental {
+
+class EventEngineRunWithPriorityExtension {
+ public:
+  virtual ~EventEngineRunWithPriorityExtension() = default;
+  static absl::string_view EndpointExtensionName() {
+    return "io.grpc.event_engine.extension.event_engine_run_with_priority";
+  }
+
+  /// Like EventEngine::Run, but queues the closure on the given lane of the
+  /// engine's thread pool.
+  virtual void RunWithPriority(WorkPriority priority,
+                               absl::AnyInvocable<void()> closure) = 0;
+};
+
+/// Runs `closure` on `engine` with the given priority if the engine supports
+/// priorities, and as a plain EventEngine::Run otherwise.
+inline void RunWithPriority(EventEngine* engine, WorkPriority priority,
+                            absl::AnyInvocable<void()> closure) {
+  auto* extension = QueryExtension<EventEngineRunWithPriorityExtension>(engine);
+  if (extension != nullptr) {
+    extension->RunWithPriority(priority, std::move(closure));
+  } else {
+    engine->Run(std::move(closure));
+  }
+}
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_EXTENSIONS_RUN_WITH_PRIORITY_H
@@ -0,0 +1,42 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_EXTENSIONS_TCP_INFO_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_EXTENSIONS_TCP_INFO_H
+
+#include <optional>
+
+#include "absl/strings/string_view.h"
+#include "src/core/telemetry/tcp_tracer.h"
+
+namespace grpc_event_engine::experimental {
+
+/// An endpoint extension that reads the kernel's TCP_INFO for the endpoint's
+/// socket on demand, for callers that sample connection state periodically.
+class TcpInfoExtension {
+ public:
+  virtual ~TcpInfoExtension() = default;
+  static absl::string_view EndpointExtensionName() {
+    return "io.grpc.event_engine.extension.tcp_info";
+  }
+  /// Returns the current RTT, congestion window, retransmission and delivery
+  /// rate figures of the connection, or nullopt if they are not available.
+  /// Makes a system call, so should not be called on every read or write.
+  virtual std::optional<grpc_core::TcpTracerInterface::ConnectionMetrics>
+  GetTcpInfo() = 0;
+};
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_EXTENSIONS_TCP_INFO_H
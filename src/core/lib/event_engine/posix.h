@@ -22,7 +22,9 @@
 
 #include "src/core/lib/event_engine/extensions/can_track_errors.h"
 #include "src/core/lib/event_engine/extensions/chaotic_good_extension.h"
+#include "src/core/lib/event_engine/extensions/run_with_priority.h"
 #include "src/core/lib/event_engine/extensions/supports_fd.h"
+#include "src/core/lib/event_engine/extensions/tcp_info.h"
 #include "src/core/lib/event_engine/query_extensions.h"
 
 namespace grpc_event_engine::experimental {
@@ -32,13 +34,15 @@ namespace grpc_event_engine::experimental {
 class PosixEndpointWithChaoticGoodSupport
     : public ExtendedType<EventEngine::Endpoint, ChaoticGoodExtension,
                           EndpointSupportsFdExtension,
-                          EndpointCanTrackErrorsExtension> {};
+                          EndpointCanTrackErrorsExtension, TcpInfoExtension> {
+};
 
 /// This defines an interface that posix specific EventEngines endpoints
 /// may implement to support additional file descriptor related functionality.
 class PosixEndpointWithFdSupport
     : public ExtendedType<EventEngine::Endpoint, EndpointSupportsFdExtension,
-                          EndpointCanTrackErrorsExtension> {};
+                          EndpointCanTrackErrorsExtension, TcpInfoExtension> {
+};
 
 /// Defines an interface that posix EventEngine listeners may implement to
 /// support additional file descriptor related functionality.
@@ -49,7 +53,8 @@ class PosixListenerWithFdSupport
 /// Defines an interface that posix EventEngines may implement to
 /// support additional file descriptor related functionality.
 class PosixEventEngineWithFdSupport
-    : public ExtendedType<EventEngine, EventEngineSupportsFdExtension> {};
+    : public ExtendedType<EventEngine, EventEngineSupportsFdExtension,
+                          EventEngineRunWithPriorityExtension> {};
 
 }  // namespace grpc_event_engine::experimental
 
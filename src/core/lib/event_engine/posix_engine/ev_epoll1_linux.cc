@@ -19,15 +19,21 @@
 #include <grpc/support/sync.h>
 #include <stdint.h>
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <memory>
+#include <utility>
+#include <vector>
 
+#include "absl/functional/any_invocable.h"
 #include "absl/log/absl_check.h"
 #include "absl/log/absl_log.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/str_format.h"
 #include "src/core/lib/event_engine/poller.h"
+#include "src/core/config/config_vars.h"
 #include "src/core/lib/event_engine/time_util.h"
 #include "src/core/lib/iomgr/port.h"
 #include "src/core/util/crash.h"
@@ -36,7 +42,10 @@
 // epoll_create() or epoll_create1()
 #ifdef GRPC_LINUX_EPOLL
 #include <errno.h>
+#include <grpc/support/cpu.h>
 #include <limits.h>
+#include <pthread.h>
+#include <sched.h>
 #include <sys/epoll.h>
 #include <sys/socket.h>
 #include <unistd.h>
@@ -47,24 +56,60 @@
 #include "src/core/lib/event_engine/posix_engine/wakeup_fd_posix.h"
 #include "src/core/lib/event_engine/posix_engine/wakeup_fd_posix_default.h"
 #include "src/core/util/fork.h"
+#include "src/core/util/notification.h"
 #include "src/core/util/status_helper.h"
 #include "src/core/util/strerror.h"
 #include "src/core/util/sync.h"
+#include "src/core/util/thd.h"
 
 #define MAX_EPOLL_EVENTS_HANDLED_PER_ITERATION 1
 
 namespace grpc_event_engine::experimental {
 
+// One shard of a sharded Epoll1Poller. It is also the Scheduler of the
+// handles placed on it, so their readiness callbacks are queued here and run
+// by the shard thread between two epoll_wait calls.
+class Epoll1Poller::Shard : public Scheduler,
+                            public std::enable_shared_from_this<Shard> {
+ public:
+  Shard(int index, int num_shards, std::chrono::microseconds busy_poll);
+  ~Shard() override;
+  void Run(EventEngine::Closure* closure) override;
+  void Run(absl::AnyInvocable<void()> closure) override;
+  void Start();
+  // Stops the shard thread and waits for it to exit, unless called from it.
+  void Stop();
+  int epfd() const { return set_.epfd; }
+  // A CPU of the shard, or -1 if the process may not run on any of them.
+  int first_cpu() const { return cpus_.empty() ? -1 : cpus_.front(); }
+  // Handles orphaned from this shard, ready for reuse. Guarded by the
+  // poller's mu_.
+  std::list<EventHandle*> free_handles;
+
+ private:
+  void Loop();
+  void Enqueue(absl::AnyInvocable<void()> closure);
+
+  std::vector<int> cpus_;
+  const std::chrono::microseconds busy_poll_;
+  EpollSet set_;
+  std::unique_ptr<WakeupFd> wakeup_fd_;
+  grpc_core::Mutex mu_;
+  std::vector<absl::AnyInvocable<void()>> queue_ ABSL_GUARDED_BY(mu_);
+  bool shutdown_ ABSL_GUARDED_BY(mu_) = false;
+  grpc_core::Notification exited_;
+};
+
 class Epoll1EventHandle : public EventHandle {
  public:
-  Epoll1EventHandle(int fd, Epoll1Poller* poller)
+  Epoll1EventHandle(int fd, Epoll1Poller* poller, Epoll1Poller::Shard* shard)
       : fd_(fd),
         list_(this),
         poller_(poller),
-        read_closure_(std::make_unique<LockfreeEvent>(poller->GetScheduler())),
-        write_closure_(std::make_unique<LockfreeEvent>(poller->GetScheduler())),
-        error_closure_(
-            std::make_unique<LockfreeEvent>(poller->GetScheduler())) {
+        shard_(shard),
+        read_closure_(std::make_unique<LockfreeEvent>(SchedulerFor(shard))),
+        write_closure_(std::make_unique<LockfreeEvent>(SchedulerFor(shard))),
+        error_closure_(std::make_unique<LockfreeEvent>(SchedulerFor(shard))) {
     read_closure_->InitEvent();
     write_closure_->InitEvent();
     error_closure_->InitEvent();
@@ -82,6 +127,10 @@ class Epoll1EventHandle : public EventHandle {
     pending_error_.store(false, std::memory_order_relaxed);
   }
   Epoll1Poller* Poller() override { return poller_; }
+  // The epoll set this handle is registered with.
+  int EpollFd() const {
+    return shard_ != nullptr ? shard_->epfd() : poller_->g_epoll_set_.epfd;
+  }
   bool SetPendingActions(bool pending_read, bool pending_write,
                          bool pending_error) {
     // Another thread may be executing ExecutePendingActions() at this point
@@ -138,6 +187,10 @@ class Epoll1EventHandle : public EventHandle {
   ~Epoll1EventHandle() override = default;
 
  private:
+  Scheduler* SchedulerFor(Epoll1Poller::Shard* shard) {
+    if (shard != nullptr) return shard;
+    return poller_->GetScheduler();
+  }
   void HandleShutdownInternal(absl::Status why, bool releasing_fd);
   // See Epoll1Poller::ShutdownHandle for explanation on why a mutex is
   // required.
@@ -150,6 +203,9 @@ class Epoll1EventHandle : public EventHandle {
   std::atomic<bool> pending_error_{false};
   Epoll1Poller::HandlesList list_;
   Epoll1Poller* poller_;
+  // The shard the handle is placed on, or nullptr if the poller is not
+  // sharded. A handle stays on its shard across reuse.
+  Epoll1Poller::Shard* shard_;
   std::unique_ptr<LockfreeEvent> read_closure_;
   std::unique_ptr<LockfreeEvent> write_closure_;
   std::unique_ptr<LockfreeEvent> error_closure_;
@@ -157,6 +213,50 @@ class Epoll1EventHandle : public EventHandle {
 
 namespace {
 
+// The shard whose thread is the current thread, if any.
+thread_local Scheduler* g_current_shard = nullptr;
+
+// Waits for up to timeout_ms (-1 for no limit) for events on epfd. Before
+// blocking, checks for events without blocking for up to busy_poll, which
+// saves a context switch when events arrive shortly after.
+int EpollWait(int epfd, struct epoll_event* events, int timeout_ms,
+              std::chrono::microseconds busy_poll) {
+  int r;
+  if (busy_poll.count() > 0 && timeout_ms != 0) {
+    const auto deadline = std::chrono::steady_clock::now() + busy_poll;
+    do {
+      do {
+        r = epoll_wait(epfd, events, MAX_EPOLL_EVENTS, 0);
+      } while (r < 0 && errno == EINTR);
+      if (r != 0) return r;
+    } while (std::chrono::steady_clock::now() < deadline);
+  }
+  do {
+    r = epoll_wait(epfd, events, MAX_EPOLL_EVENTS, timeout_ms);
+  } while (r < 0 && errno == EINTR);
+  return r;
+}
+
+// Records the readiness reported by an epoll event on its handle. Returns the
+// handle if it now has pending actions to execute.
+Epoll1EventHandle* SetPendingActionsFromEvent(const struct epoll_event& ev) {
+  void* data_ptr = ev.data.ptr;
+  Epoll1EventHandle* handle = reinterpret_cast<Epoll1EventHandle*>(
+      reinterpret_cast<intptr_t>(data_ptr) & ~intptr_t{1});
+  bool track_err = reinterpret_cast<intptr_t>(data_ptr) & intptr_t{1};
+  bool cancel = (ev.events & EPOLLHUP) != 0;
+  bool error = (ev.events & EPOLLERR) != 0;
+  bool read_ev = (ev.events & (EPOLLIN | EPOLLPRI)) != 0;
+  bool write_ev = (ev.events & EPOLLOUT) != 0;
+  bool err_fallback = error && !track_err;
+  if (handle->SetPendingActions(read_ev || cancel || err_fallback,
+                                write_ev || cancel || err_fallback,
+                                error && !err_fallback)) {
+    return handle;
+  }
+  return nullptr;
+}
+
 int EpollCreateAndCloexec() {
 #ifdef GRPC_LINUX_EPOLL_CREATE1
   int fd = epoll_create1(EPOLL_CLOEXEC);
@@ -252,8 +352,7 @@ void Epoll1EventHandle::OrphanHandle(PosixEngineClosure* on_done,
   if (is_release_fd) {
     if (!was_shutdown) {
       epoll_event phony_event;
-      if (epoll_ctl(poller_->g_epoll_set_.epfd, EPOLL_CTL_DEL, fd_,
-                    &phony_event) != 0) {
+      if (epoll_ctl(EpollFd(), EPOLL_CTL_DEL, fd_, &phony_event) != 0) {
         ABSL_LOG(ERROR) << "OrphanHandle: epoll_ctl failed: "
                    << grpc_core::StrError(errno);
       }
@@ -277,7 +376,11 @@ void Epoll1EventHandle::OrphanHandle(PosixEngineClosure* on_done,
   pending_error_.store(false, std::memory_order_release);
   {
     grpc_core::MutexLock lock(&poller_->mu_);
-    poller_->free_epoll1_handles_list_.push_back(this);
+    if (shard_ != nullptr) {
+      shard_->free_handles.push_back(this);
+    } else {
+      poller_->free_epoll1_handles_list_.push_back(this);
+    }
   }
   if (on_done != nullptr) {
     on_done->SetStatus(absl::OkStatus());
@@ -295,8 +398,7 @@ void Epoll1EventHandle::HandleShutdownInternal(absl::Status why,
   if (read_closure_->SetShutdown(why)) {
     if (releasing_fd) {
       epoll_event phony_event;
-      if (epoll_ctl(poller_->g_epoll_set_.epfd, EPOLL_CTL_DEL, fd_,
-                    &phony_event) != 0) {
+      if (epoll_ctl(EpollFd(), EPOLL_CTL_DEL, fd_, &phony_event) != 0) {
         ABSL_LOG(ERROR) << "HandleShutdownInternal: epoll_ctl failed: "
                    << grpc_core::StrError(errno);
       }
@@ -306,8 +408,129 @@ void Epoll1EventHandle::HandleShutdownInternal(absl::Status why,
   }
 }
 
-Epoll1Poller::Epoll1Poller(Scheduler* scheduler)
-    : scheduler_(scheduler), was_kicked_(false), closed_(false) {
+Epoll1Poller::Shard::Shard(int index, int num_shards,
+                           std::chrono::microseconds busy_poll)
+    : busy_poll_(busy_poll) {
+  cpu_set_t allowed;
+  CPU_ZERO(&allowed);
+  if (sched_getaffinity(0, sizeof(allowed), &allowed) == 0) {
+    for (int cpu = index; cpu < CPU_SETSIZE; cpu += num_shards) {
+      if (CPU_ISSET(cpu, &allowed)) cpus_.push_back(cpu);
+    }
+  }
+  set_.epfd = EpollCreateAndCloexec();
+  ABSL_CHECK_GE(set_.epfd, 0);
+  wakeup_fd_ = *CreateWakeupFd();
+  ABSL_CHECK(wakeup_fd_ != nullptr);
+  struct epoll_event ev{};
+  ev.events = static_cast<uint32_t>(EPOLLIN | EPOLLET);
+  ev.data.ptr = wakeup_fd_.get();
+  ABSL_CHECK(epoll_ctl(set_.epfd, EPOLL_CTL_ADD, wakeup_fd_->ReadFd(), &ev) ==
+             0);
+}
+
+Epoll1Poller::Shard::~Shard() { close(set_.epfd); }
+
+void Epoll1Poller::Shard::Start() {
+  grpc_core::Thread(
+      "epoll1_shard", [self = shared_from_this()]() { self->Loop(); },
+      nullptr,
+      grpc_core::Thread::Options().set_tracked(false).set_joinable(false))
+      .Start();
+}
+
+void Epoll1Poller::Shard::Stop() {
+  {
+    grpc_core::MutexLock lock(&mu_);
+    if (shutdown_) return;
+    shutdown_ = true;
+  }
+  ABSL_CHECK(wakeup_fd_->Wakeup().ok());
+  // The shard thread holds a ref to the shard, so when the poller is torn
+  // down from one of its callbacks the shard outlives it until the callback
+  // returns.
+  if (g_current_shard != this) exited_.WaitForNotification();
+}
+
+void Epoll1Poller::Shard::Run(EventEngine::Closure* closure) {
+  Enqueue([closure]() { closure->Run(); });
+}
+
+void Epoll1Poller::Shard::Run(absl::AnyInvocable<void()> closure) {
+  Enqueue(std::move(closure));
+}
+
+void Epoll1Poller::Shard::Enqueue(absl::AnyInvocable<void()> closure) {
+  bool wakeup;
+  {
+    grpc_core::MutexLock lock(&mu_);
+    // The shard thread drains the queue before it waits again, so only the
+    // first closure queued from another thread needs to wake it up.
+    wakeup = queue_.empty() && g_current_shard != this;
+    queue_.push_back(std::move(closure));
+  }
+  if (wakeup) ABSL_CHECK(wakeup_fd_->Wakeup().ok());
+}
+
+void Epoll1Poller::Shard::Loop() {
+  g_current_shard = this;
+  if (!cpus_.empty()) {
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    for (int cpu : cpus_) CPU_SET(cpu, &cpus);
+    if (pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus) != 0) {
+      ABSL_LOG(ERROR) << "Failed to bind epoll1 shard thread to its CPUs";
+    }
+  }
+  std::vector<absl::AnyInvocable<void()>> closures;
+  while (true) {
+    {
+      grpc_core::MutexLock lock(&mu_);
+      if (shutdown_) break;
+      closures.swap(queue_);
+    }
+    const bool ran_closures = !closures.empty();
+    for (auto& closure : closures) closure();
+    closures.clear();
+    // Closures may have queued more work: only peek at the fds then.
+    int r = EpollWait(set_.epfd, set_.events, ran_closures ? 0 : -1,
+                      busy_poll_);
+    if (r < 0) {
+      grpc_core::Crash(absl::StrFormat(
+          "(event_engine) Epoll1Poller shard:%p encountered epoll_wait "
+          "error: %s",
+          this, grpc_core::StrError(errno).c_str()));
+    }
+    for (int i = 0; i < r; ++i) {
+      if (set_.events[i].data.ptr == wakeup_fd_.get()) {
+        ABSL_CHECK(wakeup_fd_->ConsumeWakeup().ok());
+        continue;
+      }
+      Epoll1EventHandle* handle = SetPendingActionsFromEvent(set_.events[i]);
+      if (handle != nullptr) handle->ExecutePendingActions();
+    }
+  }
+  // Closures queued before the shutdown still run, just as they would have
+  // in the thread pool.
+  while (true) {
+    {
+      grpc_core::MutexLock lock(&mu_);
+      closures.swap(queue_);
+    }
+    if (closures.empty()) break;
+    for (auto& closure : closures) closure();
+    closures.clear();
+  }
+  g_current_shard = nullptr;
+  exited_.Notify();
+}
+
+Epoll1Poller::Epoll1Poller(Scheduler* scheduler, int num_shards)
+    : scheduler_(scheduler),
+      was_kicked_(false),
+      closed_(false),
+      busy_poll_(std::max<int32_t>(
+          0, grpc_core::ConfigVars::Get().PollerBusyPollUs())) {
   g_epoll_set_.epfd = EpollCreateAndCloexec();
   wakeup_fd_ = *CreateWakeupFd();
   ABSL_CHECK(wakeup_fd_ != nullptr);
@@ -321,12 +544,25 @@ Epoll1Poller::Epoll1Poller(Scheduler* scheduler)
                   &ev) == 0);
   g_epoll_set_.num_events = 0;
   g_epoll_set_.cursor = 0;
+  for (int i = 0; i < num_shards; ++i) {
+    shards_.push_back(std::make_shared<Shard>(i, num_shards, busy_poll_));
+    shards_.back()->Start();
+  }
   ForkPollerListAddPoller(this);
 }
 
 void Epoll1Poller::Shutdown() { ForkPollerListRemovePoller(this); }
 
+void Epoll1Poller::StopShards() {
+  // Callbacks running on the shard threads may take mu_, so this must not
+  // hold it.
+  for (auto& shard : shards_) {
+    shard->Stop();
+  }
+}
+
 void Epoll1Poller::Close() {
+  StopShards();
   grpc_core::MutexLock lock(&mu_);
   if (closed_) return;
 
@@ -341,6 +577,13 @@ void Epoll1Poller::Close() {
     free_epoll1_handles_list_.pop_front();
     delete handle;
   }
+  for (auto& shard : shards_) {
+    for (EventHandle* handle : shard->free_handles) {
+      delete reinterpret_cast<Epoll1EventHandle*>(handle);
+    }
+    shard->free_handles.clear();
+  }
+  shards_.clear();
   closed_ = true;
 }
 
@@ -348,15 +591,68 @@ Epoll1Poller::~Epoll1Poller() { Close(); }
 
 EventHandle* Epoll1Poller::CreateHandle(int fd, absl::string_view /*name*/,
                                         bool track_err) {
+  return CreateHandleInternal(fd, track_err,
+                              shards_.empty() ? nullptr : PickShard(fd));
+}
+
+int Epoll1Poller::NumShards() const {
+  return shards_.empty() ? 1 : static_cast<int>(shards_.size());
+}
+
+Scheduler* Epoll1Poller::CurrentShard() const {
+  if (g_current_shard == nullptr) return nullptr;
+  for (const auto& shard : shards_) {
+    if (shard.get() == g_current_shard) return shard.get();
+  }
+  return nullptr;
+}
+
+EventHandle* Epoll1Poller::CreateHandleOnShard(int fd,
+                                               absl::string_view /*name*/,
+                                               bool track_err, int shard) {
+  if (shards_.empty()) {
+    return CreateHandleInternal(fd, track_err, nullptr);
+  }
+  return CreateHandleInternal(fd, track_err,
+                              shards_[shard % shards_.size()].get());
+}
+
+int Epoll1Poller::ShardIncomingCpu(int shard) const {
+  if (shards_.empty()) return -1;
+  return shards_[shard % shards_.size()]->first_cpu();
+}
+
+Epoll1Poller::Shard* Epoll1Poller::PickShard(int fd) {
+#ifdef SO_INCOMING_CPU
+  // Connections go to the shard of the CPU that processes their packets,
+  // which is also where the listener's steering sends them.
+  int cpu = -1;
+  socklen_t len = sizeof(cpu);
+  if (getsockopt(fd, SOL_SOCKET, SO_INCOMING_CPU, &cpu, &len) == 0 &&
+      cpu >= 0) {
+    return shards_[cpu % shards_.size()].get();
+  }
+#endif
+  for (auto& shard : shards_) {
+    if (shard.get() == g_current_shard) return shard.get();
+  }
+  return shards_[next_shard_.fetch_add(1, std::memory_order_relaxed) %
+                 shards_.size()]
+      .get();
+}
+
+EventHandle* Epoll1Poller::CreateHandleInternal(int fd, bool track_err,
+                                                Shard* shard) {
   Epoll1EventHandle* new_handle = nullptr;
   {
     grpc_core::MutexLock lock(&mu_);
-    if (free_epoll1_handles_list_.empty()) {
-      new_handle = new Epoll1EventHandle(fd, this);
+    std::list<EventHandle*>& free_list =
+        shard != nullptr ? shard->free_handles : free_epoll1_handles_list_;
+    if (free_list.empty()) {
+      new_handle = new Epoll1EventHandle(fd, this, shard);
     } else {
-      new_handle = reinterpret_cast<Epoll1EventHandle*>(
-          free_epoll1_handles_list_.front());
-      free_epoll1_handles_list_.pop_front();
+      new_handle = reinterpret_cast<Epoll1EventHandle*>(free_list.front());
+      free_list.pop_front();
       new_handle->ReInit(fd);
     }
   }
@@ -369,9 +665,18 @@ EventHandle* Epoll1Poller::CreateHandle(int fd, absl::string_view /*name*/,
   // returned to the free list at that point.
   ev.data.ptr = reinterpret_cast<void*>(reinterpret_cast<intptr_t>(new_handle) |
                                         (track_err ? 1 : 0));
-  if (epoll_ctl(g_epoll_set_.epfd, EPOLL_CTL_ADD, fd, &ev) != 0) {
+  if (epoll_ctl(new_handle->EpollFd(), EPOLL_CTL_ADD, fd, &ev) != 0) {
     ABSL_LOG(ERROR) << "epoll_ctl failed: " << grpc_core::StrError(errno);
   }
+#ifdef SO_BUSY_POLL
+  if (busy_poll_.count() > 0) {
+    // Best effort: fails harmlessly for fds that are not sockets, and for
+    // processes that may not raise the budget above the system default.
+    int busy_poll_us = static_cast<int>(busy_poll_.count());
+    (void)setsockopt(fd, SOL_SOCKET, SO_BUSY_POLL, &busy_poll_us,
+                     sizeof(busy_poll_us));
+  }
+#endif  // SO_BUSY_POLL
 
   return new_handle;
 }
@@ -392,22 +697,12 @@ bool Epoll1Poller::ProcessEpollEvents(int max_epoll_events_to_handle,
        idx++) {
     int64_t c = cursor++;
     struct epoll_event* ev = &g_epoll_set_.events[c];
-    void* data_ptr = ev->data.ptr;
-    if (data_ptr == wakeup_fd_.get()) {
+    if (ev->data.ptr == wakeup_fd_.get()) {
       ABSL_CHECK(wakeup_fd_->ConsumeWakeup().ok());
       was_kicked = true;
     } else {
-      Epoll1EventHandle* handle = reinterpret_cast<Epoll1EventHandle*>(
-          reinterpret_cast<intptr_t>(data_ptr) & ~intptr_t{1});
-      bool track_err = reinterpret_cast<intptr_t>(data_ptr) & intptr_t{1};
-      bool cancel = (ev->events & EPOLLHUP) != 0;
-      bool error = (ev->events & EPOLLERR) != 0;
-      bool read_ev = (ev->events & (EPOLLIN | EPOLLPRI)) != 0;
-      bool write_ev = (ev->events & EPOLLOUT) != 0;
-      bool err_fallback = error && !track_err;
-      if (handle->SetPendingActions(read_ev || cancel || err_fallback,
-                                    write_ev || cancel || err_fallback,
-                                    error && !err_fallback)) {
+      Epoll1EventHandle* handle = SetPendingActionsFromEvent(*ev);
+      if (handle != nullptr) {
         pending_events.push_back(handle);
       }
     }
@@ -421,12 +716,10 @@ bool Epoll1Poller::ProcessEpollEvents(int max_epoll_events_to_handle,
 //  See ProcessEpollEvents() function for more details. It returns the number
 // of events generated by epoll_wait.
 int Epoll1Poller::DoEpollWait(EventEngine::Duration timeout) {
-  int r;
-  do {
-    r = epoll_wait(g_epoll_set_.epfd, g_epoll_set_.events, MAX_EPOLL_EVENTS,
-                   static_cast<int>(
-                       grpc_event_engine::experimental::Milliseconds(timeout)));
-  } while (r < 0 && errno == EINTR);
+  int r = EpollWait(
+      g_epoll_set_.epfd, g_epoll_set_.events,
+      static_cast<int>(grpc_event_engine::experimental::Milliseconds(timeout)),
+      busy_poll_);
   if (r < 0) {
     grpc_core::Crash(absl::StrFormat(
         "(event_engine) Epoll1Poller:%p encountered epoll_wait error: %s", this,
@@ -524,6 +817,19 @@ std::shared_ptr<Epoll1Poller> MakeEpoll1Poller(Scheduler* scheduler) {
   return nullptr;
 }
 
+std::shared_ptr<Epoll1Poller> MakeShardedEpoll1Poller(Scheduler* scheduler,
+                                                      int num_shards) {
+  static bool kEpoll1PollerSupported = InitEpoll1PollerLinux();
+  // Shard threads do not survive fork.
+  if (!kEpoll1PollerSupported || grpc_core::Fork::Enabled()) {
+    return nullptr;
+  }
+  if (num_shards <= 0) {
+    num_shards = static_cast<int>(gpr_cpu_num_cores());
+  }
+  return std::make_shared<Epoll1Poller>(scheduler, num_shards);
+}
+
 void Epoll1Poller::PrepareFork() { Kick(); }
 
 // TODO(vigneshbabu): implement
@@ -542,7 +848,9 @@ namespace grpc_event_engine::experimental {
 using ::grpc_event_engine::experimental::EventEngine;
 using ::grpc_event_engine::experimental::Poller;
 
-Epoll1Poller::Epoll1Poller(Scheduler* /* engine */) {
+class Epoll1Poller::Shard {};
+
+Epoll1Poller::Epoll1Poller(Scheduler* /* engine */, int /*num_shards*/) {
   grpc_core::Crash("unimplemented");
 }
 
@@ -555,6 +863,23 @@ EventHandle* Epoll1Poller::CreateHandle(int /*fd*/, absl::string_view /*name*/,
   grpc_core::Crash("unimplemented");
 }
 
+int Epoll1Poller::NumShards() const { grpc_core::Crash("unimplemented"); }
+
+Scheduler* Epoll1Poller::CurrentShard() const {
+  grpc_core::Crash("unimplemented");
+}
+
+EventHandle* Epoll1Poller::CreateHandleOnShard(int /*fd*/,
+                                               absl::string_view /*name*/,
+                                               bool /*track_err*/,
+                                               int /*shard*/) {
+  grpc_core::Crash("unimplemented");
+}
+
+int Epoll1Poller::ShardIncomingCpu(int /*shard*/) const {
+  grpc_core::Crash("unimplemented");
+}
+
 bool Epoll1Poller::ProcessEpollEvents(int /*max_epoll_events_to_handle*/,
                                       Events& /*pending_events*/) {
   grpc_core::Crash("unimplemented");
@@ -578,6 +903,11 @@ std::shared_ptr<Epoll1Poller> MakeEpoll1Poller(Scheduler* /*scheduler*/) {
   return nullptr;
 }
 
+std::shared_ptr<Epoll1Poller> MakeShardedEpoll1Poller(
+    Scheduler* /*scheduler*/, int /*num_shards*/) {
+  return nullptr;
+}
+
 void Epoll1Poller::PrepareFork() {}
 
 void Epoll1Poller::PostforkParent() {}
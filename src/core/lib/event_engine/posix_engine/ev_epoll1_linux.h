@@ -17,9 +17,12 @@
 #include <grpc/event_engine/event_engine.h>
 #include <grpc/support/port_platform.h>
 
+#include <atomic>
+#include <chrono>
 #include <list>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/container/inlined_vector.h"
@@ -43,11 +46,25 @@ namespace grpc_event_engine::experimental {
 class Epoll1EventHandle;
 
 // Definition of epoll1 based poller.
+//
+// In sharded mode (num_shards > 0) the poller additionally owns num_shards
+// epoll sets, each served by a dedicated thread bound to the CPUs c with
+// c % num_shards equal to the shard index. Every handle is placed on a shard:
+// accepted connections on the shard of the CPU that received them
+// (SO_INCOMING_CPU), other handles on the shard of the creating thread, or
+// round robin. The readiness callbacks of a handle run on its shard's thread,
+// so a connection's I/O stays on one set of cores. The epoll set driven by
+// Work() then only carries Kick()s.
 class Epoll1Poller : public PosixEventPoller {
  public:
-  explicit Epoll1Poller(Scheduler* scheduler);
+  explicit Epoll1Poller(Scheduler* scheduler, int num_shards = 0);
   EventHandle* CreateHandle(int fd, absl::string_view name,
                             bool track_err) override;
+  int NumShards() const override;
+  EventHandle* CreateHandleOnShard(int fd, absl::string_view name,
+                                   bool track_err, int shard) override;
+  int ShardIncomingCpu(int shard) const override;
+  Scheduler* CurrentShard() const override;
   Poller::WorkResult Work(
       grpc_event_engine::experimental::EventEngine::Duration timeout,
       absl::FunctionRef<void()> schedule_poll_again) override;
@@ -98,6 +115,12 @@ class Epoll1Poller : public PosixEventPoller {
     Epoll1EventHandle* prev = nullptr;
   };
   friend class Epoll1EventHandle;
+  class Shard;
+  friend class Shard;
+  EventHandle* CreateHandleInternal(int fd, bool track_err, Shard* shard);
+  // The shard a new handle for `fd` goes to in sharded mode.
+  Shard* PickShard(int fd);
+  void StopShards();
 #ifdef GRPC_LINUX_EPOLL
   struct EpollSet {
     int epfd = -1;
@@ -123,12 +146,23 @@ class Epoll1Poller : public PosixEventPoller {
   std::list<EventHandle*> free_epoll1_handles_list_ ABSL_GUARDED_BY(mu_);
   std::unique_ptr<WakeupFd> wakeup_fd_;
   bool closed_;
+  // How long to keep polling without blocking before waiting for events.
+  const std::chrono::microseconds busy_poll_;
+  // Sharded mode only.
+  std::vector<std::shared_ptr<Shard>> shards_;
+  std::atomic<size_t> next_shard_{0};
 };
 
 // Return an instance of a epoll1 based poller tied to the specified event
 // engine.
 std::shared_ptr<Epoll1Poller> MakeEpoll1Poller(Scheduler* scheduler);
 
+// Return an instance of a sharded epoll1 based poller with num_shards shards,
+// or one shard per CPU if num_shards is 0. Returns nullptr if epoll is not
+// supported or if fork support is enabled.
+std::shared_ptr<Epoll1Poller> MakeShardedEpoll1Poller(Scheduler* scheduler,
+                                                      int num_shards = 0);
+
 }  // namespace grpc_event_engine::experimental
 
 #endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EV_EPOLL1_LINUX_H
@@ -0,0 +1,596 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/status.h>
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+#include "absl/log/absl_check.h"
+#include "absl/log/absl_log.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_format.h"
+#include "src/core/lib/event_engine/poller.h"
+#include "src/core/lib/iomgr/port.h"
+#include "src/core/util/crash.h"
+
+// This polling engine is only relevant on linux kernels supporting multishot
+// io_uring poll requests.
+#ifdef GRPC_LINUX_IO_URING
+#include <endian.h>
+#include <errno.h>
+#include <linux/io_uring.h>
+#include <linux/time_types.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "src/core/lib/event_engine/posix_engine/event_poller.h"
+#include "src/core/lib/event_engine/posix_engine/lockfree_event.h"
+#include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
+#include "src/core/util/fork.h"
+#include "src/core/util/status_helper.h"
+#include "src/core/util/strerror.h"
+#include "src/core/util/sync.h"
+
+namespace grpc_event_engine::experimental {
+
+namespace {
+
+// Requested size of the submission queue. Requests are submitted as soon as
+// they are queued, so this only needs to absorb concurrent producers.
+constexpr uint32_t kSubmissionQueueEntries = 256;
+// Requested size of the completion queue. Every readiness change of every
+// handle posts a completion, so this is sized well above the submission
+// queue to keep overflows (which terminate multishot requests) rare.
+constexpr uint32_t kCompletionQueueEntries = 4096;
+
+// user_data values that never alias a handle: handles are word aligned and
+// only ever carry the track_err flag in their least significant bit.
+constexpr uint64_t kKickUserData = 0;
+constexpr uint64_t kCancelUserData = 2;
+
+constexpr uint32_t kRequiredFeatures =
+    IORING_FEAT_SINGLE_MMAP | IORING_FEAT_NODROP | IORING_FEAT_EXT_ARG |
+    // Not used directly: multishot poll requests shipped in the same kernel
+    // release (5.13) and, unlike this feature, are not advertised.
+    IORING_FEAT_RSRC_TAGS;
+
+int IoUringSetup(uint32_t entries, io_uring_params* params) {
+  return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int IoUringEnter(int ring_fd, uint32_t to_submit, uint32_t min_complete,
+                 uint32_t flags, const void* arg, size_t arg_size) {
+  return static_cast<int>(syscall(__NR_io_uring_enter, ring_fd, to_submit,
+                                  min_complete, flags, arg, arg_size));
+}
+
+// It is possible that the headers know about io_uring but the running kernel
+// doesn't, or that io_uring was disabled by the administrator. Set up a
+// minimal ring to make sure the required features are available.
+bool InitIoUringPollerLinux() {
+  io_uring_params params{};
+  int fd = IoUringSetup(1, &params);
+  if (fd < 0) {
+    GRPC_TRACE_LOG(event_engine_poller, INFO)
+        << "io_uring_setup unavailable: " << grpc_core::StrError(errno);
+    return false;
+  }
+  close(fd);
+  return (params.features & kRequiredFeatures) == kRequiredFeatures;
+}
+
+}  // namespace
+
+class IoUringEventHandle : public EventHandle {
+ public:
+  IoUringEventHandle(int fd, bool track_err, IoUringPoller* poller)
+      : fd_(fd),
+        track_err_(track_err),
+        poller_(poller),
+        read_closure_(std::make_unique<LockfreeEvent>(poller->GetScheduler())),
+        write_closure_(std::make_unique<LockfreeEvent>(poller->GetScheduler())),
+        error_closure_(
+            std::make_unique<LockfreeEvent>(poller->GetScheduler())) {
+    read_closure_->InitEvent();
+    write_closure_->InitEvent();
+    error_closure_->InitEvent();
+  }
+  void ReInit(int fd, bool track_err) {
+    fd_ = fd;
+    track_err_ = track_err;
+    armed_ = false;
+    disarmed_.store(false, std::memory_order_relaxed);
+    read_closure_->InitEvent();
+    write_closure_->InitEvent();
+    error_closure_->InitEvent();
+    pending_read_.store(false, std::memory_order_relaxed);
+    pending_write_.store(false, std::memory_order_relaxed);
+    pending_error_.store(false, std::memory_order_relaxed);
+  }
+  IoUringPoller* Poller() override { return poller_; }
+  bool SetPendingActions(bool pending_read, bool pending_write,
+                         bool pending_error) {
+    // See Epoll1EventHandle::SetPendingActions for why these are atomics.
+    if (pending_read) {
+      pending_read_.store(true, std::memory_order_release);
+    }
+    if (pending_write) {
+      pending_write_.store(true, std::memory_order_release);
+    }
+    if (pending_error) {
+      pending_error_.store(true, std::memory_order_release);
+    }
+    return pending_read || pending_write || pending_error;
+  }
+  int WrappedFd() override { return fd_; }
+  void OrphanHandle(PosixEngineClosure* on_done, int* release_fd,
+                    absl::string_view reason) override;
+  void ShutdownHandle(absl::Status why) override;
+  void NotifyOnRead(PosixEngineClosure* on_read) override;
+  void NotifyOnWrite(PosixEngineClosure* on_write) override;
+  void NotifyOnError(PosixEngineClosure* on_error) override;
+  void SetReadable() override;
+  void SetWritable() override;
+  void SetHasError() override;
+  bool IsHandleShutdown() override;
+  inline void ExecutePendingActions() {
+    if (pending_read_.exchange(false, std::memory_order_acq_rel)) {
+      read_closure_->SetReady();
+    }
+    if (pending_write_.exchange(false, std::memory_order_acq_rel)) {
+      write_closure_->SetReady();
+    }
+    if (pending_error_.exchange(false, std::memory_order_acq_rel)) {
+      error_closure_->SetReady();
+    }
+  }
+  // The identifier of this handle's poll request. The least significant bit
+  // carries track_err, as in the epoll1 poller.
+  uint64_t UserData() const {
+    return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(this)) |
+           (track_err_ ? 1 : 0);
+  }
+  static IoUringEventHandle* FromUserData(uint64_t user_data) {
+    return reinterpret_cast<IoUringEventHandle*>(
+        static_cast<uintptr_t>(user_data & ~uint64_t{1}));
+  }
+  // Called by the poller when the kernel reports that the handle's poll
+  // request will post no more completions. Returns true if the handle was
+  // orphaned and can be reused, otherwise re-arms it if rearm is true.
+  bool OnPollTerminated(bool rearm);
+  bool IsDisarmed() const { return disarmed_.load(std::memory_order_acquire); }
+  int fd() const { return fd_; }
+  ~IoUringEventHandle() override = default;
+
+ private:
+  void HandleShutdownInternal(absl::Status why);
+  // See Epoll1EventHandle::ShutdownHandle for why a mutex is required. It
+  // also orders re-arming a terminated poll request against OrphanHandle.
+  grpc_core::Mutex mu_;
+  int fd_;
+  bool track_err_;
+  // True while the kernel holds a poll request for this handle.
+  bool armed_ ABSL_GUARDED_BY(mu_) = false;
+  // Set once the handle is orphaned; completions are ignored from then on.
+  std::atomic<bool> disarmed_{false};
+  std::atomic<bool> pending_read_{false};
+  std::atomic<bool> pending_write_{false};
+  std::atomic<bool> pending_error_{false};
+  IoUringPoller* poller_;
+  std::unique_ptr<LockfreeEvent> read_closure_;
+  std::unique_ptr<LockfreeEvent> write_closure_;
+  std::unique_ptr<LockfreeEvent> error_closure_;
+
+  friend class IoUringPoller;
+};
+
+void IoUringEventHandle::OrphanHandle(PosixEngineClosure* on_done,
+                                      int* release_fd,
+                                      absl::string_view reason) {
+  if (!read_closure_->IsShutdown()) {
+    HandleShutdownInternal(absl::Status(absl::StatusCode::kUnknown, reason));
+  }
+  bool reusable;
+  {
+    grpc_core::MutexLock lock(&mu_);
+    disarmed_.store(true, std::memory_order_release);
+    read_closure_->DestroyEvent();
+    write_closure_->DestroyEvent();
+    error_closure_->DestroyEvent();
+    // Unlike epoll, a poll request holds its own reference to the file, so it
+    // must be cancelled explicitly whether or not the fd is being released.
+    // The handle becomes reusable once the kernel acknowledges that.
+    reusable = !armed_;
+    if (armed_) poller_->DisarmHandle(this);
+  }
+  pending_read_.store(false, std::memory_order_release);
+  pending_write_.store(false, std::memory_order_release);
+  pending_error_.store(false, std::memory_order_release);
+  if (reusable) {
+    grpc_core::MutexLock lock(&poller_->mu_);
+    poller_->free_handles_list_.push_back(this);
+  }
+  // If release_fd is not NULL, we should be relinquishing control of the file
+  // descriptor fd->fd (but we still own the grpc_fd structure).
+  if (release_fd != nullptr) {
+    *release_fd = fd_;
+  } else {
+    shutdown(fd_, SHUT_RDWR);
+    close(fd_);
+  }
+  if (on_done != nullptr) {
+    on_done->SetStatus(absl::OkStatus());
+    poller_->GetScheduler()->Run(on_done);
+  }
+}
+
+bool IoUringEventHandle::OnPollTerminated(bool rearm) {
+  grpc_core::MutexLock lock(&mu_);
+  armed_ = false;
+  if (IsDisarmed()) return true;
+  // The kernel drops multishot requests e.g. when the completion queue
+  // overflows. Re-arm so the handle keeps receiving readiness events.
+  if (rearm) poller_->ArmHandle(this);
+  return false;
+}
+
+void IoUringEventHandle::HandleShutdownInternal(absl::Status why) {
+  grpc_core::StatusSetInt(&why, grpc_core::StatusIntProperty::kRpcStatus,
+                          GRPC_STATUS_UNAVAILABLE);
+  if (read_closure_->SetShutdown(why)) {
+    write_closure_->SetShutdown(why);
+    error_closure_->SetShutdown(why);
+  }
+}
+
+// Might be called multiple times
+void IoUringEventHandle::ShutdownHandle(absl::Status why) {
+  grpc_core::MutexLock lock(&mu_);
+  HandleShutdownInternal(why);
+}
+
+bool IoUringEventHandle::IsHandleShutdown() {
+  return read_closure_->IsShutdown();
+}
+
+void IoUringEventHandle::NotifyOnRead(PosixEngineClosure* on_read) {
+  read_closure_->NotifyOn(on_read);
+}
+
+void IoUringEventHandle::NotifyOnWrite(PosixEngineClosure* on_write) {
+  write_closure_->NotifyOn(on_write);
+}
+
+void IoUringEventHandle::NotifyOnError(PosixEngineClosure* on_error) {
+  error_closure_->NotifyOn(on_error);
+}
+
+void IoUringEventHandle::SetReadable() { read_closure_->SetReady(); }
+
+void IoUringEventHandle::SetWritable() { write_closure_->SetReady(); }
+
+void IoUringEventHandle::SetHasError() { error_closure_->SetReady(); }
+
+IoUringPoller::IoUringPoller(Scheduler* scheduler)
+    : scheduler_(scheduler), ring_fd_(-1), was_kicked_(false), closed_(false) {
+  ABSL_CHECK(MapRing());
+  GRPC_TRACE_LOG(event_engine_poller, INFO) << "grpc io_uring fd: " << ring_fd_;
+}
+
+bool IoUringPoller::MapRing() {
+  io_uring_params params{};
+  params.flags = IORING_SETUP_CQSIZE | IORING_SETUP_CLAMP;
+  params.cq_entries = kCompletionQueueEntries;
+  ring_fd_ = IoUringSetup(kSubmissionQueueEntries, &params);
+  if (ring_fd_ < 0) {
+    ABSL_LOG(ERROR) << "io_uring_setup failed: " << grpc_core::StrError(errno);
+    return false;
+  }
+  // With IORING_FEAT_SINGLE_MMAP both rings live in a single mapping.
+  ring_.rings_size = std::max<size_t>(
+      params.sq_off.array + params.sq_entries * sizeof(uint32_t),
+      params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe));
+  ring_.rings = mmap(nullptr, ring_.rings_size, PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQ_RING);
+  if (ring_.rings == MAP_FAILED) {
+    ABSL_LOG(ERROR) << "mmap of io_uring rings failed: "
+                    << grpc_core::StrError(errno);
+    ring_.rings = nullptr;
+    return false;
+  }
+  ring_.sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+  void* sqes = mmap(nullptr, ring_.sqes_size, PROT_READ | PROT_WRITE,
+                    MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQES);
+  if (sqes == MAP_FAILED) {
+    ABSL_LOG(ERROR) << "mmap of io_uring sqes failed: "
+                    << grpc_core::StrError(errno);
+    return false;
+  }
+  ring_.sqes = static_cast<io_uring_sqe*>(sqes);
+  char* base = static_cast<char*>(ring_.rings);
+  ring_.sq_head = reinterpret_cast<uint32_t*>(base + params.sq_off.head);
+  ring_.sq_tail = reinterpret_cast<uint32_t*>(base + params.sq_off.tail);
+  ring_.sq_array = reinterpret_cast<uint32_t*>(base + params.sq_off.array);
+  ring_.sq_mask = *reinterpret_cast<uint32_t*>(base + params.sq_off.ring_mask);
+  ring_.sq_entries = params.sq_entries;
+  ring_.cq_head = reinterpret_cast<uint32_t*>(base + params.cq_off.head);
+  ring_.cq_tail = reinterpret_cast<uint32_t*>(base + params.cq_off.tail);
+  ring_.cqes = reinterpret_cast<io_uring_cqe*>(base + params.cq_off.cqes);
+  ring_.cq_mask = *reinterpret_cast<uint32_t*>(base + params.cq_off.ring_mask);
+  return true;
+}
+
+void IoUringPoller::UnmapRing() {
+  if (ring_.sqes != nullptr) {
+    munmap(ring_.sqes, ring_.sqes_size);
+    ring_.sqes = nullptr;
+  }
+  if (ring_.rings != nullptr) {
+    munmap(ring_.rings, ring_.rings_size);
+    ring_.rings = nullptr;
+  }
+  if (ring_fd_ >= 0) {
+    close(ring_fd_);
+    ring_fd_ = -1;
+  }
+}
+
+void IoUringPoller::Submit(const io_uring_sqe& request) {
+  grpc_core::MutexLock lock(&sq_mu_);
+  uint32_t tail = *ring_.sq_tail;
+  if (tail - __atomic_load_n(ring_.sq_head, __ATOMIC_ACQUIRE) ==
+      ring_.sq_entries) {
+    grpc_core::Crash(absl::StrFormat(
+        "(event_engine) IoUringPoller:%p submission queue is full", this));
+  }
+  uint32_t index = tail & ring_.sq_mask;
+  ring_.sqes[index] = request;
+  ring_.sq_array[index] = index;
+  __atomic_store_n(ring_.sq_tail, tail + 1, __ATOMIC_RELEASE);
+  // Without SQPOLL the kernel consumes submissions synchronously. Requests
+  // it could not take right now (EAGAIN, EBUSY) stay queued and are picked
+  // up by the next submission.
+  int r;
+  do {
+    uint32_t to_submit =
+        tail + 1 - __atomic_load_n(ring_.sq_head, __ATOMIC_ACQUIRE);
+    r = IoUringEnter(ring_fd_, to_submit, 0, 0, nullptr, 0);
+  } while (r < 0 && errno == EINTR);
+  if (r < 0 && errno != EAGAIN && errno != EBUSY) {
+    grpc_core::Crash(absl::StrFormat(
+        "(event_engine) IoUringPoller:%p encountered io_uring_enter error: %s",
+        this, grpc_core::StrError(errno).c_str()));
+  }
+}
+
+void IoUringPoller::ArmHandle(IoUringEventHandle* handle) {
+  handle->armed_ = true;
+  io_uring_sqe sqe{};
+  sqe.opcode = IORING_OP_POLL_ADD;
+  sqe.fd = handle->fd();
+  // Multishot requests stay armed and post a completion on every readiness
+  // change, which matches the edge triggered use of epoll in epoll1.
+  sqe.len = IORING_POLL_ADD_MULTI;
+  uint32_t events = POLLIN | POLLOUT;
+#if __BYTE_ORDER == __BIG_ENDIAN
+  events = (events << 16) | (events >> 16);
+#endif
+  sqe.poll32_events = events;
+  sqe.user_data = handle->UserData();
+  Submit(sqe);
+}
+
+void IoUringPoller::DisarmHandle(IoUringEventHandle* handle) {
+  io_uring_sqe sqe{};
+  sqe.opcode = IORING_OP_POLL_REMOVE;
+  sqe.fd = -1;
+  sqe.addr = handle->UserData();
+  sqe.user_data = kCancelUserData;
+  Submit(sqe);
+}
+
+void IoUringPoller::Shutdown() {}
+
+void IoUringPoller::Close() {
+  grpc_core::MutexLock lock(&mu_);
+  if (closed_) return;
+  // Closing the ring cancels every outstanding request.
+  UnmapRing();
+  // Handles still owned by an endpoint are left alone, as in epoll1. Orphaned
+  // handles that were waiting for their poll request to be cancelled are
+  // freed along with the reusable ones.
+  for (IoUringEventHandle* handle : all_handles_list_) {
+    if (handle->IsDisarmed()) delete handle;
+  }
+  all_handles_list_.clear();
+  free_handles_list_.clear();
+  closed_ = true;
+}
+
+IoUringPoller::~IoUringPoller() { Close(); }
+
+EventHandle* IoUringPoller::CreateHandle(int fd, absl::string_view /*name*/,
+                                         bool track_err) {
+  IoUringEventHandle* new_handle = nullptr;
+  {
+    grpc_core::MutexLock lock(&mu_);
+    if (free_handles_list_.empty()) {
+      new_handle = new IoUringEventHandle(fd, track_err, this);
+      all_handles_list_.push_back(new_handle);
+    } else {
+      new_handle = free_handles_list_.front();
+      free_handles_list_.pop_front();
+      new_handle->ReInit(fd, track_err);
+    }
+  }
+  {
+    grpc_core::MutexLock lock(&new_handle->mu_);
+    ArmHandle(new_handle);
+  }
+  return new_handle;
+}
+
+bool IoUringPoller::ProcessCompletions(Events& pending_events) {
+  bool was_kicked = false;
+  uint32_t head = *ring_.cq_head;
+  uint32_t tail = __atomic_load_n(ring_.cq_tail, __ATOMIC_ACQUIRE);
+  for (; head != tail; ++head) {
+    const io_uring_cqe& cqe = ring_.cqes[head & ring_.cq_mask];
+    if (cqe.user_data == kKickUserData) {
+      was_kicked = true;
+      continue;
+    }
+    if (cqe.user_data == kCancelUserData) continue;
+    IoUringEventHandle* handle =
+        IoUringEventHandle::FromUserData(cqe.user_data);
+    bool track_err = (cqe.user_data & 1) != 0;
+    if (!handle->IsDisarmed()) {
+      uint32_t revents = cqe.res >= 0 ? static_cast<uint32_t>(cqe.res) : 0;
+      // A failed poll request is surfaced as an error so that the endpoint
+      // attempts I/O and observes the underlying failure.
+      bool cancel = (revents & POLLHUP) != 0;
+      bool error = (revents & POLLERR) != 0 || cqe.res < 0;
+      bool read_ev = (revents & (POLLIN | POLLPRI)) != 0;
+      bool write_ev = (revents & POLLOUT) != 0;
+      bool err_fallback = error && !track_err;
+      if (handle->SetPendingActions(read_ev || cancel || err_fallback,
+                                    write_ev || cancel || err_fallback,
+                                    error && !err_fallback)) {
+        pending_events.push_back(handle);
+      }
+    }
+    if ((cqe.flags & IORING_CQE_F_MORE) == 0 &&
+        handle->OnPollTerminated(/*rearm=*/cqe.res >= 0)) {
+      free_handles_list_.push_back(handle);
+    }
+  }
+  __atomic_store_n(ring_.cq_head, head, __ATOMIC_RELEASE);
+  return was_kicked;
+}
+
+bool IoUringPoller::WaitForCompletions(EventEngine::Duration timeout) {
+  if (__atomic_load_n(ring_.cq_tail, __ATOMIC_ACQUIRE) != *ring_.cq_head) {
+    return true;
+  }
+  int64_t nanos = std::max<int64_t>(
+      0,
+      std::chrono::duration_cast<std::chrono::nanoseconds>(timeout).count());
+  __kernel_timespec ts{};
+  ts.tv_sec = nanos / 1000000000;
+  ts.tv_nsec = nanos % 1000000000;
+  io_uring_getevents_arg arg{};
+  arg.ts = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(&ts));
+  int r;
+  do {
+    r = IoUringEnter(ring_fd_, 0, 1,
+                     IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg,
+                     sizeof(arg));
+  } while (r < 0 && errno == EINTR);
+  if (r < 0 && errno != ETIME && errno != EBUSY) {
+    grpc_core::Crash(absl::StrFormat(
+        "(event_engine) IoUringPoller:%p encountered io_uring_enter error: %s",
+        this, grpc_core::StrError(errno).c_str()));
+  }
+  return __atomic_load_n(ring_.cq_tail, __ATOMIC_ACQUIRE) != *ring_.cq_head;
+}
+
+// Polls the registered Fds for events until timeout is reached or there is a
+// Kick(). If there is a Kick(), it collects and processes any previously
+// un-processed events. If there are no un-processed events, it returns
+// Poller::WorkResult::Kicked{}
+Poller::WorkResult IoUringPoller::Work(
+    EventEngine::Duration timeout,
+    absl::FunctionRef<void()> schedule_poll_again) {
+  Events pending_events;
+  bool was_kicked_ext = false;
+  if (!WaitForCompletions(timeout)) {
+    return Poller::WorkResult::kDeadlineExceeded;
+  }
+  {
+    grpc_core::MutexLock lock(&mu_);
+    if (ProcessCompletions(pending_events)) {
+      was_kicked_ = false;
+      was_kicked_ext = true;
+    }
+    if (pending_events.empty()) {
+      return Poller::WorkResult::kKicked;
+    }
+  }
+  // Run the provided callback.
+  schedule_poll_again();
+  // Process all pending events inline.
+  for (auto& it : pending_events) {
+    it->ExecutePendingActions();
+  }
+  return was_kicked_ext ? Poller::WorkResult::kKicked : Poller::WorkResult::kOk;
+}
+
+void IoUringPoller::Kick() {
+  grpc_core::MutexLock lock(&mu_);
+  if (was_kicked_ || closed_) {
+    return;
+  }
+  was_kicked_ = true;
+  // A no-op request completes immediately and wakes up the waiter, so no
+  // wakeup fd is needed.
+  io_uring_sqe sqe{};
+  sqe.opcode = IORING_OP_NOP;
+  sqe.fd = -1;
+  sqe.user_data = kKickUserData;
+  Submit(sqe);
+}
+
+std::shared_ptr<IoUringPoller> MakeIoUringPoller(Scheduler* scheduler) {
+  // Rings are not inherited meaningfully across fork(), so leave fork support
+  // to the epoll1 poller.
+  if (grpc_core::Fork::Enabled()) return nullptr;
+  static bool kIoUringPollerSupported = InitIoUringPollerLinux();
+  if (kIoUringPollerSupported) {
+    return std::make_shared<IoUringPoller>(scheduler);
+  }
+  return nullptr;
+}
+
+void IoUringPoller::PrepareFork() { Kick(); }
+
+void IoUringPoller::PostforkParent() {}
+
+void IoUringPoller::PostforkChild() {}
+
+}  // namespace grpc_event_engine::experimental
+
+#else  // defined(GRPC_LINUX_IO_URING)
+
+namespace grpc_event_engine::experimental {
+
+// If GRPC_LINUX_IO_URING is not defined, it means io_uring is not available.
+// Return nullptr.
+std::shared_ptr<IoUringPoller> MakeIoUringPoller(Scheduler* /*scheduler*/) {
+  return nullptr;
+}
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // !defined(GRPC_LINUX_IO_URING)
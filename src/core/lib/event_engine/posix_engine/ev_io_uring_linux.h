@@ -0,0 +1,137 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EV_IO_URING_LINUX_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EV_IO_URING_LINUX_H
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+
+#include <list>
+#include <memory>
+#include <string>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/inlined_vector.h"
+#include "absl/functional/function_ref.h"
+#include "absl/strings/string_view.h"
+#include "src/core/lib/event_engine/poller.h"
+#include "src/core/lib/event_engine/posix_engine/event_poller.h"
+#include "src/core/lib/event_engine/posix_engine/internal_errqueue.h"
+#include "src/core/lib/iomgr/port.h"
+#include "src/core/util/sync.h"
+
+struct io_uring_cqe;
+struct io_uring_sqe;
+
+namespace grpc_event_engine::experimental {
+
+class IoUringEventHandle;
+
+// Definition of an io_uring based poller.
+//
+// Readiness is tracked with one multishot IORING_OP_POLL_ADD request per
+// handle, so arming a handle never needs an epoll_ctl() round trip and the
+// kernel keeps the request armed across events. Waiting for completions,
+// submitting newly armed handles and kicks all go through io_uring_enter().
+// Handles keep the same readiness semantics as the epoll1 poller, so the
+// existing posix endpoint runs on top of this poller unchanged.
+class IoUringPoller : public PosixEventPoller {
+ public:
+  explicit IoUringPoller(Scheduler* scheduler);
+  EventHandle* CreateHandle(int fd, absl::string_view name,
+                            bool track_err) override;
+  Poller::WorkResult Work(
+      grpc_event_engine::experimental::EventEngine::Duration timeout,
+      absl::FunctionRef<void()> schedule_poll_again) override;
+  std::string Name() override { return "io_uring"; }
+  void Kick() override;
+  Scheduler* GetScheduler() { return scheduler_; }
+  void Shutdown() override;
+  bool CanTrackErrors() const override {
+#ifdef GRPC_POSIX_SOCKET_TCP
+    return KernelSupportsErrqueue();
+#else
+    return false;
+#endif
+  }
+  ~IoUringPoller() override;
+
+  // Forkable
+  void PrepareFork() override;
+  void PostforkParent() override;
+  void PostforkChild() override;
+
+  void Close();
+
+ private:
+  friend class IoUringEventHandle;
+  // This initial vector size may need to be tuned
+  using Events = absl::InlinedVector<IoUringEventHandle*, 5>;
+
+  // The submission and completion rings shared with the kernel.
+  struct Ring {
+    void* rings = nullptr;
+    size_t rings_size = 0;
+    io_uring_sqe* sqes = nullptr;
+    size_t sqes_size = 0;
+    uint32_t* sq_head = nullptr;
+    uint32_t* sq_tail = nullptr;
+    uint32_t* sq_array = nullptr;
+    uint32_t sq_mask = 0;
+    uint32_t sq_entries = 0;
+    uint32_t* cq_head = nullptr;
+    uint32_t* cq_tail = nullptr;
+    io_uring_cqe* cqes = nullptr;
+    uint32_t cq_mask = 0;
+  };
+
+  // Set up the ring and map it into this process.
+  bool MapRing();
+  void UnmapRing();
+  // Copy a request into the submission queue and submit it to the kernel.
+  void Submit(const io_uring_sqe& request) ABSL_LOCKS_EXCLUDED(sq_mu_);
+  // Queue a multishot poll request for the handle.
+  void ArmHandle(IoUringEventHandle* handle);
+  // Queue a request cancelling the handle's poll request.
+  void DisarmHandle(IoUringEventHandle* handle);
+  // Blocks until at least one completion is available or the timeout expires.
+  // Returns false on timeout.
+  bool WaitForCompletions(EventEngine::Duration timeout);
+  // Reap every available completion and collect the handles that became
+  // ready. Returns true if one of the completions was a Kick.
+  bool ProcessCompletions(Events& pending_events)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  grpc_core::Mutex mu_;
+  // Serializes producers of the submission queue.
+  grpc_core::Mutex sq_mu_ ABSL_ACQUIRED_AFTER(mu_);
+  Scheduler* scheduler_;
+  int ring_fd_;
+  Ring ring_;
+  bool was_kicked_ ABSL_GUARDED_BY(mu_);
+  // Handles whose poll request is fully torn down and can be reused.
+  std::list<IoUringEventHandle*> free_handles_list_ ABSL_GUARDED_BY(mu_);
+  // Every handle ever allocated by this poller, freed on Close().
+  std::list<IoUringEventHandle*> all_handles_list_ ABSL_GUARDED_BY(mu_);
+  bool closed_ ABSL_GUARDED_BY(mu_);
+};
+
+// Return an instance of an io_uring based poller tied to the specified event
+// engine, or nullptr if the running kernel does not provide the io_uring
+// features the poller depends on.
+std::shared_ptr<IoUringPoller> MakeIoUringPoller(Scheduler* scheduler);
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EV_IO_URING_LINUX_H
@@ -91,6 +91,21 @@ class PosixEventPoller : public grpc_event_engine::experimental::Poller,
   virtual EventHandle* CreateHandle(int fd, absl::string_view name,
                                     bool track_err) = 0;
   virtual bool CanTrackErrors() const = 0;
+  // Sharded pollers split their handles across NumShards() shards, each
+  // served by threads bound to its own set of CPUs. A handle created by
+  // CreateHandle() lands on a shard picked by the poller; listeners create
+  // one listening socket per shard with CreateHandleOnShard().
+  virtual int NumShards() const { return 1; }
+  virtual EventHandle* CreateHandleOnShard(int fd, absl::string_view name,
+                                           bool track_err, int /*shard*/) {
+    return CreateHandle(fd, name, track_err);
+  }
+  // The CPU whose connections the listening socket of `shard` should be
+  // preferred for, or -1 if there is no preference.
+  virtual int ShardIncomingCpu(int /*shard*/) const { return -1; }
+  // The shard served by the calling thread, or nullptr if the calling thread
+  // does not serve one of this poller's shards.
+  virtual Scheduler* CurrentShard() const { return nullptr; }
   virtual std::string Name() = 0;
   // Shuts down and deletes the poller. It is legal to call this function
   // only when no other poller method is in progress. For instance, it is
@@ -24,6 +24,8 @@
 
 #include <algorithm>
 #include <cctype>
+#include <cstddef>
+#include <chrono>
 #include <cstdint>
 #include <cstdlib>
 #include <memory>
@@ -61,8 +63,10 @@
 #include <linux/capability.h>  // IWYU pragma: keep
 #include <linux/errqueue.h>    // IWYU pragma: keep
 #include <linux/netlink.h>     // IWYU pragma: keep
+#include <sys/mman.h>          // IWYU pragma: keep
 #include <sys/prctl.h>         // IWYU pragma: keep
 #include <sys/resource.h>      // IWYU pragma: keep
+#include <unistd.h>            // IWYU pragma: keep
 #endif
 #include <netinet/in.h>  // IWYU pragma: keep
 
@@ -90,6 +94,12 @@
 #define MSG_ZEROCOPY 0x4000000
 #endif
 
+// TCP zero copy receive socket option. Defined here as a fallback for older
+// library headers, like MSG_ZEROCOPY above.
+#ifndef TCP_ZEROCOPY_RECEIVE
+#define TCP_ZEROCOPY_RECEIVE 35
+#endif
+
 #define MAX_READ_IOVEC 64
 
 namespace grpc_event_engine::experimental {
@@ -209,6 +219,19 @@ bool CmsgIsZeroCopy(const cmsghdr& cmsg) {
   auto serr = reinterpret_cast<const sock_extended_err*> CMSG_DATA(&cmsg);
   return serr->ee_errno == 0 && serr->ee_origin == SO_EE_ORIGIN_ZEROCOPY;
 }
+
+// Layout of the original (Linux 4.18) struct tcp_zerocopy_receive. The kernel
+// accepts this prefix of newer versions of the struct, so it is defined here
+// rather than relying on the library headers.
+struct TcpZerocopyReceiveArgs {
+  uint64_t address;
+  uint32_t length;
+  uint32_t recv_skip_hint;
+};
+
+// Destroy function of slices created by TcpZerocopyReceiveCtx: returns the
+// mapped pages to the kernel.
+void UnmapReceivedPages(void* p, size_t len) { munmap(p, len); }
 #endif  // GRPC_LINUX_ERRQUEUE
 
 absl::Status PosixOSError(int error_no, absl::string_view call_name) {
@@ -261,6 +284,65 @@ void TcpZerocopySendRecord::UpdateOffsetForBytesSent(size_t sending_length,
   }
 }
 
+TcpZerocopyReceiveCtx::TcpZerocopyReceiveCtx(bool zerocopy_enabled,
+                                             size_t receive_bytes_threshold)
+    : threshold_bytes_(receive_bytes_threshold) {
+#ifdef GRPC_LINUX_ERRQUEUE
+  long page_size = sysconf(_SC_PAGESIZE);
+  if (page_size > 0) {
+    page_size_ = static_cast<size_t>(page_size);
+    enabled_ = zerocopy_enabled;
+  }
+#else
+  (void)zerocopy_enabled;
+#endif  // GRPC_LINUX_ERRQUEUE
+}
+
+size_t TcpZerocopyReceiveCtx::Receive(int fd, size_t max_bytes,
+                                      SliceBuffer& buf) {
+#ifdef GRPC_LINUX_ERRQUEUE
+  if (!enabled_) return 0;
+  const size_t length = max_bytes - max_bytes % page_size_;
+  if (length == 0 || length < threshold_bytes_) return 0;
+  void* addr = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+  if (addr == MAP_FAILED) {
+    ABSL_VLOG(2) << "Disabling TCP RX zerocopy, mmap failed: "
+                 << grpc_core::StrError(errno);
+    enabled_ = false;
+    return 0;
+  }
+  TcpZerocopyReceiveArgs zc{};
+  zc.address = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(addr));
+  zc.length = static_cast<uint32_t>(length);
+  socklen_t zc_len = sizeof(zc);
+  int r;
+  do {
+    grpc_core::global_stats().IncrementSyscallRead();
+    r = getsockopt(fd, IPPROTO_TCP, TCP_ZEROCOPY_RECEIVE, &zc, &zc_len);
+  } while (r < 0 && errno == EINTR);
+  const int saved_errno = errno;
+  const size_t mapped = r == 0 ? zc.length : 0;
+  // Give back whatever part of the mapping the kernel did not fill.
+  if (mapped < length) {
+    munmap(static_cast<char*>(addr) + mapped, length - mapped);
+  }
+  if (r < 0 && saved_errno != EAGAIN) {
+    ABSL_VLOG(2) << "Disabling TCP RX zerocopy, getsockopt failed: "
+                 << grpc_core::StrError(saved_errno);
+    enabled_ = false;
+  }
+  if (mapped == 0) return 0;
+  buf.AppendIndexed(
+      Slice(grpc_slice_new_with_len(addr, mapped, UnmapReceivedPages)));
+  return mapped;
+#else
+  (void)fd;
+  (void)max_bytes;
+  (void)buf;
+  return 0;
+#endif  // GRPC_LINUX_ERRQUEUE
+}
+
 void PosixEndpointImpl::AddToEstimate(size_t bytes) {
   bytes_read_this_round_ += static_cast<double>(bytes);
 }
@@ -292,7 +374,14 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
   struct iovec iov[MAX_READ_IOVEC];
   ssize_t read_bytes;
   size_t total_read_bytes = 0;
-  size_t iov_len = std::min<size_t>(MAX_READ_IOVEC, incoming_buffer_->Count());
+  // Index of the first slice in incoming_buffer_ that recvmsg() reads into.
+  size_t first_read_slice = 0;
+  if (tcp_zerocopy_receive_ctx_->Enabled()) {
+    total_read_bytes = TcpZerocopyReceive();
+    if (total_read_bytes > 0) first_read_slice = 1;
+  }
+  size_t iov_len = std::min<size_t>(
+      MAX_READ_IOVEC, incoming_buffer_->Count() - first_read_slice);
 #ifdef GRPC_LINUX_ERRQUEUE
   constexpr size_t cmsg_alloc_space =
       CMSG_SPACE(sizeof(scm_timestamping)) + CMSG_SPACE(sizeof(int));
@@ -301,8 +390,8 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
 #endif  // GRPC_LINUX_ERRQUEUE
   char cmsgbuf[cmsg_alloc_space];
   for (size_t i = 0; i < iov_len; i++) {
-    MutableSlice& slice =
-        internal::SliceCast<MutableSlice>(incoming_buffer_->MutableSliceAt(i));
+    MutableSlice& slice = internal::SliceCast<MutableSlice>(
+        incoming_buffer_->MutableSliceAt(first_read_slice + i));
     iov[i].iov_base = slice.begin();
     iov[i].iov_len = slice.length();
   }
@@ -456,6 +545,28 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
   return true;
 }
 
+// Maps the data queued on the socket into a slice placed in front of the
+// spare slices of incoming_buffer_, as if a recvmsg() had filled them. Returns
+// the number of bytes mapped.
+size_t PosixEndpointImpl::TcpZerocopyReceive() {
+  // With TCP_INQ we know how much is queued, otherwise expect as much as the
+  // current read estimate.
+  size_t wanted = std::max<size_t>(inq_capable_ ? inq_ : 0,
+                                   incoming_buffer_->Length());
+  wanted = std::min<size_t>(wanted, max_read_chunk_size_);
+  SliceBuffer mapped;
+  size_t mapped_bytes =
+      tcp_zerocopy_receive_ctx_->Receive(fd_, wanted, mapped);
+  if (mapped_bytes == 0) return 0;
+  grpc_core::global_stats().IncrementTcpReadSize(mapped_bytes);
+  AddToEstimate(mapped_bytes);
+  incoming_buffer_->Swap(mapped);
+  while (mapped.Count() > 0) {
+    incoming_buffer_->AppendIndexed(mapped.TakeFirst());
+  }
+  return mapped_bytes;
+}
+
 void PosixEndpointImpl::PerformReclamation() {
   read_mu_.Lock();
   if (incoming_buffer_ != nullptr) {
@@ -524,15 +635,52 @@ void PosixEndpointImpl::MaybeMakeReadSlices() {
   if (incoming_buffer_->Length() < std::max<size_t>(min_progress_size_, 1)) {
     size_t allocate_length = min_progress_size_;
     const size_t target_length = static_cast<size_t>(target_length_);
-    // If memory pressure is low and we think there will be more than
-    // min_progress_size bytes to read, allocate a bit more.
-    const bool low_memory_pressure =
-        memory_owner_.GetPressureInfo().pressure_control_value < 0.8;
-    if (low_memory_pressure && target_length > allocate_length) {
-      allocate_length = target_length;
+    const double pressure =
+        memory_owner_.GetPressureInfo().pressure_control_value;
+    bool low_memory_pressure;
+    if (grpc_core::IsMemoryPressureScaledBuffersEnabled()) {
+      // Read ahead by less as pressure rises, down to just what the next
+      // read needs, rather than dropping the read-ahead all at once.
+      low_memory_pressure = pressure < grpc_core::kBufferShrinkStartPressure;
+      allocate_length = std::max(
+          allocate_length,
+          static_cast<size_t>(grpc_core::BufferSizeUnderMemoryPressure(
+              pressure, allocate_length, target_length)));
+      UpdateRcvBufForMemoryPressure(pressure);
+    } else {
+      // If memory pressure is low and we think there will be more than
+      // min_progress_size bytes to read, allocate a bit more.
+      low_memory_pressure = pressure < 0.8;
+      if (low_memory_pressure && target_length > allocate_length) {
+        allocate_length = target_length;
+      }
     }
     int extra_wanted = std::max<int>(
         1, allocate_length - static_cast<int>(incoming_buffer_->Length()));
+    // A hint comes from a transport that knows how many bytes the frame it
+    // is reading still has, so give them their own right-sized slices: a
+    // large payload then arrives in one piece instead of a run of 64k
+    // slices that have to be joined again when the message is assembled.
+    // Read-ahead beyond the hint is allocated as usual.
+    const int hinted_wanted =
+        min_progress_size_ - static_cast<int>(incoming_buffer_->Length());
+    if (grpc_core::IsTcpFrameSizeTuningEnabled() &&
+        hinted_wanted >= kBigAlloc) {
+      static const int kMaxHintedAlloc = 1024 * 1024;
+      int remaining = hinted_wanted;
+      while (remaining > 0) {
+        const int length = std::min(remaining, kMaxHintedAlloc);
+        remaining -= length;
+        incoming_buffer_->AppendIndexed(
+            Slice(memory_owner_.MakeSlice(length)));
+        grpc_core::global_stats().IncrementTcpReadAllocHinted();
+      }
+      extra_wanted -= hinted_wanted;
+      if (extra_wanted <= 0) {
+        MaybePostReclaimer();
+        return;
+      }
+    }
     if (extra_wanted >=
         (low_memory_pressure ? kSmallAlloc * 3 / 2 : kBigAlloc)) {
       while (extra_wanted > 0) {
@@ -553,6 +701,34 @@ void PosixEndpointImpl::MaybeMakeReadSlices() {
   }
 }
 
+void PosixEndpointImpl::UpdateRcvBufForMemoryPressure(double pressure) {
+  static constexpr int kMinRcvBuf = 16 * 1024;
+  int target;
+  if (pressure < grpc_core::kBufferShrinkStartPressure) {
+    // Never shrunk, or already grown back.
+    if (set_rcvbuf_ == unshrunk_rcvbuf_) return;
+    target = unshrunk_rcvbuf_;
+  } else {
+    if (set_rcvbuf_ == 0) {
+      // Setting SO_RCVBUF stops the kernel from tuning it, so remember what
+      // it had tuned it to for when the pressure goes away.
+      auto rcvbuf = sock_.GetSocketRcvBuf();
+      if (!rcvbuf.ok()) return;
+      unshrunk_rcvbuf_ = set_rcvbuf_ = *rcvbuf;
+    }
+    target = static_cast<int>(grpc_core::BufferSizeUnderMemoryPressure(
+        pressure, std::min(kMinRcvBuf, unshrunk_rcvbuf_), unshrunk_rcvbuf_));
+    // Each change costs a syscall: follow the pressure in steps of a quarter.
+    if (std::abs(target - set_rcvbuf_) < set_rcvbuf_ / 4) return;
+  }
+  auto status = sock_.SetSocketRcvBuf(target);
+  if (!status.ok()) {
+    ABSL_LOG(ERROR) << "ERROR in SO_RCVBUF: " << status.message();
+    return;
+  }
+  set_rcvbuf_ = target;
+}
+
 bool PosixEndpointImpl::HandleReadLocked(absl::Status& status) {
   if (status.ok() && memory_owner_.is_valid()) {
     MaybeMakeReadSlices();
@@ -882,6 +1058,36 @@ bool PosixEndpointImpl::WriteWithTimestamps(struct msghdr* msg,
   return true;
 }
 
+std::optional<grpc_core::TcpTracerInterface::ConnectionMetrics>
+PosixEndpointImpl::GetTcpInfo() {
+  tcp_info info;
+  if (GetSocketTcpInfo(&info, fd_) != 0) return std::nullopt;
+  // Older kernels return a shorter struct: only report the fields they set.
+  grpc_core::TcpTracerInterface::ConnectionMetrics metrics;
+  if (info.length > offsetof(tcp_info, tcpi_total_retrans)) {
+    metrics.srtt = info.tcpi_rtt;
+    metrics.congestion_window = info.tcpi_snd_cwnd;
+    metrics.snd_ssthresh = info.tcpi_snd_ssthresh;
+    metrics.reordering = info.tcpi_reordering;
+    metrics.recurring_retrans = info.tcpi_retransmits;
+    metrics.packet_retx = info.tcpi_total_retrans;
+  }
+  if (info.length > offsetof(tcp_info, tcpi_min_rtt)) {
+    if (info.tcpi_min_rtt != UINT32_MAX) metrics.min_rtt = info.tcpi_min_rtt;
+    metrics.data_notsent = info.tcpi_notsent_bytes;
+  }
+  if (info.length > offsetof(tcp_info, tcpi_delivery_rate)) {
+    metrics.delivery_rate = info.tcpi_delivery_rate;
+    metrics.is_delivery_rate_app_limited =
+        info.tcpi_delivery_rate_app_limited != 0;
+  }
+  if (info.length > offsetof(tcp_info, tcpi_dsack_dups)) {
+    metrics.data_sent = info.tcpi_bytes_sent;
+    metrics.data_retx = info.tcpi_bytes_retrans;
+  }
+  return metrics;
+}
+
 #else   // GRPC_LINUX_ERRQUEUE
 TcpZerocopySendRecord* PosixEndpointImpl::TcpGetSendZerocopyRecord(
     SliceBuffer& /*buf*/) {
@@ -901,6 +1107,11 @@ bool PosixEndpointImpl::WriteWithTimestamps(struct msghdr* /*msg*/,
                                             int /*additional_flags*/) {
   grpc_core::Crash("Write with timestamps not supported for this platform");
 }
+
+std::optional<grpc_core::TcpTracerInterface::ConnectionMetrics>
+PosixEndpointImpl::GetTcpInfo() {
+  return std::nullopt;
+}
 #endif  // GRPC_LINUX_ERRQUEUE
 
 void PosixEndpointImpl::UnrefMaybePutZerocopySendRecord(
@@ -1002,7 +1213,8 @@ bool PosixEndpointImpl::DoFlushZerocopy(TcpZerocopySendRecord* record,
     if (sent_length < 0) {
       // If this particular send failed, drop ref taken earlier in this method.
       tcp_zerocopy_send_ctx_->UndoSend();
-      if (saved_errno == EAGAIN || saved_errno == ENOBUFS) {
+      if (saved_errno == EAGAIN || saved_errno == ENOBUFS ||
+          saved_errno == EINPROGRESS) {
         record->UnwindIfThrottled(unwind_slice_idx, unwind_byte_idx);
         return false;
       } else {
@@ -1092,7 +1304,10 @@ bool PosixEndpointImpl::TcpFlush(absl::Status& status) {
     }
 
     if (sent_length < 0) {
-      if (saved_errno == EAGAIN || saved_errno == ENOBUFS) {
+      // A TCP Fast Open connect without a cookie fails its first send with
+      // EINPROGRESS while the handshake completes.
+      if (saved_errno == EAGAIN || saved_errno == ENOBUFS ||
+          saved_errno == EINPROGRESS) {
         outgoing_byte_idx_ = unwind_byte_idx;
         // unref all and forget about all slices that have been written to this
         // point
@@ -1129,6 +1344,131 @@ bool PosixEndpointImpl::TcpFlush(absl::Status& status) {
   }
 }
 
+std::optional<bool> PosixEndpointImpl::MaybeCoalesceWrite(
+    absl::AnyInvocable<void(absl::Status)>& on_writable, SliceBuffer* data,
+    const EventEngine::Endpoint::WriteArgs* args) {
+  void* traced_arg = args != nullptr ? args->google_specific : nullptr;
+  grpc_core::MutexLock lock(&coalesce_mu_);
+  const bool active =
+      coalesced_buffer_.Length() > 0 || coalesced_flush_in_progress_;
+  if (!active && coalesced_write_error_.ok() &&
+      (traced_arg != nullptr ||
+       data->Length() >= write_coalescing_max_bytes_)) {
+    // Nothing is held: large and timestamped writes keep the regular path,
+    // including its zerocopy support.
+    return std::nullopt;
+  }
+  if (!coalesced_write_error_.ok()) {
+    // The bytes of an earlier, already completed write could not be sent.
+    absl::Status status = coalesced_write_error_;
+    data->Clear();
+    engine_->Run(
+        [on_writable = std::move(on_writable), status, this]() mutable {
+          GRPC_TRACE_LOG(event_engine_endpoint, INFO)
+              << "Endpoint[" << this << "]: Write failed: " << status;
+          on_writable(status);
+        });
+    return false;
+  }
+  data->MoveFirstNBytesIntoSliceBuffer(data->Length(), coalesced_buffer_);
+  if (traced_arg != nullptr) {
+    ABSL_CHECK(poller_->CanTrackErrors());
+    // This write's bytes are the last ones held, so the timestamps recorded
+    // once the flush completes are the ones for this write.
+    outgoing_buffer_arg_ = traced_arg;
+  }
+  if (coalesced_flush_in_progress_) {
+    // The socket is backed up: hold the caller until the flush catches up.
+    coalesced_write_cb_ = std::move(on_writable);
+    return false;
+  }
+  if (traced_arg == nullptr &&
+      coalesced_buffer_.Length() < write_coalescing_max_bytes_) {
+    if (!coalesce_timer_.has_value()) {
+      Ref().release();
+      coalesce_timer_ = engine_->RunAfter(write_coalescing_delay_, [this]() {
+        HandleCoalesceTimer();
+        Unref();
+      });
+    }
+    GRPC_TRACE_LOG(event_engine_endpoint, INFO)
+        << "Endpoint[" << this << "]: Write held for coalescing, "
+        << coalesced_buffer_.Length() << " bytes held";
+    return true;
+  }
+  if (coalesce_timer_.has_value() && engine_->Cancel(*coalesce_timer_)) {
+    Unref();
+  }
+  coalesce_timer_.reset();
+  absl::Status status;
+  if (!FlushCoalescedLocked(status)) {
+    coalesced_write_cb_ = std::move(on_writable);
+    return false;
+  }
+  if (!status.ok()) {
+    engine_->Run(
+        [on_writable = std::move(on_writable), status, this]() mutable {
+          GRPC_TRACE_LOG(event_engine_endpoint, INFO)
+              << "Endpoint[" << this << "]: Write failed: " << status;
+          on_writable(status);
+        });
+    return false;
+  }
+  return true;
+}
+
+bool PosixEndpointImpl::FlushCoalescedLocked(absl::Status& status) {
+  outgoing_buffer_ = &coalesced_buffer_;
+  outgoing_byte_idx_ = 0;
+  if (!TcpFlush(status)) {
+    coalesced_flush_in_progress_ = true;
+    Ref().release();
+    handle_->NotifyOnWrite(on_coalesced_write_);
+    return false;
+  }
+  if (!status.ok()) {
+    coalesced_write_error_ = status;
+  }
+  return true;
+}
+
+void PosixEndpointImpl::HandleCoalescedWrite(absl::Status status) {
+  absl::AnyInvocable<void(absl::Status)> cb;
+  {
+    grpc_core::MutexLock lock(&coalesce_mu_);
+    // Writes that arrived in the meantime were appended to the buffer, so
+    // keep going until all of it is out.
+    if (status.ok() && !TcpFlush(status)) {
+      ABSL_DCHECK(status.ok());
+      handle_->NotifyOnWrite(on_coalesced_write_);
+      return;
+    }
+    if (!status.ok()) {
+      coalesced_buffer_.Clear();
+      coalesced_write_error_ = status;
+    }
+    coalesced_flush_in_progress_ = false;
+    cb = std::move(coalesced_write_cb_);
+    coalesced_write_cb_ = nullptr;
+  }
+  GRPC_TRACE_LOG(event_engine_endpoint, INFO)
+      << "Endpoint[" << this << "]: Coalesced write complete: " << status;
+  if (cb != nullptr) {
+    cb(status);
+  }
+  Unref();
+}
+
+void PosixEndpointImpl::HandleCoalesceTimer() {
+  grpc_core::MutexLock lock(&coalesce_mu_);
+  coalesce_timer_.reset();
+  if (coalesced_flush_in_progress_ || coalesced_buffer_.Length() == 0) {
+    return;
+  }
+  absl::Status status;
+  FlushCoalescedLocked(status);
+}
+
 void PosixEndpointImpl::HandleWrite(absl::Status status) {
   if (!status.ok()) {
     GRPC_TRACE_LOG(event_engine_endpoint, INFO)
@@ -1190,6 +1530,13 @@ bool PosixEndpointImpl::Write(
     return true;
   }
 
+  if (write_coalescing_delay_ > EventEngine::Duration::zero()) {
+    std::optional<bool> result = MaybeCoalesceWrite(on_writable, data, args);
+    if (result.has_value()) {
+      return *result;
+    }
+  }
+
   zerocopy_send_record = TcpGetSendZerocopyRecord(*data);
   if (zerocopy_send_record == nullptr) {
     // Either not enough bytes, or couldn't allocate a zerocopy context.
@@ -1239,6 +1586,22 @@ void PosixEndpointImpl::MaybeShutdown(
     stop_error_notification_.store(true, std::memory_order_release);
     handle_->SetHasError();
   }
+  {
+    grpc_core::MutexLock lock(&coalesce_mu_);
+    if (coalesce_timer_.has_value() && engine_->Cancel(*coalesce_timer_)) {
+      Unref();
+    }
+    coalesce_timer_.reset();
+    // Held bytes belong to writes that already completed: make one last
+    // attempt to send them.
+    if (!coalesced_flush_in_progress_ && coalesced_buffer_.Length() > 0) {
+      absl::Status status;
+      outgoing_buffer_ = &coalesced_buffer_;
+      outgoing_byte_idx_ = 0;
+      TcpFlush(status);
+      coalesced_buffer_.Clear();
+    }
+  }
   on_release_fd_ = std::move(on_release_fd);
   grpc_core::StatusSetInt(&why, grpc_core::StatusIntProperty::kRpcStatus,
                           GRPC_STATUS_UNAVAILABLE);
@@ -1260,6 +1623,7 @@ PosixEndpointImpl ::~PosixEndpointImpl() {
   delete on_read_;
   delete on_write_;
   delete on_error_;
+  delete on_coalesced_write_;
 }
 
 PosixEndpointImpl::PosixEndpointImpl(EventHandle* handle,
@@ -1325,6 +1689,12 @@ PosixEndpointImpl::PosixEndpointImpl(EventHandle* handle,
   tcp_zerocopy_send_ctx_ = std::make_unique<TcpZerocopySendCtx>(
       zerocopy_enabled, options.tcp_tx_zerocopy_max_simultaneous_sends,
       options.tcp_tx_zerocopy_send_bytes_threshold);
+  tcp_zerocopy_receive_ctx_ = std::make_unique<TcpZerocopyReceiveCtx>(
+      options.tcp_rx_zero_copy_enabled,
+      options.tcp_rx_zerocopy_receive_bytes_threshold);
+  write_coalescing_delay_ =
+      std::chrono::microseconds(options.tcp_write_coalescing_delay_us);
+  write_coalescing_max_bytes_ = options.tcp_write_coalescing_max_bytes;
 #ifdef GRPC_HAVE_TCP_INQ
   int one = 1;
   if (setsockopt(fd_, SOL_TCP, TCP_INQ, &one, sizeof(one)) == 0) {
@@ -1343,6 +1713,8 @@ PosixEndpointImpl::PosixEndpointImpl(EventHandle* handle,
       [this](absl::Status status) { HandleWrite(std::move(status)); });
   on_error_ = PosixEngineClosure::ToPermanentClosure(
       [this](absl::Status status) { HandleError(std::move(status)); });
+  on_coalesced_write_ = PosixEngineClosure::ToPermanentClosure(
+      [this](absl::Status status) { HandleCoalescedWrite(std::move(status)); });
 
   // Start being notified on errors if poller can track errors.
   if (poller_->CanTrackErrors()) {
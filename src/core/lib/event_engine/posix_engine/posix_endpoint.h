@@ -28,6 +28,7 @@
 #include <cstdint>
 #include <memory>
 #include <new>
+#include <optional>
 #include <utility>
 
 #include "absl/base/thread_annotations.h"
@@ -462,6 +463,39 @@ class TcpZerocopySendCtx {
   OptMemState zcopy_enobuf_state_ ABSL_GUARDED_BY(mu_) = OptMemState::kOpen;
 };
 
+// Receive-side counterpart of TcpZerocopySendCtx. Instead of copying
+// received bytes into freshly allocated slices, pages holding them are mapped
+// into the process with TCP_ZEROCOPY_RECEIVE and wrapped in slices that hand
+// the pages back to the kernel (munmap) when the last reference is released.
+// Only whole pages can be mapped; the kernel reports how many trailing bytes
+// still have to be read with recvmsg().
+class TcpZerocopyReceiveCtx {
+ public:
+  static constexpr size_t kDefaultReceiveBytesThreshold = 64 * 1024;  // 64KB
+
+  explicit TcpZerocopyReceiveCtx(
+      bool zerocopy_enabled,
+      size_t receive_bytes_threshold = kDefaultReceiveBytesThreshold);
+
+  bool Enabled() const { return enabled_; }
+
+  // Only map received data if we expect at least this many bytes. Mapping
+  // and unmapping pages costs more than copying small amounts of data.
+  size_t ThresholdBytes() const { return threshold_bytes_; }
+
+  // Map up to max_bytes (rounded down to whole pages) of the data queued on
+  // fd into slices appended to buf. Returns the number of bytes mapped, which
+  // is 0 if nothing could be mapped. Zerocopy receive is disabled for good if
+  // the socket does not support it.
+  size_t Receive(int fd, size_t max_bytes,
+                 grpc_event_engine::experimental::SliceBuffer& buf);
+
+ private:
+  bool enabled_ = false;
+  size_t threshold_bytes_ = kDefaultReceiveBytesThreshold;
+  size_t page_size_ = 0;
+};
+
 class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
  public:
   PosixEndpointImpl(
@@ -493,6 +527,8 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
 
   bool CanTrackErrors() const { return poller_->CanTrackErrors(); }
 
+  std::optional<grpc_core::TcpTracerInterface::ConnectionMetrics> GetTcpInfo();
+
   void MaybeShutdown(
       absl::Status why,
       absl::AnyInvocable<void(absl::StatusOr<int> release_fd)> on_release_fd);
@@ -505,7 +541,10 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
   bool HandleReadLocked(absl::Status& status)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
   void MaybeMakeReadSlices() ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
+  void UpdateRcvBufForMemoryPressure(double pressure)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
   bool TcpDoRead(absl::Status& status) ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
+  size_t TcpZerocopyReceive() ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
   void FinishEstimate();
   void AddToEstimate(size_t bytes);
   void MaybePostReclaimer() ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
@@ -516,6 +555,18 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
   bool DoFlushZerocopy(TcpZerocopySendRecord* record, absl::Status& status);
   bool TcpFlushZerocopy(TcpZerocopySendRecord* record, absl::Status& status);
   bool TcpFlush(absl::Status& status);
+  // Write coalescing helpers. MaybeCoalesceWrite returns std::nullopt if the
+  // write should take the regular path, and the result of Write otherwise.
+  std::optional<bool> MaybeCoalesceWrite(
+      absl::AnyInvocable<void(absl::Status)>& on_writable,
+      grpc_event_engine::experimental::SliceBuffer* data,
+      const grpc_event_engine::experimental::EventEngine::Endpoint::WriteArgs*
+          args) ABSL_LOCKS_EXCLUDED(coalesce_mu_);
+  bool FlushCoalescedLocked(absl::Status& status)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(coalesce_mu_);
+  void HandleCoalescedWrite(absl::Status status)
+      ABSL_LOCKS_EXCLUDED(coalesce_mu_);
+  void HandleCoalesceTimer() ABSL_LOCKS_EXCLUDED(coalesce_mu_);
   void TcpShutdownTracedBufferList();
   void UnrefMaybePutZerocopySendRecord(TcpZerocopySendRecord* record);
   void ZerocopyDisableAndWaitForRemaining();
@@ -539,6 +590,10 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
   int min_read_chunk_size_;
   int max_read_chunk_size_;
   int set_rcvlowat_ = 0;
+  // SO_RCVBUF as it was before memory pressure first shrank it, and as last
+  // set since; zero until then.
+  int unshrunk_rcvbuf_ ABSL_GUARDED_BY(read_mu_) = 0;
+  int set_rcvbuf_ ABSL_GUARDED_BY(read_mu_) = 0;
   double bytes_read_this_round_ = 0;
   std::atomic<int> ref_count_{1};
 
@@ -590,10 +645,32 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
   std::atomic<bool> stop_error_notification_{false};
   std::unique_ptr<TcpZerocopySendCtx> tcp_zerocopy_send_ctx_;
   TcpZerocopySendRecord* current_zerocopy_send_ = nullptr;
+  std::unique_ptr<TcpZerocopyReceiveCtx> tcp_zerocopy_receive_ctx_;
   // A hint from upper layers specifying the minimum number of bytes that need
   // to be read to make meaningful progress.
   int min_progress_size_ = 1;
   TracedBufferList traced_buffers_;
+  // Write coalescing state. While coalescing is active (bytes are held or
+  // being flushed), every write goes through coalesced_buffer_ so that bytes
+  // leave the socket in order; the regular write path is only taken when it
+  // is idle, so both paths never use outgoing_buffer_ at the same time.
+  grpc_event_engine::experimental::EventEngine::Duration
+      write_coalescing_delay_;
+  size_t write_coalescing_max_bytes_;
+  PosixEngineClosure* on_coalesced_write_ = nullptr;
+  grpc_core::Mutex coalesce_mu_;
+  grpc_event_engine::experimental::SliceBuffer coalesced_buffer_
+      ABSL_GUARDED_BY(coalesce_mu_);
+  std::optional<grpc_event_engine::experimental::EventEngine::TaskHandle>
+      coalesce_timer_ ABSL_GUARDED_BY(coalesce_mu_);
+  // True while coalesced_buffer_ waits for the socket to become writable.
+  bool coalesced_flush_in_progress_ ABSL_GUARDED_BY(coalesce_mu_) = false;
+  // The callback of a write that has to wait for that flush to finish.
+  absl::AnyInvocable<void(absl::Status)> coalesced_write_cb_
+      ABSL_GUARDED_BY(coalesce_mu_);
+  // Failure to send bytes whose writes already completed; reported by the
+  // next write.
+  absl::Status coalesced_write_error_ ABSL_GUARDED_BY(coalesce_mu_);
   // The handle is owned by the PosixEndpointImpl object.
   EventHandle* handle_;
   PosixEventPoller* poller_;
@@ -639,6 +716,11 @@ class PosixEndpoint : public PosixEndpointWithFdSupport {
 
   bool CanTrackErrors() override { return impl_->CanTrackErrors(); }
 
+  std::optional<grpc_core::TcpTracerInterface::ConnectionMetrics> GetTcpInfo()
+      override {
+    return impl_->GetTcpInfo();
+  }
+
   void Shutdown(absl::AnyInvocable<void(absl::StatusOr<int> release_fd)>
                     on_release_fd) override {
     if (!shutdown_.exchange(true, std::memory_order_acq_rel)) {
@@ -700,6 +782,12 @@ class PosixEndpoint : public PosixEndpointWithFdSupport {
         "PosixEndpoint::CanTrackErrors not supported on this platform");
   }
 
+  std::optional<grpc_core::TcpTracerInterface::ConnectionMetrics> GetTcpInfo()
+      override {
+    grpc_core::Crash(
+        "PosixEndpoint::GetTcpInfo not supported on this platform");
+  }
+
   void Shutdown(absl::AnyInvocable<void(absl::StatusOr<int> release_fd)>
                     on_release_fd) override {
     grpc_core::Crash("PosixEndpoint::Shutdown not supported on this platform");
@@ -38,6 +38,7 @@
 #include "absl/strings/str_cat.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/event_engine/ares_resolver.h"
+#include "src/core/lib/event_engine/caching_dns_resolver.h"
 #include "src/core/lib/event_engine/forkable.h"
 #include "src/core/lib/event_engine/grpc_polled_fd.h"
 #include "src/core/lib/event_engine/poller.h"
@@ -48,6 +49,7 @@
 #include "src/core/lib/event_engine/posix_engine/timer.h"
 #include "src/core/lib/event_engine/tcp_socket_utils.h"
 #include "src/core/lib/event_engine/utils.h"
+#include "src/core/lib/event_engine/work_priority.h"
 #include "src/core/lib/experiments/experiments.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/no_destruct.h"
@@ -328,16 +330,18 @@ PosixEnginePollerManager::PosixEnginePollerManager(
   ABSL_DCHECK_NE(poller_, nullptr);
 }
 
+// Everything the poller schedules is socket readiness work, which sits on the
+// transport I/O path.
 void PosixEnginePollerManager::Run(
     experimental::EventEngine::Closure* closure) {
   if (executor_ != nullptr) {
-    executor_->Run(closure);
+    executor_->Run(closure, WorkPriority::kTransportIo);
   }
 }
 
 void PosixEnginePollerManager::Run(absl::AnyInvocable<void()> cb) {
   if (executor_ != nullptr) {
-    executor_->Run(std::move(cb));
+    executor_->Run(std::move(cb), WorkPriority::kTransportIo);
   }
 }
 
@@ -390,9 +394,11 @@ PosixEventEngine::PosixEventEngine()
   // The threadpool must be instantiated after the poller otherwise, the
   // process will deadlock when forking.
   if (poller_manager_->Poller() != nullptr) {
-    executor_->Run([poller_manager = poller_manager_]() {
-      PollerWorkInternal(poller_manager);
-    });
+    executor_->Run(
+        [poller_manager = poller_manager_]() {
+          PollerWorkInternal(poller_manager);
+        },
+        WorkPriority::kTransportIo);
   }
 #endif  // GRPC_PLATFORM_SUPPORTS_POSIX_POLLING
 }
@@ -404,16 +410,20 @@ void PosixEventEngine::PollerWorkInternal(
   PosixEventPoller* poller = poller_manager->Poller();
   ThreadPool* executor = poller_manager->Executor();
   auto result = poller->Work(24h, [executor, &poller_manager]() {
-    executor->Run([poller_manager]() mutable {
-      PollerWorkInternal(std::move(poller_manager));
-    });
+    executor->Run(
+        [poller_manager]() mutable {
+          PollerWorkInternal(std::move(poller_manager));
+        },
+        WorkPriority::kTransportIo);
   });
   if (result == Poller::WorkResult::kDeadlineExceeded) {
     // The EventEngine is not shutting down but the next asynchronous
     // PollerWorkInternal did not get scheduled. Schedule it now.
-    executor->Run([poller_manager = std::move(poller_manager)]() {
-      PollerWorkInternal(poller_manager);
-    });
+    executor->Run(
+        [poller_manager = std::move(poller_manager)]() {
+          PollerWorkInternal(poller_manager);
+        },
+        WorkPriority::kTransportIo);
   } else if (result == Poller::WorkResult::kKicked &&
              poller_manager->IsShuttingDown()) {
     // The Poller Got Kicked and poller_state_ is set to
@@ -491,14 +501,41 @@ EventEngine::TaskHandle PosixEventEngine::RunAfter(
   return RunAfterInternal(when, [closure]() { closure->Run(); });
 }
 
+Scheduler* PosixEventEngine::CurrentPollerShard() {
+#ifdef GRPC_POSIX_SOCKET_TCP
+  if (!grpc_core::IsEventEngineShardLocalRunEnabled() ||
+      poller_manager_ == nullptr || poller_manager_->Poller() == nullptr) {
+    return nullptr;
+  }
+  return poller_manager_->Poller()->CurrentShard();
+#else   // GRPC_POSIX_SOCKET_TCP
+  return nullptr;
+#endif  // GRPC_POSIX_SOCKET_TCP
+}
+
 void PosixEventEngine::Run(absl::AnyInvocable<void()> closure) {
+  // Work scheduled from a poller shard stays on it, next to the endpoints
+  // whose callbacks scheduled it.
+  if (Scheduler* shard = CurrentPollerShard()) {
+    shard->Run(std::move(closure));
+    return;
+  }
   executor_->Run(std::move(closure));
 }
 
 void PosixEventEngine::Run(EventEngine::Closure* closure) {
+  if (Scheduler* shard = CurrentPollerShard()) {
+    shard->Run(closure);
+    return;
+  }
   executor_->Run(closure);
 }
 
+void PosixEventEngine::RunWithPriority(WorkPriority priority,
+                                       absl::AnyInvocable<void()> closure) {
+  executor_->Run(std::move(closure), priority);
+}
+
 EventEngine::TaskHandle PosixEventEngine::RunAfterInternal(
     Duration when, absl::AnyInvocable<void()> cb) {
   if (when <= Duration::zero()) {
@@ -559,8 +596,14 @@ PosixEventEngine::GetDNSResolver(
     if (!ares_resolver.ok()) {
       return ares_resolver.status();
     }
+    grpc_core::OrphanablePtr<RefCountedDNSResolverInterface> resolver =
+        std::move(*ares_resolver);
+    if (grpc_core::IsEventEngineDnsCacheEnabled()) {
+      resolver = grpc_core::MakeOrphanable<CachingDNSResolver>(
+          std::move(resolver), options.dns_server, shared_from_this());
+    }
     return std::make_unique<PosixEventEngine::PosixDNSResolver>(
-        std::move(*ares_resolver));
+        std::move(resolver));
 #endif  // GRPC_ARES == 1 && defined(GRPC_POSIX_SOCKET_ARES_EV_DRIVER)
   }
   GRPC_TRACE_LOG(event_engine_dns, INFO)
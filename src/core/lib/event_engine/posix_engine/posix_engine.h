@@ -38,6 +38,7 @@
 #include "src/core/lib/event_engine/posix_engine/timer_manager.h"
 #include "src/core/lib/event_engine/ref_counted_dns_resolver_interface.h"
 #include "src/core/lib/event_engine/thread_pool/thread_pool.h"
+#include "src/core/lib/event_engine/work_priority.h"
 #include "src/core/lib/iomgr/port.h"
 #include "src/core/lib/surface/init_internally.h"
 #include "src/core/util/orphanable.h"
@@ -202,6 +203,8 @@ class PosixEventEngine final : public PosixEventEngineWithFdSupport,
       GRPC_UNUSED const DNSResolver::ResolverOptions& options) override;
   void Run(Closure* closure) override;
   void Run(absl::AnyInvocable<void()> closure) override;
+  void RunWithPriority(WorkPriority priority,
+                       absl::AnyInvocable<void()> closure) override;
   // Caution!! The timer implementation cannot create any fds. See #20418.
   TaskHandle RunAfter(Duration when, Closure* closure) override;
   TaskHandle RunAfter(Duration when,
@@ -225,6 +228,9 @@ class PosixEventEngine final : public PosixEventEngineWithFdSupport,
   struct ClosureData;
   EventEngine::TaskHandle RunAfterInternal(Duration when,
                                            absl::AnyInvocable<void()> cb);
+  // The poller shard served by the calling thread, if closures it schedules
+  // should stay there.
+  Scheduler* CurrentPollerShard();
 
 #ifdef GRPC_POSIX_SOCKET_TCP
   friend class AsyncConnect;
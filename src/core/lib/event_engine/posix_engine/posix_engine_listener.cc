@@ -117,6 +117,48 @@ absl::StatusOr<int> PosixEngineListenerImpl::Bind(
   return result->port;
 }
 
+void PosixEngineListenerImpl::ListenerAsyncAcceptors::AppendShardSockets(
+    const ListenerSocket& socket) {
+  PosixEventPoller* poller = listener_->poller_;
+  const int num_shards = poller->NumShards();
+  if (num_shards <= 1 || !listener_->options_.allow_reuse_port ||
+      socket.addr.address()->sa_family == AF_UNIX ||
+      ResolvedAddressIsVSock(socket.addr)) {
+    return;
+  }
+  PosixSocketWrapper first_sock = socket.sock;
+  int cpu = poller->ShardIncomingCpu(0);
+  if (cpu >= 0) {
+    (void)first_sock.SetSocketIncomingCpu(cpu);
+  }
+  EventEngine::ResolvedAddress addr = socket.addr;
+  ResolvedAddressSetPort(addr, socket.port);
+  for (int shard = 1; shard < num_shards; ++shard) {
+    auto result = CreateAndPrepareListenerSocket(listener_->options_, addr);
+    if (!result.ok()) {
+      ABSL_LOG(ERROR) << "Failed to create a listening socket for shard "
+                      << shard << ": " << result.status();
+      return;
+    }
+    cpu = poller->ShardIncomingCpu(shard);
+    if (cpu >= 0) {
+      (void)result->sock.SetSocketIncomingCpu(cpu);
+    }
+    acceptors_.push_back(new AsyncConnectionAcceptor(
+        listener_->engine_, listener_->shared_from_this(), *result, shard));
+    if (on_append_) {
+      on_append_(result->sock.Fd());
+    }
+  }
+  // The sockets joined the SO_REUSEPORT group in shard order, so picking the
+  // socket at index (cpu % num_shards) picks the shard of that CPU. Without
+  // the program, SO_INCOMING_CPU only matches each shard's first CPU.
+  auto status = first_sock.SetSocketReusePortCpuSteering(num_shards);
+  if (!status.ok()) {
+    ABSL_VLOG(2) << "Listener shards rely on SO_INCOMING_CPU only: " << status;
+  }
+}
+
 void PosixEngineListenerImpl::AsyncConnectionAcceptor::Start() {
   Ref();
   handle_->NotifyOnRead(notify_on_accept_);
@@ -132,6 +174,15 @@ void PosixEngineListenerImpl::AsyncConnectionAcceptor::NotifyOnAccept(
     Unref();
     return;
   }
+  // Set up the exec contexts once for the whole drain rather than for every
+  // accepted connection. Work scheduled by on_accept_ is still flushed after
+  // each connection, so handshakes start as soon as they are accepted.
+  std::optional<grpc_core::ApplicationCallbackExecCtx> app_exec_ctx;
+  std::optional<grpc_core::ExecCtx> exec_ctx;
+  if (grpc_core::ExecCtx::Get() == nullptr) {
+    app_exec_ctx.emplace();
+    exec_ctx.emplace();
+  }
   // loop until accept4 returns EAGAIN, and then re-arm notification.
   for (;;) {
     EventEngine::ResolvedAddress addr;
@@ -233,19 +284,17 @@ void PosixEngineListenerImpl::AsyncConnectionAcceptor::NotifyOnAccept(
             absl::StrCat("endpoint-tcp-server-connection: ", *peer_name)),
         /*options=*/listener_->options_);
 
-    grpc_core::EnsureRunInExecCtx([this, peer_name = std::move(*peer_name),
-                                   endpoint = std::move(endpoint)]() mutable {
-      // Call on_accept_ and then resume accepting new connections
-      // by continuing the parent for-loop.
-      listener_->on_accept_(
-          /*listener_fd=*/handle_->WrappedFd(),
-          /*endpoint=*/std::move(endpoint),
-          /*is_external=*/false,
-          /*memory_allocator=*/
-          listener_->memory_allocator_factory_->CreateMemoryAllocator(
-              absl::StrCat("on-accept-tcp-server-connection: ", peer_name)),
-          /*pending_data=*/nullptr);
-    });
+    // Call on_accept_ and then resume accepting new connections by continuing
+    // the for-loop.
+    listener_->on_accept_(
+        /*listener_fd=*/handle_->WrappedFd(),
+        /*endpoint=*/std::move(endpoint),
+        /*is_external=*/false,
+        /*memory_allocator=*/
+        listener_->memory_allocator_factory_->CreateMemoryAllocator(
+            absl::StrCat("on-accept-tcp-server-connection: ", *peer_name)),
+        /*pending_data=*/nullptr);
+    if (exec_ctx.has_value()) exec_ctx->Flush();
   }
   GPR_UNREACHABLE_CODE(return);
 }
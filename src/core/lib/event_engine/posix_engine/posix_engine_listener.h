@@ -80,15 +80,16 @@ class PosixEngineListenerImpl
    public:
     AsyncConnectionAcceptor(std::shared_ptr<EventEngine> engine,
                             std::shared_ptr<PosixEngineListenerImpl> listener,
-                            ListenerSocketsContainer::ListenerSocket socket)
+                            ListenerSocketsContainer::ListenerSocket socket,
+                            int shard = 0)
         : engine_(std::move(engine)),
           listener_(std::move(listener)),
           socket_(socket),
-          handle_(listener_->poller_->CreateHandle(
+          handle_(listener_->poller_->CreateHandleOnShard(
               socket_.sock.Fd(),
               *grpc_event_engine::experimental::
                   ResolvedAddressToNormalizedString(socket_.addr),
-              listener_->poller_->CanTrackErrors())),
+              listener_->poller_->CanTrackErrors(), shard)),
           notify_on_accept_(PosixEngineClosure::ToPermanentClosure(
               [this](absl::Status status) { NotifyOnAccept(status); })) {};
     // Start listening for incoming connections on the socket.
@@ -142,6 +143,7 @@ class PosixEngineListenerImpl
       if (on_append_) {
         on_append_(socket.sock.Fd());
       }
+      AppendShardSockets(socket);
     }
 
     absl::StatusOr<ListenerSocket> Find(
@@ -167,6 +169,11 @@ class PosixEngineListenerImpl
     }
 
    private:
+    // If the poller is sharded, add one more socket listening on the same
+    // port for each other shard, with the connections steered to the socket
+    // of the shard whose CPU receives them.
+    void AppendShardSockets(const ListenerSocket& socket);
+
     PosixListenerWithFdSupport::OnPosixBindNewFdCallback on_append_;
     std::list<AsyncConnectionAcceptor*> acceptors_;
     PosixEngineListenerImpl* listener_;
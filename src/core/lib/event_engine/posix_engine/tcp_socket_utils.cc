@@ -26,6 +26,8 @@
 #include "absl/cleanup/cleanup.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/port.h"
 #include "src/core/util/crash.h"  // IWYU pragma: keep
 #include "src/core/util/time.h"
@@ -42,6 +44,9 @@
 #include <fcntl.h>
 #include <sys/socket.h>
 #include <unistd.h>
+#ifdef GRPC_LINUX_SOCKETUTILS
+#include <linux/filter.h>
+#endif
 #endif  //  GRPC_POSIX_SOCKET_UTILS_COMMON
 
 #include <atomic>
@@ -117,26 +122,52 @@ int CreateSocket(std::function<int(int, int, int)> socket_factory, int family,
   return res;
 }
 
+// Sets an int option to 1 on a socket we just created, without reading it
+// back as the PosixSocketWrapper setters do: on a fresh socket, setsockopt()
+// succeeding is check enough, and connection setup is syscall bound.
+absl::Status EnableFreshSocketOption(int fd, int level, int name,
+                                     absl::string_view name_str) {
+  const int val = 1;
+  if (0 != setsockopt(fd, level, name, &val, sizeof(val))) {
+    return absl::InternalError(absl::StrCat(
+        "setsockopt(", name_str, "): ", grpc_core::StrError(errno)));
+  }
+  return absl::OkStatus();
+}
+
+// created_nonblocking_cloexec is true if the socket was created with
+// SOCK_NONBLOCK and SOCK_CLOEXEC.
 absl::Status PrepareTcpClientSocket(PosixSocketWrapper sock,
                                     const EventEngine::ResolvedAddress& addr,
-                                    const PosixTcpOptions& options) {
+                                    const PosixTcpOptions& options,
+                                    bool created_nonblocking_cloexec) {
   bool close_fd = true;
   auto sock_cleanup = absl::MakeCleanup([&close_fd, &sock]() -> void {
     if (close_fd and sock.Fd() >= 0) {
       close(sock.Fd());
     }
   });
-  GRPC_RETURN_IF_ERROR(sock.SetSocketNonBlocking(1));
-  GRPC_RETURN_IF_ERROR(sock.SetSocketCloexec(1));
+  if (!created_nonblocking_cloexec) {
+    GRPC_RETURN_IF_ERROR(sock.SetSocketNonBlocking(1));
+    GRPC_RETURN_IF_ERROR(sock.SetSocketCloexec(1));
+  }
   if (options.tcp_receive_buffer_size != options.kReadBufferSizeUnset) {
     GRPC_RETURN_IF_ERROR(sock.SetSocketRcvBuf(options.tcp_receive_buffer_size));
   }
   if (addr.address()->sa_family != AF_UNIX && !ResolvedAddressIsVSock(addr)) {
     // If its not a unix socket or vsock address.
-    GRPC_RETURN_IF_ERROR(sock.SetSocketLowLatency(1));
-    GRPC_RETURN_IF_ERROR(sock.SetSocketReuseAddr(1));
+    if (grpc_core::IsPosixLeanClientSocketSetupEnabled()) {
+      GRPC_RETURN_IF_ERROR(EnableFreshSocketOption(sock.Fd(), IPPROTO_TCP,
+                                                   TCP_NODELAY, "TCP_NODELAY"));
+      GRPC_RETURN_IF_ERROR(EnableFreshSocketOption(
+          sock.Fd(), SOL_SOCKET, SO_REUSEADDR, "SO_REUSEADDR"));
+    } else {
+      GRPC_RETURN_IF_ERROR(sock.SetSocketLowLatency(1));
+      GRPC_RETURN_IF_ERROR(sock.SetSocketReuseAddr(1));
+    }
     GRPC_RETURN_IF_ERROR(sock.SetSocketDscp(options.dscp));
     sock.TrySetSocketTcpUserTimeout(options, true);
+    if (options.tcp_fast_open_connect) sock.TrySetSocketTcpFastOpenConnect();
   }
   GRPC_RETURN_IF_ERROR(sock.SetSocketNoSigpipeIfPossible());
   GRPC_RETURN_IF_ERROR(sock.ApplySocketMutatorInOptions(
@@ -187,6 +218,18 @@ PosixTcpOptions TcpOptionsFromEndpointConfig(const EndpointConfig& config) {
   options.tcp_tx_zero_copy_enabled =
       (AdjustValue(PosixTcpOptions::kZerocpTxEnabledDefault, 0, 1,
                    config.GetInt(GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED)) != 0);
+  options.tcp_rx_zerocopy_receive_bytes_threshold = AdjustValue(
+      PosixTcpOptions::kDefaultReceiveBytesThreshold, 0, INT_MAX,
+      config.GetInt(GRPC_ARG_TCP_RX_ZEROCOPY_RECEIVE_BYTES_THRESHOLD));
+  options.tcp_rx_zero_copy_enabled =
+      (AdjustValue(PosixTcpOptions::kZerocpRxEnabledDefault, 0, 1,
+                   config.GetInt(GRPC_ARG_TCP_RX_ZEROCOPY_ENABLED)) != 0);
+  options.tcp_write_coalescing_delay_us =
+      AdjustValue(PosixTcpOptions::kWriteCoalescingDisabled, 0, INT_MAX,
+                  config.GetInt(GRPC_ARG_TCP_WRITE_COALESCING_DELAY_US));
+  options.tcp_write_coalescing_max_bytes =
+      AdjustValue(PosixTcpOptions::kDefaultWriteCoalescingMaxBytes, 1, INT_MAX,
+                  config.GetInt(GRPC_ARG_TCP_WRITE_COALESCING_MAX_BYTES));
   options.keep_alive_time_ms =
       AdjustValue(0, 1, INT_MAX, config.GetInt(GRPC_ARG_KEEPALIVE_TIME_MS));
   options.keep_alive_timeout_ms =
@@ -196,6 +239,9 @@ PosixTcpOptions TcpOptionsFromEndpointConfig(const EndpointConfig& config) {
                    config.GetInt(GRPC_ARG_EXPAND_WILDCARD_ADDRS)) != 0);
   options.dscp = AdjustValue(PosixTcpOptions::kDscpNotSet, 0, 63,
                              config.GetInt(GRPC_ARG_DSCP));
+  options.tcp_fast_open_connect =
+      (AdjustValue(0, 1, INT_MAX,
+                   config.GetInt(GRPC_ARG_TCP_FAST_OPEN_CONNECT)) != 0);
   options.allow_reuse_port = PosixSocketWrapper::IsSocketReusePortSupported();
   auto allow_reuse_port_value = config.GetInt(GRPC_ARG_ALLOW_REUSEPORT);
   if (allow_reuse_port_value.has_value()) {
@@ -422,6 +468,22 @@ absl::Status PosixSocketWrapper::SetSocketRcvBuf(int buffer_size_bytes) {
                                          grpc_core::StrError(errno)));
 }
 
+absl::StatusOr<int> PosixSocketWrapper::GetSocketRcvBuf() {
+  int buffer_size_bytes = 0;
+  socklen_t len = sizeof(buffer_size_bytes);
+  if (getsockopt(fd_, SOL_SOCKET, SO_RCVBUF, &buffer_size_bytes, &len) != 0) {
+    return absl::Status(absl::StatusCode::kInternal,
+                        absl::StrCat("getsockopt(SO_RCVBUF): ",
+                                     grpc_core::StrError(errno)));
+  }
+#ifdef GPR_LINUX
+  // Linux doubles the value it is given to leave room for bookkeeping, and
+  // reports the doubled value.
+  buffer_size_bytes /= 2;
+#endif  // GPR_LINUX
+  return buffer_size_bytes;
+}
+
 // Set a socket to close on exec
 absl::Status PosixSocketWrapper::SetSocketCloexec(int close_on_exec) {
   int oldflags = fcntl(fd_, F_GETFD, 0);
@@ -495,6 +557,50 @@ absl::Status PosixSocketWrapper::SetSocketReusePort(int reuse) {
 #endif
 }
 
+absl::Status PosixSocketWrapper::SetSocketIncomingCpu(int cpu) {
+#ifndef SO_INCOMING_CPU
+  return absl::Status(absl::StatusCode::kInternal,
+                      "SO_INCOMING_CPU unavailable on compiling system");
+#else
+  if (0 != setsockopt(fd_, SOL_SOCKET, SO_INCOMING_CPU, &cpu, sizeof(cpu))) {
+    return absl::Status(absl::StatusCode::kInternal,
+                        absl::StrCat("setsockopt(SO_INCOMING_CPU): ",
+                                     grpc_core::StrError(errno)));
+  }
+  return absl::OkStatus();
+#endif
+}
+
+absl::Status PosixSocketWrapper::SetSocketReusePortCpuSteering(
+    int num_sockets) {
+#if !defined(GRPC_LINUX_SOCKETUTILS) || !defined(SO_ATTACH_REUSEPORT_CBPF)
+  return absl::Status(
+      absl::StatusCode::kInternal,
+      "SO_ATTACH_REUSEPORT_CBPF unavailable on compiling system");
+#else
+  if (num_sockets <= 0) {
+    return absl::InvalidArgumentError("num_sockets must be positive");
+  }
+  // A = current cpu; A = A % num_sockets; return A.
+  struct sock_filter code[] = {
+      BPF_STMT(BPF_LD | BPF_W | BPF_ABS,
+               static_cast<uint32_t>(SKF_AD_OFF + SKF_AD_CPU)),
+      BPF_STMT(BPF_ALU | BPF_MOD | BPF_K, static_cast<uint32_t>(num_sockets)),
+      BPF_STMT(BPF_RET | BPF_A, 0),
+  };
+  struct sock_fprog prog;
+  prog.len = sizeof(code) / sizeof(code[0]);
+  prog.filter = code;
+  if (0 != setsockopt(fd_, SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &prog,
+                      sizeof(prog))) {
+    return absl::Status(absl::StatusCode::kInternal,
+                        absl::StrCat("setsockopt(SO_ATTACH_REUSEPORT_CBPF): ",
+                                     grpc_core::StrError(errno)));
+  }
+  return absl::OkStatus();
+#endif
+}
+
 bool PosixSocketWrapper::IsSocketReusePortSupported() {
   static bool kSupportSoReusePort = []() -> bool {
     int s = socket(AF_INET, SOCK_STREAM, 0);
@@ -665,6 +771,22 @@ void PosixSocketWrapper::TrySetSocketTcpUserTimeout(
   }
 }
 
+#if GPR_LINUX == 1 && !defined(TCP_FASTOPEN_CONNECT)
+// Older libc headers may lack it; kernels before 4.11 reject it.
+#define TCP_FASTOPEN_CONNECT 30
+#endif
+
+void PosixSocketWrapper::TrySetSocketTcpFastOpenConnect() {
+#ifdef TCP_FASTOPEN_CONNECT
+  const int val = 1;
+  if (0 != setsockopt(fd_, IPPROTO_TCP, TCP_FASTOPEN_CONNECT, &val,
+                      sizeof(val))) {
+    GRPC_TRACE_LOG(tcp, INFO) << "setsockopt(TCP_FASTOPEN_CONNECT): "
+                              << grpc_core::StrError(errno);
+  }
+#endif  // TCP_FASTOPEN_CONNECT
+}
+
 // Set a socket using a grpc_socket_mutator
 absl::Status PosixSocketWrapper::SetSocketMutator(
     grpc_fd_usage usage, grpc_socket_mutator* mutator) {
@@ -801,9 +923,18 @@ PosixSocketWrapper::CreateAndPrepareTcpClientSocket(
     // addr is v4 mapped to v6 or just v6.
     mapped_target_addr = target_addr;
   }
+  int type = SOCK_STREAM;
+  bool created_nonblocking_cloexec = false;
+#ifdef GRPC_LINUX_SOCKETUTILS
+  // Saves the four fcntl() calls of setting these flags afterwards.
+  if (grpc_core::IsPosixLeanClientSocketSetupEnabled()) {
+    type |= SOCK_NONBLOCK | SOCK_CLOEXEC;
+    created_nonblocking_cloexec = true;
+  }
+#endif  // GRPC_LINUX_SOCKETUTILS
   absl::StatusOr<PosixSocketWrapper> posix_socket_wrapper =
       PosixSocketWrapper::CreateDualStackSocket(nullptr, mapped_target_addr,
-                                                SOCK_STREAM, 0, dsmode);
+                                                type, 0, dsmode);
   if (!posix_socket_wrapper.ok()) {
     return posix_socket_wrapper.status();
   }
@@ -816,7 +947,7 @@ PosixSocketWrapper::CreateAndPrepareTcpClientSocket(
   }
 
   auto error = PrepareTcpClientSocket(*posix_socket_wrapper, mapped_target_addr,
-                                      options);
+                                      options, created_nonblocking_cloexec);
   if (!error.ok()) {
     return error;
   }
@@ -854,6 +985,15 @@ absl::Status PosixSocketWrapper::SetSocketReusePort(int /*reuse*/) {
   grpc_core::Crash("unimplemented");
 }
 
+absl::Status PosixSocketWrapper::SetSocketIncomingCpu(int /*cpu*/) {
+  grpc_core::Crash("unimplemented");
+}
+
+absl::Status PosixSocketWrapper::SetSocketReusePortCpuSteering(
+    int /*num_sockets*/) {
+  grpc_core::Crash("unimplemented");
+}
+
 absl::Status PosixSocketWrapper::SetSocketDscp(int /*dscp*/) {
   grpc_core::Crash("unimplemented");
 }
@@ -867,6 +1007,10 @@ void PosixSocketWrapper::TrySetSocketTcpUserTimeout(
   grpc_core::Crash("unimplemented");
 }
 
+void PosixSocketWrapper::TrySetSocketTcpFastOpenConnect() {
+  grpc_core::Crash("unimplemented");
+}
+
 absl::Status PosixSocketWrapper::SetSocketNoSigpipeIfPossible() {
   grpc_core::Crash("unimplemented");
 }
@@ -887,6 +1031,10 @@ absl::Status PosixSocketWrapper::SetSocketRcvBuf(int /*buffer_size_bytes*/) {
   grpc_core::Crash("unimplemented");
 }
 
+absl::StatusOr<int> PosixSocketWrapper::GetSocketRcvBuf() {
+  grpc_core::Crash("unimplemented");
+}
+
 absl::Status PosixSocketWrapper::SetSocketMutator(
     grpc_fd_usage /*usage*/, grpc_socket_mutator* /*mutator*/) {
   grpc_core::Crash("unimplemented");
@@ -56,6 +56,10 @@ struct PosixTcpOptions {
   static constexpr int kMaxChunkSize = 32 * 1024 * 1024;
   static constexpr int kDefaultMaxSends = 4;
   static constexpr size_t kDefaultSendBytesThreshold = 16 * 1024;
+  static constexpr int kZerocpRxEnabledDefault = 0;
+  static constexpr size_t kDefaultReceiveBytesThreshold = 64 * 1024;
+  static constexpr int kWriteCoalescingDisabled = 0;
+  static constexpr int kDefaultWriteCoalescingMaxBytes = 16 * 1024;
   // Let the system decide the proper buffer size.
   static constexpr int kReadBufferSizeUnset = -1;
   static constexpr int kDscpNotSet = -1;
@@ -66,11 +70,16 @@ struct PosixTcpOptions {
   int tcp_tx_zerocopy_max_simultaneous_sends = kDefaultMaxSends;
   int tcp_receive_buffer_size = kReadBufferSizeUnset;
   bool tcp_tx_zero_copy_enabled = kZerocpTxEnabledDefault;
+  int tcp_rx_zerocopy_receive_bytes_threshold = kDefaultReceiveBytesThreshold;
+  bool tcp_rx_zero_copy_enabled = kZerocpRxEnabledDefault;
+  int tcp_write_coalescing_delay_us = kWriteCoalescingDisabled;
+  int tcp_write_coalescing_max_bytes = kDefaultWriteCoalescingMaxBytes;
   int keep_alive_time_ms = 0;
   int keep_alive_timeout_ms = 0;
   bool expand_wildcard_addrs = false;
   bool allow_reuse_port = false;
   int dscp = kDscpNotSet;
+  bool tcp_fast_open_connect = false;
   grpc_core::RefCountedPtr<grpc_core::ResourceQuota> resource_quota;
   struct grpc_socket_mutator* socket_mutator = nullptr;
   grpc_event_engine::experimental::MemoryAllocatorFactory*
@@ -137,11 +146,17 @@ struct PosixTcpOptions {
     tcp_tx_zerocopy_max_simultaneous_sends =
         other.tcp_tx_zerocopy_max_simultaneous_sends;
     tcp_tx_zero_copy_enabled = other.tcp_tx_zero_copy_enabled;
+    tcp_rx_zerocopy_receive_bytes_threshold =
+        other.tcp_rx_zerocopy_receive_bytes_threshold;
+    tcp_rx_zero_copy_enabled = other.tcp_rx_zero_copy_enabled;
+    tcp_write_coalescing_delay_us = other.tcp_write_coalescing_delay_us;
+    tcp_write_coalescing_max_bytes = other.tcp_write_coalescing_max_bytes;
     keep_alive_time_ms = other.keep_alive_time_ms;
     keep_alive_timeout_ms = other.keep_alive_timeout_ms;
     expand_wildcard_addrs = other.expand_wildcard_addrs;
     allow_reuse_port = other.allow_reuse_port;
     dscp = other.dscp;
+    tcp_fast_open_connect = other.tcp_fast_open_connect;
   }
 };
 
@@ -189,6 +204,15 @@ class PosixSocketWrapper {
   // Set SO_REUSEPORT
   absl::Status SetSocketReusePort(int reuse);
 
+  // Set SO_INCOMING_CPU: among listening sockets sharing a port through
+  // SO_REUSEPORT, prefer this one for connections processed on `cpu`.
+  absl::Status SetSocketIncomingCpu(int cpu);
+
+  // Attach a reuseport program to this socket's SO_REUSEPORT group which
+  // picks the listening socket at index (cpu % num_sockets), the index being
+  // the order in which the sockets of the group started listening.
+  absl::Status SetSocketReusePortCpuSteering(int num_sockets);
+
   // Set Differentiated Services Code Point (DSCP)
   absl::Status SetSocketDscp(int dscp);
 
@@ -196,6 +220,10 @@ class PosixSocketWrapper {
   void TrySetSocketTcpUserTimeout(const PosixTcpOptions& options,
                                   bool is_client);
 
+  // Tries to set TCP_FASTOPEN_CONNECT, if available on this platform.
+  // Failure is not an error: the connect then just goes without Fast Open.
+  void TrySetSocketTcpFastOpenConnect();
+
   // Tries to set SO_NOSIGPIPE if available on this platform.
   // If SO_NO_SIGPIPE is not available, returns not OK status.
   absl::Status SetSocketNoSigpipeIfPossible();
@@ -214,6 +242,10 @@ class PosixSocketWrapper {
   // Tries to set the socket's receive buffer to given size.
   absl::Status SetSocketRcvBuf(int buffer_size_bytes);
 
+  // Returns the socket's receive buffer size, in the units SetSocketRcvBuf
+  // takes.
+  absl::StatusOr<int> GetSocketRcvBuf();
+
   // Tries to set the socket using a grpc_socket_mutator
   absl::Status SetSocketMutator(grpc_fd_usage usage,
                                 grpc_socket_mutator* mutator);
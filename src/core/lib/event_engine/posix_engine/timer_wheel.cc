@@ -0,0 +1,277 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/timer_wheel.h"
+
+#include <grpc/support/cpu.h>
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include "absl/numeric/bits.h"
+#include "src/core/util/useful.h"
+
+namespace grpc_event_engine::experimental {
+
+namespace {
+// Bucket indices beyond the wheels, kept in Timer::heap_index.
+constexpr size_t kExpiredBucket = TimerWheel::kLevels * TimerWheel::kSlots;
+constexpr size_t kFarBucket = kExpiredBucket + 1;
+constexpr uint64_t kSlotMask = TimerWheel::kSlots - 1;
+constexpr uint64_t kNoEvent = std::numeric_limits<uint64_t>::max();
+
+// The log2 of the number of ticks spanned by one bucket of `level`.
+constexpr int LevelShift(int level) { return TimerWheel::kSlotBits * level; }
+
+// The number of ticks ahead of the current tick that `level` can hold.
+constexpr uint64_t LevelSpan(int level) {
+  return uint64_t{1} << LevelShift(level + 1);
+}
+
+void ListInit(Timer* head) { head->next = head->prev = head; }
+
+bool ListEmpty(const Timer* head) { return head->next == head; }
+
+void ListJoin(Timer* head, Timer* timer) {
+  timer->next = head;
+  timer->prev = head->prev;
+  timer->next->prev = timer->prev->next = timer;
+}
+
+void ListRemove(Timer* timer) {
+  timer->next->prev = timer->prev;
+  timer->prev->next = timer->next;
+}
+
+// Unlinks every timer of the list, marks it fired, and collects its closure.
+void ListFire(Timer* head,
+              std::vector<experimental::EventEngine::Closure*>* out) {
+  for (Timer* timer = head->next; timer != head; timer = timer->next) {
+    timer->pending = false;
+    out->push_back(timer->closure);
+  }
+  ListInit(head);
+}
+
+uint64_t RotateRight(uint64_t bits, uint64_t n) {
+  n &= 63;
+  return n == 0 ? bits : (bits >> n) | (bits << (64 - n));
+}
+
+int64_t TickToMillis(uint64_t tick) {
+  if (tick > static_cast<uint64_t>(std::numeric_limits<int64_t>::max())) {
+    return grpc_core::Timestamp::InfFuture().milliseconds_after_process_epoch();
+  }
+  return static_cast<int64_t>(tick);
+}
+}  // namespace
+
+TimerWheel::Shard::Shard(uint64_t now)
+    : current_tick(now),
+      next_event(std::numeric_limits<int64_t>::max()),
+      min_deadline(grpc_core::Timestamp::InfFuture()) {
+  for (Timer& bucket : buckets) ListInit(&bucket);
+  ListInit(&expired);
+  ListInit(&far);
+}
+
+void TimerWheel::Shard::Add(Timer* timer) {
+  if (timer->deadline < 0 ||
+      static_cast<uint64_t>(timer->deadline) < current_tick) {
+    timer->heap_index = kExpiredBucket;
+    ListJoin(&expired, timer);
+    return;
+  }
+  const uint64_t tick = static_cast<uint64_t>(timer->deadline);
+  const uint64_t delta = tick - current_tick;
+  for (int level = 0; level < kLevels; ++level) {
+    if (delta >= LevelSpan(level)) continue;
+    const uint64_t slot = (tick >> LevelShift(level)) & kSlotMask;
+    timer->heap_index = level * kSlots + slot;
+    ListJoin(&buckets[timer->heap_index], timer);
+    occupied[level] |= uint64_t{1} << slot;
+    return;
+  }
+  timer->heap_index = kFarBucket;
+  ListJoin(&far, timer);
+}
+
+void TimerWheel::Shard::Remove(Timer* timer) {
+  ListRemove(timer);
+  const size_t index = timer->heap_index;
+  if (index < kExpiredBucket && ListEmpty(&buckets[index])) {
+    occupied[index / kSlots] &= ~(uint64_t{1} << (index % kSlots));
+  }
+}
+
+void TimerWheel::Shard::Redistribute(Timer* head) {
+  Timer* timer = head->next;
+  ListInit(head);
+  while (timer != head) {
+    Timer* next = timer->next;
+    Add(timer);
+    timer = next;
+  }
+}
+
+uint64_t TimerWheel::Shard::NextEventTick() {
+  if (!ListEmpty(&expired)) return 0;
+  uint64_t next = kNoEvent;
+  for (int level = 0; level < kLevels; ++level) {
+    if (occupied[level] == 0) continue;
+    // The first bucket boundary of this level at or after the current tick;
+    // bucket `slot` is next reached when the boundary's low bits equal it.
+    const int shift = LevelShift(level);
+    const uint64_t boundary =
+        (current_tick + (uint64_t{1} << shift) - 1) >> shift;
+    const uint64_t ahead = static_cast<uint64_t>(
+        absl::countr_zero(RotateRight(occupied[level], boundary)));
+    next = std::min(next, (boundary + ahead) << shift);
+  }
+  if (!ListEmpty(&far)) {
+    const int shift = LevelShift(kLevels - 1);
+    const uint64_t boundary =
+        (current_tick + (uint64_t{1} << shift) - 1) >> shift;
+    next = std::min(next, boundary << shift);
+  }
+  return next;
+}
+
+void TimerWheel::Shard::Advance(
+    uint64_t now, std::vector<experimental::EventEngine::Closure*>* out) {
+  ListFire(&expired, out);
+  for (uint64_t tick = NextEventTick(); tick <= now; tick = NextEventTick()) {
+    current_tick = tick;
+    // Refill from the coarsest level down, so that a timer moved out of one
+    // level can be moved on again by the levels below within the same tick.
+    if (!ListEmpty(&far) &&
+        (tick & ((uint64_t{1} << LevelShift(kLevels - 1)) - 1)) == 0) {
+      Redistribute(&far);
+    }
+    for (int level = kLevels - 1; level > 0; --level) {
+      const int shift = LevelShift(level);
+      if ((tick & ((uint64_t{1} << shift) - 1)) != 0) continue;
+      const uint64_t slot = (tick >> shift) & kSlotMask;
+      if ((occupied[level] & (uint64_t{1} << slot)) == 0) continue;
+      occupied[level] &= ~(uint64_t{1} << slot);
+      Redistribute(&buckets[level * kSlots + slot]);
+    }
+    const uint64_t slot = tick & kSlotMask;
+    if ((occupied[0] & (uint64_t{1} << slot)) != 0) {
+      occupied[0] &= ~(uint64_t{1} << slot);
+      ListFire(&buckets[slot], out);
+    }
+    current_tick = tick + 1;
+  }
+  // Nothing is due up to `now`, so the ticks in between need no visit.
+  current_tick = std::max(current_tick, now + 1);
+}
+
+TimerWheel::TimerWheel(TimerListHost* host)
+    : host_(host),
+      num_shards_(grpc_core::Clamp(2 * gpr_cpu_num_cores(), 1u, 32u)),
+      min_timer_(host_->Now().milliseconds_after_process_epoch()) {
+  const uint64_t now =
+      static_cast<uint64_t>(min_timer_.load(std::memory_order_relaxed));
+  shards_.reserve(num_shards_);
+  for (size_t i = 0; i < num_shards_; i++) {
+    shards_.push_back(std::make_unique<Shard>(now));
+  }
+}
+
+void TimerWheel::TimerInit(Timer* timer, grpc_core::Timestamp deadline,
+                           experimental::EventEngine::Closure* closure) {
+  Shard* shard = shards_[grpc_core::HashPointer(timer, num_shards_)].get();
+  timer->closure = closure;
+  timer->deadline = deadline.milliseconds_after_process_epoch();
+
+#ifndef NDEBUG
+  timer->hash_table_next = nullptr;
+#endif
+
+  bool is_first_timer = false;
+  {
+    grpc_core::MutexLock lock(&shard->mu);
+    timer->pending = true;
+    shard->Add(timer);
+    if (timer->deadline < shard->next_event) {
+      shard->next_event = timer->deadline;
+      is_first_timer = true;
+    }
+  }
+
+  // As in TimerList, a TimerCheck may run between the two critical sections.
+  // It publishes the shard's next event under mu_ before we get here, so the
+  // comparison below cannot lose the earlier deadline.
+  if (is_first_timer) {
+    grpc_core::MutexLock lock(&mu_);
+    if (deadline < shard->min_deadline) {
+      shard->min_deadline = deadline;
+      if (timer->deadline < min_timer_.load(std::memory_order_relaxed)) {
+        min_timer_.store(timer->deadline, std::memory_order_relaxed);
+        host_->Kick();
+      }
+    }
+  }
+}
+
+bool TimerWheel::TimerCancel(Timer* timer) {
+  Shard* shard = shards_[grpc_core::HashPointer(timer, num_shards_)].get();
+  grpc_core::MutexLock lock(&shard->mu);
+  if (!timer->pending) return false;
+  timer->pending = false;
+  shard->Remove(timer);
+  return true;
+}
+
+std::optional<std::vector<experimental::EventEngine::Closure*>>
+TimerWheel::TimerCheck(grpc_core::Timestamp* next) {
+  grpc_core::Timestamp now = host_->Now();
+  grpc_core::Timestamp min_timer =
+      grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
+          min_timer_.load(std::memory_order_relaxed));
+  if (now < min_timer) {
+    if (next != nullptr) *next = std::min(*next, min_timer);
+    return std::vector<experimental::EventEngine::Closure*>();
+  }
+
+  if (!checker_mu_.TryLock()) return std::nullopt;
+  std::vector<experimental::EventEngine::Closure*> done;
+  {
+    grpc_core::MutexLock lock(&mu_);
+    min_timer = grpc_core::Timestamp::InfFuture();
+    for (auto& shard : shards_) {
+      if (shard->min_deadline <= now) {
+        grpc_core::MutexLock shard_lock(&shard->mu);
+        shard->Advance(
+            static_cast<uint64_t>(now.milliseconds_after_process_epoch()),
+            &done);
+        shard->next_event = TickToMillis(shard->NextEventTick());
+        shard->min_deadline =
+            grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
+                shard->next_event);
+      }
+      min_timer = std::min(min_timer, shard->min_deadline);
+    }
+    min_timer_.store(min_timer.milliseconds_after_process_epoch(),
+                     std::memory_order_relaxed);
+  }
+  checker_mu_.Unlock();
+  if (next != nullptr) *next = std::min(*next, min_timer);
+  return std::move(done);
+}
+
+}  // namespace grpc_event_engine::experimental
@@ -0,0 +1,114 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TIMER_WHEEL_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TIMER_WHEEL_H
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "src/core/lib/event_engine/posix_engine/timer.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/time.h"
+
+namespace grpc_event_engine::experimental {
+
+// A TimerListInterface built on hierarchical timing wheels (Varghese and
+// Lauck, "Hashed and Hierarchical Timing Wheels"). Adding and cancelling a
+// timer are O(1): a timer is linked into the bucket covering its deadline and
+// unlinked from it again, with no ordering maintained between timers.
+//
+// Each shard has kLevels wheels of kSlots buckets. A bucket on level 0 spans
+// one millisecond; a bucket on level N spans kSlots times a bucket on level
+// N-1, so deadlines further out land in coarser buckets. As time advances the
+// buckets of a level are redistributed ("cascaded") into the finer levels
+// below once time reaches them. Deadlines past the last level wait in an
+// unordered list that is rescanned once per turn of the second-to-last level.
+//
+// Expiry is exact to the millisecond, and TimerCheck skips over empty buckets
+// rather than walking every millisecond that has passed.
+class TimerWheel final : public TimerListInterface {
+ public:
+  static constexpr int kSlotBits = 6;
+  static constexpr size_t kSlots = size_t{1} << kSlotBits;
+  static constexpr int kLevels = 4;
+
+  explicit TimerWheel(TimerListHost* host);
+
+  TimerWheel(const TimerWheel&) = delete;
+  TimerWheel& operator=(const TimerWheel&) = delete;
+
+  void TimerInit(Timer* timer, grpc_core::Timestamp deadline,
+                 experimental::EventEngine::Closure* closure) override;
+  bool TimerCancel(Timer* timer) override;
+  std::optional<std::vector<experimental::EventEngine::Closure*>> TimerCheck(
+      grpc_core::Timestamp* next) override;
+
+ private:
+  struct Shard {
+    explicit Shard(uint64_t now);
+
+    // Links the timer into the bucket for its deadline.
+    void Add(Timer* timer) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    // Unlinks a pending timer from its bucket.
+    void Remove(Timer* timer) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    // Moves every timer of a bucket back through Add().
+    void Redistribute(Timer* head) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    // The earliest tick at which a timer may expire or a bucket has to be
+    // cascaded. A lower bound on the earliest deadline in the shard.
+    uint64_t NextEventTick() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    // Advances the wheel through `now`, collecting the expired closures.
+    void Advance(uint64_t now,
+                 std::vector<experimental::EventEngine::Closure*>* out)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+
+    grpc_core::Mutex mu;
+    // The next tick the wheel has not yet processed.
+    uint64_t current_tick ABSL_GUARDED_BY(mu);
+    // The cached result of NextEventTick(), in milliseconds after the process
+    // epoch.
+    int64_t next_event ABSL_GUARDED_BY(mu);
+    // One bit per non-empty bucket, for each level.
+    uint64_t occupied[kLevels] ABSL_GUARDED_BY(mu) = {};
+    // List heads of the buckets, kSlots per level.
+    Timer buckets[kLevels * kSlots] ABSL_GUARDED_BY(mu);
+    // Timers whose deadline had already passed when they were added.
+    Timer expired ABSL_GUARDED_BY(mu);
+    // Timers whose deadline lies beyond the last level.
+    Timer far ABSL_GUARDED_BY(mu);
+    // The shard's next_event as published to TimerCheck.
+    grpc_core::Timestamp min_deadline ABSL_GUARDED_BY(&TimerWheel::mu_);
+  };
+
+  TimerListHost* const host_;
+  const size_t num_shards_;
+  grpc_core::Mutex mu_;
+  // The earliest min_deadline across all shards.
+  std::atomic<int64_t> min_timer_;
+  // Allows only one TimerCheck to advance the shards at once.
+  grpc_core::Mutex checker_mu_;
+  std::vector<std::unique_ptr<Shard>> shards_;
+};
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TIMER_WHEEL_H
@@ -21,6 +21,7 @@
 
 #include "absl/functional/any_invocable.h"
 #include "src/core/lib/event_engine/forkable.h"
+#include "src/core/lib/event_engine/work_priority.h"
 
 namespace grpc_event_engine::experimental {
 
@@ -35,6 +36,11 @@ class ThreadPool : public Forkable {
   // Run must not be called after Quiesce completes
   virtual void Run(absl::AnyInvocable<void()> callback) = 0;
   virtual void Run(EventEngine::Closure* closure) = 0;
+  // Run the closure on the given lane. The overloads above use
+  // WorkPriority::kDefault.
+  virtual void Run(absl::AnyInvocable<void()> callback,
+                   WorkPriority priority) = 0;
+  virtual void Run(EventEngine::Closure* closure, WorkPriority priority) = 0;
 };
 
 // Creates a default thread pool.
@@ -24,20 +24,31 @@
 #include <atomic>
 #include <chrono>
 #include <cstddef>
+#include <fstream>
 #include <memory>
 #include <optional>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "absl/functional/any_invocable.h"
 #include "absl/log/absl_check.h"
 #include "absl/log/absl_log.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_split.h"
+#include "absl/strings/string_view.h"
 #include "absl/time/clock.h"
 #include "absl/time/time.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/event_engine/common_closures.h"
 #include "src/core/lib/event_engine/thread_local.h"
 #include "src/core/lib/event_engine/work_queue/basic_work_queue.h"
+#include "src/core/lib/event_engine/work_queue/lock_free_work_queue.h"
 #include "src/core/lib/event_engine/work_queue/work_queue.h"
+#include "src/core/lib/experiments/experiments.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 #include "src/core/util/backoff.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/env.h"
@@ -51,6 +62,11 @@
 #include <signal.h>
 #endif
 
+#ifdef GPR_LINUX
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 // IWYU pragma: no_include <ratio>
 
 // ## Thread Pool Fork-handling
@@ -100,6 +116,26 @@
 // enable advanced debugging. When the pool takes too long to quiesce, a
 // backtrace will be printed for every running thread, and the process will
 // abort.
+//
+// ## NUMA
+//
+// On a machine with more than one NUMA node, every worker thread belongs to
+// one node and is pinned to that node's CPUs. An idle worker steals from the
+// other workers of its own node first, so that closures keep running close to
+// the memory they touch. It only steals across nodes once it has come up empty
+// on its own node kLocalStealAttemptsBeforeRemote times in a row, that is
+// when one node has been busier than the other for a while. Set
+// GRPC_THREAD_POOL_NUMA_AWARE=0 to treat the machine as a single node.
+//
+// ## Priorities
+//
+// Closures are queued on one of three lanes: transport I/O, default and
+// background (see WorkPriority). Workers look for transport I/O work first,
+// then default work (their own queue, then the global queue), then background
+// work. Every kPriorityRotationInterval-th closure a worker takes is looked
+// for in the reverse order instead, so that a steady stream of transport I/O
+// work slows the other lanes down without starving them. Only default work
+// goes to thread-local queues, so work stealing is unaffected.
 
 namespace grpc_event_engine::experimental {
 
@@ -134,6 +170,14 @@ constexpr grpc_core::Duration kLifeguardMaxSleepBetweenChecks{
     grpc_core::Duration::Seconds(1)};
 constexpr grpc_core::Duration kBlockUntilThreadCountTimeout{
     grpc_core::Duration::Seconds(60)};
+// Number of consecutive failed attempts at stealing from the worker's own NUMA
+// node before it starts stealing from the other nodes too. Attempts are
+// separated by a wait for work, so this bounds how long an imbalance between
+// nodes lasts before it is evened out.
+constexpr int kLocalStealAttemptsBeforeRemote = 2;
+// Every this many closures, a worker looks for work in the lowest priority
+// lane first.
+constexpr size_t kPriorityRotationInterval = 8;
 
 #ifdef GPR_POSIX_SYNC
 const bool g_log_verbose_failures =
@@ -162,6 +206,30 @@ void DumpSignalHandler(int /* sig */) {
   grpc_core::Thread::Kill(gpr_thd_currentid());
 }
 
+#ifdef GPR_LINUX
+// Returns the CPUs listed in the given sysfs file, or nothing if it cannot be
+// read.
+std::vector<int> ReadCpuList(const std::string& path) {
+  std::ifstream file(path);
+  std::string cpulist;
+  if (!std::getline(file, cpulist)) return {};
+  return WorkStealingThreadPool::ParseCpuList(cpulist);
+}
+
+void PinCurrentThread(const std::vector<int>& cpus) {
+  if (cpus.empty()) return;
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  for (int cpu : cpus) CPU_SET(cpu, &cpu_set);
+  if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) != 0) {
+    GRPC_TRACE_LOG(event_engine, INFO)
+        << "Failed to bind thread pool worker to its NUMA node";
+  }
+}
+#else
+void PinCurrentThread(const std::vector<int>& /*cpus*/) {}
+#endif
+
 }  // namespace
 
 thread_local WorkQueue* g_local_queue = nullptr;
@@ -169,7 +237,12 @@ thread_local WorkQueue* g_local_queue = nullptr;
 // -------- WorkStealingThreadPool --------
 
 WorkStealingThreadPool::WorkStealingThreadPool(size_t reserve_threads)
-    : pool_{std::make_shared<WorkStealingThreadPoolImpl>(reserve_threads)} {
+    : WorkStealingThreadPool(reserve_threads, DetectNumaNodes()) {}
+
+WorkStealingThreadPool::WorkStealingThreadPool(size_t reserve_threads,
+                                               NumaNodes numa_nodes)
+    : pool_{std::make_shared<WorkStealingThreadPoolImpl>(
+          reserve_threads, std::move(numa_nodes))} {
   if (g_log_verbose_failures) {
     GRPC_TRACE_LOG(event_engine, INFO)
         << "WorkStealingThreadPool verbose failures are enabled";
@@ -188,25 +261,106 @@ void WorkStealingThreadPool::Run(absl::AnyInvocable<void()> callback) {
 }
 
 void WorkStealingThreadPool::Run(EventEngine::Closure* closure) {
-  pool_->Run(closure);
+  pool_->Run(closure, WorkPriority::kDefault);
+}
+
+void WorkStealingThreadPool::Run(absl::AnyInvocable<void()> callback,
+                                 WorkPriority priority) {
+  Run(SelfDeletingClosure::Create(std::move(callback)), priority);
+}
+
+void WorkStealingThreadPool::Run(EventEngine::Closure* closure,
+                                 WorkPriority priority) {
+  pool_->Run(closure, priority);
+}
+
+WorkStealingThreadPool::NumaNodes WorkStealingThreadPool::DetectNumaNodes() {
+  NumaNodes nodes;
+#ifdef GPR_LINUX
+  auto numa_aware = grpc_core::GetEnv("GRPC_THREAD_POOL_NUMA_AWARE");
+  if (numa_aware.has_value() && *numa_aware == "0") return NumaNodes(1);
+  cpu_set_t allowed;
+  CPU_ZERO(&allowed);
+  if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) {
+    return NumaNodes(1);
+  }
+  for (int node : ReadCpuList("/sys/devices/system/node/online")) {
+    std::vector<int> cpus;
+    for (int cpu : ReadCpuList(
+             absl::StrCat("/sys/devices/system/node/node", node, "/cpulist"))) {
+      if (cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowed)) cpus.push_back(cpu);
+    }
+    // Nodes without CPUs, or none this process may use, get no workers.
+    if (!cpus.empty()) nodes.push_back(std::move(cpus));
+  }
+#endif
+  if (nodes.size() < 2) return NumaNodes(1);
+  return nodes;
+}
+
+std::vector<int> WorkStealingThreadPool::ParseCpuList(
+    absl::string_view cpulist) {
+  std::vector<int> cpus;
+  for (absl::string_view range :
+       absl::StrSplit(cpulist, ',', absl::SkipWhitespace())) {
+    std::pair<absl::string_view, absl::string_view> bounds =
+        absl::StrSplit(range, absl::MaxSplits('-', 1));
+    int first;
+    int last;
+    if (!absl::SimpleAtoi(bounds.first, &first)) return {};
+    if (bounds.second.empty()) {
+      last = first;
+    } else if (!absl::SimpleAtoi(bounds.second, &last) || last < first) {
+      return {};
+    }
+    for (int cpu = first; cpu <= last; ++cpu) cpus.push_back(cpu);
+  }
+  return cpus;
 }
 
 // -------- WorkStealingThreadPool::TheftRegistry --------
 
-void WorkStealingThreadPool::TheftRegistry::Enroll(WorkQueue* queue) {
-  grpc_core::MutexLock lock(&mu_);
-  queues_.emplace(queue);
+void WorkStealingThreadPool::TheftRegistry::Enroll(WorkQueue* queue,
+                                                   size_t node) {
+  grpc_core::MutexLock lock(&nodes_[node].mu);
+  nodes_[node].queues.emplace(queue);
 }
 
-void WorkStealingThreadPool::TheftRegistry::Unenroll(WorkQueue* queue) {
-  grpc_core::MutexLock lock(&mu_);
-  queues_.erase(queue);
+void WorkStealingThreadPool::TheftRegistry::Unenroll(WorkQueue* queue,
+                                                     size_t node) {
+  grpc_core::MutexLock lock(&nodes_[node].mu);
+  nodes_[node].queues.erase(queue);
 }
 
-EventEngine::Closure* WorkStealingThreadPool::TheftRegistry::StealOne() {
-  grpc_core::MutexLock lock(&mu_);
+EventEngine::Closure* WorkStealingThreadPool::TheftRegistry::StealLocal(
+    size_t node) {
+  EventEngine::Closure* closure = StealFrom(nodes_[node]);
+  if (closure != nullptr) {
+    grpc_core::global_stats().IncrementThreadPoolLocalSteals();
+  }
+  return closure;
+}
+
+EventEngine::Closure* WorkStealingThreadPool::TheftRegistry::StealRemote(
+    size_t node) {
+  // Start with the next node rather than always the first one, so that the
+  // nodes share the load of remote stealing.
+  for (size_t i = 1; i < nodes_.size(); ++i) {
+    EventEngine::Closure* closure =
+        StealFrom(nodes_[(node + i) % nodes_.size()]);
+    if (closure != nullptr) {
+      grpc_core::global_stats().IncrementThreadPoolRemoteSteals();
+      return closure;
+    }
+  }
+  return nullptr;
+}
+
+EventEngine::Closure* WorkStealingThreadPool::TheftRegistry::StealFrom(
+    Node& node) {
+  grpc_core::MutexLock lock(&node.mu);
   EventEngine::Closure* closure;
-  for (auto* queue : queues_) {
+  for (auto* queue : node.queues) {
     closure = queue->PopMostRecent();
     if (closure != nullptr) return closure;
   }
@@ -222,8 +376,13 @@ void WorkStealingThreadPool::PostforkChild() { pool_->Postfork(); }
 // -------- WorkStealingThreadPool::WorkStealingThreadPoolImpl --------
 
 WorkStealingThreadPool::WorkStealingThreadPoolImpl::WorkStealingThreadPoolImpl(
-    size_t reserve_threads)
-    : reserve_threads_(reserve_threads), queue_(this) {}
+    size_t reserve_threads, NumaNodes numa_nodes)
+    : reserve_threads_(reserve_threads),
+      numa_nodes_(numa_nodes.empty() ? NumaNodes(1) : std::move(numa_nodes)),
+      theft_registry_(numa_nodes_.size()),
+      io_queue_(this),
+      queue_(this),
+      background_queue_(this) {}
 
 void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Start() {
   for (size_t i = 0; i < reserve_threads_; i++) {
@@ -234,9 +393,11 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Start() {
 }
 
 void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Run(
-    EventEngine::Closure* closure) {
+    EventEngine::Closure* closure, WorkPriority priority) {
   ABSL_CHECK(!IsQuiesced());
-  if (g_local_queue != nullptr && g_local_queue->owner() == this) {
+  if (priority != WorkPriority::kDefault) {
+    queue(priority)->Add(closure);
+  } else if (g_local_queue != nullptr && g_local_queue->owner() == this) {
     g_local_queue->Add(closure);
   } else {
     queue_.Add(closure);
@@ -277,12 +438,34 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Quiesce() {
   if (!threads_were_shut_down.ok() && g_log_verbose_failures) {
     DumpStacksAndCrash();
   }
-  ABSL_CHECK(queue_.Empty());
+  ABSL_CHECK(GlobalQueuesEmpty());
   quiesced_.store(true, std::memory_order_relaxed);
   grpc_core::MutexLock lock(&lifeguard_ptr_mu_);
   lifeguard_.reset();
 }
 
+WorkQueue* WorkStealingThreadPool::WorkStealingThreadPoolImpl::queue(
+    WorkPriority priority) {
+  switch (priority) {
+    case WorkPriority::kTransportIo:
+      return &io_queue_;
+    case WorkPriority::kDefault:
+      return &queue_;
+    case WorkPriority::kBackground:
+      return &background_queue_;
+  }
+  GPR_UNREACHABLE_CODE(return &queue_);
+}
+
+bool WorkStealingThreadPool::WorkStealingThreadPoolImpl::GlobalQueuesEmpty() {
+  return io_queue_.Empty() && queue_.Empty() && background_queue_.Empty();
+}
+
+size_t WorkStealingThreadPool::WorkStealingThreadPoolImpl::NextNumaNode() {
+  return next_numa_node_.fetch_add(1, std::memory_order_relaxed) %
+         numa_nodes_.size();
+}
+
 bool WorkStealingThreadPool::WorkStealingThreadPoolImpl::SetThrottled(
     bool throttled) {
   return throttled_.exchange(throttled, std::memory_order_relaxed);
@@ -430,7 +613,7 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Lifeguard::
   const auto living_thread_count = pool_->living_thread_count()->count();
   // Wake an idle worker thread if there's global work to be had.
   if (pool_->busy_thread_count()->count() < living_thread_count) {
-    if (!pool_->queue_.Empty()) {
+    if (!pool_->GlobalQueuesEmpty()) {
       pool_->work_signal()->Signal();
       backoff_.Reset();
     }
@@ -470,7 +653,8 @@ WorkStealingThreadPool::ThreadState::ThreadState(
                    .set_initial_backoff(kWorkerThreadMinSleepBetweenChecks)
                    .set_max_backoff(kWorkerThreadMaxSleepBetweenChecks)
                    .set_multiplier(1.3)),
-      busy_count_idx_(pool_->busy_thread_count()->NextIndex()) {}
+      busy_count_idx_(pool_->busy_thread_count()->NextIndex()),
+      numa_node_(pool_->NextNumaNode()) {}
 
 void WorkStealingThreadPool::ThreadState::ThreadBody() {
   if (g_log_verbose_failures) {
@@ -481,8 +665,13 @@ void WorkStealingThreadPool::ThreadState::ThreadBody() {
 #endif
     pool_->TrackThread(gpr_thd_currentid());
   }
-  g_local_queue = new BasicWorkQueue(pool_.get());
-  pool_->theft_registry()->Enroll(g_local_queue);
+  PinCurrentThread(pool_->numa_nodes()[numa_node_]);
+  if (grpc_core::IsEventEngineLockFreeWorkQueueEnabled()) {
+    g_local_queue = new LockFreeWorkQueue(pool_.get());
+  } else {
+    g_local_queue = new BasicWorkQueue(pool_.get());
+  }
+  pool_->theft_registry()->Enroll(g_local_queue, numa_node_);
   ThreadLocal::SetIsEventEngineThread(true);
   while (Step()) {
     // loop until the thread should no longer run
@@ -501,7 +690,7 @@ void WorkStealingThreadPool::ThreadState::ThreadBody() {
     FinishDraining();
   }
   ABSL_CHECK(g_local_queue->Empty());
-  pool_->theft_registry()->Unenroll(g_local_queue);
+  pool_->theft_registry()->Unenroll(g_local_queue, numa_node_);
   delete g_local_queue;
   if (g_log_verbose_failures) {
     pool_->UntrackThread(gpr_thd_currentid());
@@ -514,10 +703,37 @@ void WorkStealingThreadPool::ThreadState::SleepIfRunning() {
       absl::Milliseconds(kTimeBetweenThrottledThreadStarts.millis()));
 }
 
+EventEngine::Closure* WorkStealingThreadPool::ThreadState::PopQueued() {
+  const bool promote_background =
+      ++queued_pops_ % kPriorityRotationInterval == 0;
+  EventEngine::Closure* closure = nullptr;
+  auto pop_lane = [&](WorkPriority priority) {
+    if (closure != nullptr) return;
+    if (priority == WorkPriority::kDefault) {
+      closure = g_local_queue->PopMostRecent();
+      if (closure != nullptr) return;
+    }
+    closure = pool_->queue(priority)->PopMostRecent();
+  };
+  if (promote_background) {
+    pop_lane(WorkPriority::kBackground);
+    pop_lane(WorkPriority::kDefault);
+    pop_lane(WorkPriority::kTransportIo);
+  } else {
+    pop_lane(WorkPriority::kTransportIo);
+    pop_lane(WorkPriority::kDefault);
+    pop_lane(WorkPriority::kBackground);
+  }
+  // Only count the closures actually taken, so that an idle worker polling
+  // the queues does not skew the rotation.
+  if (closure == nullptr) --queued_pops_;
+  return closure;
+}
+
 bool WorkStealingThreadPool::ThreadState::Step() {
   if (pool_->IsForking()) return false;
-  auto* closure = g_local_queue->PopMostRecent();
-  // If local work is available, run it.
+  auto* closure = PopQueued();
+  // If queued work is available, run it.
   if (closure != nullptr) {
     auto busy =
         pool_->busy_thread_count()->MakeAutoThreadCounter(busy_count_idx_);
@@ -527,23 +743,28 @@ bool WorkStealingThreadPool::ThreadState::Step() {
   // Thread shutdown exit condition (ignoring fork). All must be true:
   // * shutdown was called
   // * the local queue is empty
-  // * the global queue is empty
+  // * the global queues are empty
   // * the steal pool returns nullptr
   bool should_run_again = false;
   auto start_time = std::chrono::steady_clock::now();
+  int failed_local_steals = 0;
   // Wait until work is available or until shut down.
   while (!pool_->IsForking()) {
-    // Pull from the global queue next
+    // Pull from the global queues next
     // TODO(hork): consider an empty check for performance wins. Depends on the
     // queue implementation, the BasicWorkQueue takes two locks when you do an
     // empty check then pop.
-    closure = pool_->queue()->PopMostRecent();
+    closure = PopQueued();
     if (closure != nullptr) {
       should_run_again = true;
       break;
     };
-    // Try stealing if the queue is empty
-    closure = pool_->theft_registry()->StealOne();
+    // Try stealing if the queue is empty, from this thread's NUMA node first.
+    closure = pool_->theft_registry()->StealLocal(numa_node_);
+    if (closure == nullptr &&
+        ++failed_local_steals >= kLocalStealAttemptsBeforeRemote) {
+      closure = pool_->theft_registry()->StealRemote(numa_node_);
+    }
     if (closure != nullptr) {
       should_run_again = true;
       break;
@@ -583,21 +804,12 @@ void WorkStealingThreadPool::ThreadState::FinishDraining() {
   // If a fork occurs at any point during shutdown, quit draining. The post-fork
   // threads will finish draining the global queue.
   while (!pool_->IsForking()) {
-    if (!g_local_queue->Empty()) {
-      auto* closure = g_local_queue->PopMostRecent();
-      if (closure != nullptr) {
-        closure->Run();
-      }
-      continue;
-    }
-    if (!pool_->queue()->Empty()) {
-      auto* closure = pool_->queue()->PopMostRecent();
-      if (closure != nullptr) {
-        closure->Run();
-      }
+    auto* closure = PopQueued();
+    if (closure != nullptr) {
+      closure->Run();
       continue;
     }
-    break;
+    if (g_local_queue->Empty() && pool_->GlobalQueuesEmpty()) break;
   }
 }
 
@@ -26,12 +26,15 @@
 
 #include <atomic>
 #include <memory>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/container/flat_hash_set.h"
 #include "absl/functional/any_invocable.h"
+#include "absl/strings/string_view.h"
 #include "src/core/lib/event_engine/thread_pool/thread_count.h"
 #include "src/core/lib/event_engine/thread_pool/thread_pool.h"
+#include "src/core/lib/event_engine/work_priority.h"
 #include "src/core/lib/event_engine/work_queue/basic_work_queue.h"
 #include "src/core/lib/event_engine/work_queue/work_queue.h"
 #include "src/core/util/backoff.h"
@@ -43,7 +46,13 @@ namespace grpc_event_engine::experimental {
 
 class WorkStealingThreadPool final : public ThreadPool {
  public:
+  // The CPUs of each NUMA node the pool spreads its threads over. Workers are
+  // assigned to nodes round robin, pinned to their node's CPUs (when the list
+  // is not empty), and steal from workers on their own node first.
+  using NumaNodes = std::vector<std::vector<int>>;
+
   explicit WorkStealingThreadPool(size_t reserve_threads);
+  WorkStealingThreadPool(size_t reserve_threads, NumaNodes numa_nodes);
   // Asserts Quiesce was called.
   ~WorkStealingThreadPool() override;
   // Shut down the pool, and wait for all threads to exit.
@@ -52,6 +61,9 @@ class WorkStealingThreadPool final : public ThreadPool {
   // Run must not be called after Quiesce completes
   void Run(absl::AnyInvocable<void()> callback) override;
   void Run(EventEngine::Closure* closure) override;
+  void Run(absl::AnyInvocable<void()> callback,
+           WorkPriority priority) override;
+  void Run(EventEngine::Closure* closure, WorkPriority priority) override;
 
   // Forkable
   // These methods are exposed on the public object to allow for testing.
@@ -59,6 +71,14 @@ class WorkStealingThreadPool final : public ThreadPool {
   void PostforkParent() override;
   void PostforkChild() override;
 
+  // Returns the NUMA nodes this process may run on. Reports a single node
+  // with no CPUs, so that nothing is pinned, if the platform has no NUMA
+  // information, the process is confined to one node, or NUMA awareness is
+  // disabled with GRPC_THREAD_POOL_NUMA_AWARE=0.
+  static NumaNodes DetectNumaNodes();
+  // Parses a Linux cpulist such as "0-3,8,10-11".
+  static std::vector<int> ParseCpuList(absl::string_view cpulist);
+
  private:
   // A basic communication mechanism to signal waiting threads that work is
   // available.
@@ -78,20 +98,31 @@ class WorkStealingThreadPool final : public ThreadPool {
   //
   // Every worker thread registers and unregisters its thread-local thread pool
   // here, and steals closures from other threads when work is otherwise
-  // unavailable.
+  // unavailable. Queues are grouped by the NUMA node of their thread, so that
+  // stealing within a node never contends with the other nodes.
   class TheftRegistry {
    public:
+    explicit TheftRegistry(size_t num_nodes) : nodes_(num_nodes) {}
     // Allow any member of the registry to steal from the provided queue.
-    void Enroll(WorkQueue* queue) ABSL_LOCKS_EXCLUDED(mu_);
+    void Enroll(WorkQueue* queue, size_t node);
     // Disallow work stealing from the provided queue.
-    void Unenroll(WorkQueue* queue) ABSL_LOCKS_EXCLUDED(mu_);
-    // Returns one closure from another thread, or nullptr if none are
-    // available.
-    EventEngine::Closure* StealOne() ABSL_LOCKS_EXCLUDED(mu_);
+    void Unenroll(WorkQueue* queue, size_t node);
+    // Returns one closure from another thread on `node`, or nullptr if none
+    // are available.
+    EventEngine::Closure* StealLocal(size_t node);
+    // Returns one closure from a thread on any node but `node`, or nullptr if
+    // none are available.
+    EventEngine::Closure* StealRemote(size_t node);
 
    private:
-    grpc_core::Mutex mu_;
-    absl::flat_hash_set<WorkQueue*> queues_ ABSL_GUARDED_BY(mu_);
+    struct Node {
+      grpc_core::Mutex mu;
+      absl::flat_hash_set<WorkQueue*> queues ABSL_GUARDED_BY(mu);
+    };
+
+    EventEngine::Closure* StealFrom(Node& node);
+
+    std::vector<Node> nodes_;
   };
 
   // An implementation of the ThreadPool
@@ -101,12 +132,13 @@ class WorkStealingThreadPool final : public ThreadPool {
   class WorkStealingThreadPoolImpl
       : public std::enable_shared_from_this<WorkStealingThreadPoolImpl> {
    public:
-    explicit WorkStealingThreadPoolImpl(size_t reserve_threads);
+    WorkStealingThreadPoolImpl(size_t reserve_threads, NumaNodes numa_nodes);
     // Start all threads.
     void Start();
-    // Add a closure to a work queue, preferably a thread-local queue if
-    // available, otherwise the global queue.
-    void Run(EventEngine::Closure* closure);
+    // Add a closure to a work queue. Default priority closures go to a
+    // thread-local queue if available, otherwise the global queue; the
+    // other priorities always go to the global queue of their lane.
+    void Run(EventEngine::Closure* closure, WorkPriority priority);
     // Start a new thread.
     // The reason argument determines whether thread creation is rate-limited;
     // threads created to populate the initial pool are not rate-limited, but
@@ -137,10 +169,16 @@ class WorkStealingThreadPool final : public ThreadPool {
     bool IsForking();
     bool IsQuiesced();
     size_t reserve_threads() { return reserve_threads_; }
+    const NumaNodes& numa_nodes() { return numa_nodes_; }
+    // The NUMA node the next started thread should run on.
+    size_t NextNumaNode();
     BusyThreadCount* busy_thread_count() { return &busy_thread_count_; }
     LivingThreadCount* living_thread_count() { return &living_thread_count_; }
     TheftRegistry* theft_registry() { return &theft_registry_; }
     WorkQueue* queue() { return &queue_; }
+    WorkQueue* queue(WorkPriority priority);
+    // Returns whether the global queues of all lanes are empty.
+    bool GlobalQueuesEmpty();
     WorkSignal* work_signal() { return &work_signal_; }
 
    private:
@@ -171,10 +209,15 @@ class WorkStealingThreadPool final : public ThreadPool {
     void DumpStacksAndCrash();
 
     const size_t reserve_threads_;
+    const NumaNodes numa_nodes_;
+    std::atomic<size_t> next_numa_node_{0};
     BusyThreadCount busy_thread_count_;
     LivingThreadCount living_thread_count_;
     TheftRegistry theft_registry_;
+    // The global queues of the transport I/O, default and background lanes.
+    BasicWorkQueue io_queue_;
     BasicWorkQueue queue_;
+    BasicWorkQueue background_queue_;
     // Track shutdown and fork bits separately.
     // It's possible for a ThreadPool to initiate shut down while fork handlers
     // are running, and similarly possible for a fork event to occur during
@@ -200,6 +243,9 @@ class WorkStealingThreadPool final : public ThreadPool {
     void ThreadBody();
     void SleepIfRunning();
     bool Step();
+    // Returns the next closure from this thread's queue or the global queues,
+    // favoring higher priority lanes, or nullptr if they are all empty.
+    EventEngine::Closure* PopQueued();
     // After the pool is shut down, ensure all local and global callbacks are
     // executed before quitting the thread.
     void FinishDraining();
@@ -214,6 +260,9 @@ class WorkStealingThreadPool final : public ThreadPool {
     LivingThreadCount::AutoThreadCounter auto_thread_counter_;
     grpc_core::BackOff backoff_;
     size_t busy_count_idx_;
+    const size_t numa_node_;
+    // Number of closures PopQueued has returned.
+    size_t queued_pops_ = 0;
   };
 
   const std::shared_ptr<WorkStealingThreadPoolImpl> pool_;
@@ -68,42 +68,62 @@ void IOCP::Shutdown() {
 
 Poller::WorkResult IOCP::Work(EventEngine::Duration timeout,
                               absl::FunctionRef<void()> schedule_poll_again) {
-  DWORD bytes = 0;
-  ULONG_PTR completion_key;
-  LPOVERLAPPED overlapped;
+  // Dequeue completions in batches: each one only schedules a closure on the
+  // thread pool, so one poller can hand out many before polling again.
+  OVERLAPPED_ENTRY entries[kMaxCompletionsPerWork];
+  ULONG num_entries = 0;
   GRPC_TRACE_LOG(event_engine_poller, INFO)
       << "IOCP::" << this << " doing work";
-  BOOL success = GetQueuedCompletionStatus(
-      iocp_handle_, &bytes, &completion_key, &overlapped,
-      static_cast<DWORD>(Milliseconds(timeout)));
-  if (success == 0 && overlapped == nullptr) {
+  BOOL success = GetQueuedCompletionStatusEx(
+      iocp_handle_, entries, kMaxCompletionsPerWork, &num_entries,
+      static_cast<DWORD>(Milliseconds(timeout)), /*fAlertable=*/FALSE);
+  if (success == 0 || num_entries == 0) {
     GRPC_TRACE_LOG(event_engine_poller, INFO)
         << "IOCP::" << this << " deadline exceeded";
     return Poller::WorkResult::kDeadlineExceeded;
   }
-  ABSL_CHECK(completion_key);
-  ABSL_CHECK(overlapped);
-  if (overlapped == &kick_overlap_) {
+  int kicks = 0;
+  for (ULONG i = 0; i < num_entries; ++i) {
+    ULONG_PTR completion_key = entries[i].lpCompletionKey;
+    LPOVERLAPPED overlapped = entries[i].lpOverlapped;
+    ABSL_CHECK(completion_key);
+    ABSL_CHECK(overlapped);
+    if (overlapped == &kick_overlap_) {
+      if (completion_key != (ULONG_PTR)&kick_token_) {
+        grpc_core::Crash(absl::StrFormat(
+            "Unknown custom completion key: %lu", completion_key));
+      }
+      ++kicks;
+      continue;
+    }
+    GRPC_TRACE_LOG(event_engine_poller, INFO)
+        << "IOCP::" << this << " got event on OVERLAPPED::" << overlapped;
+    // Safety note: socket is guaranteed to exist when managed by a
+    // WindowsEndpoint. If an overlapped event came in, then either a read
+    // event handler is registered, which keeps the socket alive, or the
+    // WindowsEndpoint (which keeps the socket alive) has done an asynchronous
+    // WSARecv and is about to register for notification of an overlapped
+    // event.
+    auto* socket = reinterpret_cast<WinSocket*>(completion_key);
+    WinSocket::OpState* info = socket->GetOpInfoForOverlapped(overlapped);
+    ABSL_CHECK_NE(info, nullptr);
+    info->GetOverlappedResult();
+    info->SetReady();
+  }
+  const bool got_events = kicks < static_cast<int>(num_entries);
+  // Each kick wakes exactly one Work() call. Only consume one here if there
+  // were no events to report, and re-post the rest for later calls.
+  if (kicks > 0 && !got_events) {
     GRPC_TRACE_LOG(event_engine_poller, INFO) << "IOCP::" << this << " kicked";
     outstanding_kicks_.fetch_sub(1);
-    if (completion_key == (ULONG_PTR)&kick_token_) {
-      return Poller::WorkResult::kKicked;
-    }
-    grpc_core::Crash(
-        absl::StrFormat("Unknown custom completion key: %lu", completion_key));
+    --kicks;
   }
-  GRPC_TRACE_LOG(event_engine_poller, INFO)
-      << "IOCP::" << this << " got event on OVERLAPPED::" << overlapped;
-  // Safety note: socket is guaranteed to exist when managed by a
-  // WindowsEndpoint. If an overlapped event came in, then either a read event
-  // handler is registered, which keeps the socket alive, or the WindowsEndpoint
-  // (which keeps the socket alive) has done an asynchronous WSARecv and is
-  // about to register for notification of an overlapped event.
-  auto* socket = reinterpret_cast<WinSocket*>(completion_key);
-  WinSocket::OpState* info = socket->GetOpInfoForOverlapped(overlapped);
-  ABSL_CHECK_NE(info, nullptr);
-  info->GetOverlappedResult();
-  info->SetReady();
+  for (; kicks > 0; --kicks) {
+    ABSL_CHECK(PostQueuedCompletionStatus(
+        iocp_handle_, 0, reinterpret_cast<ULONG_PTR>(&kick_token_),
+        &kick_overlap_));
+  }
+  if (!got_events) return Poller::WorkResult::kKicked;
   schedule_poll_again();
   return Poller::WorkResult::kOk;
 }
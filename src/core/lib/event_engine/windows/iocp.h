@@ -49,6 +49,9 @@ class IOCP final : public Poller {
   static DWORD GetDefaultSocketFlags();
 
  private:
+  // Most completions dequeued by a single Work() call.
+  static constexpr ULONG kMaxCompletionsPerWork = 64;
+
   // Initialize default flags via checking platform support
   static DWORD WSASocketFlagsInit();
 
@@ -0,0 +1,42 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_WORK_PRIORITY_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_WORK_PRIORITY_H
+
+#include <grpc/support/port_platform.h>
+
+#include <cstddef>
+
+namespace grpc_event_engine::experimental {
+
+// The lane a closure is queued on in the EventEngine thread pool. Workers
+// favor the lanes in declaration order, but still give each lane a regular
+// turn so that a busy lane cannot starve the ones after it.
+enum class WorkPriority {
+  // Latency-critical work on the transport I/O path, such as socket
+  // readiness callbacks.
+  kTransportIo,
+  // Everything that has not been tagged otherwise.
+  kDefault,
+  // Work nobody is waiting on: teardown hops, config and certificate
+  // reloads, introspection.
+  kBackground,
+};
+
+inline constexpr size_t kNumWorkPriorities = 3;
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_WORK_PRIORITY_H
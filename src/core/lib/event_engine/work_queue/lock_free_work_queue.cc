@@ -0,0 +1,216 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "src/core/lib/event_engine/work_queue/lock_free_work_queue.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <atomic>
+#include <utility>
+
+#include "src/core/lib/event_engine/common_closures.h"
+#include "src/core/util/sync.h"
+
+namespace grpc_event_engine::experimental {
+
+namespace {
+static_assert((LockFreeWorkQueue::kDequeCapacity &
+               (LockFreeWorkQueue::kDequeCapacity - 1)) == 0,
+              "deque capacity must be a power of two");
+static_assert((LockFreeWorkQueue::kInjectionQueueCapacity &
+               (LockFreeWorkQueue::kInjectionQueueCapacity - 1)) == 0,
+              "injection queue capacity must be a power of two");
+constexpr int64_t kDequeMask = LockFreeWorkQueue::kDequeCapacity - 1;
+constexpr size_t kInjectionQueueMask =
+    LockFreeWorkQueue::kInjectionQueueCapacity - 1;
+}  // namespace
+
+// -------- LockFreeWorkQueue::WorkStealingDeque --------
+
+bool LockFreeWorkQueue::WorkStealingDeque::Push(
+    EventEngine::Closure* closure) {
+  int64_t b = bottom_.load(std::memory_order_relaxed);
+  int64_t t = top_.load(std::memory_order_acquire);
+  if (b - t >= static_cast<int64_t>(kDequeCapacity)) return false;
+  buffer_[b & kDequeMask].store(closure, std::memory_order_relaxed);
+  bottom_.store(b + 1, std::memory_order_release);
+  return true;
+}
+
+EventEngine::Closure* LockFreeWorkQueue::WorkStealingDeque::Pop() {
+  int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+  // Sequentially consistent accesses stand in for the paper's fences, which
+  // TSAN cannot model: the store to bottom_ must not pass the load of top_.
+  bottom_.store(b, std::memory_order_seq_cst);
+  int64_t t = top_.load(std::memory_order_seq_cst);
+  if (t > b) {
+    // Empty.
+    bottom_.store(b + 1, std::memory_order_relaxed);
+    return nullptr;
+  }
+  EventEngine::Closure* closure =
+      buffer_[b & kDequeMask].load(std::memory_order_relaxed);
+  if (t == b) {
+    // Last element: race the thieves for it.
+    if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed)) {
+      closure = nullptr;
+    }
+    bottom_.store(b + 1, std::memory_order_relaxed);
+  }
+  return closure;
+}
+
+EventEngine::Closure* LockFreeWorkQueue::WorkStealingDeque::Steal() {
+  int64_t t = top_.load(std::memory_order_seq_cst);
+  int64_t b = bottom_.load(std::memory_order_seq_cst);
+  if (t >= b) return nullptr;
+  EventEngine::Closure* closure =
+      buffer_[t & kDequeMask].load(std::memory_order_relaxed);
+  if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                    std::memory_order_relaxed)) {
+    return nullptr;
+  }
+  return closure;
+}
+
+size_t LockFreeWorkQueue::WorkStealingDeque::Size() const {
+  int64_t b = bottom_.load(std::memory_order_relaxed);
+  int64_t t = top_.load(std::memory_order_relaxed);
+  return b > t ? static_cast<size_t>(b - t) : 0;
+}
+
+// -------- LockFreeWorkQueue::InjectionQueue --------
+
+LockFreeWorkQueue::InjectionQueue::InjectionQueue() {
+  for (size_t i = 0; i < kInjectionQueueCapacity; ++i) {
+    cells_[i].sequence.store(i, std::memory_order_relaxed);
+    cells_[i].closure = nullptr;
+  }
+}
+
+bool LockFreeWorkQueue::InjectionQueue::Push(EventEngine::Closure* closure) {
+  size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+  Cell* cell;
+  while (true) {
+    cell = &cells_[pos & kInjectionQueueMask];
+    size_t sequence = cell->sequence.load(std::memory_order_acquire);
+    intptr_t diff =
+        static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+    if (diff == 0) {
+      if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                             std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (diff < 0) {
+      // The consumer has not freed this cell yet: full.
+      return false;
+    } else {
+      pos = enqueue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+  cell->closure = closure;
+  cell->sequence.store(pos + 1, std::memory_order_release);
+  return true;
+}
+
+EventEngine::Closure* LockFreeWorkQueue::InjectionQueue::Pop() {
+  size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+  Cell* cell;
+  while (true) {
+    cell = &cells_[pos & kInjectionQueueMask];
+    size_t sequence = cell->sequence.load(std::memory_order_acquire);
+    intptr_t diff =
+        static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+    if (diff == 0) {
+      if (dequeue_pos_.compare_exchange_weak(pos, pos + 1,
+                                             std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (diff < 0) {
+      // No producer has filled this cell yet: empty.
+      return nullptr;
+    } else {
+      pos = dequeue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+  EventEngine::Closure* closure = cell->closure;
+  cell->sequence.store(pos + kInjectionQueueCapacity,
+                       std::memory_order_release);
+  return closure;
+}
+
+size_t LockFreeWorkQueue::InjectionQueue::Size() const {
+  size_t enqueued = enqueue_pos_.load(std::memory_order_relaxed);
+  size_t dequeued = dequeue_pos_.load(std::memory_order_relaxed);
+  return enqueued > dequeued ? enqueued - dequeued : 0;
+}
+
+// -------- LockFreeWorkQueue --------
+
+LockFreeWorkQueue::LockFreeWorkQueue(void* owner)
+    : owner_thread_(std::this_thread::get_id()), owner_(owner) {}
+
+bool LockFreeWorkQueue::Empty() const { return Size() == 0; }
+
+size_t LockFreeWorkQueue::Size() const {
+  return deque_.Size() + injection_queue_.Size() +
+         overflow_size_.load(std::memory_order_relaxed);
+}
+
+EventEngine::Closure* LockFreeWorkQueue::PopMostRecent() {
+  if (!IsOwnerThread()) return PopOldest();
+  EventEngine::Closure* closure = deque_.Pop();
+  if (closure != nullptr) return closure;
+  closure = injection_queue_.Pop();
+  if (closure != nullptr) return closure;
+  return PopOverflow(/*most_recent=*/true);
+}
+
+EventEngine::Closure* LockFreeWorkQueue::PopOldest() {
+  EventEngine::Closure* closure = deque_.Steal();
+  if (closure != nullptr) return closure;
+  closure = injection_queue_.Pop();
+  if (closure != nullptr) return closure;
+  return PopOverflow(/*most_recent=*/false);
+}
+
+void LockFreeWorkQueue::Add(EventEngine::Closure* closure) {
+  if (IsOwnerThread() && deque_.Push(closure)) return;
+  if (injection_queue_.Push(closure)) return;
+  grpc_core::MutexLock lock(&overflow_mu_);
+  overflow_.push_back(closure);
+  overflow_size_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void LockFreeWorkQueue::Add(absl::AnyInvocable<void()> invocable) {
+  Add(SelfDeletingClosure::Create(std::move(invocable)));
+}
+
+EventEngine::Closure* LockFreeWorkQueue::PopOverflow(bool most_recent) {
+  if (overflow_size_.load(std::memory_order_relaxed) == 0) return nullptr;
+  grpc_core::MutexLock lock(&overflow_mu_);
+  if (overflow_.empty()) return nullptr;
+  EventEngine::Closure* closure;
+  if (most_recent) {
+    closure = overflow_.back();
+    overflow_.pop_back();
+  } else {
+    closure = overflow_.front();
+    overflow_.pop_front();
+  }
+  overflow_size_.fetch_sub(1, std::memory_order_relaxed);
+  return closure;
+}
+
+}  // namespace grpc_event_engine::experimental
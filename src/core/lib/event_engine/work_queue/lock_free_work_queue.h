@@ -0,0 +1,132 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_WORK_QUEUE_LOCK_FREE_WORK_QUEUE_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_WORK_QUEUE_LOCK_FREE_WORK_QUEUE_H
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <deque>
+#include <thread>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/functional/any_invocable.h"
+#include "src/core/lib/event_engine/work_queue/work_queue.h"
+#include "src/core/util/sync.h"
+
+namespace grpc_event_engine::experimental {
+
+// A WorkQueue whose common operations take no locks.
+//
+// The thread that creates the queue owns it. Closures added by the owner go
+// to a bounded Chase-Lev deque, whose bottom (most recent) end only the owner
+// touches and whose top (oldest) end any thread may steal from. Closures added
+// by other threads go to a bounded lock-free MPMC injection queue. When either
+// is full, closures spill over into a mutex-protected deque, which is skipped
+// without locking while it is empty.
+//
+// PopMostRecent() on the owner thread returns the most recent closure the
+// owner added, then falls back to the injection queue. On any other thread it
+// behaves like PopOldest(): others only ever steal from the oldest end.
+class LockFreeWorkQueue : public WorkQueue {
+ public:
+  // Both capacities must be powers of two.
+  static constexpr size_t kDequeCapacity = 1024;
+  static constexpr size_t kInjectionQueueCapacity = 1024;
+
+  LockFreeWorkQueue() : LockFreeWorkQueue(nullptr) {}
+  explicit LockFreeWorkQueue(void* owner);
+  // Returns whether the queue is empty
+  bool Empty() const override;
+  // Returns the size of the queue.
+  size_t Size() const override;
+  // Returns the most recent element from the queue, or nullptr if either empty
+  // or the queue is under contention. Only the owner thread sees LIFO order.
+  //
+  // This method may return nullptr even if the queue is not empty.
+  EventEngine::Closure* PopMostRecent() override;
+  // Returns the oldest element from the queue, or nullptr if either empty or
+  // the queue is under contention.
+  //
+  // This method may return nullptr even if the queue is not empty.
+  EventEngine::Closure* PopOldest() override;
+  // Adds a closure to the queue.
+  void Add(EventEngine::Closure* closure) override;
+  // Wraps an AnyInvocable and adds it to the the queue.
+  void Add(absl::AnyInvocable<void()> invocable) override;
+  const void* owner() override { return owner_; }
+
+ private:
+  // A bounded Chase-Lev work-stealing deque, after Lê et al., "Correct and
+  // Efficient Work-Stealing for Weak Memory Models".
+  class WorkStealingDeque {
+   public:
+    // Owner only. Returns false if the deque is full.
+    bool Push(EventEngine::Closure* closure);
+    // Owner only. Takes the most recently pushed closure.
+    EventEngine::Closure* Pop();
+    // Any thread. Takes the oldest closure; returns nullptr if the deque is
+    // empty or another thread took it first.
+    EventEngine::Closure* Steal();
+    size_t Size() const;
+
+   private:
+    alignas(GPR_CACHELINE_SIZE) std::atomic<int64_t> top_{0};
+    alignas(GPR_CACHELINE_SIZE) std::atomic<int64_t> bottom_{0};
+    std::atomic<EventEngine::Closure*> buffer_[kDequeCapacity] = {};
+  };
+
+  // A bounded multi-producer multi-consumer queue (Vyukov's algorithm): each
+  // cell carries a sequence number telling producers and consumers whose turn
+  // it is, so neither side ever waits on the other.
+  class InjectionQueue {
+   public:
+    InjectionQueue();
+    // Returns false if the queue is full.
+    bool Push(EventEngine::Closure* closure);
+    // Returns nullptr if the queue is empty.
+    EventEngine::Closure* Pop();
+    size_t Size() const;
+
+   private:
+    struct Cell {
+      std::atomic<size_t> sequence;
+      EventEngine::Closure* closure;
+    };
+
+    alignas(GPR_CACHELINE_SIZE) std::atomic<size_t> enqueue_pos_{0};
+    alignas(GPR_CACHELINE_SIZE) std::atomic<size_t> dequeue_pos_{0};
+    Cell cells_[kInjectionQueueCapacity];
+  };
+
+  bool IsOwnerThread() const {
+    return std::this_thread::get_id() == owner_thread_;
+  }
+  EventEngine::Closure* PopOverflow(bool most_recent)
+      ABSL_LOCKS_EXCLUDED(overflow_mu_);
+
+  const std::thread::id owner_thread_;
+  const void* const owner_;
+  WorkStealingDeque deque_;
+  InjectionQueue injection_queue_;
+  std::atomic<size_t> overflow_size_{0};
+  grpc_core::Mutex overflow_mu_;
+  std::deque<EventEngine::Closure*> overflow_ ABSL_GUARDED_BY(overflow_mu_);
+};
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_WORK_QUEUE_LOCK_FREE_WORK_QUEUE_H
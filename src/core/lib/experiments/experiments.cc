@@ -26,12 +26,52 @@ namespace {
 const char* const description_backoff_cap_initial_at_max =
     "Backoff library applies max_backoff even on initial_backoff.";
 const char* const additional_constraints_backoff_cap_initial_at_max = "{}";
+const char* const description_call_deadline_wheel =
+    "Run call deadlines of at least a second off coarse per-cpu timer wheels, "
+    "instead of arming an EventEngine timer per call.";
+const char* const additional_constraints_call_deadline_wheel = "{}";
 const char* const description_call_tracer_in_transport =
     "Transport directly passes byte counts to CallTracer.";
 const char* const additional_constraints_call_tracer_in_transport = "{}";
 const char* const description_callv3_client_auth_filter =
     "Use the CallV3 client auth filter.";
 const char* const additional_constraints_callv3_client_auth_filter = "{}";
+const char* const description_chttp2_coalesce_control_frames =
+    "Hold chttp2 writes that carry only control frames (WINDOW_UPDATE, "
+    "SETTINGS ACK, PING ACK) for up to a millisecond, so that they go out with "
+    "the next data write instead of in writes of their own.";
+const char* const additional_constraints_chttp2_coalesce_control_frames = "{}";
+const char* const description_chttp2_idle_compaction =
+    "When an HTTP/2 connection has had no streams for a keepalive interval, "
+    "release idle write buffers and have the peer drop the HPACK decoder table "
+    "via SETTINGS.";
+const char* const additional_constraints_chttp2_idle_compaction = "{}";
+const char* const description_chttp2_keepalive_ticker =
+    "Drive chttp2 keepalive timers of at least ten seconds from a shared "
+    "coarse ticker per EventEngine instead of one EventEngine timer per "
+    "connection.";
+const char* const additional_constraints_chttp2_keepalive_ticker = "{}";
+const char* const description_chttp2_model_based_flow_control =
+    "Size chttp2 stream and transport windows from a BBR style model of the "
+    "path (peak receive rate times minimum RTT from TCP_INFO) instead of from "
+    "BDP pings alone.";
+const char* const additional_constraints_chttp2_model_based_flow_control = "{}";
+const char* const description_chttp2_offload_stream_callbacks =
+    "Run each chttp2 stream's receive callbacks, and so the filter work on "
+    "received metadata and messages, in order on the EventEngine pool instead "
+    "of on the thread holding the transport combiner.";
+const char* const additional_constraints_chttp2_offload_stream_callbacks = "{}";
+const char* const description_chttp2_optimistic_connect =
+    "Report new client connections as ready as soon as the handshake "
+    "completes, instead of waiting for the server's SETTINGS frame, so the "
+    "first RPC is sent in the same flight as the client preface.";
+const char* const additional_constraints_chttp2_optimistic_connect = "{}";
+const char* const description_chttp2_weighted_write_scheduling =
+    "Share each chttp2 write between writable streams by weighted deficit "
+    "round robin, instead of letting each stream fill the write in turn, and "
+    "put streams with only headers or the last frames of a short call first.";
+const char* const additional_constraints_chttp2_weighted_write_scheduling =
+    "{}";
 const char* const description_disable_buffer_hint_on_high_memory_pressure =
     "Disable buffer hint flag parsing in the transport under high memory "
     "pressure.";
@@ -54,6 +94,10 @@ const char* const additional_constraints_event_engine_client = "{}";
 const char* const description_event_engine_dns =
     "If set, use EventEngine DNSResolver for client channel resolution";
 const char* const additional_constraints_event_engine_dns = "{}";
+const char* const description_event_engine_dns_cache =
+    "Share c-ares DNS results between the EventEngine DNS resolvers in the "
+    "process, coalescing identical queries and caching their results.";
+const char* const additional_constraints_event_engine_dns_cache = "{}";
 const char* const description_event_engine_dns_non_client_channel =
     "If set, use EventEngine DNSResolver in other places besides client "
     "channel.";
@@ -62,6 +106,21 @@ const char* const additional_constraints_event_engine_dns_non_client_channel =
 const char* const description_event_engine_listener =
     "Use EventEngine listeners instead of iomgr's grpc_tcp_server";
 const char* const additional_constraints_event_engine_listener = "{}";
+const char* const description_event_engine_lock_free_work_queue =
+    "Use a lock-free work queue (a Chase-Lev deque for the owning thread plus "
+    "a lock-free injection queue) for EventEngine thread pool workers instead "
+    "of a mutex-protected deque.";
+const char* const additional_constraints_event_engine_lock_free_work_queue =
+    "{}";
+const char* const description_event_engine_shard_local_run =
+    "With a sharded poller, run closures that are scheduled from a poller "
+    "shard thread on that shard instead of handing them to the shared thread "
+    "pool.";
+const char* const additional_constraints_event_engine_shard_local_run = "{}";
+const char* const description_event_engine_timer_wheel =
+    "Keep EventEngine timers in hierarchical timing wheels, with O(1) "
+    "insertion and cancellation, instead of sharded binary heaps.";
+const char* const additional_constraints_event_engine_timer_wheel = "{}";
 const char* const description_free_large_allocator =
     "If set, return all free bytes from a \042big\042 allocator";
 const char* const additional_constraints_free_large_allocator = "{}";
@@ -78,19 +137,40 @@ const char* const description_max_pings_wo_data_throttle =
     "GRPC_ARG_HTTP2_MAX_PINGS_WITHOUT_DATA limit has reached (instead of "
     "completely blocking).";
 const char* const additional_constraints_max_pings_wo_data_throttle = "{}";
+const char* const description_memory_pressure_scaled_buffers =
+    "Shrink endpoint read chunks and socket receive buffers smoothly as memory "
+    "pressure rises, along the same curve as the HTTP/2 flow control window.";
+const char* const additional_constraints_memory_pressure_scaled_buffers = "{}";
+const char* const description_memory_quota_per_cpu_cache =
+    "Cache small memory quota takes and returns per cpu, and settle them with "
+    "the quota's shared free byte counter in batches.";
+const char* const additional_constraints_memory_quota_per_cpu_cache = "{}";
 const char* const description_monitoring_experiment =
     "Placeholder experiment to prove/disprove our monitoring is working";
 const char* const additional_constraints_monitoring_experiment = "{}";
 const char* const description_multiping =
     "Allow more than one ping to be in flight at a time by default.";
 const char* const additional_constraints_multiping = "{}";
+const char* const description_party_coalesced_wakeups =
+    "Wake parties with a single fetch_or instead of a CAS loop, so that "
+    "concurrent wakers of a locked party never retry against each other.";
+const char* const additional_constraints_party_coalesced_wakeups = "{}";
 const char* const description_pick_first_new =
     "New pick_first impl with memory reduction.";
 const char* const additional_constraints_pick_first_new = "{}";
+const char* const description_pick_first_prefer_connected_family =
+    "pick_first tries the address family of its last successful connection "
+    "first when it reconnects, instead of the resolver's family order.";
+const char* const additional_constraints_pick_first_prefer_connected_family =
+    "{}";
 const char* const description_posix_ee_skip_grpc_init =
     "Prevent the PosixEventEngine from calling grpc_init & grpc_shutdown on "
     "creation and destruction.";
 const char* const additional_constraints_posix_ee_skip_grpc_init = "{}";
+const char* const description_posix_lean_client_socket_setup =
+    "Create posix client sockets non-blocking and close-on-exec, and set their "
+    "TCP_NODELAY and SO_REUSEADDR without reading them back.";
+const char* const additional_constraints_posix_lean_client_socket_setup = "{}";
 const char* const description_prioritize_finished_requests =
     "Prioritize flushing out finished requests over other in-flight requests "
     "during transport writes.";
@@ -110,8 +190,24 @@ const char* const additional_constraints_promise_based_http2_server_transport =
 const char* const description_promise_based_inproc_transport =
     "Use promises for the in-process transport.";
 const char* const additional_constraints_promise_based_inproc_transport = "{}";
+const char* const description_reclaimer_cost_aware_selection =
+    "Choose which memory reclaimer to run by how much its allocator holds and "
+    "how long it has been idle, instead of strictly in posting order.";
+const char* const additional_constraints_reclaimer_cost_aware_selection = "{}";
 const char* const description_retry_in_callv3 = "Support retries with call-v3";
 const char* const additional_constraints_retry_in_callv3 = "{}";
+const char* const description_ring_hash_async_table_build =
+    "Build large ring_hash and maglev tables on the EventEngine, serving from "
+    "the previous table until the new one is ready.";
+const char* const additional_constraints_ring_hash_async_table_build = "{}";
+const char* const description_rls_lock_free_cache_reads =
+    "RLS pickers serve fresh cache entries from a snapshot taken when the "
+    "picker is created, instead of taking the policy lock on every pick.";
+const char* const additional_constraints_rls_lock_free_cache_reads = "{}";
+const char* const description_rls_refresh_ahead =
+    "RLS refreshes frequently picked cache entries before they go stale, so "
+    "that hot keys never wait on an RLS request.";
+const char* const additional_constraints_rls_refresh_ahead = "{}";
 const char* const description_rq_fast_reject =
     "Resource quota rejects requests immediately (before allocating the "
     "request structure) under very high memory pressure.";
@@ -120,9 +216,28 @@ const char* const description_schedule_cancellation_over_write =
     "Allow cancellation op to be scheduled over a write";
 const char* const additional_constraints_schedule_cancellation_over_write =
     "{}";
+const char* const description_secure_handshake_executor =
+    "Run the steps of TLS and ALTS handshakes that follow reads from the peer "
+    "on a bounded executor that limits how many run at once, running steps of "
+    "handshakes already under way before ones that start a handshake.";
+const char* const additional_constraints_secure_handshake_executor = "{}";
 const char* const description_server_listener =
     "If set, the new server listener classes are used.";
 const char* const additional_constraints_server_listener = "{}";
+const char* const description_shared_ssl_client_context =
+    "Share TSI client handshaker factories, and so their SSL contexts, between "
+    "channels whose TLS options are identical, instead of re-parsing roots and "
+    "keys for each channel.";
+const char* const additional_constraints_shared_ssl_client_context = "{}";
+const char* const description_skip_incompressible_methods =
+    "Stop compressing outgoing messages of methods whose sampled messages do "
+    "not shrink enough to pay for the CPU, re-probing them periodically.";
+const char* const additional_constraints_skip_incompressible_methods = "{}";
+const char* const description_ssl_zero_copy_protector =
+    "Use a zero-copy grpc protector for SSL connections, which protects a "
+    "whole slice buffer at a time and moves as many records as the SSL BIO "
+    "holds into each output slice.";
+const char* const additional_constraints_ssl_zero_copy_protector = "{}";
 const char* const description_tcp_frame_size_tuning =
     "If set, enables TCP to use RPC size estimation made by higher layers. TCP "
     "would not indicate completion of a read operation until a specified "
@@ -132,13 +247,36 @@ const char* const additional_constraints_tcp_frame_size_tuning = "{}";
 const char* const description_tcp_rcv_lowat =
     "Use SO_RCVLOWAT to avoid wakeups on the read path.";
 const char* const additional_constraints_tcp_rcv_lowat = "{}";
+const char* const description_tls_kernel_write_offload =
+    "Install the write keys of TLS 1.2 AES-GCM connections on the socket with "
+    "kernel TLS, so that writes are encrypted by the kernel instead of the SSL "
+    "frame protector.";
+const char* const additional_constraints_tls_kernel_write_offload = "{}";
 const char* const description_trace_record_callops =
     "Enables tracing of call batch initiation and completion.";
 const char* const additional_constraints_trace_record_callops = "{}";
+const char* const description_transport_message_size_check =
+    "Reject received messages longer than the channel's max receive message "
+    "length in the transport, as soon as their length prefix is read, instead "
+    "of after buffering them.";
+const char* const additional_constraints_transport_message_size_check = "{}";
 const char* const description_unconstrained_max_quota_buffer_size =
     "Discard the cap on the max free pool size for one memory allocator";
 const char* const additional_constraints_unconstrained_max_quota_buffer_size =
     "{}";
+const char* const description_work_serializer_batched_drain =
+    "Drain several queued work serializer callbacks per EventEngine closure, "
+    "instead of rescheduling once per callback.";
+const char* const additional_constraints_work_serializer_batched_drain = "{}";
+const char* const description_wrr_shared_endpoint_weights =
+    "Share WRR endpoint weights across the channels to the same target and "
+    "locality, so that each channel's weights are fed by the ORCA reports seen "
+    "by all of them.";
+const char* const additional_constraints_wrr_shared_endpoint_weights = "{}";
+const char* const description_wrr_skip_unchanged_weights =
+    "Keep the WRR picker's scheduler across weight updates that leave every "
+    "endpoint weight within 1% of the weights it was built from.";
+const char* const additional_constraints_wrr_skip_unchanged_weights = "{}";
 }  // namespace
 
 namespace grpc_core {
@@ -146,10 +284,34 @@ namespace grpc_core {
 const ExperimentMetadata g_experiment_metadata[] = {
     {"backoff_cap_initial_at_max", description_backoff_cap_initial_at_max,
      additional_constraints_backoff_cap_initial_at_max, nullptr, 0, true, true},
+    {"call_deadline_wheel", description_call_deadline_wheel,
+     additional_constraints_call_deadline_wheel, nullptr, 0, false, true},
     {"call_tracer_in_transport", description_call_tracer_in_transport,
      additional_constraints_call_tracer_in_transport, nullptr, 0, true, true},
     {"callv3_client_auth_filter", description_callv3_client_auth_filter,
      additional_constraints_callv3_client_auth_filter, nullptr, 0, false, true},
+    {"chttp2_coalesce_control_frames",
+     description_chttp2_coalesce_control_frames,
+     additional_constraints_chttp2_coalesce_control_frames, nullptr, 0, false,
+     true},
+    {"chttp2_idle_compaction", description_chttp2_idle_compaction,
+     additional_constraints_chttp2_idle_compaction, nullptr, 0, false, true},
+    {"chttp2_keepalive_ticker", description_chttp2_keepalive_ticker,
+     additional_constraints_chttp2_keepalive_ticker, nullptr, 0, false, true},
+    {"chttp2_model_based_flow_control",
+     description_chttp2_model_based_flow_control,
+     additional_constraints_chttp2_model_based_flow_control, nullptr, 0, false,
+     true},
+    {"chttp2_offload_stream_callbacks",
+     description_chttp2_offload_stream_callbacks,
+     additional_constraints_chttp2_offload_stream_callbacks, nullptr, 0, false,
+     true},
+    {"chttp2_optimistic_connect", description_chttp2_optimistic_connect,
+     additional_constraints_chttp2_optimistic_connect, nullptr, 0, false, true},
+    {"chttp2_weighted_write_scheduling",
+     description_chttp2_weighted_write_scheduling,
+     additional_constraints_chttp2_weighted_write_scheduling, nullptr, 0, false,
+     true},
     {"disable_buffer_hint_on_high_memory_pressure",
      description_disable_buffer_hint_on_high_memory_pressure,
      additional_constraints_disable_buffer_hint_on_high_memory_pressure,
@@ -165,12 +327,23 @@ const ExperimentMetadata g_experiment_metadata[] = {
      additional_constraints_event_engine_client, nullptr, 0, false, true},
     {"event_engine_dns", description_event_engine_dns,
      additional_constraints_event_engine_dns, nullptr, 0, false, false},
+    {"event_engine_dns_cache", description_event_engine_dns_cache,
+     additional_constraints_event_engine_dns_cache, nullptr, 0, false, true},
     {"event_engine_dns_non_client_channel",
      description_event_engine_dns_non_client_channel,
      additional_constraints_event_engine_dns_non_client_channel, nullptr, 0,
      false, false},
     {"event_engine_listener", description_event_engine_listener,
      additional_constraints_event_engine_listener, nullptr, 0, false, true},
+    {"event_engine_lock_free_work_queue",
+     description_event_engine_lock_free_work_queue,
+     additional_constraints_event_engine_lock_free_work_queue, nullptr, 0,
+     false, true},
+    {"event_engine_shard_local_run", description_event_engine_shard_local_run,
+     additional_constraints_event_engine_shard_local_run, nullptr, 0, false,
+     true},
+    {"event_engine_timer_wheel", description_event_engine_timer_wheel,
+     additional_constraints_event_engine_timer_wheel, nullptr, 0, false, true},
     {"free_large_allocator", description_free_large_allocator,
      additional_constraints_free_large_allocator, nullptr, 0, false, true},
     {"keep_alive_ping_timer_batch", description_keep_alive_ping_timer_batch,
@@ -180,14 +353,31 @@ const ExperimentMetadata g_experiment_metadata[] = {
      additional_constraints_local_connector_secure, nullptr, 0, false, true},
     {"max_pings_wo_data_throttle", description_max_pings_wo_data_throttle,
      additional_constraints_max_pings_wo_data_throttle, nullptr, 0, true, true},
+    {"memory_pressure_scaled_buffers",
+     description_memory_pressure_scaled_buffers,
+     additional_constraints_memory_pressure_scaled_buffers, nullptr, 0, false,
+     true},
+    {"memory_quota_per_cpu_cache", description_memory_quota_per_cpu_cache,
+     additional_constraints_memory_quota_per_cpu_cache, nullptr, 0, false,
+     true},
     {"monitoring_experiment", description_monitoring_experiment,
      additional_constraints_monitoring_experiment, nullptr, 0, true, true},
     {"multiping", description_multiping, additional_constraints_multiping,
      nullptr, 0, false, true},
+    {"party_coalesced_wakeups", description_party_coalesced_wakeups,
+     additional_constraints_party_coalesced_wakeups, nullptr, 0, false, true},
     {"pick_first_new", description_pick_first_new,
      additional_constraints_pick_first_new, nullptr, 0, true, true},
+    {"pick_first_prefer_connected_family",
+     description_pick_first_prefer_connected_family,
+     additional_constraints_pick_first_prefer_connected_family, nullptr, 0,
+     false, true},
     {"posix_ee_skip_grpc_init", description_posix_ee_skip_grpc_init,
      additional_constraints_posix_ee_skip_grpc_init, nullptr, 0, false, true},
+    {"posix_lean_client_socket_setup",
+     description_posix_lean_client_socket_setup,
+     additional_constraints_posix_lean_client_socket_setup, nullptr, 0, false,
+     true},
     {"prioritize_finished_requests", description_prioritize_finished_requests,
      additional_constraints_prioritize_finished_requests, nullptr, 0, false,
      true},
@@ -203,26 +393,60 @@ const ExperimentMetadata g_experiment_metadata[] = {
      description_promise_based_inproc_transport,
      additional_constraints_promise_based_inproc_transport, nullptr, 0, false,
      false},
+    {"reclaimer_cost_aware_selection",
+     description_reclaimer_cost_aware_selection,
+     additional_constraints_reclaimer_cost_aware_selection, nullptr, 0, false,
+     true},
     {"retry_in_callv3", description_retry_in_callv3,
      additional_constraints_retry_in_callv3, nullptr, 0, false, true},
+    {"ring_hash_async_table_build", description_ring_hash_async_table_build,
+     additional_constraints_ring_hash_async_table_build, nullptr, 0, false,
+     true},
+    {"rls_lock_free_cache_reads", description_rls_lock_free_cache_reads,
+     additional_constraints_rls_lock_free_cache_reads, nullptr, 0, false, true},
+    {"rls_refresh_ahead", description_rls_refresh_ahead,
+     additional_constraints_rls_refresh_ahead, nullptr, 0, false, true},
     {"rq_fast_reject", description_rq_fast_reject,
      additional_constraints_rq_fast_reject, nullptr, 0, false, true},
     {"schedule_cancellation_over_write",
      description_schedule_cancellation_over_write,
      additional_constraints_schedule_cancellation_over_write, nullptr, 0, false,
      true},
+    {"secure_handshake_executor", description_secure_handshake_executor,
+     additional_constraints_secure_handshake_executor, nullptr, 0, false, true},
     {"server_listener", description_server_listener,
      additional_constraints_server_listener, nullptr, 0, true, true},
+    {"shared_ssl_client_context", description_shared_ssl_client_context,
+     additional_constraints_shared_ssl_client_context, nullptr, 0, false, true},
+    {"skip_incompressible_methods", description_skip_incompressible_methods,
+     additional_constraints_skip_incompressible_methods, nullptr, 0, false,
+     true},
+    {"ssl_zero_copy_protector", description_ssl_zero_copy_protector,
+     additional_constraints_ssl_zero_copy_protector, nullptr, 0, false, true},
     {"tcp_frame_size_tuning", description_tcp_frame_size_tuning,
      additional_constraints_tcp_frame_size_tuning, nullptr, 0, false, true},
     {"tcp_rcv_lowat", description_tcp_rcv_lowat,
      additional_constraints_tcp_rcv_lowat, nullptr, 0, false, true},
+    {"tls_kernel_write_offload", description_tls_kernel_write_offload,
+     additional_constraints_tls_kernel_write_offload, nullptr, 0, false, true},
     {"trace_record_callops", description_trace_record_callops,
      additional_constraints_trace_record_callops, nullptr, 0, true, true},
+    {"transport_message_size_check", description_transport_message_size_check,
+     additional_constraints_transport_message_size_check, nullptr, 0, false,
+     true},
     {"unconstrained_max_quota_buffer_size",
      description_unconstrained_max_quota_buffer_size,
      additional_constraints_unconstrained_max_quota_buffer_size, nullptr, 0,
      false, true},
+    {"work_serializer_batched_drain", description_work_serializer_batched_drain,
+     additional_constraints_work_serializer_batched_drain, nullptr, 0, false,
+     true},
+    {"wrr_shared_endpoint_weights", description_wrr_shared_endpoint_weights,
+     additional_constraints_wrr_shared_endpoint_weights, nullptr, 0, false,
+     true},
+    {"wrr_skip_unchanged_weights", description_wrr_skip_unchanged_weights,
+     additional_constraints_wrr_skip_unchanged_weights, nullptr, 0, false,
+     true},
 };
 
 }  // namespace grpc_core
@@ -232,12 +456,52 @@ namespace {
 const char* const description_backoff_cap_initial_at_max =
     "Backoff library applies max_backoff even on initial_backoff.";
 const char* const additional_constraints_backoff_cap_initial_at_max = "{}";
+const char* const description_call_deadline_wheel =
+    "Run call deadlines of at least a second off coarse per-cpu timer wheels, "
+    "instead of arming an EventEngine timer per call.";
+const char* const additional_constraints_call_deadline_wheel = "{}";
 const char* const description_call_tracer_in_transport =
     "Transport directly passes byte counts to CallTracer.";
 const char* const additional_constraints_call_tracer_in_transport = "{}";
 const char* const description_callv3_client_auth_filter =
     "Use the CallV3 client auth filter.";
 const char* const additional_constraints_callv3_client_auth_filter = "{}";
+const char* const description_chttp2_coalesce_control_frames =
+    "Hold chttp2 writes that carry only control frames (WINDOW_UPDATE, "
+    "SETTINGS ACK, PING ACK) for up to a millisecond, so that they go out with "
+    "the next data write instead of in writes of their own.";
+const char* const additional_constraints_chttp2_coalesce_control_frames = "{}";
+const char* const description_chttp2_idle_compaction =
+    "When an HTTP/2 connection has had no streams for a keepalive interval, "
+    "release idle write buffers and have the peer drop the HPACK decoder table "
+    "via SETTINGS.";
+const char* const additional_constraints_chttp2_idle_compaction = "{}";
+const char* const description_chttp2_keepalive_ticker =
+    "Drive chttp2 keepalive timers of at least ten seconds from a shared "
+    "coarse ticker per EventEngine instead of one EventEngine timer per "
+    "connection.";
+const char* const additional_constraints_chttp2_keepalive_ticker = "{}";
+const char* const description_chttp2_model_based_flow_control =
+    "Size chttp2 stream and transport windows from a BBR style model of the "
+    "path (peak receive rate times minimum RTT from TCP_INFO) instead of from "
+    "BDP pings alone.";
+const char* const additional_constraints_chttp2_model_based_flow_control = "{}";
+const char* const description_chttp2_offload_stream_callbacks =
+    "Run each chttp2 stream's receive callbacks, and so the filter work on "
+    "received metadata and messages, in order on the EventEngine pool instead "
+    "of on the thread holding the transport combiner.";
+const char* const additional_constraints_chttp2_offload_stream_callbacks = "{}";
+const char* const description_chttp2_optimistic_connect =
+    "Report new client connections as ready as soon as the handshake "
+    "completes, instead of waiting for the server's SETTINGS frame, so the "
+    "first RPC is sent in the same flight as the client preface.";
+const char* const additional_constraints_chttp2_optimistic_connect = "{}";
+const char* const description_chttp2_weighted_write_scheduling =
+    "Share each chttp2 write between writable streams by weighted deficit "
+    "round robin, instead of letting each stream fill the write in turn, and "
+    "put streams with only headers or the last frames of a short call first.";
+const char* const additional_constraints_chttp2_weighted_write_scheduling =
+    "{}";
 const char* const description_disable_buffer_hint_on_high_memory_pressure =
     "Disable buffer hint flag parsing in the transport under high memory "
     "pressure.";
@@ -260,6 +524,10 @@ const char* const additional_constraints_event_engine_client = "{}";
 const char* const description_event_engine_dns =
     "If set, use EventEngine DNSResolver for client channel resolution";
 const char* const additional_constraints_event_engine_dns = "{}";
+const char* const description_event_engine_dns_cache =
+    "Share c-ares DNS results between the EventEngine DNS resolvers in the "
+    "process, coalescing identical queries and caching their results.";
+const char* const additional_constraints_event_engine_dns_cache = "{}";
 const char* const description_event_engine_dns_non_client_channel =
     "If set, use EventEngine DNSResolver in other places besides client "
     "channel.";
@@ -268,6 +536,21 @@ const char* const additional_constraints_event_engine_dns_non_client_channel =
 const char* const description_event_engine_listener =
     "Use EventEngine listeners instead of iomgr's grpc_tcp_server";
 const char* const additional_constraints_event_engine_listener = "{}";
+const char* const description_event_engine_lock_free_work_queue =
+    "Use a lock-free work queue (a Chase-Lev deque for the owning thread plus "
+    "a lock-free injection queue) for EventEngine thread pool workers instead "
+    "of a mutex-protected deque.";
+const char* const additional_constraints_event_engine_lock_free_work_queue =
+    "{}";
+const char* const description_event_engine_shard_local_run =
+    "With a sharded poller, run closures that are scheduled from a poller "
+    "shard thread on that shard instead of handing them to the shared thread "
+    "pool.";
+const char* const additional_constraints_event_engine_shard_local_run = "{}";
+const char* const description_event_engine_timer_wheel =
+    "Keep EventEngine timers in hierarchical timing wheels, with O(1) "
+    "insertion and cancellation, instead of sharded binary heaps.";
+const char* const additional_constraints_event_engine_timer_wheel = "{}";
 const char* const description_free_large_allocator =
     "If set, return all free bytes from a \042big\042 allocator";
 const char* const additional_constraints_free_large_allocator = "{}";
@@ -284,19 +567,40 @@ const char* const description_max_pings_wo_data_throttle =
     "GRPC_ARG_HTTP2_MAX_PINGS_WITHOUT_DATA limit has reached (instead of "
     "completely blocking).";
 const char* const additional_constraints_max_pings_wo_data_throttle = "{}";
+const char* const description_memory_pressure_scaled_buffers =
+    "Shrink endpoint read chunks and socket receive buffers smoothly as memory "
+    "pressure rises, along the same curve as the HTTP/2 flow control window.";
+const char* const additional_constraints_memory_pressure_scaled_buffers = "{}";
+const char* const description_memory_quota_per_cpu_cache =
+    "Cache small memory quota takes and returns per cpu, and settle them with "
+    "the quota's shared free byte counter in batches.";
+const char* const additional_constraints_memory_quota_per_cpu_cache = "{}";
 const char* const description_monitoring_experiment =
     "Placeholder experiment to prove/disprove our monitoring is working";
 const char* const additional_constraints_monitoring_experiment = "{}";
 const char* const description_multiping =
     "Allow more than one ping to be in flight at a time by default.";
 const char* const additional_constraints_multiping = "{}";
+const char* const description_party_coalesced_wakeups =
+    "Wake parties with a single fetch_or instead of a CAS loop, so that "
+    "concurrent wakers of a locked party never retry against each other.";
+const char* const additional_constraints_party_coalesced_wakeups = "{}";
 const char* const description_pick_first_new =
     "New pick_first impl with memory reduction.";
 const char* const additional_constraints_pick_first_new = "{}";
+const char* const description_pick_first_prefer_connected_family =
+    "pick_first tries the address family of its last successful connection "
+    "first when it reconnects, instead of the resolver's family order.";
+const char* const additional_constraints_pick_first_prefer_connected_family =
+    "{}";
 const char* const description_posix_ee_skip_grpc_init =
     "Prevent the PosixEventEngine from calling grpc_init & grpc_shutdown on "
     "creation and destruction.";
 const char* const additional_constraints_posix_ee_skip_grpc_init = "{}";
+const char* const description_posix_lean_client_socket_setup =
+    "Create posix client sockets non-blocking and close-on-exec, and set their "
+    "TCP_NODELAY and SO_REUSEADDR without reading them back.";
+const char* const additional_constraints_posix_lean_client_socket_setup = "{}";
 const char* const description_prioritize_finished_requests =
     "Prioritize flushing out finished requests over other in-flight requests "
     "during transport writes.";
@@ -316,8 +620,24 @@ const char* const additional_constraints_promise_based_http2_server_transport =
 const char* const description_promise_based_inproc_transport =
     "Use promises for the in-process transport.";
 const char* const additional_constraints_promise_based_inproc_transport = "{}";
+const char* const description_reclaimer_cost_aware_selection =
+    "Choose which memory reclaimer to run by how much its allocator holds and "
+    "how long it has been idle, instead of strictly in posting order.";
+const char* const additional_constraints_reclaimer_cost_aware_selection = "{}";
 const char* const description_retry_in_callv3 = "Support retries with call-v3";
 const char* const additional_constraints_retry_in_callv3 = "{}";
+const char* const description_ring_hash_async_table_build =
+    "Build large ring_hash and maglev tables on the EventEngine, serving from "
+    "the previous table until the new one is ready.";
+const char* const additional_constraints_ring_hash_async_table_build = "{}";
+const char* const description_rls_lock_free_cache_reads =
+    "RLS pickers serve fresh cache entries from a snapshot taken when the "
+    "picker is created, instead of taking the policy lock on every pick.";
+const char* const additional_constraints_rls_lock_free_cache_reads = "{}";
+const char* const description_rls_refresh_ahead =
+    "RLS refreshes frequently picked cache entries before they go stale, so "
+    "that hot keys never wait on an RLS request.";
+const char* const additional_constraints_rls_refresh_ahead = "{}";
 const char* const description_rq_fast_reject =
     "Resource quota rejects requests immediately (before allocating the "
     "request structure) under very high memory pressure.";
@@ -326,9 +646,28 @@ const char* const description_schedule_cancellation_over_write =
     "Allow cancellation op to be scheduled over a write";
 const char* const additional_constraints_schedule_cancellation_over_write =
     "{}";
+const char* const description_secure_handshake_executor =
+    "Run the steps of TLS and ALTS handshakes that follow reads from the peer "
+    "on a bounded executor that limits how many run at once, running steps of "
+    "handshakes already under way before ones that start a handshake.";
+const char* const additional_constraints_secure_handshake_executor = "{}";
 const char* const description_server_listener =
     "If set, the new server listener classes are used.";
 const char* const additional_constraints_server_listener = "{}";
+const char* const description_shared_ssl_client_context =
+    "Share TSI client handshaker factories, and so their SSL contexts, between "
+    "channels whose TLS options are identical, instead of re-parsing roots and "
+    "keys for each channel.";
+const char* const additional_constraints_shared_ssl_client_context = "{}";
+const char* const description_skip_incompressible_methods =
+    "Stop compressing outgoing messages of methods whose sampled messages do "
+    "not shrink enough to pay for the CPU, re-probing them periodically.";
+const char* const additional_constraints_skip_incompressible_methods = "{}";
+const char* const description_ssl_zero_copy_protector =
+    "Use a zero-copy grpc protector for SSL connections, which protects a "
+    "whole slice buffer at a time and moves as many records as the SSL BIO "
+    "holds into each output slice.";
+const char* const additional_constraints_ssl_zero_copy_protector = "{}";
 const char* const description_tcp_frame_size_tuning =
     "If set, enables TCP to use RPC size estimation made by higher layers. TCP "
     "would not indicate completion of a read operation until a specified "
@@ -338,13 +677,36 @@ const char* const additional_constraints_tcp_frame_size_tuning = "{}";
 const char* const description_tcp_rcv_lowat =
     "Use SO_RCVLOWAT to avoid wakeups on the read path.";
 const char* const additional_constraints_tcp_rcv_lowat = "{}";
+const char* const description_tls_kernel_write_offload =
+    "Install the write keys of TLS 1.2 AES-GCM connections on the socket with "
+    "kernel TLS, so that writes are encrypted by the kernel instead of the SSL "
+    "frame protector.";
+const char* const additional_constraints_tls_kernel_write_offload = "{}";
 const char* const description_trace_record_callops =
     "Enables tracing of call batch initiation and completion.";
 const char* const additional_constraints_trace_record_callops = "{}";
+const char* const description_transport_message_size_check =
+    "Reject received messages longer than the channel's max receive message "
+    "length in the transport, as soon as their length prefix is read, instead "
+    "of after buffering them.";
+const char* const additional_constraints_transport_message_size_check = "{}";
 const char* const description_unconstrained_max_quota_buffer_size =
     "Discard the cap on the max free pool size for one memory allocator";
 const char* const additional_constraints_unconstrained_max_quota_buffer_size =
     "{}";
+const char* const description_work_serializer_batched_drain =
+    "Drain several queued work serializer callbacks per EventEngine closure, "
+    "instead of rescheduling once per callback.";
+const char* const additional_constraints_work_serializer_batched_drain = "{}";
+const char* const description_wrr_shared_endpoint_weights =
+    "Share WRR endpoint weights across the channels to the same target and "
+    "locality, so that each channel's weights are fed by the ORCA reports seen "
+    "by all of them.";
+const char* const additional_constraints_wrr_shared_endpoint_weights = "{}";
+const char* const description_wrr_skip_unchanged_weights =
+    "Keep the WRR picker's scheduler across weight updates that leave every "
+    "endpoint weight within 1% of the weights it was built from.";
+const char* const additional_constraints_wrr_skip_unchanged_weights = "{}";
 }  // namespace
 
 namespace grpc_core {
@@ -352,10 +714,34 @@ namespace grpc_core {
 const ExperimentMetadata g_experiment_metadata[] = {
     {"backoff_cap_initial_at_max", description_backoff_cap_initial_at_max,
      additional_constraints_backoff_cap_initial_at_max, nullptr, 0, true, true},
+    {"call_deadline_wheel", description_call_deadline_wheel,
+     additional_constraints_call_deadline_wheel, nullptr, 0, false, true},
     {"call_tracer_in_transport", description_call_tracer_in_transport,
      additional_constraints_call_tracer_in_transport, nullptr, 0, true, true},
     {"callv3_client_auth_filter", description_callv3_client_auth_filter,
      additional_constraints_callv3_client_auth_filter, nullptr, 0, false, true},
+    {"chttp2_coalesce_control_frames",
+     description_chttp2_coalesce_control_frames,
+     additional_constraints_chttp2_coalesce_control_frames, nullptr, 0, false,
+     true},
+    {"chttp2_idle_compaction", description_chttp2_idle_compaction,
+     additional_constraints_chttp2_idle_compaction, nullptr, 0, false, true},
+    {"chttp2_keepalive_ticker", description_chttp2_keepalive_ticker,
+     additional_constraints_chttp2_keepalive_ticker, nullptr, 0, false, true},
+    {"chttp2_model_based_flow_control",
+     description_chttp2_model_based_flow_control,
+     additional_constraints_chttp2_model_based_flow_control, nullptr, 0, false,
+     true},
+    {"chttp2_offload_stream_callbacks",
+     description_chttp2_offload_stream_callbacks,
+     additional_constraints_chttp2_offload_stream_callbacks, nullptr, 0, false,
+     true},
+    {"chttp2_optimistic_connect", description_chttp2_optimistic_connect,
+     additional_constraints_chttp2_optimistic_connect, nullptr, 0, false, true},
+    {"chttp2_weighted_write_scheduling",
+     description_chttp2_weighted_write_scheduling,
+     additional_constraints_chttp2_weighted_write_scheduling, nullptr, 0, false,
+     true},
     {"disable_buffer_hint_on_high_memory_pressure",
      description_disable_buffer_hint_on_high_memory_pressure,
      additional_constraints_disable_buffer_hint_on_high_memory_pressure,
@@ -371,12 +757,23 @@ const ExperimentMetadata g_experiment_metadata[] = {
      additional_constraints_event_engine_client, nullptr, 0, true, true},
     {"event_engine_dns", description_event_engine_dns,
      additional_constraints_event_engine_dns, nullptr, 0, true, false},
+    {"event_engine_dns_cache", description_event_engine_dns_cache,
+     additional_constraints_event_engine_dns_cache, nullptr, 0, false, true},
     {"event_engine_dns_non_client_channel",
      description_event_engine_dns_non_client_channel,
      additional_constraints_event_engine_dns_non_client_channel, nullptr, 0,
      false, false},
     {"event_engine_listener", description_event_engine_listener,
      additional_constraints_event_engine_listener, nullptr, 0, true, true},
+    {"event_engine_lock_free_work_queue",
+     description_event_engine_lock_free_work_queue,
+     additional_constraints_event_engine_lock_free_work_queue, nullptr, 0,
+     false, true},
+    {"event_engine_shard_local_run", description_event_engine_shard_local_run,
+     additional_constraints_event_engine_shard_local_run, nullptr, 0, false,
+     true},
+    {"event_engine_timer_wheel", description_event_engine_timer_wheel,
+     additional_constraints_event_engine_timer_wheel, nullptr, 0, false, true},
     {"free_large_allocator", description_free_large_allocator,
      additional_constraints_free_large_allocator, nullptr, 0, false, true},
     {"keep_alive_ping_timer_batch", description_keep_alive_ping_timer_batch,
@@ -386,14 +783,31 @@ const ExperimentMetadata g_experiment_metadata[] = {
      additional_constraints_local_connector_secure, nullptr, 0, false, true},
     {"max_pings_wo_data_throttle", description_max_pings_wo_data_throttle,
      additional_constraints_max_pings_wo_data_throttle, nullptr, 0, true, true},
+    {"memory_pressure_scaled_buffers",
+     description_memory_pressure_scaled_buffers,
+     additional_constraints_memory_pressure_scaled_buffers, nullptr, 0, false,
+     true},
+    {"memory_quota_per_cpu_cache", description_memory_quota_per_cpu_cache,
+     additional_constraints_memory_quota_per_cpu_cache, nullptr, 0, false,
+     true},
     {"monitoring_experiment", description_monitoring_experiment,
      additional_constraints_monitoring_experiment, nullptr, 0, true, true},
     {"multiping", description_multiping, additional_constraints_multiping,
      nullptr, 0, false, true},
+    {"party_coalesced_wakeups", description_party_coalesced_wakeups,
+     additional_constraints_party_coalesced_wakeups, nullptr, 0, false, true},
     {"pick_first_new", description_pick_first_new,
      additional_constraints_pick_first_new, nullptr, 0, true, true},
+    {"pick_first_prefer_connected_family",
+     description_pick_first_prefer_connected_family,
+     additional_constraints_pick_first_prefer_connected_family, nullptr, 0,
+     false, true},
     {"posix_ee_skip_grpc_init", description_posix_ee_skip_grpc_init,
      additional_constraints_posix_ee_skip_grpc_init, nullptr, 0, false, true},
+    {"posix_lean_client_socket_setup",
+     description_posix_lean_client_socket_setup,
+     additional_constraints_posix_lean_client_socket_setup, nullptr, 0, false,
+     true},
     {"prioritize_finished_requests", description_prioritize_finished_requests,
      additional_constraints_prioritize_finished_requests, nullptr, 0, false,
      true},
@@ -409,26 +823,60 @@ const ExperimentMetadata g_experiment_metadata[] = {
      description_promise_based_inproc_transport,
      additional_constraints_promise_based_inproc_transport, nullptr, 0, false,
      false},
+    {"reclaimer_cost_aware_selection",
+     description_reclaimer_cost_aware_selection,
+     additional_constraints_reclaimer_cost_aware_selection, nullptr, 0, false,
+     true},
     {"retry_in_callv3", description_retry_in_callv3,
      additional_constraints_retry_in_callv3, nullptr, 0, false, true},
+    {"ring_hash_async_table_build", description_ring_hash_async_table_build,
+     additional_constraints_ring_hash_async_table_build, nullptr, 0, false,
+     true},
+    {"rls_lock_free_cache_reads", description_rls_lock_free_cache_reads,
+     additional_constraints_rls_lock_free_cache_reads, nullptr, 0, false, true},
+    {"rls_refresh_ahead", description_rls_refresh_ahead,
+     additional_constraints_rls_refresh_ahead, nullptr, 0, false, true},
     {"rq_fast_reject", description_rq_fast_reject,
      additional_constraints_rq_fast_reject, nullptr, 0, false, true},
     {"schedule_cancellation_over_write",
      description_schedule_cancellation_over_write,
      additional_constraints_schedule_cancellation_over_write, nullptr, 0, false,
      true},
+    {"secure_handshake_executor", description_secure_handshake_executor,
+     additional_constraints_secure_handshake_executor, nullptr, 0, false, true},
     {"server_listener", description_server_listener,
      additional_constraints_server_listener, nullptr, 0, true, true},
+    {"shared_ssl_client_context", description_shared_ssl_client_context,
+     additional_constraints_shared_ssl_client_context, nullptr, 0, false, true},
+    {"skip_incompressible_methods", description_skip_incompressible_methods,
+     additional_constraints_skip_incompressible_methods, nullptr, 0, false,
+     true},
+    {"ssl_zero_copy_protector", description_ssl_zero_copy_protector,
+     additional_constraints_ssl_zero_copy_protector, nullptr, 0, false, true},
     {"tcp_frame_size_tuning", description_tcp_frame_size_tuning,
      additional_constraints_tcp_frame_size_tuning, nullptr, 0, false, true},
     {"tcp_rcv_lowat", description_tcp_rcv_lowat,
      additional_constraints_tcp_rcv_lowat, nullptr, 0, false, true},
+    {"tls_kernel_write_offload", description_tls_kernel_write_offload,
+     additional_constraints_tls_kernel_write_offload, nullptr, 0, false, true},
     {"trace_record_callops", description_trace_record_callops,
      additional_constraints_trace_record_callops, nullptr, 0, true, true},
+    {"transport_message_size_check", description_transport_message_size_check,
+     additional_constraints_transport_message_size_check, nullptr, 0, false,
+     true},
     {"unconstrained_max_quota_buffer_size",
      description_unconstrained_max_quota_buffer_size,
      additional_constraints_unconstrained_max_quota_buffer_size, nullptr, 0,
      false, true},
+    {"work_serializer_batched_drain", description_work_serializer_batched_drain,
+     additional_constraints_work_serializer_batched_drain, nullptr, 0, false,
+     true},
+    {"wrr_shared_endpoint_weights", description_wrr_shared_endpoint_weights,
+     additional_constraints_wrr_shared_endpoint_weights, nullptr, 0, false,
+     true},
+    {"wrr_skip_unchanged_weights", description_wrr_skip_unchanged_weights,
+     additional_constraints_wrr_skip_unchanged_weights, nullptr, 0, false,
+     true},
 };
 
 }  // namespace grpc_core
@@ -438,12 +886,52 @@ namespace {
 const char* const description_backoff_cap_initial_at_max =
     "Backoff library applies max_backoff even on initial_backoff.";
 const char* const additional_constraints_backoff_cap_initial_at_max = "{}";
+const char* const description_call_deadline_wheel =
+    "Run call deadlines of at least a second off coarse per-cpu timer wheels, "
+    "instead of arming an EventEngine timer per call.";
+const char* const additional_constraints_call_deadline_wheel = "{}";
 const char* const description_call_tracer_in_transport =
     "Transport directly passes byte counts to CallTracer.";
 const char* const additional_constraints_call_tracer_in_transport = "{}";
 const char* const description_callv3_client_auth_filter =
     "Use the CallV3 client auth filter.";
 const char* const additional_constraints_callv3_client_auth_filter = "{}";
+const char* const description_chttp2_coalesce_control_frames =
+    "Hold chttp2 writes that carry only control frames (WINDOW_UPDATE, "
+    "SETTINGS ACK, PING ACK) for up to a millisecond, so that they go out with "
+    "the next data write instead of in writes of their own.";
+const char* const additional_constraints_chttp2_coalesce_control_frames = "{}";
+const char* const description_chttp2_idle_compaction =
+    "When an HTTP/2 connection has had no streams for a keepalive interval, "
+    "release idle write buffers and have the peer drop the HPACK decoder table "
+    "via SETTINGS.";
+const char* const additional_constraints_chttp2_idle_compaction = "{}";
+const char* const description_chttp2_keepalive_ticker =
+    "Drive chttp2 keepalive timers of at least ten seconds from a shared "
+    "coarse ticker per EventEngine instead of one EventEngine timer per "
+    "connection.";
+const char* const additional_constraints_chttp2_keepalive_ticker = "{}";
+const char* const description_chttp2_model_based_flow_control =
+    "Size chttp2 stream and transport windows from a BBR style model of the "
+    "path (peak receive rate times minimum RTT from TCP_INFO) instead of from "
+    "BDP pings alone.";
+const char* const additional_constraints_chttp2_model_based_flow_control = "{}";
+const char* const description_chttp2_offload_stream_callbacks =
+    "Run each chttp2 stream's receive callbacks, and so the filter work on "
+    "received metadata and messages, in order on the EventEngine pool instead "
+    "of on the thread holding the transport combiner.";
+const char* const additional_constraints_chttp2_offload_stream_callbacks = "{}";
+const char* const description_chttp2_optimistic_connect =
+    "Report new client connections as ready as soon as the handshake "
+    "completes, instead of waiting for the server's SETTINGS frame, so the "
+    "first RPC is sent in the same flight as the client preface.";
+const char* const additional_constraints_chttp2_optimistic_connect = "{}";
+const char* const description_chttp2_weighted_write_scheduling =
+    "Share each chttp2 write between writable streams by weighted deficit "
+    "round robin, instead of letting each stream fill the write in turn, and "
+    "put streams with only headers or the last frames of a short call first.";
+const char* const additional_constraints_chttp2_weighted_write_scheduling =
+    "{}";
 const char* const description_disable_buffer_hint_on_high_memory_pressure =
     "Disable buffer hint flag parsing in the transport under high memory "
     "pressure.";
@@ -466,6 +954,10 @@ const char* const additional_constraints_event_engine_client = "{}";
 const char* const description_event_engine_dns =
     "If set, use EventEngine DNSResolver for client channel resolution";
 const char* const additional_constraints_event_engine_dns = "{}";
+const char* const description_event_engine_dns_cache =
+    "Share c-ares DNS results between the EventEngine DNS resolvers in the "
+    "process, coalescing identical queries and caching their results.";
+const char* const additional_constraints_event_engine_dns_cache = "{}";
 const char* const description_event_engine_dns_non_client_channel =
     "If set, use EventEngine DNSResolver in other places besides client "
     "channel.";
@@ -474,6 +966,21 @@ const char* const additional_constraints_event_engine_dns_non_client_channel =
 const char* const description_event_engine_listener =
     "Use EventEngine listeners instead of iomgr's grpc_tcp_server";
 const char* const additional_constraints_event_engine_listener = "{}";
+const char* const description_event_engine_lock_free_work_queue =
+    "Use a lock-free work queue (a Chase-Lev deque for the owning thread plus "
+    "a lock-free injection queue) for EventEngine thread pool workers instead "
+    "of a mutex-protected deque.";
+const char* const additional_constraints_event_engine_lock_free_work_queue =
+    "{}";
+const char* const description_event_engine_shard_local_run =
+    "With a sharded poller, run closures that are scheduled from a poller "
+    "shard thread on that shard instead of handing them to the shared thread "
+    "pool.";
+const char* const additional_constraints_event_engine_shard_local_run = "{}";
+const char* const description_event_engine_timer_wheel =
+    "Keep EventEngine timers in hierarchical timing wheels, with O(1) "
+    "insertion and cancellation, instead of sharded binary heaps.";
+const char* const additional_constraints_event_engine_timer_wheel = "{}";
 const char* const description_free_large_allocator =
     "If set, return all free bytes from a \042big\042 allocator";
 const char* const additional_constraints_free_large_allocator = "{}";
@@ -490,19 +997,40 @@ const char* const description_max_pings_wo_data_throttle =
     "GRPC_ARG_HTTP2_MAX_PINGS_WITHOUT_DATA limit has reached (instead of "
     "completely blocking).";
 const char* const additional_constraints_max_pings_wo_data_throttle = "{}";
+const char* const description_memory_pressure_scaled_buffers =
+    "Shrink endpoint read chunks and socket receive buffers smoothly as memory "
+    "pressure rises, along the same curve as the HTTP/2 flow control window.";
+const char* const additional_constraints_memory_pressure_scaled_buffers = "{}";
+const char* const description_memory_quota_per_cpu_cache =
+    "Cache small memory quota takes and returns per cpu, and settle them with "
+    "the quota's shared free byte counter in batches.";
+const char* const additional_constraints_memory_quota_per_cpu_cache = "{}";
 const char* const description_monitoring_experiment =
     "Placeholder experiment to prove/disprove our monitoring is working";
 const char* const additional_constraints_monitoring_experiment = "{}";
 const char* const description_multiping =
     "Allow more than one ping to be in flight at a time by default.";
 const char* const additional_constraints_multiping = "{}";
+const char* const description_party_coalesced_wakeups =
+    "Wake parties with a single fetch_or instead of a CAS loop, so that "
+    "concurrent wakers of a locked party never retry against each other.";
+const char* const additional_constraints_party_coalesced_wakeups = "{}";
 const char* const description_pick_first_new =
     "New pick_first impl with memory reduction.";
 const char* const additional_constraints_pick_first_new = "{}";
+const char* const description_pick_first_prefer_connected_family =
+    "pick_first tries the address family of its last successful connection "
+    "first when it reconnects, instead of the resolver's family order.";
+const char* const additional_constraints_pick_first_prefer_connected_family =
+    "{}";
 const char* const description_posix_ee_skip_grpc_init =
     "Prevent the PosixEventEngine from calling grpc_init & grpc_shutdown on "
     "creation and destruction.";
 const char* const additional_constraints_posix_ee_skip_grpc_init = "{}";
+const char* const description_posix_lean_client_socket_setup =
+    "Create posix client sockets non-blocking and close-on-exec, and set their "
+    "TCP_NODELAY and SO_REUSEADDR without reading them back.";
+const char* const additional_constraints_posix_lean_client_socket_setup = "{}";
 const char* const description_prioritize_finished_requests =
     "Prioritize flushing out finished requests over other in-flight requests "
     "during transport writes.";
@@ -522,8 +1050,24 @@ const char* const additional_constraints_promise_based_http2_server_transport =
 const char* const description_promise_based_inproc_transport =
     "Use promises for the in-process transport.";
 const char* const additional_constraints_promise_based_inproc_transport = "{}";
+const char* const description_reclaimer_cost_aware_selection =
+    "Choose which memory reclaimer to run by how much its allocator holds and "
+    "how long it has been idle, instead of strictly in posting order.";
+const char* const additional_constraints_reclaimer_cost_aware_selection = "{}";
 const char* const description_retry_in_callv3 = "Support retries with call-v3";
 const char* const additional_constraints_retry_in_callv3 = "{}";
+const char* const description_ring_hash_async_table_build =
+    "Build large ring_hash and maglev tables on the EventEngine, serving from "
+    "the previous table until the new one is ready.";
+const char* const additional_constraints_ring_hash_async_table_build = "{}";
+const char* const description_rls_lock_free_cache_reads =
+    "RLS pickers serve fresh cache entries from a snapshot taken when the "
+    "picker is created, instead of taking the policy lock on every pick.";
+const char* const additional_constraints_rls_lock_free_cache_reads = "{}";
+const char* const description_rls_refresh_ahead =
+    "RLS refreshes frequently picked cache entries before they go stale, so "
+    "that hot keys never wait on an RLS request.";
+const char* const additional_constraints_rls_refresh_ahead = "{}";
 const char* const description_rq_fast_reject =
     "Resource quota rejects requests immediately (before allocating the "
     "request structure) under very high memory pressure.";
@@ -532,9 +1076,28 @@ const char* const description_schedule_cancellation_over_write =
     "Allow cancellation op to be scheduled over a write";
 const char* const additional_constraints_schedule_cancellation_over_write =
     "{}";
+const char* const description_secure_handshake_executor =
+    "Run the steps of TLS and ALTS handshakes that follow reads from the peer "
+    "on a bounded executor that limits how many run at once, running steps of "
+    "handshakes already under way before ones that start a handshake.";
+const char* const additional_constraints_secure_handshake_executor = "{}";
 const char* const description_server_listener =
     "If set, the new server listener classes are used.";
 const char* const additional_constraints_server_listener = "{}";
+const char* const description_shared_ssl_client_context =
+    "Share TSI client handshaker factories, and so their SSL contexts, between "
+    "channels whose TLS options are identical, instead of re-parsing roots and "
+    "keys for each channel.";
+const char* const additional_constraints_shared_ssl_client_context = "{}";
+const char* const description_skip_incompressible_methods =
+    "Stop compressing outgoing messages of methods whose sampled messages do "
+    "not shrink enough to pay for the CPU, re-probing them periodically.";
+const char* const additional_constraints_skip_incompressible_methods = "{}";
+const char* const description_ssl_zero_copy_protector =
+    "Use a zero-copy grpc protector for SSL connections, which protects a "
+    "whole slice buffer at a time and moves as many records as the SSL BIO "
+    "holds into each output slice.";
+const char* const additional_constraints_ssl_zero_copy_protector = "{}";
 const char* const description_tcp_frame_size_tuning =
     "If set, enables TCP to use RPC size estimation made by higher layers. TCP "
     "would not indicate completion of a read operation until a specified "
@@ -544,13 +1107,36 @@ const char* const additional_constraints_tcp_frame_size_tuning = "{}";
 const char* const description_tcp_rcv_lowat =
     "Use SO_RCVLOWAT to avoid wakeups on the read path.";
 const char* const additional_constraints_tcp_rcv_lowat = "{}";
+const char* const description_tls_kernel_write_offload =
+    "Install the write keys of TLS 1.2 AES-GCM connections on the socket with "
+    "kernel TLS, so that writes are encrypted by the kernel instead of the SSL "
+    "frame protector.";
+const char* const additional_constraints_tls_kernel_write_offload = "{}";
 const char* const description_trace_record_callops =
     "Enables tracing of call batch initiation and completion.";
 const char* const additional_constraints_trace_record_callops = "{}";
+const char* const description_transport_message_size_check =
+    "Reject received messages longer than the channel's max receive message "
+    "length in the transport, as soon as their length prefix is read, instead "
+    "of after buffering them.";
+const char* const additional_constraints_transport_message_size_check = "{}";
 const char* const description_unconstrained_max_quota_buffer_size =
     "Discard the cap on the max free pool size for one memory allocator";
 const char* const additional_constraints_unconstrained_max_quota_buffer_size =
     "{}";
+const char* const description_work_serializer_batched_drain =
+    "Drain several queued work serializer callbacks per EventEngine closure, "
+    "instead of rescheduling once per callback.";
+const char* const additional_constraints_work_serializer_batched_drain = "{}";
+const char* const description_wrr_shared_endpoint_weights =
+    "Share WRR endpoint weights across the channels to the same target and "
+    "locality, so that each channel's weights are fed by the ORCA reports seen "
+    "by all of them.";
+const char* const additional_constraints_wrr_shared_endpoint_weights = "{}";
+const char* const description_wrr_skip_unchanged_weights =
+    "Keep the WRR picker's scheduler across weight updates that leave every "
+    "endpoint weight within 1% of the weights it was built from.";
+const char* const additional_constraints_wrr_skip_unchanged_weights = "{}";
 }  // namespace
 
 namespace grpc_core {
@@ -558,10 +1144,34 @@ namespace grpc_core {
 const ExperimentMetadata g_experiment_metadata[] = {
     {"backoff_cap_initial_at_max", description_backoff_cap_initial_at_max,
      additional_constraints_backoff_cap_initial_at_max, nullptr, 0, true, true},
+    {"call_deadline_wheel", description_call_deadline_wheel,
+     additional_constraints_call_deadline_wheel, nullptr, 0, false, true},
     {"call_tracer_in_transport", description_call_tracer_in_transport,
      additional_constraints_call_tracer_in_transport, nullptr, 0, true, true},
     {"callv3_client_auth_filter", description_callv3_client_auth_filter,
      additional_constraints_callv3_client_auth_filter, nullptr, 0, false, true},
+    {"chttp2_coalesce_control_frames",
+     description_chttp2_coalesce_control_frames,
+     additional_constraints_chttp2_coalesce_control_frames, nullptr, 0, false,
+     true},
+    {"chttp2_idle_compaction", description_chttp2_idle_compaction,
+     additional_constraints_chttp2_idle_compaction, nullptr, 0, false, true},
+    {"chttp2_keepalive_ticker", description_chttp2_keepalive_ticker,
+     additional_constraints_chttp2_keepalive_ticker, nullptr, 0, false, true},
+    {"chttp2_model_based_flow_control",
+     description_chttp2_model_based_flow_control,
+     additional_constraints_chttp2_model_based_flow_control, nullptr, 0, false,
+     true},
+    {"chttp2_offload_stream_callbacks",
+     description_chttp2_offload_stream_callbacks,
+     additional_constraints_chttp2_offload_stream_callbacks, nullptr, 0, false,
+     true},
+    {"chttp2_optimistic_connect", description_chttp2_optimistic_connect,
+     additional_constraints_chttp2_optimistic_connect, nullptr, 0, false, true},
+    {"chttp2_weighted_write_scheduling",
+     description_chttp2_weighted_write_scheduling,
+     additional_constraints_chttp2_weighted_write_scheduling, nullptr, 0, false,
+     true},
     {"disable_buffer_hint_on_high_memory_pressure",
      description_disable_buffer_hint_on_high_memory_pressure,
      additional_constraints_disable_buffer_hint_on_high_memory_pressure,
@@ -577,12 +1187,23 @@ const ExperimentMetadata g_experiment_metadata[] = {
      additional_constraints_event_engine_client, nullptr, 0, true, true},
     {"event_engine_dns", description_event_engine_dns,
      additional_constraints_event_engine_dns, nullptr, 0, true, false},
+    {"event_engine_dns_cache", description_event_engine_dns_cache,
+     additional_constraints_event_engine_dns_cache, nullptr, 0, false, true},
     {"event_engine_dns_non_client_channel",
      description_event_engine_dns_non_client_channel,
      additional_constraints_event_engine_dns_non_client_channel, nullptr, 0,
      false, false},
     {"event_engine_listener", description_event_engine_listener,
      additional_constraints_event_engine_listener, nullptr, 0, true, true},
+    {"event_engine_lock_free_work_queue",
+     description_event_engine_lock_free_work_queue,
+     additional_constraints_event_engine_lock_free_work_queue, nullptr, 0,
+     false, true},
+    {"event_engine_shard_local_run", description_event_engine_shard_local_run,
+     additional_constraints_event_engine_shard_local_run, nullptr, 0, false,
+     true},
+    {"event_engine_timer_wheel", description_event_engine_timer_wheel,
+     additional_constraints_event_engine_timer_wheel, nullptr, 0, false, true},
     {"free_large_allocator", description_free_large_allocator,
      additional_constraints_free_large_allocator, nullptr, 0, false, true},
     {"keep_alive_ping_timer_batch", description_keep_alive_ping_timer_batch,
@@ -592,14 +1213,31 @@ const ExperimentMetadata g_experiment_metadata[] = {
      additional_constraints_local_connector_secure, nullptr, 0, false, true},
     {"max_pings_wo_data_throttle", description_max_pings_wo_data_throttle,
      additional_constraints_max_pings_wo_data_throttle, nullptr, 0, true, true},
+    {"memory_pressure_scaled_buffers",
+     description_memory_pressure_scaled_buffers,
+     additional_constraints_memory_pressure_scaled_buffers, nullptr, 0, false,
+     true},
+    {"memory_quota_per_cpu_cache", description_memory_quota_per_cpu_cache,
+     additional_constraints_memory_quota_per_cpu_cache, nullptr, 0, false,
+     true},
     {"monitoring_experiment", description_monitoring_experiment,
      additional_constraints_monitoring_experiment, nullptr, 0, true, true},
     {"multiping", description_multiping, additional_constraints_multiping,
      nullptr, 0, false, true},
+    {"party_coalesced_wakeups", description_party_coalesced_wakeups,
+     additional_constraints_party_coalesced_wakeups, nullptr, 0, false, true},
     {"pick_first_new", description_pick_first_new,
      additional_constraints_pick_first_new, nullptr, 0, true, true},
+    {"pick_first_prefer_connected_family",
+     description_pick_first_prefer_connected_family,
+     additional_constraints_pick_first_prefer_connected_family, nullptr, 0,
+     false, true},
     {"posix_ee_skip_grpc_init", description_posix_ee_skip_grpc_init,
      additional_constraints_posix_ee_skip_grpc_init, nullptr, 0, false, true},
+    {"posix_lean_client_socket_setup",
+     description_posix_lean_client_socket_setup,
+     additional_constraints_posix_lean_client_socket_setup, nullptr, 0, false,
+     true},
     {"prioritize_finished_requests", description_prioritize_finished_requests,
      additional_constraints_prioritize_finished_requests, nullptr, 0, false,
      true},
@@ -615,26 +1253,60 @@ const ExperimentMetadata g_experiment_metadata[] = {
      description_promise_based_inproc_transport,
      additional_constraints_promise_based_inproc_transport, nullptr, 0, false,
      false},
+    {"reclaimer_cost_aware_selection",
+     description_reclaimer_cost_aware_selection,
+     additional_constraints_reclaimer_cost_aware_selection, nullptr, 0, false,
+     true},
     {"retry_in_callv3", description_retry_in_callv3,
      additional_constraints_retry_in_callv3, nullptr, 0, false, true},
+    {"ring_hash_async_table_build", description_ring_hash_async_table_build,
+     additional_constraints_ring_hash_async_table_build, nullptr, 0, false,
+     true},
+    {"rls_lock_free_cache_reads", description_rls_lock_free_cache_reads,
+     additional_constraints_rls_lock_free_cache_reads, nullptr, 0, false, true},
+    {"rls_refresh_ahead", description_rls_refresh_ahead,
+     additional_constraints_rls_refresh_ahead, nullptr, 0, false, true},
     {"rq_fast_reject", description_rq_fast_reject,
      additional_constraints_rq_fast_reject, nullptr, 0, false, true},
     {"schedule_cancellation_over_write",
      description_schedule_cancellation_over_write,
      additional_constraints_schedule_cancellation_over_write, nullptr, 0, false,
      true},
+    {"secure_handshake_executor", description_secure_handshake_executor,
+     additional_constraints_secure_handshake_executor, nullptr, 0, false, true},
     {"server_listener", description_server_listener,
      additional_constraints_server_listener, nullptr, 0, true, true},
+    {"shared_ssl_client_context", description_shared_ssl_client_context,
+     additional_constraints_shared_ssl_client_context, nullptr, 0, false, true},
+    {"skip_incompressible_methods", description_skip_incompressible_methods,
+     additional_constraints_skip_incompressible_methods, nullptr, 0, false,
+     true},
+    {"ssl_zero_copy_protector", description_ssl_zero_copy_protector,
+     additional_constraints_ssl_zero_copy_protector, nullptr, 0, false, true},
     {"tcp_frame_size_tuning", description_tcp_frame_size_tuning,
      additional_constraints_tcp_frame_size_tuning, nullptr, 0, false, true},
     {"tcp_rcv_lowat", description_tcp_rcv_lowat,
      additional_constraints_tcp_rcv_lowat, nullptr, 0, false, true},
+    {"tls_kernel_write_offload", description_tls_kernel_write_offload,
+     additional_constraints_tls_kernel_write_offload, nullptr, 0, false, true},
     {"trace_record_callops", description_trace_record_callops,
      additional_constraints_trace_record_callops, nullptr, 0, true, true},
+    {"transport_message_size_check", description_transport_message_size_check,
+     additional_constraints_transport_message_size_check, nullptr, 0, false,
+     true},
     {"unconstrained_max_quota_buffer_size",
      description_unconstrained_max_quota_buffer_size,
      additional_constraints_unconstrained_max_quota_buffer_size, nullptr, 0,
      false, true},
+    {"work_serializer_batched_drain", description_work_serializer_batched_drain,
+     additional_constraints_work_serializer_batched_drain, nullptr, 0, false,
+     true},
+    {"wrr_shared_endpoint_weights", description_wrr_shared_endpoint_weights,
+     additional_constraints_wrr_shared_endpoint_weights, nullptr, 0, false,
+     true},
+    {"wrr_skip_unchanged_weights", description_wrr_skip_unchanged_weights,
+     additional_constraints_wrr_skip_unchanged_weights, nullptr, 0, false,
+     true},
 };
 
 }  // namespace grpc_core
@@ -59,9 +59,17 @@ namespace grpc_core {
 #if defined(GRPC_CFSTREAM)
 #define GRPC_EXPERIMENT_IS_INCLUDED_BACKOFF_CAP_INITIAL_AT_MAX
 inline bool IsBackoffCapInitialAtMaxEnabled() { return true; }
+inline bool IsCallDeadlineWheelEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_CALL_TRACER_IN_TRANSPORT
 inline bool IsCallTracerInTransportEnabled() { return true; }
 inline bool IsCallv3ClientAuthFilterEnabled() { return false; }
+inline bool IsChttp2CoalesceControlFramesEnabled() { return false; }
+inline bool IsChttp2IdleCompactionEnabled() { return false; }
+inline bool IsChttp2KeepaliveTickerEnabled() { return false; }
+inline bool IsChttp2ModelBasedFlowControlEnabled() { return false; }
+inline bool IsChttp2OffloadStreamCallbacksEnabled() { return false; }
+inline bool IsChttp2OptimisticConnectEnabled() { return false; }
+inline bool IsChttp2WeightedWriteSchedulingEnabled() { return false; }
 inline bool IsDisableBufferHintOnHighMemoryPressureEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_APPLICATION_CALLBACKS
 inline bool IsEventEngineApplicationCallbacksEnabled() { return true; }
@@ -69,40 +77,70 @@ inline bool IsEventEngineApplicationCallbacksEnabled() { return true; }
 inline bool IsEventEngineCallbackCqEnabled() { return true; }
 inline bool IsEventEngineClientEnabled() { return false; }
 inline bool IsEventEngineDnsEnabled() { return false; }
+inline bool IsEventEngineDnsCacheEnabled() { return false; }
 inline bool IsEventEngineDnsNonClientChannelEnabled() { return false; }
 inline bool IsEventEngineListenerEnabled() { return false; }
+inline bool IsEventEngineLockFreeWorkQueueEnabled() { return false; }
+inline bool IsEventEngineShardLocalRunEnabled() { return false; }
+inline bool IsEventEngineTimerWheelEnabled() { return false; }
 inline bool IsFreeLargeAllocatorEnabled() { return false; }
 inline bool IsKeepAlivePingTimerBatchEnabled() { return false; }
 inline bool IsLocalConnectorSecureEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_MAX_PINGS_WO_DATA_THROTTLE
 inline bool IsMaxPingsWoDataThrottleEnabled() { return true; }
+inline bool IsMemoryPressureScaledBuffersEnabled() { return false; }
+inline bool IsMemoryQuotaPerCpuCacheEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_MONITORING_EXPERIMENT
 inline bool IsMonitoringExperimentEnabled() { return true; }
 inline bool IsMultipingEnabled() { return false; }
+inline bool IsPartyCoalescedWakeupsEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_PICK_FIRST_NEW
 inline bool IsPickFirstNewEnabled() { return true; }
+inline bool IsPickFirstPreferConnectedFamilyEnabled() { return false; }
 inline bool IsPosixEeSkipGrpcInitEnabled() { return false; }
+inline bool IsPosixLeanClientSocketSetupEnabled() { return false; }
 inline bool IsPrioritizeFinishedRequestsEnabled() { return false; }
 inline bool IsPromiseBasedHttp2ClientTransportEnabled() { return false; }
 inline bool IsPromiseBasedHttp2ServerTransportEnabled() { return false; }
 inline bool IsPromiseBasedInprocTransportEnabled() { return false; }
+inline bool IsReclaimerCostAwareSelectionEnabled() { return false; }
 inline bool IsRetryInCallv3Enabled() { return false; }
+inline bool IsRingHashAsyncTableBuildEnabled() { return false; }
+inline bool IsRlsLockFreeCacheReadsEnabled() { return false; }
+inline bool IsRlsRefreshAheadEnabled() { return false; }
 inline bool IsRqFastRejectEnabled() { return false; }
 inline bool IsScheduleCancellationOverWriteEnabled() { return false; }
+inline bool IsSecureHandshakeExecutorEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_SERVER_LISTENER
 inline bool IsServerListenerEnabled() { return true; }
+inline bool IsSharedSslClientContextEnabled() { return false; }
+inline bool IsSkipIncompressibleMethodsEnabled() { return false; }
+inline bool IsSslZeroCopyProtectorEnabled() { return false; }
 inline bool IsTcpFrameSizeTuningEnabled() { return false; }
 inline bool IsTcpRcvLowatEnabled() { return false; }
+inline bool IsTlsKernelWriteOffloadEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_TRACE_RECORD_CALLOPS
 inline bool IsTraceRecordCallopsEnabled() { return true; }
+inline bool IsTransportMessageSizeCheckEnabled() { return false; }
 inline bool IsUnconstrainedMaxQuotaBufferSizeEnabled() { return false; }
+inline bool IsWorkSerializerBatchedDrainEnabled() { return false; }
+inline bool IsWrrSharedEndpointWeightsEnabled() { return false; }
+inline bool IsWrrSkipUnchangedWeightsEnabled() { return false; }
 
 #elif defined(GPR_WINDOWS)
 #define GRPC_EXPERIMENT_IS_INCLUDED_BACKOFF_CAP_INITIAL_AT_MAX
 inline bool IsBackoffCapInitialAtMaxEnabled() { return true; }
+inline bool IsCallDeadlineWheelEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_CALL_TRACER_IN_TRANSPORT
 inline bool IsCallTracerInTransportEnabled() { return true; }
 inline bool IsCallv3ClientAuthFilterEnabled() { return false; }
+inline bool IsChttp2CoalesceControlFramesEnabled() { return false; }
+inline bool IsChttp2IdleCompactionEnabled() { return false; }
+inline bool IsChttp2KeepaliveTickerEnabled() { return false; }
+inline bool IsChttp2ModelBasedFlowControlEnabled() { return false; }
+inline bool IsChttp2OffloadStreamCallbacksEnabled() { return false; }
+inline bool IsChttp2OptimisticConnectEnabled() { return false; }
+inline bool IsChttp2WeightedWriteSchedulingEnabled() { return false; }
 inline bool IsDisableBufferHintOnHighMemoryPressureEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_APPLICATION_CALLBACKS
 inline bool IsEventEngineApplicationCallbacksEnabled() { return true; }
@@ -112,41 +150,71 @@ inline bool IsEventEngineCallbackCqEnabled() { return true; }
 inline bool IsEventEngineClientEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_DNS
 inline bool IsEventEngineDnsEnabled() { return true; }
+inline bool IsEventEngineDnsCacheEnabled() { return false; }
 inline bool IsEventEngineDnsNonClientChannelEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_LISTENER
 inline bool IsEventEngineListenerEnabled() { return true; }
+inline bool IsEventEngineLockFreeWorkQueueEnabled() { return false; }
+inline bool IsEventEngineShardLocalRunEnabled() { return false; }
+inline bool IsEventEngineTimerWheelEnabled() { return false; }
 inline bool IsFreeLargeAllocatorEnabled() { return false; }
 inline bool IsKeepAlivePingTimerBatchEnabled() { return false; }
 inline bool IsLocalConnectorSecureEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_MAX_PINGS_WO_DATA_THROTTLE
 inline bool IsMaxPingsWoDataThrottleEnabled() { return true; }
+inline bool IsMemoryPressureScaledBuffersEnabled() { return false; }
+inline bool IsMemoryQuotaPerCpuCacheEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_MONITORING_EXPERIMENT
 inline bool IsMonitoringExperimentEnabled() { return true; }
 inline bool IsMultipingEnabled() { return false; }
+inline bool IsPartyCoalescedWakeupsEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_PICK_FIRST_NEW
 inline bool IsPickFirstNewEnabled() { return true; }
+inline bool IsPickFirstPreferConnectedFamilyEnabled() { return false; }
 inline bool IsPosixEeSkipGrpcInitEnabled() { return false; }
+inline bool IsPosixLeanClientSocketSetupEnabled() { return false; }
 inline bool IsPrioritizeFinishedRequestsEnabled() { return false; }
 inline bool IsPromiseBasedHttp2ClientTransportEnabled() { return false; }
 inline bool IsPromiseBasedHttp2ServerTransportEnabled() { return false; }
 inline bool IsPromiseBasedInprocTransportEnabled() { return false; }
+inline bool IsReclaimerCostAwareSelectionEnabled() { return false; }
 inline bool IsRetryInCallv3Enabled() { return false; }
+inline bool IsRingHashAsyncTableBuildEnabled() { return false; }
+inline bool IsRlsLockFreeCacheReadsEnabled() { return false; }
+inline bool IsRlsRefreshAheadEnabled() { return false; }
 inline bool IsRqFastRejectEnabled() { return false; }
 inline bool IsScheduleCancellationOverWriteEnabled() { return false; }
+inline bool IsSecureHandshakeExecutorEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_SERVER_LISTENER
 inline bool IsServerListenerEnabled() { return true; }
+inline bool IsSharedSslClientContextEnabled() { return false; }
+inline bool IsSkipIncompressibleMethodsEnabled() { return false; }
+inline bool IsSslZeroCopyProtectorEnabled() { return false; }
 inline bool IsTcpFrameSizeTuningEnabled() { return false; }
 inline bool IsTcpRcvLowatEnabled() { return false; }
+inline bool IsTlsKernelWriteOffloadEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_TRACE_RECORD_CALLOPS
 inline bool IsTraceRecordCallopsEnabled() { return true; }
+inline bool IsTransportMessageSizeCheckEnabled() { return false; }
 inline bool IsUnconstrainedMaxQuotaBufferSizeEnabled() { return false; }
+inline bool IsWorkSerializerBatchedDrainEnabled() { return false; }
+inline bool IsWrrSharedEndpointWeightsEnabled() { return false; }
+inline bool IsWrrSkipUnchangedWeightsEnabled() { return false; }
 
 #else
 #define GRPC_EXPERIMENT_IS_INCLUDED_BACKOFF_CAP_INITIAL_AT_MAX
 inline bool IsBackoffCapInitialAtMaxEnabled() { return true; }
+inline bool IsCallDeadlineWheelEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_CALL_TRACER_IN_TRANSPORT
 inline bool IsCallTracerInTransportEnabled() { return true; }
 inline bool IsCallv3ClientAuthFilterEnabled() { return false; }
+inline bool IsChttp2CoalesceControlFramesEnabled() { return false; }
+inline bool IsChttp2IdleCompactionEnabled() { return false; }
+inline bool IsChttp2KeepaliveTickerEnabled() { return false; }
+inline bool IsChttp2ModelBasedFlowControlEnabled() { return false; }
+inline bool IsChttp2OffloadStreamCallbacksEnabled() { return false; }
+inline bool IsChttp2OptimisticConnectEnabled() { return false; }
+inline bool IsChttp2WeightedWriteSchedulingEnabled() { return false; }
 inline bool IsDisableBufferHintOnHighMemoryPressureEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_APPLICATION_CALLBACKS
 inline bool IsEventEngineApplicationCallbacksEnabled() { return true; }
@@ -156,74 +224,130 @@ inline bool IsEventEngineCallbackCqEnabled() { return true; }
 inline bool IsEventEngineClientEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_DNS
 inline bool IsEventEngineDnsEnabled() { return true; }
+inline bool IsEventEngineDnsCacheEnabled() { return false; }
 inline bool IsEventEngineDnsNonClientChannelEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_LISTENER
 inline bool IsEventEngineListenerEnabled() { return true; }
+inline bool IsEventEngineLockFreeWorkQueueEnabled() { return false; }
+inline bool IsEventEngineShardLocalRunEnabled() { return false; }
+inline bool IsEventEngineTimerWheelEnabled() { return false; }
 inline bool IsFreeLargeAllocatorEnabled() { return false; }
 inline bool IsKeepAlivePingTimerBatchEnabled() { return false; }
 inline bool IsLocalConnectorSecureEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_MAX_PINGS_WO_DATA_THROTTLE
 inline bool IsMaxPingsWoDataThrottleEnabled() { return true; }
+inline bool IsMemoryPressureScaledBuffersEnabled() { return false; }
+inline bool IsMemoryQuotaPerCpuCacheEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_MONITORING_EXPERIMENT
 inline bool IsMonitoringExperimentEnabled() { return true; }
 inline bool IsMultipingEnabled() { return false; }
+inline bool IsPartyCoalescedWakeupsEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_PICK_FIRST_NEW
 inline bool IsPickFirstNewEnabled() { return true; }
+inline bool IsPickFirstPreferConnectedFamilyEnabled() { return false; }
 inline bool IsPosixEeSkipGrpcInitEnabled() { return false; }
+inline bool IsPosixLeanClientSocketSetupEnabled() { return false; }
 inline bool IsPrioritizeFinishedRequestsEnabled() { return false; }
 inline bool IsPromiseBasedHttp2ClientTransportEnabled() { return false; }
 inline bool IsPromiseBasedHttp2ServerTransportEnabled() { return false; }
 inline bool IsPromiseBasedInprocTransportEnabled() { return false; }
+inline bool IsReclaimerCostAwareSelectionEnabled() { return false; }
 inline bool IsRetryInCallv3Enabled() { return false; }
+inline bool IsRingHashAsyncTableBuildEnabled() { return false; }
+inline bool IsRlsLockFreeCacheReadsEnabled() { return false; }
+inline bool IsRlsRefreshAheadEnabled() { return false; }
 inline bool IsRqFastRejectEnabled() { return false; }
 inline bool IsScheduleCancellationOverWriteEnabled() { return false; }
+inline bool IsSecureHandshakeExecutorEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_SERVER_LISTENER
 inline bool IsServerListenerEnabled() { return true; }
+inline bool IsSharedSslClientContextEnabled() { return false; }
+inline bool IsSkipIncompressibleMethodsEnabled() { return false; }
+inline bool IsSslZeroCopyProtectorEnabled() { return false; }
 inline bool IsTcpFrameSizeTuningEnabled() { return false; }
 inline bool IsTcpRcvLowatEnabled() { return false; }
+inline bool IsTlsKernelWriteOffloadEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_TRACE_RECORD_CALLOPS
 inline bool IsTraceRecordCallopsEnabled() { return true; }
+inline bool IsTransportMessageSizeCheckEnabled() { return false; }
 inline bool IsUnconstrainedMaxQuotaBufferSizeEnabled() { return false; }
+inline bool IsWorkSerializerBatchedDrainEnabled() { return false; }
+inline bool IsWrrSharedEndpointWeightsEnabled() { return false; }
+inline bool IsWrrSkipUnchangedWeightsEnabled() { return false; }
 #endif
 
 #else
 enum ExperimentIds {
   kExperimentIdBackoffCapInitialAtMax,
+  kExperimentIdCallDeadlineWheel,
   kExperimentIdCallTracerInTransport,
   kExperimentIdCallv3ClientAuthFilter,
+  kExperimentIdChttp2CoalesceControlFrames,
+  kExperimentIdChttp2IdleCompaction,
+  kExperimentIdChttp2KeepaliveTicker,
+  kExperimentIdChttp2ModelBasedFlowControl,
+  kExperimentIdChttp2OffloadStreamCallbacks,
+  kExperimentIdChttp2OptimisticConnect,
+  kExperimentIdChttp2WeightedWriteScheduling,
   kExperimentIdDisableBufferHintOnHighMemoryPressure,
   kExperimentIdEventEngineApplicationCallbacks,
   kExperimentIdEventEngineCallbackCq,
   kExperimentIdEventEngineClient,
   kExperimentIdEventEngineDns,
+  kExperimentIdEventEngineDnsCache,
   kExperimentIdEventEngineDnsNonClientChannel,
   kExperimentIdEventEngineListener,
+  kExperimentIdEventEngineLockFreeWorkQueue,
+  kExperimentIdEventEngineShardLocalRun,
+  kExperimentIdEventEngineTimerWheel,
   kExperimentIdFreeLargeAllocator,
   kExperimentIdKeepAlivePingTimerBatch,
   kExperimentIdLocalConnectorSecure,
   kExperimentIdMaxPingsWoDataThrottle,
+  kExperimentIdMemoryPressureScaledBuffers,
+  kExperimentIdMemoryQuotaPerCpuCache,
   kExperimentIdMonitoringExperiment,
   kExperimentIdMultiping,
+  kExperimentIdPartyCoalescedWakeups,
   kExperimentIdPickFirstNew,
+  kExperimentIdPickFirstPreferConnectedFamily,
   kExperimentIdPosixEeSkipGrpcInit,
+  kExperimentIdPosixLeanClientSocketSetup,
   kExperimentIdPrioritizeFinishedRequests,
   kExperimentIdPromiseBasedHttp2ClientTransport,
   kExperimentIdPromiseBasedHttp2ServerTransport,
   kExperimentIdPromiseBasedInprocTransport,
+  kExperimentIdReclaimerCostAwareSelection,
   kExperimentIdRetryInCallv3,
+  kExperimentIdRingHashAsyncTableBuild,
+  kExperimentIdRlsLockFreeCacheReads,
+  kExperimentIdRlsRefreshAhead,
   kExperimentIdRqFastReject,
   kExperimentIdScheduleCancellationOverWrite,
+  kExperimentIdSecureHandshakeExecutor,
   kExperimentIdServerListener,
+  kExperimentIdSharedSslClientContext,
+  kExperimentIdSkipIncompressibleMethods,
+  kExperimentIdSslZeroCopyProtector,
   kExperimentIdTcpFrameSizeTuning,
   kExperimentIdTcpRcvLowat,
+  kExperimentIdTlsKernelWriteOffload,
   kExperimentIdTraceRecordCallops,
+  kExperimentIdTransportMessageSizeCheck,
   kExperimentIdUnconstrainedMaxQuotaBufferSize,
+  kExperimentIdWorkSerializerBatchedDrain,
+  kExperimentIdWrrSharedEndpointWeights,
+  kExperimentIdWrrSkipUnchangedWeights,
   kNumExperiments
 };
 #define GRPC_EXPERIMENT_IS_INCLUDED_BACKOFF_CAP_INITIAL_AT_MAX
 inline bool IsBackoffCapInitialAtMaxEnabled() {
   return IsExperimentEnabled<kExperimentIdBackoffCapInitialAtMax>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_CALL_DEADLINE_WHEEL
+inline bool IsCallDeadlineWheelEnabled() {
+  return IsExperimentEnabled<kExperimentIdCallDeadlineWheel>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_CALL_TRACER_IN_TRANSPORT
 inline bool IsCallTracerInTransportEnabled() {
   return IsExperimentEnabled<kExperimentIdCallTracerInTransport>();
@@ -232,6 +356,34 @@ inline bool IsCallTracerInTransportEnabled() {
 inline bool IsCallv3ClientAuthFilterEnabled() {
   return IsExperimentEnabled<kExperimentIdCallv3ClientAuthFilter>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_CHTTP2_COALESCE_CONTROL_FRAMES
+inline bool IsChttp2CoalesceControlFramesEnabled() {
+  return IsExperimentEnabled<kExperimentIdChttp2CoalesceControlFrames>();
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_CHTTP2_IDLE_COMPACTION
+inline bool IsChttp2IdleCompactionEnabled() {
+  return IsExperimentEnabled<kExperimentIdChttp2IdleCompaction>();
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_CHTTP2_KEEPALIVE_TICKER
+inline bool IsChttp2KeepaliveTickerEnabled() {
+  return IsExperimentEnabled<kExperimentIdChttp2KeepaliveTicker>();
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_CHTTP2_MODEL_BASED_FLOW_CONTROL
+inline bool IsChttp2ModelBasedFlowControlEnabled() {
+  return IsExperimentEnabled<kExperimentIdChttp2ModelBasedFlowControl>();
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_CHTTP2_OFFLOAD_STREAM_CALLBACKS
+inline bool IsChttp2OffloadStreamCallbacksEnabled() {
+  return IsExperimentEnabled<kExperimentIdChttp2OffloadStreamCallbacks>();
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_CHTTP2_OPTIMISTIC_CONNECT
+inline bool IsChttp2OptimisticConnectEnabled() {
+  return IsExperimentEnabled<kExperimentIdChttp2OptimisticConnect>();
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_CHTTP2_WEIGHTED_WRITE_SCHEDULING
+inline bool IsChttp2WeightedWriteSchedulingEnabled() {
+  return IsExperimentEnabled<kExperimentIdChttp2WeightedWriteScheduling>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_DISABLE_BUFFER_HINT_ON_HIGH_MEMORY_PRESSURE
 inline bool IsDisableBufferHintOnHighMemoryPressureEnabled() {
   return IsExperimentEnabled<
@@ -253,6 +405,10 @@ inline bool IsEventEngineClientEnabled() {
 inline bool IsEventEngineDnsEnabled() {
   return IsExperimentEnabled<kExperimentIdEventEngineDns>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_DNS_CACHE
+inline bool IsEventEngineDnsCacheEnabled() {
+  return IsExperimentEnabled<kExperimentIdEventEngineDnsCache>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_DNS_NON_CLIENT_CHANNEL
 inline bool IsEventEngineDnsNonClientChannelEnabled() {
   return IsExperimentEnabled<kExperimentIdEventEngineDnsNonClientChannel>();
@@ -261,6 +417,18 @@ inline bool IsEventEngineDnsNonClientChannelEnabled() {
 inline bool IsEventEngineListenerEnabled() {
   return IsExperimentEnabled<kExperimentIdEventEngineListener>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_LOCK_FREE_WORK_QUEUE
+inline bool IsEventEngineLockFreeWorkQueueEnabled() {
+  return IsExperimentEnabled<kExperimentIdEventEngineLockFreeWorkQueue>();
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_SHARD_LOCAL_RUN
+inline bool IsEventEngineShardLocalRunEnabled() {
+  return IsExperimentEnabled<kExperimentIdEventEngineShardLocalRun>();
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_TIMER_WHEEL
+inline bool IsEventEngineTimerWheelEnabled() {
+  return IsExperimentEnabled<kExperimentIdEventEngineTimerWheel>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_FREE_LARGE_ALLOCATOR
 inline bool IsFreeLargeAllocatorEnabled() {
   return IsExperimentEnabled<kExperimentIdFreeLargeAllocator>();
@@ -277,6 +445,14 @@ inline bool IsLocalConnectorSecureEnabled() {
 inline bool IsMaxPingsWoDataThrottleEnabled() {
   return IsExperimentEnabled<kExperimentIdMaxPingsWoDataThrottle>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_MEMORY_PRESSURE_SCALED_BUFFERS
+inline bool IsMemoryPressureScaledBuffersEnabled() {
+  return IsExperimentEnabled<kExperimentIdMemoryPressureScaledBuffers>();
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_MEMORY_QUOTA_PER_CPU_CACHE
+inline bool IsMemoryQuotaPerCpuCacheEnabled() {
+  return IsExperimentEnabled<kExperimentIdMemoryQuotaPerCpuCache>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_MONITORING_EXPERIMENT
 inline bool IsMonitoringExperimentEnabled() {
   return IsExperimentEnabled<kExperimentIdMonitoringExperiment>();
@@ -285,14 +461,26 @@ inline bool IsMonitoringExperimentEnabled() {
 inline bool IsMultipingEnabled() {
   return IsExperimentEnabled<kExperimentIdMultiping>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_PARTY_COALESCED_WAKEUPS
+inline bool IsPartyCoalescedWakeupsEnabled() {
+  return IsExperimentEnabled<kExperimentIdPartyCoalescedWakeups>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_PICK_FIRST_NEW
 inline bool IsPickFirstNewEnabled() {
   return IsExperimentEnabled<kExperimentIdPickFirstNew>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_PICK_FIRST_PREFER_CONNECTED_FAMILY
+inline bool IsPickFirstPreferConnectedFamilyEnabled() {
+  return IsExperimentEnabled<kExperimentIdPickFirstPreferConnectedFamily>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_POSIX_EE_SKIP_GRPC_INIT
 inline bool IsPosixEeSkipGrpcInitEnabled() {
   return IsExperimentEnabled<kExperimentIdPosixEeSkipGrpcInit>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_POSIX_LEAN_CLIENT_SOCKET_SETUP
+inline bool IsPosixLeanClientSocketSetupEnabled() {
+  return IsExperimentEnabled<kExperimentIdPosixLeanClientSocketSetup>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_PRIORITIZE_FINISHED_REQUESTS
 inline bool IsPrioritizeFinishedRequestsEnabled() {
   return IsExperimentEnabled<kExperimentIdPrioritizeFinishedRequests>();
@@ -309,10 +497,26 @@ inline bool IsPromiseBasedHttp2ServerTransportEnabled() {
 inline bool IsPromiseBasedInprocTransportEnabled() {
   return IsExperimentEnabled<kExperimentIdPromiseBasedInprocTransport>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_RECLAIMER_COST_AWARE_SELECTION
+inline bool IsReclaimerCostAwareSelectionEnabled() {
+  return IsExperimentEnabled<kExperimentIdReclaimerCostAwareSelection>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_RETRY_IN_CALLV3
 inline bool IsRetryInCallv3Enabled() {
   return IsExperimentEnabled<kExperimentIdRetryInCallv3>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_RING_HASH_ASYNC_TABLE_BUILD
+inline bool IsRingHashAsyncTableBuildEnabled() {
+  return IsExperimentEnabled<kExperimentIdRingHashAsyncTableBuild>();
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_RLS_LOCK_FREE_CACHE_READS
+inline bool IsRlsLockFreeCacheReadsEnabled() {
+  return IsExperimentEnabled<kExperimentIdRlsLockFreeCacheReads>();
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_RLS_REFRESH_AHEAD
+inline bool IsRlsRefreshAheadEnabled() {
+  return IsExperimentEnabled<kExperimentIdRlsRefreshAhead>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_RQ_FAST_REJECT
 inline bool IsRqFastRejectEnabled() {
   return IsExperimentEnabled<kExperimentIdRqFastReject>();
@@ -321,10 +525,26 @@ inline bool IsRqFastRejectEnabled() {
 inline bool IsScheduleCancellationOverWriteEnabled() {
   return IsExperimentEnabled<kExperimentIdScheduleCancellationOverWrite>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_SECURE_HANDSHAKE_EXECUTOR
+inline bool IsSecureHandshakeExecutorEnabled() {
+  return IsExperimentEnabled<kExperimentIdSecureHandshakeExecutor>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_SERVER_LISTENER
 inline bool IsServerListenerEnabled() {
   return IsExperimentEnabled<kExperimentIdServerListener>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_SHARED_SSL_CLIENT_CONTEXT
+inline bool IsSharedSslClientContextEnabled() {
+  return IsExperimentEnabled<kExperimentIdSharedSslClientContext>();
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_SKIP_INCOMPRESSIBLE_METHODS
+inline bool IsSkipIncompressibleMethodsEnabled() {
+  return IsExperimentEnabled<kExperimentIdSkipIncompressibleMethods>();
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_SSL_ZERO_COPY_PROTECTOR
+inline bool IsSslZeroCopyProtectorEnabled() {
+  return IsExperimentEnabled<kExperimentIdSslZeroCopyProtector>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_TCP_FRAME_SIZE_TUNING
 inline bool IsTcpFrameSizeTuningEnabled() {
   return IsExperimentEnabled<kExperimentIdTcpFrameSizeTuning>();
@@ -333,14 +553,34 @@ inline bool IsTcpFrameSizeTuningEnabled() {
 inline bool IsTcpRcvLowatEnabled() {
   return IsExperimentEnabled<kExperimentIdTcpRcvLowat>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_TLS_KERNEL_WRITE_OFFLOAD
+inline bool IsTlsKernelWriteOffloadEnabled() {
+  return IsExperimentEnabled<kExperimentIdTlsKernelWriteOffload>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_TRACE_RECORD_CALLOPS
 inline bool IsTraceRecordCallopsEnabled() {
   return IsExperimentEnabled<kExperimentIdTraceRecordCallops>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_TRANSPORT_MESSAGE_SIZE_CHECK
+inline bool IsTransportMessageSizeCheckEnabled() {
+  return IsExperimentEnabled<kExperimentIdTransportMessageSizeCheck>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_UNCONSTRAINED_MAX_QUOTA_BUFFER_SIZE
 inline bool IsUnconstrainedMaxQuotaBufferSizeEnabled() {
   return IsExperimentEnabled<kExperimentIdUnconstrainedMaxQuotaBufferSize>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_WORK_SERIALIZER_BATCHED_DRAIN
+inline bool IsWorkSerializerBatchedDrainEnabled() {
+  return IsExperimentEnabled<kExperimentIdWorkSerializerBatchedDrain>();
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_WRR_SHARED_ENDPOINT_WEIGHTS
+inline bool IsWrrSharedEndpointWeightsEnabled() {
+  return IsExperimentEnabled<kExperimentIdWrrSharedEndpointWeights>();
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_WRR_SKIP_UNCHANGED_WEIGHTS
+inline bool IsWrrSkipUnchangedWeightsEnabled() {
+  return IsExperimentEnabled<kExperimentIdWrrSkipUnchangedWeights>();
+}
 
 extern const ExperimentMetadata g_experiment_metadata[kNumExperiments];
 
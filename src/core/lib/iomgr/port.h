@@ -63,6 +63,9 @@
 #if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 0, 0)
 #define GRPC_LINUX_ERRQUEUE 1
 #endif  // LINUX_VERSION_CODE >= KERNEL_VERSION(4, 0, 0)
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 13, 0)
+#define GRPC_LINUX_IO_URING 1
+#endif  // LINUX_VERSION_CODE >= KERNEL_VERSION(5, 13, 0)
 #endif  // LINUX_VERSION_CODE
 #if defined(LINUX_VERSION_CODE) && defined(__GLIBC_PREREQ)
 #if LINUX_VERSION_CODE >= KERNEL_VERSION(3, 9, 0) && __GLIBC_PREREQ(2, 18)
@@ -0,0 +1,262 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_PROMISE_DETAIL_SEQ_FUSION_H
+#define GRPC_SRC_CORE_LIB_PROMISE_DETAIL_SEQ_FUSION_H
+
+#include <grpc/support/port_platform.h>
+
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "src/core/lib/promise/detail/promise_factory.h"
+#include "src/core/lib/promise/detail/promise_like.h"
+#include "src/core/lib/promise/detail/seq_state.h"
+#include "src/core/lib/promise/poll.h"
+#include "src/core/util/debug_location.h"
+
+// Compile-time fusion of sequence steps.
+//
+// Each step of a SeqState costs a member of its nested union and a state of
+// its state machine, and a synchronous step additionally becomes a Curried
+// promise holding both the function and its argument. A step whose factory
+// simply computes a value - returning neither a promise nor a Poll - can
+// never suspend the sequence though, so it needs no state of its own: we fold
+// it into the step before it. Leading synchronous steps fold into the first
+// promise, later ones into the promise made by the preceding factory, so that
+// Seq(p, f, g, h, k) with synchronous f, h and k is run as a two state
+// SeqState<p+f, g+h+k>.
+//
+// Under escaping traits (TrySeq) a folded step passes a failure on in its own
+// result type instead of escaping the sequence directly. That conversion is
+// only lossless between absl::Status and absl::StatusOr, so only steps between
+// those types are folded there.
+
+namespace grpc_core {
+namespace promise_detail {
+
+// What factory F returns when handed Arg (void for no argument), using the
+// same argument-dropping rules as PromiseFactoryImpl.
+template <typename Arg, typename F, typename Ignored = void>
+struct FactoryResult {
+  using Type = std::invoke_result_t<F&>;
+};
+
+template <typename Arg, typename F>
+struct FactoryResult<
+    Arg, F,
+    std::enable_if_t<std::conjunction_v<std::negation<std::is_void<Arg>>,
+                                        std::is_invocable<F&, Arg>>>> {
+  using Type = std::invoke_result_t<F&, Arg>;
+};
+
+// True if F, given Arg, computes its value immediately instead of making a
+// promise.
+template <typename Arg, typename F>
+inline constexpr bool kIsImmediateFactory =
+    !IsVoidCallable<typename FactoryResult<Arg, F>::Type>::value &&
+    !PollTraits<typename FactoryResult<Arg, F>::Type>::is_poll();
+
+template <typename T>
+inline constexpr bool kIsAbslStatusType = false;
+template <>
+inline constexpr bool kIsAbslStatusType<absl::Status> = true;
+template <typename T>
+inline constexpr bool kIsAbslStatusType<absl::StatusOr<T>> = true;
+
+// The synchronous step F as a function from the result of the step before it
+// to its own (wrapped) result. A failed prior result is passed on without
+// calling F.
+template <template <typename> class Traits, typename Prior, typename F>
+class ImmediateStep {
+  using PriorTraits = Traits<Prior>;
+  using Factory = OncePromiseFactory<typename PriorTraits::UnwrappedType, F>;
+
+ public:
+  using Result =
+      typename Traits<typename Factory::Promise::Result>::WrappedType;
+
+  GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION explicit ImmediateStep(F f)
+      : factory_(std::move(f)) {}
+
+  GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION Result operator()(Prior prior) {
+    if (!PriorTraits::IsOk(prior)) {
+      return PriorTraits::template ReturnValue<Result>(std::move(prior));
+    }
+    auto promise = PriorTraits::CallFactory(&factory_, std::move(prior));
+    return Result(std::move(promise().value()));
+  }
+
+ private:
+  GPR_NO_UNIQUE_ADDRESS Factory factory_;
+};
+
+// Promise P with the step Step folded into it.
+template <typename P, typename Step>
+class ImmediateStepPromise {
+ public:
+  using Result = typename Step::Result;
+
+  GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION ImmediateStepPromise(P promise,
+                                                            Step step)
+      : promise_(std::move(promise)), step_(std::move(step)) {}
+
+  GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION Poll<Result> operator()() {
+    auto r = promise_();
+    if (auto* p = r.value_if_ready()) return step_(std::move(*p));
+    return Pending{};
+  }
+
+ private:
+  GPR_NO_UNIQUE_ADDRESS PromiseLike<P> promise_;
+  GPR_NO_UNIQUE_ADDRESS Step step_;
+};
+
+// Promise factory F (taking Arg) whose promises get the step Step folded in.
+template <typename Arg, typename F, typename Step>
+class ImmediateStepFactory {
+  using Factory = OncePromiseFactory<Arg, F>;
+  using Promise = ImmediateStepPromise<typename Factory::Promise, Step>;
+
+ public:
+  GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION ImmediateStepFactory(F f, Step step)
+      : factory_(std::move(f)), step_(std::move(step)) {}
+
+  // Takes exactly the arguments Factory::Make does: none if Arg is void.
+  template <typename... A, typename = decltype(std::declval<Factory&>().Make(
+                               std::declval<A>()...))>
+  GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION Promise operator()(A&&... arg) {
+    return Promise(factory_.Make(std::forward<A>(arg)...), std::move(step_));
+  }
+
+ private:
+  GPR_NO_UNIQUE_ADDRESS Factory factory_;
+  GPR_NO_UNIQUE_ADDRESS Step step_;
+};
+
+// What is left of a sequence once every step is folded into its first
+// promise.
+template <template <typename> class Traits, typename P>
+class FusedSeqPromise {
+ public:
+  using Result =
+      typename Traits<typename PromiseLike<P>::Result>::WrappedType;
+
+  GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION explicit FusedSeqPromise(P promise)
+      : promise_(std::move(promise)) {}
+
+  GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION Poll<Result> PollOnce() {
+    auto r = promise_();
+    if (auto* p = r.value_if_ready()) return Result(std::move(*p));
+    return Pending{};
+  }
+
+ private:
+  GPR_NO_UNIQUE_ADDRESS PromiseLike<P> promise_;
+};
+
+// Builds the state of a sequence of promise P and factories Fs... under
+// Traits, folding synchronous steps as described above. kEscapes says whether
+// Traits can end the sequence early on a failed result.
+template <template <typename> class Traits, bool kEscapes>
+class SeqFusion {
+ public:
+  template <typename P, typename... Fs>
+  GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION static auto Make(DebugLocation whence,
+                                                        P p, Fs... fs) {
+    return Fuse<void, typename PromiseLike<P>::Result>(
+        whence, std::move(p), std::tuple<>(), NoFactory(), std::move(fs)...);
+  }
+
+ private:
+  struct NoFactory {};
+
+  template <typename Prior, typename F>
+  static constexpr bool CanFuse() {
+    if constexpr (!kIsImmediateFactory<typename Traits<Prior>::UnwrappedType,
+                                       F>) {
+      return false;
+    } else if constexpr (!kEscapes) {
+      return true;
+    } else {
+      return kIsAbslStatusType<Prior> &&
+             kIsAbslStatusType<
+                 typename ImmediateStep<Traits, Prior, F>::Result>;
+    }
+  }
+
+  // The sequence so far is promise p, then the factories done..., then last
+  // (unless it is NoFactory), whose promise consumes a PriorOfLast and yields
+  // a Prior.
+  template <typename PriorOfLast, typename Prior, typename P,
+            typename... Done, typename Last>
+  GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION static auto Fuse(
+      DebugLocation whence, P p, std::tuple<Done...> done, Last last) {
+    if constexpr (std::is_same_v<Last, NoFactory>) {
+      return FusedSeqPromise<Traits, P>(std::move(p));
+    } else {
+      return std::apply(
+          [&](Done&... d) {
+            return SeqState<Traits, P, Done..., Last>(
+                std::move(p), std::move(d)..., std::move(last), whence);
+          },
+          done);
+    }
+  }
+
+  template <typename PriorOfLast, typename Prior, typename P,
+            typename... Done, typename Last, typename F, typename... Fs>
+  GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION static auto Fuse(
+      DebugLocation whence, P p, std::tuple<Done...> done, Last last, F f,
+      Fs... fs) {
+    if constexpr (CanFuse<Prior, F>()) {
+      using Step = ImmediateStep<Traits, Prior, F>;
+      if constexpr (std::is_same_v<Last, NoFactory>) {
+        return Fuse<PriorOfLast, typename Step::Result>(
+            whence, ImmediateStepPromise<P, Step>(std::move(p),
+                                                  Step(std::move(f))),
+            std::move(done), NoFactory(), std::move(fs)...);
+      } else {
+        using Fused =
+            ImmediateStepFactory<typename Traits<PriorOfLast>::UnwrappedType,
+                                 Last, Step>;
+        return Fuse<PriorOfLast, typename Step::Result>(
+            whence, std::move(p), std::move(done),
+            Fused(std::move(last), Step(std::move(f))), std::move(fs)...);
+      }
+    } else {
+      using Next =
+          typename OncePromiseFactory<typename Traits<Prior>::UnwrappedType,
+                                      F>::Promise;
+      if constexpr (std::is_same_v<Last, NoFactory>) {
+        return Fuse<Prior, typename Next::Result>(
+            whence, std::move(p), std::move(done), std::move(f),
+            std::move(fs)...);
+      } else {
+        return Fuse<Prior, typename Next::Result>(
+            whence, std::move(p),
+            std::tuple_cat(std::move(done), std::make_tuple(std::move(last))),
+            std::move(f), std::move(fs)...);
+      }
+    }
+  }
+};
+
+}  // namespace promise_detail
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_PROMISE_DETAIL_SEQ_FUSION_H
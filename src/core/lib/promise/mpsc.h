@@ -20,6 +20,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <iterator>
 #include <limits>
 #include <utility>
 #include <vector>
@@ -241,6 +242,30 @@ class MpscReceiver {
     };
   }
 
+  // Return a promise that will resolve to ValueOrFailure<std::vector<T>>.
+  // If receiving is closed, it will resolve to failure.
+  // Otherwise, resolves to between one and max_batch_size items, in the order
+  // they were sent - everything already received up to that limit - so that
+  // the caller can handle a burst in one poll.
+  auto NextBatch(size_t max_batch_size) {
+    ABSL_DCHECK_GT(max_batch_size, 0u);
+    return [this, max_batch_size]() -> Poll<ValueOrFailure<std::vector<T>>> {
+      if (buffer_it_ == buffer_.end()) {
+        auto p = center_->PollReceiveBatch(buffer_);
+        bool* r = p.value_if_ready();
+        if (r == nullptr) return Pending{};
+        if (!*r) return Failure{};
+        buffer_it_ = buffer_.begin();
+      }
+      const size_t n = std::min(
+          max_batch_size, static_cast<size_t>(buffer_.end() - buffer_it_));
+      std::vector<T> batch(std::make_move_iterator(buffer_it_),
+                           std::make_move_iterator(buffer_it_ + n));
+      buffer_it_ += n;
+      return ValueOrFailure<std::vector<T>>(std::move(batch));
+    };
+  }
+
  private:
   // Received items. We move out of here one by one, but don't resize the
   // vector. Instead, when we run out of items, we poll the center for more -
@@ -348,7 +348,7 @@ void Party::RunPartyAndUnref(uint64_t prev_state) {
         currently_polling_ = i;
         if (participant->PollParticipantPromise()) {
           participants_[i].store(nullptr, std::memory_order_relaxed);
-          const uint64_t allocated_bit = (1u << i << kAllocatedShift);
+          const uint64_t allocated_bit = (1ull << i << kAllocatedShift);
           keep_allocated_mask &= ~allocated_bit;
         }
       }
@@ -30,6 +30,7 @@
 #include "absl/strings/string_view.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/event_engine/event_engine_context.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/promise/activity.h"
 #include "src/core/lib/promise/context.h"
 #include "src/core/lib/promise/detail/promise_factory.h"
@@ -46,7 +47,7 @@ namespace party_detail {
 
 // Number of bits reserved for wakeups gives us the maximum number of
 // participants.
-static constexpr size_t kMaxParticipants = 16;
+static constexpr size_t kMaxParticipants = 20;
 
 }  // namespace party_detail
 
@@ -143,10 +144,10 @@ class Party : public Activity, private Wakeable {
   //
   // Each SpawnSerializer consumes one slot in the party's participant array for
   // the lifetime of the party - that is that a SpawnSerializer counts as one of
-  // the sixteen promises executing on a Party.
+  // the kMaxParticipants promises executing on a Party.
   //
-  // The promises spawned by SpawnSerializer *DO NOT* count towards the sixteen
-  // promise limit.
+  // The promises spawned by SpawnSerializer *DO NOT* count towards the
+  // kMaxParticipants promise limit.
   //
   // The size of this type matters, and so we leverage private inheritance to
   // minimize the number of pointers needed to be kept per instance.
@@ -411,37 +412,43 @@ class Party : public Activity, private Wakeable {
 
   // State bits:
   // The atomic state_ field is composed of the following:
-  //   - 24 bits for ref counts
+  //   - 23 bits for ref counts
   //     1 is owned by the party prior to Orphan()
   //     All others are owned by owning wakers
   //   - 1 bit to indicate whether the party is locked
   //     The first thread to set this owns the party until it is unlocked
   //     That thread will run the main loop until no further work needs to
   //     be done.
-  //   - 1 bit to indicate whether there are participants waiting to be
-  //   added
-  //   - 16 bits, one per participant, indicating which participants have
-  //   been
-  //     woken up and should be polled next time the main loop runs.
+  //   - 20 bits, one per participant, indicating which participant slots are
+  //     allocated.
+  //   - 20 bits, one per participant, indicating which participants have
+  //     been woken up and should be polled next time the main loop runs.
 
   // clang-format off
-  // Bits used to store 16 bits of wakeups
-  static constexpr uint64_t kWakeupMask    = 0x0000'0000'0000'ffff;
-  // Bits used to store 16 bits of allocated participant slots.
-  static constexpr uint64_t kAllocatedMask = 0x0000'0000'ffff'0000;
+  // Bits used to store 20 bits of wakeups
+  static constexpr uint64_t kWakeupMask    = 0x0000'0000'000f'ffff;
+  // Bits used to store 20 bits of allocated participant slots.
+  static constexpr uint64_t kAllocatedMask = 0x0000'00ff'fff0'0000;
   // Bit indicating locked or not
-  static constexpr uint64_t kLocked        = 0x0000'0008'0000'0000;
-  // Bits used to store 24 bits of ref counts
-  static constexpr uint64_t kRefMask       = 0xffff'ff00'0000'0000;
+  static constexpr uint64_t kLocked        = 0x0000'0100'0000'0000;
+  // Bits used to store 23 bits of ref counts
+  static constexpr uint64_t kRefMask       = 0xffff'fe00'0000'0000;
   // clang-format on
 
   // Shift to get from a participant mask to an allocated mask.
-  static constexpr size_t kAllocatedShift = 16;
+  static constexpr size_t kAllocatedShift = party_detail::kMaxParticipants;
   // How far to shift to get the refcount
-  static constexpr size_t kRefShift = 40;
+  static constexpr size_t kRefShift = 41;
   // One ref count
   static constexpr uint64_t kOneRef = 1ull << kRefShift;
 
+  static_assert(kWakeupMask == (1ull << party_detail::kMaxParticipants) - 1);
+  static_assert(kAllocatedMask == kWakeupMask << kAllocatedShift);
+  static_assert(kLocked == kAllocatedMask + (1ull << kAllocatedShift));
+  static_assert(kRefMask == ~(kLocked | kAllocatedMask | kWakeupMask));
+  static_assert(kOneRef == kLocked << 1);
+  static_assert(sizeof(WakeupMask) * 8 >= party_detail::kMaxParticipants);
+
   // Destroy any remaining participants.
   // Needs to have normal context setup before calling.
   void CancelRemainingParticipants();
@@ -470,6 +477,10 @@ class Party : public Activity, private Wakeable {
     GRPC_LATENT_SEE_INNER_SCOPE("Party::WakeupFromState");
     ABSL_DCHECK_NE(wakeup_mask & kWakeupMask, 0u)
         << "Wakeup mask must be non-zero: " << wakeup_mask;
+    if (IsPartyCoalescedWakeupsEnabled()) {
+      CoalescedWakeup<kReffed>(wakeup_mask);
+      return;
+    }
     while (true) {
       if (cur_state & kLocked) {
         // If the party is locked, we need to set the wakeup bits, and then
@@ -503,6 +514,29 @@ class Party : public Activity, private Wakeable {
     }
   }
 
+  // Like WakeupFromState, but with a single unconditional fetch_or instead of
+  // a CAS loop, so that many threads waking the same party never retry
+  // against each other: every waker that finds the party locked just leaves
+  // its bits for the running thread to pick up, and the one waker that finds
+  // it unlocked becomes that thread.
+  template <bool kReffed>
+  GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION void CoalescedWakeup(
+      WakeupMask wakeup_mask) {
+    const uint64_t prev_state =
+        state_.fetch_or(wakeup_mask | kLocked, std::memory_order_acq_rel);
+    LogStateChange("CoalescedWakeup", prev_state,
+                   prev_state | wakeup_mask | kLocked);
+    if (prev_state & kLocked) {
+      if (kReffed) Unref();
+      return;
+    }
+    // We now hold the lock. Our wakeup bits are still in state_, so the run
+    // loop collects them on its first pass just as it would collect a
+    // wakeup that raced with it.
+    if (!kReffed) IncrementRefCount();
+    RunLockedAndUnref(this, prev_state);
+  }
+
   void WakeupAsync(WakeupMask wakeup_mask) final;
   void Drop(WakeupMask wakeup_mask) final;
 
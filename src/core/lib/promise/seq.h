@@ -22,7 +22,7 @@
 
 #include "src/core/lib/promise/detail/basic_seq.h"
 #include "src/core/lib/promise/detail/promise_like.h"
-#include "src/core/lib/promise/detail/seq_state.h"
+#include "src/core/lib/promise/detail/seq_fusion.h"
 #include "src/core/lib/promise/poll.h"
 #include "src/core/util/debug_location.h"
 
@@ -56,19 +56,23 @@ struct SeqTraits {
 
 template <typename P, typename... Fs>
 class Seq {
+  using Fusion = SeqFusion<SeqTraits, /*kEscapes=*/false>;
+
  public:
   GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION explicit Seq(P&& promise,
                                                     Fs&&... factories,
                                                     DebugLocation whence)
-      : state_(std::forward<P>(promise), std::forward<Fs>(factories)...,
-               whence) {}
+      : state_(Fusion::Make(whence, std::forward<P>(promise),
+                            std::forward<Fs>(factories)...)) {}
 
   GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION auto operator()() {
     return state_.PollOnce();
   }
 
  private:
-  SeqState<SeqTraits, P, Fs...> state_;
+  // Synchronous steps are folded into their neighbours: see seq_fusion.h.
+  decltype(Fusion::Make(std::declval<DebugLocation>(), std::declval<P>(),
+                        std::declval<Fs>()...)) state_;
 };
 
 template <typename Iter, typename Factory, typename Argument>
@@ -27,7 +27,7 @@
 #include "absl/status/statusor.h"
 #include "src/core/lib/promise/detail/basic_seq.h"
 #include "src/core/lib/promise/detail/promise_like.h"
-#include "src/core/lib/promise/detail/seq_state.h"
+#include "src/core/lib/promise/detail/seq_fusion.h"
 #include "src/core/lib/promise/detail/status.h"
 #include "src/core/lib/promise/poll.h"
 #include "src/core/lib/promise/status_flag.h"
@@ -252,19 +252,23 @@ using TrySeqTraits = TrySeqTraitsWithSfinae<T>;
 
 template <typename P, typename... Fs>
 class TrySeq {
+  using Fusion = SeqFusion<TrySeqTraits, /*kEscapes=*/true>;
+
  public:
   GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION explicit TrySeq(P&& promise,
                                                        Fs&&... factories,
                                                        DebugLocation whence)
-      : state_(std::forward<P>(promise), std::forward<Fs>(factories)...,
-               whence) {}
+      : state_(Fusion::Make(whence, std::forward<P>(promise),
+                            std::forward<Fs>(factories)...)) {}
 
   GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION auto operator()() {
     return state_.PollOnce();
   }
 
  private:
-  SeqState<TrySeqTraits, P, Fs...> state_;
+  // Synchronous steps are folded into their neighbours: see seq_fusion.h.
+  decltype(Fusion::Make(std::declval<DebugLocation>(), std::declval<P>(),
+                        std::declval<Fs>()...)) state_;
 };
 
 template <typename Iter, typename Factory, typename Argument>
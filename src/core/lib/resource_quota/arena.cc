@@ -21,12 +21,16 @@
 #include <grpc/support/alloc.h>
 #include <grpc/support/port_platform.h>
 
+#include <algorithm>
 #include <atomic>
 #include <new>
 
 #include "absl/log/absl_log.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
 #include "src/core/util/alloc.h"
+#include "src/core/util/no_destruct.h"
+#include "src/core/util/per_cpu.h"
+#include "src/core/util/sync.h"
 namespace grpc_core {
 
 namespace {
@@ -131,6 +135,146 @@ void Arena::ManagedNewObject::Link(std::atomic<ManagedNewObject*>* head) {
   }
 }
 
+namespace arena_detail {
+namespace {
+
+constexpr size_t kNumPoolSizeClasses = kMaxPooledSize / kPoolSizeClassStep;
+// Blocks of each size class a thread keeps before sharing with the depot.
+constexpr size_t kThreadCacheBlocks = 32;
+// Blocks moved between a thread and the depot at a time.
+constexpr size_t kTransferBlocks = kThreadCacheBlocks / 2;
+// Blocks of each size class a depot shard keeps before freeing them.
+constexpr size_t kDepotShardBlocks = 256;
+
+size_t SizeClass(size_t size) {
+  return (std::max<size_t>(size, 1) - 1) / kPoolSizeClassStep;
+}
+
+size_t SizeClassBytes(size_t size_class) {
+  return (size_class + 1) * kPoolSizeClassStep;
+}
+
+class FreeList {
+ public:
+  bool empty() const { return head_ == nullptr; }
+  size_t size() const { return size_; }
+
+  void Push(void* p) {
+    auto* block = static_cast<Block*>(p);
+    block->next = head_;
+    head_ = block;
+    ++size_;
+  }
+
+  void* Pop() {
+    Block* block = head_;
+    if (block == nullptr) return nullptr;
+    head_ = block->next;
+    --size_;
+    return block;
+  }
+
+  // Moves up to `n` blocks from this list onto `to`.
+  void MoveTo(FreeList& to, size_t n) {
+    while (n-- > 0 && !empty()) to.Push(Pop());
+  }
+
+  void Free(size_t size_class) {
+    while (void* p = Pop()) {
+      ::operator delete(p, SizeClassBytes(size_class));
+    }
+  }
+
+ private:
+  struct Block {
+    Block* next;
+  };
+  Block* head_ = nullptr;
+  size_t size_ = 0;
+};
+
+struct DepotShard {
+  Mutex mu;
+  FreeList lists[kNumPoolSizeClasses] ABSL_GUARDED_BY(mu);
+  // Mirrors lists[i].size(), so that empty lists can be skipped unlocked.
+  std::atomic<size_t> sizes[kNumPoolSizeClasses] = {};
+};
+
+PerCpu<DepotShard>& Depot() {
+  static NoDestruct<PerCpu<DepotShard>> depot(
+      PerCpuOptions().SetCpusPerShard(4).SetMaxShards(16));
+  return *depot;
+}
+
+class ThreadCache {
+ public:
+  ~ThreadCache() {
+    for (size_t i = 0; i < kNumPoolSizeClasses; ++i) {
+      while (!lists_[i].empty()) GiveToDepot(i);
+    }
+  }
+
+  void* Alloc(size_t size_class) {
+    FreeList& list = lists_[size_class];
+    if (list.empty()) {
+      DepotShard& shard = Depot().this_cpu();
+      if (shard.sizes[size_class].load(std::memory_order_relaxed) > 0) {
+        MutexLock lock(&shard.mu);
+        FreeList& depot = shard.lists[size_class];
+        depot.MoveTo(list, kTransferBlocks);
+        shard.sizes[size_class].store(depot.size(), std::memory_order_relaxed);
+      }
+    }
+    if (void* p = list.Pop()) return p;
+    return ::operator new(SizeClassBytes(size_class));
+  }
+
+  void Free(void* p, size_t size_class) {
+    FreeList& list = lists_[size_class];
+    list.Push(p);
+    if (list.size() > kThreadCacheBlocks) GiveToDepot(size_class);
+  }
+
+ private:
+  void GiveToDepot(size_t size_class) {
+    FreeList& list = lists_[size_class];
+    size_t moved;
+    {
+      DepotShard& shard = Depot().this_cpu();
+      MutexLock lock(&shard.mu);
+      FreeList& depot = shard.lists[size_class];
+      moved = std::min(kTransferBlocks, kDepotShardBlocks - depot.size());
+      list.MoveTo(depot, moved);
+      shard.sizes[size_class].store(depot.size(), std::memory_order_relaxed);
+    }
+    // Whatever did not fit in the depot goes back to the global allocator.
+    FreeList excess;
+    list.MoveTo(excess, kTransferBlocks - moved);
+    excess.Free(size_class);
+  }
+
+  FreeList lists_[kNumPoolSizeClasses];
+};
+
+thread_local ThreadCache g_thread_cache;
+
+}  // namespace
+
+void* PooledAlloc(size_t size) {
+  if (size > kMaxPooledSize) return ::operator new(size);
+  return g_thread_cache.Alloc(SizeClass(size));
+}
+
+void PooledFree(void* p, size_t size) {
+  if (size > kMaxPooledSize) {
+    ::operator delete(p, size);
+    return;
+  }
+  g_thread_cache.Free(p, SizeClass(size));
+}
+
+}  // namespace arena_detail
+
 MemoryAllocator DefaultMemoryAllocatorForSimpleArenaAllocator() {
   return ResourceQuota::Default()->memory_quota()->CreateMemoryAllocator(
       "simple-arena-allocator");
@@ -33,6 +33,7 @@
 #include <cstddef>
 #include <iosfwd>
 #include <memory>
+#include <type_traits>
 #include <utility>
 
 #include "src/core/lib/promise/context.h"
@@ -116,6 +117,23 @@ struct UnrefDestroy {
   void operator()(const Arena* arena) const;
 };
 
+// Storage for Arena::MakePooled objects.
+// Blocks are handed out in size classes of kPoolSizeClassStep bytes, up to
+// kMaxPooledSize. Freed blocks are kept on a free list of the freeing thread
+// for reuse; a thread with more than it needs passes some on to a shared,
+// per-cpu depot, from which threads that run out are refilled. Larger sizes go
+// straight to the global allocator.
+inline constexpr size_t kPoolSizeClassStep = 64;
+inline constexpr size_t kMaxPooledSize = 1024;
+
+void* PooledAlloc(size_t size);
+// `size` must be the size passed to the PooledAlloc that returned `p`.
+void PooledFree(void* p, size_t size);
+
+// Types with extended alignment bypass the pools.
+template <typename T>
+inline constexpr bool kIsPoolable = alignof(T) <= alignof(std::max_align_t);
+
 }  // namespace arena_detail
 
 class ArenaFactory : public RefCounted<ArenaFactory> {
@@ -158,6 +176,17 @@ class Arena final : public RefCounted<Arena, NonPolymorphicRefCount,
     return total_used_.load(std::memory_order_relaxed);
   }
 
+  // Return the total amount of memory this arena has taken from the heap,
+  // including its initial zone.
+  size_t TotalAllocatedBytes() const {
+    return total_allocated_.load(std::memory_order_relaxed);
+  }
+
+  // Return true if this arena outgrew its initial zone.
+  bool HasOverflowed() const {
+    return last_zone_.load(std::memory_order_relaxed) != nullptr;
+  }
+
   // Allocate \a size bytes from the arena.
   void* Alloc(size_t size) {
     size = GPR_ROUND_UP_TO_ALIGNMENT_SIZE(size);
@@ -210,7 +239,7 @@ class Arena final : public RefCounted<Arena, NonPolymorphicRefCount,
       // by setting the arena to nullptr.
       // This is a transitional hack and should be removed once promise based
       // filter is removed.
-      if (delete_) delete p;
+      if (delete_) DeletePooled(p);
     }
 
     bool has_freelist() const { return delete_; }
@@ -252,12 +281,18 @@ class Arena final : public RefCounted<Arena, NonPolymorphicRefCount,
   //          arena size.
   template <typename T, typename... Args>
   static PoolPtr<T> MakePooled(Args&&... args) {
-    return PoolPtr<T>(new T(std::forward<Args>(args)...), PooledDeleter());
+    return PoolPtr<T>(NewPooled<T>(std::forward<Args>(args)...),
+                      PooledDeleter());
   }
 
   template <typename T>
   static PoolPtr<T> MakePooledForOverwrite() {
-    return PoolPtr<T>(new T, PooledDeleter());
+    if constexpr (arena_detail::kIsPoolable<T>) {
+      return PoolPtr<T>(new (arena_detail::PooledAlloc(sizeof(T))) T,
+                        PooledDeleter());
+    } else {
+      return PoolPtr<T>(new T, PooledDeleter());
+    }
   }
 
   // Make a unique_ptr to an array of T that is allocated from the arena.
@@ -277,13 +312,24 @@ class Arena final : public RefCounted<Arena, NonPolymorphicRefCount,
   // pointer, and expected to call it with the same type T as was passed to this
   // function (else the free list returned to the arena will be corrupted).
   template <typename T, typename... Args>
-  T* NewPooled(Args&&... args) {
-    return new T(std::forward<Args>(args)...);
+  static T* NewPooled(Args&&... args) {
+    if constexpr (arena_detail::kIsPoolable<T>) {
+      return new (arena_detail::PooledAlloc(sizeof(T)))
+          T(std::forward<Args>(args)...);
+    } else {
+      return new T(std::forward<Args>(args)...);
+    }
   }
 
   template <typename T>
-  void DeletePooled(T* p) {
-    delete p;
+  static void DeletePooled(T* p) {
+    if constexpr (arena_detail::kIsPoolable<T>) {
+      p->~T();
+      arena_detail::PooledFree(const_cast<std::remove_const_t<T>*>(p),
+                               sizeof(T));
+    } else {
+      delete p;
+    }
   }
 
   // Context accessors
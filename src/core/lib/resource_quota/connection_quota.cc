@@ -16,10 +16,13 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
 
 #include "absl/log/absl_check.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 
 namespace grpc_core {
 
@@ -32,11 +35,45 @@ void ConnectionQuota::SetMaxIncomingConnections(int max_incoming_connections) {
             max_incoming_connections, std::memory_order_release) == INT_MAX);
 }
 
+void ConnectionQuota::SetMaxIncomingConnectionRate(
+    int connections_per_second) {
+  // The rate can only be configured once.
+  ABSL_CHECK_GT(connections_per_second, 0);
+  MutexLock lock(&accept_rate_mu_);
+  accept_tokens_ = connections_per_second;
+  last_accept_refill_ = Timestamp::Now();
+  ABSL_CHECK_EQ(max_incoming_connection_rate_.exchange(
+                    connections_per_second, std::memory_order_release),
+                0);
+}
+
+bool ConnectionQuota::TryTakeAcceptToken() {
+  const int rate =
+      max_incoming_connection_rate_.load(std::memory_order_acquire);
+  if (rate == 0) return true;
+  MutexLock lock(&accept_rate_mu_);
+  const Timestamp now = Timestamp::Now();
+  const double refill = (now - last_accept_refill_).seconds() * rate;
+  accept_tokens_ = std::min<double>(rate, accept_tokens_ + refill);
+  last_accept_refill_ = now;
+  if (accept_tokens_ < 1) return false;
+  accept_tokens_ -= 1;
+  return true;
+}
+
 // Returns true if the incoming connection is allowed to be accepted on the
 // server.
 bool ConnectionQuota::AllowIncomingConnection(MemoryQuotaRefPtr mem_quota,
                                               absl::string_view /*peer*/) {
+  // Refuse before the handshake starts: under memory pressure the server
+  // would most likely drop the connection anyway, after paying for it.
   if (mem_quota->IsMemoryPressureHigh()) {
+    global_stats().IncrementRqConnectionsRejected();
+    return false;
+  }
+
+  if (!TryTakeAcceptToken()) {
+    global_stats().IncrementRqConnectionsRateLimited();
     return false;
   }
 
@@ -49,6 +86,7 @@ bool ConnectionQuota::AllowIncomingConnection(MemoryQuotaRefPtr mem_quota,
   do {
     if (curr_active_connections >=
         max_incoming_connections_.load(std::memory_order_relaxed)) {
+      global_stats().IncrementRqConnectionsRejected();
       return false;
     }
   } while (!active_incoming_connections_.compare_exchange_weak(
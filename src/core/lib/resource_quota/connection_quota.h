@@ -25,6 +25,7 @@
 #include "src/core/util/ref_counted.h"
 #include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/sync.h"
+#include "src/core/util/time.h"
 
 namespace grpc_core {
 
@@ -40,8 +41,14 @@ class ConnectionQuota : public RefCounted<ConnectionQuota> {
   // Set the maximum number of allowed incoming connections on the server.
   void SetMaxIncomingConnections(int max_incoming_connections);
 
+  // Set the maximum rate, in connections per second, at which incoming
+  // connections are accepted. Up to one second's worth of connections may be
+  // accepted in a burst.
+  void SetMaxIncomingConnectionRate(int connections_per_second);
+
   // Returns true if the incoming connection is allowed to be accepted on the
-  // server.
+  // server. Connections are refused under memory pressure, above the
+  // configured accept rate, or beyond the maximum number of connections.
   bool AllowIncomingConnection(MemoryQuotaRefPtr mem_quota,
                                absl::string_view peer);
 
@@ -53,8 +60,15 @@ class ConnectionQuota : public RefCounted<ConnectionQuota> {
   }
 
  private:
+  // Takes a token from the accept rate limiter, if one is configured.
+  bool TryTakeAcceptToken();
+
   std::atomic<int> active_incoming_connections_{0};
   std::atomic<int> max_incoming_connections_{std::numeric_limits<int>::max()};
+  std::atomic<int> max_incoming_connection_rate_{0};
+  Mutex accept_rate_mu_;
+  double accept_tokens_ ABSL_GUARDED_BY(accept_rate_mu_) = 0;
+  Timestamp last_accept_refill_ ABSL_GUARDED_BY(accept_rate_mu_);
 };
 
 using ConnectionQuotaRefPtr = RefCountedPtr<ConnectionQuota>;
@@ -167,6 +167,8 @@ struct ReclaimerQueue::State {
   Mutex reader_mu;
   MultiProducerSingleConsumerQueue queue;  // reader_mu must be held to pop
   Waker waker ABSL_GUARDED_BY(reader_mu);
+  // Reclaimers taken off the queue to be compared, oldest first.
+  std::vector<RefCountedPtr<Handle>> candidates ABSL_GUARDED_BY(reader_mu);
 
   ~State() {
     bool empty = false;
@@ -232,11 +234,47 @@ void ReclaimerQueue::Enqueue(RefCountedPtr<Handle> handle) {
 Poll<RefCountedPtr<ReclaimerQueue::Handle>> ReclaimerQueue::PollNext() {
   MutexLock lock(&state_->reader_mu);
   bool empty = false;
-  // Try to pull from the queue.
-  std::unique_ptr<QueuedNode> node(
-      static_cast<QueuedNode*>(state_->queue.PopAndCheckEnd(&empty)));
-  // If we get something, great.
-  if (node != nullptr) return std::move(node->reclaimer_handle);
+  if (IsReclaimerCostAwareSelectionEnabled()) {
+    // Gather what is queued, drop whatever was cancelled while waiting, and
+    // run the candidate that frees the most for the least disruption (the
+    // oldest one on ties, so reclaimers without costs stay FIFO).
+    auto& candidates = state_->candidates;
+    while (candidates.size() < kMaxCandidates) {
+      std::unique_ptr<QueuedNode> node(
+          static_cast<QueuedNode*>(state_->queue.PopAndCheckEnd(&empty)));
+      if (node == nullptr) break;
+      candidates.push_back(std::move(node->reclaimer_handle));
+    }
+    candidates.erase(
+        std::remove_if(candidates.begin(), candidates.end(),
+                       [](const RefCountedPtr<Handle>& handle) {
+                         return handle->sweep_.load(
+                                    std::memory_order_relaxed) == nullptr;
+                       }),
+        candidates.end());
+    if (!candidates.empty()) {
+      const Timestamp now = Timestamp::Now();
+      auto best = candidates.begin();
+      double best_score = -1;
+      for (auto it = candidates.begin(); it != candidates.end(); ++it) {
+        if ((*it)->cost_ == nullptr) continue;
+        const double score = (*it)->cost_().Score(now);
+        if (score > best_score) {
+          best = it;
+          best_score = score;
+        }
+      }
+      RefCountedPtr<Handle> handle = std::move(*best);
+      candidates.erase(best);
+      return handle;
+    }
+  } else {
+    // Try to pull from the queue.
+    std::unique_ptr<QueuedNode> node(
+        static_cast<QueuedNode*>(state_->queue.PopAndCheckEnd(&empty)));
+    // If we get something, great.
+    if (node != nullptr) return std::move(node->reclaimer_handle);
+  }
   if (!empty) {
     // If we don't, but the queue is probably not empty, schedule an immediate
     // repoll.
@@ -248,6 +286,18 @@ Poll<RefCountedPtr<ReclaimerQueue::Handle>> ReclaimerQueue::PollNext() {
   return Pending{};
 }
 
+//
+// ReclamationCost
+//
+
+double ReclamationCost::Score(Timestamp now) const {
+  // An allocator idle for a minute counts double one in use right now, and
+  // one idle for ten minutes eleven times as much.
+  const double idle_minutes =
+      std::max(0.0, (now - last_activity).seconds() / 60.0);
+  return static_cast<double>(bytes_held) * (1.0 + idle_minutes);
+}
+
 //
 // GrpcMemoryAllocatorImpl
 //
@@ -288,6 +338,11 @@ size_t GrpcMemoryAllocatorImpl::Reserve(MemoryRequest request) {
   // inlined asserts.
   ABSL_CHECK(request.min() <= request.max());
   ABSL_CHECK(request.max() <= MemoryRequest::max_allowed_size());
+  if (IsReclaimerCostAwareSelectionEnabled()) {
+    last_activity_ms_.store(
+        Timestamp::Now().milliseconds_after_process_epoch(),
+        std::memory_order_relaxed);
+  }
   size_t old_free = free_bytes_.load(std::memory_order_relaxed);
 
   while (true) {
@@ -493,11 +548,16 @@ void BasicMemoryQuota::Stop() { reclaimer_activity_.reset(); }
 
 void BasicMemoryQuota::SetSize(size_t new_size) {
   size_t old_size = quota_size_.exchange(new_size, std::memory_order_relaxed);
+  const size_t num_caches = cpu_caches_.end() - cpu_caches_.begin();
+  cpu_cache_limit_.store(
+      std::min(kMaxCpuCacheBytes, new_size / (16 * num_caches)),
+      std::memory_order_relaxed);
   if (old_size < new_size) {
     // We're growing the quota.
-    Return(new_size - old_size);
+    free_bytes_.fetch_add(new_size - old_size, std::memory_order_relaxed);
   } else {
-    // We're shrinking the quota.
+    // We're shrinking the quota: the caches may now hold more than allowed.
+    FlushCpuCaches();
     Take(/*allocator=*/nullptr, old_size - new_size);
   }
 }
@@ -506,11 +566,20 @@ void BasicMemoryQuota::Take(GrpcMemoryAllocatorImpl* allocator, size_t amount) {
   // If there's a request for nothing, then do nothing!
   if (amount == 0) return;
   ABSL_DCHECK(amount <= std::numeric_limits<intptr_t>::max());
-  // Grab memory from the quota.
-  auto prior = free_bytes_.fetch_sub(amount, std::memory_order_acq_rel);
-  // If we push into overcommit, awake the reclaimer.
-  if (prior >= 0 && prior < static_cast<intptr_t>(amount)) {
-    if (reclaimer_activity_ != nullptr) reclaimer_activity_->ForceWakeup();
+  // Quota resizes (allocator == nullptr) always go straight to free_bytes_.
+  if (allocator == nullptr || !IsMemoryQuotaPerCpuCacheEnabled() ||
+      !TakeFromCpuCache(amount)) {
+    // Grab memory from the quota.
+    auto prior = free_bytes_.fetch_sub(amount, std::memory_order_acq_rel);
+    // If we push into overcommit, awake the reclaimer - unless what the cpu
+    // caches were holding back covers it.
+    if (prior >= 0 && prior < static_cast<intptr_t>(amount)) {
+      FlushCpuCaches();
+      if (free_bytes_.load(std::memory_order_acquire) < 0 &&
+          reclaimer_activity_ != nullptr) {
+        reclaimer_activity_->ForceWakeup();
+      }
+    }
   }
 
   if (IsFreeLargeAllocatorEnabled()) {
@@ -551,9 +620,68 @@ void BasicMemoryQuota::FinishReclamation(uint64_t token, Waker waker) {
 }
 
 void BasicMemoryQuota::Return(size_t amount) {
+  if (IsMemoryQuotaPerCpuCacheEnabled()) {
+    amount = ReturnToCpuCache(amount);
+    if (amount == 0) return;
+  }
   free_bytes_.fetch_add(amount, std::memory_order_relaxed);
 }
 
+bool BasicMemoryQuota::TakeFromCpuCache(size_t amount) {
+  const size_t limit = cpu_cache_limit_.load(std::memory_order_relaxed);
+  if (amount > limit) return false;
+  CpuCache& cache = cpu_caches_.this_cpu();
+  size_t cached = cache.bytes.load(std::memory_order_relaxed);
+  while (cached >= amount) {
+    if (cache.bytes.compare_exchange_weak(cached, cached - amount,
+                                          std::memory_order_relaxed,
+                                          std::memory_order_relaxed)) {
+      return true;
+    }
+  }
+  // Refill with half the limit on top of this take. Only do so while the
+  // quota can spare it, so that close to the limit every take is seen by
+  // free_bytes_ (and so by the reclaimer) straight away.
+  const size_t refill = limit / 2;
+  const intptr_t batch = static_cast<intptr_t>(amount + refill);
+  intptr_t free = free_bytes_.load(std::memory_order_relaxed);
+  while (free >= batch) {
+    if (free_bytes_.compare_exchange_weak(free, free - batch,
+                                          std::memory_order_acq_rel,
+                                          std::memory_order_relaxed)) {
+      cache.bytes.fetch_add(refill, std::memory_order_relaxed);
+      return true;
+    }
+  }
+  return false;
+}
+
+size_t BasicMemoryQuota::ReturnToCpuCache(size_t amount) {
+  const size_t limit = cpu_cache_limit_.load(std::memory_order_relaxed);
+  if (amount > limit) return amount;
+  CpuCache& cache = cpu_caches_.this_cpu();
+  size_t cached =
+      cache.bytes.fetch_add(amount, std::memory_order_relaxed) + amount;
+  if (cached <= limit) return 0;
+  // Over the limit: keep half of it and hand the rest back in one go.
+  while (cached > limit / 2) {
+    if (cache.bytes.compare_exchange_weak(cached, limit / 2,
+                                          std::memory_order_relaxed,
+                                          std::memory_order_relaxed)) {
+      return cached - limit / 2;
+    }
+  }
+  return 0;
+}
+
+void BasicMemoryQuota::FlushCpuCaches() {
+  size_t flushed = 0;
+  for (CpuCache& cache : cpu_caches_) {
+    flushed += cache.bytes.exchange(0, std::memory_order_relaxed);
+  }
+  if (flushed != 0) free_bytes_.fetch_add(flushed, std::memory_order_acq_rel);
+}
+
 void BasicMemoryQuota::AddNewAllocator(GrpcMemoryAllocatorImpl* allocator) {
   GRPC_TRACE_LOG(resource_quota, INFO) << "Adding allocator " << allocator;
 
@@ -32,6 +32,7 @@
 
 #include "absl/base/thread_annotations.h"
 #include "absl/container/flat_hash_set.h"
+#include "absl/functional/any_invocable.h"
 #include "absl/log/absl_check.h"
 #include "absl/log/absl_log.h"
 #include "absl/strings/string_view.h"
@@ -41,6 +42,7 @@
 #include "src/core/lib/promise/poll.h"
 #include "src/core/lib/resource_quota/periodic_update.h"
 #include "src/core/util/orphanable.h"
+#include "src/core/util/per_cpu.h"
 #include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/sync.h"
 #include "src/core/util/time.h"
@@ -84,6 +86,17 @@ enum class ReclamationPass {
 };
 static constexpr size_t kNumReclamationPasses = 3;
 
+// What running a reclaimer would be worth: the memory held by the allocator
+// that posted it, and when that allocator was last used. Within a pass, the
+// reclaimer freeing the most memory for the least disruption runs first.
+struct ReclamationCost {
+  size_t bytes_held = 0;
+  Timestamp last_activity = Timestamp::InfPast();
+
+  // Bytes held, weighted up by how long the allocator has sat idle.
+  double Score(Timestamp now) const;
+};
+
 // For each reclamation function run we construct a ReclamationSweep.
 // When this object is finally destroyed (it may be moved several times first),
 // then that reclamation is complete and we may continue the reclamation loop.
@@ -128,12 +141,17 @@ class ReclaimerQueue {
   struct State;
 
  public:
+  // Reports the current cost of running a queued reclaimer.
+  using CostFn = absl::AnyInvocable<ReclamationCost() const>;
+
   class Handle : public InternallyRefCounted<Handle> {
    public:
     Handle() = default;
     template <typename F>
-    explicit Handle(F reclaimer, std::shared_ptr<State> state)
-        : sweep_(new SweepFn<F>(std::move(reclaimer), std::move(state))) {}
+    explicit Handle(F reclaimer, std::shared_ptr<State> state,
+                    CostFn cost = nullptr)
+        : sweep_(new SweepFn<F>(std::move(reclaimer), std::move(state))),
+          cost_(std::move(cost)) {}
     ~Handle() override {
       ABSL_DCHECK_EQ(sweep_.load(std::memory_order_relaxed), nullptr);
     }
@@ -178,6 +196,7 @@ class ReclaimerQueue {
     };
 
     std::atomic<Sweep*> sweep_{nullptr};
+    const CostFn cost_;
   };
 
   ReclaimerQueue();
@@ -192,9 +211,14 @@ class ReclaimerQueue {
   // then *index is set to the index of the newly queued entry.
   // Associates the reclamation function with an allocator, and keeps that
   // allocator alive, so that we can use the pointer as an ABA guard.
+  // `cost`, if given, is consulted under the reclaimer_cost_aware_selection
+  // experiment to pick the most worthwhile of the queued reclaimers; without
+  // it (or the experiment) reclaimers run in the order they were queued.
   template <typename F>
-  GRPC_MUST_USE_RESULT OrphanablePtr<Handle> Insert(F reclaimer) {
-    auto p = MakeOrphanable<Handle>(std::move(reclaimer), state_);
+  GRPC_MUST_USE_RESULT OrphanablePtr<Handle> Insert(F reclaimer,
+                                                    CostFn cost = nullptr) {
+    auto p = MakeOrphanable<Handle>(std::move(reclaimer), state_,
+                                    std::move(cost));
     Enqueue(p->Ref());
     return p;
   }
@@ -203,6 +227,9 @@ class ReclaimerQueue {
   // removed reclamation function if so.
   Poll<RefCountedPtr<Handle>> PollNext();
 
+  // At most this many queued reclaimers are compared at once.
+  static constexpr size_t kMaxCandidates = 64;
+
   // This callable is the promise backing Next - it resolves when there is an
   // entry available. This really just redirects to calling PollNext().
   class NextPromise {
@@ -348,7 +375,25 @@ class BasicMemoryQuota final
     std::array<Shard, 16> shards;
   };
 
+  // Bytes taken from free_bytes_ ahead of need, so that small Take() and
+  // Return() calls from many threads do not all contend on it.
+  struct alignas(GPR_CACHELINE_SIZE) CpuCache {
+    std::atomic<size_t> bytes{0};
+  };
+
   static constexpr intptr_t kInitialSize = std::numeric_limits<intptr_t>::max();
+  // Upper bound on cpu_cache_limit_.
+  static constexpr size_t kMaxCpuCacheBytes = 256 * 1024;
+
+  // Serves a Take() from this cpu's cache, refilling it from free_bytes_ in
+  // one batch if needed. Returns false if the caller should take from
+  // free_bytes_ directly.
+  bool TakeFromCpuCache(size_t amount);
+  // Adds a Return() to this cpu's cache. Returns what did not fit, which the
+  // caller should return to free_bytes_.
+  size_t ReturnToCpuCache(size_t amount);
+  // Moves everything cached back to free_bytes_.
+  void FlushCpuCaches();
 
   // Move allocator from big bucket to small bucket.
   void MaybeMoveAllocatorBigToSmall(GrpcMemoryAllocatorImpl* allocator);
@@ -361,6 +406,15 @@ class BasicMemoryQuota final
   std::atomic<intptr_t> free_bytes_{kInitialSize};
   // The total number of bytes in this quota.
   std::atomic<size_t> quota_size_{kInitialSize};
+  // Free bytes held back from free_bytes_, under the
+  // memory_quota_per_cpu_cache experiment. Each cache holds at most
+  // cpu_cache_limit_ bytes (apart from concurrent returns in flight), which
+  // keeps the total under a sixteenth of the quota: free_bytes_ and the
+  // pressure derived from it are off by no more than that, and always on the
+  // conservative side.
+  PerCpu<CpuCache> cpu_caches_{
+      PerCpuOptions().SetCpusPerShard(2).SetMaxShards(32)};
+  std::atomic<size_t> cpu_cache_limit_{kMaxCpuCacheBytes};
 
   // Reclaimer queues.
   ReclaimerQueue reclaimers_[kNumReclamationPasses];
@@ -469,8 +523,19 @@ class GrpcMemoryAllocatorImpl final : public EventEngineMemoryAllocatorImpl {
   template <typename F>
   void InsertReclaimer(size_t pass, F fn)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(reclaimer_mu_) {
-    reclamation_handles_[pass] =
-        memory_quota_->reclaimer_queue(pass)->Insert(std::move(fn));
+    reclamation_handles_[pass] = memory_quota_->reclaimer_queue(pass)->Insert(
+        std::move(fn), [self = weak_from_this()]() {
+          auto allocator = self.lock();
+          if (allocator == nullptr) return ReclamationCost{};
+          return static_cast<const GrpcMemoryAllocatorImpl*>(allocator.get())
+              ->GetReclamationCost();
+        });
+  }
+  ReclamationCost GetReclamationCost() const {
+    return ReclamationCost{
+        taken_bytes_.load(std::memory_order_relaxed),
+        Timestamp::FromMillisecondsAfterProcessEpoch(
+            last_activity_ms_.load(std::memory_order_relaxed))};
   }
 
   // Backing resource quota.
@@ -482,6 +547,9 @@ class GrpcMemoryAllocatorImpl final : public EventEngineMemoryAllocatorImpl {
   std::atomic<size_t> free_bytes_{0};
   // Amount of memory taken from the quota by this allocator.
   std::atomic<size_t> taken_bytes_{sizeof(GrpcMemoryAllocatorImpl)};
+  // When Reserve() was last called, in milliseconds after the process epoch.
+  // Only kept up to date under the reclaimer_cost_aware_selection experiment.
+  std::atomic<int64_t> last_activity_ms_{0};
   // Index used to randomly choose shard to return bytes from.
   std::atomic<size_t> chosen_shard_idx_{0};
   // We try to donate back some memory periodically to the central quota.
@@ -588,6 +656,22 @@ inline MemoryQuotaRefPtr MakeMemoryQuota(std::string name) {
 
 std::vector<std::shared_ptr<BasicMemoryQuota>> AllMemoryQuotas();
 
+// Buffers sized from memory pressure keep their full size up to this
+// pressure control value, then shrink linearly to their minimum at a value of
+// 1. Endpoint read chunks, socket receive buffers and HTTP/2 windows all
+// follow this curve, so they back off together.
+inline constexpr double kBufferShrinkStartPressure = 0.5;
+
+// Returns the size a buffer following that curve should have at `pressure`.
+inline double BufferSizeUnderMemoryPressure(double pressure, double min_size,
+                                            double max_size) {
+  if (pressure <= kBufferShrinkStartPressure) return max_size;
+  if (pressure >= 1.0) return min_size;
+  return max_size + (min_size - max_size) *
+                        (pressure - kBufferShrinkStartPressure) /
+                        (1.0 - kBufferShrinkStartPressure);
+}
+
 void SetContainerMemoryPressure(double pressure);
 
 double ContainerMemoryPressure();
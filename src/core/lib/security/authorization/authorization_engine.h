@@ -37,6 +37,11 @@ class AuthorizationEngine : public RefCounted<AuthorizationEngine> {
   };
 
   virtual Decision Evaluate(const EvaluateArgs& args) const = 0;
+
+  // Returns true if Evaluate() depends only on the path of the call and on
+  // the per-channel args, and has no side effects, so that its decision for
+  // a path may be reused for later calls on the same channel.
+  virtual bool DecisionDependsOnlyOnPath() const { return false; }
 };
 
 }  // namespace grpc_core
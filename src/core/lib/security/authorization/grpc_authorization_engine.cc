@@ -42,6 +42,21 @@ bool ShouldLog(const Decision& decision,
           condition == Rbac::AuditCondition::kOnDeny);
 }
 
+// Returns false if the rule matches on the call's headers, i.e. on anything
+// other than its path and the per-channel args.
+bool DependsOnlyOnPath(const Rbac::Permission& permission) {
+  if (permission.type == Rbac::Permission::RuleType::kHeader) return false;
+  return std::all_of(permission.permissions.begin(),
+                     permission.permissions.end(),
+                     [](const auto& p) { return DependsOnlyOnPath(*p); });
+}
+
+bool DependsOnlyOnPath(const Rbac::Principal& principal) {
+  if (principal.type == Rbac::Principal::RuleType::kHeader) return false;
+  return std::all_of(principal.principals.begin(), principal.principals.end(),
+                     [](const auto& p) { return DependsOnlyOnPath(*p); });
+}
+
 }  // namespace
 
 GrpcAuthorizationEngine::GrpcAuthorizationEngine(Rbac policy)
@@ -49,6 +64,10 @@ GrpcAuthorizationEngine::GrpcAuthorizationEngine(Rbac policy)
       action_(policy.action),
       audit_condition_(policy.audit_condition) {
   for (auto& sub_policy : policy.policies) {
+    if (!DependsOnlyOnPath(sub_policy.second.permissions) ||
+        !DependsOnlyOnPath(sub_policy.second.principals)) {
+      decision_depends_only_on_path_ = false;
+    }
     Policy policy;
     policy.name = sub_policy.first;
     policy.matcher = std::make_unique<PolicyAuthorizationMatcher>(
@@ -61,6 +80,11 @@ GrpcAuthorizationEngine::GrpcAuthorizationEngine(Rbac policy)
     ABSL_CHECK(logger != nullptr);
     audit_loggers_.push_back(std::move(logger));
   }
+  // Audit logging has to see every call.
+  if (audit_condition_ != Rbac::AuditCondition::kNone &&
+      !audit_loggers_.empty()) {
+    decision_depends_only_on_path_ = false;
+  }
 }
 
 GrpcAuthorizationEngine::GrpcAuthorizationEngine(
@@ -69,7 +93,8 @@ GrpcAuthorizationEngine::GrpcAuthorizationEngine(
       action_(other.action_),
       policies_(std::move(other.policies_)),
       audit_condition_(other.audit_condition_),
-      audit_loggers_(std::move(other.audit_loggers_)) {}
+      audit_loggers_(std::move(other.audit_loggers_)),
+      decision_depends_only_on_path_(other.decision_depends_only_on_path_) {}
 
 GrpcAuthorizationEngine& GrpcAuthorizationEngine::operator=(
     GrpcAuthorizationEngine&& other) noexcept {
@@ -78,6 +103,7 @@ GrpcAuthorizationEngine& GrpcAuthorizationEngine::operator=(
   policies_ = std::move(other.policies_);
   audit_condition_ = other.audit_condition_;
   audit_loggers_ = std::move(other.audit_loggers_);
+  decision_depends_only_on_path_ = other.decision_depends_only_on_path_;
   return *this;
 }
 
@@ -66,6 +66,10 @@ class GrpcAuthorizationEngine : public AuthorizationEngine {
   // whether allow/deny this request.
   Decision Evaluate(const EvaluateArgs& args) const override;
 
+  bool DecisionDependsOnlyOnPath() const override {
+    return decision_depends_only_on_path_;
+  }
+
  private:
   struct Policy {
     std::string name;
@@ -77,6 +81,7 @@ class GrpcAuthorizationEngine : public AuthorizationEngine {
   std::vector<Policy> policies_;
   Rbac::AuditCondition audit_condition_;
   std::vector<std::unique_ptr<AuditLogger>> audit_loggers_;
+  bool decision_depends_only_on_path_ = true;
 };
 
 }  // namespace grpc_core
@@ -65,6 +65,37 @@ bool GrpcServerAuthzFilter::IsAuthorized(ClientMetadata& initial_metadata) {
       << "], subject=" << args.GetSubject();
   grpc_authorization_policy_provider::AuthorizationEngines engines =
       provider_->engines();
+  const bool cacheable = (engines.deny_engine == nullptr ||
+                          engines.deny_engine->DecisionDependsOnlyOnPath()) &&
+                         (engines.allow_engine == nullptr ||
+                          engines.allow_engine->DecisionDependsOnlyOnPath());
+  if (!cacheable) return Evaluate(args, engines);
+  absl::string_view path = args.GetPath();
+  {
+    MutexLock lock(&mu_);
+    if (cached_allow_engine_ == engines.allow_engine &&
+        cached_deny_engine_ == engines.deny_engine) {
+      auto it = cached_decisions_.find(path);
+      if (it != cached_decisions_.end()) return it->second;
+    }
+  }
+  const bool authorized = Evaluate(args, engines);
+  MutexLock lock(&mu_);
+  if (cached_allow_engine_ != engines.allow_engine ||
+      cached_deny_engine_ != engines.deny_engine) {
+    cached_decisions_.clear();
+    cached_allow_engine_ = std::move(engines.allow_engine);
+    cached_deny_engine_ = std::move(engines.deny_engine);
+  }
+  if (cached_decisions_.size() < kMaxCachedDecisions) {
+    cached_decisions_.emplace(path, authorized);
+  }
+  return authorized;
+}
+
+bool GrpcServerAuthzFilter::Evaluate(
+    const EvaluateArgs& args,
+    const grpc_authorization_policy_provider::AuthorizationEngines& engines) {
   if (engines.deny_engine != nullptr) {
     AuthorizationEngine::Decision decision =
         engines.deny_engine->Evaluate(args);
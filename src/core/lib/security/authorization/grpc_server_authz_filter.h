@@ -18,16 +18,22 @@
 #include <grpc/grpc_security.h>
 #include <grpc/support/port_platform.h>
 
+#include <string>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/status/statusor.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channel_fwd.h"
 #include "src/core/lib/channel/promise_based_filter.h"
 #include "src/core/lib/promise/arena_promise.h"
+#include "src/core/lib/security/authorization/authorization_engine.h"
 #include "src/core/lib/security/authorization/authorization_policy_provider.h"
 #include "src/core/lib/security/authorization/evaluate_args.h"
 #include "src/core/lib/security/context/security_context.h"
 #include "src/core/lib/transport/transport.h"
 #include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/sync.h"
 
 namespace grpc_core {
 
@@ -58,11 +64,26 @@ class GrpcServerAuthzFilter final
   };
 
  private:
+  // The maximum number of paths whose decisions are cached per channel.
+  static constexpr size_t kMaxCachedDecisions = 64;
+
   bool IsAuthorized(ClientMetadata& initial_metadata);
+  bool Evaluate(
+      const EvaluateArgs& args,
+      const grpc_authorization_policy_provider::AuthorizationEngines& engines);
 
   RefCountedPtr<grpc_auth_context> auth_context_;
   EvaluateArgs::PerChannelArgs per_channel_evaluate_args_;
   RefCountedPtr<grpc_authorization_policy_provider> provider_;
+  // Decisions by path, for engines whose decisions depend only on the path,
+  // since everything else they match on is fixed for the channel.  The
+  // cache is for the engines below, and is cleared when the provider's
+  // engines change.
+  Mutex mu_;
+  RefCountedPtr<AuthorizationEngine> cached_allow_engine_ ABSL_GUARDED_BY(mu_);
+  RefCountedPtr<AuthorizationEngine> cached_deny_engine_ ABSL_GUARDED_BY(mu_);
+  absl::flat_hash_map<std::string, bool> cached_decisions_
+      ABSL_GUARDED_BY(mu_);
 };
 
 }  // namespace grpc_core
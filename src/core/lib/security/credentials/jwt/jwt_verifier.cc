@@ -32,6 +32,7 @@
 
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -45,11 +46,14 @@
 #include <grpc/support/string_util.h>
 #include <grpc/support/time.h>
 
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/log/absl_check.h"
 #include "absl/log/absl_log.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/escaping.h"
+#include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
 #include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/iomgr/error.h"
@@ -67,7 +71,10 @@
 #include "src/core/util/manual_constructor.h"
 #include "src/core/util/memory.h"
 #include "src/core/util/orphanable.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/string.h"
+#include "src/core/util/sync.h"
 #include "src/core/util/uri.h"
 
 using grpc_core::Json;
@@ -350,6 +357,114 @@ grpc_jwt_verifier_status grpc_jwt_claims_check(const grpc_jwt_claims* claims,
   return GRPC_JWT_VERIFIER_OK;
 }
 
+// --- Verification cache. ---
+
+namespace {
+
+// Verified tokens are re-verified after this long even if they expire later,
+// so that revoked keys eventually stop being honored.
+constexpr grpc_core::Duration kVerifiedTokenMaxAge =
+    grpc_core::Duration::Minutes(5);
+// How long fetched keys and OpenID configurations are used before being
+// fetched again.
+constexpr grpc_core::Duration kKeysMaxAge = grpc_core::Duration::Minutes(10);
+// The cache holds entries derived from untrusted tokens, so it needs a bound.
+constexpr size_t kMaxVerifiedTokens = 1024;
+constexpr size_t kMaxKeySets = 64;
+
+// Tokens verified recently and keys fetched recently, so that verifying a
+// hot token needs neither a signature check nor a network fetch.
+// Ref-counted, since pending verifications may outlive the verifier.
+class JwtVerifierCache : public grpc_core::RefCounted<JwtVerifierCache> {
+ public:
+  // Returns the claims of jwt if it was recently verified for audience.
+  std::optional<Json> FindVerifiedToken(absl::string_view jwt,
+                                        absl::string_view audience) {
+    grpc_core::MutexLock lock(&mu_);
+    return Find(tokens_, TokenKey(jwt, audience));
+  }
+  void AddVerifiedToken(absl::string_view jwt, absl::string_view audience,
+                        const grpc_jwt_claims* claims) {
+    const grpc_core::Timestamp expiration = std::min(
+        grpc_core::Timestamp::Now() + kVerifiedTokenMaxAge,
+        grpc_core::Timestamp::FromTimespecRoundDown(
+            grpc_jwt_claims_expires_at(claims)));
+    grpc_core::MutexLock lock(&mu_);
+    Add(tokens_, kMaxVerifiedTokens, TokenKey(jwt, audience),
+        *grpc_jwt_claims_json(claims), expiration);
+  }
+
+  // Returns the keys recently fetched from https://<url>.
+  std::optional<Json> FindKeys(absl::string_view url) {
+    grpc_core::MutexLock lock(&mu_);
+    return Find(keys_, url);
+  }
+  void AddKeys(absl::string_view url, const Json& keys) {
+    grpc_core::MutexLock lock(&mu_);
+    Add(keys_, kMaxKeySets, std::string(url), keys,
+        grpc_core::Timestamp::Now() + kKeysMaxAge);
+  }
+
+  // Returns the jwks_uri (without scheme) recently found in the OpenID
+  // configuration at https://<url>.
+  std::optional<std::string> FindJwksUri(absl::string_view url) {
+    grpc_core::MutexLock lock(&mu_);
+    return Find(jwks_uris_, url);
+  }
+  void AddJwksUri(absl::string_view url, absl::string_view jwks_uri) {
+    grpc_core::MutexLock lock(&mu_);
+    Add(jwks_uris_, kMaxKeySets, std::string(url), std::string(jwks_uri),
+        grpc_core::Timestamp::Now() + kKeysMaxAge);
+  }
+
+ private:
+  template <typename T>
+  struct Entry {
+    T value;
+    grpc_core::Timestamp expiration;
+  };
+  template <typename T>
+  using Map = absl::flat_hash_map<std::string, Entry<T>>;
+
+  // JWTs don't contain spaces, so this is unambiguous.
+  static std::string TokenKey(absl::string_view jwt,
+                              absl::string_view audience) {
+    return absl::StrCat(jwt, " ", audience);
+  }
+
+  template <typename T>
+  static std::optional<T> Find(Map<T>& map, absl::string_view key) {
+    auto it = map.find(key);
+    if (it == map.end()) return std::nullopt;
+    if (it->second.expiration < grpc_core::Timestamp::Now()) {
+      map.erase(it);
+      return std::nullopt;
+    }
+    return it->second.value;
+  }
+
+  template <typename T>
+  static void Add(Map<T>& map, size_t max_entries, std::string key, T value,
+                  grpc_core::Timestamp expiration) {
+    if (map.size() >= max_entries && !map.contains(key)) {
+      const grpc_core::Timestamp now = grpc_core::Timestamp::Now();
+      absl::erase_if(map, [now](const auto& entry) {
+        return entry.second.expiration < now;
+      });
+      if (map.size() >= max_entries) map.erase(map.begin());
+    }
+    map.insert_or_assign(std::move(key),
+                         Entry<T>{std::move(value), expiration});
+  }
+
+  grpc_core::Mutex mu_;
+  Map<Json> tokens_ ABSL_GUARDED_BY(mu_);
+  Map<Json> keys_ ABSL_GUARDED_BY(mu_);
+  Map<std::string> jwks_uris_ ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace
+
 // --- verifier_cb_ctx object. ---
 
 typedef enum {
@@ -370,6 +485,12 @@ struct verifier_cb_ctx {
   grpc_jwt_verification_done_cb user_cb;
   grpc_http_response responses[HTTP_RESPONSE_COUNT];
   grpc_core::OrphanablePtr<grpc_core::HttpRequest> http_request;
+  grpc_core::RefCountedPtr<JwtVerifierCache> cache;
+  std::string jwt;
+  // Where the OpenID configuration and keys are fetched from, without the
+  // https:// scheme.
+  std::string openid_config_url;
+  std::string keys_url;
 };
 // Takes ownership of the header, claims and signature.
 static verifier_cb_ctx* verifier_cb_ctx_create(
@@ -422,6 +543,7 @@ struct grpc_jwt_verifier {
   email_key_mapping* mappings;
   size_t num_mappings;  // Should be very few, linear search ok.
   size_t allocated_mappings;
+  JwtVerifierCache* cache;
 };
 
 static Json json_from_http(const grpc_http_response* response) {
@@ -679,20 +801,18 @@ end:
   return result;
 }
 
-static void on_keys_retrieved(void* user_data, grpc_error_handle /*error*/) {
-  verifier_cb_ctx* ctx = static_cast<verifier_cb_ctx*>(user_data);
-  Json json = json_from_http(&ctx->responses[HTTP_RESPONSE_KEYS]);
-  EVP_PKEY* verification_key = nullptr;
+// Verifies the token in ctx with keys, and completes ctx. If the keys came
+// from the cache and lack the token's key, returns false and leaves ctx
+// pending instead, so that the keys can be fetched again.
+static bool verify_with_keys(verifier_cb_ctx* ctx, const Json& keys,
+                             bool keys_from_cache) {
   grpc_jwt_verifier_status status = GRPC_JWT_VERIFIER_GENERIC_ERROR;
   grpc_jwt_claims* claims = nullptr;
-
-  if (json.type() == Json::Type::kNull) {
-    status = GRPC_JWT_VERIFIER_KEY_RETRIEVAL_ERROR;
-    goto end;
-  }
-  verification_key =
-      find_verification_key(json, ctx->header->alg, ctx->header->kid);
+  EVP_PKEY* verification_key =
+      find_verification_key(keys, ctx->header->alg, ctx->header->kid);
   if (verification_key == nullptr) {
+    // The issuer may have rotated its keys since they were cached.
+    if (keys_from_cache) return false;
     ABSL_LOG(ERROR) << "Could not find verification key with kid "
                << ctx->header->kid;
     status = GRPC_JWT_VERIFIER_KEY_RETRIEVAL_ERROR;
@@ -707,6 +827,7 @@ static void on_keys_retrieved(void* user_data, grpc_error_handle /*error*/) {
 
   status = grpc_jwt_claims_check(ctx->claims, ctx->audience);
   if (status == GRPC_JWT_VERIFIER_OK) {
+    ctx->cache->AddVerifiedToken(ctx->jwt, ctx->audience, ctx->claims);
     // Pass ownership.
     claims = ctx->claims;
     ctx->claims = nullptr;
@@ -716,6 +837,54 @@ end:
   EVP_PKEY_free(verification_key);
   ctx->user_cb(ctx->user_data, status, claims);
   verifier_cb_ctx_destroy(ctx);
+  return true;
+}
+
+static void on_keys_retrieved(void* user_data, grpc_error_handle /*error*/) {
+  verifier_cb_ctx* ctx = static_cast<verifier_cb_ctx*>(user_data);
+  Json json = json_from_http(&ctx->responses[HTTP_RESPONSE_KEYS]);
+  if (json.type() == Json::Type::kNull) {
+    ctx->user_cb(ctx->user_data, GRPC_JWT_VERIFIER_KEY_RETRIEVAL_ERROR,
+                 nullptr);
+    verifier_cb_ctx_destroy(ctx);
+    return;
+  }
+  ctx->cache->AddKeys(ctx->keys_url, json);
+  verify_with_keys(ctx, json, /*keys_from_cache=*/false);
+}
+
+// Verifies the token in ctx with the keys at ctx->keys_url, fetching them
+// unless they are cached.
+static void retrieve_keys_from_url_and_verify(verifier_cb_ctx* ctx) {
+  std::optional<Json> keys = ctx->cache->FindKeys(ctx->keys_url);
+  if (keys.has_value() &&
+      verify_with_keys(ctx, *keys, /*keys_from_cache=*/true)) {
+    return;
+  }
+  grpc_http_request req;
+  memset(&req, 0, sizeof(grpc_http_request));
+  const size_t slash = ctx->keys_url.find('/');
+  const std::string host = ctx->keys_url.substr(0, slash);
+  const std::string path =
+      slash == std::string::npos ? "" : ctx->keys_url.substr(slash);
+  // TODO(ctiller): Carry the resource_quota in ctx and share it with the host
+  // channel. This would allow us to cancel an authentication query when under
+  // extreme memory pressure.
+  absl::StatusOr<grpc_core::URI> uri = grpc_core::URI::Create(
+      "https", host, path, {} /* query params */, "" /* fragment */);
+  if (!uri.ok()) {
+    ctx->user_cb(ctx->user_data, GRPC_JWT_VERIFIER_KEY_RETRIEVAL_ERROR,
+                 nullptr);
+    verifier_cb_ctx_destroy(ctx);
+    return;
+  }
+  ctx->http_request = grpc_core::HttpRequest::Get(
+      std::move(*uri), nullptr /* channel args */, &ctx->pollent, &req,
+      grpc_core::Timestamp::Now() + grpc_jwt_verifier_max_delay,
+      GRPC_CLOSURE_CREATE(on_keys_retrieved, ctx, grpc_schedule_on_exec_ctx),
+      &ctx->responses[HTTP_RESPONSE_KEYS],
+      grpc_core::CreateHttpRequestSSLCredentials());
+  ctx->http_request->Start();
 }
 
 static void on_openid_config_retrieved(void* user_data,
@@ -723,15 +892,9 @@ static void on_openid_config_retrieved(void* user_data,
   verifier_cb_ctx* ctx = static_cast<verifier_cb_ctx*>(user_data);
   const grpc_http_response* response = &ctx->responses[HTTP_RESPONSE_OPENID];
   Json json = json_from_http(response);
-  grpc_http_request req;
-  memset(&req, 0, sizeof(grpc_http_request));
   const char* jwks_uri;
   const Json* cur;
-  absl::StatusOr<grpc_core::URI> uri;
-  char* host;
-  char* path;
 
-  // TODO(jboeuf): Cache the jwks_uri in order to avoid this hop next time.
   if (json.type() == Json::Type::kNull) goto error;
   cur = find_property_by_name(json, "jwks_uri");
   if (cur == nullptr) {
@@ -744,31 +907,10 @@ static void on_openid_config_retrieved(void* user_data,
     ABSL_LOG(ERROR) << "Invalid non https jwks_uri: " << jwks_uri;
     goto error;
   }
-  jwks_uri += 8;
-  host = gpr_strdup(jwks_uri);
-  path = const_cast<char*>(strchr(jwks_uri, '/'));
-  if (path == nullptr) {
-    path = const_cast<char*>("");
-  } else {
-    *(host + (path - jwks_uri)) = '\0';
-  }
-
-  // TODO(ctiller): Carry the resource_quota in ctx and share it with the host
-  // channel. This would allow us to cancel an authentication query when under
-  // extreme memory pressure.
-  uri = grpc_core::URI::Create("https", host, path, {} /* query params /*/,
-                               "" /* fragment */);
-  if (!uri.ok()) {
-    goto error;
-  }
-  ctx->http_request = grpc_core::HttpRequest::Get(
-      std::move(*uri), nullptr /* channel args */, &ctx->pollent, &req,
-      grpc_core::Timestamp::Now() + grpc_jwt_verifier_max_delay,
-      GRPC_CLOSURE_CREATE(on_keys_retrieved, ctx, grpc_schedule_on_exec_ctx),
-      &ctx->responses[HTTP_RESPONSE_KEYS],
-      grpc_core::CreateHttpRequestSSLCredentials());
-  ctx->http_request->Start();
-  gpr_free(host);
+  ctx->keys_url = jwks_uri + 8;
+  // Cache the jwks_uri in order to avoid this hop next time.
+  ctx->cache->AddJwksUri(ctx->openid_config_url, ctx->keys_url);
+  retrieve_keys_from_url_and_verify(ctx);
   return;
 
 error:
@@ -823,14 +965,13 @@ const char* grpc_jwt_issuer_email_domain(const char* issuer) {
 // Takes ownership of ctx.
 static void retrieve_key_and_verify(verifier_cb_ctx* ctx) {
   const char* email_domain;
-  grpc_closure* http_cb;
   char* path_prefix = nullptr;
   const char* iss;
   grpc_http_request req;
   memset(&req, 0, sizeof(grpc_http_request));
-  http_response_index rsp_idx;
   char* host;
   char* path;
+  std::optional<std::string> jwks_uri;
   absl::StatusOr<grpc_core::URI> uri;
 
   ABSL_CHECK(ctx != nullptr && ctx->header != nullptr && ctx->claims != nullptr);
@@ -866,21 +1007,29 @@ static void retrieve_key_and_verify(verifier_cb_ctx* ctx) {
       *(path_prefix++) = '\0';
       gpr_asprintf(&path, "/%s/%s", path_prefix, iss);
     }
-    http_cb =
-        GRPC_CLOSURE_CREATE(on_keys_retrieved, ctx, grpc_schedule_on_exec_ctx);
-    rsp_idx = HTTP_RESPONSE_KEYS;
+    ctx->keys_url = absl::StrCat(host, path);
+    gpr_free(host);
+    gpr_free(path);
+    retrieve_keys_from_url_and_verify(ctx);
+    return;
+  }
+
+  host = gpr_strdup(strstr(iss, "https://") == iss ? iss + 8 : iss);
+  path_prefix = strchr(host, '/');
+  if (path_prefix == nullptr) {
+    path = gpr_strdup(GRPC_OPENID_CONFIG_URL_SUFFIX);
   } else {
-    host = gpr_strdup(strstr(iss, "https://") == iss ? iss + 8 : iss);
-    path_prefix = strchr(host, '/');
-    if (path_prefix == nullptr) {
-      path = gpr_strdup(GRPC_OPENID_CONFIG_URL_SUFFIX);
-    } else {
-      *(path_prefix++) = 0;
-      gpr_asprintf(&path, "/%s%s", path_prefix, GRPC_OPENID_CONFIG_URL_SUFFIX);
-    }
-    http_cb = GRPC_CLOSURE_CREATE(on_openid_config_retrieved, ctx,
-                                  grpc_schedule_on_exec_ctx);
-    rsp_idx = HTTP_RESPONSE_OPENID;
+    *(path_prefix++) = 0;
+    gpr_asprintf(&path, "/%s%s", path_prefix, GRPC_OPENID_CONFIG_URL_SUFFIX);
+  }
+  ctx->openid_config_url = absl::StrCat(host, path);
+  jwks_uri = ctx->cache->FindJwksUri(ctx->openid_config_url);
+  if (jwks_uri.has_value()) {
+    gpr_free(host);
+    gpr_free(path);
+    ctx->keys_url = std::move(*jwks_uri);
+    retrieve_keys_from_url_and_verify(ctx);
+    return;
   }
 
   // TODO(ctiller): Carry the resource_quota in ctx and share it with the host
@@ -888,16 +1037,19 @@ static void retrieve_key_and_verify(verifier_cb_ctx* ctx) {
   // extreme memory pressure.
   uri = grpc_core::URI::Create("https", host, path, {} /* query params */,
                                "" /* fragment */);
+  gpr_free(host);
+  gpr_free(path);
   if (!uri.ok()) {
     goto error;
   }
   ctx->http_request = grpc_core::HttpRequest::Get(
       std::move(*uri), nullptr /* channel args */, &ctx->pollent, &req,
-      grpc_core::Timestamp::Now() + grpc_jwt_verifier_max_delay, http_cb,
-      &ctx->responses[rsp_idx], grpc_core::CreateHttpRequestSSLCredentials());
+      grpc_core::Timestamp::Now() + grpc_jwt_verifier_max_delay,
+      GRPC_CLOSURE_CREATE(on_openid_config_retrieved, ctx,
+                          grpc_schedule_on_exec_ctx),
+      &ctx->responses[HTTP_RESPONSE_OPENID],
+      grpc_core::CreateHttpRequestSSLCredentials());
   ctx->http_request->Start();
-  gpr_free(host);
-  gpr_free(path);
   return;
 
 error:
@@ -905,6 +1057,26 @@ error:
   verifier_cb_ctx_destroy(ctx);
 }
 
+// Completes the verification from the cache if jwt was recently verified for
+// audience. Returns false if it wasn't.
+static bool verify_from_cache(grpc_jwt_verifier* verifier, const char* jwt,
+                              const char* audience,
+                              grpc_jwt_verification_done_cb cb,
+                              void* user_data) {
+  std::optional<Json> json = verifier->cache->FindVerifiedToken(jwt, audience);
+  if (!json.has_value()) return false;
+  grpc_jwt_claims* claims = grpc_jwt_claims_from_json(std::move(*json));
+  if (claims == nullptr) return false;
+  // The time constraints may no longer hold.
+  grpc_jwt_verifier_status status = grpc_jwt_claims_check(claims, audience);
+  if (status != GRPC_JWT_VERIFIER_OK) {
+    grpc_jwt_claims_destroy(claims);
+    claims = nullptr;
+  }
+  cb(user_data, status, claims);
+  return true;
+}
+
 void grpc_jwt_verifier_verify(grpc_jwt_verifier* verifier,
                               grpc_pollset* pollset, const char* jwt,
                               const char* audience,
@@ -918,9 +1090,11 @@ void grpc_jwt_verifier_verify(grpc_jwt_verifier* verifier,
   const char* cur = jwt;
   Json json;
   std::string signature_str;
+  verifier_cb_ctx* ctx;
 
   ABSL_CHECK(verifier != nullptr && jwt != nullptr && audience != nullptr &&
         cb != nullptr);
+  if (verify_from_cache(verifier, jwt, audience, cb, user_data)) return;
   dot = strchr(cur, '.');
   if (dot == nullptr) goto error;
   json = parse_json_part_from_jwt(cur, static_cast<size_t>(dot - cur));
@@ -941,9 +1115,11 @@ void grpc_jwt_verifier_verify(grpc_jwt_verifier* verifier,
 
   if (!absl::WebSafeBase64Unescape(cur, &signature_str)) goto error;
   signature = grpc_slice_from_cpp_string(std::move(signature_str));
-  retrieve_key_and_verify(
-      verifier_cb_ctx_create(verifier, pollset, header, claims, audience,
-                             signature, jwt, signed_jwt_len, user_data, cb));
+  ctx = verifier_cb_ctx_create(verifier, pollset, header, claims, audience,
+                               signature, jwt, signed_jwt_len, user_data, cb);
+  ctx->cache = verifier->cache->Ref();
+  ctx->jwt = jwt;
+  retrieve_key_and_verify(ctx);
   return;
 
 error:
@@ -956,6 +1132,7 @@ grpc_jwt_verifier* grpc_jwt_verifier_create(
     const grpc_jwt_verifier_email_domain_key_url_mapping* mappings,
     size_t num_mappings) {
   grpc_jwt_verifier* v = grpc_core::Zalloc<grpc_jwt_verifier>();
+  v->cache = new JwtVerifierCache();
 
   // We know at least of one mapping.
   v->allocated_mappings = 1 + num_mappings;
@@ -984,5 +1161,6 @@ void grpc_jwt_verifier_destroy(grpc_jwt_verifier* v) {
     }
     gpr_free(v->mappings);
   }
+  v->cache->Unref();
   gpr_free(v);
 }
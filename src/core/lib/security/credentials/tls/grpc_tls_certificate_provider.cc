@@ -171,9 +171,20 @@ gpr_timespec TimeoutSecondsToDeadline(int64_t seconds) {
                       gpr_time_from_seconds(seconds, GPR_TIMESPAN));
 }
 
+// This helper function gets the last-modified time of |filename|. When failed,
+// it logs the error and returns 0.
+time_t GetModificationTime(const char* filename) {
+  time_t ts = 0;
+  (void)GetFileModificationTime(filename, &ts);
+  return ts;
+}
+
 }  // namespace
 
 static constexpr int64_t kMinimumFileWatcherRefreshIntervalSeconds = 1;
+// The files are read anyway once this many refreshes in a row were skipped,
+// in case one was replaced by a file with the same modification time.
+static constexpr int kMaxSkippedFileWatcherRefreshes = 9;
 
 FileWatcherCertificateProvider::FileWatcherCertificateProvider(
     std::string private_key_path, std::string identity_certificate_path,
@@ -206,7 +217,7 @@ FileWatcherCertificateProvider::FileWatcherCertificateProvider(
       if (value != nullptr) {
         return;
       };
-      provider->ForceUpdate();
+      provider->MaybeUpdate();
     }
   };
   refresh_thread_ = Thread("FileWatcherCertificateProvider_refreshing_thread",
@@ -284,15 +295,57 @@ absl::Status FileWatcherCertificateProvider::ValidateCredentials() const {
   return absl::OkStatus();
 }
 
+std::vector<time_t>
+FileWatcherCertificateProvider::GetWatchedFileModificationTimes() const {
+  std::vector<time_t> times;
+  for (const std::string* path :
+       {&root_cert_path_, &private_key_path_, &identity_certificate_path_}) {
+    if (!path->empty()) times.push_back(GetModificationTime(path->c_str()));
+  }
+  return times;
+}
+
+void FileWatcherCertificateProvider::MaybeUpdate() {
+  // A file last modified before it was read must have a later modification
+  // time if it was written to since. One modified in the second it was read
+  // could have been written again unnoticed, so it is read again.
+  if (!last_read_modification_times_.empty() &&
+      skipped_refreshes_ < kMaxSkippedFileWatcherRefreshes &&
+      GetWatchedFileModificationTimes() == last_read_modification_times_ &&
+      *std::max_element(last_read_modification_times_.begin(),
+                        last_read_modification_times_.end()) <
+          last_read_time_) {
+    ++skipped_refreshes_;
+    return;
+  }
+  ForceUpdate();
+}
+
 void FileWatcherCertificateProvider::ForceUpdate() {
+  skipped_refreshes_ = 0;
+  std::vector<time_t> modification_times = GetWatchedFileModificationTimes();
+  const time_t read_time = time(nullptr);
   std::optional<std::string> root_certificate;
   std::optional<PemKeyCertPairList> pem_key_cert_pairs;
+  bool all_read = true;
   if (!root_cert_path_.empty()) {
     root_certificate = ReadRootCertificatesFromFile(root_cert_path_);
+    all_read &= root_certificate.has_value();
   }
   if (!private_key_path_.empty()) {
     pem_key_cert_pairs = ReadIdentityKeyCertPairFromFiles(
         private_key_path_, identity_certificate_path_);
+    all_read &= pem_key_cert_pairs.has_value();
+  }
+  // Files that failed to read, or whose modification time is unknown, are
+  // read again on the next refresh.
+  if (all_read && std::find(modification_times.begin(),
+                            modification_times.end(),
+                            0) == modification_times.end()) {
+    last_read_modification_times_ = std::move(modification_times);
+    last_read_time_ = read_time;
+  } else {
+    last_read_modification_times_.clear();
   }
   MutexLock lock(&mu_);
   const bool root_cert_changed =
@@ -368,18 +421,6 @@ FileWatcherCertificateProvider::ReadRootCertificatesFromFile(
   return std::string(root_slice->as_string_view());
 }
 
-namespace {
-
-// This helper function gets the last-modified time of |filename|. When failed,
-// it logs the error and returns 0.
-time_t GetModificationTime(const char* filename) {
-  time_t ts = 0;
-  (void)GetFileModificationTime(filename, &ts);
-  return ts;
-}
-
-}  // namespace
-
 std::optional<PemKeyCertPairList>
 FileWatcherCertificateProvider::ReadIdentityKeyCertPairFromFiles(
     const std::string& private_key_path,
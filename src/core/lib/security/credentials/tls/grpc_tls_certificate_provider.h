@@ -21,10 +21,12 @@
 #include <grpc/support/port_platform.h>
 #include <grpc/support/sync.h>
 #include <stdint.h>
+#include <time.h>
 
 #include <map>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/log/absl_check.h"
@@ -165,6 +167,12 @@ class FileWatcherCertificateProvider final
 
   // Force an update from the file system regardless of the interval.
   void ForceUpdate();
+  // Calls ForceUpdate() unless the watched files can't have changed since
+  // they were last read.
+  void MaybeUpdate();
+  // The modification times of the watched files, 0 for any that can't be
+  // determined.
+  std::vector<time_t> GetWatchedFileModificationTimes() const;
   // Read the root certificates from files and update the distributor.
   std::optional<std::string> ReadRootCertificatesFromFile(
       const std::string& root_cert_full_path);
@@ -183,6 +191,12 @@ class FileWatcherCertificateProvider final
   RefCountedPtr<grpc_tls_certificate_distributor> distributor_;
   Thread refresh_thread_;
   gpr_event shutdown_event_;
+  // The modification times of the watched files when they were last all
+  // read successfully, and when that read started. Only used by
+  // ForceUpdate() and MaybeUpdate(), which never run concurrently.
+  std::vector<time_t> last_read_modification_times_;
+  time_t last_read_time_ = 0;
+  int skipped_refreshes_ = 0;
 
   // Guards members below.
   mutable Mutex mu_;
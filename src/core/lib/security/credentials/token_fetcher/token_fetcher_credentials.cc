@@ -18,6 +18,9 @@
 
 #include "src/core/lib/security/credentials/token_fetcher/token_fetcher_credentials.h"
 
+#include <algorithm>
+
+#include "src/core/config/config_vars.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/event_engine/default_event_engine.h"
 #include "src/core/lib/iomgr/pollset_set.h"
@@ -37,6 +40,10 @@ constexpr Duration kTokenExpirationAdjustmentDuration = Duration::Seconds(30);
 // token.  Also determines the timeout for the fetch request.
 constexpr Duration kTokenRefreshDuration = Duration::Seconds(60);
 
+// Jitter applied to the delay of background refreshes, so that processes
+// started together do not refresh together.
+constexpr double kTokenRefreshJitter = 0.1;
+
 }  // namespace
 
 //
@@ -172,6 +179,7 @@ void TokenFetcherCredentials::FetchState::TokenFetchComplete(
         << "[TokenFetcherCredentials " << creds_.get()
         << "]: fetch_state=" << this << ": token fetch succeeded";
     creds_->token_ = *token;
+    creds_->MaybeStartRefreshTimer();
     creds_->fetch_state_.reset();  // Orphan ourselves.
   } else {
     GRPC_TRACE_LOG(token_fetcher_credentials, INFO)
@@ -229,6 +237,8 @@ TokenFetcherCredentials::TokenFetcherCredentials(
               ? grpc_event_engine::experimental::GetDefaultEventEngine()
               : std::move(event_engine)),
       test_only_use_backoff_jitter_(test_only_use_backoff_jitter),
+      refresh_percent_(
+          std::clamp(ConfigVars::Get().TokenRefreshPercent(), 0, 100)),
       pollent_(grpc_polling_entity_create_from_pollset_set(
           grpc_pollset_set_create())) {}
 
@@ -238,15 +248,63 @@ TokenFetcherCredentials::~TokenFetcherCredentials() {
 
 void TokenFetcherCredentials::Orphaned() {
   MutexLock lock(&mu_);
+  if (refresh_timer_handle_.has_value()) {
+    event_engine_->Cancel(*refresh_timer_handle_);
+    refresh_timer_handle_.reset();
+  }
   fetch_state_.reset();
 }
 
+void TokenFetcherCredentials::MaybeStartRefreshTimer() {
+  if (refresh_percent_ == 0) return;
+  if (refresh_timer_handle_.has_value()) {
+    event_engine_->Cancel(*refresh_timer_handle_);
+    refresh_timer_handle_.reset();
+  }
+  // Tokens that do not outlive the refresh duration are refreshed by the
+  // next call anyway.
+  const Duration lifetime = token_->ExpirationTime() - Timestamp::Now();
+  if (lifetime == Duration::Infinity() || lifetime <= kTokenRefreshDuration) {
+    return;
+  }
+  const Duration delay = std::min(
+      lifetime * (refresh_percent_ / 100.0) *
+          absl::Uniform(bit_gen_, 1 - kTokenRefreshJitter,
+                        1 + kTokenRefreshJitter),
+      lifetime - kTokenRefreshDuration);
+  GRPC_TRACE_LOG(token_fetcher_credentials, INFO)
+      << "[TokenFetcherCredentials " << this
+      << "]: starting refresh timer for " << delay;
+  refresh_timer_handle_ = event_engine_->RunAfter(
+      delay, [self = WeakRefAsSubclass<TokenFetcherCredentials>()]() mutable {
+        ApplicationCallbackExecCtx callback_exec_ctx;
+        ExecCtx exec_ctx;
+        self->OnRefreshTimer();
+        self.reset();
+      });
+}
+
+void TokenFetcherCredentials::OnRefreshTimer() {
+  MutexLock lock(&mu_);
+  if (!refresh_timer_handle_.has_value()) return;
+  refresh_timer_handle_.reset();
+  // Calls keep using token_ until the new one arrives.
+  if (!used_since_refresh_ || fetch_state_ != nullptr) return;
+  used_since_refresh_ = false;
+  GRPC_TRACE_LOG(token_fetcher_credentials, INFO)
+      << "[TokenFetcherCredentials " << this
+      << "]: refresh timer fired; triggering new token fetch";
+  fetch_state_ = OrphanablePtr<FetchState>(
+      new FetchState(WeakRefAsSubclass<TokenFetcherCredentials>()));
+}
+
 ArenaPromise<absl::StatusOr<ClientMetadataHandle>>
 TokenFetcherCredentials::GetRequestMetadata(
     ClientMetadataHandle initial_metadata, const GetRequestMetadataArgs*) {
   RefCountedPtr<QueuedCall> queued_call;
   {
     MutexLock lock(&mu_);
+    used_since_refresh_ = true;
     // If we don't have a cached token or the token is within the
     // refresh duration, start a new fetch if there isn't a pending one.
     if ((token_ == nullptr || (token_->ExpirationTime() - Timestamp::Now()) <=
@@ -19,13 +19,17 @@
 
 #include <grpc/event_engine/event_engine.h>
 
+#include <stdint.h>
+
 #include <atomic>
 #include <memory>
+#include <optional>
 #include <utility>
 #include <variant>
 
 #include "absl/container/flat_hash_set.h"
 #include "absl/functional/any_invocable.h"
+#include "absl/random/random.h"
 #include "absl/status/statusor.h"
 #include "src/core/lib/iomgr/polling_entity.h"
 #include "src/core/lib/promise/arena_promise.h"
@@ -159,6 +163,11 @@ class TokenFetcherCredentials : public grpc_call_credentials {
     BackOff backoff_ ABSL_GUARDED_BY(&TokenFetcherCredentials::mu_);
   };
 
+  // If proactive refresh is enabled, starts a timer to refresh token_ in the
+  // background partway through its lifetime.
+  void MaybeStartRefreshTimer() ABSL_EXCLUSIVE_LOCKS_REQUIRED(&mu_);
+  void OnRefreshTimer();
+
   int cmp_impl(const grpc_call_credentials* other) const override {
     // TODO(yashykt): Check if we can do something better here
     return QsortCompare(static_cast<const grpc_call_credentials*>(this), other);
@@ -166,10 +175,20 @@ class TokenFetcherCredentials : public grpc_call_credentials {
 
   std::shared_ptr<grpc_event_engine::experimental::EventEngine> event_engine_;
   const bool test_only_use_backoff_jitter_;
+  // Percentage of a token's lifetime after which it is refreshed in the
+  // background, or 0 to refresh only when a call needs it.
+  const int32_t refresh_percent_;
 
   Mutex mu_;
   // Cached token, if any.
   RefCountedPtr<Token> token_ ABSL_GUARDED_BY(&mu_);
+  // Timer for the background refresh of token_, if any.
+  std::optional<grpc_event_engine::experimental::EventEngine::TaskHandle>
+      refresh_timer_handle_ ABSL_GUARDED_BY(&mu_);
+  // Whether a call has asked for a token since the last background refresh,
+  // so that idle credentials stop refreshing.
+  bool used_since_refresh_ ABSL_GUARDED_BY(&mu_) = false;
+  absl::BitGen bit_gen_ ABSL_GUARDED_BY(&mu_);
   // Fetch state, if any.
   OrphanablePtr<FetchState> fetch_state_ ABSL_GUARDED_BY(&mu_);
 
@@ -0,0 +1,72 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/slice/arena_slice.h"
+
+#include <grpc/slice.h>
+#include <grpc/support/port_platform.h>
+
+#include <cstdint>
+#include <utility>
+
+#include "src/core/lib/slice/slice_refcount.h"
+#include "src/core/util/ref_counted_ptr.h"
+
+namespace grpc_core {
+
+namespace {
+
+// Reference count for a slice allocated by MakeArenaSlice. Lives in the arena
+// just ahead of the slice bytes; the last unref releases the arena.
+class ArenaSliceRefcount final : public grpc_slice_refcount {
+ public:
+  explicit ArenaSliceRefcount(RefCountedPtr<Arena> arena)
+      : grpc_slice_refcount(Destroy), arena_(std::move(arena)) {}
+
+ private:
+  static void Destroy(grpc_slice_refcount* p) {
+    auto* rc = static_cast<ArenaSliceRefcount*>(p);
+    // The arena may go away with this ref, and the refcount with it.
+    RefCountedPtr<Arena> arena = std::move(rc->arena_);
+    rc->~ArenaSliceRefcount();
+  }
+
+  RefCountedPtr<Arena> arena_;
+};
+
+}  // namespace
+
+MutableSlice MakeArenaSlice(Arena* arena, size_t length) {
+  constexpr size_t kHeaderSize =
+      GPR_ROUND_UP_TO_ALIGNMENT_SIZE(sizeof(ArenaSliceRefcount));
+  void* p = arena->Alloc(kHeaderSize + length);
+  grpc_slice slice;
+  slice.refcount = new (p) ArenaSliceRefcount(arena->Ref());
+  slice.data.refcounted.bytes = static_cast<uint8_t*>(p) + kHeaderSize;
+  slice.data.refcounted.length = length;
+  return MutableSlice(slice);
+}
+
+bool MoveIntoArenaSlice(SliceBuffer& buffer, Arena* arena,
+                        size_t max_length) {
+  const size_t length = buffer.Length();
+  if (length == 0 || length > max_length) return false;
+  MutableSlice slice = MakeArenaSlice(arena, length);
+  buffer.CopyToBuffer(slice.data());
+  buffer.Clear();
+  buffer.Append(Slice(std::move(slice)));
+  return true;
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,45 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_SLICE_ARENA_SLICE_H
+#define GRPC_SRC_CORE_LIB_SLICE_ARENA_SLICE_H
+
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_buffer.h"
+
+namespace grpc_core {
+
+// Returns an uninitialized slice of `length` bytes carved out of `arena`.
+// The slice holds a ref to the arena, so it stays valid for as long as it is
+// held, even after the call is done. Its bytes are only given back when the
+// arena is destroyed, so this suits small payloads that live about as long
+// as the call.
+MutableSlice MakeArenaSlice(Arena* arena, size_t length);
+
+// If `buffer` is non-empty and holds at most `max_length` bytes, copies its
+// contents into a single arena slice and drops the slices it held.
+// Returns true if it did.
+//
+// Meant for received messages: a small payload then costs no allocation of
+// its own, readers that need contiguous bytes need not join it, and it no
+// longer pins the transport's read buffers.
+bool MoveIntoArenaSlice(SliceBuffer& buffer, Arena* arena, size_t max_length);
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_SLICE_ARENA_SLICE_H
@@ -20,12 +20,14 @@
 
 #include <grpc/support/port_platform.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <cstdint>
 #include <utility>
 
 #include "absl/log/absl_check.h"
 #include "src/core/util/bitset.h"
+#include "src/core/util/printable_ascii.h"
 
 namespace grpc_core {
 
@@ -73,6 +75,12 @@ const BitSet<256>& LookupTableForPercentEncodingType(PercentEncodingType type) {
 Slice PercentEncodeSlice(Slice slice, PercentEncodingType type) {
   static const uint8_t hex[] = "0123456789ABCDEF";
 
+  // grpc-message is usually plain text that needs no escaping at all.
+  if (type == PercentEncodingType::Compatible &&
+      IsPrintableAsciiWithout(slice.as_string_view(), '%')) {
+    return slice;
+  }
+
   const BitSet<256>& lut = LookupTableForPercentEncodingType(type);
 
   // first pass: count the number of bytes needed to output this string
@@ -117,14 +125,10 @@ static uint8_t DeHex(uint8_t c) {
 }
 
 Slice PermissivePercentDecodeSlice(Slice slice_in) {
-  bool any_percent_encoded_stuff = false;
-  for (uint8_t c : slice_in) {
-    if (c == '%') {
-      any_percent_encoded_stuff = true;
-      break;
-    }
+  if (slice_in.empty() ||
+      memchr(slice_in.data(), '%', slice_in.size()) == nullptr) {
+    return slice_in;
   }
-  if (!any_percent_encoded_stuff) return slice_in;
 
   MutableSlice out = slice_in.TakeMutable();
   uint8_t* q = out.begin();
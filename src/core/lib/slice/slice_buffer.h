@@ -166,7 +166,9 @@ class SliceBuffer {
     return copy;
   }
 
-  /// Add a small amount to the end of the slice buffer.
+  /// Add a small amount to the end of the slice buffer. \a n must be at most
+  /// GRPC_SLICE_INLINED_SIZE. The bytes go into the last slice if it is
+  /// inlined and has room, so consecutive small writes share one slice.
   uint8_t* AddTiny(size_t n) {
     return grpc_slice_buffer_tiny_add(&slice_buffer_, n);
   }
@@ -348,27 +348,43 @@ void Call::UpdateDeadline(Timestamp deadline) {
   auto* event_engine =
       arena_->GetContext<grpc_event_engine::experimental::EventEngine>();
   if (deadline_ != Timestamp::InfFuture()) {
-    if (!event_engine->Cancel(deadline_task_)) return;
+    if (!CancelDeadlineTimer()) return;
   } else {
     InternalRef("deadline");
   }
   deadline_ = deadline;
-  deadline_task_ = event_engine->RunAfter(deadline - Timestamp::Now(), this);
+  const Duration timeout = deadline - Timestamp::Now();
+  // Almost every deadline is cancelled when the call finishes on time, so
+  // the longer ones go on a wheel where that is just a list removal.
+  deadline_on_wheel_ = IsCallDeadlineWheelEnabled() &&
+                       timeout >= CallDeadlineWheel::kMinDelay;
+  if (deadline_on_wheel_) {
+    if (deadline_wheel_ == nullptr) {
+      deadline_wheel_ = CallDeadlineWheel::Get(event_engine);
+    }
+    deadline_wheel_->Schedule(&deadline_entry_, timeout,
+                              OnDeadlineWheelExpired, this);
+  } else {
+    deadline_task_ = event_engine->RunAfter(timeout, this);
+  }
 }
 
 void Call::ResetDeadline() {
   {
     MutexLock lock(&deadline_mu_);
     if (deadline_ == Timestamp::InfFuture()) return;
-    if (!arena_->GetContext<grpc_event_engine::experimental::EventEngine>()
-             ->Cancel(deadline_task_)) {
-      return;
-    }
+    if (!CancelDeadlineTimer()) return;
     deadline_ = Timestamp::InfFuture();
   }
   InternalUnref("deadline[reset]");
 }
 
+bool Call::CancelDeadlineTimer() {
+  if (deadline_on_wheel_) return deadline_wheel_->Cancel(&deadline_entry_);
+  return arena_->GetContext<grpc_event_engine::experimental::EventEngine>()
+      ->Cancel(deadline_task_);
+}
+
 void Call::Run() {
   ApplicationCallbackExecCtx callback_exec_ctx;
   ExecCtx exec_ctx;
@@ -42,6 +42,7 @@
 #include "src/core/lib/promise/context.h"
 #include "src/core/lib/resource_quota/arena.h"
 #include "src/core/lib/slice/slice.h"
+#include "src/core/lib/surface/call_deadline_wheel.h"
 #include "src/core/lib/surface/channel.h"
 #include "src/core/lib/transport/transport.h"
 #include "src/core/server/server_interface.h"
@@ -203,6 +204,14 @@ class Call : public CppImplOf<Call, grpc_call>,
       grpc_compression_algorithm algorithm) = 0;
 
  private:
+  static void OnDeadlineWheelExpired(void* arg) {
+    static_cast<Call*>(arg)->Run();
+  }
+
+  // Cancels the pending deadline timer; returns false if it already started
+  // running.
+  bool CancelDeadlineTimer() ABSL_EXCLUSIVE_LOCKS_REQUIRED(deadline_mu_);
+
   const RefCountedPtr<Arena> arena_;
   std::atomic<ParentCall*> parent_call_{nullptr};
   ChildCall* child_ = nullptr;
@@ -225,6 +234,12 @@ class Call : public CppImplOf<Call, grpc_call>,
   Timestamp deadline_ ABSL_GUARDED_BY(deadline_mu_) = Timestamp::InfFuture();
   grpc_event_engine::experimental::EventEngine::TaskHandle ABSL_GUARDED_BY(
       deadline_mu_) deadline_task_;
+  // Set when deadline_ is being tracked by deadline_wheel_ rather than by
+  // deadline_task_.
+  bool deadline_on_wheel_ ABSL_GUARDED_BY(deadline_mu_) = false;
+  RefCountedPtr<CallDeadlineWheel> deadline_wheel_
+      ABSL_GUARDED_BY(deadline_mu_);
+  CallDeadlineWheel::Entry deadline_entry_ ABSL_GUARDED_BY(deadline_mu_);
   gpr_cycle_counter start_time_ = gpr_get_cycle_counter();
 };
 
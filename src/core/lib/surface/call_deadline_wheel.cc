@@ -0,0 +1,173 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/surface/call_deadline_wheel.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/log/check.h"
+#include "src/core/util/no_destruct.h"
+#include "src/core/util/per_cpu.h"
+
+namespace grpc_core {
+
+using grpc_event_engine::experimental::EventEngine;
+
+struct CallDeadlineWheel::RegistryShard {
+  Mutex mu;
+  absl::flat_hash_map<EventEngine*, CallDeadlineWheel*> wheels
+      ABSL_GUARDED_BY(mu);
+};
+
+PerCpu<CallDeadlineWheel::RegistryShard>* CallDeadlineWheel::GetRegistry() {
+  static NoDestruct<PerCpu<RegistryShard>> registry(
+      PerCpuOptions().SetCpusPerShard(4).SetMaxShards(16));
+  return registry.get();
+}
+
+RefCountedPtr<CallDeadlineWheel> CallDeadlineWheel::Get(
+    EventEngine* event_engine) {
+  RegistryShard* shard = &GetRegistry()->this_cpu();
+  MutexLock lock(&shard->mu);
+  CallDeadlineWheel*& wheel = shard->wheels[event_engine];
+  // A wheel whose last ref is being dropped can't be revived; replace it.
+  // Its destructor only unregisters itself if it is still the one listed.
+  if (wheel != nullptr) {
+    auto ref = wheel->RefIfNonZero();
+    if (ref != nullptr) return ref;
+  }
+  auto fresh =
+      MakeRefCounted<CallDeadlineWheel>(event_engine->shared_from_this());
+  fresh->registry_shard_ = shard;
+  wheel = fresh.get();
+  return fresh;
+}
+
+CallDeadlineWheel::CallDeadlineWheel(
+    std::shared_ptr<EventEngine> event_engine)
+    : event_engine_(std::move(event_engine)),
+      processed_tick_(TickFor(Timestamp::Now(), /*round_up=*/false)) {}
+
+CallDeadlineWheel::~CallDeadlineWheel() {
+  if (registry_shard_ == nullptr) return;
+  MutexLock lock(&registry_shard_->mu);
+  auto it = registry_shard_->wheels.find(event_engine_.get());
+  if (it != registry_shard_->wheels.end() && it->second == this) {
+    registry_shard_->wheels.erase(it);
+  }
+}
+
+int64_t CallDeadlineWheel::TickFor(Timestamp timestamp, bool round_up) {
+  const int64_t millis = timestamp.milliseconds_after_process_epoch();
+  const int64_t tick_millis = kTick.millis();
+  return (millis + (round_up ? tick_millis - 1 : 0)) / tick_millis;
+}
+
+void CallDeadlineWheel::Schedule(Entry* entry, Duration delay,
+                                 void (*callback)(void* arg), void* arg) {
+  const int64_t tick = TickFor(Timestamp::Now() + delay, /*round_up=*/true);
+  MutexLock lock(&mu_);
+  CHECK_EQ(entry->callback_, nullptr);
+  entry->callback_ = callback;
+  entry->arg_ = arg;
+  // Slots up to processed_tick_ won't be looked at again until the wheel
+  // comes back around.
+  entry->tick_ = std::max(tick, processed_tick_ + 1);
+  Link(entry);
+  ++num_entries_;
+  MaybeStartTimer();
+}
+
+bool CallDeadlineWheel::Cancel(Entry* entry) {
+  MutexLock lock(&mu_);
+  if (entry->callback_ == nullptr) return false;
+  Unlink(entry);
+  entry->callback_ = nullptr;
+  --num_entries_;
+  MaybeStopTimer();
+  return true;
+}
+
+void CallDeadlineWheel::Link(Entry* entry) {
+  Entry*& head = slots_[entry->tick_ % kSlots];
+  entry->prev_ = nullptr;
+  entry->next_ = head;
+  if (head != nullptr) head->prev_ = entry;
+  head = entry;
+}
+
+void CallDeadlineWheel::Unlink(Entry* entry) {
+  if (entry->prev_ != nullptr) {
+    entry->prev_->next_ = entry->next_;
+  } else {
+    slots_[entry->tick_ % kSlots] = entry->next_;
+  }
+  if (entry->next_ != nullptr) entry->next_->prev_ = entry->prev_;
+  entry->prev_ = entry->next_ = nullptr;
+}
+
+void CallDeadlineWheel::MaybeStartTimer() {
+  if (timer_handle_ != EventEngine::TaskHandle::kInvalid ||
+      num_entries_ == 0) {
+    return;
+  }
+  timer_handle_ =
+      event_engine_->RunAfter(kTick, [self = Ref()]() { self->OnTick(); });
+}
+
+void CallDeadlineWheel::MaybeStopTimer() {
+  // Don't keep ticking (and holding a ref to the EventEngine) once the last
+  // call with a deadline is done.
+  if (num_entries_ == 0 &&
+      timer_handle_ != EventEngine::TaskHandle::kInvalid &&
+      event_engine_->Cancel(timer_handle_)) {
+    timer_handle_ = EventEngine::TaskHandle::kInvalid;
+  }
+}
+
+void CallDeadlineWheel::OnTick() {
+  std::vector<std::pair<void (*)(void*), void*>> due;
+  {
+    MutexLock lock(&mu_);
+    timer_handle_ = EventEngine::TaskHandle::kInvalid;
+    const int64_t now_tick = TickFor(Timestamp::Now(), /*round_up=*/false);
+    // Visiting more than kSlots ticks would only revisit the same slots.
+    const int64_t first_tick =
+        std::max(processed_tick_ + 1, now_tick - int64_t{kSlots} + 1);
+    for (int64_t tick = first_tick; tick <= now_tick; ++tick) {
+      Entry* entry = slots_[tick % kSlots];
+      while (entry != nullptr) {
+        Entry* next = entry->next_;
+        if (entry->tick_ <= now_tick) {
+          Unlink(entry);
+          due.emplace_back(std::exchange(entry->callback_, nullptr),
+                           entry->arg_);
+          --num_entries_;
+        }
+        entry = next;
+      }
+    }
+    processed_tick_ = std::max(processed_tick_, now_tick);
+    MaybeStartTimer();
+  }
+  // Callbacks may schedule their entries again, so they run without the lock.
+  for (const auto& [callback, arg] : due) callback(arg);
+}
+
+}  // namespace grpc_core
@@ -66,15 +66,16 @@ namespace grpc_core {
 
 void PublishMetadataArray(grpc_metadata_batch* md, grpc_metadata_array* array,
                           bool is_client) {
-  const auto md_count = md->count();
+  const auto md_count = PublishToAppEncoder::PublishedCount(*md);
   if (md_count > array->capacity) {
     array->capacity =
-        std::max(array->capacity + md->count(), array->capacity * 3 / 2);
+        std::max(array->capacity + md_count, array->capacity * 3 / 2);
     array->metadata = static_cast<grpc_metadata*>(
         gpr_realloc(array->metadata, sizeof(grpc_metadata) * array->capacity));
   }
   PublishToAppEncoder encoder(array, md, is_client);
   md->Encode(&encoder);
+  encoder.EncodeTemplate();
 }
 
 void CToMetadata(grpc_metadata* metadata, size_t count,
@@ -69,6 +69,25 @@ class PublishToAppEncoder {
     Append(key.c_slice(), value.c_slice());
   }
 
+  // Appends the entries of the batch's GrpcMetadataTemplate, which
+  // grpc_metadata_batch::Encode() does not visit.
+  void EncodeTemplate() {
+    const auto* metadata_template =
+        encoding_->get_pointer(GrpcMetadataTemplate());
+    if (metadata_template == nullptr) return;
+    for (const auto& [key, value] : (*metadata_template)->entries()) {
+      Encode(key, value);
+    }
+  }
+
+  // The number of entries that publishing this batch appends.
+  static size_t PublishedCount(const grpc_metadata_batch& md) {
+    const auto* metadata_template = md.get_pointer(GrpcMetadataTemplate());
+    return md.count() + (metadata_template == nullptr
+                             ? 0
+                             : (*metadata_template)->entries().size());
+  }
+
   // Catch anything that is not explicitly handled, and do not publish it to the
   // application. If new metadata is added to a batch that needs to be
   // published, it should be called out here.
@@ -413,6 +413,7 @@ ChannelInit ChannelInit::Builder::Build() {
     result.stack_configs_[i] =
         BuildStackConfig(filters_[i], post_processors_[i],
                          static_cast<grpc_channel_stack_type>(i));
+    result.stack_configs_[i].sealed_stacks = std::move(sealed_stacks_[i]);
   }
   return result;
 }
@@ -471,6 +472,7 @@ void ChannelInit::AddToInterceptionChainBuilder(
     grpc_channel_stack_type type, InterceptionChainBuilder& builder) const {
   const auto& stack_config = stack_configs_[type];
   // Based on predicates build a list of filters to include in this segment.
+  std::vector<const Filter*> filters;
   for (const auto& filter : stack_config.filters) {
     if (SkipV3(filter.version)) continue;
     if (!filter.CheckPredicates(builder.channel_args())) continue;
@@ -479,7 +481,31 @@ void ChannelInit::AddToInterceptionChainBuilder(
           absl::StrCat("Filter ", filter.name, " has no v3-callstack vtable")));
       return;
     }
-    filter.filter_adder(builder);
+    filters.push_back(&filter);
+  }
+  // Add them, sealing together any run that matches a sealed stack.
+  auto sealed_stack_at = [&filters](const SealedStack& sealed, size_t i) {
+    if (filters.size() - i < sealed.filters.size()) return false;
+    for (size_t j = 0; j < sealed.filters.size(); ++j) {
+      if (filters[i + j]->name != sealed.filters[j]) return false;
+    }
+    return true;
+  };
+  for (size_t i = 0; i < filters.size();) {
+    const SealedStack* match = nullptr;
+    for (const auto& sealed : stack_config.sealed_stacks) {
+      if (sealed_stack_at(sealed, i)) {
+        match = &sealed;
+        break;
+      }
+    }
+    if (match != nullptr) {
+      match->filter_adder(builder);
+      i += match->filters.size();
+    } else {
+      filters[i]->filter_adder(builder);
+      ++i;
+    }
   }
 }
 
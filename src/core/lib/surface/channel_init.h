@@ -285,6 +285,14 @@ class ChannelInit {
     SourceLocation registration_source_;
   };
 
+  // A run of filters that is added to v3 stacks as one sealed unit (see
+  // InterceptionChainBuilder::AddSealed()) wherever exactly these filters end
+  // up next to each other, in this order.
+  struct SealedStack {
+    std::vector<UniqueTypeName> filters;
+    FilterAdder filter_adder;
+  };
+
   class Builder {
    public:
     // Register a builder in the normal filter registration pass.
@@ -322,6 +330,21 @@ class ChannelInit {
           .SkipV3();
     }
 
+    // Register a sealed stack template: a run of filters known to be
+    // commonly built together.
+    // Each filter must still be registered with RegisterFilter(): this never
+    // changes which filters are included in a stack, nor their order, only
+    // how a run of them is built. When several sealed stacks could match at
+    // the same place, the first registered wins.
+    template <typename... Filters>
+    void RegisterSealedStack(grpc_channel_stack_type type) {
+      sealed_stacks_[type].push_back(
+          SealedStack{{UniqueTypeNameFor<Filters>()...},
+                      [](InterceptionChainBuilder& builder) {
+                        builder.AddSealed<Filters...>();
+                      }});
+    }
+
     // Register a post processor for the builder.
     // These run after the main graph has been placed into the builder.
     // At most one filter per slot per channel stack type can be added.
@@ -343,6 +366,7 @@ class ChannelInit {
         filters_[GRPC_NUM_CHANNEL_STACK_TYPES];
     PostProcessor post_processors_[GRPC_NUM_CHANNEL_STACK_TYPES]
                                   [static_cast<int>(PostProcessorSlot::kCount)];
+    std::vector<SealedStack> sealed_stacks_[GRPC_NUM_CHANNEL_STACK_TYPES];
   };
 
   /// Construct a channel stack of some sort: see channel_stack.h for details
@@ -386,6 +410,7 @@ class ChannelInit {
     std::vector<Filter> filters;
     std::vector<Filter> terminators;
     std::vector<PostProcessor> post_processors;
+    std::vector<SealedStack> sealed_stacks;
   };
 
   StackConfig stack_configs_[GRPC_NUM_CHANNEL_STACK_TYPES];
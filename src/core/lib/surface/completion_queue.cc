@@ -49,6 +49,7 @@
 #include "src/core/telemetry/stats_data.h"
 #include "src/core/util/atomic_utils.h"
 #include "src/core/util/debug_location.h"
+#include "src/core/util/per_cpu.h"
 #include "src/core/util/ref_counted.h"
 #include "src/core/util/spinlock.h"
 #include "src/core/util/status_helper.h"
@@ -219,13 +220,19 @@ struct cq_vtable {
 
 namespace {
 
-// Queue that holds the cq_completion_events. Internally uses
+// Queue that holds the cq_completion_events. Internally uses shards of
 // MultiProducerSingleConsumerQueue (a lockfree multiproducer single consumer
-// queue). It uses a queue_lock to support multiple consumers.
+// queue), each with a queue_lock to support multiple consumers. Producers push
+// to the shard of their cpu, and consumers try every shard starting from
+// theirs, so that threads polling the same cq rarely contend for a lock.
+// Completions pushed by different threads are not ordered with respect to
+// each other.
 // Only used in completion queues whose completion_type is GRPC_CQ_NEXT
 class CqEventQueue {
  public:
-  CqEventQueue() = default;
+  CqEventQueue()
+      : shards_(grpc_core::PerCpuOptions().SetCpusPerShard(4).SetMaxShards(
+            16)) {}
   ~CqEventQueue() = default;
 
   // Note: The counter is not incremented/decremented atomically with push/pop.
@@ -238,10 +245,14 @@ class CqEventQueue {
   grpc_cq_completion* Pop();
 
  private:
-  // Spinlock to serialize consumers i.e pop() operations
-  gpr_spinlock queue_lock_ = GPR_SPINLOCK_INITIALIZER;
+  struct alignas(GPR_CACHELINE_SIZE) Shard {
+    // Spinlock to serialize consumers i.e pop() operations
+    gpr_spinlock queue_lock = GPR_SPINLOCK_INITIALIZER;
 
-  grpc_core::MultiProducerSingleConsumerQueue queue_;
+    grpc_core::MultiProducerSingleConsumerQueue queue;
+  };
+
+  grpc_core::PerCpu<Shard> shards_;
 
   // A lazy counter of number of items in the queue. This is NOT atomically
   // incremented/decremented along with push/pop operations and hence is only
@@ -484,18 +495,28 @@ int grpc_completion_queue_thread_local_cache_flush(grpc_completion_queue* cq,
 }
 
 bool CqEventQueue::Push(grpc_cq_completion* c) {
-  queue_.Push(
+  shards_.this_cpu().queue.Push(
       reinterpret_cast<grpc_core::MultiProducerSingleConsumerQueue::Node*>(c));
   return num_queue_items_.fetch_add(1, std::memory_order_relaxed) == 0;
 }
 
 grpc_cq_completion* CqEventQueue::Pop() {
   grpc_cq_completion* c = nullptr;
-
-  if (gpr_spinlock_trylock(&queue_lock_)) {
-    bool is_empty = false;
-    c = reinterpret_cast<grpc_cq_completion*>(queue_.PopAndCheckEnd(&is_empty));
-    gpr_spinlock_unlock(&queue_lock_);
+  if (num_items() <= 0) return nullptr;
+
+  // A shard whose lock is held by another consumer is skipped rather than
+  // waited for. As before sharding, a Pop() may therefore return NULL even if
+  // the queue is not empty.
+  const size_t num_shards = shards_.end() - shards_.begin();
+  const size_t first = &shards_.this_cpu() - shards_.begin();
+  for (size_t i = 0; i < num_shards && c == nullptr; ++i) {
+    Shard& shard = shards_.begin()[(first + i) % num_shards];
+    if (gpr_spinlock_trylock(&shard.queue_lock)) {
+      bool is_empty = false;
+      c = reinterpret_cast<grpc_cq_completion*>(
+          shard.queue.PopAndCheckEnd(&is_empty));
+      gpr_spinlock_unlock(&shard.queue_lock);
+    }
   }
 
   if (c) {
@@ -949,9 +970,29 @@ static void dump_pending_tags(grpc_completion_queue* cq) {
 static void dump_pending_tags(grpc_completion_queue* /*cq*/) {}
 #endif
 
-static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
-                          void* reserved) {
-  grpc_event ret;
+// Fills events[*num_events, max_events) with completions that are already
+// queued, without polling.
+static void cq_pop_queued_events(cq_next_data* cqd, grpc_event* events,
+                                 size_t max_events, size_t* num_events) {
+  while (*num_events < max_events) {
+    grpc_cq_completion* c = cqd->queue.Pop();
+    if (c == nullptr) return;
+    grpc_event& ev = events[(*num_events)++];
+    ev.type = GRPC_OP_COMPLETE;
+    ev.success = c->next & 1u;
+    ev.tag = c->tag;
+    c->done(c->done_arg, c);
+  }
+}
+
+// Blocks for the first event as cq_next() does, then takes up to
+// max_events - 1 more completions that are already queued. A timeout or
+// shutdown is always the only event returned.
+static size_t cq_next_batch(grpc_completion_queue* cq, grpc_event* events,
+                            size_t max_events, gpr_timespec deadline,
+                            void* reserved) {
+  grpc_event& ret = events[0];
+  size_t num_events = 1;
   cq_next_data* cqd = static_cast<cq_next_data*> DATA_FROM_CQ(cq);
 
   GRPC_TRACE_LOG(api, INFO)
@@ -986,6 +1027,7 @@ static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
       ret.success = c->next & 1u;
       ret.tag = c->tag;
       c->done(c->done_arg, c);
+      cq_pop_queued_events(cqd, events, max_events, &num_events);
       break;
     }
 
@@ -996,6 +1038,7 @@ static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
       ret.success = c->next & 1u;
       ret.tag = c->tag;
       c->done(c->done_arg, c);
+      cq_pop_queued_events(cqd, events, max_events, &num_events);
       break;
     } else {
       // If c == NULL it means either the queue is empty OR in an transient
@@ -1063,11 +1106,20 @@ static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
     gpr_mu_unlock(cq->mu);
   }
 
-  GRPC_SURFACE_TRACE_RETURNED_EVENT(cq, &ret);
+  for (size_t i = 0; i < num_events; ++i) {
+    GRPC_SURFACE_TRACE_RETURNED_EVENT(cq, &events[i]);
+  }
   GRPC_CQ_INTERNAL_UNREF(cq, "next");
 
   ABSL_CHECK_EQ(is_finished_arg.stolen_completion, nullptr);
 
+  return num_events;
+}
+
+static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
+                          void* reserved) {
+  grpc_event ret;
+  cq_next_batch(cq, &ret, 1, deadline, reserved);
   return ret;
 }
 
@@ -1118,6 +1170,15 @@ grpc_event grpc_completion_queue_next(grpc_completion_queue* cq,
   return cq->vtable->next(cq, deadline, reserved);
 }
 
+size_t grpc_completion_queue_next_batch(grpc_completion_queue* cq,
+                                        grpc_event* events, size_t max_events,
+                                        gpr_timespec deadline,
+                                        void* reserved) {
+  ABSL_CHECK_EQ(cq->vtable->cq_completion_type, GRPC_CQ_NEXT);
+  ABSL_CHECK_GT(max_events, 0u);
+  return cq_next_batch(cq, events, max_events, deadline, reserved);
+}
+
 static int add_plucker(grpc_completion_queue* cq, void* tag,
                        grpc_pollset_worker** worker) {
   cq_pluck_data* cqd = static_cast<cq_pluck_data*> DATA_FROM_CQ(cq);
@@ -105,7 +105,12 @@ grpc_error_handle FilterStackCall::Create(grpc_call_create_args* args,
       GPR_ROUND_UP_TO_ALIGNMENT_SIZE(sizeof(FilterStackCall)) +
       channel_stack->call_stack_size;
 
-  RefCountedPtr<Arena> arena = channel->call_arena_allocator()->MakeArena();
+  // Server calls learn their method only after the arena is made.
+  RefCountedPtr<Arena> arena =
+      args->path.has_value()
+          ? channel->call_arena_allocator()->MakeArenaForMethod(
+                args->path->as_string_view())
+          : channel->call_arena_allocator()->MakeArena();
   arena->SetContext<grpc_event_engine::experimental::EventEngine>(
       args->channel->event_engine());
   call = new (arena->Alloc(call_alloc_size)) FilterStackCall(arena, *args);
@@ -430,14 +435,15 @@ void FilterStackCall::PublishAppMetadata(grpc_metadata_batch* b,
   if (is_trailing && buffered_metadata_[1] == nullptr) return;
   grpc_metadata_array* dest;
   dest = buffered_metadata_[is_trailing];
-  if (dest->count + b->count() > dest->capacity) {
-    dest->capacity =
-        std::max(dest->capacity + b->count(), dest->capacity * 3 / 2);
+  const size_t count = PublishToAppEncoder::PublishedCount(*b);
+  if (dest->count + count > dest->capacity) {
+    dest->capacity = std::max(dest->capacity + count, dest->capacity * 3 / 2);
     dest->metadata = static_cast<grpc_metadata*>(
         gpr_realloc(dest->metadata, sizeof(grpc_metadata) * dest->capacity));
   }
   PublishToAppEncoder encoder(dest, b, is_client());
   b->Encode(&encoder);
+  encoder.EncodeTemplate();
 }
 
 void FilterStackCall::RecvInitialFilter(grpc_metadata_batch* b) {
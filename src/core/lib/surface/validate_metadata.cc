@@ -26,6 +26,7 @@
 #include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/slice/slice_internal.h"
 #include "src/core/util/bitset.h"
+#include "src/core/util/printable_ascii.h"
 
 namespace grpc_core {
 
@@ -103,23 +104,13 @@ int grpc_header_key_is_legal(grpc_slice slice) {
   return error2int(grpc_validate_header_key_is_legal(slice));
 }
 
-namespace {
-class LegalHeaderNonBinValueBits : public grpc_core::BitSet<256> {
- public:
-  constexpr LegalHeaderNonBinValueBits() {
-    for (int i = 32; i <= 126; i++) {
-      set(i);
-    }
-  }
-};
-constexpr LegalHeaderNonBinValueBits g_legal_header_non_bin_value_bits;
-}  // namespace
-
 grpc_error_handle grpc_validate_header_nonbin_value_is_legal(
     const grpc_slice& slice) {
-  return grpc_core::UpgradeToStatus(grpc_core::ConformsTo(
-      grpc_core::StringViewFromSlice(slice), g_legal_header_non_bin_value_bits,
-      grpc_core::ValidateMetadataResult::kIllegalHeaderValue));
+  // Legal non-binary values are exactly the printable ASCII characters.
+  return grpc_core::UpgradeToStatus(
+      grpc_core::IsPrintableAscii(grpc_core::StringViewFromSlice(slice))
+          ? grpc_core::ValidateMetadataResult::kOk
+          : grpc_core::ValidateMetadataResult::kIllegalHeaderValue);
 }
 
 int grpc_header_nonbin_value_is_legal(grpc_slice slice) {
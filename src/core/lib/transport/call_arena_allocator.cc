@@ -17,11 +17,26 @@
 #include <grpc/support/port_platform.h>
 
 #include <algorithm>
+#include <limits>
+
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 
 namespace grpc_core {
 
 void CallArenaAllocator::FinalizeArena(Arena* arena) {
-  call_size_estimator_.UpdateCallSizeEstimate(arena->TotalUsedBytes());
+  const size_t size = arena->TotalUsedBytes();
+  call_size_estimator_.UpdateCallSizeEstimate(size);
+  // Arena context destructors have run by now, but this one is a no-op and
+  // leaves the pointer in place.
+  auto* method_estimator = arena->GetContext<CallSizeEstimator>();
+  if (method_estimator != nullptr) {
+    method_estimator->UpdateCallSizeEstimate(size);
+  }
+  global_stats().IncrementCallArenaAllocatedSize(static_cast<int>(
+      std::min<size_t>(arena->TotalAllocatedBytes(),
+                       std::numeric_limits<int>::max())));
+  if (arena->HasOverflowed()) global_stats().IncrementCallArenaOverflows();
 }
 
 }  // namespace grpc_core
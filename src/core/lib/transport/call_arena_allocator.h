@@ -21,6 +21,8 @@
 #include <atomic>
 #include <cstddef>
 
+#include "absl/hash/hash.h"
+#include "absl/strings/string_view.h"
 #include "src/core/lib/resource_quota/arena.h"
 #include "src/core/lib/resource_quota/memory_quota.h"
 #include "src/core/util/ref_counted.h"
@@ -29,9 +31,16 @@ namespace grpc_core {
 
 class CallSizeEstimator final {
  public:
+  // An estimator with no history; see HasEstimate().
+  CallSizeEstimator() = default;
   explicit CallSizeEstimator(size_t initial_estimate)
       : call_size_estimate_(initial_estimate) {}
 
+  // Returns false until the first UpdateCallSizeEstimate().
+  bool HasEstimate() const {
+    return call_size_estimate_.load(std::memory_order_relaxed) != 0;
+  }
+
   GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION size_t CallSizeEstimate() {
     // We round up our current estimate to the NEXT value of kRoundUpSize.
     // This ensures:
@@ -65,11 +74,22 @@ class CallSizeEstimator final {
   }
 
  private:
-  std::atomic<size_t> call_size_estimate_;
+  std::atomic<size_t> call_size_estimate_{0};
+};
+
+// Set on arenas made by CallArenaAllocator::MakeArenaForMethod(), so that
+// FinalizeArena() knows which estimate to feed.
+template <>
+struct ArenaContextType<CallSizeEstimator> {
+  static void Destroy(CallSizeEstimator*) {}
 };
 
 class CallArenaAllocator final : public ArenaFactory {
  public:
+  // Methods are hashed by path into this many estimates. Methods sharing a
+  // slot share an estimate, which is no worse than one for the whole channel.
+  static constexpr size_t kMethodEstimateSlots = 64;
+
   CallArenaAllocator(MemoryAllocator allocator, size_t initial_size)
       : ArenaFactory(std::move(allocator)),
         call_size_estimator_(initial_size) {}
@@ -78,12 +98,36 @@ class CallArenaAllocator final : public ArenaFactory {
     return Arena::Create(call_size_estimator_.CallSizeEstimate(), Ref());
   }
 
+  // Like MakeArena(), but sizes the first zone from previous calls to `path`
+  // rather than from every call on the channel, so a small health check does
+  // not pay for a large streaming call's arena (or the other way round).
+  RefCountedPtr<Arena> MakeArenaForMethod(absl::string_view path) {
+    CallSizeEstimator* estimator = MethodEstimator(path);
+    auto arena = Arena::Create(EstimateFor(estimator), Ref());
+    arena->SetContext<CallSizeEstimator>(estimator);
+    return arena;
+  }
+
   void FinalizeArena(Arena* arena) override;
 
   size_t CallSizeEstimate() { return call_size_estimator_.CallSizeEstimate(); }
+  size_t CallSizeEstimate(absl::string_view path) {
+    return EstimateFor(MethodEstimator(path));
+  }
 
  private:
+  CallSizeEstimator* MethodEstimator(absl::string_view path) {
+    return &method_call_size_estimators_[absl::HashOf(path) %
+                                         kMethodEstimateSlots];
+  }
+  // Methods with no history yet start from the channel-wide estimate.
+  size_t EstimateFor(CallSizeEstimator* estimator) {
+    return estimator->HasEstimate() ? estimator->CallSizeEstimate()
+                                    : call_size_estimator_.CallSizeEstimate();
+  }
+
   CallSizeEstimator call_size_estimator_;
+  CallSizeEstimator method_call_size_estimators_[kMethodEstimateSlots];
 };
 
 }  // namespace grpc_core
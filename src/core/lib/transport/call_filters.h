@@ -17,11 +17,14 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <array>
 #include <cstdint>
 #include <limits>
 #include <memory>
 #include <ostream>
+#include <tuple>
 #include <type_traits>
+#include <utility>
 
 #include "absl/log/absl_check.h"
 #include "src/core/lib/promise/for_each.h"
@@ -296,6 +299,19 @@ struct Operator {
   void (*early_destroy)(void* promise_data);
 };
 
+// One synchronous filter operation that inspects or edits the value in place
+// Runs to completion with no promise data: returns nullptr to pass the value
+// on, or the error that ends the operation.
+template <typename T>
+struct InPlaceOperator {
+  // Pointer to corresponding channel data for this filter
+  void* channel_data;
+  // Offset of the call data for this filter within the call data memory
+  size_t call_offset;
+  ServerMetadataHandle (*run)(void* call_data, void* channel_data,
+                              typename T::element_type& value);
+};
+
 struct HalfCloseOperator {
   // Pointer to corresponding channel data for this filter
   void* channel_data;
@@ -345,6 +361,9 @@ struct Layout {
   size_t promise_size = 0;
   size_t promise_alignment = 0;
   std::vector<Operator<T>> ops;
+  // While every op added is an in place op, the same ops again in a form that
+  // OperationExecutor can run as a flat loop.
+  std::vector<InPlaceOperator<T>> in_place_ops;
 
   void Add(size_t filter_promise_size, size_t filter_promise_alignment,
            Operator<T> op) {
@@ -353,7 +372,18 @@ struct Layout {
     ops.push_back(op);
   }
 
-  void Reverse() { absl::c_reverse(ops); }
+  void AddInPlace(Operator<T> op, InPlaceOperator<T> in_place_op) {
+    if (AllInPlace()) in_place_ops.push_back(in_place_op);
+    Add(0, 0, op);
+  }
+
+  // True if every op in this layout can be run from in_place_ops.
+  bool AllInPlace() const { return in_place_ops.size() == ops.size(); }
+
+  void Reverse() {
+    absl::c_reverse(ops);
+    absl::c_reverse(in_place_ops);
+  }
 };
 
 // AddOp and friends
@@ -378,6 +408,28 @@ void AddOp(FilterType* channel_data, size_t call_offset, Layout<T>& to) {
                                                     to);
 }
 
+// Adds the synchronous op `run` to a layout both as an ordinary op and as an
+// in place op.
+template <typename T,
+          ServerMetadataHandle (*run)(void* call_data, void* channel_data,
+                                      typename T::element_type& value)>
+void AddInPlaceOp(void* channel_data, size_t call_offset, Layout<T>& to) {
+  to.AddInPlace(
+      Operator<T>{
+          channel_data,
+          call_offset,
+          [](void*, void* call_data, void* channel_data,
+             T value) -> Poll<ResultOr<T>> {
+            auto r = run(call_data, channel_data, *value);
+            if (r == nullptr) return ResultOr<T>{std::move(value), nullptr};
+            return ResultOr<T>{nullptr, std::move(r)};
+          },
+          nullptr,
+          nullptr,
+      },
+      InPlaceOperator<T>{channel_data, call_offset, run});
+}
+
 template <typename FilterType>
 void AddHalfClose(FilterType* channel_data, size_t call_offset,
                   void (FilterType::Call::*)(),
@@ -478,19 +530,13 @@ template <typename FilterType, typename T,
           void (FilterType::Call::*impl)(typename T::element_type&)>
 struct AddOpImpl<FilterType, T,
                  void (FilterType::Call::*)(typename T::element_type&), impl> {
+  static ServerMetadataHandle Run(void* call_data, void*,
+                                  typename T::element_type& value) {
+    (static_cast<typename FilterType::Call*>(call_data)->*impl)(value);
+    return nullptr;
+  }
   static void Add(FilterType* channel_data, size_t call_offset, Layout<T>& to) {
-    to.Add(0, 0,
-           Operator<T>{
-               channel_data,
-               call_offset,
-               [](void*, void* call_data, void*, T value) -> Poll<ResultOr<T>> {
-                 (static_cast<typename FilterType::Call*>(call_data)->*impl)(
-                     *value);
-                 return ResultOr<T>{std::move(value), nullptr};
-               },
-               nullptr,
-               nullptr,
-           });
+    AddInPlaceOp<T, Run>(channel_data, call_offset, to);
   }
 };
 
@@ -500,19 +546,13 @@ template <typename FilterType, typename T,
 struct AddOpImpl<FilterType, T,
                  void (FilterType::Call::*)(const typename T::element_type&),
                  impl> {
+  static ServerMetadataHandle Run(void* call_data, void*,
+                                  typename T::element_type& value) {
+    (static_cast<typename FilterType::Call*>(call_data)->*impl)(value);
+    return nullptr;
+  }
   static void Add(FilterType* channel_data, size_t call_offset, Layout<T>& to) {
-    to.Add(0, 0,
-           Operator<T>{
-               channel_data,
-               call_offset,
-               [](void*, void* call_data, void*, T value) -> Poll<ResultOr<T>> {
-                 (static_cast<typename FilterType::Call*>(call_data)->*impl)(
-                     *value);
-                 return ResultOr<T>{std::move(value), nullptr};
-               },
-               nullptr,
-               nullptr,
-           });
+    AddInPlaceOp<T, Run>(channel_data, call_offset, to);
   }
 };
 
@@ -523,20 +563,14 @@ template <typename FilterType, typename T,
 struct AddOpImpl<
     FilterType, T,
     void (FilterType::Call::*)(typename T::element_type&, FilterType*), impl> {
+  static ServerMetadataHandle Run(void* call_data, void* channel_data,
+                                  typename T::element_type& value) {
+    (static_cast<typename FilterType::Call*>(call_data)->*impl)(
+        value, static_cast<FilterType*>(channel_data));
+    return nullptr;
+  }
   static void Add(FilterType* channel_data, size_t call_offset, Layout<T>& to) {
-    to.Add(0, 0,
-           Operator<T>{
-               channel_data,
-               call_offset,
-               [](void*, void* call_data, void* channel_data,
-                  T value) -> Poll<ResultOr<T>> {
-                 (static_cast<typename FilterType::Call*>(call_data)->*impl)(
-                     *value, static_cast<FilterType*>(channel_data));
-                 return ResultOr<T>{std::move(value), nullptr};
-               },
-               nullptr,
-               nullptr,
-           });
+    AddInPlaceOp<T, Run>(channel_data, call_offset, to);
   }
 };
 
@@ -548,20 +582,14 @@ struct AddOpImpl<FilterType, T,
                  void (FilterType::Call::*)(const typename T::element_type&,
                                             FilterType*),
                  impl> {
+  static ServerMetadataHandle Run(void* call_data, void* channel_data,
+                                  typename T::element_type& value) {
+    (static_cast<typename FilterType::Call*>(call_data)->*impl)(
+        value, static_cast<FilterType*>(channel_data));
+    return nullptr;
+  }
   static void Add(FilterType* channel_data, size_t call_offset, Layout<T>& to) {
-    to.Add(0, 0,
-           Operator<T>{
-               channel_data,
-               call_offset,
-               [](void*, void* call_data, void* channel_data,
-                  T value) -> Poll<ResultOr<T>> {
-                 (static_cast<typename FilterType::Call*>(call_data)->*impl)(
-                     *value, static_cast<FilterType*>(channel_data));
-                 return ResultOr<T>{std::move(value), nullptr};
-               },
-               nullptr,
-               nullptr,
-           });
+    AddInPlaceOp<T, Run>(channel_data, call_offset, to);
   }
 };
 
@@ -594,23 +622,14 @@ template <typename FilterType, typename T,
 struct AddOpImpl<FilterType, T,
                  absl::Status (FilterType::Call::*)(typename T::element_type&),
                  impl> {
+  static ServerMetadataHandle Run(void* call_data, void*,
+                                  typename T::element_type& value) {
+    auto r = (static_cast<typename FilterType::Call*>(call_data)->*impl)(value);
+    if (r.ok()) return nullptr;
+    return StatusCast<ServerMetadataHandle>(std::move(r));
+  }
   static void Add(FilterType* channel_data, size_t call_offset, Layout<T>& to) {
-    to.Add(
-        0, 0,
-        Operator<T>{
-            channel_data,
-            call_offset,
-            [](void*, void* call_data, void*, T value) -> Poll<ResultOr<T>> {
-              auto r =
-                  (static_cast<typename FilterType::Call*>(call_data)->*impl)(
-                      *value);
-              if (r.ok()) return ResultOr<T>{std::move(value), nullptr};
-              return ResultOr<T>{
-                  nullptr, StatusCast<ServerMetadataHandle>(std::move(r))};
-            },
-            nullptr,
-            nullptr,
-        });
+    AddInPlaceOp<T, Run>(channel_data, call_offset, to);
   }
 };
 
@@ -621,23 +640,14 @@ template <typename FilterType, typename T,
 struct AddOpImpl<
     FilterType, T,
     absl::Status (FilterType::Call::*)(const typename T::element_type&), impl> {
+  static ServerMetadataHandle Run(void* call_data, void*,
+                                  typename T::element_type& value) {
+    auto r = (static_cast<typename FilterType::Call*>(call_data)->*impl)(value);
+    if (r.ok()) return nullptr;
+    return StatusCast<ServerMetadataHandle>(std::move(r));
+  }
   static void Add(FilterType* channel_data, size_t call_offset, Layout<T>& to) {
-    to.Add(
-        0, 0,
-        Operator<T>{
-            channel_data,
-            call_offset,
-            [](void*, void* call_data, void*, T value) -> Poll<ResultOr<T>> {
-              auto r =
-                  (static_cast<typename FilterType::Call*>(call_data)->*impl)(
-                      *value);
-              if (r.ok()) return ResultOr<T>{std::move(value), nullptr};
-              return ResultOr<T>{
-                  nullptr, StatusCast<ServerMetadataHandle>(std::move(r))};
-            },
-            nullptr,
-            nullptr,
-        });
+    AddInPlaceOp<T, Run>(channel_data, call_offset, to);
   }
 };
 
@@ -649,24 +659,15 @@ struct AddOpImpl<FilterType, T,
                  absl::Status (FilterType::Call::*)(typename T::element_type&,
                                                     FilterType*),
                  impl> {
+  static ServerMetadataHandle Run(void* call_data, void* channel_data,
+                                  typename T::element_type& value) {
+    auto r = (static_cast<typename FilterType::Call*>(call_data)->*impl)(
+        value, static_cast<FilterType*>(channel_data));
+    if (r.ok()) return nullptr;
+    return StatusCast<ServerMetadataHandle>(std::move(r));
+  }
   static void Add(FilterType* channel_data, size_t call_offset, Layout<T>& to) {
-    to.Add(
-        0, 0,
-        Operator<T>{
-            channel_data,
-            call_offset,
-            [](void*, void* call_data, void* channel_data,
-               T value) -> Poll<ResultOr<T>> {
-              auto r =
-                  (static_cast<typename FilterType::Call*>(call_data)->*impl)(
-                      *value, static_cast<FilterType*>(channel_data));
-              if (IsStatusOk(r)) return ResultOr<T>{std::move(value), nullptr};
-              return ResultOr<T>{
-                  nullptr, StatusCast<ServerMetadataHandle>(std::move(r))};
-            },
-            nullptr,
-            nullptr,
-        });
+    AddInPlaceOp<T, Run>(channel_data, call_offset, to);
   }
 };
 
@@ -678,24 +679,15 @@ struct AddOpImpl<FilterType, T,
                  absl::Status (FilterType::Call::*)(
                      const typename T::element_type&, FilterType*),
                  impl> {
+  static ServerMetadataHandle Run(void* call_data, void* channel_data,
+                                  typename T::element_type& value) {
+    auto r = (static_cast<typename FilterType::Call*>(call_data)->*impl)(
+        value, static_cast<FilterType*>(channel_data));
+    if (r.ok()) return nullptr;
+    return StatusCast<ServerMetadataHandle>(std::move(r));
+  }
   static void Add(FilterType* channel_data, size_t call_offset, Layout<T>& to) {
-    to.Add(
-        0, 0,
-        Operator<T>{
-            channel_data,
-            call_offset,
-            [](void*, void* call_data, void* channel_data,
-               T value) -> Poll<ResultOr<T>> {
-              auto r =
-                  (static_cast<typename FilterType::Call*>(call_data)->*impl)(
-                      *value, static_cast<FilterType*>(channel_data));
-              if (IsStatusOk(r)) return ResultOr<T>{std::move(value), nullptr};
-              return ResultOr<T>{
-                  nullptr, StatusCast<ServerMetadataHandle>(std::move(r))};
-            },
-            nullptr,
-            nullptr,
-        });
+    AddInPlaceOp<T, Run>(channel_data, call_offset, to);
   }
 };
 
@@ -734,23 +726,12 @@ struct AddOpImpl<FilterType, T,
                  ServerMetadataHandle (FilterType::Call::*)(
                      typename T::element_type&),
                  impl> {
+  static ServerMetadataHandle Run(void* call_data, void*,
+                                  typename T::element_type& value) {
+    return (static_cast<typename FilterType::Call*>(call_data)->*impl)(value);
+  }
   static void Add(FilterType* channel_data, size_t call_offset, Layout<T>& to) {
-    to.Add(
-        0, 0,
-        Operator<T>{
-            channel_data,
-            call_offset,
-            [](void*, void* call_data, void*, T value) -> Poll<ResultOr<T>> {
-              auto r =
-                  (static_cast<typename FilterType::Call*>(call_data)->*impl)(
-                      *value);
-              if (r == nullptr) return ResultOr<T>{std::move(value), nullptr};
-              return ResultOr<T>{
-                  nullptr, StatusCast<ServerMetadataHandle>(std::move(r))};
-            },
-            nullptr,
-            nullptr,
-        });
+    AddInPlaceOp<T, Run>(channel_data, call_offset, to);
   }
 };
 
@@ -762,23 +743,12 @@ struct AddOpImpl<FilterType, T,
                  ServerMetadataHandle (FilterType::Call::*)(
                      const typename T::element_type&),
                  impl> {
+  static ServerMetadataHandle Run(void* call_data, void*,
+                                  typename T::element_type& value) {
+    return (static_cast<typename FilterType::Call*>(call_data)->*impl)(value);
+  }
   static void Add(FilterType* channel_data, size_t call_offset, Layout<T>& to) {
-    to.Add(
-        0, 0,
-        Operator<T>{
-            channel_data,
-            call_offset,
-            [](void*, void* call_data, void*, T value) -> Poll<ResultOr<T>> {
-              auto r =
-                  (static_cast<typename FilterType::Call*>(call_data)->*impl)(
-                      *value);
-              if (r == nullptr) return ResultOr<T>{std::move(value), nullptr};
-              return ResultOr<T>{
-                  nullptr, StatusCast<ServerMetadataHandle>(std::move(r))};
-            },
-            nullptr,
-            nullptr,
-        });
+    AddInPlaceOp<T, Run>(channel_data, call_offset, to);
   }
 };
 
@@ -790,24 +760,13 @@ struct AddOpImpl<FilterType, T,
                  ServerMetadataHandle (FilterType::Call::*)(
                      typename T::element_type&, FilterType*),
                  impl> {
+  static ServerMetadataHandle Run(void* call_data, void* channel_data,
+                                  typename T::element_type& value) {
+    return (static_cast<typename FilterType::Call*>(call_data)->*impl)(
+        value, static_cast<FilterType*>(channel_data));
+  }
   static void Add(FilterType* channel_data, size_t call_offset, Layout<T>& to) {
-    to.Add(
-        0, 0,
-        Operator<T>{
-            channel_data,
-            call_offset,
-            [](void*, void* call_data, void* channel_data,
-               T value) -> Poll<ResultOr<T>> {
-              auto r =
-                  (static_cast<typename FilterType::Call*>(call_data)->*impl)(
-                      *value, static_cast<FilterType*>(channel_data));
-              if (r == nullptr) return ResultOr<T>{std::move(value), nullptr};
-              return ResultOr<T>{
-                  nullptr, StatusCast<ServerMetadataHandle>(std::move(r))};
-            },
-            nullptr,
-            nullptr,
-        });
+    AddInPlaceOp<T, Run>(channel_data, call_offset, to);
   }
 };
 
@@ -819,24 +778,13 @@ struct AddOpImpl<FilterType, T,
                  ServerMetadataHandle (FilterType::Call::*)(
                      const typename T::element_type&, FilterType*),
                  impl> {
+  static ServerMetadataHandle Run(void* call_data, void* channel_data,
+                                  typename T::element_type& value) {
+    return (static_cast<typename FilterType::Call*>(call_data)->*impl)(
+        value, static_cast<FilterType*>(channel_data));
+  }
   static void Add(FilterType* channel_data, size_t call_offset, Layout<T>& to) {
-    to.Add(
-        0, 0,
-        Operator<T>{
-            channel_data,
-            call_offset,
-            [](void*, void* call_data, void* channel_data,
-               T value) -> Poll<ResultOr<T>> {
-              auto r =
-                  (static_cast<typename FilterType::Call*>(call_data)->*impl)(
-                      *value, static_cast<FilterType*>(channel_data));
-              if (r == nullptr) return ResultOr<T>{std::move(value), nullptr};
-              return ResultOr<T>{
-                  nullptr, StatusCast<ServerMetadataHandle>(std::move(r))};
-            },
-            nullptr,
-            nullptr,
-        });
+    AddInPlaceOp<T, Run>(channel_data, call_offset, to);
   }
 };
 
@@ -998,6 +946,130 @@ struct ChannelDataDestructor {
   void* channel_data;
 };
 
+// Sealed runs of filters
+// A run of filters that is known ahead of time can be added to a stack as one
+// sealed unit (see CallFilters::StackBuilder::AddSealed()). On each pipe where
+// every filter of the run works in place, the run contributes a single in
+// place op that calls each filter's handler directly, so the compiler sees -
+// and can inline - the whole run instead of one indirect call per filter.
+
+// Channel data for a sealed run: the filters, and where each one's call data
+// lives.
+template <typename... FilterTypes>
+struct SealedChannelData {
+  std::tuple<FilterTypes*...> filters;
+  std::array<size_t, sizeof...(FilterTypes)> call_offsets;
+};
+
+// How a sealed run sees one filter handler: kInPlace if it can be part of a
+// sealed op, kSkip if there is nothing to call (NoInterceptor).
+template <typename FilterType, typename T, typename FunctionImpl,
+          FunctionImpl impl, typename SfinaeVoid = void>
+struct SealedOp {
+  static constexpr bool kInPlace =
+      std::is_same<FunctionImpl, const NoInterceptor*>::value;
+  static constexpr bool kSkip = kInPlace;
+};
+
+template <typename FilterType, typename T, typename FunctionImpl,
+          FunctionImpl impl>
+struct SealedOp<FilterType, T, FunctionImpl, impl,
+                absl::void_t<decltype(&AddOpImpl<FilterType, T, FunctionImpl,
+                                                 impl>::Run)>> {
+  static constexpr bool kInPlace = true;
+  static constexpr bool kSkip = false;
+  using Impl = AddOpImpl<FilterType, T, FunctionImpl, impl>;
+};
+
+// The four pipes a sealed run can fuse.
+// kReversed pipes run their filters from the bottom of the stack up.
+struct ClientInitialMetadataPipe {
+  using Value = ClientMetadataHandle;
+  static constexpr bool kReversed = false;
+  template <typename FilterType>
+  static constexpr auto Handler() {
+    return &FilterType::Call::OnClientInitialMetadata;
+  }
+};
+
+struct ServerInitialMetadataPipe {
+  using Value = ServerMetadataHandle;
+  static constexpr bool kReversed = true;
+  template <typename FilterType>
+  static constexpr auto Handler() {
+    return &FilterType::Call::OnServerInitialMetadata;
+  }
+};
+
+struct ClientToServerMessagePipe {
+  using Value = MessageHandle;
+  static constexpr bool kReversed = false;
+  template <typename FilterType>
+  static constexpr auto Handler() {
+    return &FilterType::Call::OnClientToServerMessage;
+  }
+};
+
+struct ServerToClientMessagePipe {
+  using Value = MessageHandle;
+  static constexpr bool kReversed = true;
+  template <typename FilterType>
+  static constexpr auto Handler() {
+    return &FilterType::Call::OnServerToClientMessage;
+  }
+};
+
+// One pipe of a sealed run.
+template <typename Pipe, typename... FilterTypes>
+class SealedPipe {
+ public:
+  using T = typename Pipe::Value;
+
+  template <typename FilterType>
+  using Op =
+      SealedOp<FilterType, T, decltype(Pipe::template Handler<FilterType>()),
+               Pipe::template Handler<FilterType>()>;
+
+  // Every filter of the run works in place on this pipe.
+  static constexpr bool kInPlace = (Op<FilterTypes>::kInPlace && ...);
+  // No filter of the run intercepts this pipe.
+  static constexpr bool kEmpty = (Op<FilterTypes>::kSkip && ...);
+
+  // The sealed op: channel_data is the run's SealedChannelData.
+  static ServerMetadataHandle Run(void* call_data, void* channel_data,
+                                  typename T::element_type& value) {
+    return RunAll(call_data,
+                  static_cast<SealedChannelData<FilterTypes...>*>(channel_data),
+                  value, std::make_index_sequence<sizeof...(FilterTypes)>());
+  }
+
+ private:
+  static constexpr size_t kCount = sizeof...(FilterTypes);
+
+  template <size_t... I>
+  GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION static ServerMetadataHandle RunAll(
+      void* call_data, SealedChannelData<FilterTypes...>* sealed,
+      typename T::element_type& value, std::index_sequence<I...>) {
+    ServerMetadataHandle error;
+    (... || ((error = RunOne<Pipe::kReversed ? kCount - 1 - I : I>(
+                  call_data, sealed, value)) != nullptr));
+    return error;
+  }
+
+  template <size_t I>
+  GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION static ServerMetadataHandle RunOne(
+      void* call_data, SealedChannelData<FilterTypes...>* sealed,
+      typename T::element_type& value) {
+    using FilterOp = Op<std::tuple_element_t<I, std::tuple<FilterTypes...>>>;
+    if constexpr (FilterOp::kSkip) {
+      return nullptr;
+    } else {
+      return FilterOp::Impl::Run(Offset(call_data, sealed->call_offsets[I]),
+                                 std::get<I>(sealed->filters), value);
+    }
+  }
+};
+
 // StackData contains the main datastructures built up by this module.
 // It's a complete representation of all the code that needs to be invoked
 // to execute a call for a given set of filters.
@@ -1173,6 +1245,62 @@ struct StackData {
                               server_trailing_metadata);
   }
 
+  // Add the ops of a sealed run whose call data has already been added.
+  template <typename... FilterTypes>
+  void AddSealedOps(SealedChannelData<FilterTypes...>* sealed) {
+    AddSealedPipeOps<ClientInitialMetadataPipe>(sealed,
+                                                client_initial_metadata);
+    AddSealedPipeOps<ServerInitialMetadataPipe>(sealed,
+                                                server_initial_metadata);
+    AddSealedPipeOps<ClientToServerMessagePipe>(sealed,
+                                                client_to_server_messages);
+    AddSealedPipeOps<ServerToClientMessagePipe>(sealed,
+                                                server_to_client_messages);
+    AddSealedRemainingOps(sealed,
+                          std::make_index_sequence<sizeof...(FilterTypes)>());
+  }
+
+  template <typename Pipe, typename... FilterTypes>
+  void AddSealedPipeOps(SealedChannelData<FilterTypes...>* sealed,
+                        Layout<typename Pipe::Value>& to) {
+    using Sealed = SealedPipe<Pipe, FilterTypes...>;
+    if constexpr (Sealed::kEmpty) {
+      return;
+    } else if constexpr (Sealed::kInPlace) {
+      AddInPlaceOp<typename Pipe::Value, Sealed::Run>(sealed, 0, to);
+    } else {
+      // Some filter needs the promise path: add the run filter by filter.
+      AddSealedPipeOpsOneByOne<Pipe>(
+          sealed, to, std::make_index_sequence<sizeof...(FilterTypes)>());
+    }
+  }
+
+  template <typename Pipe, typename... FilterTypes, size_t... I>
+  void AddSealedPipeOpsOneByOne(SealedChannelData<FilterTypes...>* sealed,
+                                Layout<typename Pipe::Value>& to,
+                                std::index_sequence<I...>) {
+    (AddOp<decltype(Pipe::template Handler<FilterTypes>()),
+           Pipe::template Handler<FilterTypes>()>(
+         std::get<I>(sealed->filters), sealed->call_offsets[I], to),
+     ...);
+  }
+
+  // Half close, server trailing metadata and finalization are run as a flat
+  // loop already: they're added filter by filter.
+  template <typename... FilterTypes, size_t... I>
+  void AddSealedRemainingOps(SealedChannelData<FilterTypes...>* sealed,
+                             std::index_sequence<I...>) {
+    (AddClientToServerHalfClose(std::get<I>(sealed->filters),
+                                sealed->call_offsets[I]),
+     ...);
+    (AddServerTrailingMetadataOp(std::get<I>(sealed->filters),
+                                 sealed->call_offsets[I]),
+     ...);
+    (AddFinalizer(std::get<I>(sealed->filters), sealed->call_offsets[I],
+                  &FilterTypes::Call::OnFinalize),
+     ...);
+  }
+
   // Finalizer interception adders
 
   template <typename FilterType>
@@ -1282,6 +1410,17 @@ GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION inline Poll<ResultOr<T>>
 OperationExecutor<T>::Start(const Layout<T>* layout, T input, void* call_data) {
   ops_ = layout->ops.data();
   end_ops_ = ops_ + layout->ops.size();
+  if (layout->AllInPlace()) {
+    // Only synchronous ops that keep the value where it is: skip the promise
+    // machinery and call each one directly.
+    ABSL_CHECK(input != nullptr);
+    for (const auto& op : layout->in_place_ops) {
+      auto error =
+          op.run(Offset(call_data, op.call_offset), op.channel_data, *input);
+      if (error != nullptr) return ResultOr<T>{nullptr, std::move(error)};
+    }
+    return ResultOr<T>{std::move(input), nullptr};
+  }
   if (layout->promise_size == 0) {
     // No call state ==> instantaneously ready
     auto r = InitStep(std::move(input), call_data);
@@ -1502,6 +1641,20 @@ class CallFilters {
       data_.AddFinalizer(filter, call_offset, &FilterType::Call::OnFinalize);
     }
 
+    // Add a run of filters that always appear together, in this order.
+    // Equivalent to calling Add() with each of them, except that on each pipe
+    // where every filter of the run works in place the run becomes a single
+    // operation.
+    template <typename... FilterTypes>
+    void AddSealed(FilterTypes*... filters) {
+      auto sealed = std::make_unique<
+          filters_detail::SealedChannelData<FilterTypes...>>();
+      sealed->filters = std::tuple<FilterTypes*...>(filters...);
+      sealed->call_offsets = {data_.AddFilter<FilterTypes>(filters)...};
+      data_.AddSealedOps(sealed.get());
+      AddOwnedObject(std::move(sealed));
+    }
+
     void AddOwnedObject(void (*destroy)(void* p), void* p) {
       data_.channel_data_destructors.push_back({destroy, p});
     }
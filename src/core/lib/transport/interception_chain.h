@@ -18,6 +18,7 @@
 #include <grpc/support/port_platform.h>
 
 #include <memory>
+#include <tuple>
 #include <vector>
 
 #include "src/core/lib/transport/call_destination.h"
@@ -188,6 +189,32 @@ class InterceptionChainBuilder final {
     return *this;
   };
 
+  // Add a run of filters (each one as Add<T>() would) that always appear
+  // together, in this order: see CallFilters::StackBuilder::AddSealed().
+  template <typename... Ts>
+  InterceptionChainBuilder& AddSealed() {
+    static_assert(((sizeof(typename Ts::Call) != 0) && ...),
+                  "AddSealed() takes filters with a Call class");
+    if (!status_.ok()) return *this;
+    std::tuple<decltype(Ts::Create(args_, {}))...> filters{
+        Ts::Create(args_, {FilterInstanceId(FilterTypeId<Ts>()),
+                           old_blackboard_, new_blackboard_})...};
+    std::apply(
+        [this](auto&... filter) {
+          (... && (filter.ok() || (status_ = filter.status(), false)));
+        },
+        filters);
+    if (!status_.ok()) return *this;
+    std::apply(
+        [this](auto&... filter) {
+          auto& sb = stack_builder();
+          sb.AddSealed(filter.value().get()...);
+          (sb.AddOwnedObject(std::move(filter.value())), ...);
+        },
+        filters);
+    return *this;
+  }
+
   // Add a filter that is an interceptor - one that can hijack calls.
   template <typename T>
   absl::enable_if_t<std::is_base_of<Interceptor, T>::value,
@@ -0,0 +1,108 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/transport/interned_metadata_key.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+#include "absl/base/no_destructor.h"
+#include "absl/hash/hash.h"
+
+namespace grpc_core {
+
+namespace {
+
+struct InternedKey {
+  InternedKey(absl::string_view key, uint32_t id) : key(key), id(id) {}
+  const std::string key;
+  const uint32_t id;
+};
+
+// A lock-free open addressing hash table, so that lookups on the metadata
+// path never contend. Keys are only ever added, and are never freed.
+class InternTable {
+ public:
+  const InternedKey* Find(absl::string_view key, bool add) {
+    size_t slot = absl::HashOf(key) % kSlots;
+    while (true) {
+      const InternedKey* entry = slots_[slot].load(std::memory_order_acquire);
+      if (entry == nullptr) {
+        if (!add || next_id_.load(std::memory_order_relaxed) >=
+                        InternedMetadataKey::kMaxKeys) {
+          return nullptr;
+        }
+        entry = TryAdd(key, slot);
+        // Another thread may have filled the slot first, with this key or
+        // another one: look at it again.
+        if (entry == nullptr) continue;
+        return entry;
+      }
+      if (entry->key == key) return entry;
+      slot = (slot + 1) % kSlots;
+    }
+  }
+
+ private:
+  // At most a quarter full so that probe sequences stay short, and so that
+  // there is always an empty slot to end a probe.
+  static constexpr size_t kSlots = 4 * InternedMetadataKey::kMaxKeys;
+
+  // Tries to put key into the empty slot. Returns nullptr if another thread
+  // took the slot first.
+  const InternedKey* TryAdd(absl::string_view key, size_t slot) {
+    // Racing adders may take the id count a little past kMaxKeys, which the
+    // spare slots absorb.
+    const size_t id = next_id_.fetch_add(1, std::memory_order_relaxed);
+    auto entry = std::make_unique<InternedKey>(key, static_cast<uint32_t>(id));
+    const InternedKey* expected = nullptr;
+    if (!slots_[slot].compare_exchange_strong(expected, entry.get(),
+                                              std::memory_order_acq_rel)) {
+      // Losing the race wastes the id, which only shrinks the table by one.
+      return nullptr;
+    }
+    return entry.release();
+  }
+
+  std::atomic<size_t> next_id_{0};
+  std::atomic<const InternedKey*> slots_[kSlots] = {};
+};
+
+InternTable& Table() {
+  static absl::NoDestructor<InternTable> table;
+  return *table;
+}
+
+}  // namespace
+
+std::optional<InternedMetadataKey> InternedMetadataKey::Intern(
+    absl::string_view key) {
+  if (key.size() > kMaxKeyLength) return std::nullopt;
+  const InternedKey* entry = Table().Find(key, true);
+  if (entry == nullptr) return std::nullopt;
+  return InternedMetadataKey(entry->id, entry->key);
+}
+
+std::optional<InternedMetadataKey> InternedMetadataKey::Find(
+    absl::string_view key) {
+  if (key.size() > kMaxKeyLength) return std::nullopt;
+  const InternedKey* entry = Table().Find(key, false);
+  if (entry == nullptr) return std::nullopt;
+  return InternedMetadataKey(entry->id, entry->key);
+}
+
+}  // namespace grpc_core
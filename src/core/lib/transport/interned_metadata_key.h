@@ -0,0 +1,77 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_TRANSPORT_INTERNED_METADATA_KEY_H
+#define GRPC_SRC_CORE_LIB_TRANSPORT_INTERNED_METADATA_KEY_H
+
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <optional>
+
+#include "absl/strings/string_view.h"
+#include "src/core/lib/slice/slice.h"
+
+namespace grpc_core {
+
+// A metadata key from a process-wide intern table. Each distinct key is
+// stored once, forever, and given a small integer id: two interned keys are
+// equal exactly when they have the same id, and a Slice of an interned key is
+// a static slice, so taking refs to it costs nothing.
+//
+// grpc_metadata_batch interns the keys of unknown metadata as they are added,
+// so that filters can look custom headers up by InternedMetadataKey without
+// comparing strings. The table is bounded (kMaxKeys keys of up to
+// kMaxKeyLength bytes) so that peers sending many distinct keys cannot grow
+// it without limit; keys that do not fit are simply not interned.
+class InternedMetadataKey {
+ public:
+  static constexpr size_t kMaxKeys = 1024;
+  static constexpr size_t kMaxKeyLength = 64;
+
+  // Returns the interned form of key, adding it to the table if needed and
+  // there is room.
+  static std::optional<InternedMetadataKey> Intern(absl::string_view key);
+  // Returns the interned form of key only if it is already in the table.
+  static std::optional<InternedMetadataKey> Find(absl::string_view key);
+
+  uint32_t id() const { return id_; }
+  absl::string_view key() const { return key_; }
+  Slice slice() const { return Slice::FromStaticString(key_); }
+
+  // A bit identifying this key within a 64-bit set: collections of keys can
+  // keep the union of their keys' bits and rule out most absent keys without
+  // searching.
+  uint64_t mask_bit() const { return uint64_t{1} << (id_ % 64); }
+
+  bool operator==(const InternedMetadataKey& other) const {
+    return id_ == other.id_;
+  }
+  bool operator!=(const InternedMetadataKey& other) const {
+    return id_ != other.id_;
+  }
+
+ private:
+  InternedMetadataKey(uint32_t id, absl::string_view key)
+      : id_(id), key_(key) {}
+
+  uint32_t id_;
+  // Points into the intern table, and so outlives everything.
+  absl::string_view key_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_TRANSPORT_INTERNED_METADATA_KEY_H
@@ -31,6 +31,45 @@
 namespace grpc_core {
 namespace metadata_detail {
 
+KeyIndex::KeyIndex(std::vector<absl::string_view> keys)
+    : keys_(std::move(keys)) {
+  bool has_empty_key = false;
+  for (absl::string_view key : keys_) has_empty_key |= key.empty();
+  if (has_empty_key) return;
+  // Table sizes from 2x to 16x the number of keys, and a bounded number of
+  // seeds per size: for the sets of keys we see this finds a perfect hash
+  // almost immediately.
+  size_t size = 1;
+  while (size < 2 * keys_.size()) size *= 2;
+  for (; size <= 16 * std::max<size_t>(keys_.size(), 1); size *= 2) {
+    for (uint32_t seed = 1; seed <= 256; ++seed) {
+      std::vector<int16_t> slots(size, -1);
+      bool collision = false;
+      for (size_t i = 0; i < keys_.size(); ++i) {
+        int16_t& slot = slots[Hash(keys_[i], seed) & (size - 1)];
+        if (slot != -1) {
+          collision = true;
+          break;
+        }
+        slot = static_cast<int16_t>(i);
+      }
+      if (!collision) {
+        slots_ = std::move(slots);
+        seed_ = seed;
+        mask_ = static_cast<uint32_t>(size - 1);
+        return;
+      }
+    }
+  }
+}
+
+int KeyIndex::FindSlow(absl::string_view key) const {
+  for (size_t i = 0; i < keys_.size(); ++i) {
+    if (keys_[i] == key) return static_cast<int>(i);
+  }
+  return -1;
+}
+
 void DebugStringBuilder::Add(absl::string_view key, absl::string_view value) {
   if (!out_.empty()) out_.append(", ");
   absl::StrAppend(&out_, absl::CEscape(key), ": ", absl::CEscape(value));
@@ -88,12 +127,14 @@ bool DebugStringBuilder::IsAllowListed(const absl::string_view key) const {
         // go/keep-sorted end
         // go/keep-sorted start
         allow_list.insert(std::string(GrpcCallWasCancelled::DebugKey()));
+        allow_list.insert(std::string(GrpcMetadataTemplate::DebugKey()));
         allow_list.insert(std::string(GrpcRegisteredMethod::DebugKey()));
         allow_list.insert(std::string(GrpcStatusContext::DebugKey()));
         allow_list.insert(std::string(GrpcStatusFromWire::DebugKey()));
         allow_list.insert(std::string(GrpcStreamNetworkState::DebugKey()));
         allow_list.insert(std::string(GrpcTarPit::DebugKey()));
         allow_list.insert(std::string(GrpcTrailersOnly::DebugKey()));
+        allow_list.insert(std::string(GrpcWriteWeight::DebugKey()));
         allow_list.insert(std::string(PeerString::DebugKey()));
         allow_list.insert(std::string(WaitForReady::DebugKey()));
         // go/keep-sorted end
@@ -103,7 +144,23 @@ bool DebugStringBuilder::IsAllowListed(const absl::string_view key) const {
 }
 
 void UnknownMap::Append(absl::string_view key, Slice value) {
-  unknown_.emplace_back(Slice::FromCopiedString(key), value.Ref());
+  auto interned = InternedMetadataKey::Intern(key);
+  if (interned.has_value()) {
+    key_mask_ |= interned->mask_bit();
+    unknown_.emplace_back(interned->slice(), value.Ref());
+  } else {
+    unknown_.emplace_back(Slice::FromCopiedString(key), value.Ref());
+  }
+}
+
+void UnknownMap::Append(const Slice& key, Slice value) {
+  auto interned = InternedMetadataKey::Intern(key.as_string_view());
+  if (interned.has_value()) {
+    key_mask_ |= interned->mask_bit();
+    unknown_.emplace_back(interned->slice(), value.Ref());
+  } else {
+    unknown_.emplace_back(key.AsOwned(), value.Ref());
+  }
 }
 
 void UnknownMap::Remove(absl::string_view key) {
@@ -129,6 +186,23 @@ std::optional<absl::string_view> UnknownMap::GetStringValue(
   return out;
 }
 
+std::optional<absl::string_view> UnknownMap::GetStringValue(
+    InternedMetadataKey key, std::string* backing) const {
+  if ((key_mask_ & key.mask_bit()) == 0) return std::nullopt;
+  std::optional<absl::string_view> out;
+  for (const auto& p : unknown_) {
+    // Interned keys are equal exactly when they share storage.
+    if (p.first.data() == reinterpret_cast<const uint8_t*>(key.key().data())) {
+      if (!out.has_value()) {
+        out = p.second.as_string_view();
+      } else {
+        out = *backing = absl::StrCat(*out, ",", p.second.as_string_view());
+      }
+    }
+  }
+  return out;
+}
+
 }  // namespace metadata_detail
 
 ContentTypeMetadata::MementoType ContentTypeMetadata::ParseMemento(
@@ -363,6 +437,10 @@ std::string GrpcStreamNetworkState::DisplayValue(ValueType x) {
   GPR_UNREACHABLE_CODE(return "unknown value");
 }
 
+std::string GrpcMetadataTemplate::DisplayValue(const ValueType& x) {
+  return absl::StrCat(x->entries().size(), " entries");
+}
+
 std::string GrpcRegisteredMethod::DisplayValue(void* x) {
   return absl::StrFormat("%p", x);
 }
@@ -29,6 +29,7 @@
 #include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "absl/container/inlined_vector.h"
 #include "absl/functional/function_ref.h"
@@ -41,11 +42,12 @@
 #include "src/core/lib/promise/poll.h"
 #include "src/core/lib/slice/slice.h"
 #include "src/core/lib/transport/custom_metadata.h"
+#include "src/core/lib/transport/interned_metadata_key.h"
+#include "src/core/lib/transport/metadata_template.h"
 #include "src/core/lib/transport/metadata_compression_traits.h"
 #include "src/core/lib/transport/parsed_metadata.h"
 #include "src/core/lib/transport/simple_slice_based_metadata.h"
 #include "src/core/util/chunked_vector.h"
-#include "src/core/util/if_list.h"
 #include "src/core/util/packed_table.h"
 #include "src/core/util/time.h"
 #include "src/core/util/type_list.h"
@@ -630,6 +632,26 @@ struct GrpcTarPit {
   static absl::string_view DisplayValue(Empty) { return "tarpit"; }
 };
 
+// Custom metadata sent from a shared MetadataTemplate, after the rest of the
+// batch. Transports that do not encode it themselves send its entries as
+// unknown metadata.
+struct GrpcMetadataTemplate {
+  static absl::string_view DebugKey() { return "GrpcMetadataTemplate"; }
+  static constexpr bool kRepeatable = false;
+  using ValueType = RefCountedPtr<MetadataTemplate>;
+  static std::string DisplayValue(const ValueType& x);
+};
+
+// Annotation added by filters to weight the share of its connection's writes
+// that a call gets, relative to the other calls on the connection. Calls
+// without it have weight 1.
+struct GrpcWriteWeight {
+  static absl::string_view DebugKey() { return "GrpcWriteWeight"; }
+  static constexpr bool kRepeatable = false;
+  using ValueType = uint32_t;
+  static std::string DisplayValue(uint32_t x) { return std::to_string(x); }
+};
+
 namespace metadata_detail {
 
 // Build a key/value formatted debug string.
@@ -687,24 +709,72 @@ struct EncodableTraits<void> {
   using List = Typelist<>;
 };
 
-template <typename Trait>
-struct EncodableNameLookupKeyComparison {
-  bool operator()(absl::string_view key) { return key == Trait::key(); }
+// Maps each of a fixed set of keys to its position in the set using a
+// perfect hash: one probe and one string comparison per lookup, rather than
+// comparing against every key in turn.
+class KeyIndex {
+ public:
+  explicit KeyIndex(std::vector<absl::string_view> keys);
+
+  // Returns the position of key in the set passed at construction, or -1.
+  int Find(absl::string_view key) const {
+    if (GPR_UNLIKELY(slots_.empty())) return FindSlow(key);
+    if (key.empty()) return -1;
+    const int index = slots_[Hash(key, seed_) & mask_];
+    if (index < 0 || keys_[index] != key) return -1;
+    return index;
+  }
+
+ private:
+  // Mixes the length and the first, middle and last bytes of the key.
+  static uint32_t Hash(absl::string_view key, uint32_t seed) {
+    uint32_t h = seed ^ static_cast<uint32_t>(key.size());
+    h = (h * 0x9e3779b1u) ^ static_cast<uint8_t>(key[0]);
+    h = (h * 0x9e3779b1u) ^ static_cast<uint8_t>(key[key.size() / 2]);
+    h = (h * 0x9e3779b1u) ^ static_cast<uint8_t>(key.back());
+    return h ^ (h >> 15);
+  }
+
+  // Used if no perfect hash could be found for the keys.
+  int FindSlow(absl::string_view key) const;
+
+  std::vector<absl::string_view> keys_;
+  // Index into keys_ for each hash slot, or -1 for an empty slot.
+  std::vector<int16_t> slots_;
+  uint32_t seed_ = 0;
+  uint32_t mask_ = 0;
 };
 
 template <typename Trait, typename Op>
-struct EncodableNameLookupOnFound {
-  auto operator()(Op* op) { return op->Found(Trait()); }
-};
+auto EncodableNameLookupOnFound(Op* op) {
+  return op->Found(Trait());
+}
 
 template <typename... Traits>
 struct EncodableNameLookup {
   template <typename Op>
   static auto Lookup(absl::string_view key, Op* op) {
-    return IfList(
-        key, op, [key](Op* op) { return op->NotFound(key); },
-        EncodableNameLookupKeyComparison<Traits>()...,
-        EncodableNameLookupOnFound<Traits, Op>()...);
+    using Result = decltype(op->NotFound(key));
+    using FoundFn = Result (*)(Op*);
+    static const FoundFn kFound[] = {
+        &EncodableNameLookupOnFound<Traits, Op>...};
+    const int index = Index().Find(key);
+    if (index < 0) return op->NotFound(key);
+    return kFound[index](op);
+  }
+
+ private:
+  static const KeyIndex& Index() {
+    static const KeyIndex* const index = new KeyIndex({Traits::key()...});
+    return *index;
+  }
+};
+
+template <>
+struct EncodableNameLookup<> {
+  template <typename Op>
+  static auto Lookup(absl::string_view key, Op* op) {
+    return op->NotFound(key);
   }
 };
 
@@ -1080,7 +1150,7 @@ class CopySink {
   }
 
   void Encode(const Slice& key, const Slice& value) {
-    dst_->unknown_.Append(key.as_string_view(), value.Ref());
+    dst_->unknown_.Append(key, value.Ref());
   }
 
  private:
@@ -1173,9 +1243,13 @@ class UnknownMap {
   using BackingType = std::vector<std::pair<Slice, Slice>>;
 
   void Append(absl::string_view key, Slice value);
+  // As above, but shares key rather than copying it where possible.
+  void Append(const Slice& key, Slice value);
   void Remove(absl::string_view key);
   std::optional<absl::string_view> GetStringValue(absl::string_view key,
                                                   std::string* backing) const;
+  std::optional<absl::string_view> GetStringValue(InternedMetadataKey key,
+                                                  std::string* backing) const;
 
   BackingType::const_iterator begin() const { return unknown_.cbegin(); }
   BackingType::const_iterator end() const { return unknown_.cend(); }
@@ -1192,11 +1266,18 @@ class UnknownMap {
 
   bool empty() const { return unknown_.empty(); }
   size_t size() const { return unknown_.size(); }
-  void Clear() { unknown_.clear(); }
+  void Clear() {
+    unknown_.clear();
+    key_mask_ = 0;
+  }
 
  private:
-  // Backing store for added metadata.
+  // Backing store for added metadata. Keys are interned where possible, in
+  // which case they point into the intern table.
   BackingType unknown_;
+  // Union of the mask bits of the interned keys added (bits of removed
+  // keys may linger).
+  uint64_t key_mask_ = 0;
 };
 
 // Given a factory template Factory, construct a type that derives from
@@ -1506,6 +1587,13 @@ class MetadataMap {
     return metadata_detail::NameLookup<Traits...>::Lookup(name, &helper);
   }
 
+  // Retrieve some unknown metadata by interned key: cheaper than by name for
+  // custom headers that have no trait, and only for those.
+  std::optional<absl::string_view> GetStringValue(InternedMetadataKey key,
+                                                  std::string* buffer) const {
+    return unknown_.GetStringValue(key, buffer);
+  }
+
   // Extract a piece of known metadata.
   // Returns nullopt if the metadata was not present, or the value if it was.
   // The same as:
@@ -1565,6 +1653,9 @@ class MetadataMap {
   void Clear();
   size_t TransportSize() const;
   Derived Copy() const;
+  // Appends a copy of the encodable fields, the ones a transport would send
+  // to the peer, to \a out. Slices are shared rather than copied.
+  void CopyEncodableTo(Derived* out) const;
   bool empty() const { return table_.empty() && unknown_.empty(); }
   size_t count() const { return table_.count() + unknown_.size(); }
 
@@ -1630,6 +1721,12 @@ Derived MetadataMap<Derived, Traits...>::Copy() const {
   return out;
 }
 
+template <class Derived, typename... Traits>
+void MetadataMap<Derived, Traits...>::CopyEncodableTo(Derived* out) const {
+  metadata_detail::CopySink<Derived> sink(out);
+  Encode(&sink);
+}
+
 }  // namespace grpc_core
 
 struct grpc_metadata_batch;
@@ -1657,7 +1754,8 @@ using grpc_metadata_batch_base = grpc_core::MetadataMap<
     grpc_core::GrpcStatusContext, grpc_core::GrpcStatusFromWire,
     grpc_core::GrpcCallWasCancelled, grpc_core::WaitForReady,
     grpc_core::IsTransparentRetry, grpc_core::GrpcTrailersOnly,
-    grpc_core::GrpcTarPit,
+    grpc_core::GrpcTarPit, grpc_core::GrpcWriteWeight,
+    grpc_core::GrpcMetadataTemplate,
     grpc_core::GrpcRegisteredMethod GRPC_CUSTOM_CLIENT_METADATA
         GRPC_CUSTOM_SERVER_METADATA>;
 
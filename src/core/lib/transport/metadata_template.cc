@@ -0,0 +1,69 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/transport/metadata_template.h"
+
+#include <grpc/support/port_platform.h>
+
+#include "absl/status/status.h"
+#include "absl/strings/match.h"
+#include "absl/strings/str_cat.h"
+
+namespace grpc_core {
+
+namespace {
+
+bool IsLegalKeyChar(char c) {
+  return (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '-' ||
+         c == '_' || c == '.';
+}
+
+absl::Status ValidateEntry(absl::string_view key, absl::string_view value) {
+  if (key.empty()) return absl::InvalidArgumentError("empty metadata key");
+  for (char c : key) {
+    if (!IsLegalKeyChar(c)) {
+      return absl::InvalidArgumentError(
+          absl::StrCat("illegal metadata key: ", key));
+    }
+  }
+  if (absl::StartsWith(key, "grpc-") || absl::EndsWith(key, "-bin")) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("metadata key not allowed in a template: ", key));
+  }
+  for (char c : value) {
+    if (c < 0x20 || c > 0x7e) {
+      return absl::InvalidArgumentError(
+          absl::StrCat("illegal value for metadata key: ", key));
+    }
+  }
+  return absl::OkStatus();
+}
+
+}  // namespace
+
+absl::StatusOr<RefCountedPtr<MetadataTemplate>> MetadataTemplate::Create(
+    absl::Span<const std::pair<absl::string_view, absl::string_view>>
+        entries) {
+  std::vector<std::pair<Slice, Slice>> slices;
+  slices.reserve(entries.size());
+  for (const auto& [key, value] : entries) {
+    absl::Status status = ValidateEntry(key, value);
+    if (!status.ok()) return status;
+    slices.emplace_back(Slice::FromCopiedString(key),
+                        Slice::FromCopiedString(value));
+  }
+  return MakeRefCounted<MetadataTemplate>(std::move(slices));
+}
+
+}  // namespace grpc_core
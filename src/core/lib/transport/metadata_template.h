@@ -0,0 +1,73 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_TRANSPORT_METADATA_TEMPLATE_H
+#define GRPC_SRC_CORE_LIB_TRANSPORT_METADATA_TEMPLATE_H
+
+#include <grpc/support/port_platform.h>
+
+#include <utility>
+#include <vector>
+
+#include "absl/base/call_once.h"
+#include "absl/functional/function_ref.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
+
+namespace grpc_core {
+
+// A frozen set of custom metadata that many calls send unchanged, such as the
+// headers a server attaches to every response of a method. It is built once
+// and attached to each call's metadata with the GrpcMetadataTemplate trait,
+// instead of appending its entries one by one, and a transport can encode it
+// once and send the same bytes on every call.
+//
+// Only plain custom metadata can go in a template: keys must be legal, not
+// reserved (pseudo headers and grpc- prefixed keys) and not binary, so that
+// the encoding does not depend on what the peer negotiated.
+class MetadataTemplate final : public RefCounted<MetadataTemplate> {
+ public:
+  static absl::StatusOr<RefCountedPtr<MetadataTemplate>> Create(
+      absl::Span<const std::pair<absl::string_view, absl::string_view>>
+          entries);
+
+  explicit MetadataTemplate(std::vector<std::pair<Slice, Slice>> entries)
+      : entries_(std::move(entries)) {}
+
+  absl::Span<const std::pair<Slice, Slice>> entries() const {
+    return entries_;
+  }
+
+  // Returns the transport's encoding of the template, computed by encode the
+  // first time this is called. Every transport that uses this must produce
+  // the same encoding.
+  const Slice& Encoded(
+      absl::FunctionRef<Slice(const MetadataTemplate&)> encode) const {
+    absl::call_once(encoded_once_, [&]() { encoded_ = encode(*this); });
+    return encoded_;
+  }
+
+ private:
+  const std::vector<std::pair<Slice, Slice>> entries_;
+  mutable absl::once_flag encoded_once_;
+  mutable Slice encoded_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_TRANSPORT_METADATA_TEMPLATE_H
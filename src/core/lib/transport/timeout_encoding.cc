@@ -90,77 +90,62 @@ Duration Timeout::AsDuration() const {
 }
 
 Slice Timeout::Encode() const {
-  char buf[10];
-  char* p = buf;
-  uint16_t n = value_;
-  int digits;
-  if (n >= 10000) {
-    digits = 5;
-  } else if (n >= 1000) {
-    digits = 4;
-  } else if (n >= 100) {
-    digits = 3;
-  } else if (n >= 10) {
-    digits = 2;
-  } else {
-    digits = 1;
-  }
-  switch (digits) {
-    case 5:
-      *p++ = '0' + n / 10000;
-      n %= 10000;
-      [[fallthrough]];
-    case 4:
-      *p++ = '0' + n / 1000;
-      n %= 1000;
-      [[fallthrough]];
-    case 3:
-      *p++ = '0' + n / 100;
-      n %= 100;
-      [[fallthrough]];
-    case 2:
-      *p++ = '0' + n / 10;
-      n %= 10;
-      [[fallthrough]];
-    case 1:
-      *p++ = '0' + n;
-  }
+  // Fill the buffer from the back: the unit (with any scale zeros) first, then
+  // the digits, so that no digit count is needed. At most 5 digits, 2 zeros
+  // and a unit.
+  char buf[8];
+  char* const end = buf + sizeof(buf);
+  char* p = end;
   switch (unit_) {
     case Unit::kNanoseconds:
-      *p++ = 'n';
+      *--p = 'n';
       break;
-    case Unit::kHundredMilliseconds:
-      *p++ = '0';
-      [[fallthrough]];
-    case Unit::kTenMilliseconds:
-      *p++ = '0';
-      [[fallthrough]];
     case Unit::kMilliseconds:
-      *p++ = 'm';
+      *--p = 'm';
+      break;
+    case Unit::kTenMilliseconds:
+      *--p = 'm';
+      *--p = '0';
+      break;
+    case Unit::kHundredMilliseconds:
+      *--p = 'm';
+      *--p = '0';
+      *--p = '0';
       break;
-    case Unit::kHundredSeconds:
-      *p++ = '0';
-      [[fallthrough]];
-    case Unit::kTenSeconds:
-      *p++ = '0';
-      [[fallthrough]];
     case Unit::kSeconds:
-      *p++ = 'S';
+      *--p = 'S';
+      break;
+    case Unit::kTenSeconds:
+      *--p = 'S';
+      *--p = '0';
+      break;
+    case Unit::kHundredSeconds:
+      *--p = 'S';
+      *--p = '0';
+      *--p = '0';
       break;
-    case Unit::kHundredMinutes:
-      *p++ = '0';
-      [[fallthrough]];
-    case Unit::kTenMinutes:
-      *p++ = '0';
-      [[fallthrough]];
     case Unit::kMinutes:
-      *p++ = 'M';
+      *--p = 'M';
+      break;
+    case Unit::kTenMinutes:
+      *--p = 'M';
+      *--p = '0';
+      break;
+    case Unit::kHundredMinutes:
+      *--p = 'M';
+      *--p = '0';
+      *--p = '0';
       break;
     case Unit::kHours:
-      *p++ = 'H';
+      *--p = 'H';
       break;
   }
-  return Slice::FromCopiedBuffer(buf, p - buf);
+  uint16_t n = value_;
+  do {
+    *--p = static_cast<char>('0' + n % 10);
+    n /= 10;
+  } while (n != 0);
+  return Slice::FromCopiedBuffer(p, end - p);
 }
 
 Timeout Timeout::FromMillis(int64_t millis) {
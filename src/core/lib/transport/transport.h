@@ -546,6 +546,13 @@ class Transport : public InternallyRefCounted<Transport> {
   // implementation of grpc_transport_perform_op
   virtual void PerformOp(grpc_transport_op* op) = 0;
 
+  // Returns the most streams the peer currently allows to be open at once,
+  // or nullopt if the transport does not limit them. May be called from any
+  // thread.
+  virtual std::optional<uint32_t> PeerMaxConcurrentStreams() const {
+    return std::nullopt;
+  }
+
   void StartConnectivityWatch(
       OrphanablePtr<ConnectivityStateWatcherInterface> watcher) {
     grpc_transport_op* op = grpc_make_transport_op(nullptr);
@@ -21,6 +21,7 @@
 #include <grpc/support/port_platform.h>
 #include <stdlib.h>
 
+#include <map>
 #include <memory>
 #include <optional>
 #include <utility>
@@ -57,6 +58,11 @@ class EndpointList::Endpoint::Helper final
 
   ~Helper() override { endpoint_.reset(DEBUG_LOCATION, "Helper"); }
 
+  // Routes the child policy's requests to a new owner.
+  void set_endpoint(RefCountedPtr<Endpoint> endpoint) {
+    endpoint_ = std::move(endpoint);
+  }
+
   RefCountedPtr<SubchannelInterface> CreateSubchannel(
       const grpc_resolved_address& address, const ChannelArgs& per_address_args,
       const ChannelArgs& args) override {
@@ -70,6 +76,7 @@ class EndpointList::Endpoint::Helper final
     if (!old_state.has_value()) {
       ++endpoint_->endpoint_list_->num_endpoints_seen_initial_state_;
     }
+    endpoint_->connectivity_status_ = status;
     endpoint_->picker_ = std::move(picker);
     endpoint_->OnStateUpdate(old_state, state, status);
   }
@@ -89,14 +96,41 @@ class EndpointList::Endpoint::Helper final
 absl::Status EndpointList::Endpoint::Init(
     const EndpointAddresses& addresses, const ChannelArgs& args,
     std::shared_ptr<WorkSerializer> work_serializer) {
+  addresses_ = addresses;
+  if (endpoint_list_->reusable_endpoints_ != nullptr) {
+    auto it = endpoint_list_->reusable_endpoints_->find(addresses);
+    if (it != endpoint_list_->reusable_endpoints_->end()) {
+      Endpoint* previous = it->second;
+      endpoint_list_->reusable_endpoints_->erase(it);
+      if (GPR_UNLIKELY(endpoint_list_->tracer_ != nullptr)) {
+        ABSL_LOG(INFO) << "[" << endpoint_list_->tracer_ << " "
+                       << endpoint_list_->policy_.get() << "] endpoint "
+                       << this << ": taking over child policy "
+                       << previous->child_policy_.get() << " from endpoint "
+                       << previous;
+      }
+      // Both lists belong to the same policy, so the pollset_set linkage
+      // carries over.
+      child_policy_ = std::move(previous->child_policy_);
+      helper_ = std::exchange(previous->helper_, nullptr);
+      helper_->set_endpoint(Ref(DEBUG_LOCATION, "Helper"));
+      if (previous->connectivity_state_.has_value()) {
+        helper_->UpdateState(*previous->connectivity_state_,
+                             previous->connectivity_status_,
+                             previous->picker_);
+      }
+      return absl::OkStatus();
+    }
+  }
   ChannelArgs child_args =
       args.Set(GRPC_ARG_INTERNAL_PICK_FIRST_ENABLE_HEALTH_CHECKING, true)
           .Set(GRPC_ARG_INTERNAL_PICK_FIRST_OMIT_STATUS_MESSAGE_PREFIX, true);
   LoadBalancingPolicy::Args lb_policy_args;
   lb_policy_args.work_serializer = std::move(work_serializer);
   lb_policy_args.args = child_args;
-  lb_policy_args.channel_control_helper =
-      std::make_unique<Helper>(Ref(DEBUG_LOCATION, "Helper"));
+  auto helper = std::make_unique<Helper>(Ref(DEBUG_LOCATION, "Helper"));
+  helper_ = helper.get();
+  lb_policy_args.channel_control_helper = std::move(helper);
   child_policy_ =
       CoreConfiguration::Get().lb_policy_registry().CreateLoadBalancingPolicy(
           "pick_first", std::move(lb_policy_args));
@@ -126,10 +160,12 @@ absl::Status EndpointList::Endpoint::Init(
 }
 
 void EndpointList::Endpoint::Orphan() {
-  // Remove pollset_set linkage.
-  grpc_pollset_set_del_pollset_set(
-      child_policy_->interested_parties(),
-      endpoint_list_->policy_->interested_parties());
+  // Remove pollset_set linkage, unless another endpoint took over the child.
+  if (child_policy_ != nullptr) {
+    grpc_pollset_set_del_pollset_set(
+        child_policy_->interested_parties(),
+        endpoint_list_->policy_->interested_parties());
+  }
   child_policy_.reset();
   picker_.reset();
   Unref();
@@ -166,12 +202,26 @@ void EndpointList::Init(
     absl::FunctionRef<OrphanablePtr<Endpoint>(RefCountedPtr<EndpointList>,
                                               const EndpointAddresses&,
                                               const ChannelArgs&)>
-        create_endpoint) {
+        create_endpoint,
+    absl::Span<EndpointList* const> previous_lists) {
+  args_ = args;
   if (endpoints == nullptr) return;
+  std::map<EndpointAddresses, Endpoint*> reusable_endpoints;
+  for (EndpointList* previous : previous_lists) {
+    if (previous == nullptr || previous->args_ != args) continue;
+    for (const auto& endpoint : previous->endpoints_) {
+      if (endpoint->child_policy_ != nullptr &&
+          endpoint->addresses_.has_value()) {
+        reusable_endpoints.emplace(*endpoint->addresses_, endpoint.get());
+      }
+    }
+  }
+  if (!reusable_endpoints.empty()) reusable_endpoints_ = &reusable_endpoints;
   endpoints->ForEach([&](const EndpointAddresses& endpoint) {
     endpoints_.push_back(
         create_endpoint(Ref(DEBUG_LOCATION, "Endpoint"), endpoint, args));
   });
+  reusable_endpoints_ = nullptr;
 }
 
 void EndpointList::ResetBackoffLocked() {
@@ -21,6 +21,7 @@
 #include <grpc/support/port_platform.h>
 #include <stdlib.h>
 
+#include <map>
 #include <memory>
 #include <optional>
 #include <utility>
@@ -28,6 +29,7 @@
 
 #include "absl/functional/function_ref.h"
 #include "absl/status/status.h"
+#include "absl/types/span.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/iomgr/resolved_address.h"
 #include "src/core/load_balancing/lb_policy.h"
@@ -45,6 +47,10 @@ namespace grpc_core {
 // have one or more addresses, which will be passed down to a pick_first
 // child policy.
 //
+// A list built for an update may take over the child policies of unchanged
+// endpoints from the lists it replaces, so that address churn only creates
+// and destroys children for the endpoints that were added or removed.
+//
 // To use this, a petiole policy must define its own subclass of both
 // EndpointList and EndpointList::Endpoint, like so:
 /*
@@ -125,6 +131,9 @@ class EndpointList : public InternallyRefCounted<EndpointList> {
     explicit Endpoint(RefCountedPtr<EndpointList> endpoint_list)
         : endpoint_list_(std::move(endpoint_list)) {}
 
+    // If the endpoint list is taking over children from previous lists and
+    // one of them has identical addresses, takes over its child policy and
+    // replays its last state through OnStateUpdate().
     absl::Status Init(const EndpointAddresses& addresses,
                       const ChannelArgs& args,
                       std::shared_ptr<WorkSerializer> work_serializer);
@@ -148,6 +157,8 @@ class EndpointList : public InternallyRefCounted<EndpointList> {
     size_t Index() const;
 
    private:
+    friend class EndpointList;
+
     class Helper;
 
     // Called when the child policy reports a connectivity state update.
@@ -162,8 +173,12 @@ class EndpointList : public InternallyRefCounted<EndpointList> {
 
     RefCountedPtr<EndpointList> endpoint_list_;
 
+    std::optional<EndpointAddresses> addresses_;
     OrphanablePtr<LoadBalancingPolicy> child_policy_;
+    // Owned by child_policy_.
+    Helper* helper_ = nullptr;
     std::optional<grpc_connectivity_state> connectivity_state_;
+    absl::Status connectivity_status_;
     RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker_;
   };
 
@@ -194,11 +209,18 @@ class EndpointList : public InternallyRefCounted<EndpointList> {
         resolution_note_(std::move(resolution_note)),
         tracer_(tracer) {}
 
+  // Endpoints identical to one in previous_lists, which were built with the
+  // same args, take over its child policy; earlier lists are preferred.
+  // Those endpoints then stop receiving state updates in the previous list,
+  // so the caller should replace it as soon as this list can take over.
+  // Only pass lists whose endpoints' CreateSubchannel() would behave the
+  // same as this one's.
   void Init(EndpointAddressesIterator* endpoints, const ChannelArgs& args,
             absl::FunctionRef<OrphanablePtr<Endpoint>(
                 RefCountedPtr<EndpointList>, const EndpointAddresses&,
                 const ChannelArgs&)>
-                create_endpoint);
+                create_endpoint,
+            absl::Span<EndpointList* const> previous_lists = {});
 
   // Templated for convenience, to provide a short-hand for down-casting
   // in the caller.
@@ -222,8 +244,12 @@ class EndpointList : public InternallyRefCounted<EndpointList> {
   RefCountedPtr<LoadBalancingPolicy> policy_;
   std::string resolution_note_;
   const char* tracer_;
+  ChannelArgs args_;
   std::vector<OrphanablePtr<Endpoint>> endpoints_;
   size_t num_endpoints_seen_initial_state_ = 0;
+  // Set during Init(): endpoints of the previous lists that may be taken
+  // over, by their addresses.
+  std::map<EndpointAddresses, Endpoint*>* reusable_endpoints_ = nullptr;
 };
 
 }  // namespace grpc_core
@@ -18,7 +18,6 @@
 
 #include "src/core/load_balancing/grpclb/grpclb_client_stats.h"
 
-#include <grpc/support/atm.h>
 #include <grpc/support/port_platform.h>
 #include <grpc/support/string_util.h>
 #include <string.h>
@@ -28,61 +27,89 @@
 namespace grpc_core {
 
 void GrpcLbClientStats::AddCallStarted() {
-  gpr_atm_full_fetch_add(&num_calls_started_, (gpr_atm)1);
+  stats_.this_cpu().num_calls_started.fetch_add(1, std::memory_order_relaxed);
 }
 
 void GrpcLbClientStats::AddCallFinished(
     bool finished_with_client_failed_to_send, bool finished_known_received) {
-  gpr_atm_full_fetch_add(&num_calls_finished_, (gpr_atm)1);
+  Stats& stats = stats_.this_cpu();
+  stats.num_calls_finished.fetch_add(1, std::memory_order_relaxed);
   if (finished_with_client_failed_to_send) {
-    gpr_atm_full_fetch_add(&num_calls_finished_with_client_failed_to_send_,
-                           (gpr_atm)1);
+    stats.num_calls_finished_with_client_failed_to_send.fetch_add(
+        1, std::memory_order_relaxed);
   }
   if (finished_known_received) {
-    gpr_atm_full_fetch_add(&num_calls_finished_known_received_, (gpr_atm)1);
+    stats.num_calls_finished_known_received.fetch_add(
+        1, std::memory_order_relaxed);
   }
 }
 
-void GrpcLbClientStats::AddCallDropped(const char* token) {
-  // Increment num_calls_started and num_calls_finished.
-  gpr_atm_full_fetch_add(&num_calls_started_, (gpr_atm)1);
-  gpr_atm_full_fetch_add(&num_calls_finished_, (gpr_atm)1);
-  // Record the drop.
-  MutexLock lock(&drop_count_mu_);
-  if (drop_token_counts_ == nullptr) {
-    drop_token_counts_ = std::make_unique<DroppedCallCounts>();
-  }
-  for (size_t i = 0; i < drop_token_counts_->size(); ++i) {
-    if (strcmp((*drop_token_counts_)[i].token.get(), token) == 0) {
-      ++(*drop_token_counts_)[i].count;
+namespace {
+
+// Adds `count` drops for `token` to `counts`.
+void AddDropTokenCount(const char* token, int64_t count,
+                       GrpcLbClientStats::DroppedCallCounts& counts) {
+  for (auto& drop_token_count : counts) {
+    if (strcmp(drop_token_count.token.get(), token) == 0) {
+      drop_token_count.count += count;
       return;
     }
   }
   // Not found, so add a new entry.
-  drop_token_counts_->emplace_back(UniquePtr<char>(gpr_strdup(token)), 1);
+  counts.emplace_back(UniquePtr<char>(gpr_strdup(token)), count);
 }
 
-namespace {
+}  // namespace
 
-void AtomicGetAndResetCounter(int64_t* value, gpr_atm* counter) {
-  *value = static_cast<int64_t>(gpr_atm_full_xchg(counter, (gpr_atm)0));
+void GrpcLbClientStats::AddCallDropped(const char* token) {
+  Stats& stats = stats_.this_cpu();
+  // Increment num_calls_started and num_calls_finished.
+  stats.num_calls_started.fetch_add(1, std::memory_order_relaxed);
+  stats.num_calls_finished.fetch_add(1, std::memory_order_relaxed);
+  // Record the drop.
+  MutexLock lock(&stats.drop_count_mu);
+  if (stats.drop_token_counts == nullptr) {
+    stats.drop_token_counts = std::make_unique<DroppedCallCounts>();
+  }
+  AddDropTokenCount(token, 1, *stats.drop_token_counts);
 }
 
-}  // namespace
-
 void GrpcLbClientStats::Get(
     int64_t* num_calls_started, int64_t* num_calls_finished,
     int64_t* num_calls_finished_with_client_failed_to_send,
     int64_t* num_calls_finished_known_received,
     std::unique_ptr<DroppedCallCounts>* drop_token_counts) {
-  AtomicGetAndResetCounter(num_calls_started, &num_calls_started_);
-  AtomicGetAndResetCounter(num_calls_finished, &num_calls_finished_);
-  AtomicGetAndResetCounter(num_calls_finished_with_client_failed_to_send,
-                           &num_calls_finished_with_client_failed_to_send_);
-  AtomicGetAndResetCounter(num_calls_finished_known_received,
-                           &num_calls_finished_known_received_);
-  MutexLock lock(&drop_count_mu_);
-  *drop_token_counts = std::move(drop_token_counts_);
+  *num_calls_started = 0;
+  *num_calls_finished = 0;
+  *num_calls_finished_with_client_failed_to_send = 0;
+  *num_calls_finished_known_received = 0;
+  drop_token_counts->reset();
+  for (Stats& stats : stats_) {
+    *num_calls_started +=
+        stats.num_calls_started.exchange(0, std::memory_order_relaxed);
+    *num_calls_finished +=
+        stats.num_calls_finished.exchange(0, std::memory_order_relaxed);
+    *num_calls_finished_with_client_failed_to_send +=
+        stats.num_calls_finished_with_client_failed_to_send.exchange(
+            0, std::memory_order_relaxed);
+    *num_calls_finished_known_received +=
+        stats.num_calls_finished_known_received.exchange(
+            0, std::memory_order_relaxed);
+    std::unique_ptr<DroppedCallCounts> shard_counts;
+    {
+      MutexLock lock(&stats.drop_count_mu);
+      shard_counts = std::move(stats.drop_token_counts);
+    }
+    if (shard_counts == nullptr) continue;
+    if (*drop_token_counts == nullptr) {
+      *drop_token_counts = std::move(shard_counts);
+      continue;
+    }
+    for (const auto& drop_token_count : *shard_counts) {
+      AddDropTokenCount(drop_token_count.token.get(), drop_token_count.count,
+                        **drop_token_counts);
+    }
+  }
 }
 
 }  // namespace grpc_core
@@ -19,16 +19,17 @@
 #ifndef GRPC_SRC_CORE_LOAD_BALANCING_GRPCLB_GRPCLB_CLIENT_STATS_H
 #define GRPC_SRC_CORE_LOAD_BALANCING_GRPCLB_GRPCLB_CLIENT_STATS_H
 
-#include <grpc/support/atm.h>
 #include <grpc/support/port_platform.h>
 #include <stdint.h>
 
+#include <atomic>
 #include <memory>
 #include <utility>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/container/inlined_vector.h"
 #include "src/core/util/memory.h"
+#include "src/core/util/per_cpu.h"
 #include "src/core/util/ref_counted.h"
 #include "src/core/util/sync.h"
 
@@ -64,13 +65,19 @@ class GrpcLbClientStats final : public RefCounted<GrpcLbClientStats> {
   }
 
  private:
-  gpr_atm num_calls_started_ = 0;
-  gpr_atm num_calls_finished_ = 0;
-  gpr_atm num_calls_finished_with_client_failed_to_send_ = 0;
-  gpr_atm num_calls_finished_known_received_ = 0;
-  Mutex drop_count_mu_;  // Guards drop_token_counts_.
-  std::unique_ptr<DroppedCallCounts> drop_token_counts_
-      ABSL_GUARDED_BY(drop_count_mu_);
+  // Sharded so that calls on different cpus, dropped ones in particular,
+  // don't contend; the shards are folded together by Get().
+  struct Stats {
+    std::atomic<int64_t> num_calls_started{0};
+    std::atomic<int64_t> num_calls_finished{0};
+    std::atomic<int64_t> num_calls_finished_with_client_failed_to_send{0};
+    std::atomic<int64_t> num_calls_finished_known_received{0};
+    Mutex drop_count_mu;  // Guards drop_token_counts.
+    std::unique_ptr<DroppedCallCounts> drop_token_counts
+        ABSL_GUARDED_BY(drop_count_mu);
+  };
+
+  PerCpu<Stats> stats_{PerCpuOptions().SetMaxShards(32).SetCpusPerShard(4)};
 };
 
 }  // namespace grpc_core
@@ -282,6 +282,11 @@ class LoadBalancingPolicy : public InternallyRefCounted<LoadBalancingPolicy> {
 
     virtual PickResult Pick(PickArgs args) = 0;
 
+    /// Returns true if every pick made with this picker will be queued,
+    /// whatever its args. The channel uses this to avoid retrying all of
+    /// its queued picks against a picker that cannot complete any of them.
+    virtual bool QueuesAllPicks() const { return false; }
+
    protected:
     void Orphaned() override {}
   };
@@ -446,6 +451,8 @@ class LoadBalancingPolicy : public InternallyRefCounted<LoadBalancingPolicy> {
 
     PickResult Pick(PickArgs args) override;
 
+    bool QueuesAllPicks() const override { return true; }
+
    private:
     Mutex mu_;
     RefCountedPtr<LoadBalancingPolicy> parent_ ABSL_GUARDED_BY(&mu_);
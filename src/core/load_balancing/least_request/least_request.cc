@@ -0,0 +1,738 @@
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/impl/connectivity_state.h>
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/log/absl_check.h"
+#include "absl/log/absl_log.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_join.h"
+#include "absl/strings/string_view.h"
+#include "src/core/config/core_configuration.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/debug/trace.h"
+#include "src/core/lib/iomgr/resolved_address.h"
+#include "src/core/lib/transport/connectivity_state.h"
+#include "src/core/load_balancing/backend_metric_data.h"
+#include "src/core/load_balancing/endpoint_list.h"
+#include "src/core/load_balancing/lb_policy.h"
+#include "src/core/load_balancing/lb_policy_factory.h"
+#include "src/core/load_balancing/oob_backend_metric.h"
+#include "src/core/load_balancing/subchannel_interface.h"
+#include "src/core/resolver/endpoint_addresses.h"
+#include "src/core/util/debug_location.h"
+#include "src/core/util/fast_random.h"
+#include "src/core/util/json/json.h"
+#include "src/core/util/json/json_args.h"
+#include "src/core/util/json/json_object_loader.h"
+#include "src/core/util/orphanable.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/time.h"
+#include "src/core/util/validation_errors.h"
+#include "src/core/util/work_serializer.h"
+
+// The least_request policy picks, for each call, the least loaded of a few
+// READY endpoints chosen at random ("power of two choices" for the default
+// of two).  An endpoint's load is the number of calls in flight to it, which
+// the picker keeps current with atomic counters, so the policy reacts to
+// uneven request costs as soon as calls start piling up on an endpoint
+// rather than at the next weight update.
+//
+// Optionally, the load is further scaled by the endpoint's ORCA-reported
+// utilization, taken from either per-call or out-of-band load reports.
+
+namespace grpc_core {
+
+namespace {
+
+constexpr absl::string_view kLeastRequest = "least_request";
+
+// Larger choice counts approach a full scan of the endpoints for little
+// further benefit.
+constexpr uint32_t kMaxChoiceCount = 10;
+
+// Config for least_request policy.
+class LeastRequestConfig final : public LoadBalancingPolicy::Config {
+ public:
+  LeastRequestConfig() = default;
+
+  LeastRequestConfig(const LeastRequestConfig&) = delete;
+  LeastRequestConfig& operator=(const LeastRequestConfig&) = delete;
+
+  LeastRequestConfig(LeastRequestConfig&&) = delete;
+  LeastRequestConfig& operator=(LeastRequestConfig&&) = delete;
+
+  absl::string_view name() const override { return kLeastRequest; }
+
+  uint32_t choice_count() const { return choice_count_; }
+  bool enable_orca_weighting() const { return enable_orca_weighting_; }
+  bool enable_oob_load_report() const { return enable_oob_load_report_; }
+  Duration oob_reporting_period() const { return oob_reporting_period_; }
+
+  static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
+    static const auto* loader =
+        JsonObjectLoader<LeastRequestConfig>()
+            .OptionalField("choiceCount", &LeastRequestConfig::choice_count_)
+            .OptionalField("enableOrcaWeighting",
+                           &LeastRequestConfig::enable_orca_weighting_)
+            .OptionalField("enableOobLoadReport",
+                           &LeastRequestConfig::enable_oob_load_report_)
+            .OptionalField("oobReportingPeriod",
+                           &LeastRequestConfig::oob_reporting_period_)
+            .Finish();
+    return loader;
+  }
+
+  void JsonPostLoad(const Json&, const JsonArgs&, ValidationErrors* errors) {
+    if (choice_count_ < 2) {
+      ValidationErrors::ScopedField field(errors, ".choiceCount");
+      errors->AddError("must be at least 2");
+    }
+    choice_count_ = std::min(choice_count_, kMaxChoiceCount);
+  }
+
+ private:
+  uint32_t choice_count_ = 2;
+  bool enable_orca_weighting_ = false;
+  bool enable_oob_load_report_ = false;
+  Duration oob_reporting_period_ = Duration::Seconds(10);
+};
+
+// least_request LB policy
+class LeastRequest final : public LoadBalancingPolicy {
+ public:
+  explicit LeastRequest(Args args);
+
+  absl::string_view name() const override { return kLeastRequest; }
+
+  absl::Status UpdateLocked(UpdateArgs args) override;
+  void ResetBackoffLocked() override;
+
+ private:
+  // The load on a given address, shared by every picker and endpoint list
+  // that includes it, so that it survives picker and address updates.
+  class EndpointState final : public RefCounted<EndpointState> {
+   public:
+    EndpointState(RefCountedPtr<LeastRequest> least_request,
+                  EndpointAddressSet key)
+        : least_request_(std::move(least_request)), key_(std::move(key)) {}
+    ~EndpointState() override;
+
+    void CallStarted() { in_flight_.fetch_add(1, std::memory_order_relaxed); }
+    void CallFinished() { in_flight_.fetch_sub(1, std::memory_order_relaxed); }
+
+    // Returns the number of calls in flight, scaled by utilization if
+    // use_utilization is true.
+    double Load(bool use_utilization) const;
+
+    void UpdateUtilization(const BackendMetricData& backend_metric_data);
+
+   private:
+    RefCountedPtr<LeastRequest> least_request_;
+    const EndpointAddressSet key_;
+
+    std::atomic<uint64_t> in_flight_{0};
+    std::atomic<double> utilization_{0};
+  };
+
+  class LeastRequestEndpointList final : public EndpointList {
+   public:
+    class LeastRequestEndpoint final : public Endpoint {
+     public:
+      LeastRequestEndpoint(RefCountedPtr<EndpointList> endpoint_list,
+                           const EndpointAddresses& addresses,
+                           const ChannelArgs& args,
+                           std::shared_ptr<WorkSerializer> work_serializer,
+                           std::vector<std::string>* errors)
+          : Endpoint(std::move(endpoint_list)),
+            state_(policy<LeastRequest>()->GetOrCreateEndpointState(
+                addresses.addresses())) {
+        absl::Status status = Init(addresses, args, std::move(work_serializer));
+        if (!status.ok()) {
+          errors->emplace_back(absl::StrCat("endpoint ", addresses.ToString(),
+                                            ": ", status.ToString()));
+        }
+      }
+
+      RefCountedPtr<EndpointState> state() const { return state_; }
+
+     private:
+      class OobWatcher final : public OobBackendMetricWatcher {
+       public:
+        explicit OobWatcher(RefCountedPtr<EndpointState> state)
+            : state_(std::move(state)) {}
+
+        void OnBackendMetricReport(
+            const BackendMetricData& backend_metric_data) override {
+          state_->UpdateUtilization(backend_metric_data);
+        }
+
+       private:
+        RefCountedPtr<EndpointState> state_;
+      };
+
+      RefCountedPtr<SubchannelInterface> CreateSubchannel(
+          const grpc_resolved_address& address,
+          const ChannelArgs& per_address_args,
+          const ChannelArgs& args) override;
+
+      // Called when the child policy reports a connectivity state update.
+      void OnStateUpdate(std::optional<grpc_connectivity_state> old_state,
+                         grpc_connectivity_state new_state,
+                         const absl::Status& status) override;
+
+      RefCountedPtr<EndpointState> state_;
+    };
+
+    LeastRequestEndpointList(RefCountedPtr<LeastRequest> least_request,
+                             EndpointAddressesIterator* endpoints,
+                             const ChannelArgs& args,
+                             std::string resolution_note,
+                             std::vector<std::string>* errors)
+        : EndpointList(std::move(least_request), std::move(resolution_note),
+                       GRPC_TRACE_FLAG_ENABLED(least_request_lb)
+                           ? "LeastRequestEndpointList"
+                           : nullptr) {
+      Init(endpoints, args,
+           [&](RefCountedPtr<EndpointList> endpoint_list,
+               const EndpointAddresses& addresses, const ChannelArgs& args) {
+             return MakeOrphanable<LeastRequestEndpoint>(
+                 std::move(endpoint_list), addresses, args,
+                 policy<LeastRequest>()->work_serializer(), errors);
+           });
+    }
+
+   private:
+    LoadBalancingPolicy::ChannelControlHelper* channel_control_helper()
+        const override {
+      return policy<LeastRequest>()->channel_control_helper();
+    }
+
+    // Updates the counters of children in each state when a
+    // child transitions from old_state to new_state.
+    void UpdateStateCountersLocked(
+        std::optional<grpc_connectivity_state> old_state,
+        grpc_connectivity_state new_state);
+
+    // Ensures that the right child list is used and then updates
+    // the policy's connectivity state based on the child list's
+    // state counters.
+    void MaybeUpdateAggregatedConnectivityStateLocked(
+        absl::Status status_for_tf);
+
+    std::string CountersString() const {
+      return absl::StrCat("num_children=", size(), " num_ready=", num_ready_,
+                          " num_connecting=", num_connecting_,
+                          " num_transient_failure=", num_transient_failure_);
+    }
+
+    size_t num_ready_ = 0;
+    size_t num_connecting_ = 0;
+    size_t num_transient_failure_ = 0;
+
+    absl::Status last_failure_;
+  };
+
+  // A picker that sends each call to the least loaded of choice_count
+  // randomly chosen READY endpoints.
+  class Picker final : public SubchannelPicker {
+   public:
+    Picker(LeastRequest* least_request,
+           LeastRequestEndpointList* endpoint_list);
+
+    PickResult Pick(PickArgs args) override;
+
+   private:
+    // Counts the call against its endpoint while it is in flight, and
+    // collects its utilization report if needed.
+    class SubchannelCallTracker final : public SubchannelCallTrackerInterface {
+     public:
+      SubchannelCallTracker(
+          RefCountedPtr<EndpointState> state, bool collect_utilization,
+          std::unique_ptr<SubchannelCallTrackerInterface> child_tracker)
+          : state_(std::move(state)),
+            collect_utilization_(collect_utilization),
+            child_tracker_(std::move(child_tracker)) {}
+
+      void Start() override;
+
+      void Finish(FinishArgs args) override;
+
+     private:
+      RefCountedPtr<EndpointState> state_;
+      const bool collect_utilization_;
+      std::unique_ptr<SubchannelCallTrackerInterface> child_tracker_;
+    };
+
+    // Info stored about each endpoint.
+    struct EndpointInfo {
+      EndpointInfo(RefCountedPtr<SubchannelPicker> picker,
+                   RefCountedPtr<EndpointState> state)
+          : picker(std::move(picker)), state(std::move(state)) {}
+
+      RefCountedPtr<SubchannelPicker> picker;
+      RefCountedPtr<EndpointState> state;
+    };
+
+    // Returns a uniformly chosen index into endpoints_.
+    size_t RandomIndex();
+
+    // Using pointer value only, no ref held -- do not dereference!
+    LeastRequest* least_request_;
+
+    const uint32_t choice_count_;
+    const bool use_utilization_;
+    const bool collect_utilization_;
+    std::vector<EndpointInfo> endpoints_;
+
+    std::atomic<uint64_t> random_state_;
+  };
+
+  ~LeastRequest() override;
+
+  void ShutdownLocked() override;
+
+  RefCountedPtr<EndpointState> GetOrCreateEndpointState(
+      const std::vector<grpc_resolved_address>& addresses);
+
+  RefCountedPtr<LeastRequestConfig> config_;
+
+  // List of endpoints.
+  OrphanablePtr<LeastRequestEndpointList> endpoint_list_;
+  // Latest pending endpoint list.
+  // When we get an updated address list, we create a new endpoint list
+  // for it here, and we wait to swap it into endpoint_list_ until the new
+  // list becomes READY.
+  OrphanablePtr<LeastRequestEndpointList> latest_pending_endpoint_list_;
+
+  Mutex endpoint_state_map_mu_;
+  std::map<EndpointAddressSet, EndpointState*> endpoint_state_map_
+      ABSL_GUARDED_BY(&endpoint_state_map_mu_);
+
+  bool shutdown_ = false;
+};
+
+//
+// LeastRequest::EndpointState
+//
+
+LeastRequest::EndpointState::~EndpointState() {
+  MutexLock lock(&least_request_->endpoint_state_map_mu_);
+  auto it = least_request_->endpoint_state_map_.find(key_);
+  if (it != least_request_->endpoint_state_map_.end() && it->second == this) {
+    least_request_->endpoint_state_map_.erase(it);
+  }
+}
+
+double LeastRequest::EndpointState::Load(bool use_utilization) const {
+  double in_flight = in_flight_.load(std::memory_order_relaxed);
+  if (!use_utilization) return in_flight;
+  // Count an idle endpoint's utilization too, so that of two endpoints
+  // with no calls in flight the less utilized one is picked.
+  return (in_flight + 1) * (1 + utilization_.load(std::memory_order_relaxed));
+}
+
+void LeastRequest::EndpointState::UpdateUtilization(
+    const BackendMetricData& backend_metric_data) {
+  double utilization = backend_metric_data.application_utilization;
+  if (utilization <= 0) utilization = backend_metric_data.cpu_utilization;
+  // Endpoints without reports are treated as unutilized.  Capping the
+  // utilization bounds how much less often a busy endpoint may be picked,
+  // so that an endpoint whose last report was high keeps getting the
+  // occasional call with which to report that it has recovered.
+  utilization = std::clamp(utilization, 0.0, 1.0);
+  GRPC_TRACE_LOG(least_request_lb, INFO)
+      << "[least_request " << least_request_.get() << "] endpoint "
+      << key_.ToString() << ": utilization=" << utilization;
+  utilization_.store(utilization, std::memory_order_relaxed);
+}
+
+//
+// LeastRequest::Picker::SubchannelCallTracker
+//
+
+void LeastRequest::Picker::SubchannelCallTracker::Start() {
+  // Count the call here rather than when it was picked: picks that never
+  // start a call get no Finish() to undo the count.
+  state_->CallStarted();
+  if (child_tracker_ != nullptr) child_tracker_->Start();
+}
+
+void LeastRequest::Picker::SubchannelCallTracker::Finish(FinishArgs args) {
+  if (child_tracker_ != nullptr) child_tracker_->Finish(args);
+  state_->CallFinished();
+  if (!collect_utilization_) return;
+  auto* backend_metric_data =
+      args.backend_metric_accessor->GetBackendMetricData();
+  if (backend_metric_data != nullptr) {
+    state_->UpdateUtilization(*backend_metric_data);
+  }
+}
+
+//
+// LeastRequest::Picker
+//
+
+LeastRequest::Picker::Picker(LeastRequest* least_request,
+                             LeastRequestEndpointList* endpoint_list)
+    : least_request_(least_request),
+      choice_count_(least_request->config_->choice_count()),
+      use_utilization_(least_request->config_->enable_orca_weighting()),
+      collect_utilization_(use_utilization_ &&
+                           !least_request->config_->enable_oob_load_report()),
+      random_state_(FastRandom::Next()) {
+  for (auto& endpoint : endpoint_list->endpoints()) {
+    auto* ep = static_cast<LeastRequestEndpointList::LeastRequestEndpoint*>(
+        endpoint.get());
+    if (ep->connectivity_state() == GRPC_CHANNEL_READY) {
+      endpoints_.emplace_back(ep->picker(), ep->state());
+    }
+  }
+  GRPC_TRACE_LOG(least_request_lb, INFO)
+      << "[least_request " << least_request_ << " picker " << this
+      << "] created picker from endpoint_list=" << endpoint_list << " with "
+      << endpoints_.size() << " READY endpoints";
+}
+
+size_t LeastRequest::Picker::RandomIndex() {
+  // A splitmix64 generator, whose state a single atomic add advances, so
+  // that concurrent picks need no lock.
+  uint64_t z = random_state_.fetch_add(0x9e3779b97f4a7c15,
+                                       std::memory_order_relaxed) +
+               0x9e3779b97f4a7c15;
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+  z ^= z >> 31;
+  return z % endpoints_.size();
+}
+
+LeastRequest::PickResult LeastRequest::Picker::Pick(PickArgs args) {
+  EndpointInfo* endpoint_info = &endpoints_[0];
+  if (endpoints_.size() > 1) {
+    endpoint_info = &endpoints_[RandomIndex()];
+    double load = endpoint_info->state->Load(use_utilization_);
+    for (uint32_t i = 1; i < choice_count_; ++i) {
+      EndpointInfo* candidate = &endpoints_[RandomIndex()];
+      double candidate_load = candidate->state->Load(use_utilization_);
+      if (candidate_load < load) {
+        endpoint_info = candidate;
+        load = candidate_load;
+      }
+    }
+  }
+  GRPC_TRACE_LOG(least_request_lb, INFO)
+      << "[least_request " << least_request_ << " picker " << this
+      << "] returning index " << endpoint_info - endpoints_.data()
+      << ", picker=" << endpoint_info->picker.get();
+  auto result = endpoint_info->picker->Pick(args);
+  auto* complete = std::get_if<PickResult::Complete>(&result.result);
+  if (complete != nullptr) {
+    complete->subchannel_call_tracker = std::make_unique<SubchannelCallTracker>(
+        endpoint_info->state, collect_utilization_,
+        std::move(complete->subchannel_call_tracker));
+  }
+  return result;
+}
+
+//
+// LeastRequest
+//
+
+LeastRequest::LeastRequest(Args args) : LoadBalancingPolicy(std::move(args)) {
+  GRPC_TRACE_LOG(least_request_lb, INFO)
+      << "[least_request " << this << "] Created";
+}
+
+LeastRequest::~LeastRequest() {
+  GRPC_TRACE_LOG(least_request_lb, INFO)
+      << "[least_request " << this << "] Destroying least_request policy";
+  ABSL_CHECK(endpoint_list_ == nullptr);
+  ABSL_CHECK(latest_pending_endpoint_list_ == nullptr);
+}
+
+void LeastRequest::ShutdownLocked() {
+  GRPC_TRACE_LOG(least_request_lb, INFO)
+      << "[least_request " << this << "] Shutting down";
+  shutdown_ = true;
+  endpoint_list_.reset();
+  latest_pending_endpoint_list_.reset();
+}
+
+void LeastRequest::ResetBackoffLocked() {
+  endpoint_list_->ResetBackoffLocked();
+  if (latest_pending_endpoint_list_ != nullptr) {
+    latest_pending_endpoint_list_->ResetBackoffLocked();
+  }
+}
+
+absl::Status LeastRequest::UpdateLocked(UpdateArgs args) {
+  config_ = args.config.TakeAsSubclass<LeastRequestConfig>();
+  EndpointAddressesIterator* addresses = nullptr;
+  if (args.addresses.ok()) {
+    GRPC_TRACE_LOG(least_request_lb, INFO)
+        << "[least_request " << this << "] received update";
+    addresses = args.addresses->get();
+  } else {
+    GRPC_TRACE_LOG(least_request_lb, INFO)
+        << "[least_request " << this
+        << "] received update with address error: " << args.addresses.status();
+    // If we already have an endpoint list, then keep using the existing
+    // list, but still report back that the update was not accepted.
+    if (endpoint_list_ != nullptr) return args.addresses.status();
+  }
+  // Create new endpoint list, replacing the previous pending list, if any.
+  if (GRPC_TRACE_FLAG_ENABLED(least_request_lb) &&
+      latest_pending_endpoint_list_ != nullptr) {
+    ABSL_LOG(INFO) << "[least_request " << this
+                   << "] replacing previous pending endpoint list "
+                   << latest_pending_endpoint_list_.get();
+  }
+  std::vector<std::string> errors;
+  latest_pending_endpoint_list_ = MakeOrphanable<LeastRequestEndpointList>(
+      RefAsSubclass<LeastRequest>(DEBUG_LOCATION, "LeastRequestEndpointList"),
+      addresses, args.args, std::move(args.resolution_note), &errors);
+  // If the new list is empty, immediately promote it to
+  // endpoint_list_ and report TRANSIENT_FAILURE.
+  if (latest_pending_endpoint_list_->size() == 0) {
+    if (GRPC_TRACE_FLAG_ENABLED(least_request_lb) &&
+        endpoint_list_ != nullptr) {
+      ABSL_LOG(INFO) << "[least_request " << this
+                     << "] replacing previous endpoint list "
+                     << endpoint_list_.get();
+    }
+    endpoint_list_ = std::move(latest_pending_endpoint_list_);
+    absl::Status status = args.addresses.ok()
+                              ? absl::UnavailableError("empty address list")
+                              : args.addresses.status();
+    endpoint_list_->ReportTransientFailure(status);
+    return status;
+  }
+  // Otherwise, if this is the initial update, immediately promote it to
+  // endpoint_list_.
+  if (endpoint_list_ == nullptr) {
+    endpoint_list_ = std::move(latest_pending_endpoint_list_);
+  }
+  if (!errors.empty()) {
+    return absl::UnavailableError(absl::StrCat(
+        "errors from children: [", absl::StrJoin(errors, "; "), "]"));
+  }
+  return absl::OkStatus();
+}
+
+RefCountedPtr<LeastRequest::EndpointState>
+LeastRequest::GetOrCreateEndpointState(
+    const std::vector<grpc_resolved_address>& addresses) {
+  EndpointAddressSet key(addresses);
+  MutexLock lock(&endpoint_state_map_mu_);
+  auto it = endpoint_state_map_.find(key);
+  if (it != endpoint_state_map_.end()) {
+    auto state = it->second->RefIfNonZero();
+    if (state != nullptr) return state;
+  }
+  auto state = MakeRefCounted<EndpointState>(
+      RefAsSubclass<LeastRequest>(DEBUG_LOCATION, "EndpointState"), key);
+  endpoint_state_map_.insert_or_assign(key, state.get());
+  return state;
+}
+
+//
+// LeastRequest::LeastRequestEndpointList::LeastRequestEndpoint
+//
+
+RefCountedPtr<SubchannelInterface>
+LeastRequest::LeastRequestEndpointList::LeastRequestEndpoint::CreateSubchannel(
+    const grpc_resolved_address& address, const ChannelArgs& per_address_args,
+    const ChannelArgs& args) {
+  auto* least_request = policy<LeastRequest>();
+  auto subchannel = least_request->channel_control_helper()->CreateSubchannel(
+      address, per_address_args, args);
+  // Start OOB watch if configured.
+  if (least_request->config_->enable_orca_weighting() &&
+      least_request->config_->enable_oob_load_report()) {
+    subchannel->AddDataWatcher(MakeOobBackendMetricWatcher(
+        least_request->config_->oob_reporting_period(),
+        std::make_unique<OobWatcher>(state_)));
+  }
+  return subchannel;
+}
+
+void LeastRequest::LeastRequestEndpointList::LeastRequestEndpoint::
+    OnStateUpdate(std::optional<grpc_connectivity_state> old_state,
+                  grpc_connectivity_state new_state,
+                  const absl::Status& status) {
+  auto* lr_endpoint_list = endpoint_list<LeastRequestEndpointList>();
+  auto* least_request = policy<LeastRequest>();
+  GRPC_TRACE_LOG(least_request_lb, INFO)
+      << "[least_request " << least_request << "] connectivity changed for "
+      << "child " << this << ", endpoint_list " << lr_endpoint_list
+      << " (index " << Index() << " of " << lr_endpoint_list->size()
+      << "): prev_state="
+      << (old_state.has_value() ? ConnectivityStateName(*old_state) : "N/A")
+      << " new_state=" << ConnectivityStateName(new_state) << " (" << status
+      << ")";
+  if (new_state == GRPC_CHANNEL_IDLE) {
+    GRPC_TRACE_LOG(least_request_lb, INFO)
+        << "[least_request " << least_request << "] child " << this
+        << " reported IDLE; requesting connection";
+    ExitIdleLocked();
+  }
+  // If state changed, update state counters.
+  if (!old_state.has_value() || *old_state != new_state) {
+    lr_endpoint_list->UpdateStateCountersLocked(old_state, new_state);
+  }
+  // Update the policy state.
+  lr_endpoint_list->MaybeUpdateAggregatedConnectivityStateLocked(status);
+}
+
+//
+// LeastRequest::LeastRequestEndpointList
+//
+
+void LeastRequest::LeastRequestEndpointList::UpdateStateCountersLocked(
+    std::optional<grpc_connectivity_state> old_state,
+    grpc_connectivity_state new_state) {
+  // We treat IDLE the same as CONNECTING, since it will immediately
+  // transition into that state anyway.
+  if (old_state.has_value()) {
+    ABSL_CHECK(*old_state != GRPC_CHANNEL_SHUTDOWN);
+    if (*old_state == GRPC_CHANNEL_READY) {
+      ABSL_CHECK_GT(num_ready_, 0u);
+      --num_ready_;
+    } else if (*old_state == GRPC_CHANNEL_CONNECTING ||
+               *old_state == GRPC_CHANNEL_IDLE) {
+      ABSL_CHECK_GT(num_connecting_, 0u);
+      --num_connecting_;
+    } else if (*old_state == GRPC_CHANNEL_TRANSIENT_FAILURE) {
+      ABSL_CHECK_GT(num_transient_failure_, 0u);
+      --num_transient_failure_;
+    }
+  }
+  ABSL_CHECK(new_state != GRPC_CHANNEL_SHUTDOWN);
+  if (new_state == GRPC_CHANNEL_READY) {
+    ++num_ready_;
+  } else if (new_state == GRPC_CHANNEL_CONNECTING ||
+             new_state == GRPC_CHANNEL_IDLE) {
+    ++num_connecting_;
+  } else if (new_state == GRPC_CHANNEL_TRANSIENT_FAILURE) {
+    ++num_transient_failure_;
+  }
+}
+
+void LeastRequest::LeastRequestEndpointList::
+    MaybeUpdateAggregatedConnectivityStateLocked(absl::Status status_for_tf) {
+  auto* least_request = policy<LeastRequest>();
+  // If this is latest_pending_endpoint_list_, then swap it into
+  // endpoint_list_ in the following cases:
+  // - endpoint_list_ has no READY children.
+  // - This list has at least one READY child and we have seen the
+  //   initial connectivity state notification for all children.
+  // - All of the children in this list are in TRANSIENT_FAILURE.
+  //   (This may cause the channel to go from READY to TRANSIENT_FAILURE,
+  //   but we're doing what the control plane told us to do.)
+  if (least_request->latest_pending_endpoint_list_.get() == this &&
+      (least_request->endpoint_list_->num_ready_ == 0 ||
+       (num_ready_ > 0 && AllEndpointsSeenInitialState()) ||
+       num_transient_failure_ == size())) {
+    if (GRPC_TRACE_FLAG_ENABLED(least_request_lb)) {
+      ABSL_LOG(INFO) << "[least_request " << least_request
+                     << "] swapping out endpoint list "
+                     << least_request->endpoint_list_.get() << " ("
+                     << least_request->endpoint_list_->CountersString()
+                     << ") in favor of " << this << " (" << CountersString()
+                     << ")";
+    }
+    least_request->endpoint_list_ =
+        std::move(least_request->latest_pending_endpoint_list_);
+  }
+  // Only set connectivity state if this is the current endpoint list.
+  if (least_request->endpoint_list_.get() != this) return;
+  // First matching rule wins:
+  // 1) ANY child is READY => policy is READY.
+  // 2) ANY child is CONNECTING => policy is CONNECTING.
+  // 3) ALL children are TRANSIENT_FAILURE => policy is TRANSIENT_FAILURE.
+  if (num_ready_ > 0) {
+    GRPC_TRACE_LOG(least_request_lb, INFO)
+        << "[least_request " << least_request
+        << "] reporting READY with endpoint list " << this;
+    least_request->channel_control_helper()->UpdateState(
+        GRPC_CHANNEL_READY, absl::OkStatus(),
+        MakeRefCounted<Picker>(least_request, this));
+  } else if (num_connecting_ > 0) {
+    GRPC_TRACE_LOG(least_request_lb, INFO)
+        << "[least_request " << least_request
+        << "] reporting CONNECTING with endpoint list " << this;
+    least_request->channel_control_helper()->UpdateState(
+        GRPC_CHANNEL_CONNECTING, absl::OkStatus(),
+        MakeRefCounted<QueuePicker>(nullptr));
+  } else if (num_transient_failure_ == size()) {
+    GRPC_TRACE_LOG(least_request_lb, INFO)
+        << "[least_request " << least_request
+        << "] reporting TRANSIENT_FAILURE with endpoint list " << this << ": "
+        << status_for_tf;
+    if (!status_for_tf.ok()) {
+      last_failure_ = absl::UnavailableError(
+          absl::StrCat("connections to all backends failing; last error: ",
+                       status_for_tf.ToString()));
+    }
+    ReportTransientFailure(last_failure_);
+  }
+}
+
+//
+// factory
+//
+
+class LeastRequestFactory final : public LoadBalancingPolicyFactory {
+ public:
+  OrphanablePtr<LoadBalancingPolicy> CreateLoadBalancingPolicy(
+      LoadBalancingPolicy::Args args) const override {
+    return MakeOrphanable<LeastRequest>(std::move(args));
+  }
+
+  absl::string_view name() const override { return kLeastRequest; }
+
+  absl::StatusOr<RefCountedPtr<LoadBalancingPolicy::Config>>
+  ParseLoadBalancingConfig(const Json& json) const override {
+    return LoadFromJson<RefCountedPtr<LeastRequestConfig>>(
+        json, JsonArgs(), "errors validating least_request LB policy config");
+  }
+};
+
+}  // namespace
+
+void RegisterLeastRequestLbPolicy(CoreConfiguration::Builder* builder) {
+  builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
+      std::make_unique<LeastRequestFactory>());
+}
+
+}  // namespace grpc_core
@@ -19,6 +19,7 @@
 #include <grpc/event_engine/event_engine.h>
 #include <grpc/impl/connectivity_state.h>
 #include <grpc/support/port_platform.h>
+#include <grpc/support/time.h>
 #include <inttypes.h>
 #include <stddef.h>
 
@@ -67,6 +68,7 @@
 #include "src/core/util/ref_counted.h"
 #include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/sync.h"
+#include "src/core/util/tdigest.h"
 #include "src/core/util/unique_type_name.h"
 #include "src/core/util/validation_errors.h"
 #include "src/core/util/work_serializer.h"
@@ -80,6 +82,9 @@ using ::grpc_event_engine::experimental::EventEngine;
 constexpr absl::string_view kOutlierDetection =
     "outlier_detection_experimental";
 
+// Compression of the per-endpoint latency digests used by latency ejection.
+constexpr double kLatencyDigestCompression = 100;
+
 // Config for xDS Cluster Impl LB policy.
 class OutlierDetectionLbConfig final : public LoadBalancingPolicy::Config {
  public:
@@ -93,7 +98,12 @@ class OutlierDetectionLbConfig final : public LoadBalancingPolicy::Config {
 
   bool CountingEnabled() const {
     return outlier_detection_config_.success_rate_ejection.has_value() ||
-           outlier_detection_config_.failure_percentage_ejection.has_value();
+           outlier_detection_config_.failure_percentage_ejection.has_value() ||
+           LatencyTrackingEnabled();
+  }
+
+  bool LatencyTrackingEnabled() const {
+    return outlier_detection_config_.latency_ejection.has_value();
   }
 
   const OutlierDetectionConfig& outlier_detection_config() const {
@@ -285,6 +295,9 @@ class OutlierDetectionLb final : public LoadBalancingPolicy {
       backup_bucket_->failures = 0;
       current_bucket_.swap(backup_bucket_);
       active_bucket_.store(current_bucket_.get());
+      MutexLock lock(&latency_mu_);
+      current_latencies_.Swap(backup_latencies_);
+      current_latencies_.Reset(kLatencyDigestCompression);
     }
 
     std::optional<std::pair<double, uint64_t>> GetSuccessRateAndVolume() {
@@ -304,6 +317,21 @@ class OutlierDetectionLb final : public LoadBalancingPolicy {
 
     void AddFailureCount() { active_bucket_.load()->failures.fetch_add(1); }
 
+    // Returns the latency in milliseconds at quantile over the last
+    // interval, and the number of calls it is based on.
+    std::optional<std::pair<double, uint64_t>> GetLatencyAndVolume(
+        double quantile) {
+      MutexLock lock(&latency_mu_);
+      if (backup_latencies_.Count() == 0) return std::nullopt;
+      return {{backup_latencies_.Quantile(quantile),
+               backup_latencies_.Count()}};
+    }
+
+    void AddLatency(double latency_ms) {
+      MutexLock lock(&latency_mu_);
+      current_latencies_.Add(latency_ms);
+    }
+
     std::optional<Timestamp> ejection_time() const { return ejection_time_; }
 
     void Eject(const Timestamp& time) {
@@ -360,6 +388,12 @@ class OutlierDetectionLb final : public LoadBalancingPolicy {
     // The bucket used to update call counts.
     // Points to either current_bucket or active_bucket.
     std::atomic<Bucket*> active_bucket_{current_bucket_.get()};
+    // Latencies of successful calls, rotated along with the buckets.
+    Mutex latency_mu_;
+    TDigest current_latencies_ ABSL_GUARDED_BY(latency_mu_){
+        kLatencyDigestCompression};
+    TDigest backup_latencies_ ABSL_GUARDED_BY(latency_mu_){
+        kLatencyDigestCompression};
     uint32_t multiplier_ = 0;
     std::optional<Timestamp> ejection_time_;
   };
@@ -368,7 +402,8 @@ class OutlierDetectionLb final : public LoadBalancingPolicy {
   class Picker final : public SubchannelPicker {
    public:
     Picker(OutlierDetectionLb* outlier_detection_lb,
-           RefCountedPtr<SubchannelPicker> picker, bool counting_enabled);
+           RefCountedPtr<SubchannelPicker> picker, bool counting_enabled,
+           bool latency_tracking_enabled);
 
     PickResult Pick(PickArgs args) override;
 
@@ -376,6 +411,7 @@ class OutlierDetectionLb final : public LoadBalancingPolicy {
     class SubchannelCallTracker;
     RefCountedPtr<SubchannelPicker> picker_;
     bool counting_enabled_;
+    bool latency_tracking_enabled_;
   };
 
   class Helper final
@@ -484,17 +520,20 @@ class OutlierDetectionLb::Picker::SubchannelCallTracker final
   SubchannelCallTracker(
       std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>
           original_subchannel_call_tracker,
-      RefCountedPtr<EndpointState> endpoint_state)
+      RefCountedPtr<EndpointState> endpoint_state,
+      bool latency_tracking_enabled)
       : original_subchannel_call_tracker_(
             std::move(original_subchannel_call_tracker)),
-        endpoint_state_(std::move(endpoint_state)) {}
+        endpoint_state_(std::move(endpoint_state)),
+        latency_tracking_enabled_(latency_tracking_enabled) {}
 
   ~SubchannelCallTracker() override {
     endpoint_state_.reset(DEBUG_LOCATION, "SubchannelCallTracker");
   }
 
   void Start() override {
-    // This tracker does not care about started calls only finished calls.
+    // Started calls only matter for timing latency.
+    if (latency_tracking_enabled_) start_time_ = gpr_now(GPR_CLOCK_MONOTONIC);
     // Delegate if needed.
     if (original_subchannel_call_tracker_ != nullptr) {
       original_subchannel_call_tracker_->Start();
@@ -510,6 +549,12 @@ class OutlierDetectionLb::Picker::SubchannelCallTracker final
     // calculations.
     if (args.status.ok()) {
       endpoint_state_->AddSuccessCount();
+      if (start_time_.has_value()) {
+        endpoint_state_->AddLatency(
+            gpr_timespec_to_micros(
+                gpr_time_sub(gpr_now(GPR_CLOCK_MONOTONIC), *start_time_)) /
+            1000);
+      }
     } else {
       endpoint_state_->AddFailureCount();
     }
@@ -519,6 +564,8 @@ class OutlierDetectionLb::Picker::SubchannelCallTracker final
   std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>
       original_subchannel_call_tracker_;
   RefCountedPtr<EndpointState> endpoint_state_;
+  const bool latency_tracking_enabled_;
+  std::optional<gpr_timespec> start_time_;
 };
 
 //
@@ -527,8 +574,11 @@ class OutlierDetectionLb::Picker::SubchannelCallTracker final
 
 OutlierDetectionLb::Picker::Picker(OutlierDetectionLb* outlier_detection_lb,
                                    RefCountedPtr<SubchannelPicker> picker,
-                                   bool counting_enabled)
-    : picker_(std::move(picker)), counting_enabled_(counting_enabled) {
+                                   bool counting_enabled,
+                                   bool latency_tracking_enabled)
+    : picker_(std::move(picker)),
+      counting_enabled_(counting_enabled),
+      latency_tracking_enabled_(latency_tracking_enabled) {
   GRPC_TRACE_LOG(outlier_detection_lb, INFO)
       << "[outlier_detection_lb " << outlier_detection_lb
       << "] constructed new picker " << this << " and counting " << "is "
@@ -555,7 +605,7 @@ LoadBalancingPolicy::PickResult OutlierDetectionLb::Picker::Pick(
         complete_pick->subchannel_call_tracker =
             std::make_unique<SubchannelCallTracker>(
                 std::move(complete_pick->subchannel_call_tracker),
-                std::move(endpoint_state));
+                std::move(endpoint_state), latency_tracking_enabled_);
       }
     }
     // Unwrap subchannel to pass back up the stack.
@@ -740,7 +790,8 @@ absl::Status OutlierDetectionLb::UpdateLocked(UpdateArgs args) {
 void OutlierDetectionLb::MaybeUpdatePickerLocked() {
   if (picker_ != nullptr) {
     auto outlier_detection_picker =
-        MakeRefCounted<Picker>(this, picker_, config_->CountingEnabled());
+        MakeRefCounted<Picker>(this, picker_, config_->CountingEnabled(),
+                               config_->LatencyTrackingEnabled());
     GRPC_TRACE_LOG(outlier_detection_lb, INFO)
         << "[outlier_detection_lb " << this
         << "] updating connectivity: state=" << ConnectivityStateName(state_)
@@ -856,6 +907,7 @@ void OutlierDetectionLb::EjectionTimer::OnTimerLocked() {
       << "] ejection timer running";
   std::map<EndpointState*, double> success_rate_ejection_candidates;
   std::map<EndpointState*, double> failure_percentage_ejection_candidates;
+  std::map<EndpointState*, double> latency_ejection_candidates;
   size_t ejected_host_count = 0;
   double success_rate_sum = 0;
   auto time_now = Timestamp::Now();
@@ -867,6 +919,16 @@ void OutlierDetectionLb::EjectionTimer::OnTimerLocked() {
     // Gather data to run success rate algorithm or failure percentage
     // algorithm.
     if (endpoint_state->ejection_time().has_value()) ++ejected_host_count;
+    if (config.latency_ejection.has_value()) {
+      auto latency_and_volume = endpoint_state->GetLatencyAndVolume(
+          config.latency_ejection->percentile / 100.0);
+      if (latency_and_volume.has_value() &&
+          latency_and_volume->second >=
+              config.latency_ejection->request_volume) {
+        latency_ejection_candidates[endpoint_state.get()] =
+            latency_and_volume->first;
+      }
+    }
     std::optional<std::pair<double, uint64_t>> host_success_rate_and_volume =
         endpoint_state->GetSuccessRateAndVolume();
     if (!host_success_rate_and_volume.has_value()) continue;
@@ -991,6 +1053,58 @@ void OutlierDetectionLb::EjectionTimer::OnTimerLocked() {
       }
     }
   }
+  // latency algorithm
+  if (!latency_ejection_candidates.empty() &&
+      latency_ejection_candidates.size() >=
+          config.latency_ejection->minimum_hosts) {
+    // calculate ejection threshold: (median * (threshold_factor / 1000))
+    std::vector<double> latencies;
+    latencies.reserve(latency_ejection_candidates.size());
+    for (const auto& [_, latency] : latency_ejection_candidates) {
+      latencies.push_back(latency);
+    }
+    auto middle = latencies.begin() + latencies.size() / 2;
+    std::nth_element(latencies.begin(), middle, latencies.end());
+    const double ejection_threshold =
+        *middle * config.latency_ejection->threshold_factor / 1000;
+    GRPC_TRACE_LOG(outlier_detection_lb, INFO)
+        << "[outlier_detection_lb " << parent_.get()
+        << "] running latency algorithm: percentile="
+        << config.latency_ejection->percentile
+        << ", threshold_factor=" << config.latency_ejection->threshold_factor
+        << ", enforcement_percentage="
+        << config.latency_ejection->enforcement_percentage
+        << ", median=" << *middle
+        << "ms, ejection_threshold=" << ejection_threshold << "ms";
+    for (auto& [endpoint_state, latency] : latency_ejection_candidates) {
+      GRPC_TRACE_LOG(outlier_detection_lb, INFO)
+          << "[outlier_detection_lb " << parent_.get()
+          << "] checking candidate " << endpoint_state
+          << ": latency=" << latency << "ms";
+      // Extra check to make sure neither of the other algorithms already
+      // ejected this backend.
+      if (endpoint_state->ejection_time().has_value()) continue;
+      if (latency > ejection_threshold) {
+        uint32_t random_key = absl::Uniform(bit_gen_, 1, 100);
+        double current_percent =
+            100.0 * ejected_host_count / parent_->endpoint_state_map_.size();
+        GRPC_TRACE_LOG(outlier_detection_lb, INFO)
+            << "[outlier_detection_lb " << parent_.get()
+            << "] random_key=" << random_key
+            << " ejected_host_count=" << ejected_host_count
+            << " current_percent=" << current_percent;
+        if (random_key < config.latency_ejection->enforcement_percentage &&
+            (ejected_host_count == 0 ||
+             (current_percent < config.max_ejection_percent))) {
+          GRPC_TRACE_LOG(outlier_detection_lb, INFO)
+              << "[outlier_detection_lb " << parent_.get()
+              << "] ejecting candidate";
+          endpoint_state->Eject(time_now);
+          ++ejected_host_count;
+        }
+      }
+    }
+  }
   // For each address in the map:
   //   If the address is not ejected and the multiplier is greater than 0,
   //   decrease the multiplier by 1. If the address is ejected, and the
@@ -1112,6 +1226,36 @@ void OutlierDetectionConfig::FailurePercentageEjection::JsonPostLoad(
   }
 }
 
+const JsonLoaderInterface* OutlierDetectionConfig::LatencyEjection::JsonLoader(
+    const JsonArgs&) {
+  static const auto* loader =
+      JsonObjectLoader<LatencyEjection>()
+          .OptionalField("percentile", &LatencyEjection::percentile)
+          .OptionalField("thresholdFactor", &LatencyEjection::threshold_factor)
+          .OptionalField("enforcementPercentage",
+                         &LatencyEjection::enforcement_percentage)
+          .OptionalField("minimumHosts", &LatencyEjection::minimum_hosts)
+          .OptionalField("requestVolume", &LatencyEjection::request_volume)
+          .Finish();
+  return loader;
+}
+
+void OutlierDetectionConfig::LatencyEjection::JsonPostLoad(
+    const Json&, const JsonArgs&, ValidationErrors* errors) {
+  if (percentile == 0 || percentile > 100) {
+    ValidationErrors::ScopedField field(errors, ".percentile");
+    errors->AddError("value must be in the range [1, 100]");
+  }
+  if (threshold_factor < 1000) {
+    ValidationErrors::ScopedField field(errors, ".threshold_factor");
+    errors->AddError("value must be >= 1000");
+  }
+  if (enforcement_percentage > 100) {
+    ValidationErrors::ScopedField field(errors, ".enforcement_percentage");
+    errors->AddError("value must be <= 100");
+  }
+}
+
 const JsonLoaderInterface* OutlierDetectionConfig::JsonLoader(const JsonArgs&) {
   static const auto* loader =
       JsonObjectLoader<OutlierDetectionConfig>()
@@ -1126,6 +1270,8 @@ const JsonLoaderInterface* OutlierDetectionConfig::JsonLoader(const JsonArgs&) {
                          &OutlierDetectionConfig::success_rate_ejection)
           .OptionalField("failurePercentageEjection",
                          &OutlierDetectionConfig::failure_percentage_ejection)
+          .OptionalField("latencyEjection",
+                         &OutlierDetectionConfig::latency_ejection)
           .Finish();
   return loader;
 }
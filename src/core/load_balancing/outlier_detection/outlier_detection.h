@@ -71,8 +71,32 @@ struct OutlierDetectionConfig {
     static const JsonLoaderInterface* JsonLoader(const JsonArgs&);
     void JsonPostLoad(const Json&, const JsonArgs&, ValidationErrors* errors);
   };
+  // Ejects endpoints whose latency at the given percentile exceeds the
+  // median of that percentile across endpoints by threshold_factor / 1000.
+  // Only successful calls are timed.  Not settable via xDS.
+  struct LatencyEjection {
+    uint32_t percentile = 99;
+    uint32_t threshold_factor = 2000;
+    uint32_t enforcement_percentage = 100;
+    uint32_t minimum_hosts = 5;
+    uint32_t request_volume = 100;
+
+    LatencyEjection() {}
+
+    bool operator==(const LatencyEjection& other) const {
+      return percentile == other.percentile &&
+             threshold_factor == other.threshold_factor &&
+             enforcement_percentage == other.enforcement_percentage &&
+             minimum_hosts == other.minimum_hosts &&
+             request_volume == other.request_volume;
+    }
+
+    static const JsonLoaderInterface* JsonLoader(const JsonArgs&);
+    void JsonPostLoad(const Json&, const JsonArgs&, ValidationErrors* errors);
+  };
   std::optional<SuccessRateEjection> success_rate_ejection;
   std::optional<FailurePercentageEjection> failure_percentage_ejection;
+  std::optional<LatencyEjection> latency_ejection;
 
   bool operator==(const OutlierDetectionConfig& other) const {
     return interval == other.interval &&
@@ -80,7 +104,8 @@ struct OutlierDetectionConfig {
            max_ejection_time == other.max_ejection_time &&
            max_ejection_percent == other.max_ejection_percent &&
            success_rate_ejection == other.success_rate_ejection &&
-           failure_percentage_ejection == other.failure_percentage_ejection;
+           failure_percentage_ejection == other.failure_percentage_ejection &&
+           latency_ejection == other.latency_ejection;
   }
 
   static const JsonLoaderInterface* JsonLoader(const JsonArgs&);
@@ -23,6 +23,7 @@
 #include <inttypes.h>
 #include <string.h>
 
+#include <algorithm>
 #include <memory>
 #include <optional>
 #include <set>
@@ -204,7 +205,8 @@ class PickFirst final : public LoadBalancingPolicy {
       };
 
       SubchannelData(SubchannelList* subchannel_list, size_t index,
-                     RefCountedPtr<SubchannelInterface> subchannel);
+                     RefCountedPtr<SubchannelInterface> subchannel,
+                     absl::string_view address_family);
 
       std::optional<grpc_connectivity_state> connectivity_state() const {
         return connectivity_state_;
@@ -212,6 +214,7 @@ class PickFirst final : public LoadBalancingPolicy {
       const absl::Status& connectivity_status() const {
         return connectivity_status_;
       }
+      absl::string_view address_family() const { return address_family_; }
 
       void RequestConnection() { subchannel_state_->RequestConnection(); }
 
@@ -236,6 +239,8 @@ class PickFirst final : public LoadBalancingPolicy {
       SubchannelList* subchannel_list_;
       // Our index within subchannel_list_.
       const size_t index_;
+      // The URI scheme of the subchannel's address.
+      const absl::string_view address_family_;
       // Subchannel state.
       OrphanablePtr<SubchannelState> subchannel_state_;
       // Data updated by the watcher.
@@ -366,6 +371,10 @@ class PickFirst final : public LoadBalancingPolicy {
 
   void AttemptToConnectUsingLatestUpdateArgsLocked();
 
+  // Reorders latest_update_args_ so that preferred_address_family_ is
+  // attempted first, if it isn't already.
+  void MaybePreferConnectedAddressFamily();
+
   void UnsetSelectedSubchannel();
 
   void GoIdle();
@@ -396,6 +405,11 @@ class PickFirst final : public LoadBalancingPolicy {
   // Selected subchannel.  Will generally be null when subchannel_list_
   // is non-null, with the exception mentioned above.
   OrphanablePtr<SubchannelList::SubchannelData::SubchannelState> selected_;
+  // The address family of the last subchannel to be selected, which won
+  // the most recent Happy Eyeballs race.  Empty until a subchannel has
+  // been selected.  Used only with the pick_first_prefer_connected_family
+  // experiment.
+  absl::string_view preferred_address_family_;
   // Health watcher for the selected subchannel.
   SubchannelInterface::ConnectivityStateWatcherInterface* health_watcher_ =
       nullptr;
@@ -452,6 +466,9 @@ void PickFirst::ResetBackoffLocked() {
 }
 
 void PickFirst::AttemptToConnectUsingLatestUpdateArgsLocked() {
+  if (IsPickFirstPreferConnectedFamilyEnabled()) {
+    MaybePreferConnectedAddressFamily();
+  }
   // Create a subchannel list from latest_update_args_.
   EndpointAddressesIterator* addresses = nullptr;
   if (latest_update_args_.addresses.ok()) {
@@ -507,6 +524,77 @@ class AddressFamilyIterator final {
   size_t index_;
 };
 
+// Flattens the list so that we have one address per endpoint, and
+// interleaves addresses as per RFC-8305 section 4.  Address families are
+// ordered by first appearance, except that preferred_family, if present,
+// goes first.  Within each family, addresses keep their relative order.
+EndpointAddressesList InterleaveAddressFamilies(
+    const EndpointAddressesList& endpoints,
+    absl::string_view preferred_family) {
+  // While flattening, also determine the desired address family order and
+  // the index of the first element of each family, for use in the
+  // interleaving below.
+  std::set<absl::string_view> address_families;
+  std::vector<AddressFamilyIterator> address_family_order;
+  EndpointAddressesList flattened_endpoints;
+  for (const auto& endpoint : endpoints) {
+    for (const auto& address : endpoint.addresses()) {
+      flattened_endpoints.emplace_back(address, endpoint.args());
+      absl::string_view scheme = GetAddressFamily(address);
+      bool inserted = address_families.insert(scheme).second;
+      if (inserted) {
+        address_family_order.emplace_back(scheme,
+                                          flattened_endpoints.size() - 1);
+        if (scheme == preferred_family) {
+          std::rotate(address_family_order.begin(),
+                      address_family_order.end() - 1,
+                      address_family_order.end());
+        }
+      }
+    }
+  }
+  EndpointAddressesList interleaved_endpoints;
+  interleaved_endpoints.reserve(flattened_endpoints.size());
+  std::vector<bool> endpoints_moved(flattened_endpoints.size());
+  size_t scheme_index = 0;
+  for (size_t i = 0; i < flattened_endpoints.size(); ++i) {
+    EndpointAddresses* endpoint;
+    do {
+      auto& iterator = address_family_order[scheme_index++ %
+                                            address_family_order.size()];
+      endpoint = iterator.Next(flattened_endpoints, &endpoints_moved);
+    } while (endpoint == nullptr);
+    interleaved_endpoints.emplace_back(std::move(*endpoint));
+  }
+  return interleaved_endpoints;
+}
+
+void PickFirst::MaybePreferConnectedAddressFamily() {
+  if (preferred_address_family_.empty() ||
+      !latest_update_args_.addresses.ok()) {
+    return;
+  }
+  EndpointAddressesList endpoints;
+  bool has_preferred_family = false;
+  (*latest_update_args_.addresses)->ForEach([&](const EndpointAddresses& e) {
+    endpoints.push_back(e);
+    if (GetAddressFamily(e.address()) == preferred_address_family_) {
+      has_preferred_family = true;
+    }
+  });
+  if (!has_preferred_family ||
+      GetAddressFamily(endpoints.front().address()) ==
+          preferred_address_family_) {
+    return;
+  }
+  GRPC_TRACE_LOG(pick_first, INFO)
+      << "Pick First " << this << " attempting address family "
+      << preferred_address_family_ << " first";
+  latest_update_args_.addresses =
+      std::make_shared<EndpointAddressesListIterator>(
+          InterleaveAddressFamilies(endpoints, preferred_address_family_));
+}
+
 absl::Status PickFirst::UpdateLocked(UpdateArgs args) {
   if (GRPC_TRACE_FLAG_ENABLED(pick_first)) {
     if (args.addresses.ok()) {
@@ -534,40 +622,9 @@ absl::Status PickFirst::UpdateLocked(UpdateArgs args) {
       if (config->shuffle_addresses()) {
         absl::c_shuffle(endpoints, bit_gen_);
       }
-      // Flatten the list so that we have one address per endpoint.
-      // While we're iterating, also determine the desired address family
-      // order and the index of the first element of each family, for use in
-      // the interleaving below.
-      std::set<absl::string_view> address_families;
-      std::vector<AddressFamilyIterator> address_family_order;
-      EndpointAddressesList flattened_endpoints;
-      for (const auto& endpoint : endpoints) {
-        for (const auto& address : endpoint.addresses()) {
-          flattened_endpoints.emplace_back(address, endpoint.args());
-          absl::string_view scheme = GetAddressFamily(address);
-          bool inserted = address_families.insert(scheme).second;
-          if (inserted) {
-            address_family_order.emplace_back(scheme,
-                                              flattened_endpoints.size() - 1);
-          }
-        }
-      }
-      endpoints = std::move(flattened_endpoints);
-      // Interleave addresses as per RFC-8305 section 4.
-      EndpointAddressesList interleaved_endpoints;
-      interleaved_endpoints.reserve(endpoints.size());
-      std::vector<bool> endpoints_moved(endpoints.size());
-      size_t scheme_index = 0;
-      for (size_t i = 0; i < endpoints.size(); ++i) {
-        EndpointAddresses* endpoint;
-        do {
-          auto& iterator = address_family_order[scheme_index++ %
-                                                address_family_order.size()];
-          endpoint = iterator.Next(endpoints, &endpoints_moved);
-        } while (endpoint == nullptr);
-        interleaved_endpoints.emplace_back(std::move(*endpoint));
-      }
-      endpoints = std::move(interleaved_endpoints);
+      // Flatten the list and interleave address families.  The preferred
+      // family, if any, is applied later, when connecting.
+      endpoints = InterleaveAddressFamilies(endpoints, "");
       args.addresses =
           std::make_shared<EndpointAddressesListIterator>(std::move(endpoints));
     }
@@ -699,6 +756,7 @@ void PickFirst::SubchannelList::SubchannelData::SubchannelState::Select() {
   ABSL_CHECK_NE(subchannel_data_, nullptr);
   pick_first_->UnsetSelectedSubchannel();  // Cancel health watch, if any.
   pick_first_->selected_ = std::move(subchannel_data_->subchannel_state_);
+  pick_first_->preferred_address_family_ = subchannel_data_->address_family();
   // If health checking is enabled, start the health watch, but don't
   // report a new picker -- we want to stay in CONNECTING while we wait
   // for the health status notification.
@@ -786,8 +844,11 @@ void PickFirst::SubchannelList::SubchannelData::SubchannelState::
 
 PickFirst::SubchannelList::SubchannelData::SubchannelData(
     SubchannelList* subchannel_list, size_t index,
-    RefCountedPtr<SubchannelInterface> subchannel)
-    : subchannel_list_(subchannel_list), index_(index) {
+    RefCountedPtr<SubchannelInterface> subchannel,
+    absl::string_view address_family)
+    : subchannel_list_(subchannel_list),
+      index_(index),
+      address_family_(address_family) {
   GRPC_TRACE_LOG(pick_first, INFO)
       << "[PF " << subchannel_list_->policy_.get() << "] subchannel list "
       << subchannel_list_ << " index " << index_
@@ -1016,7 +1077,8 @@ PickFirst::SubchannelList::SubchannelList(RefCountedPtr<PickFirst> policy,
         << subchannels_.size() << ": Created subchannel " << subchannel.get()
         << " for address " << address.ToString();
     subchannels_.emplace_back(std::make_unique<SubchannelData>(
-        this, subchannels_.size(), std::move(subchannel)));
+        this, subchannels_.size(), std::move(subchannel),
+        GetAddressFamily(address.address())));
   });
 }
 
@@ -241,6 +241,10 @@ class PriorityLb final : public LoadBalancingPolicy {
   // Deletes a child.  Called when the child's deactivation timer fires.
   void DeleteChild(ChildPriority* child);
 
+  // Returns the child for the specified priority, creating it or
+  // reactivating it if needed.
+  ChildPriority* GetOrCreateChildLocked(uint32_t priority);
+
   // Iterates through the list of priorities to choose one:
   // - If the child for a priority doesn't exist, creates it.
   // - If a child's failover timer is pending, selects that priority
@@ -255,13 +259,16 @@ class PriorityLb final : public LoadBalancingPolicy {
   void ChoosePriorityLocked();
 
   // Sets the specified priority as the current priority.
-  // Optionally deactivates any children at lower priorities.
+  // Keeps the next warm_standby_count_ priorities connected, and optionally
+  // deactivates any children at lower priorities than those.
   // Returns the child's picker to the channel.
   void SetCurrentPriorityLocked(int32_t priority,
                                 bool deactivate_lower_priorities,
                                 const char* reason);
 
   const Duration child_failover_timeout_;
+  // Number of priorities below the current one kept connected.
+  const uint32_t warm_standby_count_;
 
   // Current channel args and config from the resolver.
   ChannelArgs args_;
@@ -291,7 +298,11 @@ PriorityLb::PriorityLb(Args args)
           Duration::Zero(),
           channel_args()
               .GetDurationFromIntMillis(GRPC_ARG_PRIORITY_FAILOVER_TIMEOUT_MS)
-              .value_or(kDefaultChildFailoverTimeout))) {
+              .value_or(kDefaultChildFailoverTimeout))),
+      warm_standby_count_(std::max(
+          0, channel_args()
+                 .GetInt(GRPC_ARG_PRIORITY_WARM_STANDBY_COUNT)
+                 .value_or(0))) {
   GRPC_TRACE_LOG(priority_lb, INFO) << "[priority_lb " << this << "] created";
 }
 
@@ -374,6 +385,34 @@ void PriorityLb::DeleteChild(ChildPriority* child) {
   children_.erase(child->name());
 }
 
+PriorityLb::ChildPriority* PriorityLb::GetOrCreateChildLocked(
+    uint32_t priority) {
+  const std::string& child_name = config_->priorities()[priority];
+  auto& child = children_[child_name];
+  // Create child if needed.
+  if (child == nullptr) {
+    child = MakeOrphanable<ChildPriority>(
+        RefAsSubclass<PriorityLb>(DEBUG_LOCATION, "ChildPriority"),
+        child_name);
+    auto child_config = config_->children().find(child_name);
+    ABSL_DCHECK(child_config != config_->children().end());
+    // If the child policy returns a non-OK status, request re-resolution.
+    // Note that this will initially cause fixed backoff delay in the
+    // resolver instead of exponential delay.  However, once the
+    // resolver returns the initial re-resolution, we will be able to
+    // return non-OK from UpdateLocked(), which will trigger
+    // exponential backoff instead.
+    absl::Status status = child->UpdateLocked(
+        child_config->second.config,
+        child_config->second.ignore_reresolution_requests);
+    if (!status.ok()) channel_control_helper()->RequestReresolution();
+  } else {
+    // The child already exists.  Reactivate if needed.
+    child->MaybeReactivateLocked();
+  }
+  return child.get();
+}
+
 void PriorityLb::ChoosePriorityLocked() {
   // If priority list is empty, report TF.
   if (config_->priorities().empty()) {
@@ -394,28 +433,7 @@ void PriorityLb::ChoosePriorityLocked() {
     GRPC_TRACE_LOG(priority_lb, INFO)
         << "[priority_lb " << this << "] trying priority " << priority
         << ", child " << child_name;
-    auto& child = children_[child_name];
-    // Create child if needed.
-    if (child == nullptr) {
-      child = MakeOrphanable<ChildPriority>(
-          RefAsSubclass<PriorityLb>(DEBUG_LOCATION, "ChildPriority"),
-          child_name);
-      auto child_config = config_->children().find(child_name);
-      ABSL_DCHECK(child_config != config_->children().end());
-      // If the child policy returns a non-OK status, request re-resolution.
-      // Note that this will initially cause fixed backoff delay in the
-      // resolver instead of exponential delay.  However, once the
-      // resolver returns the initial re-resolution, we will be able to
-      // return non-OK from UpdateLocked(), which will trigger
-      // exponential backoff instead.
-      absl::Status status = child->UpdateLocked(
-          child_config->second.config,
-          child_config->second.ignore_reresolution_requests);
-      if (!status.ok()) channel_control_helper()->RequestReresolution();
-    } else {
-      // The child already exists.  Reactivate if needed.
-      child->MaybeReactivateLocked();
-    }
+    ChildPriority* child = GetOrCreateChildLocked(priority);
     // Select this child if it is in states READY or IDLE.
     if (child->connectivity_state() == GRPC_CHANNEL_READY ||
         child->connectivity_state() == GRPC_CHANNEL_IDLE) {
@@ -472,8 +490,32 @@ void PriorityLb::SetCurrentPriorityLocked(int32_t priority,
       << ", child " << config_->priorities()[priority] << " (" << reason
       << ", deactivate_lower_priorities=" << deactivate_lower_priorities << ")";
   current_priority_ = priority;
+  const uint32_t last_standby = static_cast<uint32_t>(
+      std::min(priority + size_t{warm_standby_count_},
+               config_->priorities().size() - 1));
+  if (last_standby > static_cast<uint32_t>(priority)) {
+    // Children created here report their initial state while we are still
+    // choosing; there is no need to choose again for that.
+    const bool update_in_progress =
+        std::exchange(update_in_progress_, true);
+    for (uint32_t p = priority + 1; p <= last_standby; ++p) {
+      ChildPriority* child = GetOrCreateChildLocked(p);
+      // Pickers only take a child out of IDLE when it is in use.
+      if (child->connectivity_state() == GRPC_CHANNEL_IDLE) {
+        work_serializer()->Run(
+            [self = RefAsSubclass<PriorityLb>(DEBUG_LOCATION, "WarmStandby"),
+             child_name = child->name()]() {
+              auto it = self->children_.find(child_name);
+              if (self->shutting_down_ || it == self->children_.end()) return;
+              it->second->ExitIdleLocked();
+            });
+      }
+    }
+    update_in_progress_ = update_in_progress;
+  }
   if (deactivate_lower_priorities) {
-    for (uint32_t p = priority + 1; p < config_->priorities().size(); ++p) {
+    for (uint32_t p = last_standby + 1; p < config_->priorities().size();
+         ++p) {
       const std::string& child_name = config_->priorities()[p];
       auto it = children_.find(child_name);
       if (it != children_.end()) it->second->MaybeDeactivateLocked();
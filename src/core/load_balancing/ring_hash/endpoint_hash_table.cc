@@ -0,0 +1,329 @@
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "src/core/load_balancing/ring_hash/endpoint_hash_table.h"
+
+#include <grpc/impl/channel_arg_names.h>
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <utility>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/inlined_vector.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "src/core/lib/address_utils/sockaddr_utils.h"
+#include "src/core/load_balancing/ring_hash/ring_hash.h"
+#include "src/core/util/no_destruct.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/xxhash_inline.h"
+
+namespace grpc_core {
+
+namespace {
+
+struct EndpointWeight {
+  std::string hash_key;  // By default, endpoint's first address.
+  // Default weight is 1 for the cases where a weight is not provided,
+  // each occurrence of the address will be counted a weight value of 1.
+  uint32_t weight = 1;
+};
+
+EndpointWeight GetEndpointWeight(const EndpointAddresses& endpoint) {
+  EndpointWeight endpoint_weight;
+  auto hash_key =
+      endpoint.args().GetString(GRPC_ARG_RING_HASH_ENDPOINT_HASH_KEY);
+  if (hash_key.has_value()) {
+    endpoint_weight.hash_key = std::string(*hash_key);
+  } else {
+    endpoint_weight.hash_key =
+        grpc_sockaddr_to_string(&endpoint.addresses().front(), false).value();
+  }
+  // Weight should never be zero, but ignore it just in case, since
+  // that value would screw up the table-building algorithms.
+  auto weight_arg = endpoint.args().GetInt(GRPC_ARG_ADDRESS_WEIGHT);
+  if (weight_arg.value_or(0) > 0) {
+    endpoint_weight.weight = *weight_arg;
+  }
+  return endpoint_weight;
+}
+
+std::vector<std::pair<std::string, uint32_t>> GetEndpointWeights(
+    const EndpointAddressesList& endpoints) {
+  std::vector<std::pair<std::string, uint32_t>> endpoint_weights;
+  endpoint_weights.reserve(endpoints.size());
+  for (const auto& endpoint : endpoints) {
+    EndpointWeight endpoint_weight = GetEndpointWeight(endpoint);
+    endpoint_weights.emplace_back(std::move(endpoint_weight.hash_key),
+                                  endpoint_weight.weight);
+  }
+  return endpoint_weights;
+}
+
+// The tables built by BuildShared() that are still in use.
+struct SharedTables {
+  Mutex mu;
+  absl::flat_hash_map<EndpointHashTableKey, EndpointHashTable*> tables
+      ABSL_GUARDED_BY(mu);
+};
+
+SharedTables* GetSharedTables() {
+  static NoDestruct<SharedTables> shared_tables;
+  return shared_tables.get();
+}
+
+}  // namespace
+
+//
+// EndpointHashTableKey
+//
+
+EndpointHashTableKey EndpointHashTableKey::ForHashRing(
+    const EndpointAddressesList& endpoints, size_t min_ring_size,
+    size_t max_ring_size) {
+  return {Kind::kHashRing, min_ring_size, max_ring_size,
+          GetEndpointWeights(endpoints)};
+}
+
+EndpointHashTableKey EndpointHashTableKey::ForMaglevTable(
+    const EndpointAddressesList& endpoints, uint64_t table_size) {
+  return {Kind::kMaglev, table_size, table_size,
+          GetEndpointWeights(endpoints)};
+}
+
+//
+// EndpointHashTable
+//
+
+EndpointHashTable::~EndpointHashTable() {
+  if (!shared_key_.has_value()) return;
+  SharedTables* shared_tables = GetSharedTables();
+  MutexLock lock(&shared_tables->mu);
+  auto it = shared_tables->tables.find(*shared_key_);
+  // A table whose last ref is being dropped may already have been replaced.
+  if (it != shared_tables->tables.end() && it->second == this) {
+    shared_tables->tables.erase(it);
+  }
+}
+
+RefCountedPtr<EndpointHashTable> EndpointHashTable::FindShared(
+    const EndpointHashTableKey& key) {
+  SharedTables* shared_tables = GetSharedTables();
+  MutexLock lock(&shared_tables->mu);
+  auto it = shared_tables->tables.find(key);
+  if (it == shared_tables->tables.end()) return nullptr;
+  return it->second->RefIfNonZero();
+}
+
+RefCountedPtr<EndpointHashTable> EndpointHashTable::BuildShared(
+    EndpointHashTableKey key, const EndpointAddressesList& endpoints) {
+  // Build without the lock: this is the slow part.
+  RefCountedPtr<EndpointHashTable> table;
+  if (key.kind == EndpointHashTableKey::Kind::kMaglev) {
+    table = MakeRefCounted<MaglevTable>(endpoints, key.max_size);
+  } else {
+    table = MakeRefCounted<HashRing>(endpoints, key.min_size, key.max_size);
+  }
+  SharedTables* shared_tables = GetSharedTables();
+  MutexLock lock(&shared_tables->mu);
+  EndpointHashTable*& entry = shared_tables->tables[key];
+  if (entry != nullptr) {
+    auto existing = entry->RefIfNonZero();
+    // Our copy was never registered, so dropping it doesn't take the lock.
+    if (existing != nullptr) return existing;
+  }
+  entry = table.get();
+  table->shared_key_ = std::move(key);
+  return table;
+}
+
+//
+// HashRing
+//
+
+HashRing::HashRing(const EndpointAddressesList& endpoints,
+                   size_t min_ring_size, size_t max_ring_size) {
+  // Store the weights while finding the sum.
+  std::vector<EndpointWeight> endpoint_weights;
+  size_t sum = 0;
+  endpoint_weights.reserve(endpoints.size());
+  for (const auto& endpoint : endpoints) {
+    endpoint_weights.push_back(GetEndpointWeight(endpoint));
+    sum += endpoint_weights.back().weight;
+  }
+  // Calculating normalized weights and find min.
+  std::vector<double> normalized_weights;
+  normalized_weights.reserve(endpoints.size());
+  double min_normalized_weight = 1.0;
+  for (const auto& endpoint_weight : endpoint_weights) {
+    normalized_weights.push_back(static_cast<double>(endpoint_weight.weight) /
+                                 sum);
+    min_normalized_weight =
+        std::min(normalized_weights.back(), min_normalized_weight);
+  }
+  // Scale up the number of hashes per host such that the least-weighted host
+  // gets a whole number of hashes on the ring. Other hosts might not end up
+  // with whole numbers, and that's fine (the ring-building algorithm below can
+  // handle this). This preserves the original implementation's behavior: when
+  // weights aren't provided, all hosts should get an equal number of hashes. In
+  // the case where this number exceeds the max_ring_size, it's scaled back down
+  // to fit.
+  const double scale = std::min(
+      std::ceil(min_normalized_weight * min_ring_size) / min_normalized_weight,
+      static_cast<double>(max_ring_size));
+  // Reserve memory for the entire ring up front.
+  const uint64_t ring_size = std::ceil(scale);
+  struct RingEntry {
+    uint64_t hash;
+    uint32_t endpoint_index;
+  };
+  std::vector<RingEntry> ring;
+  ring.reserve(ring_size);
+  // Populate the hash ring by walking through the (host, weight) pairs in
+  // normalized_host_weights, and generating (scale * weight) hashes for each
+  // host. Since these aren't necessarily whole numbers, we maintain running
+  // sums -- current_hashes and target_hashes -- which allows us to populate the
+  // ring in a mostly stable way.
+  absl::InlinedVector<char, 196> hash_key_buffer;
+  double current_hashes = 0.0;
+  double target_hashes = 0.0;
+  for (size_t i = 0; i < endpoints.size(); ++i) {
+    const std::string& hash_key = endpoint_weights[i].hash_key;
+    hash_key_buffer.assign(hash_key.begin(), hash_key.end());
+    hash_key_buffer.emplace_back('_');
+    auto offset_start = hash_key_buffer.end();
+    target_hashes += scale * normalized_weights[i];
+    size_t count = 0;
+    while (current_hashes < target_hashes) {
+      const std::string count_str = absl::StrCat(count);
+      hash_key_buffer.insert(offset_start, count_str.begin(), count_str.end());
+      absl::string_view hash_key(hash_key_buffer.data(),
+                                 hash_key_buffer.size());
+      const uint64_t hash = XXH64(hash_key.data(), hash_key.size(), 0);
+      ring.push_back({hash, static_cast<uint32_t>(i)});
+      ++count;
+      ++current_hashes;
+      hash_key_buffer.erase(offset_start, hash_key_buffer.end());
+    }
+  }
+  std::sort(ring.begin(), ring.end(),
+            [](const RingEntry& lhs, const RingEntry& rhs) -> bool {
+              return lhs.hash < rhs.hash;
+            });
+  hashes_.reserve(ring.size());
+  endpoint_indices_.reserve(ring.size());
+  for (const RingEntry& entry : ring) {
+    hashes_.push_back(entry.hash);
+    endpoint_indices_.push_back(entry.endpoint_index);
+  }
+}
+
+size_t HashRing::Find(uint64_t request_hash) const {
+  // Ported from https://github.com/RJ/ketama/blob/master/libketama/ketama.c
+  // (ketama_get_server) NOTE: The algorithm depends on using signed integers
+  // for lowp, highp, and index. Do not change them!
+  int64_t lowp = 0;
+  int64_t highp = hashes_.size();
+  int64_t index = 0;
+  while (true) {
+    index = (lowp + highp) / 2;
+    if (index == static_cast<int64_t>(hashes_.size())) {
+      index = 0;
+      break;
+    }
+    uint64_t midval = hashes_[index];
+    uint64_t midval1 = index == 0 ? 0 : hashes_[index - 1];
+    if (request_hash <= midval && request_hash > midval1) {
+      break;
+    }
+    if (midval < request_hash) {
+      lowp = index + 1;
+    } else {
+      highp = index - 1;
+    }
+    if (lowp > highp) {
+      index = 0;
+      break;
+    }
+  }
+  return index;
+}
+
+//
+// MaglevTable
+//
+
+MaglevTable::MaglevTable(const EndpointAddressesList& endpoints,
+                         uint64_t table_size) {
+  if (endpoints.empty()) return;
+  // Each endpoint's permutation of the slots starts at its offset and steps
+  // by its skip.  Because table_size is prime, any skip in [1, table_size)
+  // visits every slot.
+  struct BuildEntry {
+    uint64_t weight;
+    uint64_t next_slot;
+    uint64_t skip;
+    // The number of the round on which the endpoint next takes a slot, scaled
+    // by its weight.
+    uint64_t target_weight = 0;
+  };
+  std::vector<BuildEntry> build_entries;
+  build_entries.reserve(endpoints.size());
+  uint64_t max_weight = 0;
+  for (const auto& endpoint : endpoints) {
+    EndpointWeight endpoint_weight = GetEndpointWeight(endpoint);
+    const std::string& hash_key = endpoint_weight.hash_key;
+    const uint64_t offset =
+        XXH64(hash_key.data(), hash_key.size(), 0) % table_size;
+    const uint64_t skip =
+        XXH64(hash_key.data(), hash_key.size(), 1) % (table_size - 1) + 1;
+    build_entries.push_back({endpoint_weight.weight, offset, skip});
+    max_weight = std::max<uint64_t>(max_weight, endpoint_weight.weight);
+  }
+  // Fill the table in rounds.  An endpoint of the largest weight takes the
+  // next free slot of its permutation on every round, and one of a third of
+  // that weight on every third round.
+  constexpr uint32_t kEmptySlot = std::numeric_limits<uint32_t>::max();
+  endpoint_indices_.assign(table_size, kEmptySlot);
+  uint64_t filled = 0;
+  for (uint64_t round = 1; filled < table_size; ++round) {
+    for (size_t i = 0; i < build_entries.size() && filled < table_size; ++i) {
+      BuildEntry& entry = build_entries[i];
+      if (round * entry.weight < entry.target_weight) continue;
+      entry.target_weight += max_weight;
+      while (endpoint_indices_[entry.next_slot] != kEmptySlot) {
+        entry.next_slot = (entry.next_slot + entry.skip) % table_size;
+      }
+      endpoint_indices_[entry.next_slot] = i;
+      entry.next_slot = (entry.next_slot + entry.skip) % table_size;
+      ++filled;
+    }
+  }
+}
+
+bool MaglevTable::IsPrime(uint64_t n) {
+  if (n < 2) return false;
+  for (uint64_t d = 2; d * d <= n; ++d) {
+    if (n % d == 0) return false;
+  }
+  return true;
+}
+
+}  // namespace grpc_core
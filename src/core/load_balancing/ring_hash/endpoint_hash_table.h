@@ -0,0 +1,153 @@
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef GRPC_SRC_CORE_LOAD_BALANCING_RING_HASH_ENDPOINT_HASH_TABLE_H
+#define GRPC_SRC_CORE_LOAD_BALANCING_RING_HASH_ENDPOINT_HASH_TABLE_H
+
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "src/core/resolver/endpoint_addresses.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
+
+namespace grpc_core {
+
+// Identifies a table by everything it is built from: the kind of table, the
+// sizes it is built with, and each endpoint's hash key and weight.  Tables
+// with equal keys are identical, whatever else the endpoints' args hold.
+struct EndpointHashTableKey {
+  enum class Kind { kHashRing, kMaglev };
+
+  Kind kind;
+  // min_ring_size and max_ring_size for a HashRing; table_size (twice) for
+  // a MaglevTable.
+  uint64_t min_size;
+  uint64_t max_size;
+  std::vector<std::pair<std::string, uint32_t>> endpoints;
+
+  static EndpointHashTableKey ForHashRing(
+      const EndpointAddressesList& endpoints, size_t min_ring_size,
+      size_t max_ring_size);
+  static EndpointHashTableKey ForMaglevTable(
+      const EndpointAddressesList& endpoints, uint64_t table_size);
+
+  bool operator==(const EndpointHashTableKey& other) const {
+    return kind == other.kind && min_size == other.min_size &&
+           max_size == other.max_size && endpoints == other.endpoints;
+  }
+
+  template <typename H>
+  friend H AbslHashValue(H h, const EndpointHashTableKey& key) {
+    return H::combine(std::move(h), key.kind, key.min_size, key.max_size,
+                      key.endpoints);
+  }
+};
+
+// Maps request hashes onto endpoints for the hash-based LB policies.
+//
+// The table is a sequence of positions, each naming an endpoint by its
+// index in the list the table was built from.  A pick starts at the
+// position Find() returns for its hash, and walks on through the following
+// positions (wrapping around) while the endpoints it finds cannot be used.
+//
+// Each endpoint's hash key is its GRPC_ARG_RING_HASH_ENDPOINT_HASH_KEY arg,
+// or else its first address, and its weight is its GRPC_ARG_ADDRESS_WEIGHT
+// arg, or else 1.
+class EndpointHashTable : public RefCounted<EndpointHashTable> {
+ public:
+  ~EndpointHashTable() override;
+
+  // Returns the position at which to start the pick for request_hash.
+  // Must not be called on an empty table.
+  virtual size_t Find(uint64_t request_hash) const = 0;
+
+  size_t size() const { return endpoint_indices_.size(); }
+
+  size_t endpoint_index(size_t position) const {
+    return endpoint_indices_[position];
+  }
+
+  // Returns the table for key if one built by BuildShared() is still in
+  // use, or else nullptr.
+  static RefCountedPtr<EndpointHashTable> FindShared(
+      const EndpointHashTableKey& key);
+
+  // Returns a table for key, built from endpoints, and lets FindShared()
+  // return it while it is in use: large tables are slow to build, and every
+  // channel to a service gets the same endpoints.  If another caller has
+  // built the same table meanwhile, returns that one instead.  May be called
+  // from any thread.
+  static RefCountedPtr<EndpointHashTable> BuildShared(
+      EndpointHashTableKey key, const EndpointAddressesList& endpoints);
+
+ protected:
+  std::vector<uint32_t> endpoint_indices_;
+
+ private:
+  // Set if the table was built by BuildShared().
+  std::optional<EndpointHashTableKey> shared_key_;
+};
+
+// The Ketama hash ring used by ring_hash: each endpoint is hashed onto the
+// ring a number of times proportional to its weight, and a request goes to
+// the first endpoint at or after its hash.  Finding a request's position is
+// a binary search of the ring.
+class HashRing final : public EndpointHashTable {
+ public:
+  HashRing(const EndpointAddressesList& endpoints, size_t min_ring_size,
+           size_t max_ring_size);
+
+  size_t Find(uint64_t request_hash) const override;
+
+ private:
+  // The hash of each position, in increasing order.
+  std::vector<uint64_t> hashes_;
+};
+
+// A Maglev lookup table (Eisenbud et al., NSDI 2016): each endpoint fills
+// the slots of the table in the order of its own permutation of them, taking
+// turns in proportion to its weight, and a request goes to the slot its hash
+// selects.  Finding a request's position is a single modulo, and rebuilding
+// the table after a change to the endpoint list moves few slots from one
+// remaining endpoint to another.
+class MaglevTable final : public EndpointHashTable {
+ public:
+  // The table size used when none is configured.
+  static constexpr uint64_t kDefaultTableSize = 65537;
+  // The largest table size we accept.
+  static constexpr uint64_t kMaxTableSize = 5000011;
+
+  // table_size must be prime: that makes every endpoint's permutation visit
+  // every slot.
+  MaglevTable(const EndpointAddressesList& endpoints, uint64_t table_size);
+
+  size_t Find(uint64_t request_hash) const override {
+    return request_hash % endpoint_indices_.size();
+  }
+
+  static bool IsPrime(uint64_t n);
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LOAD_BALANCING_RING_HASH_ENDPOINT_HASH_TABLE_H
@@ -16,6 +16,7 @@
 
 #include "src/core/load_balancing/ring_hash/ring_hash.h"
 
+#include <grpc/event_engine/event_engine.h>
 #include <grpc/impl/channel_arg_names.h>
 #include <grpc/impl/connectivity_state.h>
 #include <grpc/support/json.h>
@@ -24,28 +25,27 @@
 #include <stdlib.h>
 
 #include <algorithm>
-#include <cmath>
+#include <atomic>
 #include <map>
 #include <memory>
 #include <optional>
 #include <string>
 #include <utility>
+#include <variant>
 #include <vector>
 
 #include "absl/base/attributes.h"
-#include "absl/container/inlined_vector.h"
 #include "absl/log/absl_check.h"
 #include "absl/log/absl_log.h"
-#include "absl/random/random.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
 #include "src/core/client_channel/client_channel_internal.h"
 #include "src/core/config/core_configuration.h"
-#include "src/core/lib/address_utils/sockaddr_utils.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
@@ -57,10 +57,12 @@
 #include "src/core/load_balancing/lb_policy_factory.h"
 #include "src/core/load_balancing/lb_policy_registry.h"
 #include "src/core/load_balancing/pick_first/pick_first.h"
+#include "src/core/load_balancing/ring_hash/endpoint_hash_table.h"
 #include "src/core/resolver/endpoint_addresses.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/debug_location.h"
 #include "src/core/util/env.h"
+#include "src/core/util/fast_random.h"
 #include "src/core/util/json/json.h"
 #include "src/core/util/orphanable.h"
 #include "src/core/util/ref_counted.h"
@@ -80,6 +82,7 @@ UniqueTypeName RequestHashAttribute::TypeName() {
 namespace {
 
 constexpr absl::string_view kRingHash = "ring_hash_experimental";
+constexpr absl::string_view kMaglev = "maglev_experimental";
 
 bool XdsRingHashSetRequestHashKeyEnabled() {
   auto value = GetEnv("GRPC_EXPERIMENTAL_RING_HASH_SET_REQUEST_HASH_KEY");
@@ -99,6 +102,16 @@ class RingHashJsonArgs final : public JsonArgs {
   }
 };
 
+void ValidateHashBalanceFactor(
+    const std::optional<uint32_t>& hash_balance_factor,
+    ValidationErrors* errors) {
+  ValidationErrors::ScopedField field(errors, ".hashBalanceFactor");
+  if (!errors->FieldHasErrors() && hash_balance_factor.has_value() &&
+      *hash_balance_factor < 100) {
+    errors->AddError("must be at least 100");
+  }
+}
+
 class RingHashLbConfig final : public LoadBalancingPolicy::Config {
  public:
   RingHashLbConfig() = default;
@@ -113,6 +126,10 @@ class RingHashLbConfig final : public LoadBalancingPolicy::Config {
   size_t min_ring_size() const { return min_ring_size_; }
   size_t max_ring_size() const { return max_ring_size_; }
   absl::string_view request_hash_header() const { return request_hash_header_; }
+  // In percent of the average load; 0 if loads are not bounded.
+  uint32_t hash_balance_factor() const {
+    return hash_balance_factor_.value_or(0);
+  }
 
   static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
     static const auto* loader =
@@ -122,6 +139,8 @@ class RingHashLbConfig final : public LoadBalancingPolicy::Config {
             .OptionalField("requestHashHeader",
                            &RingHashLbConfig::request_hash_header_,
                            "request_hash_header")
+            .OptionalField("hashBalanceFactor",
+                           &RingHashLbConfig::hash_balance_factor_)
             .Finish();
     return loader;
   }
@@ -141,6 +160,7 @@ class RingHashLbConfig final : public LoadBalancingPolicy::Config {
         errors->AddError("must be in the range [1, 8388608]");
       }
     }
+    ValidateHashBalanceFactor(hash_balance_factor_, errors);
     if (min_ring_size_ > max_ring_size_) {
       errors->AddError("maxRingSize cannot be smaller than minRingSize");
     }
@@ -150,39 +170,82 @@ class RingHashLbConfig final : public LoadBalancingPolicy::Config {
   uint64_t min_ring_size_ = 1024;
   uint64_t max_ring_size_ = 4096;
   std::string request_hash_header_;
+  std::optional<uint32_t> hash_balance_factor_;
+};
+
+class MaglevLbConfig final : public LoadBalancingPolicy::Config {
+ public:
+  MaglevLbConfig() = default;
+
+  MaglevLbConfig(const MaglevLbConfig&) = delete;
+  MaglevLbConfig& operator=(const MaglevLbConfig&) = delete;
+
+  MaglevLbConfig(MaglevLbConfig&& other) = delete;
+  MaglevLbConfig& operator=(MaglevLbConfig&& other) = delete;
+
+  absl::string_view name() const override { return kMaglev; }
+  uint64_t table_size() const { return table_size_; }
+  absl::string_view request_hash_header() const { return request_hash_header_; }
+  // In percent of the average load; 0 if loads are not bounded.
+  uint32_t hash_balance_factor() const {
+    return hash_balance_factor_.value_or(0);
+  }
+
+  static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
+    static const auto* loader =
+        JsonObjectLoader<MaglevLbConfig>()
+            .OptionalField("tableSize", &MaglevLbConfig::table_size_)
+            .OptionalField("requestHashHeader",
+                           &MaglevLbConfig::request_hash_header_,
+                           "request_hash_header")
+            .OptionalField("hashBalanceFactor",
+                           &MaglevLbConfig::hash_balance_factor_)
+            .Finish();
+    return loader;
+  }
+
+  void JsonPostLoad(const Json&, const JsonArgs&, ValidationErrors* errors) {
+    {
+      ValidationErrors::ScopedField field(errors, ".tableSize");
+      if (!errors->FieldHasErrors() &&
+          (table_size_ > MaglevTable::kMaxTableSize ||
+           !MaglevTable::IsPrime(table_size_))) {
+        errors->AddError(absl::StrCat("must be a prime no larger than ",
+                                      MaglevTable::kMaxTableSize));
+      }
+    }
+    ValidateHashBalanceFactor(hash_balance_factor_, errors);
+  }
+
+ private:
+  uint64_t table_size_ = MaglevTable::kDefaultTableSize;
+  std::string request_hash_header_;
+  std::optional<uint32_t> hash_balance_factor_;
 };
 
 //
 // ring_hash LB policy
 //
+// This also implements the maglev policy, which differs only in the table
+// it maps request hashes with.
+//
 
 constexpr size_t kRingSizeCapDefault = 4096;
 
 class RingHash final : public LoadBalancingPolicy {
  public:
-  explicit RingHash(Args args);
+  // name is kRingHash or kMaglev.
+  RingHash(Args args, absl::string_view name);
 
-  absl::string_view name() const override { return kRingHash; }
+  absl::string_view name() const override { return name_; }
 
   absl::Status UpdateLocked(UpdateArgs args) override;
   void ResetBackoffLocked() override;
 
  private:
-  // A ring computed based on a config and address list.
-  class Ring final : public RefCounted<Ring> {
-   public:
-    struct RingEntry {
-      uint64_t hash;
-      size_t endpoint_index;  // Index into RingHash::endpoints_.
-    };
-
-    Ring(RingHash* ring_hash, RingHashLbConfig* config);
-
-    const std::vector<RingEntry>& ring() const { return ring_; }
-
-   private:
-    std::vector<RingEntry> ring_;
-  };
+  // Tables with at least this many positions are built off the
+  // WorkSerializer, when the ring_hash_async_table_build experiment is on.
+  static constexpr uint64_t kMinAsyncTableBuildSize = 16384;
 
   // State for a particular endpoint.  Delegates to a pick_first child policy.
   class RingHashEndpoint final : public InternallyRefCounted<RingHashEndpoint> {
@@ -214,6 +277,14 @@ class RingHash final : public LoadBalancingPolicy {
 
     void ResetBackoffLocked();
 
+    // Track the calls in flight on this endpoint, and in the policy's
+    // total.  Used only when loads are bounded.
+    uint64_t calls_in_flight() const {
+      return calls_in_flight_.load(std::memory_order_relaxed);
+    }
+    void CallStarted();
+    void CallFinished();
+
     // If the child policy does not yet exist, creates it; otherwise,
     // asks the child to exit IDLE.
     void RequestConnectionLocked();
@@ -239,27 +310,66 @@ class RingHash final : public LoadBalancingPolicy {
     grpc_connectivity_state connectivity_state_ = GRPC_CHANNEL_IDLE;
     absl::Status status_;
     RefCountedPtr<SubchannelPicker> picker_;
+
+    std::atomic<uint64_t> calls_in_flight_{0};
   };
 
   class Picker final : public SubchannelPicker {
    public:
     explicit Picker(RefCountedPtr<RingHash> ring_hash)
         : ring_hash_(std::move(ring_hash)),
-          ring_(ring_hash_->ring_),
+          table_(ring_hash_->table_),
           endpoints_(ring_hash_->endpoints_.size()),
           resolution_note_(ring_hash_->resolution_note_),
-          request_hash_header_(ring_hash_->request_hash_header_) {
+          request_hash_header_(ring_hash_->request_hash_header_),
+          hash_balance_factor_(ring_hash_->hash_balance_factor_) {
       for (const auto& [_, endpoint] : ring_hash_->endpoint_map_) {
         endpoints_[endpoint->index()] = endpoint->GetInfoForPicker();
         if (endpoints_[endpoint->index()].state == GRPC_CHANNEL_CONNECTING) {
           has_endpoint_in_connecting_state_ = true;
         }
+        if (endpoints_[endpoint->index()].state == GRPC_CHANNEL_READY) {
+          ++num_ready_;
+        }
       }
     }
 
     PickResult Pick(PickArgs args) override;
 
    private:
+    // Counts a call against its endpoint while it is in flight.
+    class SubchannelCallTracker final : public SubchannelCallTrackerInterface {
+     public:
+      SubchannelCallTracker(
+          RefCountedPtr<RingHashEndpoint> endpoint,
+          std::unique_ptr<SubchannelCallTrackerInterface> child_tracker)
+          : endpoint_(std::move(endpoint)),
+            child_tracker_(std::move(child_tracker)) {}
+
+      void Start() override {
+        endpoint_->CallStarted();
+        if (child_tracker_ != nullptr) child_tracker_->Start();
+      }
+
+      void Finish(FinishArgs args) override {
+        if (child_tracker_ != nullptr) child_tracker_->Finish(args);
+        endpoint_->CallFinished();
+      }
+
+     private:
+      RefCountedPtr<RingHashEndpoint> endpoint_;
+      std::unique_ptr<SubchannelCallTrackerInterface> child_tracker_;
+    };
+
+    // Returns true if loads are bounded and the endpoint is already at its
+    // share of them.
+    bool IsOverloaded(const RingHashEndpoint::EndpointInfo& endpoint_info);
+
+    // Delegates the pick to the endpoint, tracking the call if loads are
+    // bounded.
+    PickResult PickFromEndpoint(
+        const RingHashEndpoint::EndpointInfo& endpoint_info, PickArgs args);
+
     // A fire-and-forget class that schedules endpoint connection attempts
     // on the control plane WorkSerializer.
     class EndpointConnectionAttempter final {
@@ -290,11 +400,13 @@ class RingHash final : public LoadBalancingPolicy {
     };
 
     RefCountedPtr<RingHash> ring_hash_;
-    RefCountedPtr<Ring> ring_;
+    RefCountedPtr<EndpointHashTable> table_;
     std::vector<RingHashEndpoint::EndpointInfo> endpoints_;
     bool has_endpoint_in_connecting_state_ = false;
     std::string resolution_note_;
     RefCountedStringValue request_hash_header_;
+    uint32_t hash_balance_factor_;
+    size_t num_ready_ = 0;
   };
 
   ~RingHash() override;
@@ -310,11 +422,33 @@ class RingHash final : public LoadBalancingPolicy {
   void UpdateAggregatedConnectivityStateLocked(bool entered_transient_failure,
                                                absl::Status status);
 
-  // Current endpoint list, channel args, and ring.
+  EndpointHashTableKey MakeTableKey(const EndpointAddressesList& endpoints,
+                                    const UpdateArgs& args) const;
+
+  // Builds the table for an update on the EventEngine, then applies the
+  // update unless a later one has superseded it.
+  void BuildTableAsync(EndpointHashTableKey key,
+                       EndpointAddressesList endpoints, UpdateArgs args);
+
+  // Makes endpoints, with table built from them, the current endpoint list.
+  absl::Status ApplyUpdateLocked(EndpointAddressesList endpoints,
+                                 UpdateArgs args,
+                                 RefCountedPtr<EndpointHashTable> table);
+
+  const absl::string_view name_;
+
+  // Current endpoint list, channel args, and table.
   EndpointAddressesList endpoints_;
   ChannelArgs args_;
   RefCountedStringValue request_hash_header_;
-  RefCountedPtr<Ring> ring_;
+  uint32_t hash_balance_factor_ = 0;
+  RefCountedPtr<EndpointHashTable> table_;
+  // Incremented by every update that replaces the table, so that a table
+  // built off the WorkSerializer is only applied if still wanted.
+  uint64_t table_build_generation_ = 0;
+
+  // Calls in flight across all endpoints, when loads are bounded.
+  std::atomic<uint64_t> total_calls_in_flight_{0};
 
   std::map<EndpointAddressSet, OrphanablePtr<RingHashEndpoint>> endpoint_map_;
   std::string resolution_note_;
@@ -333,6 +467,30 @@ class RingHash final : public LoadBalancingPolicy {
 // RingHash::Picker
 //
 
+bool RingHash::Picker::IsOverloaded(
+    const RingHashEndpoint::EndpointInfo& endpoint_info) {
+  if (hash_balance_factor_ == 0) return false;
+  // Consistent hashing with bounded loads: each READY endpoint may take
+  // ceil(factor * (total + 1) / num_ready) calls, counting the one being
+  // picked, so an endpoint is overloaded once it has that many.
+  const uint64_t total =
+      ring_hash_->total_calls_in_flight_.load(std::memory_order_relaxed);
+  return endpoint_info.endpoint->calls_in_flight() * num_ready_ * 100 >=
+         (total + 1) * hash_balance_factor_;
+}
+
+RingHash::PickResult RingHash::Picker::PickFromEndpoint(
+    const RingHashEndpoint::EndpointInfo& endpoint_info, PickArgs args) {
+  auto result = endpoint_info.picker->Pick(args);
+  if (hash_balance_factor_ == 0) return result;
+  auto* complete = std::get_if<PickResult::Complete>(&result.result);
+  if (complete != nullptr) {
+    complete->subchannel_call_tracker = std::make_unique<SubchannelCallTracker>(
+        endpoint_info.endpoint, std::move(complete->subchannel_call_tracker));
+  }
+  return result;
+}
+
 RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
   // Determine request hash.
   bool using_random_hash = false;
@@ -353,47 +511,35 @@ RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
     if (header_value.has_value()) {
       request_hash = XXH64(header_value->data(), header_value->size(), 0);
     } else {
-      request_hash = absl::Uniform<uint64_t>(absl::BitGen());
+      request_hash = FastRandom::Next();
       using_random_hash = true;
     }
   }
-  // Find the index in the ring to use for this RPC.
-  // Ported from https://github.com/RJ/ketama/blob/master/libketama/ketama.c
-  // (ketama_get_server) NOTE: The algorithm depends on using signed integers
-  // for lowp, highp, and index. Do not change them!
-  const auto& ring = ring_->ring();
-  int64_t lowp = 0;
-  int64_t highp = ring.size();
-  int64_t index = 0;
-  while (true) {
-    index = (lowp + highp) / 2;
-    if (index == static_cast<int64_t>(ring.size())) {
-      index = 0;
-      break;
-    }
-    uint64_t midval = ring[index].hash;
-    uint64_t midval1 = index == 0 ? 0 : ring[index - 1].hash;
-    if (request_hash <= midval && request_hash > midval1) {
-      break;
-    }
-    if (midval < request_hash) {
-      lowp = index + 1;
-    } else {
-      highp = index - 1;
-    }
-    if (lowp > highp) {
-      index = 0;
-      break;
-    }
-  }
+  // Find the position in the table to use for this RPC.
+  const EndpointHashTable& table = *table_;
+  const size_t index = table.Find(request_hash);
   // Find the first endpoint we can use from the selected index.
   if (!using_random_hash) {
-    for (size_t i = 0; i < ring.size(); ++i) {
-      const auto& entry = ring[(index + i) % ring.size()];
-      const auto& endpoint_info = endpoints_[entry.endpoint_index];
+    // With bounded loads, the first READY endpoint found that is already
+    // overloaded.  We walk on to the next READY endpoint that is not, and
+    // fall back to this one if there is none.
+    const RingHashEndpoint::EndpointInfo* overloaded_endpoint = nullptr;
+    for (size_t i = 0; i < table.size(); ++i) {
+      const auto& endpoint_info =
+          endpoints_[table.endpoint_index((index + i) % table.size())];
+      if (overloaded_endpoint != nullptr &&
+          endpoint_info.state != GRPC_CHANNEL_READY) {
+        continue;
+      }
       switch (endpoint_info.state) {
         case GRPC_CHANNEL_READY:
-          return endpoint_info.picker->Pick(args);
+          if (IsOverloaded(endpoint_info)) {
+            if (overloaded_endpoint == nullptr) {
+              overloaded_endpoint = &endpoint_info;
+            }
+            break;
+          }
+          return PickFromEndpoint(endpoint_info, args);
         case GRPC_CHANNEL_IDLE:
           new EndpointConnectionAttempter(
               ring_hash_.Ref(DEBUG_LOCATION, "EndpointConnectionAttempter"),
@@ -405,15 +551,18 @@ RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
           break;
       }
     }
+    if (overloaded_endpoint != nullptr) {
+      return PickFromEndpoint(*overloaded_endpoint, args);
+    }
   } else {
     // Using a random hash.  We will use the first READY endpoint we
     // find, triggering at most one endpoint to attempt connecting.
     bool requested_connection = has_endpoint_in_connecting_state_;
-    for (size_t i = 0; i < ring.size(); ++i) {
-      const auto& entry = ring[(index + i) % ring.size()];
-      const auto& endpoint_info = endpoints_[entry.endpoint_index];
+    for (size_t i = 0; i < table.size(); ++i) {
+      const auto& endpoint_info =
+          endpoints_[table.endpoint_index((index + i) % table.size())];
       if (endpoint_info.state == GRPC_CHANNEL_READY) {
-        return endpoint_info.picker->Pick(args);
+        return PickFromEndpoint(endpoint_info, args);
       }
       if (!requested_connection && endpoint_info.state == GRPC_CHANNEL_IDLE) {
         new EndpointConnectionAttempter(
@@ -426,117 +575,13 @@ RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
   }
   std::string message = absl::StrCat(
       "ring hash cannot find a connected endpoint; first failure: ",
-      endpoints_[ring[index].endpoint_index].status.message());
+      endpoints_[table.endpoint_index(index)].status.message());
   if (!resolution_note_.empty()) {
     absl::StrAppend(&message, " (", resolution_note_, ")");
   }
   return PickResult::Fail(absl::UnavailableError(message));
 }
 
-//
-// RingHash::Ring
-//
-
-RingHash::Ring::Ring(RingHash* ring_hash, RingHashLbConfig* config) {
-  // Store the weights while finding the sum.
-  struct EndpointWeight {
-    std::string hash_key;  // By default, endpoint's first address.
-    // Default weight is 1 for the cases where a weight is not provided,
-    // each occurrence of the address will be counted a weight value of 1.
-    uint32_t weight = 1;
-    double normalized_weight;
-  };
-  std::vector<EndpointWeight> endpoint_weights;
-  size_t sum = 0;
-  const EndpointAddressesList& endpoints = ring_hash->endpoints_;
-  endpoint_weights.reserve(endpoints.size());
-  for (const auto& endpoint : endpoints) {
-    EndpointWeight endpoint_weight;
-    auto hash_key =
-        endpoint.args().GetString(GRPC_ARG_RING_HASH_ENDPOINT_HASH_KEY);
-    if (hash_key.has_value()) {
-      endpoint_weight.hash_key = std::string(*hash_key);
-    } else {
-      endpoint_weight.hash_key =
-          grpc_sockaddr_to_string(&endpoint.addresses().front(), false).value();
-    }
-    // Weight should never be zero, but ignore it just in case, since
-    // that value would screw up the ring-building algorithm.
-    auto weight_arg = endpoint.args().GetInt(GRPC_ARG_ADDRESS_WEIGHT);
-    if (weight_arg.value_or(0) > 0) {
-      endpoint_weight.weight = *weight_arg;
-    }
-    sum += endpoint_weight.weight;
-    endpoint_weights.push_back(std::move(endpoint_weight));
-  }
-  // Calculating normalized weights and find min and max.
-  double min_normalized_weight = 1.0;
-  double max_normalized_weight = 0.0;
-  for (auto& endpoint_weight : endpoint_weights) {
-    endpoint_weight.normalized_weight =
-        static_cast<double>(endpoint_weight.weight) / sum;
-    min_normalized_weight =
-        std::min(endpoint_weight.normalized_weight, min_normalized_weight);
-    max_normalized_weight =
-        std::max(endpoint_weight.normalized_weight, max_normalized_weight);
-  }
-  // Scale up the number of hashes per host such that the least-weighted host
-  // gets a whole number of hashes on the ring. Other hosts might not end up
-  // with whole numbers, and that's fine (the ring-building algorithm below can
-  // handle this). This preserves the original implementation's behavior: when
-  // weights aren't provided, all hosts should get an equal number of hashes. In
-  // the case where this number exceeds the max_ring_size, it's scaled back down
-  // to fit.
-  const size_t ring_size_cap =
-      ring_hash->args_.GetInt(GRPC_ARG_RING_HASH_LB_RING_SIZE_CAP)
-          .value_or(kRingSizeCapDefault);
-  const size_t min_ring_size = std::min(config->min_ring_size(), ring_size_cap);
-  const size_t max_ring_size = std::min(config->max_ring_size(), ring_size_cap);
-  const double scale = std::min(
-      std::ceil(min_normalized_weight * min_ring_size) / min_normalized_weight,
-      static_cast<double>(max_ring_size));
-  // Reserve memory for the entire ring up front.
-  const uint64_t ring_size = std::ceil(scale);
-  ring_.reserve(ring_size);
-  // Populate the hash ring by walking through the (host, weight) pairs in
-  // normalized_host_weights, and generating (scale * weight) hashes for each
-  // host. Since these aren't necessarily whole numbers, we maintain running
-  // sums -- current_hashes and target_hashes -- which allows us to populate the
-  // ring in a mostly stable way.
-  absl::InlinedVector<char, 196> hash_key_buffer;
-  double current_hashes = 0.0;
-  double target_hashes = 0.0;
-  uint64_t min_hashes_per_host = ring_size;
-  uint64_t max_hashes_per_host = 0;
-  for (size_t i = 0; i < endpoints.size(); ++i) {
-    const std::string& hash_key = endpoint_weights[i].hash_key;
-    hash_key_buffer.assign(hash_key.begin(), hash_key.end());
-    hash_key_buffer.emplace_back('_');
-    auto offset_start = hash_key_buffer.end();
-    target_hashes += scale * endpoint_weights[i].normalized_weight;
-    size_t count = 0;
-    while (current_hashes < target_hashes) {
-      const std::string count_str = absl::StrCat(count);
-      hash_key_buffer.insert(offset_start, count_str.begin(), count_str.end());
-      absl::string_view hash_key(hash_key_buffer.data(),
-                                 hash_key_buffer.size());
-      const uint64_t hash = XXH64(hash_key.data(), hash_key.size(), 0);
-      ring_.push_back({hash, i});
-      ++count;
-      ++current_hashes;
-      hash_key_buffer.erase(offset_start, hash_key_buffer.end());
-    }
-    min_hashes_per_host =
-        std::min(static_cast<uint64_t>(i), min_hashes_per_host);
-    max_hashes_per_host =
-        std::max(static_cast<uint64_t>(i), max_hashes_per_host);
-  }
-  std::sort(ring_.begin(), ring_.end(),
-            [](const RingEntry& lhs, const RingEntry& rhs) -> bool {
-              return lhs.hash < rhs.hash;
-            });
-}
-
 //
 // RingHash::RingHashEndpoint::Helper
 //
@@ -588,6 +633,16 @@ void RingHash::RingHashEndpoint::ResetBackoffLocked() {
   if (child_policy_ != nullptr) child_policy_->ResetBackoffLocked();
 }
 
+void RingHash::RingHashEndpoint::CallStarted() {
+  calls_in_flight_.fetch_add(1, std::memory_order_relaxed);
+  ring_hash_->total_calls_in_flight_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void RingHash::RingHashEndpoint::CallFinished() {
+  calls_in_flight_.fetch_sub(1, std::memory_order_relaxed);
+  ring_hash_->total_calls_in_flight_.fetch_sub(1, std::memory_order_relaxed);
+}
+
 void RingHash::RingHashEndpoint::RequestConnectionLocked() {
   if (child_policy_ == nullptr) {
     CreateChildPolicy();
@@ -676,7 +731,8 @@ void RingHash::RingHashEndpoint::OnStateUpdate(
 // RingHash
 //
 
-RingHash::RingHash(Args args) : LoadBalancingPolicy(std::move(args)) {
+RingHash::RingHash(Args args, absl::string_view name)
+    : LoadBalancingPolicy(std::move(args)), name_(name) {
   GRPC_TRACE_LOG(ring_hash_lb, INFO) << "[RH " << this << "] Created";
 }
 
@@ -698,18 +754,18 @@ void RingHash::ResetBackoffLocked() {
 }
 
 absl::Status RingHash::UpdateLocked(UpdateArgs args) {
+  EndpointAddressesList endpoints;
   // Check address list.
   if (args.addresses.ok()) {
     GRPC_TRACE_LOG(ring_hash_lb, INFO) << "[RH " << this << "] received update";
     // De-dup endpoints, taking weight into account.
-    endpoints_.clear();
     std::map<EndpointAddressSet, size_t> endpoint_indices;
     (*args.addresses)->ForEach([&](const EndpointAddresses& endpoint) {
       const EndpointAddressSet key(endpoint.addresses());
-      auto [it, inserted] = endpoint_indices.emplace(key, endpoints_.size());
+      auto [it, inserted] = endpoint_indices.emplace(key, endpoints.size());
       if (!inserted) {
         // Duplicate endpoint.  Combine weights and skip the dup.
-        EndpointAddresses& prev_endpoint = endpoints_[it->second];
+        EndpointAddresses& prev_endpoint = endpoints[it->second];
         int weight_arg =
             endpoint.args().GetInt(GRPC_ARG_ADDRESS_WEIGHT).value_or(1);
         int prev_weight_arg =
@@ -723,7 +779,7 @@ absl::Status RingHash::UpdateLocked(UpdateArgs args) {
             prev_endpoint.args().Set(GRPC_ARG_ADDRESS_WEIGHT,
                                      weight_arg + prev_weight_arg));
       } else {
-        endpoints_.push_back(endpoint);
+        endpoints.push_back(endpoint);
       }
     });
   } else {
@@ -734,13 +790,95 @@ absl::Status RingHash::UpdateLocked(UpdateArgs args) {
     // list, but still report back that the update was not accepted.
     if (!endpoints_.empty()) return args.addresses.status();
   }
+  // Find the new table, or build it.
+  EndpointHashTableKey key = MakeTableKey(endpoints, args);
+  RefCountedPtr<EndpointHashTable> table = EndpointHashTable::FindShared(key);
+  if (table == nullptr) {
+    // A large table is built off the WorkSerializer.  Meanwhile, we keep
+    // using the current table, and so the endpoint list its positions
+    // refer to.
+    if (IsRingHashAsyncTableBuildEnabled() && table_ != nullptr &&
+        key.min_size >= kMinAsyncTableBuildSize) {
+      BuildTableAsync(std::move(key), std::move(endpoints), std::move(args));
+      return absl::OkStatus();
+    }
+    table = EndpointHashTable::BuildShared(std::move(key), endpoints);
+  }
+  // Supersede any table still being built for an earlier update.
+  ++table_build_generation_;
+  return ApplyUpdateLocked(std::move(endpoints), std::move(args),
+                           std::move(table));
+}
+
+EndpointHashTableKey RingHash::MakeTableKey(
+    const EndpointAddressesList& endpoints, const UpdateArgs& args) const {
+  if (name_ == kMaglev) {
+    auto* config = DownCast<const MaglevLbConfig*>(args.config.get());
+    return EndpointHashTableKey::ForMaglevTable(endpoints,
+                                                config->table_size());
+  }
+  auto* config = DownCast<const RingHashLbConfig*>(args.config.get());
+  const size_t ring_size_cap =
+      args.args.GetInt(GRPC_ARG_RING_HASH_LB_RING_SIZE_CAP)
+          .value_or(kRingSizeCapDefault);
+  return EndpointHashTableKey::ForHashRing(
+      endpoints, std::min(config->min_ring_size(), ring_size_cap),
+      std::min(config->max_ring_size(), ring_size_cap));
+}
+
+void RingHash::BuildTableAsync(EndpointHashTableKey key,
+                               EndpointAddressesList endpoints,
+                               UpdateArgs args) {
+  const uint64_t generation = ++table_build_generation_;
+  GRPC_TRACE_LOG(ring_hash_lb, INFO)
+      << "[RH " << this << "] building table of at least " << key.min_size
+      << " positions for " << endpoints.size() << " endpoints";
+  channel_control_helper()->GetEventEngine()->Run(
+      [self = RefAsSubclass<RingHash>(), generation, key = std::move(key),
+       endpoints = std::move(endpoints), args = std::move(args)]() mutable {
+        ApplicationCallbackExecCtx application_exec_ctx;
+        ExecCtx exec_ctx;
+        auto table = EndpointHashTable::BuildShared(std::move(key), endpoints);
+        auto* ring_hash = self.get();
+        ring_hash->work_serializer()->Run([self = std::move(self), generation,
+                                           endpoints = std::move(endpoints),
+                                           args = std::move(args),
+                                           table = std::move(table)]() mutable {
+          // A later update, or shutdown, supersedes this one.
+          if (self->shutdown_ ||
+              generation != self->table_build_generation_) {
+            return;
+          }
+          absl::Status status = self->ApplyUpdateLocked(
+              std::move(endpoints), std::move(args), std::move(table));
+          if (!status.ok()) {
+            GRPC_TRACE_LOG(ring_hash_lb, INFO)
+                << "[RH " << self.get()
+                << "] update applied with errors: " << status;
+          }
+        });
+      });
+}
+
+absl::Status RingHash::ApplyUpdateLocked(
+    EndpointAddressesList endpoints, UpdateArgs args,
+    RefCountedPtr<EndpointHashTable> table) {
+  endpoints_ = std::move(endpoints);
   // Save channel args.
   args_ = std::move(args.args);
-  // Save config.
-  auto* config = DownCast<RingHashLbConfig*>(args.config.get());
-  request_hash_header_ = RefCountedStringValue(config->request_hash_header());
-  // Build new ring.
-  ring_ = MakeRefCounted<Ring>(this, config);
+  // Save config and the new table.
+  if (name_ == kMaglev) {
+    auto* config = DownCast<MaglevLbConfig*>(args.config.get());
+    request_hash_header_ =
+        RefCountedStringValue(config->request_hash_header());
+    hash_balance_factor_ = config->hash_balance_factor();
+  } else {
+    auto* config = DownCast<RingHashLbConfig*>(args.config.get());
+    request_hash_header_ =
+        RefCountedStringValue(config->request_hash_header());
+    hash_balance_factor_ = config->hash_balance_factor();
+  }
+  table_ = std::move(table);
   // Update endpoint map.
   std::map<EndpointAddressSet, OrphanablePtr<RingHashEndpoint>> endpoint_map;
   std::vector<std::string> errors;
@@ -936,7 +1074,7 @@ class RingHashFactory final : public LoadBalancingPolicyFactory {
  public:
   OrphanablePtr<LoadBalancingPolicy> CreateLoadBalancingPolicy(
       LoadBalancingPolicy::Args args) const override {
-    return MakeOrphanable<RingHash>(std::move(args));
+    return MakeOrphanable<RingHash>(std::move(args), kRingHash);
   }
 
   absl::string_view name() const override { return kRingHash; }
@@ -949,6 +1087,22 @@ class RingHashFactory final : public LoadBalancingPolicyFactory {
   }
 };
 
+class MaglevFactory final : public LoadBalancingPolicyFactory {
+ public:
+  OrphanablePtr<LoadBalancingPolicy> CreateLoadBalancingPolicy(
+      LoadBalancingPolicy::Args args) const override {
+    return MakeOrphanable<RingHash>(std::move(args), kMaglev);
+  }
+
+  absl::string_view name() const override { return kMaglev; }
+
+  absl::StatusOr<RefCountedPtr<LoadBalancingPolicy::Config>>
+  ParseLoadBalancingConfig(const Json& json) const override {
+    return LoadFromJson<RefCountedPtr<MaglevLbConfig>>(
+        json, RingHashJsonArgs(), "errors validating maglev LB policy config");
+  }
+};
+
 }  // namespace
 
 void RegisterRingHashLbPolicy(CoreConfiguration::Builder* builder) {
@@ -956,4 +1110,9 @@ void RegisterRingHashLbPolicy(CoreConfiguration::Builder* builder) {
       std::make_unique<RingHashFactory>());
 }
 
+void RegisterMaglevLbPolicy(CoreConfiguration::Builder* builder) {
+  builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
+      std::make_unique<MaglevFactory>());
+}
+
 }  // namespace grpc_core
@@ -38,6 +38,7 @@
 #include <string.h>
 
 #include <algorithm>
+#include <atomic>
 #include <deque>
 #include <list>
 #include <map>
@@ -67,6 +68,7 @@
 #include "src/core/config/core_configuration.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
@@ -96,6 +98,7 @@
 #include "src/core/util/json/json_writer.h"
 #include "src/core/util/match.h"
 #include "src/core/util/orphanable.h"
+#include "src/core/util/ref_counted.h"
 #include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/status_helper.h"
 #include "src/core/util/sync.h"
@@ -182,6 +185,14 @@ const Duration kDefaultThrottleWindowSize = Duration::Seconds(30);
 const double kDefaultThrottleRatioForSuccesses = 2.0;
 const int kDefaultThrottlePadding = 8;
 const Duration kCacheCleanupTimerInterval = Duration::Minutes(1);
+// Entries picked at least this many times since their data arrived are
+// refreshed once this fraction of stale_age has passed, instead of waiting
+// for a pick to find them stale.
+const uint32_t kRefreshAheadMinHits = 8;
+const double kRefreshAheadFraction = 0.75;
+// Refreshes ahead of time are skipped while this many RLS requests are
+// pending, so that hot keys coming due together don't flood the server.
+const size_t kMaxPendingRequestsForRefreshAhead = 8;
 const int64_t kMaxCacheSizeBytes = 5 * 1024 * 1024;
 
 // RLS LB policy.
@@ -289,6 +300,11 @@ class RlsLb final : public LoadBalancingPolicy {
       return connectivity_state_;
     }
 
+    RefCountedPtr<SubchannelPicker> picker() const
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_) {
+      return picker_;
+    }
+
    private:
     // ChannelControlHelper object that allows the child policy to update state
     // with the wrapper.
@@ -331,11 +347,51 @@ class RlsLb final : public LoadBalancingPolicy {
         ABSL_GUARDED_BY(&RlsLb::mu_);
   };
 
+  class Cache;
+
+  // An immutable copy of the cache entries that had usable data when a
+  // picker was created.  The picker routes requests for those entries
+  // without acquiring mu_, and falls back to the cache itself for keys
+  // that are missing from the snapshot or whose data has gone stale.
+  class CacheSnapshot final : public RefCounted<CacheSnapshot> {
+   public:
+    struct Target {
+      std::string target;
+      grpc_connectivity_state connectivity_state;
+      RefCountedPtr<SubchannelPicker> picker;
+    };
+
+    struct Entry {
+      std::vector<Target> targets;
+      grpc_event_engine::experimental::Slice header_data;
+      Timestamp data_expiration_time;
+      Timestamp stale_time;
+      Timestamp refresh_ahead_time;
+      // Counts (up to kRefreshAheadMinHits) the picks routed using the
+      // entry, so that the next snapshot can move it to the end of the
+      // cache's LRU list and credit the hits to it.
+      mutable std::atomic<uint32_t> hits{0};
+      // Set once a pick has considered refreshing the entry ahead of time.
+      mutable std::atomic<bool> refresh_ahead_checked{false};
+    };
+
+    // Returns the entry for key if its data is neither stale nor expired
+    // at now, or else nullptr.
+    const Entry* Find(const RequestKey& key, Timestamp now) const;
+
+   private:
+    friend class Cache;
+
+    std::unordered_map<RequestKey, Entry, absl::Hash<RequestKey>> entries_;
+  };
+
   // A picker that uses the cache and the request map in the LB policy
-  // (synchronized via a mutex) to determine how to route requests.
+  // (synchronized via a mutex) to determine how to route requests.  If
+  // given a cache snapshot, requests for fresh entries are routed from it.
   class Picker final : public LoadBalancingPolicy::SubchannelPicker {
    public:
-    explicit Picker(RefCountedPtr<RlsLb> lb_policy);
+    Picker(RefCountedPtr<RlsLb> lb_policy,
+           RefCountedPtr<CacheSnapshot> cache_snapshot);
 
     PickResult Pick(PickArgs args) override;
 
@@ -344,9 +400,17 @@ class RlsLb final : public LoadBalancingPolicy {
                                            absl::Status status)
         ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_);
 
+    PickResult PickFromSnapshot(const CacheSnapshot::Entry& entry,
+                                PickArgs args);
+
+    void MaybeRefreshAheadFromSnapshot(const RequestKey& key,
+                                       const CacheSnapshot::Entry& entry,
+                                       Timestamp now);
+
     RefCountedPtr<RlsLb> lb_policy_;
     RefCountedPtr<RlsLbConfig> config_;
     RefCountedPtr<ChildPolicyWrapper> default_child_policy_;
+    RefCountedPtr<CacheSnapshot> cache_snapshot_;
   };
 
   // An LRU cache with adjustable size.
@@ -384,6 +448,10 @@ class RlsLb final : public LoadBalancingPolicy {
           ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_) {
         return header_data_;
       }
+      const std::vector<RefCountedPtr<ChildPolicyWrapper>>&
+      child_policy_wrappers() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_) {
+        return child_policy_wrappers_;
+      }
       Timestamp stale_time() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_) {
         return stale_time_;
       }
@@ -391,6 +459,22 @@ class RlsLb final : public LoadBalancingPolicy {
           ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_) {
         return min_expiration_time_;
       }
+      Timestamp refresh_ahead_time() const
+          ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_) {
+        return refresh_ahead_time_;
+      }
+
+      // Records picks routed using the entry's data.
+      void RecordHits(uint32_t hits)
+          ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_) {
+        hits_ = std::min(hits_ + hits, kRefreshAheadMinHits);
+      }
+
+      // Returns true if the entry's data is still fresh but it has been
+      // picked often enough to be refreshed ahead of going stale.
+      // extra_hits are picks not yet recorded via RecordHits().
+      bool ShouldRefreshAhead(Timestamp now, uint32_t extra_hits) const
+          ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_);
 
       std::unique_ptr<BackOff> TakeBackoffState()
           ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_) {
@@ -477,6 +561,10 @@ class RlsLb final : public LoadBalancingPolicy {
       Timestamp data_expiration_time_ ABSL_GUARDED_BY(&RlsLb::mu_) =
           Timestamp::InfPast();
       Timestamp stale_time_ ABSL_GUARDED_BY(&RlsLb::mu_) = Timestamp::InfPast();
+      Timestamp refresh_ahead_time_ ABSL_GUARDED_BY(&RlsLb::mu_) =
+          Timestamp::InfFuture();
+      // Picks since the data was last updated, up to kRefreshAheadMinHits.
+      uint32_t hits_ ABSL_GUARDED_BY(&RlsLb::mu_) = 0;
 
       Timestamp min_expiration_time_ ABSL_GUARDED_BY(&RlsLb::mu_);
       Cache::Iterator lru_iterator_ ABSL_GUARDED_BY(&RlsLb::mu_);
@@ -510,6 +598,12 @@ class RlsLb final : public LoadBalancingPolicy {
     // Resets backoff of all the cache entries.
     void ResetAllBackoff() ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_);
 
+    // Returns a snapshot of the entries whose data is currently usable.
+    // Entries of previous (if non-null) that picks were routed from are
+    // first marked as used, as if those picks had found them in the cache.
+    RefCountedPtr<CacheSnapshot> Snapshot(const CacheSnapshot* previous)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_);
+
     // Shutdown the cache; clean-up and orphan all the stored cache entries.
     GRPC_MUST_USE_RESULT std::vector<RefCountedPtr<ChildPolicyWrapper>>
     Shutdown() ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_);
@@ -693,9 +787,19 @@ class RlsLb final : public LoadBalancingPolicy {
   // Updates the picker in the work serializer.
   void UpdatePickerLocked() ABSL_LOCKS_EXCLUDED(&mu_);
 
+  // Starts an RLS request for entry if it is due to be refreshed ahead of
+  // going stale and the request would not add to a backlog.
+  void MaybeRefreshAheadLocked(const RequestKey& key, Cache::Entry* entry,
+                               Timestamp now, uint32_t extra_hits = 0)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(&mu_);
+
   template <typename HandleType>
   void MaybeExportPickCount(HandleType handle, absl::string_view target,
                             const PickResult& pick_result);
+  template <typename HandleType>
+  void MaybeExportPickCount(HandleType handle, const RlsLbConfig& config,
+                            absl::string_view target,
+                            const PickResult& pick_result);
 
   const std::string instance_uuid_;
 
@@ -709,6 +813,8 @@ class RlsLb final : public LoadBalancingPolicy {
   std::unordered_map<RequestKey, OrphanablePtr<RlsRequest>,
                      absl::Hash<RequestKey>>
       request_map_ ABSL_GUARDED_BY(mu_);
+  // The cache snapshot given to the most recent picker, if any.
+  RefCountedPtr<CacheSnapshot> cache_snapshot_ ABSL_GUARDED_BY(mu_);
   // The channel on which RLS requests are sent.
   // Note that this channel may be swapped out when the RLS policy gets
   // an update.  However, when that happens, any existing entries in
@@ -948,8 +1054,35 @@ std::map<std::string, std::string> BuildKeyMap(
   return key_map;
 }
 
-RlsLb::Picker::Picker(RefCountedPtr<RlsLb> lb_policy)
-    : lb_policy_(std::move(lb_policy)), config_(lb_policy_->config_) {
+//
+// RlsLb::CacheSnapshot
+//
+
+const RlsLb::CacheSnapshot::Entry* RlsLb::CacheSnapshot::Find(
+    const RequestKey& key, Timestamp now) const {
+  auto it = entries_.find(key);
+  if (it == entries_.end()) return nullptr;
+  const Entry& entry = it->second;
+  if (entry.stale_time < now || entry.data_expiration_time < now) {
+    return nullptr;
+  }
+  // Stop counting once the entry is hot, so that picks on it don't all
+  // write its line.
+  if (entry.hits.load(std::memory_order_relaxed) < kRefreshAheadMinHits) {
+    entry.hits.fetch_add(1, std::memory_order_relaxed);
+  }
+  return &entry;
+}
+
+//
+// RlsLb::Picker
+//
+
+RlsLb::Picker::Picker(RefCountedPtr<RlsLb> lb_policy,
+                      RefCountedPtr<CacheSnapshot> cache_snapshot)
+    : lb_policy_(std::move(lb_policy)),
+      config_(lb_policy_->config_),
+      cache_snapshot_(std::move(cache_snapshot)) {
   if (lb_policy_->default_child_policy_ != nullptr) {
     default_child_policy_ =
         lb_policy_->default_child_policy_->Ref(DEBUG_LOCATION, "Picker");
@@ -966,6 +1099,25 @@ LoadBalancingPolicy::PickResult RlsLb::Picker::Pick(PickArgs args) {
       << "[rlslb " << lb_policy_.get() << "] picker=" << this
       << ": request keys: " << key.ToString();
   Timestamp now = Timestamp::Now();
+  // Requests for entries with fresh data don't need the lock: neither
+  // starting an RLS request nor anything in the request map matters to
+  // them.
+  if (cache_snapshot_ != nullptr) {
+    const CacheSnapshot::Entry* entry = cache_snapshot_->Find(key, now);
+    if (entry != nullptr) {
+      GRPC_TRACE_LOG(rls_lb, INFO)
+          << "[rlslb " << lb_policy_.get() << "] picker=" << this
+          << ": using cache snapshot entry " << entry;
+      // Only the first pick past the refresh-ahead time takes the lock.
+      if (entry->refresh_ahead_time <= now &&
+          !entry->refresh_ahead_checked.load(std::memory_order_relaxed) &&
+          !entry->refresh_ahead_checked.exchange(true,
+                                                 std::memory_order_relaxed)) {
+        MaybeRefreshAheadFromSnapshot(key, *entry, now);
+      }
+      return PickFromSnapshot(*entry, args);
+    }
+  }
   MutexLock lock(&lb_policy_->mu_);
   if (lb_policy_->is_shutdown_) {
     return PickResult::Fail(
@@ -973,6 +1125,10 @@ LoadBalancingPolicy::PickResult RlsLb::Picker::Pick(PickArgs args) {
   }
   // Check if there's a cache entry.
   Cache::Entry* entry = lb_policy_->cache_.Find(key);
+  if (entry != nullptr) {
+    entry->RecordHits(1);
+    lb_policy_->MaybeRefreshAheadLocked(key, entry, now);
+  }
   // If there is no cache entry, or if the cache entry is not in backoff
   // and has a stale time in the past, and there is not already a
   // pending RLS request for this key, then try to start a new RLS request.
@@ -1043,6 +1199,47 @@ LoadBalancingPolicy::PickResult RlsLb::Picker::PickFromDefaultTargetOrFail(
   return PickResult::Fail(std::move(status));
 }
 
+void RlsLb::Picker::MaybeRefreshAheadFromSnapshot(
+    const RequestKey& key, const CacheSnapshot::Entry& entry, Timestamp now) {
+  MutexLock lock(&lb_policy_->mu_);
+  if (lb_policy_->is_shutdown_) return;
+  Cache::Entry* cache_entry = lb_policy_->cache_.Find(key);
+  if (cache_entry == nullptr) return;
+  lb_policy_->MaybeRefreshAheadLocked(
+      key, cache_entry, now, entry.hits.load(std::memory_order_relaxed));
+}
+
+LoadBalancingPolicy::PickResult RlsLb::Picker::PickFromSnapshot(
+    const CacheSnapshot::Entry& entry, PickArgs args) {
+  // As in Cache::Entry::Pick(), skip targets before the last one that are
+  // in state TRANSIENT_FAILURE.
+  size_t i = 0;
+  while (i < entry.targets.size() - 1 &&
+         entry.targets[i].connectivity_state ==
+             GRPC_CHANNEL_TRANSIENT_FAILURE) {
+    ++i;
+  }
+  const CacheSnapshot::Target& target = entry.targets[i];
+  GRPC_TRACE_LOG(rls_lb, INFO)
+      << "[rlslb " << lb_policy_.get() << "] picker=" << this << ": target "
+      << target.target << " (" << i << " of " << entry.targets.size()
+      << ") in state " << ConnectivityStateName(target.connectivity_state)
+      << "; delegating";
+  auto pick_result = target.picker->Pick(args);
+  lb_policy_->MaybeExportPickCount(kMetricTargetPicks, *config_,
+                                   target.target, pick_result);
+  // Add header data.
+  if (!entry.header_data.empty()) {
+    auto* complete_pick =
+        std::get_if<PickResult::Complete>(&pick_result.result);
+    if (complete_pick != nullptr) {
+      complete_pick->metadata_mutations.Set(kRlsHeaderKey,
+                                            entry.header_data.Ref());
+    }
+  }
+  return pick_result;
+}
+
 //
 // RlsLb::Cache::Entry::BackoffTimer
 //
@@ -1192,6 +1389,12 @@ bool RlsLb::Cache::Entry::ShouldRemove() const {
   return data_expiration_time_ < now && backoff_expiration_time_ < now;
 }
 
+bool RlsLb::Cache::Entry::ShouldRefreshAhead(Timestamp now,
+                                             uint32_t extra_hits) const {
+  return refresh_ahead_time_ <= now && stale_time_ >= now &&
+         backoff_time_ < now && hits_ + extra_hits >= kRefreshAheadMinHits;
+}
+
 bool RlsLb::Cache::Entry::CanEvict() const {
   Timestamp now = Timestamp::Now();
   return min_expiration_time_ < now;
@@ -1233,6 +1436,11 @@ RlsLb::Cache::Entry::OnRlsResponseLocked(
   Timestamp now = Timestamp::Now();
   data_expiration_time_ = now + lb_policy_->config_->max_age();
   stale_time_ = now + lb_policy_->config_->stale_age();
+  refresh_ahead_time_ =
+      IsRlsRefreshAheadEnabled()
+          ? now + lb_policy_->config_->stale_age() * kRefreshAheadFraction
+          : Timestamp::InfFuture();
+  hits_ = 0;
   status_ = absl::OkStatus();
   backoff_state_.reset();
   backoff_time_ = Timestamp::InfPast();
@@ -1306,6 +1514,44 @@ RlsLb::Cache::Entry* RlsLb::Cache::Find(const RequestKey& key) {
   return it->second.get();
 }
 
+RefCountedPtr<RlsLb::CacheSnapshot> RlsLb::Cache::Snapshot(
+    const CacheSnapshot* previous) {
+  if (previous != nullptr) {
+    for (const auto& [key, entry] : previous->entries_) {
+      const uint32_t hits = entry.hits.load(std::memory_order_relaxed);
+      if (hits == 0) continue;
+      Entry* cache_entry = Find(key);
+      if (cache_entry != nullptr) cache_entry->RecordHits(hits);
+    }
+  }
+  auto snapshot = MakeRefCounted<CacheSnapshot>();
+  Timestamp now = Timestamp::Now();
+  for (const auto& [key, entry] : map_) {
+    if (entry->stale_time() < now || entry->data_expiration_time() < now) {
+      continue;
+    }
+    const auto& child_policy_wrappers = entry->child_policy_wrappers();
+    if (child_policy_wrappers.empty()) continue;
+    std::vector<CacheSnapshot::Target> targets;
+    targets.reserve(child_policy_wrappers.size());
+    for (const auto& child_policy_wrapper : child_policy_wrappers) {
+      auto picker = child_policy_wrapper->picker();
+      if (picker == nullptr) break;
+      targets.push_back({child_policy_wrapper->target(),
+                         child_policy_wrapper->connectivity_state(),
+                         std::move(picker)});
+    }
+    if (targets.size() != child_policy_wrappers.size()) continue;
+    CacheSnapshot::Entry& snapshot_entry = snapshot->entries_[key];
+    snapshot_entry.targets = std::move(targets);
+    snapshot_entry.header_data = entry->header_data().Ref();
+    snapshot_entry.data_expiration_time = entry->data_expiration_time();
+    snapshot_entry.stale_time = entry->stale_time();
+    snapshot_entry.refresh_ahead_time = entry->refresh_ahead_time();
+  }
+  return snapshot;
+}
+
 RlsLb::Cache::Entry* RlsLb::Cache::FindOrInsert(
     const RequestKey& key, std::vector<RefCountedPtr<ChildPolicyWrapper>>*
                                child_policy_wrappers_to_delete) {
@@ -2046,11 +2292,13 @@ void RlsLb::ShutdownLocked() {
   std::vector<RefCountedPtr<ChildPolicyWrapper>>
       child_policy_wrappers_to_delete;
   OrphanablePtr<RlsChannel> rls_channel_to_delete;
+  RefCountedPtr<CacheSnapshot> cache_snapshot_to_delete;
   {
     MutexLock lock(&mu_);
     is_shutdown_ = true;
     config_.reset(DEBUG_LOCATION, "ShutdownLocked");
     child_policy_wrappers_to_delete = cache_.Shutdown();
+    cache_snapshot_to_delete = std::move(cache_snapshot_);
     request_map_.clear();
     rls_channel_to_delete = std::move(rls_channel_);
     child_policy_to_delete = std::move(default_child_policy_);
@@ -2124,14 +2372,46 @@ void RlsLb::UpdatePickerLocked() {
   if (state == GRPC_CHANNEL_TRANSIENT_FAILURE) {
     status = absl::UnavailableError("no children available");
   }
+  RefCountedPtr<CacheSnapshot> cache_snapshot;
+  RefCountedPtr<CacheSnapshot> previous_cache_snapshot;
+  if (IsRlsLockFreeCacheReadsEnabled()) {
+    MutexLock lock(&mu_);
+    if (is_shutdown_) return;
+    // We want to unref the child pickers after we release the lock.
+    previous_cache_snapshot = std::move(cache_snapshot_);
+    cache_snapshot_ = cache_.Snapshot(previous_cache_snapshot.get());
+    cache_snapshot = cache_snapshot_;
+  }
   channel_control_helper()->UpdateState(
       state, status,
-      MakeRefCounted<Picker>(RefAsSubclass<RlsLb>(DEBUG_LOCATION, "Picker")));
+      MakeRefCounted<Picker>(RefAsSubclass<RlsLb>(DEBUG_LOCATION, "Picker"),
+                             std::move(cache_snapshot)));
+}
+
+void RlsLb::MaybeRefreshAheadLocked(const RequestKey& key, Cache::Entry* entry,
+                                    Timestamp now, uint32_t extra_hits) {
+  if (!entry->ShouldRefreshAhead(now, extra_hits)) return;
+  if (request_map_.size() >= kMaxPendingRequestsForRefreshAhead ||
+      request_map_.find(key) != request_map_.end()) {
+    return;
+  }
+  if (rls_channel_->ShouldThrottle()) return;
+  GRPC_TRACE_LOG(rls_lb, INFO)
+      << "[rlslb " << this << "] key=" << key.ToString()
+      << ": refreshing cache entry " << entry << " ahead of going stale";
+  rls_channel_->StartRlsCall(key, entry);
 }
 
 template <typename HandleType>
 void RlsLb::MaybeExportPickCount(HandleType handle, absl::string_view target,
                                  const PickResult& pick_result) {
+  MaybeExportPickCount(handle, *config_, target, pick_result);
+}
+
+template <typename HandleType>
+void RlsLb::MaybeExportPickCount(HandleType handle, const RlsLbConfig& config,
+                                 absl::string_view target,
+                                 const PickResult& pick_result) {
   absl::string_view pick_result_string = Match(
       pick_result.result,
       [](const LoadBalancingPolicy::PickResult::Complete&) {
@@ -2144,7 +2424,7 @@ void RlsLb::MaybeExportPickCount(HandleType handle, absl::string_view target,
   auto& stats_plugins = channel_control_helper()->GetStatsPluginGroup();
   stats_plugins.AddCounter(
       handle, 1,
-      {channel_control_helper()->GetTarget(), config_->lookup_service(), target,
+      {channel_control_helper()->GetTarget(), config.lookup_service(), target,
        pick_result_string},
       {});
 }
@@ -14,6 +14,7 @@
 // limitations under the License.
 //
 
+#include <grpc/event_engine/event_engine.h>
 #include <grpc/impl/connectivity_state.h>
 #include <grpc/support/port_platform.h>
 #include <inttypes.h>
@@ -21,6 +22,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <cmath>
 #include <memory>
 #include <optional>
 #include <string>
@@ -30,7 +32,6 @@
 #include "absl/log/absl_check.h"
 #include "absl/log/absl_log.h"
 #include "absl/meta/type_traits.h"
-#include "absl/random/random.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/str_cat.h"
@@ -38,15 +39,22 @@
 #include "src/core/config/core_configuration.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/transport/connectivity_state.h"
 #include "src/core/load_balancing/endpoint_list.h"
 #include "src/core/load_balancing/lb_policy.h"
 #include "src/core/load_balancing/lb_policy_factory.h"
 #include "src/core/resolver/endpoint_addresses.h"
 #include "src/core/util/debug_location.h"
+#include "src/core/util/down_cast.h"
+#include "src/core/util/fast_random.h"
 #include "src/core/util/json/json.h"
+#include "src/core/util/json/json_args.h"
+#include "src/core/util/json/json_object_loader.h"
 #include "src/core/util/orphanable.h"
 #include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/time.h"
+#include "src/core/util/validation_errors.h"
 #include "src/core/util/work_serializer.h"
 
 namespace grpc_core {
@@ -55,6 +63,40 @@ namespace {
 
 constexpr absl::string_view kRoundRobin = "round_robin";
 
+class RoundRobinConfig final : public LoadBalancingPolicy::Config {
+ public:
+  absl::string_view name() const override { return kRoundRobin; }
+
+  float warm_up_fraction() const { return warm_up_fraction_; }
+  Duration warm_up_timeout() const { return warm_up_timeout_; }
+
+  static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
+    static const auto* loader =
+        JsonObjectLoader<RoundRobinConfig>()
+            .OptionalField("warmUpFraction",
+                           &RoundRobinConfig::warm_up_fraction_)
+            .OptionalField("warmUpTimeout",
+                           &RoundRobinConfig::warm_up_timeout_)
+            .Finish();
+    return loader;
+  }
+
+  void JsonPostLoad(const Json&, const JsonArgs&, ValidationErrors* errors) {
+    if (warm_up_fraction_ < 0 || warm_up_fraction_ > 1) {
+      ValidationErrors::ScopedField field(errors, ".warmUpFraction");
+      errors->AddError("must be in the range [0, 1]");
+    }
+  }
+
+ private:
+  // The fraction of the initial endpoints that must be READY before the
+  // policy first reports READY.  0 reports READY on the first one.
+  float warm_up_fraction_ = 0;
+  // How long to wait for warm-up before reporting READY with whatever
+  // endpoints are connected.
+  Duration warm_up_timeout_ = Duration::Seconds(1);
+};
+
 class RoundRobin final : public LoadBalancingPolicy {
  public:
   explicit RoundRobin(Args args);
@@ -70,21 +112,26 @@ class RoundRobin final : public LoadBalancingPolicy {
     RoundRobinEndpointList(RefCountedPtr<RoundRobin> round_robin,
                            EndpointAddressesIterator* endpoints,
                            const ChannelArgs& args, std::string resolution_note,
-                           std::vector<std::string>* errors)
+                           std::vector<std::string>* errors,
+                           absl::Span<EndpointList* const> previous_lists)
         : EndpointList(std::move(round_robin), std::move(resolution_note),
                        GRPC_TRACE_FLAG_ENABLED(round_robin)
                            ? "RoundRobinEndpointList"
                            : nullptr) {
-      Init(endpoints, args,
-           [&](RefCountedPtr<EndpointList> endpoint_list,
-               const EndpointAddresses& addresses, const ChannelArgs& args) {
-             return MakeOrphanable<RoundRobinEndpoint>(
-                 std::move(endpoint_list), addresses, args,
-                 policy<RoundRobin>()->work_serializer(), errors);
-           });
+      Init(
+          endpoints, args,
+          [&](RefCountedPtr<EndpointList> endpoint_list,
+              const EndpointAddresses& addresses, const ChannelArgs& args) {
+            return MakeOrphanable<RoundRobinEndpoint>(
+                std::move(endpoint_list), addresses, args,
+                policy<RoundRobin>()->work_serializer(), errors);
+          },
+          previous_lists);
     }
 
    private:
+    friend class RoundRobin;
+
     class RoundRobinEndpoint final : public Endpoint {
      public:
       RoundRobinEndpoint(RefCountedPtr<EndpointList> endpoint_list,
@@ -157,6 +204,11 @@ class RoundRobin final : public LoadBalancingPolicy {
 
   void ShutdownLocked() override;
 
+  // Starts warming up the initial child list, if so configured.
+  void MaybeStartWarmUpLocked(const RoundRobinConfig* config);
+  void OnWarmUpTimerLocked();
+  void CancelWarmUpTimer();
+
   // Current child list.
   OrphanablePtr<RoundRobinEndpointList> endpoint_list_;
   // Latest pending child list.
@@ -167,7 +219,12 @@ class RoundRobin final : public LoadBalancingPolicy {
 
   bool shutdown_ = false;
 
-  absl::BitGen bit_gen_;
+  // Set during warm-up: until the timer fires, READY is reported only once
+  // warm_up_num_ready_ children are READY, or none of the others can be.
+  bool warming_up_ = false;
+  size_t warm_up_num_ready_ = 0;
+  std::optional<grpc_event_engine::experimental::EventEngine::TaskHandle>
+      warm_up_timer_handle_;
 };
 
 //
@@ -180,7 +237,7 @@ RoundRobin::Picker::Picker(
     : parent_(parent), pickers_(std::move(pickers)) {
   // For discussion on why we generate a random starting index for
   // the picker, see https://github.com/grpc/grpc-go/issues/2580.
-  size_t index = absl::Uniform<size_t>(parent->bit_gen_, 0, pickers_.size());
+  size_t index = FastRandom::Below(pickers_.size());
   last_picked_index_.store(index, std::memory_order_relaxed);
   GRPC_TRACE_LOG(round_robin, INFO)
       << "[RR " << parent_ << " picker " << this
@@ -216,6 +273,7 @@ RoundRobin::~RoundRobin() {
 void RoundRobin::ShutdownLocked() {
   GRPC_TRACE_LOG(round_robin, INFO) << "[RR " << this << "] Shutting down";
   shutdown_ = true;
+  CancelWarmUpTimer();
   endpoint_list_.reset();
   latest_pending_endpoint_list_.reset();
 }
@@ -241,15 +299,19 @@ absl::Status RoundRobin::UpdateLocked(UpdateArgs args) {
     if (endpoint_list_ != nullptr) return args.addresses.status();
   }
   // Create new child list, replacing the previous pending list, if any.
+  // Unchanged endpoints keep their children from the previous lists.
   if (GRPC_TRACE_FLAG_ENABLED(round_robin) &&
       latest_pending_endpoint_list_ != nullptr) {
     ABSL_LOG(INFO) << "[RR " << this << "] replacing previous pending child list "
               << latest_pending_endpoint_list_.get();
   }
   std::vector<std::string> errors;
+  EndpointList* previous_lists[] = {latest_pending_endpoint_list_.get(),
+                                    endpoint_list_.get()};
   latest_pending_endpoint_list_ = MakeOrphanable<RoundRobinEndpointList>(
       RefAsSubclass<RoundRobin>(DEBUG_LOCATION, "RoundRobinEndpointList"),
-      addresses, args.args, std::move(args.resolution_note), &errors);
+      addresses, args.args, std::move(args.resolution_note), &errors,
+      previous_lists);
   // If the new list is empty, immediately promote it to
   // endpoint_list_ and report TRANSIENT_FAILURE.
   if (latest_pending_endpoint_list_->size() == 0) {
@@ -268,6 +330,15 @@ absl::Status RoundRobin::UpdateLocked(UpdateArgs args) {
   // endpoint_list_.
   if (endpoint_list_ == nullptr) {
     endpoint_list_ = std::move(latest_pending_endpoint_list_);
+    MaybeStartWarmUpLocked(
+        DownCast<const RoundRobinConfig*>(args.config.get()));
+  }
+  // Children taken over from the previous lists have already reported
+  // their state, so the new list may be able to take over straight away.
+  if (latest_pending_endpoint_list_ != nullptr &&
+      latest_pending_endpoint_list_->num_ready_ > 0) {
+    latest_pending_endpoint_list_
+        ->MaybeUpdateRoundRobinConnectivityStateLocked(absl::OkStatus());
   }
   if (!errors.empty()) {
     return absl::UnavailableError(absl::StrCat(
@@ -276,6 +347,47 @@ absl::Status RoundRobin::UpdateLocked(UpdateArgs args) {
   return absl::OkStatus();
 }
 
+void RoundRobin::MaybeStartWarmUpLocked(const RoundRobinConfig* config) {
+  // Tests and some parent policies send no config.
+  if (config == nullptr || config->warm_up_fraction() == 0) return;
+  warming_up_ = true;
+  warm_up_num_ready_ = std::max<size_t>(
+      1, std::ceil(config->warm_up_fraction() * endpoint_list_->size()));
+  GRPC_TRACE_LOG(round_robin, INFO)
+      << "[RR " << this << "] warming up: waiting up to "
+      << config->warm_up_timeout().ToString() << " for "
+      << warm_up_num_ready_ << " of " << endpoint_list_->size()
+      << " children to become READY";
+  warm_up_timer_handle_ = channel_control_helper()->GetEventEngine()->RunAfter(
+      config->warm_up_timeout(),
+      [self = RefAsSubclass<RoundRobin>(DEBUG_LOCATION,
+                                        "WarmUpTimer")]() mutable {
+        ApplicationCallbackExecCtx application_exec_ctx;
+        ExecCtx exec_ctx;
+        auto* self_ptr = self.get();
+        self_ptr->work_serializer()->Run(
+            [self = std::move(self)]() { self->OnWarmUpTimerLocked(); });
+      });
+}
+
+void RoundRobin::OnWarmUpTimerLocked() {
+  if (!warm_up_timer_handle_.has_value()) return;
+  warm_up_timer_handle_.reset();
+  GRPC_TRACE_LOG(round_robin, INFO)
+      << "[RR " << this << "] warm-up timer fired";
+  warming_up_ = false;
+  endpoint_list_->MaybeUpdateRoundRobinConnectivityStateLocked(
+      absl::OkStatus());
+}
+
+void RoundRobin::CancelWarmUpTimer() {
+  warming_up_ = false;
+  if (warm_up_timer_handle_.has_value()) {
+    channel_control_helper()->GetEventEngine()->Cancel(*warm_up_timer_handle_);
+    warm_up_timer_handle_.reset();
+  }
+}
+
 //
 // RoundRobin::RoundRobinEndpointList::RoundRobinEndpoint
 //
@@ -366,6 +478,22 @@ void RoundRobin::RoundRobinEndpointList::
   }
   // Only set connectivity state if this is the current child list.
   if (round_robin->endpoint_list_.get() != this) return;
+  // While warming up, report CONNECTING until enough children are READY,
+  // unless none of the rest can become READY any time soon.
+  if (round_robin->warming_up_ && num_ready_ > 0) {
+    if (num_ready_ < round_robin->warm_up_num_ready_ &&
+        num_ready_ + num_transient_failure_ < size()) {
+      GRPC_TRACE_LOG(round_robin, INFO)
+          << "[RR " << round_robin << "] warming up: " << CountersString();
+      round_robin->channel_control_helper()->UpdateState(
+          GRPC_CHANNEL_CONNECTING, absl::OkStatus(),
+          MakeRefCounted<QueuePicker>(nullptr));
+      return;
+    }
+    GRPC_TRACE_LOG(round_robin, INFO)
+        << "[RR " << round_robin << "] warm-up complete: " << CountersString();
+    round_robin->CancelWarmUpTimer();
+  }
   // First matching rule wins:
   // 1) ANY child is READY => policy is READY.
   // 2) ANY child is CONNECTING => policy is CONNECTING.
@@ -410,11 +538,6 @@ void RoundRobin::RoundRobinEndpointList::
 // factory
 //
 
-class RoundRobinConfig final : public LoadBalancingPolicy::Config {
- public:
-  absl::string_view name() const override { return kRoundRobin; }
-};
-
 class RoundRobinFactory final : public LoadBalancingPolicyFactory {
  public:
   OrphanablePtr<LoadBalancingPolicy> CreateLoadBalancingPolicy(
@@ -425,8 +548,9 @@ class RoundRobinFactory final : public LoadBalancingPolicyFactory {
   absl::string_view name() const override { return kRoundRobin; }
 
   absl::StatusOr<RefCountedPtr<LoadBalancingPolicy::Config>>
-  ParseLoadBalancingConfig(const Json& /*json*/) const override {
-    return MakeRefCounted<RoundRobinConfig>();
+  ParseLoadBalancingConfig(const Json& json) const override {
+    return LoadFromJson<RefCountedPtr<RoundRobinConfig>>(
+        json, JsonArgs(), "errors validating round_robin LB policy config");
   }
 };
 
@@ -22,6 +22,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <cmath>
 #include <map>
 #include <memory>
 #include <optional>
@@ -36,12 +37,12 @@
 #include "absl/log/absl_check.h"
 #include "absl/log/absl_log.h"
 #include "absl/meta/type_traits.h"
-#include "absl/random/random.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_join.h"
 #include "absl/strings/string_view.h"
+#include "absl/types/span.h"
 #include "src/core/config/core_configuration.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/debug/trace.h"
@@ -62,6 +63,7 @@
 #include "src/core/telemetry/stats.h"
 #include "src/core/telemetry/stats_data.h"
 #include "src/core/util/debug_location.h"
+#include "src/core/util/fast_random.h"
 #include "src/core/util/json/json.h"
 #include "src/core/util/json/json_args.h"
 #include "src/core/util/json/json_object_loader.h"
@@ -198,12 +200,14 @@ class WeightedRoundRobin final : public LoadBalancingPolicy {
   void ResetBackoffLocked() override;
 
  private:
+  class EndpointWeightMap;
+
   // Represents the weight for a given address.
   class EndpointWeight final : public RefCounted<EndpointWeight> {
    public:
-    EndpointWeight(RefCountedPtr<WeightedRoundRobin> wrr,
+    EndpointWeight(RefCountedPtr<EndpointWeightMap> weight_map,
                    EndpointAddressSet key)
-        : wrr_(std::move(wrr)), key_(std::move(key)) {}
+        : weight_map_(std::move(weight_map)), key_(std::move(key)) {}
     ~EndpointWeight() override;
 
     void MaybeUpdateWeight(double qps, double eps, double utilization,
@@ -216,7 +220,7 @@ class WeightedRoundRobin final : public LoadBalancingPolicy {
     void ResetNonEmptySince();
 
    private:
-    RefCountedPtr<WeightedRoundRobin> wrr_;
+    RefCountedPtr<EndpointWeightMap> weight_map_;
     const EndpointAddressSet key_;
 
     Mutex mu_;
@@ -225,6 +229,43 @@ class WeightedRoundRobin final : public LoadBalancingPolicy {
     Timestamp last_update_time_ ABSL_GUARDED_BY(&mu_) = Timestamp::InfFuture();
   };
 
+  // The weights of the endpoints seen by a WRR policy, keyed by address set
+  // so that they carry over across endpoint list updates.  With the
+  // wrr_shared_endpoint_weights experiment, the policies of all channels to
+  // the same target and locality share one map, so that they share one
+  // weight per endpoint, fed by the reports seen by all of them.
+  class EndpointWeightMap final : public RefCounted<EndpointWeightMap> {
+   public:
+    // Creates a map for a single policy.
+    EndpointWeightMap() = default;
+    ~EndpointWeightMap() override;
+
+    // Returns the map shared by all policies with the same target and
+    // locality, creating it if needed.
+    static RefCountedPtr<EndpointWeightMap> GetShared(
+        absl::string_view target, absl::string_view locality_name);
+
+    RefCountedPtr<EndpointWeight> GetOrCreateWeight(
+        const std::vector<grpc_resolved_address>& addresses);
+
+   private:
+    friend class EndpointWeight;
+
+    using SharedKey = std::pair<std::string, std::string>;
+    struct SharedMaps {
+      Mutex mu;
+      std::map<SharedKey, EndpointWeightMap*> maps ABSL_GUARDED_BY(&mu);
+    };
+    static SharedMaps* shared_maps();
+
+    // Set only for shared maps.
+    std::optional<SharedKey> shared_key_;
+
+    Mutex mu_;
+    std::map<EndpointAddressSet, EndpointWeight*> weights_
+        ABSL_GUARDED_BY(&mu_);
+  };
+
   class WrrEndpointList final : public EndpointList {
    public:
     class WrrEndpoint final : public Endpoint {
@@ -277,21 +318,26 @@ class WeightedRoundRobin final : public LoadBalancingPolicy {
     WrrEndpointList(RefCountedPtr<WeightedRoundRobin> wrr,
                     EndpointAddressesIterator* endpoints,
                     const ChannelArgs& args, std::string resolution_note,
-                    std::vector<std::string>* errors)
+                    std::vector<std::string>* errors,
+                    absl::Span<EndpointList* const> previous_lists)
         : EndpointList(std::move(wrr), std::move(resolution_note),
                        GRPC_TRACE_FLAG_ENABLED(weighted_round_robin_lb)
                            ? "WrrEndpointList"
                            : nullptr) {
-      Init(endpoints, args,
-           [&](RefCountedPtr<EndpointList> endpoint_list,
-               const EndpointAddresses& addresses, const ChannelArgs& args) {
-             return MakeOrphanable<WrrEndpoint>(
-                 std::move(endpoint_list), addresses, args,
-                 policy<WeightedRoundRobin>()->work_serializer(), errors);
-           });
+      Init(
+          endpoints, args,
+          [&](RefCountedPtr<EndpointList> endpoint_list,
+              const EndpointAddresses& addresses, const ChannelArgs& args) {
+            return MakeOrphanable<WrrEndpoint>(
+                std::move(endpoint_list), addresses, args,
+                policy<WeightedRoundRobin>()->work_serializer(), errors);
+          },
+          previous_lists);
     }
 
    private:
+    friend class WeightedRoundRobin;
+
     LoadBalancingPolicy::ChannelControlHelper* channel_control_helper()
         const override {
       return policy<WeightedRoundRobin>()->channel_control_helper();
@@ -369,8 +415,16 @@ class WeightedRoundRobin final : public LoadBalancingPolicy {
     // Returns the index into endpoints_ to be picked.
     size_t PickIndex();
 
+    // Returns true if no weight has changed by more than 1% (or to or from
+    // zero), so that a scheduler built from old_weights may be kept.
+    static bool WeightsEffectivelyUnchanged(
+        absl::Span<const float> old_weights,
+        absl::Span<const float> new_weights);
+
     // Builds a new scheduler and swaps it into place, then starts a
-    // timer for the next update.
+    // timer for the next update.  If the wrr_skip_unchanged_weights
+    // experiment is enabled, keeps the current scheduler instead when the
+    // weights are effectively unchanged.
     void BuildSchedulerAndStartTimerLocked()
         ABSL_EXCLUSIVE_LOCKS_REQUIRED(&timer_mu_);
 
@@ -381,6 +435,9 @@ class WeightedRoundRobin final : public LoadBalancingPolicy {
     Mutex scheduler_mu_;
     std::shared_ptr<StaticStrideScheduler> scheduler_
         ABSL_GUARDED_BY(&scheduler_mu_);
+    // The weights scheduler_ was built from, or empty if there is no
+    // scheduler.
+    std::vector<float> scheduler_weights_ ABSL_GUARDED_BY(&timer_mu_);
 
     Mutex timer_mu_ ABSL_ACQUIRED_BEFORE(&scheduler_mu_);
     std::optional<grpc_event_engine::experimental::EventEngine::TaskHandle>
@@ -395,7 +452,9 @@ class WeightedRoundRobin final : public LoadBalancingPolicy {
   void ShutdownLocked() override;
 
   RefCountedPtr<EndpointWeight> GetOrCreateWeight(
-      const std::vector<grpc_resolved_address>& addresses);
+      const std::vector<grpc_resolved_address>& addresses) {
+    return weight_map_->GetOrCreateWeight(addresses);
+  }
 
   RefCountedPtr<WeightedRoundRobinConfig> config_;
 
@@ -407,18 +466,19 @@ class WeightedRoundRobin final : public LoadBalancingPolicy {
   // list becomes READY.
   OrphanablePtr<WrrEndpointList> latest_pending_endpoint_list_;
 
-  Mutex endpoint_weight_map_mu_;
-  std::map<EndpointAddressSet, EndpointWeight*> endpoint_weight_map_
-      ABSL_GUARDED_BY(&endpoint_weight_map_mu_);
-
   const absl::string_view locality_name_;
 
-  bool shutdown_ = false;
+  const RefCountedPtr<EndpointWeightMap> weight_map_;
+
+  // Bound once, since every scheduler rebuild records each endpoint's weight.
+  GlobalStatsPluginRegistry::StatsPluginGroup::BoundHistogram<double>
+      endpoint_weights_histogram_;
 
-  absl::BitGen bit_gen_;
+  bool shutdown_ = false;
 
   // Accessed by picker.
-  std::atomic<uint32_t> scheduler_state_{absl::Uniform<uint32_t>(bit_gen_)};
+  std::atomic<uint32_t> scheduler_state_{
+      static_cast<uint32_t>(FastRandom::Next())};
 };
 
 //
@@ -426,10 +486,10 @@ class WeightedRoundRobin final : public LoadBalancingPolicy {
 //
 
 WeightedRoundRobin::EndpointWeight::~EndpointWeight() {
-  MutexLock lock(&wrr_->endpoint_weight_map_mu_);
-  auto it = wrr_->endpoint_weight_map_.find(key_);
-  if (it != wrr_->endpoint_weight_map_.end() && it->second == this) {
-    wrr_->endpoint_weight_map_.erase(it);
+  MutexLock lock(&weight_map_->mu_);
+  auto it = weight_map_->weights_.find(key_);
+  if (it != weight_map_->weights_.end() && it->second == this) {
+    weight_map_->weights_.erase(it);
   }
 }
 
@@ -447,7 +507,8 @@ void WeightedRoundRobin::EndpointWeight::MaybeUpdateWeight(
   }
   if (weight == 0) {
     GRPC_TRACE_LOG(weighted_round_robin_lb, INFO)
-        << "[WRR " << wrr_.get() << "] subchannel " << key_.ToString()
+        << "[WRR weights " << weight_map_.get() << "] subchannel "
+      << key_.ToString()
         << ": qps=" << qps << ", eps=" << eps << ", utilization=" << utilization
         << ": error_util_penalty=" << error_utilization_penalty
         << ", weight=" << weight << " (not updating)";
@@ -457,7 +518,8 @@ void WeightedRoundRobin::EndpointWeight::MaybeUpdateWeight(
   // Grab the lock and update the data.
   MutexLock lock(&mu_);
   GRPC_TRACE_LOG(weighted_round_robin_lb, INFO)
-      << "[WRR " << wrr_.get() << "] subchannel " << key_.ToString()
+      << "[WRR weights " << weight_map_.get() << "] subchannel "
+      << key_.ToString()
       << ": qps=" << qps << ", eps=" << eps << ", utilization=" << utilization
       << " error_util_penalty=" << error_utilization_penalty
       << " : setting weight=" << weight << " weight_=" << weight_
@@ -474,7 +536,8 @@ float WeightedRoundRobin::EndpointWeight::GetWeight(
     uint64_t* num_not_yet_usable, uint64_t* num_stale) {
   MutexLock lock(&mu_);
   GRPC_TRACE_LOG(weighted_round_robin_lb, INFO)
-      << "[WRR " << wrr_.get() << "] subchannel " << key_.ToString()
+      << "[WRR weights " << weight_map_.get() << "] subchannel "
+      << key_.ToString()
       << ": getting weight: now=" << now.ToString()
       << " weight_expiration_period=" << weight_expiration_period.ToString()
       << " blackout_period=" << blackout_period.ToString()
@@ -504,6 +567,56 @@ void WeightedRoundRobin::EndpointWeight::ResetNonEmptySince() {
   non_empty_since_ = Timestamp::InfFuture();
 }
 
+//
+// WeightedRoundRobin::EndpointWeightMap
+//
+
+WeightedRoundRobin::EndpointWeightMap::SharedMaps*
+WeightedRoundRobin::EndpointWeightMap::shared_maps() {
+  static SharedMaps* shared_maps = new SharedMaps();
+  return shared_maps;
+}
+
+WeightedRoundRobin::EndpointWeightMap::~EndpointWeightMap() {
+  if (!shared_key_.has_value()) return;
+  SharedMaps* shared = shared_maps();
+  MutexLock lock(&shared->mu);
+  auto it = shared->maps.find(*shared_key_);
+  if (it != shared->maps.end() && it->second == this) shared->maps.erase(it);
+}
+
+RefCountedPtr<WeightedRoundRobin::EndpointWeightMap>
+WeightedRoundRobin::EndpointWeightMap::GetShared(
+    absl::string_view target, absl::string_view locality_name) {
+  SharedKey key(target, locality_name);
+  SharedMaps* shared = shared_maps();
+  MutexLock lock(&shared->mu);
+  auto it = shared->maps.find(key);
+  if (it != shared->maps.end()) {
+    auto weight_map = it->second->RefIfNonZero();
+    if (weight_map != nullptr) return weight_map;
+  }
+  auto weight_map = MakeRefCounted<EndpointWeightMap>();
+  weight_map->shared_key_ = key;
+  shared->maps.insert_or_assign(std::move(key), weight_map.get());
+  return weight_map;
+}
+
+RefCountedPtr<WeightedRoundRobin::EndpointWeight>
+WeightedRoundRobin::EndpointWeightMap::GetOrCreateWeight(
+    const std::vector<grpc_resolved_address>& addresses) {
+  EndpointAddressSet key(addresses);
+  MutexLock lock(&mu_);
+  auto it = weights_.find(key);
+  if (it != weights_.end()) {
+    auto weight = it->second->RefIfNonZero();
+    if (weight != nullptr) return weight;
+  }
+  auto weight = MakeRefCounted<EndpointWeight>(Ref(), key);
+  weights_.insert_or_assign(std::move(key), weight.get());
+  return weight;
+}
+
 //
 // WeightedRoundRobin::Picker::SubchannelCallTracker
 //
@@ -539,7 +652,7 @@ WeightedRoundRobin::Picker::Picker(RefCountedPtr<WeightedRoundRobin> wrr,
                                    WrrEndpointList* endpoint_list)
     : wrr_(std::move(wrr)),
       config_(wrr_->config_),
-      last_picked_index_(absl::Uniform<size_t>(wrr_->bit_gen_)) {
+      last_picked_index_(FastRandom::Next()) {
   for (auto& endpoint : endpoint_list->endpoints()) {
     auto* ep = static_cast<WrrEndpointList::WrrEndpoint*>(endpoint.get());
     if (ep->connectivity_state() == GRPC_CHANNEL_READY) {
@@ -607,6 +720,24 @@ size_t WeightedRoundRobin::Picker::PickIndex() {
   return last_picked_index_.fetch_add(1) % endpoints_.size();
 }
 
+bool WeightedRoundRobin::Picker::WeightsEffectivelyUnchanged(
+    absl::Span<const float> old_weights, absl::Span<const float> new_weights) {
+  // Weights are estimates from noisy QPS and utilization samples, so a
+  // scheduler built from weights within this fraction of the new ones picks
+  // as well as a new one would.
+  constexpr float kMaxWeightChange = 0.01;
+  if (old_weights.size() != new_weights.size()) return false;
+  for (size_t i = 0; i < old_weights.size(); ++i) {
+    // The scheduler treats zero weights specially.
+    if ((old_weights[i] == 0) != (new_weights[i] == 0)) return false;
+    if (std::abs(new_weights[i] - old_weights[i]) >
+        kMaxWeightChange * old_weights[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
 void WeightedRoundRobin::Picker::BuildSchedulerAndStartTimerLocked() {
   auto& stats_plugins = wrr_->channel_control_helper()->GetStatsPluginGroup();
   // Build scheduler, reporting metrics on endpoint weights.
@@ -620,9 +751,7 @@ void WeightedRoundRobin::Picker::BuildSchedulerAndStartTimerLocked() {
         now, config_->weight_expiration_period(), config_->blackout_period(),
         &num_not_yet_usable, &num_stale);
     weights.push_back(weight);
-    stats_plugins.RecordHistogram(kMetricEndpointWeights, weight,
-                                  {wrr_->channel_control_helper()->GetTarget()},
-                                  {wrr_->locality_name_});
+    wrr_->endpoint_weights_histogram_.Record(weight);
   }
   stats_plugins.AddCounter(
       kMetricEndpointWeightNotYetUsable, num_not_yet_usable,
@@ -633,26 +762,36 @@ void WeightedRoundRobin::Picker::BuildSchedulerAndStartTimerLocked() {
   GRPC_TRACE_LOG(weighted_round_robin_lb, INFO)
       << "[WRR " << wrr_.get() << " picker " << this
       << "] new weights: " << absl::StrJoin(weights, " ");
-  auto scheduler_or = StaticStrideScheduler::Make(
-      weights, [this]() { return wrr_->scheduler_state_.fetch_add(1); });
-  std::shared_ptr<StaticStrideScheduler> scheduler;
-  if (scheduler_or.has_value()) {
-    scheduler =
-        std::make_shared<StaticStrideScheduler>(std::move(*scheduler_or));
+  if (IsWrrSkipUnchangedWeightsEnabled() &&
+      WeightsEffectivelyUnchanged(scheduler_weights_, weights)) {
     GRPC_TRACE_LOG(weighted_round_robin_lb, INFO)
         << "[WRR " << wrr_.get() << " picker " << this
-        << "] new scheduler: " << scheduler.get();
+        << "] weights effectively unchanged, keeping scheduler";
   } else {
-    GRPC_TRACE_LOG(weighted_round_robin_lb, INFO)
-        << "[WRR " << wrr_.get() << " picker " << this
-        << "] no scheduler, falling back to RR";
-    stats_plugins.AddCounter(kMetricRrFallback, 1,
-                             {wrr_->channel_control_helper()->GetTarget()},
-                             {wrr_->locality_name_});
-  }
-  {
-    MutexLock lock(&scheduler_mu_);
-    scheduler_ = std::move(scheduler);
+    auto scheduler_or = StaticStrideScheduler::Make(
+        weights, [this]() { return wrr_->scheduler_state_.fetch_add(1); });
+    std::shared_ptr<StaticStrideScheduler> scheduler;
+    if (scheduler_or.has_value()) {
+      scheduler =
+          std::make_shared<StaticStrideScheduler>(std::move(*scheduler_or));
+      scheduler_weights_ = std::move(weights);
+      GRPC_TRACE_LOG(weighted_round_robin_lb, INFO)
+          << "[WRR " << wrr_.get() << " picker " << this
+          << "] new scheduler: " << scheduler.get();
+    } else {
+      // Keep rebuilding, and counting the fallback, on every update.
+      scheduler_weights_.clear();
+      GRPC_TRACE_LOG(weighted_round_robin_lb, INFO)
+          << "[WRR " << wrr_.get() << " picker " << this
+          << "] no scheduler, falling back to RR";
+      stats_plugins.AddCounter(kMetricRrFallback, 1,
+                               {wrr_->channel_control_helper()->GetTarget()},
+                               {wrr_->locality_name_});
+    }
+    {
+      MutexLock lock(&scheduler_mu_);
+      scheduler_ = std::move(scheduler);
+    }
   }
   // Start timer.
   GRPC_TRACE_LOG(weighted_round_robin_lb, INFO)
@@ -690,7 +829,16 @@ WeightedRoundRobin::WeightedRoundRobin(Args args)
     : LoadBalancingPolicy(std::move(args)),
       locality_name_(channel_args()
                          .GetString(GRPC_ARG_LB_WEIGHTED_TARGET_CHILD)
-                         .value_or("")) {
+                         .value_or("")),
+      weight_map_(IsWrrSharedEndpointWeightsEnabled()
+                      ? EndpointWeightMap::GetShared(
+                            channel_control_helper()->GetTarget(),
+                            locality_name_)
+                      : MakeRefCounted<EndpointWeightMap>()),
+      endpoint_weights_histogram_(
+          channel_control_helper()->GetStatsPluginGroup().BindHistogram(
+              kMetricEndpointWeights, {channel_control_helper()->GetTarget()},
+              {locality_name_})) {
   GRPC_TRACE_LOG(weighted_round_robin_lb, INFO)
       << "[WRR " << this << "] Created -- locality_name=\""
       << std::string(locality_name_) << "\"";
@@ -720,7 +868,18 @@ void WeightedRoundRobin::ResetBackoffLocked() {
 
 absl::Status WeightedRoundRobin::UpdateLocked(UpdateArgs args) {
   global_stats().IncrementWrrUpdates();
-  config_ = args.config.TakeAsSubclass<WeightedRoundRobinConfig>();
+  auto previous_config = std::exchange(
+      config_, args.config.TakeAsSubclass<WeightedRoundRobinConfig>());
+  // Children's subchannels carry OOB watchers set up from the config, so
+  // they can only be reused if those settings are unchanged.
+  const bool reuse_children =
+      previous_config != nullptr &&
+      previous_config->enable_oob_load_report() ==
+          config_->enable_oob_load_report() &&
+      previous_config->oob_reporting_period() ==
+          config_->oob_reporting_period() &&
+      previous_config->error_utilization_penalty() ==
+          config_->error_utilization_penalty();
   std::shared_ptr<EndpointAddressesIterator> addresses;
   if (args.addresses.ok()) {
     GRPC_TRACE_LOG(weighted_round_robin_lb, INFO)
@@ -758,6 +917,7 @@ absl::Status WeightedRoundRobin::UpdateLocked(UpdateArgs args) {
     if (endpoint_list_ != nullptr) return args.addresses.status();
   }
   // Create new endpoint list, replacing the previous pending list, if any.
+  // Unchanged endpoints keep their children from the previous lists.
   if (GRPC_TRACE_FLAG_ENABLED(weighted_round_robin_lb) &&
       latest_pending_endpoint_list_ != nullptr) {
     ABSL_LOG(INFO) << "[WRR " << this
@@ -765,9 +925,13 @@ absl::Status WeightedRoundRobin::UpdateLocked(UpdateArgs args) {
               << latest_pending_endpoint_list_.get();
   }
   std::vector<std::string> errors;
+  EndpointList* previous_lists[] = {latest_pending_endpoint_list_.get(),
+                                    endpoint_list_.get()};
   latest_pending_endpoint_list_ = MakeOrphanable<WrrEndpointList>(
       RefAsSubclass<WeightedRoundRobin>(), addresses.get(), args.args,
-      std::move(args.resolution_note), &errors);
+      std::move(args.resolution_note), &errors,
+      reuse_children ? absl::Span<EndpointList* const>(previous_lists)
+                     : absl::Span<EndpointList* const>());
   // If the new list is empty, immediately promote it to
   // endpoint_list_ and report TRANSIENT_FAILURE.
   if (latest_pending_endpoint_list_->size() == 0) {
@@ -788,6 +952,13 @@ absl::Status WeightedRoundRobin::UpdateLocked(UpdateArgs args) {
   if (endpoint_list_.get() == nullptr) {
     endpoint_list_ = std::move(latest_pending_endpoint_list_);
   }
+  // Children taken over from the previous lists have already reported
+  // their state, so the new list may be able to take over straight away.
+  if (latest_pending_endpoint_list_ != nullptr &&
+      latest_pending_endpoint_list_->num_ready_ > 0) {
+    latest_pending_endpoint_list_
+        ->MaybeUpdateAggregatedConnectivityStateLocked(absl::OkStatus());
+  }
   if (!errors.empty()) {
     return absl::UnavailableError(absl::StrCat(
         "errors from children: [", absl::StrJoin(errors, "; "), "]"));
@@ -795,21 +966,6 @@ absl::Status WeightedRoundRobin::UpdateLocked(UpdateArgs args) {
   return absl::OkStatus();
 }
 
-RefCountedPtr<WeightedRoundRobin::EndpointWeight>
-WeightedRoundRobin::GetOrCreateWeight(
-    const std::vector<grpc_resolved_address>& addresses) {
-  EndpointAddressSet key(addresses);
-  MutexLock lock(&endpoint_weight_map_mu_);
-  auto it = endpoint_weight_map_.find(key);
-  if (it != endpoint_weight_map_.end()) {
-    auto weight = it->second->RefIfNonZero();
-    if (weight != nullptr) return weight;
-  }
-  auto weight = MakeRefCounted<EndpointWeight>(
-      RefAsSubclass<WeightedRoundRobin>(DEBUG_LOCATION, "EndpointWeight"), key);
-  endpoint_weight_map_.emplace(key, weight.get());
-  return weight;
-}
 
 //
 // WeightedRoundRobin::WrrEndpointList::WrrEndpoint::OobWatcher
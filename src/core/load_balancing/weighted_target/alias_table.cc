@@ -0,0 +1,66 @@
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "src/core/load_balancing/weighted_target/alias_table.h"
+
+#include <grpc/support/port_platform.h>
+
+#include "absl/log/check.h"
+#include "absl/numeric/int128.h"
+
+namespace grpc_core {
+
+AliasTable::AliasTable(absl::Span<const uint32_t> weights)
+    : buckets_(weights.size()) {
+  CHECK(!weights.empty());
+  const uint64_t n = weights.size();
+  uint64_t total = 0;
+  for (uint32_t weight : weights) {
+    CHECK_GT(weight, 0u);
+    total += weight;
+  }
+  // Each weight is scaled by n, so that a bucket holds exactly `total`.
+  // Indexes with less than that are topped up from ones with more.
+  std::vector<absl::uint128> scaled(weights.size());
+  std::vector<size_t> small;
+  std::vector<size_t> large;
+  for (size_t i = 0; i < weights.size(); ++i) {
+    scaled[i] = absl::uint128(weights[i]) * n;
+    (scaled[i] < total ? small : large).push_back(i);
+  }
+  while (!small.empty() && !large.empty()) {
+    const size_t s = small.back();
+    small.pop_back();
+    const size_t l = large.back();
+    buckets_[s].threshold =
+        absl::Uint128Low64((scaled[s] << 32) / total);
+    buckets_[s].alias = l;
+    scaled[l] -= total - scaled[s];
+    if (scaled[l] < total) {
+      large.pop_back();
+      small.push_back(l);
+    }
+  }
+  // Whatever is left holds a full bucket, up to rounding.
+  for (const std::vector<size_t>* rest : {&small, &large}) {
+    for (size_t i : *rest) {
+      buckets_[i].threshold = uint64_t{1} << 32;
+      buckets_[i].alias = i;
+    }
+  }
+}
+
+}  // namespace grpc_core
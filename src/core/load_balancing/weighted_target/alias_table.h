@@ -0,0 +1,67 @@
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef GRPC_SRC_CORE_LOAD_BALANCING_WEIGHTED_TARGET_ALIAS_TABLE_H
+#define GRPC_SRC_CORE_LOAD_BALANCING_WEIGHTED_TARGET_ALIAS_TABLE_H
+
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "absl/types/span.h"
+
+namespace grpc_core {
+
+// AliasTable picks an index with probability proportional to its weight in
+// O(1), using Vose's alias method: each index owns one equally likely bucket,
+// and each bucket is split between its owner and one other index (its alias).
+//
+// Construction is O(|weights|). Stores 16 bytes per weight. The table is
+// immutable, so picks can be made concurrently without locking.
+class AliasTable final {
+ public:
+  // `weights` must be non-empty and every weight must be non-zero.
+  explicit AliasTable(absl::Span<const uint32_t> weights);
+
+  // Returns an index in [0, size()), given a uniformly distributed random
+  // number.
+  size_t Pick(uint64_t random) const {
+    // The high half of `random` picks the bucket, the low half picks between
+    // the bucket's owner and its alias.
+    const size_t index = static_cast<size_t>(
+        ((random >> 32) * static_cast<uint64_t>(buckets_.size())) >> 32);
+    const Bucket& bucket = buckets_[index];
+    return (random & 0xffffffff) < bucket.threshold ? index : bucket.alias;
+  }
+
+  size_t size() const { return buckets_.size(); }
+
+ private:
+  struct Bucket {
+    // The owner is picked if the low 32 bits of the random number are below
+    // this value, which is in [0, 2^32].
+    uint64_t threshold;
+    size_t alias;
+  };
+
+  std::vector<Bucket> buckets_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LOAD_BALANCING_WEIGHTED_TARGET_ALIAS_TABLE_H
@@ -34,7 +34,6 @@
 #include "absl/log/absl_check.h"
 #include "absl/log/absl_log.h"
 #include "absl/meta/type_traits.h"
-#include "absl/random/random.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/str_cat.h"
@@ -52,14 +51,15 @@
 #include "src/core/load_balancing/lb_policy.h"
 #include "src/core/load_balancing/lb_policy_factory.h"
 #include "src/core/load_balancing/lb_policy_registry.h"
+#include "src/core/load_balancing/weighted_target/alias_table.h"
 #include "src/core/resolver/endpoint_addresses.h"
 #include "src/core/util/debug_location.h"
+#include "src/core/util/fast_random.h"
 #include "src/core/util/json/json.h"
 #include "src/core/util/json/json_args.h"
 #include "src/core/util/json/json_object_loader.h"
 #include "src/core/util/orphanable.h"
 #include "src/core/util/ref_counted_ptr.h"
-#include "src/core/util/sync.h"
 #include "src/core/util/time.h"
 #include "src/core/util/validation_errors.h"
 #include "src/core/util/work_serializer.h"
@@ -126,24 +126,23 @@ class WeightedTargetLb final : public LoadBalancingPolicy {
   class WeightedPicker final : public SubchannelPicker {
    public:
     // Maintains a weighted list of pickers from each child that is in
-    // ready state. The first element in the pair represents the end of a
-    // range proportional to the child's weight. The start of the range
-    // is the previous value in the vector and is 0 for the first element.
+    // ready state. The first element in the pair is the child's weight.
     using PickerList =
-        std::vector<std::pair<uint64_t, RefCountedPtr<SubchannelPicker>>>;
+        std::vector<std::pair<uint32_t, RefCountedPtr<SubchannelPicker>>>;
 
-    explicit WeightedPicker(PickerList pickers)
-        : pickers_(std::move(pickers)) {}
+    // Returns a picker for `pickers`. With a single child, which is what
+    // most xDS clusters with one locality end up with, that is the child's
+    // own picker, so that picks do not go through an extra level.
+    static RefCountedPtr<SubchannelPicker> Make(PickerList pickers);
+
+    explicit WeightedPicker(PickerList pickers);
 
     PickResult Pick(PickArgs args) override;
 
    private:
-    PickerList pickers_;
-
-    // TODO(roth): Consider using a separate thread-local BitGen for each CPU
-    // to avoid the need for this mutex.
-    Mutex mu_;
-    absl::BitGen bit_gen_ ABSL_GUARDED_BY(&mu_);
+    std::vector<RefCountedPtr<SubchannelPicker>> pickers_;
+    // Picks an index into pickers_ in O(1), however many children there are.
+    AliasTable alias_table_;
   };
 
   // Each WeightedChild holds a ref to its parent WeightedTargetLb.
@@ -247,33 +246,27 @@ class WeightedTargetLb final : public LoadBalancingPolicy {
 // WeightedTargetLb::WeightedPicker
 //
 
+RefCountedPtr<LoadBalancingPolicy::SubchannelPicker>
+WeightedTargetLb::WeightedPicker::Make(PickerList pickers) {
+  if (pickers.size() == 1) return std::move(pickers[0].second);
+  return MakeRefCounted<WeightedPicker>(std::move(pickers));
+}
+
+WeightedTargetLb::WeightedPicker::WeightedPicker(PickerList pickers)
+    : alias_table_([&]() {
+        std::vector<uint32_t> weights;
+        weights.reserve(pickers.size());
+        for (const auto& [weight, picker] : pickers) weights.push_back(weight);
+        return weights;
+      }()) {
+  pickers_.reserve(pickers.size());
+  for (auto& [weight, picker] : pickers) pickers_.push_back(std::move(picker));
+}
+
 WeightedTargetLb::PickResult WeightedTargetLb::WeightedPicker::Pick(
     PickArgs args) {
-  // Generate a random number in [0, total weight).
-  const uint64_t key = [&]() {
-    MutexLock lock(&mu_);
-    return absl::Uniform<uint64_t>(bit_gen_, 0, pickers_.back().first);
-  }();
-  // Find the index in pickers_ corresponding to key.
-  size_t mid = 0;
-  size_t start_index = 0;
-  size_t end_index = pickers_.size() - 1;
-  size_t index = 0;
-  while (end_index > start_index) {
-    mid = (start_index + end_index) / 2;
-    if (pickers_[mid].first > key) {
-      end_index = mid;
-    } else if (pickers_[mid].first < key) {
-      start_index = mid + 1;
-    } else {
-      index = mid + 1;
-      break;
-    }
-  }
-  if (index == 0) index = start_index;
-  ABSL_CHECK(pickers_[index].first > key);
   // Delegate to the child picker.
-  return pickers_[index].second->Pick(args);
+  return pickers_[alias_table_.Pick(FastRandom::Next())]->Pick(args);
 }
 
 //
@@ -377,13 +370,9 @@ void WeightedTargetLb::UpdateStateLocked() {
       << "] scanning children to determine connectivity state";
   // Construct lists of child pickers with associated weights, one for
   // children that are in state READY and another for children that are
-  // in state TRANSIENT_FAILURE.  Each child is represented by a portion of
-  // the range proportional to its weight, such that the total range is the
-  // sum of the weights of all children.
+  // in state TRANSIENT_FAILURE.
   WeightedPicker::PickerList ready_picker_list;
-  uint64_t ready_end = 0;
   WeightedPicker::PickerList tf_picker_list;
-  uint64_t tf_end = 0;
   // Also count the number of children in CONNECTING and IDLE, to determine
   // the aggregated state.
   size_t num_connecting = 0;
@@ -401,8 +390,8 @@ void WeightedTargetLb::UpdateStateLocked() {
     switch (child->connectivity_state()) {
       case GRPC_CHANNEL_READY: {
         ABSL_CHECK_GT(child->weight(), 0u);
-        ready_end += child->weight();
-        ready_picker_list.emplace_back(ready_end, std::move(child_picker));
+        ready_picker_list.emplace_back(child->weight(),
+                                       std::move(child_picker));
         break;
       }
       case GRPC_CHANNEL_CONNECTING: {
@@ -415,8 +404,7 @@ void WeightedTargetLb::UpdateStateLocked() {
       }
       case GRPC_CHANNEL_TRANSIENT_FAILURE: {
         ABSL_CHECK_GT(child->weight(), 0u);
-        tf_end += child->weight();
-        tf_picker_list.emplace_back(tf_end, std::move(child_picker));
+        tf_picker_list.emplace_back(child->weight(), std::move(child_picker));
         break;
       }
       default:
@@ -441,14 +429,14 @@ void WeightedTargetLb::UpdateStateLocked() {
   absl::Status status;
   switch (connectivity_state) {
     case GRPC_CHANNEL_READY:
-      picker = MakeRefCounted<WeightedPicker>(std::move(ready_picker_list));
+      picker = WeightedPicker::Make(std::move(ready_picker_list));
       break;
     case GRPC_CHANNEL_CONNECTING:
     case GRPC_CHANNEL_IDLE:
       picker = MakeRefCounted<QueuePicker>(Ref(DEBUG_LOCATION, "QueuePicker"));
       break;
     default:
-      picker = MakeRefCounted<WeightedPicker>(std::move(tf_picker_list));
+      picker = WeightedPicker::Make(std::move(tf_picker_list));
   }
   channel_control_helper()->UpdateState(connectivity_state, status,
                                         std::move(picker));
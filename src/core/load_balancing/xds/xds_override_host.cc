@@ -35,6 +35,7 @@
 #include <vector>
 
 #include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/functional/function_ref.h"
 #include "absl/log/absl_check.h"
 #include "absl/log/absl_log.h"
@@ -415,7 +416,9 @@ class XdsOverrideHostLb final : public LoadBalancingPolicy {
   absl::Status status_;
   RefCountedPtr<SubchannelPicker> picker_;
   Mutex mu_;
-  std::map<std::string, RefCountedPtr<SubchannelEntry>, std::less<>>
+  // Looked up under mu_ for each address in a session cookie on every
+  // pick, so this is a hash map rather than a tree.
+  absl::flat_hash_map<std::string, RefCountedPtr<SubchannelEntry>>
       subchannel_map_ ABSL_GUARDED_BY(mu_);
 
   // Timer handle for periodic subchannel sweep.
@@ -848,7 +851,7 @@ void XdsOverrideHostLb::UpdateAddressMap(
             << "[xds_override_host_lb " << this << "] removing map key "
             << it->first;
         it->second->UnsetSubchannel(&subchannel_refs_to_drop);
-        it = subchannel_map_.erase(it);
+        subchannel_map_.erase(it++);
       } else {
         ++it;
       }
@@ -38,6 +38,7 @@ extern void RegisterXdsOverrideHostLbPolicy(
     CoreConfiguration::Builder* builder);
 extern void RegisterXdsWrrLocalityLbPolicy(CoreConfiguration::Builder* builder);
 extern void RegisterRingHashLbPolicy(CoreConfiguration::Builder* builder);
+extern void RegisterMaglevLbPolicy(CoreConfiguration::Builder* builder);
 extern void RegisterFileWatcherCertificateProvider(
     CoreConfiguration::Builder* builder);
 extern void RegisterXdsHttpProxyMapper(CoreConfiguration::Builder* builder);
@@ -61,6 +62,7 @@ void RegisterExtraFilters(CoreConfiguration::Builder* builder) {
   RegisterXdsOverrideHostLbPolicy(builder);
   RegisterXdsWrrLocalityLbPolicy(builder);
   RegisterRingHashLbPolicy(builder);
+  RegisterMaglevLbPolicy(builder);
   RegisterFileWatcherCertificateProvider(builder);
   RegisterXdsHttpProxyMapper(builder);
 #endif
@@ -192,6 +192,8 @@ class AresClientChannelDNSResolver final : public PollingResolver {
   const bool enable_srv_queries_;
   // timeout in milliseconds for active DNS queries
   const int query_timeout_ms_;
+  // the TXT record rarely changes between resolutions
+  ServiceConfigParseCache service_config_cache_;
 };
 
 AresClientChannelDNSResolver::AresClientChannelDNSResolver(
@@ -313,7 +315,7 @@ AresClientChannelDNSResolver::AresRequestWrapper::OnResolvedLocked(
         GRPC_TRACE_VLOG(cares_resolver, 2)
             << "(c-ares resolver) resolver:" << this
             << " selected service config choice: " << *service_config_string;
-        result.service_config = ServiceConfigImpl::Create(
+        result.service_config = resolver_->service_config_cache_.Parse(
             resolver_->channel_args(), *service_config_string);
         if (!result.service_config.ok()) {
           result.service_config = absl::UnavailableError(
@@ -158,6 +158,8 @@ class EventEngineClientChannelDNSResolver final : public PollingResolver {
   // timeout in milliseconds for active DNS queries
   EventEngine::Duration query_timeout_ms_;
   std::shared_ptr<EventEngine> event_engine_;
+  // the TXT record rarely changes between resolutions
+  ServiceConfigParseCache service_config_cache_;
 };
 
 EventEngineClientChannelDNSResolver::EventEngineClientChannelDNSResolver(
@@ -494,8 +496,8 @@ void EventEngineClientChannelDNSResolver::EventEngineDNSRequestWrapper::
       << "(event_engine client channel resolver) DNSResolver::"
       << event_engine_resolver_.get()
       << " selected service config choice: " << service_config->c_str();
-  result->service_config =
-      ServiceConfigImpl::Create(resolver_->channel_args(), *service_config);
+  result->service_config = resolver_->service_config_cache_.Parse(
+      resolver_->channel_args(), *service_config);
   if (!result->service_config.ok()) {
     result->service_config = absl::UnavailableError(
         absl::StrCat("failed to parse service config: ",
@@ -82,6 +82,7 @@
 #include "src/core/util/mpscq.h"
 #include "src/core/util/orphanable.h"
 #include "src/core/util/status_helper.h"
+#include "src/core/util/time_precise.h"
 #include "src/core/util/useful.h"
 
 namespace grpc_core {
@@ -135,6 +136,12 @@ Server::ListenerState::ListenerState(RefCountedPtr<Server> server,
     connection_quota_->SetMaxIncomingConnections(
         max_allowed_incoming_connections.value());
   }
+  auto max_incoming_connection_rate =
+      server_->channel_args().GetInt(GRPC_ARG_MAX_INCOMING_CONNECTION_RATE);
+  if (max_incoming_connection_rate.has_value()) {
+    connection_quota_->SetMaxIncomingConnectionRate(
+        max_incoming_connection_rate.value());
+  }
 }
 
 void Server::ListenerState::Start() {
@@ -620,6 +627,8 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
             pending_call.rc = reinterpret_cast<RequestedCall*>(
                 requests_per_cq_[request_queue_index].Pop());
             if (pending_call.rc != nullptr) {
+              server_->pending_delay_detector_.RecordQueueingDelay(
+                  pending_promises_.front()->Age(), Timestamp::Now());
               pending_call.pending_promise =
                   std::move(pending_promises_.front());
               pending_promises_.pop();
@@ -628,6 +637,8 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
             pending_call.rc = reinterpret_cast<RequestedCall*>(
                 requests_per_cq_[request_queue_index].Pop());
             if (pending_call.rc != nullptr) {
+              server_->pending_delay_detector_.RecordQueueingDelay(
+                  pending_filter_stack_.front().Age(), Timestamp::Now());
               pending_call.pending_filter_stack =
                   pending_filter_stack_.front().calld;
               pending_filter_stack_.pop();
@@ -729,9 +740,18 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
         rc = reinterpret_cast<RequestedCall*>(requests_per_cq_[cq_idx].Pop());
         if (rc != nullptr) break;
       }
-      if (rc == nullptr) {
-        if (server_->pending_backlog_protector_.Reject(pending_promises_.size(),
-                                                       server_->bitgen_)) {
+      const Timestamp now = Timestamp::Now();
+      if (rc != nullptr) {
+        // Matched without waiting: there is no standing queue.
+        server_->pending_delay_detector_.RecordQueueingDelay(Duration::Zero(),
+                                                             now);
+      } else {
+        if (server_->pending_delay_detector_.Overloaded(now)) {
+          return Immediate(absl::ResourceExhaustedError(
+              "Pending requests are waiting too long for this server"));
+        }
+        if (server_->pending_backlog_protector_.Reject(
+                pending_promises_.size())) {
           return Immediate(absl::ResourceExhaustedError(
               "Too many pending requests for this server"));
         }
@@ -1086,7 +1106,8 @@ absl::StatusOr<ClientMetadataHandle> CheckClientMetadata(
 }  // namespace
 
 auto Server::MatchRequestAndMaybeReadFirstMessage(CallHandler call_handler,
-                                                  ClientMetadataHandle md) {
+                                                  ClientMetadataHandle md,
+                                                  size_t cq_idx) {
   auto* registered_method = static_cast<RegisteredMethod*>(
       md->get(GrpcRegisteredMethod()).value_or(nullptr));
   RequestMatcherInterface* rm;
@@ -1114,28 +1135,34 @@ auto Server::MatchRequestAndMaybeReadFirstMessage(CallHandler call_handler,
       },
       []() -> FirstMessageResult { return FirstMessageResult(std::nullopt); });
   return TryJoin<absl::StatusOr>(
-      std::move(maybe_read_first_message), rm->MatchRequest(0),
+      std::move(maybe_read_first_message), rm->MatchRequest(cq_idx),
       [md = std::move(md)]() mutable {
         return ValueOrFailure<ClientMetadataHandle>(std::move(md));
       });
 }
 
-auto Server::MatchAndPublishCall(CallHandler call_handler) {
-  call_handler.SpawnGuarded("request_matcher", [this, call_handler]() mutable {
+auto Server::MatchAndPublishCall(CallHandler call_handler, size_t cq_idx) {
+  const gpr_cycle_counter start_time = gpr_get_cycle_counter();
+  call_handler.SpawnGuarded("request_matcher", [this, call_handler, cq_idx,
+                                                start_time]() mutable {
     return TrySeq(
         call_handler.UntilCallCompletes(TrySeq(
             // Wait for initial metadata to pass through all filters
             Map(call_handler.PullClientInitialMetadata(), CheckClientMetadata),
             // Match request with requested call
-            [this, call_handler](ClientMetadataHandle md) mutable {
+            [this, call_handler, cq_idx](ClientMetadataHandle md) mutable {
               return MatchRequestAndMaybeReadFirstMessage(
-                  std::move(call_handler), std::move(md));
+                  std::move(call_handler), std::move(md), cq_idx);
             })),
         // Publish call to cq
-        [call_handler, this](std::tuple<std::optional<MessageHandle>,
-                                        RequestMatcherInterface::MatchResult,
-                                        ClientMetadataHandle>
-                                 r) {
+        [call_handler, this,
+         start_time](std::tuple<std::optional<MessageHandle>,
+                                RequestMatcherInterface::MatchResult,
+                                ClientMetadataHandle>
+                         r) {
+          global_stats().IncrementServerCallQueueTimeUs(
+              gpr_cycle_counter_sub_micros(gpr_get_cycle_counter(),
+                                           start_time));
           RequestMatcherInterface::MatchResult& mr = std::get<1>(r);
           auto md = std::move(std::get<2>(r));
           auto* rc = mr.TakeCall();
@@ -1153,7 +1180,7 @@ auto Server::MatchAndPublishCall(CallHandler call_handler) {
 }
 
 absl::StatusOr<RefCountedPtr<UnstartedCallDestination>>
-Server::MakeCallDestination(const ChannelArgs& args) {
+Server::MakeCallDestination(const ChannelArgs& args, size_t cq_idx) {
   InterceptionChainBuilder builder(args);
   // TODO(ctiller): find a way to avoid adding a server ref per call
   builder.AddOnClientInitialMetadata([self = Ref()](ClientMetadata& md) {
@@ -1162,9 +1189,10 @@ Server::MakeCallDestination(const ChannelArgs& args) {
   CoreConfiguration::Get().channel_init().AddToInterceptionChainBuilder(
       GRPC_SERVER_CHANNEL, builder);
   return builder.Build(
-      MakeCallDestinationFromHandlerFunction([this](CallHandler handler) {
-        return MatchAndPublishCall(std::move(handler));
-      }));
+      MakeCallDestinationFromHandlerFunction(
+          [this, cq_idx](CallHandler handler) {
+            return MatchAndPublishCall(std::move(handler), cq_idx);
+          }));
 }
 
 Server::Server(const ChannelArgs& args)
@@ -1254,7 +1282,8 @@ grpc_error_handle Server::SetupTransport(
     // TODO(ctiller): post-v3-transition make this method take an
     // OrphanablePtr<ServerTransport> directly.
     OrphanablePtr<ServerTransport> t(transport->server_transport());
-    auto destination = MakeCallDestination(args.SetObject(transport));
+    auto destination = MakeCallDestination(
+        args.SetObject(transport), ConnectionCqIndex(accepting_pollset));
     if (!destination.ok()) {
       return absl_status_to_grpc_error(destination.status());
     }
@@ -1282,14 +1311,7 @@ grpc_error_handle Server::SetupTransport(
     ChannelData* chand = static_cast<ChannelData*>(
         grpc_channel_stack_element(channel_stack, 0)->channel_data);
     // Set up CQs.
-    size_t cq_idx;
-    for (cq_idx = 0; cq_idx < cqs_.size(); cq_idx++) {
-      if (grpc_cq_pollset(cqs_[cq_idx]) == accepting_pollset) break;
-    }
-    if (cq_idx == cqs_.size()) {
-      // Completion queue not found.  Pick a random one to publish new calls to.
-      cq_idx = static_cast<size_t>(rand()) % std::max<size_t>(1, cqs_.size());
-    }
+    const size_t cq_idx = ConnectionCqIndex(accepting_pollset);
     intptr_t channelz_socket_uuid = 0;
     if (socket_node != nullptr) {
       channelz_socket_uuid = socket_node->uuid();
@@ -1302,6 +1324,14 @@ grpc_error_handle Server::SetupTransport(
   return absl::OkStatus();
 }
 
+size_t Server::ConnectionCqIndex(grpc_pollset* accepting_pollset) const {
+  for (size_t cq_idx = 0; cq_idx < cqs_.size(); cq_idx++) {
+    if (grpc_cq_pollset(cqs_[cq_idx]) == accepting_pollset) return cq_idx;
+  }
+  // Completion queue not found.  Pick a random one to publish new calls to.
+  return static_cast<size_t>(rand()) % std::max<size_t>(1, cqs_.size());
+}
+
 bool Server::HasOpenConnections() {
   MutexLock lock(&mu_global_);
   return !channels_.empty() || !connections_.empty();
@@ -1682,8 +1712,7 @@ void Server::ChannelData::InitTransport(RefCountedPtr<Server> server,
   op->set_accept_stream_fn = AcceptStream;
   op->set_registered_method_matcher_fn = [](void* arg,
                                             ClientMetadata* metadata) {
-    static_cast<ChannelData*>(arg)->server_->SetRegisteredMethodOnMetadata(
-        *metadata);
+    static_cast<ChannelData*>(arg)->SetRegisteredMethodOnMetadata(*metadata);
   };
   op->set_accept_stream_user_data = this;
   op->start_connectivity_watch = MakeOrphanable<ConnectivityWatcher>(this);
@@ -1729,6 +1758,39 @@ void Server::SetRegisteredMethodOnMetadata(ClientMetadata& metadata) {
   metadata.Set(GrpcRegisteredMethod(), method);
 }
 
+namespace {
+bool IsSameSliceMemory(const Slice& a, const Slice& b) {
+  return a.data() == b.data() && a.size() == b.size();
+}
+}  // namespace
+
+void Server::ChannelData::SetRegisteredMethodOnMetadata(
+    ClientMetadata& metadata) {
+  auto* authority = metadata.get_pointer(HttpAuthorityMetadata());
+  if (authority == nullptr) {
+    authority = metadata.get_pointer(HostMetadata());
+    if (authority == nullptr) {
+      // Authority not being set is an RPC error.
+      return;
+    }
+  }
+  auto* path = metadata.get_pointer(HttpPathMetadata());
+  if (path == nullptr) {
+    // Path not being set would result in an RPC error.
+    return;
+  }
+  // Inlined slices live in the metadata itself, so they never match the
+  // remembered ones by address and always take the slow path.
+  if (!IsSameSliceMemory(*path, last_path_) ||
+      !IsSameSliceMemory(*authority, last_authority_)) {
+    last_registered_method_ = server_->GetRegisteredMethod(
+        authority->as_string_view(), path->as_string_view());
+    last_path_ = path->Ref();
+    last_authority_ = authority->Ref();
+  }
+  metadata.Set(GrpcRegisteredMethod(), last_registered_method_);
+}
+
 void Server::ChannelData::AcceptStream(void* arg, Transport* /*transport*/,
                                        const void* transport_server_data) {
   auto* chand = static_cast<Server::ChannelData*>(arg);
@@ -1860,6 +1922,8 @@ void Server::CallData::Start(grpc_call_element* elem) {
 }
 
 void Server::CallData::Publish(size_t cq_idx, RequestedCall* rc) {
+  global_stats().IncrementServerCallQueueTimeUs(gpr_cycle_counter_sub_micros(
+      gpr_get_cycle_counter(), Call::FromC(call_)->start_time()));
   grpc_call_set_completion_queue(call_, rc->cq_bound_to_call);
   *rc->call = call_;
   cq_new_ = server_->cqs_[cq_idx];
@@ -40,7 +40,6 @@
 #include "absl/container/flat_hash_map.h"
 #include "absl/container/flat_hash_set.h"
 #include "absl/hash/hash.h"
-#include "absl/random/random.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/string_view.h"
 #include "src/core/channelz/channelz.h"
@@ -63,6 +62,7 @@
 #include "src/core/lib/transport/transport.h"
 #include "src/core/server/server_interface.h"
 #include "src/core/telemetry/call_tracer.h"
+#include "src/core/util/codel.h"
 #include "src/core/util/cpp_impl_of.h"
 #include "src/core/util/dual_ref_counted.h"
 #include "src/core/util/orphanable.h"
@@ -74,6 +74,15 @@
 #define GRPC_ARG_SERVER_MAX_PENDING_REQUESTS "grpc.server.max_pending_requests"
 #define GRPC_ARG_SERVER_MAX_PENDING_REQUESTS_HARD_LIMIT \
   "grpc.server.max_pending_requests_hard_limit"
+// Once requests have waited for a requested call for at least this long
+// throughout an interval, requests that would have to wait are rejected with
+// RESOURCE_EXHAUSTED until the waits come back down.  Disabled (0) by
+// default.
+#define GRPC_ARG_SERVER_QUEUEING_DELAY_TARGET_MS \
+  "grpc.server.queueing_delay_target_ms"
+// The interval for GRPC_ARG_SERVER_QUEUEING_DELAY_TARGET_MS.  Default 100.
+#define GRPC_ARG_SERVER_QUEUEING_DELAY_INTERVAL_MS \
+  "grpc.server.queueing_delay_interval_ms"
 
 namespace grpc_core {
 
@@ -448,6 +457,10 @@ class Server : public ServerInterface,
 
     static void FinishDestroy(void* arg, grpc_error_handle error);
 
+    // Server::SetRegisteredMethodOnMetadata, but remembering the last match.
+    // Called by the transport, one stream at a time.
+    void SetRegisteredMethodOnMetadata(ClientMetadata& metadata);
+
     RefCountedPtr<Server> server_;
     RefCountedPtr<Channel> channel_;
     // The index into Server::cqs_ of the CQ used as a starting point for
@@ -456,6 +469,14 @@ class Server : public ServerInterface,
     std::optional<std::list<ChannelData*>::iterator> list_position_;
     grpc_closure finish_destroy_channel_closure_;
     intptr_t channelz_socket_uuid_;
+    // The path and authority of the last call on this connection and the
+    // registered method they resolved to. HPACK hands out refs to the same
+    // slices for headers repeated from its table, so those are recognized
+    // by address without hashing or comparing the strings. Holding the refs
+    // keeps the addresses from being reused.
+    Slice last_path_;
+    Slice last_authority_;
+    RegisteredMethod* last_registered_method_ = nullptr;
   };
 
   class CallData {
@@ -638,11 +659,18 @@ class Server : public ServerInterface,
   //     optional<MessageHandle>,
   //     RequestMatcherInterface::MatchResult,
   //     ClientMetadataHandle>
+  // Calls are matched first against calls requested on cq_idx, the CQ of
+  // the connection they arrived on, and then against those of the other
+  // CQs.
   auto MatchRequestAndMaybeReadFirstMessage(CallHandler call_handler,
-                                            ClientMetadataHandle md);
-  auto MatchAndPublishCall(CallHandler call_handler);
+                                            ClientMetadataHandle md,
+                                            size_t cq_idx);
+  auto MatchAndPublishCall(CallHandler call_handler, size_t cq_idx);
   absl::StatusOr<RefCountedPtr<UnstartedCallDestination>> MakeCallDestination(
-      const ChannelArgs& args);
+      const ChannelArgs& args, size_t cq_idx);
+  // Returns the index of the CQ to which calls on a connection accepted by
+  // accepting_pollset are published by preference.
+  size_t ConnectionCqIndex(grpc_pollset* accepting_pollset) const;
 
   ChannelArgs const channel_args_;
   RefCountedPtr<channelz::ServerNode> channelz_node_;
@@ -696,8 +724,14 @@ class Server : public ServerInterface,
           0,
           channel_args_.GetInt(GRPC_ARG_SERVER_MAX_PENDING_REQUESTS_HARD_LIMIT)
               .value_or(3000)))};
+  CoDel pending_delay_detector_ ABSL_GUARDED_BY(mu_call_){
+      Duration::Milliseconds(std::max(
+          0, channel_args_.GetInt(GRPC_ARG_SERVER_QUEUEING_DELAY_TARGET_MS)
+                 .value_or(0))),
+      Duration::Milliseconds(std::max(
+          1, channel_args_.GetInt(GRPC_ARG_SERVER_QUEUEING_DELAY_INTERVAL_MS)
+                 .value_or(100)))};
   const Duration max_time_in_pending_queue_;
-  absl::BitGen bitgen_ ABSL_GUARDED_BY(mu_call_);
 
   std::list<ChannelData*> channels_;
   absl::flat_hash_set<OrphanablePtr<ServerTransport>> connections_
@@ -35,10 +35,12 @@
 #include <vector>
 
 #include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/log/absl_check.h"
 #include "absl/log/absl_log.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
+#include "absl/strings/ascii.h"
 #include "absl/strings/match.h"
 #include "absl/strings/numbers.h"
 #include "absl/strings/str_cat.h"
@@ -238,6 +240,8 @@ class XdsServerConfigFetcher::ListenerWatcher::FilterChainMatchManager final
   absl::StatusOr<RefCountedPtr<XdsCertificateProvider>>
   CreateOrGetXdsCertificateProviderFromFilterChainData(
       const XdsListenerResource::FilterChainData* filter_chain);
+  RefCountedPtr<XdsChannelStackModifier> MakeChannelStackModifier(
+      const XdsListenerResource::FilterChainData& filter_chain) const;
   void Orphaned() override;
 
   // Helper functions invoked by RouteConfigWatcher when there are updates to
@@ -257,6 +261,12 @@ class XdsServerConfigFetcher::ListenerWatcher::FilterChainMatchManager final
   // than copying the filter chain data here.
   XdsListenerResource::FilterChainMap filter_chain_map_;
   std::optional<XdsListenerResource::FilterChainData> default_filter_chain_;
+  // The channel stack modifier of each filter chain, which depends only on
+  // its HTTP filters.  Built by StartRdsWatch() and read-only afterwards, so
+  // that connections share them instead of building their own.
+  std::map<const XdsListenerResource::FilterChainData*,
+           RefCountedPtr<XdsChannelStackModifier>>
+      channel_stack_modifiers_;
   Mutex mu_;
   size_t rds_resources_yet_to_fetch_ ABSL_GUARDED_BY(mu_) = 0;
   std::map<std::string /* resource_name */, RdsUpdateState> rds_map_
@@ -350,6 +360,7 @@ class XdsServerConfigFetcher::ListenerWatcher::FilterChainMatchManager::
 
     std::vector<std::string> domains;
     std::vector<Route> routes;
+    XdsRouting::RouteIndex route_index;
   };
 
   class VirtualHostListIterator final
@@ -371,6 +382,10 @@ class XdsServerConfigFetcher::ListenerWatcher::FilterChainMatchManager::
   };
 
   std::vector<VirtualHost> virtual_hosts_;
+  // The first virtual host of each lower-cased exact domain.  Exact matches
+  // win over all others, so a hit here skips matching the authority
+  // against every domain pattern.
+  absl::flat_hash_map<std::string, size_t> exact_domains_;
 };
 
 // An XdsServerConfigSelectorProvider implementation for when the
@@ -710,10 +725,18 @@ void XdsServerConfigFetcher::ListenerWatcher::FilterChainMatchManager::
     if (rds_name != nullptr) resource_names.insert(*rds_name);
     std::reverse(hcm.http_filters.begin(), hcm.http_filters.end());
   }
-  // Reverse the lists of HTTP filters in all the filter chains
+  // Reverse the lists of HTTP filters in all the filter chains, and build
+  // their channel stack modifiers.
   for (auto* filter_chain_data : filter_chain_data_set) {
     auto& hcm = filter_chain_data->http_connection_manager;
     std::reverse(hcm.http_filters.begin(), hcm.http_filters.end());
+    channel_stack_modifiers_.emplace(
+        filter_chain_data, MakeChannelStackModifier(*filter_chain_data));
+  }
+  if (default_filter_chain_.has_value()) {
+    channel_stack_modifiers_.emplace(
+        &*default_filter_chain_,
+        MakeChannelStackModifier(*default_filter_chain_));
   }
   // Start watching on referenced RDS resources
   struct WatcherToStart {
@@ -849,6 +872,35 @@ void XdsServerConfigFetcher::ListenerWatcher::FilterChainMatchManager::
              << resource_name << "; ignoring in favor of existing resource";
 }
 
+RefCountedPtr<XdsChannelStackModifier>
+XdsServerConfigFetcher::ListenerWatcher::FilterChainMatchManager::
+    MakeChannelStackModifier(
+        const XdsListenerResource::FilterChainData& filter_chain) const {
+  // Iterate the list of HTTP filters in reverse since in Core, received data
+  // flows *up* the stack.
+  std::vector<const grpc_channel_filter*> filters;
+  const auto& http_filter_registry =
+      static_cast<const GrpcXdsBootstrap&>(xds_client_->bootstrap())
+          .http_filter_registry();
+  for (const auto& http_filter :
+       filter_chain.http_connection_manager.http_filters) {
+    // Find filter.  This is guaranteed to succeed, because it's checked
+    // at config validation time in the XdsApi code.
+    const XdsHttpFilterImpl* filter_impl =
+        http_filter_registry.GetFilterForType(
+            http_filter.config.config_proto_type_name);
+    ABSL_CHECK_NE(filter_impl, nullptr);
+    // Some filters like the router filter are no-op filters and do not have
+    // an implementation.
+    if (filter_impl->channel_filter() != nullptr) {
+      filters.push_back(filter_impl->channel_filter());
+    }
+  }
+  // Add config selector filter.
+  filters.push_back(&kServerConfigSelectorFilter);
+  return MakeRefCounted<XdsChannelStackModifier>(std::move(filters));
+}
+
 const XdsListenerResource::FilterChainData* FindFilterChainDataForSourcePort(
     const XdsListenerResource::FilterChainMap::SourcePortsMap& source_ports_map,
     absl::string_view port_str) {
@@ -1020,32 +1072,11 @@ absl::StatusOr<ChannelArgs> XdsServerConfigFetcher::ListenerWatcher::
     return absl::UnavailableError("No matching filter chain found");
   }
   RefCountedPtr<ServerConfigSelectorProvider> server_config_selector_provider;
-  RefCountedPtr<XdsChannelStackModifier> channel_stack_modifier;
   RefCountedPtr<XdsCertificateProvider> xds_certificate_provider;
-  // Iterate the list of HTTP filters in reverse since in Core, received data
-  // flows *up* the stack.
-  std::vector<const grpc_channel_filter*> filters;
-  const auto& http_filter_registry =
-      static_cast<const GrpcXdsBootstrap&>(xds_client_->bootstrap())
-          .http_filter_registry();
-  for (const auto& http_filter :
-       filter_chain->http_connection_manager.http_filters) {
-    // Find filter.  This is guaranteed to succeed, because it's checked
-    // at config validation time in the XdsApi code.
-    const XdsHttpFilterImpl* filter_impl =
-        http_filter_registry.GetFilterForType(
-            http_filter.config.config_proto_type_name);
-    ABSL_CHECK_NE(filter_impl, nullptr);
-    // Some filters like the router filter are no-op filters and do not have
-    // an implementation.
-    if (filter_impl->channel_filter() != nullptr) {
-      filters.push_back(filter_impl->channel_filter());
-    }
-  }
-  // Add config selector filter.
-  filters.push_back(&kServerConfigSelectorFilter);
-  channel_stack_modifier =
-      MakeRefCounted<XdsChannelStackModifier>(std::move(filters));
+  auto it = channel_stack_modifiers_.find(filter_chain);
+  ABSL_CHECK(it != channel_stack_modifiers_.end());
+  const RefCountedPtr<XdsChannelStackModifier>& channel_stack_modifier =
+      it->second;
   Match(
       filter_chain->http_connection_manager.route_config,
       // RDS resource name
@@ -1142,6 +1173,15 @@ XdsServerConfigFetcher::ListenerWatcher::FilterChainMatchManager::
             ServiceConfigImpl::Create(result->args, json.c_str()).value();
       }
     }
+    virtual_host.route_index = XdsRouting::RouteIndex(
+        VirtualHost::RouteListIterator(&virtual_host.routes));
+    for (const std::string& domain : virtual_host.domains) {
+      if (!absl::StrContains(domain, '*')) {
+        config_selector->exact_domains_.emplace(
+            absl::AsciiStrToLower(domain),
+            config_selector->virtual_hosts_.size() - 1);
+      }
+    }
   }
   return config_selector;
 }
@@ -1160,15 +1200,21 @@ XdsServerConfigFetcher::ListenerWatcher::FilterChainMatchManager::
   }
   absl::string_view authority =
       metadata->get_pointer(HttpAuthorityMetadata())->as_string_view();
-  auto vhost_index = XdsRouting::FindVirtualHostForDomain(
-      VirtualHostListIterator(&virtual_hosts_), authority);
+  std::optional<size_t> vhost_index;
+  auto it = exact_domains_.find(absl::AsciiStrToLower(authority));
+  if (it != exact_domains_.end()) {
+    vhost_index = it->second;
+  } else {
+    vhost_index = XdsRouting::FindVirtualHostForDomain(
+        VirtualHostListIterator(&virtual_hosts_), authority);
+  }
   if (!vhost_index.has_value()) {
     return absl::UnavailableError(
         absl::StrCat("could not find VirtualHost for ", authority,
                      " in RouteConfiguration"));
   }
   auto& virtual_host = virtual_hosts_[vhost_index.value()];
-  auto route_index = XdsRouting::GetRouteForRequest(
+  auto route_index = virtual_host.route_index.GetRouteForRequest(
       VirtualHost::RouteListIterator(&virtual_host.routes), path, metadata);
   if (route_index.has_value()) {
     auto& route = virtual_host.routes[route_index.value()];
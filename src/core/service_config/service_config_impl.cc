@@ -17,7 +17,6 @@
 #include "src/core/service_config/service_config_impl.h"
 
 #include <grpc/support/port_platform.h>
-#include <string.h>
 
 #include <optional>
 #include <string>
@@ -35,7 +34,6 @@
 #include "src/core/util/json/json_object_loader.h"
 #include "src/core/util/json/json_reader.h"
 #include "src/core/util/json/json_writer.h"
-#include "src/core/util/memory.h"
 #include "src/core/util/validation_errors.h"
 
 namespace grpc_core {
@@ -181,16 +179,30 @@ ServiceConfigImpl::GetMethodParsedConfigVector(const grpc_slice& path) const {
   auto it = parsed_method_configs_map_.find(path);
   if (it != parsed_method_configs_map_.end()) return it->second;
   // If we didn't find a match for the path, try looking for a wildcard
-  // entry (i.e., change "/service/method" to "/service/").
-  UniquePtr<char> path_str(grpc_slice_to_c_string(path));
-  char* sep = strrchr(path_str.get(), '/');
-  if (sep == nullptr) return nullptr;  // Shouldn't ever happen.
-  sep[1] = '\0';
-  grpc_slice wildcard_path = grpc_slice_from_static_string(path_str.get());
-  it = parsed_method_configs_map_.find(wildcard_path);
+  // entry (i.e., change "/service/method" to "/service/"). The wildcard is a
+  // prefix of the path, so look it up without copying anything.
+  const absl::string_view path_str = StringViewFromSlice(path);
+  const size_t sep = path_str.rfind('/');
+  // Shouldn't ever happen.
+  if (sep == absl::string_view::npos) return nullptr;
+  it = parsed_method_configs_map_.find(
+      grpc_slice_sub_no_ref(path, 0, sep + 1));
   if (it != parsed_method_configs_map_.end()) return it->second;
   // Try default method config, if set.
   return default_method_config_vector_;
 }
 
+absl::StatusOr<RefCountedPtr<ServiceConfig>> ServiceConfigParseCache::Parse(
+    const ChannelArgs& args, absl::string_view json_string) {
+  MutexLock lock(&mu_);
+  if (has_result_ && json_string_ == json_string && args_ == args) {
+    return result_;
+  }
+  result_ = ServiceConfigImpl::Create(args, json_string);
+  args_ = args;
+  json_string_ = std::string(json_string);
+  has_result_ = true;
+  return result_;
+}
+
 }  // namespace grpc_core
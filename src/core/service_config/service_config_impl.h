@@ -35,6 +35,7 @@
 #include "src/core/service_config/service_config_parser.h"
 #include "src/core/util/json/json.h"
 #include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/sync.h"
 #include "src/core/util/validation_errors.h"
 
 // The main purpose of the code here is to parse the service config in
@@ -117,6 +118,25 @@ class ServiceConfigImpl final : public ServiceConfig {
       parsed_method_config_vectors_storage_;
 };
 
+// Remembers the last service config parsed from text. Polling resolvers
+// usually see the same config text on every resolution, and this lets them
+// skip re-parsing it. Thread-safe.
+class ServiceConfigParseCache final {
+ public:
+  // Equivalent to ServiceConfigImpl::Create(args, json_string), but returns
+  // the previous result if both are unchanged since the last call.
+  absl::StatusOr<RefCountedPtr<ServiceConfig>> Parse(
+      const ChannelArgs& args, absl::string_view json_string);
+
+ private:
+  Mutex mu_;
+  ChannelArgs args_ ABSL_GUARDED_BY(mu_);
+  std::string json_string_ ABSL_GUARDED_BY(mu_);
+  absl::StatusOr<RefCountedPtr<ServiceConfig>> result_ ABSL_GUARDED_BY(mu_) =
+      absl::UnknownError("nothing parsed yet");
+  bool has_result_ ABSL_GUARDED_BY(mu_) = false;
+};
+
 }  // namespace grpc_core
 
 #endif  // GRPC_SRC_CORE_SERVICE_CONFIG_SERVICE_CONFIG_IMPL_H
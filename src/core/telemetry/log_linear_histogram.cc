@@ -0,0 +1,110 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/telemetry/log_linear_histogram.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+
+#include "absl/log/absl_check.h"
+
+namespace grpc_core {
+
+//
+// LogLinearHistogramShape
+//
+
+uint64_t LogLinearHistogramShape::LowerBound(size_t bucket) const {
+  const uint64_t linear = uint64_t{1} << precision_bits_;
+  if (bucket < linear) return bucket;
+  const uint32_t shift = (bucket >> precision_bits_) - 1;
+  return (linear | (bucket & (linear - 1))) << shift;
+}
+
+//
+// LogLinearHistogram
+//
+
+void LogLinearHistogram::Merge(const LogLinearHistogram& other) {
+  ABSL_CHECK(shape_ == other.shape_);
+  for (size_t i = 0; i < buckets_.size(); ++i) {
+    buckets_[i] += other.buckets_[i];
+  }
+}
+
+LogLinearHistogram LogLinearHistogram::operator-(
+    const LogLinearHistogram& other) const {
+  ABSL_CHECK(shape_ == other.shape_);
+  LogLinearHistogram result(shape_);
+  for (size_t i = 0; i < buckets_.size(); ++i) {
+    result.buckets_[i] = buckets_[i] - other.buckets_[i];
+  }
+  return result;
+}
+
+uint64_t LogLinearHistogram::Count() const {
+  uint64_t count = 0;
+  for (uint64_t bucket : buckets_) count += bucket;
+  return count;
+}
+
+double LogLinearHistogram::Percentile(double p) const {
+  const uint64_t count = Count();
+  if (count == 0) return 0;
+  const double rank = count * std::clamp(p, 0.0, 100.0) / 100.0;
+  double count_so_far = 0;
+  for (size_t i = 0; i < buckets_.size(); ++i) {
+    if (buckets_[i] == 0) continue;
+    if (count_so_far + buckets_[i] >= rank) {
+      const double lower = shape_.LowerBound(i);
+      const double upper = i + 1 < buckets_.size()
+                               ? shape_.LowerBound(i + 1)
+                               : shape_.max_value() + 1.0;
+      return lower + (upper - lower) * (rank - count_so_far) / buckets_[i];
+    }
+    count_so_far += buckets_[i];
+  }
+  return shape_.max_value();
+}
+
+//
+// LogLinearHistogramCollector
+//
+
+LogLinearHistogramCollector::LogLinearHistogramCollector(
+    LogLinearHistogramShape shape, PerCpuOptions options)
+    : shape_(shape), shards_(options) {
+  ABSL_CHECK_LE(shape.precision_bits(),
+                LogLinearHistogramShape::kMaxPrecisionBits);
+  const size_t num_buckets = shape.num_buckets();
+  for (Shard& shard : shards_) {
+    shard.buckets.reset(new std::atomic<uint64_t>[num_buckets]);
+    for (size_t i = 0; i < num_buckets; ++i) {
+      shard.buckets[i].store(0, std::memory_order_relaxed);
+    }
+  }
+}
+
+LogLinearHistogram LogLinearHistogramCollector::Collect() const {
+  LogLinearHistogram result(shape_);
+  for (const Shard& shard : shards_) {
+    for (size_t i = 0; i < result.buckets_.size(); ++i) {
+      result.buckets_[i] += shard.buckets[i].load(std::memory_order_relaxed);
+    }
+  }
+  return result;
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,128 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_TELEMETRY_LOG_LINEAR_HISTOGRAM_H
+#define GRPC_SRC_CORE_TELEMETRY_LOG_LINEAR_HISTOGRAM_H
+
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "absl/numeric/bits.h"
+#include "absl/types/span.h"
+#include "src/core/util/per_cpu.h"
+
+namespace grpc_core {
+
+// The bucket layout of a log-linear (HDR style) histogram: each power of two
+// is split into 2^precision_bits equal buckets, so that any value is known to
+// within a relative error of 2^-precision_bits however large it is. Values
+// below 2^precision_bits get a bucket each, and values above max_value are
+// counted as max_value.
+class LogLinearHistogramShape {
+ public:
+  static constexpr uint32_t kMaxPrecisionBits = 10;
+
+  constexpr LogLinearHistogramShape(uint32_t precision_bits,
+                                    uint64_t max_value)
+      : precision_bits_(precision_bits), max_value_(max_value) {}
+
+  uint32_t precision_bits() const { return precision_bits_; }
+  uint64_t max_value() const { return max_value_; }
+
+  size_t BucketFor(uint64_t value) const {
+    if (value > max_value_) value = max_value_;
+    const uint64_t linear = uint64_t{1} << precision_bits_;
+    if (value < linear) return value;
+    const uint32_t exponent = absl::bit_width(value) - 1;
+    const uint32_t shift = exponent - precision_bits_;
+    return ((shift + 1) << precision_bits_) |
+           ((value >> shift) & (linear - 1));
+  }
+  // The smallest value counted in bucket.
+  uint64_t LowerBound(size_t bucket) const;
+  size_t num_buckets() const { return BucketFor(max_value_) + 1; }
+
+  bool operator==(const LogLinearHistogramShape& other) const {
+    return precision_bits_ == other.precision_bits_ &&
+           max_value_ == other.max_value_;
+  }
+
+ private:
+  uint32_t precision_bits_;
+  uint64_t max_value_;
+};
+
+// A snapshot of a log-linear histogram. Snapshots of the same shape can be
+// merged and subtracted, e.g. to combine shards or to compute the values
+// recorded between two collections.
+class LogLinearHistogram {
+ public:
+  explicit LogLinearHistogram(LogLinearHistogramShape shape)
+      : shape_(shape), buckets_(shape.num_buckets()) {}
+
+  const LogLinearHistogramShape& shape() const { return shape_; }
+  absl::Span<const uint64_t> buckets() const { return buckets_; }
+
+  void Record(uint64_t value, uint64_t count = 1) {
+    buckets_[shape_.BucketFor(value)] += count;
+  }
+  // Adds the counts of other, which must have the same shape.
+  void Merge(const LogLinearHistogram& other);
+  LogLinearHistogram operator-(const LogLinearHistogram& other) const;
+
+  uint64_t Count() const;
+  // Estimates the value below which p percent of the recorded values lie,
+  // treating the values in each bucket as spread evenly across it.
+  double Percentile(double p) const;
+
+ private:
+  friend class LogLinearHistogramCollector;
+
+  LogLinearHistogramShape shape_;
+  std::vector<uint64_t> buckets_;
+};
+
+// Records into a log-linear histogram from any thread without locks: each
+// CPU shard has its own buckets, which Collect() sums.
+class LogLinearHistogramCollector {
+ public:
+  explicit LogLinearHistogramCollector(
+      LogLinearHistogramShape shape,
+      PerCpuOptions options =
+          PerCpuOptions().SetCpusPerShard(4).SetMaxShards(32));
+
+  void Record(uint64_t value) {
+    shards_.this_cpu().buckets[shape_.BucketFor(value)].fetch_add(
+        1, std::memory_order_relaxed);
+  }
+
+  LogLinearHistogram Collect() const;
+
+ private:
+  struct Shard {
+    std::unique_ptr<std::atomic<uint64_t>[]> buckets;
+  };
+
+  const LogLinearHistogramShape shape_;
+  PerCpu<Shard> shards_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_TELEMETRY_LOG_LINEAR_HISTOGRAM_H
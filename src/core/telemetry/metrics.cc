@@ -18,6 +18,8 @@
 
 #include <memory>
 #include <optional>
+#include <string>
+#include <vector>
 
 #include "absl/log/absl_check.h"
 #include "src/core/util/crash.h"
@@ -99,6 +101,54 @@ RegisteredMetricCallback::~RegisteredMetricCallback() {
   }
 }
 
+namespace {
+
+// Records through StatsPlugin::RecordHistogram() for plugins that do not
+// resolve label values themselves.
+class DefaultBoundHistogram final : public StatsPlugin::BoundHistogram {
+ public:
+  DefaultBoundHistogram(
+      StatsPlugin* plugin,
+      GlobalInstrumentsRegistry::GlobalInstrumentHandle handle,
+      absl::Span<const absl::string_view> label_values,
+      absl::Span<const absl::string_view> optional_label_values)
+      : plugin_(plugin),
+        handle_(handle),
+        label_values_(label_values.begin(), label_values.end()),
+        optional_label_values_(optional_label_values.begin(),
+                               optional_label_values.end()),
+        label_value_views_(label_values_.begin(), label_values_.end()),
+        optional_label_value_views_(optional_label_values_.begin(),
+                                    optional_label_values_.end()) {}
+
+  void Record(uint64_t value) override {
+    plugin_->RecordHistogram(handle_, value, label_value_views_,
+                             optional_label_value_views_);
+  }
+  void Record(double value) override {
+    plugin_->RecordHistogram(handle_, value, label_value_views_,
+                             optional_label_value_views_);
+  }
+
+ private:
+  StatsPlugin* const plugin_;
+  const GlobalInstrumentsRegistry::GlobalInstrumentHandle handle_;
+  const std::vector<std::string> label_values_;
+  const std::vector<std::string> optional_label_values_;
+  const std::vector<absl::string_view> label_value_views_;
+  const std::vector<absl::string_view> optional_label_value_views_;
+};
+
+}  // namespace
+
+std::unique_ptr<StatsPlugin::BoundHistogram> StatsPlugin::BindHistogram(
+    GlobalInstrumentsRegistry::GlobalInstrumentHandle handle,
+    absl::Span<const absl::string_view> label_values,
+    absl::Span<const absl::string_view> optional_label_values) {
+  return std::make_unique<DefaultBoundHistogram>(this, handle, label_values,
+                                                 optional_label_values);
+}
+
 void GlobalStatsPluginRegistry::StatsPluginGroup::AddClientCallTracers(
     const Slice& path, bool registered_method, Arena* arena) {
   for (auto& state : plugins_state_) {
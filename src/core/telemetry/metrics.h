@@ -20,6 +20,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <string>
 #include <type_traits>
 #include <vector>
 
@@ -350,14 +351,25 @@ class StatsPlugin {
   virtual ServerCallTracer* GetServerCallTracer(
       std::shared_ptr<ScopeConfig> scope_config) = 0;
 
-  // TODO(yijiem): This is an optimization for the StatsPlugin to create its own
-  // representation of the label_values and use it multiple times. We would
-  // change AddCounter and RecordHistogram to take RefCountedPtr<LabelValueSet>
-  // and also change the StatsPluginsGroup to support this.
-  // Use the StatsPlugin to get a representation of label values that can be
-  // saved for multiple uses later.
-  // virtual RefCountedPtr<LabelValueSet> MakeLabelValueSet(
-  //     absl::Span<absl::string_view> label_values) = 0;
+  // A histogram with its label values resolved once, so that values that
+  // share those labels can be recorded without passing them again. Only the
+  // Record() method matching the histogram's value type may be called. A
+  // bound histogram must not outlive the stats plugin that created it.
+  class BoundHistogram {
+   public:
+    virtual ~BoundHistogram() = default;
+    virtual void Record(uint64_t value) = 0;
+    virtual void Record(double value) = 0;
+  };
+
+  // Binds \a label_values and \a optional_label_values to the histogram
+  // specified by \a handle, as for RecordHistogram(). The default
+  // implementation copies the label values and calls RecordHistogram() for
+  // each value.
+  virtual std::unique_ptr<BoundHistogram> BindHistogram(
+      GlobalInstrumentsRegistry::GlobalInstrumentHandle handle,
+      absl::Span<const absl::string_view> label_values,
+      absl::Span<const absl::string_view> optional_label_values);
 };
 
 // A global registry of stats plugins. It has shared ownership to the registered
@@ -434,6 +446,44 @@ class GlobalStatsPluginRegistry {
                                       optional_values);
       }
     }
+    // A histogram bound to the same label values in all stats plugins within
+    // a group. It must not outlive the group.
+    template <typename T>
+    class BoundHistogram {
+     public:
+      void Record(T value) {
+        for (auto& histogram : histograms_) histogram->Record(value);
+      }
+
+     private:
+      friend class StatsPluginGroup;
+
+      std::vector<std::unique_ptr<StatsPlugin::BoundHistogram>> histograms_;
+    };
+    // Binds label values to a histogram in all stats plugins within the
+    // group, for use when the same labels are recorded repeatedly, e.g. by
+    // a channel. See StatsPlugin::BindHistogram().
+    template <std::size_t M, std::size_t N>
+    BoundHistogram<uint64_t> BindHistogram(
+        GlobalInstrumentsRegistry::TypedGlobalInstrumentHandle<
+            GlobalInstrumentsRegistry::ValueType::kUInt64,
+            GlobalInstrumentsRegistry::InstrumentType::kHistogram, M, N>
+            handle,
+        std::array<absl::string_view, M> label_values,
+        std::array<absl::string_view, N> optional_values) {
+      return BindHistogramImpl<uint64_t>(handle, label_values,
+                                         optional_values);
+    }
+    template <std::size_t M, std::size_t N>
+    BoundHistogram<double> BindHistogram(
+        GlobalInstrumentsRegistry::TypedGlobalInstrumentHandle<
+            GlobalInstrumentsRegistry::ValueType::kDouble,
+            GlobalInstrumentsRegistry::InstrumentType::kHistogram, M, N>
+            handle,
+        std::array<absl::string_view, M> label_values,
+        std::array<absl::string_view, N> optional_values) {
+      return BindHistogramImpl<double>(handle, label_values, optional_values);
+    }
     // Returns true if any of the stats plugins in the group have enabled \a
     // handle.
     bool IsInstrumentEnabled(
@@ -479,6 +529,20 @@ class GlobalStatsPluginRegistry {
       std::shared_ptr<StatsPlugin> plugin;
     };
 
+    template <typename T>
+    BoundHistogram<T> BindHistogramImpl(
+        GlobalInstrumentsRegistry::GlobalInstrumentHandle handle,
+        absl::Span<const absl::string_view> label_values,
+        absl::Span<const absl::string_view> optional_values) {
+      BoundHistogram<T> bound;
+      for (auto& state : plugins_state_) {
+        if (!state.plugin->IsInstrumentEnabled(handle)) continue;
+        bound.histograms_.push_back(state.plugin->BindHistogram(
+            handle, label_values, optional_values));
+      }
+      return bound;
+    }
+
     template <GlobalInstrumentsRegistry::ValueType V,
               GlobalInstrumentsRegistry::InstrumentType I, size_t M, size_t N>
     static constexpr void AssertIsCallbackGaugeHandle(
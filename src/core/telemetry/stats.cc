@@ -22,13 +22,27 @@
 #include <stddef.h>
 
 #include <algorithm>
+#include <limits>
 #include <vector>
 
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_join.h"
+#include "absl/synchronization/mutex.h"
 
 namespace grpc_core {
 
+void RegisterMutexContentionProfiler() {
+#ifdef GPR_ABSEIL_SYNC
+  // absl reports waits in its cycle clock's ticks, whose rate it does not
+  // expose, so they are recorded in thousands of ticks rather than in time.
+  absl::RegisterMutexProfiler([](int64_t wait_cycles) {
+    global_stats().IncrementMutexContentionWaitKcycles(
+        static_cast<int>(std::min<int64_t>(wait_cycles / 1000,
+                                           std::numeric_limits<int>::max())));
+  });
+#endif  // GPR_ABSEIL_SYNC
+}
+
 namespace stats_detail {
 
 namespace {
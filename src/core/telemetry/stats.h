@@ -37,6 +37,11 @@ inline GlobalStatsCollector& global_stats() {
   return *NoDestructSingleton<GlobalStatsCollector>::Get();
 }
 
+// Hooks into absl::Mutex so that the wait of every contended acquisition
+// is recorded in global_stats().  Does nothing if gRPC mutexes are not
+// absl::Mutex.  Called once at startup if GRPC_MUTEX_PROFILING is set.
+void RegisterMutexContentionProfiler();
+
 namespace stats_detail {
 std::string StatsAsJson(absl::Span<const uint64_t> counters,
                         absl::Span<const absl::string_view> counter_name,
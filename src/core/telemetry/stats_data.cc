@@ -130,10 +130,13 @@ const absl::string_view
         "rq_connections_dropped",
         "rq_calls_dropped",
         "rq_calls_rejected",
+        "rq_connections_rejected",
+        "rq_connections_rate_limited",
         "syscall_write",
         "syscall_read",
         "tcp_read_alloc_8k",
         "tcp_read_alloc_64k",
+        "tcp_read_alloc_hinted",
         "http2_settings_writes",
         "http2_pings_sent",
         "http2_writes_begun",
@@ -141,12 +144,15 @@ const absl::string_view
         "http2_stream_stalls",
         "http2_hpack_hits",
         "http2_hpack_misses",
+        "http2_hpack_adaptive_literals",
         "cq_pluck_creates",
         "cq_next_creates",
         "cq_callback_creates",
         "wrr_updates",
         "work_serializer_items_enqueued",
         "work_serializer_items_dequeued",
+        "thread_pool_local_steals",
+        "thread_pool_remote_steals",
         "econnaborted_count",
         "econnreset_count",
         "epipe_count",
@@ -158,6 +164,10 @@ const absl::string_view
         "enobufs_count",
         "uncommon_io_error_count",
         "msg_errqueue_error_count",
+        "compression_skipped_messages",
+        "compression_methods_disabled",
+        "compression_methods_enabled",
+        "call_arena_overflows",
 };
 const absl::string_view GlobalStats::counter_doc[static_cast<int>(
     Counter::COUNT)] = {
@@ -170,11 +180,15 @@ const absl::string_view GlobalStats::counter_doc[static_cast<int>(
     "Number of connections dropped due to resource quota exceeded",
     "Number of calls dropped due to resource quota exceeded",
     "Number of calls rejected (never started) due to resource quota exceeded",
+    "Number of incoming connections rejected before the handshake due to "
+    "memory pressure or the maximum number of connections",
+    "Number of incoming connections rejected due to the accept rate limit",
     "Number of write syscalls (or equivalent - eg sendmsg) made by this "
     "process",
     "Number of read syscalls (or equivalent - eg recvmsg) made by this process",
     "Number of 8k allocations by the TCP subsystem for reading",
     "Number of 64k allocations by the TCP subsystem for reading",
+    "Number of allocations sized by a read hint by the TCP subsystem",
     "Number of settings frames sent",
     "Number of HTTP2 pings sent by process",
     "Number of HTTP2 writes initiated",
@@ -184,6 +198,8 @@ const absl::string_view GlobalStats::counter_doc[static_cast<int>(
     "window",
     "Number of HPACK cache hits",
     "Number of HPACK cache misses (entries added but never used)",
+    "Number of custom headers sent as literals by adaptive HPACK indexing "
+    "because their values change too often to be worth indexing",
     "Number of completion queues created for cq_pluck (indicates sync api "
     "usage)",
     "Number of completion queues created for cq_next (indicates cq async api "
@@ -193,6 +209,10 @@ const absl::string_view GlobalStats::counter_doc[static_cast<int>(
     "Number of wrr updates that have been received",
     "Number of items enqueued onto work serializers",
     "Number of items dequeued from work serializers",
+    "Number of closures an event engine thread pool worker stole from a queue "
+    "on its own NUMA node",
+    "Number of closures an event engine thread pool worker stole from a queue "
+    "on another NUMA node",
     "Number of ECONNABORTED errors",
     "Number of ECONNRESET errors",
     "Number of EPIPE errors",
@@ -204,6 +224,10 @@ const absl::string_view GlobalStats::counter_doc[static_cast<int>(
     "Number of ENOBUFS errors",
     "Number of uncommon io errors",
     "Number of uncommon errors returned by MSG_ERRQUEUE",
+    "Number of messages adaptive compression sent uncompressed",
+    "Number of times adaptive compression stopped compressing a method",
+    "Number of times adaptive compression resumed compressing a method",
+    "Number of calls whose arena outgrew its initial zone",
 };
 const absl::string_view
     GlobalStats::histogram_name[static_cast<int>(Histogram::COUNT)] = {
@@ -215,6 +239,7 @@ const absl::string_view
         "tcp_read_offer_iov_size",
         "http2_send_message_size",
         "http2_metadata_size",
+        "http2_hpack_encoded_size",
         "http2_hpack_entry_lifetime",
         "http2_header_table_size",
         "http2_initial_window_size",
@@ -232,6 +257,7 @@ const absl::string_view
         "work_serializer_work_time_ms",
         "work_serializer_work_time_per_item_ms",
         "work_serializer_items_per_run",
+        "work_serializer_queue_depth",
         "chaotic_good_sendmsgs_per_write_control",
         "chaotic_good_recvmsgs_per_read_control",
         "chaotic_good_sendmsgs_per_write_data",
@@ -246,6 +272,15 @@ const absl::string_view
         "chaotic_good_tcp_read_offer_control",
         "chaotic_good_tcp_write_size_data",
         "chaotic_good_tcp_write_size_control",
+        "server_call_queue_time_us",
+        "client_call_filter_time_us",
+        "http2_write_latency_us",
+        "http2_client_network_time_us",
+        "tcp_info_srtt_us",
+        "tcp_info_congestion_window",
+        "tcp_info_delivery_rate_kbps",
+        "mutex_contention_wait_kcycles",
+        "call_arena_allocated_size",
 };
 const absl::string_view GlobalStats::histogram_doc[static_cast<int>(
     Histogram::COUNT)] = {
@@ -257,6 +292,7 @@ const absl::string_view GlobalStats::histogram_doc[static_cast<int>(
     "Number of byte segments offered to each syscall_read",
     "Size of messages received by HTTP2 transport",
     "Number of bytes consumed by metadata, according to HPACK accounting rules",
+    "Number of bytes produced by the HPACK encoder for one header block",
     "Lifetime of HPACK entries in the cache (in milliseconds)",
     "Http2 header table size received through SETTINGS frame",
     "Http2 initial window size received through SETTINGS frame",
@@ -276,6 +312,7 @@ const absl::string_view GlobalStats::histogram_doc[static_cast<int>(
     "work",
     "How long do individual items take to process in work serializers",
     "How many callbacks are executed when a work serializer runs",
+    "How many callbacks are waiting when a work serializer picks up more work",
     "Number of sendmsgs per control channel endpoint write",
     "Number of recvmsgs per control channel endpoint read",
     "Number of sendmsgs per data channel endpoint write",
@@ -290,6 +327,23 @@ const absl::string_view GlobalStats::histogram_doc[static_cast<int>(
     "Number of bytes offered to each syscall_read in the control channel",
     "Number of bytes offered to each syscall_write in the data channel",
     "Number of bytes offered to each syscall_write in the control channel",
+    "Microseconds from the creation of a server call to its publication to the "
+    "application",
+    "Microseconds from the creation of a client call to its initial metadata "
+    "reaching the transport, including any wait for a load balancing pick",
+    "Microseconds from an HTTP2 transport handing a write to its endpoint to "
+    "the endpoint completing it",
+    "Microseconds from the write carrying a client stream's initial metadata "
+    "to the first bytes of its response headers arriving",
+    "Smoothed round trip time in microseconds of each TCP_INFO sample taken by "
+    "an HTTP2 transport",
+    "Congestion window in segments of each TCP_INFO sample taken by an HTTP2 "
+    "transport",
+    "Delivery rate in kilobytes per second of each TCP_INFO sample taken by an "
+    "HTTP2 transport",
+    "Thousands of cycle clock ticks spent waiting for each contended mutex "
+    "acquisition, recorded only when GRPC_MUTEX_PROFILING is set",
+    "Total bytes allocated by a grpc_call arena over its lifetime",
 };
 namespace {
 const int kStatsTable0[21] = {0,    1,    2,    4,     8,     15,    27,
@@ -493,10 +547,13 @@ GlobalStats::GlobalStats()
       rq_connections_dropped{0},
       rq_calls_dropped{0},
       rq_calls_rejected{0},
+      rq_connections_rejected{0},
+      rq_connections_rate_limited{0},
       syscall_write{0},
       syscall_read{0},
       tcp_read_alloc_8k{0},
       tcp_read_alloc_64k{0},
+      tcp_read_alloc_hinted{0},
       http2_settings_writes{0},
       http2_pings_sent{0},
       http2_writes_begun{0},
@@ -504,12 +561,15 @@ GlobalStats::GlobalStats()
       http2_stream_stalls{0},
       http2_hpack_hits{0},
       http2_hpack_misses{0},
+      http2_hpack_adaptive_literals{0},
       cq_pluck_creates{0},
       cq_next_creates{0},
       cq_callback_creates{0},
       wrr_updates{0},
       work_serializer_items_enqueued{0},
       work_serializer_items_dequeued{0},
+      thread_pool_local_steals{0},
+      thread_pool_remote_steals{0},
       econnaborted_count{0},
       econnreset_count{0},
       epipe_count{0},
@@ -520,7 +580,11 @@ GlobalStats::GlobalStats()
       enotconn_count{0},
       enobufs_count{0},
       uncommon_io_error_count{0},
-      msg_errqueue_error_count{0} {}
+      msg_errqueue_error_count{0},
+      compression_skipped_messages{0},
+      compression_methods_disabled{0},
+      compression_methods_enabled{0},
+      call_arena_overflows{0} {}
 HistogramView GlobalStats::histogram(Histogram which) const {
   switch (which) {
     default:
@@ -549,6 +613,9 @@ HistogramView GlobalStats::histogram(Histogram which) const {
     case Histogram::kHttp2MetadataSize:
       return HistogramView{&Histogram_65536_26::BucketFor, kStatsTable2, 26,
                            http2_metadata_size.buckets()};
+    case Histogram::kHttp2HpackEncodedSize:
+      return HistogramView{&Histogram_65536_26::BucketFor, kStatsTable2, 26,
+                           http2_hpack_encoded_size.buckets()};
     case Histogram::kHttp2HpackEntryLifetime:
       return HistogramView{&Histogram_1800000_40::BucketFor, kStatsTable12, 40,
                            http2_hpack_entry_lifetime.buckets()};
@@ -601,6 +668,9 @@ HistogramView GlobalStats::histogram(Histogram which) const {
     case Histogram::kWorkSerializerItemsPerRun:
       return HistogramView{&Histogram_10000_20::BucketFor, kStatsTable10, 20,
                            work_serializer_items_per_run.buckets()};
+    case Histogram::kWorkSerializerQueueDepth:
+      return HistogramView{&Histogram_10000_20::BucketFor, kStatsTable10, 20,
+                           work_serializer_queue_depth.buckets()};
     case Histogram::kChaoticGoodSendmsgsPerWriteControl:
       return HistogramView{&Histogram_100_20::BucketFor, kStatsTable4, 20,
                            chaotic_good_sendmsgs_per_write_control.buckets()};
@@ -644,6 +714,33 @@ HistogramView GlobalStats::histogram(Histogram which) const {
     case Histogram::kChaoticGoodTcpWriteSizeControl:
       return HistogramView{&Histogram_16777216_20::BucketFor, kStatsTable6, 20,
                            chaotic_good_tcp_write_size_control.buckets()};
+    case Histogram::kServerCallQueueTimeUs:
+      return HistogramView{&Histogram_100000_20::BucketFor, kStatsTable0, 20,
+                           server_call_queue_time_us.buckets()};
+    case Histogram::kClientCallFilterTimeUs:
+      return HistogramView{&Histogram_100000_20::BucketFor, kStatsTable0, 20,
+                           client_call_filter_time_us.buckets()};
+    case Histogram::kHttp2WriteLatencyUs:
+      return HistogramView{&Histogram_100000_20::BucketFor, kStatsTable0, 20,
+                           http2_write_latency_us.buckets()};
+    case Histogram::kHttp2ClientNetworkTimeUs:
+      return HistogramView{&Histogram_100000_20::BucketFor, kStatsTable0, 20,
+                           http2_client_network_time_us.buckets()};
+    case Histogram::kTcpInfoSrttUs:
+      return HistogramView{&Histogram_100000_20::BucketFor, kStatsTable0, 20,
+                           tcp_info_srtt_us.buckets()};
+    case Histogram::kTcpInfoCongestionWindow:
+      return HistogramView{&Histogram_10000_20::BucketFor, kStatsTable10, 20,
+                           tcp_info_congestion_window.buckets()};
+    case Histogram::kTcpInfoDeliveryRateKbps:
+      return HistogramView{&Histogram_16777216_20::BucketFor, kStatsTable6, 20,
+                           tcp_info_delivery_rate_kbps.buckets()};
+    case Histogram::kMutexContentionWaitKcycles:
+      return HistogramView{&Histogram_100000_20::BucketFor, kStatsTable0, 20,
+                           mutex_contention_wait_kcycles.buckets()};
+    case Histogram::kCallArenaAllocatedSize:
+      return HistogramView{&Histogram_65536_26::BucketFor, kStatsTable2, 26,
+                           call_arena_allocated_size.buckets()};
   }
 }
 std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
@@ -667,12 +764,18 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
         data.rq_calls_dropped.load(std::memory_order_relaxed);
     result->rq_calls_rejected +=
         data.rq_calls_rejected.load(std::memory_order_relaxed);
+    result->rq_connections_rejected +=
+        data.rq_connections_rejected.load(std::memory_order_relaxed);
+    result->rq_connections_rate_limited +=
+        data.rq_connections_rate_limited.load(std::memory_order_relaxed);
     result->syscall_write += data.syscall_write.load(std::memory_order_relaxed);
     result->syscall_read += data.syscall_read.load(std::memory_order_relaxed);
     result->tcp_read_alloc_8k +=
         data.tcp_read_alloc_8k.load(std::memory_order_relaxed);
     result->tcp_read_alloc_64k +=
         data.tcp_read_alloc_64k.load(std::memory_order_relaxed);
+    result->tcp_read_alloc_hinted +=
+        data.tcp_read_alloc_hinted.load(std::memory_order_relaxed);
     result->http2_settings_writes +=
         data.http2_settings_writes.load(std::memory_order_relaxed);
     result->http2_pings_sent +=
@@ -687,6 +790,8 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
         data.http2_hpack_hits.load(std::memory_order_relaxed);
     result->http2_hpack_misses +=
         data.http2_hpack_misses.load(std::memory_order_relaxed);
+    result->http2_hpack_adaptive_literals +=
+        data.http2_hpack_adaptive_literals.load(std::memory_order_relaxed);
     result->cq_pluck_creates +=
         data.cq_pluck_creates.load(std::memory_order_relaxed);
     result->cq_next_creates +=
@@ -698,6 +803,10 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
         data.work_serializer_items_enqueued.load(std::memory_order_relaxed);
     result->work_serializer_items_dequeued +=
         data.work_serializer_items_dequeued.load(std::memory_order_relaxed);
+    result->thread_pool_local_steals +=
+        data.thread_pool_local_steals.load(std::memory_order_relaxed);
+    result->thread_pool_remote_steals +=
+        data.thread_pool_remote_steals.load(std::memory_order_relaxed);
     result->econnaborted_count +=
         data.econnaborted_count.load(std::memory_order_relaxed);
     result->econnreset_count +=
@@ -717,6 +826,14 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
         data.uncommon_io_error_count.load(std::memory_order_relaxed);
     result->msg_errqueue_error_count +=
         data.msg_errqueue_error_count.load(std::memory_order_relaxed);
+    result->compression_skipped_messages +=
+        data.compression_skipped_messages.load(std::memory_order_relaxed);
+    result->compression_methods_disabled +=
+        data.compression_methods_disabled.load(std::memory_order_relaxed);
+    result->compression_methods_enabled +=
+        data.compression_methods_enabled.load(std::memory_order_relaxed);
+    result->call_arena_overflows +=
+        data.call_arena_overflows.load(std::memory_order_relaxed);
     data.call_initial_size.Collect(&result->call_initial_size);
     data.tcp_write_size.Collect(&result->tcp_write_size);
     data.tcp_write_iov_size.Collect(&result->tcp_write_iov_size);
@@ -725,6 +842,7 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
     data.tcp_read_offer_iov_size.Collect(&result->tcp_read_offer_iov_size);
     data.http2_send_message_size.Collect(&result->http2_send_message_size);
     data.http2_metadata_size.Collect(&result->http2_metadata_size);
+    data.http2_hpack_encoded_size.Collect(&result->http2_hpack_encoded_size);
     data.http2_hpack_entry_lifetime.Collect(
         &result->http2_hpack_entry_lifetime);
     data.http2_header_table_size.Collect(&result->http2_header_table_size);
@@ -754,6 +872,8 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
         &result->work_serializer_work_time_per_item_ms);
     data.work_serializer_items_per_run.Collect(
         &result->work_serializer_items_per_run);
+    data.work_serializer_queue_depth.Collect(
+        &result->work_serializer_queue_depth);
     data.chaotic_good_sendmsgs_per_write_control.Collect(
         &result->chaotic_good_sendmsgs_per_write_control);
     data.chaotic_good_recvmsgs_per_read_control.Collect(
@@ -782,6 +902,20 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
         &result->chaotic_good_tcp_write_size_data);
     data.chaotic_good_tcp_write_size_control.Collect(
         &result->chaotic_good_tcp_write_size_control);
+    data.server_call_queue_time_us.Collect(&result->server_call_queue_time_us);
+    data.client_call_filter_time_us.Collect(
+        &result->client_call_filter_time_us);
+    data.http2_write_latency_us.Collect(&result->http2_write_latency_us);
+    data.http2_client_network_time_us.Collect(
+        &result->http2_client_network_time_us);
+    data.tcp_info_srtt_us.Collect(&result->tcp_info_srtt_us);
+    data.tcp_info_congestion_window.Collect(
+        &result->tcp_info_congestion_window);
+    data.tcp_info_delivery_rate_kbps.Collect(
+        &result->tcp_info_delivery_rate_kbps);
+    data.mutex_contention_wait_kcycles.Collect(
+        &result->mutex_contention_wait_kcycles);
+    data.call_arena_allocated_size.Collect(&result->call_arena_allocated_size);
   }
   return result;
 }
@@ -803,10 +937,16 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
       rq_connections_dropped - other.rq_connections_dropped;
   result->rq_calls_dropped = rq_calls_dropped - other.rq_calls_dropped;
   result->rq_calls_rejected = rq_calls_rejected - other.rq_calls_rejected;
+  result->rq_connections_rejected =
+      rq_connections_rejected - other.rq_connections_rejected;
+  result->rq_connections_rate_limited =
+      rq_connections_rate_limited - other.rq_connections_rate_limited;
   result->syscall_write = syscall_write - other.syscall_write;
   result->syscall_read = syscall_read - other.syscall_read;
   result->tcp_read_alloc_8k = tcp_read_alloc_8k - other.tcp_read_alloc_8k;
   result->tcp_read_alloc_64k = tcp_read_alloc_64k - other.tcp_read_alloc_64k;
+  result->tcp_read_alloc_hinted =
+      tcp_read_alloc_hinted - other.tcp_read_alloc_hinted;
   result->http2_settings_writes =
       http2_settings_writes - other.http2_settings_writes;
   result->http2_pings_sent = http2_pings_sent - other.http2_pings_sent;
@@ -816,6 +956,8 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
   result->http2_stream_stalls = http2_stream_stalls - other.http2_stream_stalls;
   result->http2_hpack_hits = http2_hpack_hits - other.http2_hpack_hits;
   result->http2_hpack_misses = http2_hpack_misses - other.http2_hpack_misses;
+  result->http2_hpack_adaptive_literals =
+      http2_hpack_adaptive_literals - other.http2_hpack_adaptive_literals;
   result->cq_pluck_creates = cq_pluck_creates - other.cq_pluck_creates;
   result->cq_next_creates = cq_next_creates - other.cq_next_creates;
   result->cq_callback_creates = cq_callback_creates - other.cq_callback_creates;
@@ -824,6 +966,10 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
       work_serializer_items_enqueued - other.work_serializer_items_enqueued;
   result->work_serializer_items_dequeued =
       work_serializer_items_dequeued - other.work_serializer_items_dequeued;
+  result->thread_pool_local_steals =
+      thread_pool_local_steals - other.thread_pool_local_steals;
+  result->thread_pool_remote_steals =
+      thread_pool_remote_steals - other.thread_pool_remote_steals;
   result->econnaborted_count = econnaborted_count - other.econnaborted_count;
   result->econnreset_count = econnreset_count - other.econnreset_count;
   result->epipe_count = epipe_count - other.epipe_count;
@@ -837,6 +983,14 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
       uncommon_io_error_count - other.uncommon_io_error_count;
   result->msg_errqueue_error_count =
       msg_errqueue_error_count - other.msg_errqueue_error_count;
+  result->compression_skipped_messages =
+      compression_skipped_messages - other.compression_skipped_messages;
+  result->compression_methods_disabled =
+      compression_methods_disabled - other.compression_methods_disabled;
+  result->compression_methods_enabled =
+      compression_methods_enabled - other.compression_methods_enabled;
+  result->call_arena_overflows =
+      call_arena_overflows - other.call_arena_overflows;
   result->call_initial_size = call_initial_size - other.call_initial_size;
   result->tcp_write_size = tcp_write_size - other.tcp_write_size;
   result->tcp_write_iov_size = tcp_write_iov_size - other.tcp_write_iov_size;
@@ -847,6 +1001,8 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
   result->http2_send_message_size =
       http2_send_message_size - other.http2_send_message_size;
   result->http2_metadata_size = http2_metadata_size - other.http2_metadata_size;
+  result->http2_hpack_encoded_size =
+      http2_hpack_encoded_size - other.http2_hpack_encoded_size;
   result->http2_hpack_entry_lifetime =
       http2_hpack_entry_lifetime - other.http2_hpack_entry_lifetime;
   result->http2_header_table_size =
@@ -887,6 +1043,8 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
       other.work_serializer_work_time_per_item_ms;
   result->work_serializer_items_per_run =
       work_serializer_items_per_run - other.work_serializer_items_per_run;
+  result->work_serializer_queue_depth =
+      work_serializer_queue_depth - other.work_serializer_queue_depth;
   result->chaotic_good_sendmsgs_per_write_control =
       chaotic_good_sendmsgs_per_write_control -
       other.chaotic_good_sendmsgs_per_write_control;
@@ -926,6 +1084,23 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
   result->chaotic_good_tcp_write_size_control =
       chaotic_good_tcp_write_size_control -
       other.chaotic_good_tcp_write_size_control;
+  result->server_call_queue_time_us =
+      server_call_queue_time_us - other.server_call_queue_time_us;
+  result->client_call_filter_time_us =
+      client_call_filter_time_us - other.client_call_filter_time_us;
+  result->http2_write_latency_us =
+      http2_write_latency_us - other.http2_write_latency_us;
+  result->http2_client_network_time_us =
+      http2_client_network_time_us - other.http2_client_network_time_us;
+  result->tcp_info_srtt_us = tcp_info_srtt_us - other.tcp_info_srtt_us;
+  result->tcp_info_congestion_window =
+      tcp_info_congestion_window - other.tcp_info_congestion_window;
+  result->tcp_info_delivery_rate_kbps =
+      tcp_info_delivery_rate_kbps - other.tcp_info_delivery_rate_kbps;
+  result->mutex_contention_wait_kcycles =
+      mutex_contention_wait_kcycles - other.mutex_contention_wait_kcycles;
+  result->call_arena_allocated_size =
+      call_arena_allocated_size - other.call_arena_allocated_size;
   return result;
 }
 }  // namespace grpc_core
@@ -207,10 +207,13 @@ struct GlobalStats {
     kRqConnectionsDropped,
     kRqCallsDropped,
     kRqCallsRejected,
+    kRqConnectionsRejected,
+    kRqConnectionsRateLimited,
     kSyscallWrite,
     kSyscallRead,
     kTcpReadAlloc8k,
     kTcpReadAlloc64k,
+    kTcpReadAllocHinted,
     kHttp2SettingsWrites,
     kHttp2PingsSent,
     kHttp2WritesBegun,
@@ -218,12 +221,15 @@ struct GlobalStats {
     kHttp2StreamStalls,
     kHttp2HpackHits,
     kHttp2HpackMisses,
+    kHttp2HpackAdaptiveLiterals,
     kCqPluckCreates,
     kCqNextCreates,
     kCqCallbackCreates,
     kWrrUpdates,
     kWorkSerializerItemsEnqueued,
     kWorkSerializerItemsDequeued,
+    kThreadPoolLocalSteals,
+    kThreadPoolRemoteSteals,
     kEconnabortedCount,
     kEconnresetCount,
     kEpipeCount,
@@ -235,6 +241,10 @@ struct GlobalStats {
     kEnobufsCount,
     kUncommonIoErrorCount,
     kMsgErrqueueErrorCount,
+    kCompressionSkippedMessages,
+    kCompressionMethodsDisabled,
+    kCompressionMethodsEnabled,
+    kCallArenaOverflows,
     COUNT
   };
   enum class Histogram {
@@ -246,6 +256,7 @@ struct GlobalStats {
     kTcpReadOfferIovSize,
     kHttp2SendMessageSize,
     kHttp2MetadataSize,
+    kHttp2HpackEncodedSize,
     kHttp2HpackEntryLifetime,
     kHttp2HeaderTableSize,
     kHttp2InitialWindowSize,
@@ -263,6 +274,7 @@ struct GlobalStats {
     kWorkSerializerWorkTimeMs,
     kWorkSerializerWorkTimePerItemMs,
     kWorkSerializerItemsPerRun,
+    kWorkSerializerQueueDepth,
     kChaoticGoodSendmsgsPerWriteControl,
     kChaoticGoodRecvmsgsPerReadControl,
     kChaoticGoodSendmsgsPerWriteData,
@@ -277,6 +289,15 @@ struct GlobalStats {
     kChaoticGoodTcpReadOfferControl,
     kChaoticGoodTcpWriteSizeData,
     kChaoticGoodTcpWriteSizeControl,
+    kServerCallQueueTimeUs,
+    kClientCallFilterTimeUs,
+    kHttp2WriteLatencyUs,
+    kHttp2ClientNetworkTimeUs,
+    kTcpInfoSrttUs,
+    kTcpInfoCongestionWindow,
+    kTcpInfoDeliveryRateKbps,
+    kMutexContentionWaitKcycles,
+    kCallArenaAllocatedSize,
     COUNT
   };
   GlobalStats();
@@ -297,10 +318,13 @@ struct GlobalStats {
       uint64_t rq_connections_dropped;
       uint64_t rq_calls_dropped;
       uint64_t rq_calls_rejected;
+      uint64_t rq_connections_rejected;
+      uint64_t rq_connections_rate_limited;
       uint64_t syscall_write;
       uint64_t syscall_read;
       uint64_t tcp_read_alloc_8k;
       uint64_t tcp_read_alloc_64k;
+      uint64_t tcp_read_alloc_hinted;
       uint64_t http2_settings_writes;
       uint64_t http2_pings_sent;
       uint64_t http2_writes_begun;
@@ -308,12 +332,15 @@ struct GlobalStats {
       uint64_t http2_stream_stalls;
       uint64_t http2_hpack_hits;
       uint64_t http2_hpack_misses;
+      uint64_t http2_hpack_adaptive_literals;
       uint64_t cq_pluck_creates;
       uint64_t cq_next_creates;
       uint64_t cq_callback_creates;
       uint64_t wrr_updates;
       uint64_t work_serializer_items_enqueued;
       uint64_t work_serializer_items_dequeued;
+      uint64_t thread_pool_local_steals;
+      uint64_t thread_pool_remote_steals;
       uint64_t econnaborted_count;
       uint64_t econnreset_count;
       uint64_t epipe_count;
@@ -325,6 +352,10 @@ struct GlobalStats {
       uint64_t enobufs_count;
       uint64_t uncommon_io_error_count;
       uint64_t msg_errqueue_error_count;
+      uint64_t compression_skipped_messages;
+      uint64_t compression_methods_disabled;
+      uint64_t compression_methods_enabled;
+      uint64_t call_arena_overflows;
     };
     uint64_t counters[static_cast<int>(Counter::COUNT)];
   };
@@ -336,6 +367,7 @@ struct GlobalStats {
   Histogram_80_10 tcp_read_offer_iov_size;
   Histogram_16777216_20 http2_send_message_size;
   Histogram_65536_26 http2_metadata_size;
+  Histogram_65536_26 http2_hpack_encoded_size;
   Histogram_1800000_40 http2_hpack_entry_lifetime;
   Histogram_16777216_20 http2_header_table_size;
   Histogram_16777216_20 http2_initial_window_size;
@@ -353,6 +385,7 @@ struct GlobalStats {
   Histogram_100000_20 work_serializer_work_time_ms;
   Histogram_100000_20 work_serializer_work_time_per_item_ms;
   Histogram_10000_20 work_serializer_items_per_run;
+  Histogram_10000_20 work_serializer_queue_depth;
   Histogram_100_20 chaotic_good_sendmsgs_per_write_control;
   Histogram_100_20 chaotic_good_recvmsgs_per_read_control;
   Histogram_100_20 chaotic_good_sendmsgs_per_write_data;
@@ -367,6 +400,15 @@ struct GlobalStats {
   Histogram_16777216_20 chaotic_good_tcp_read_offer_control;
   Histogram_16777216_20 chaotic_good_tcp_write_size_data;
   Histogram_16777216_20 chaotic_good_tcp_write_size_control;
+  Histogram_100000_20 server_call_queue_time_us;
+  Histogram_100000_20 client_call_filter_time_us;
+  Histogram_100000_20 http2_write_latency_us;
+  Histogram_100000_20 http2_client_network_time_us;
+  Histogram_100000_20 tcp_info_srtt_us;
+  Histogram_10000_20 tcp_info_congestion_window;
+  Histogram_16777216_20 tcp_info_delivery_rate_kbps;
+  Histogram_100000_20 mutex_contention_wait_kcycles;
+  Histogram_65536_26 call_arena_allocated_size;
   HistogramView histogram(Histogram which) const;
   std::unique_ptr<GlobalStats> Diff(const GlobalStats& other) const;
 };
@@ -407,6 +449,14 @@ class GlobalStatsCollector {
   void IncrementRqCallsRejected() {
     data_.this_cpu().rq_calls_rejected.fetch_add(1, std::memory_order_relaxed);
   }
+  void IncrementRqConnectionsRejected() {
+    data_.this_cpu().rq_connections_rejected.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementRqConnectionsRateLimited() {
+    data_.this_cpu().rq_connections_rate_limited.fetch_add(
+        1, std::memory_order_relaxed);
+  }
   void IncrementSyscallWrite() {
     data_.this_cpu().syscall_write.fetch_add(1, std::memory_order_relaxed);
   }
@@ -419,6 +469,10 @@ class GlobalStatsCollector {
   void IncrementTcpReadAlloc64k() {
     data_.this_cpu().tcp_read_alloc_64k.fetch_add(1, std::memory_order_relaxed);
   }
+  void IncrementTcpReadAllocHinted() {
+    data_.this_cpu().tcp_read_alloc_hinted.fetch_add(1,
+                                                     std::memory_order_relaxed);
+  }
   void IncrementHttp2SettingsWrites() {
     data_.this_cpu().http2_settings_writes.fetch_add(1,
                                                      std::memory_order_relaxed);
@@ -443,6 +497,10 @@ class GlobalStatsCollector {
   void IncrementHttp2HpackMisses() {
     data_.this_cpu().http2_hpack_misses.fetch_add(1, std::memory_order_relaxed);
   }
+  void IncrementHttp2HpackAdaptiveLiterals() {
+    data_.this_cpu().http2_hpack_adaptive_literals.fetch_add(
+        1, std::memory_order_relaxed);
+  }
   void IncrementCqPluckCreates() {
     data_.this_cpu().cq_pluck_creates.fetch_add(1, std::memory_order_relaxed);
   }
@@ -464,6 +522,14 @@ class GlobalStatsCollector {
     data_.this_cpu().work_serializer_items_dequeued.fetch_add(
         1, std::memory_order_relaxed);
   }
+  void IncrementThreadPoolLocalSteals() {
+    data_.this_cpu().thread_pool_local_steals.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementThreadPoolRemoteSteals() {
+    data_.this_cpu().thread_pool_remote_steals.fetch_add(
+        1, std::memory_order_relaxed);
+  }
   void IncrementEconnabortedCount() {
     data_.this_cpu().econnaborted_count.fetch_add(1, std::memory_order_relaxed);
   }
@@ -499,6 +565,22 @@ class GlobalStatsCollector {
     data_.this_cpu().msg_errqueue_error_count.fetch_add(
         1, std::memory_order_relaxed);
   }
+  void IncrementCompressionSkippedMessages() {
+    data_.this_cpu().compression_skipped_messages.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementCompressionMethodsDisabled() {
+    data_.this_cpu().compression_methods_disabled.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementCompressionMethodsEnabled() {
+    data_.this_cpu().compression_methods_enabled.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementCallArenaOverflows() {
+    data_.this_cpu().call_arena_overflows.fetch_add(1,
+                                                    std::memory_order_relaxed);
+  }
   void IncrementCallInitialSize(int value) {
     data_.this_cpu().call_initial_size.Increment(value);
   }
@@ -523,6 +605,9 @@ class GlobalStatsCollector {
   void IncrementHttp2MetadataSize(int value) {
     data_.this_cpu().http2_metadata_size.Increment(value);
   }
+  void IncrementHttp2HpackEncodedSize(int value) {
+    data_.this_cpu().http2_hpack_encoded_size.Increment(value);
+  }
   void IncrementHttp2HpackEntryLifetime(int value) {
     data_.this_cpu().http2_hpack_entry_lifetime.Increment(value);
   }
@@ -575,6 +660,9 @@ class GlobalStatsCollector {
   void IncrementWorkSerializerItemsPerRun(int value) {
     data_.this_cpu().work_serializer_items_per_run.Increment(value);
   }
+  void IncrementWorkSerializerQueueDepth(int value) {
+    data_.this_cpu().work_serializer_queue_depth.Increment(value);
+  }
   void IncrementChaoticGoodSendmsgsPerWriteControl(int value) {
     data_.this_cpu().chaotic_good_sendmsgs_per_write_control.Increment(value);
   }
@@ -618,6 +706,33 @@ class GlobalStatsCollector {
   void IncrementChaoticGoodTcpWriteSizeControl(int value) {
     data_.this_cpu().chaotic_good_tcp_write_size_control.Increment(value);
   }
+  void IncrementServerCallQueueTimeUs(int value) {
+    data_.this_cpu().server_call_queue_time_us.Increment(value);
+  }
+  void IncrementClientCallFilterTimeUs(int value) {
+    data_.this_cpu().client_call_filter_time_us.Increment(value);
+  }
+  void IncrementHttp2WriteLatencyUs(int value) {
+    data_.this_cpu().http2_write_latency_us.Increment(value);
+  }
+  void IncrementHttp2ClientNetworkTimeUs(int value) {
+    data_.this_cpu().http2_client_network_time_us.Increment(value);
+  }
+  void IncrementTcpInfoSrttUs(int value) {
+    data_.this_cpu().tcp_info_srtt_us.Increment(value);
+  }
+  void IncrementTcpInfoCongestionWindow(int value) {
+    data_.this_cpu().tcp_info_congestion_window.Increment(value);
+  }
+  void IncrementTcpInfoDeliveryRateKbps(int value) {
+    data_.this_cpu().tcp_info_delivery_rate_kbps.Increment(value);
+  }
+  void IncrementMutexContentionWaitKcycles(int value) {
+    data_.this_cpu().mutex_contention_wait_kcycles.Increment(value);
+  }
+  void IncrementCallArenaAllocatedSize(int value) {
+    data_.this_cpu().call_arena_allocated_size.Increment(value);
+  }
 
  private:
   struct Data {
@@ -630,10 +745,13 @@ class GlobalStatsCollector {
     std::atomic<uint64_t> rq_connections_dropped{0};
     std::atomic<uint64_t> rq_calls_dropped{0};
     std::atomic<uint64_t> rq_calls_rejected{0};
+    std::atomic<uint64_t> rq_connections_rejected{0};
+    std::atomic<uint64_t> rq_connections_rate_limited{0};
     std::atomic<uint64_t> syscall_write{0};
     std::atomic<uint64_t> syscall_read{0};
     std::atomic<uint64_t> tcp_read_alloc_8k{0};
     std::atomic<uint64_t> tcp_read_alloc_64k{0};
+    std::atomic<uint64_t> tcp_read_alloc_hinted{0};
     std::atomic<uint64_t> http2_settings_writes{0};
     std::atomic<uint64_t> http2_pings_sent{0};
     std::atomic<uint64_t> http2_writes_begun{0};
@@ -641,12 +759,15 @@ class GlobalStatsCollector {
     std::atomic<uint64_t> http2_stream_stalls{0};
     std::atomic<uint64_t> http2_hpack_hits{0};
     std::atomic<uint64_t> http2_hpack_misses{0};
+    std::atomic<uint64_t> http2_hpack_adaptive_literals{0};
     std::atomic<uint64_t> cq_pluck_creates{0};
     std::atomic<uint64_t> cq_next_creates{0};
     std::atomic<uint64_t> cq_callback_creates{0};
     std::atomic<uint64_t> wrr_updates{0};
     std::atomic<uint64_t> work_serializer_items_enqueued{0};
     std::atomic<uint64_t> work_serializer_items_dequeued{0};
+    std::atomic<uint64_t> thread_pool_local_steals{0};
+    std::atomic<uint64_t> thread_pool_remote_steals{0};
     std::atomic<uint64_t> econnaborted_count{0};
     std::atomic<uint64_t> econnreset_count{0};
     std::atomic<uint64_t> epipe_count{0};
@@ -658,6 +779,10 @@ class GlobalStatsCollector {
     std::atomic<uint64_t> enobufs_count{0};
     std::atomic<uint64_t> uncommon_io_error_count{0};
     std::atomic<uint64_t> msg_errqueue_error_count{0};
+    std::atomic<uint64_t> compression_skipped_messages{0};
+    std::atomic<uint64_t> compression_methods_disabled{0};
+    std::atomic<uint64_t> compression_methods_enabled{0};
+    std::atomic<uint64_t> call_arena_overflows{0};
     HistogramCollector_65536_26 call_initial_size;
     HistogramCollector_16777216_20 tcp_write_size;
     HistogramCollector_80_10 tcp_write_iov_size;
@@ -666,6 +791,7 @@ class GlobalStatsCollector {
     HistogramCollector_80_10 tcp_read_offer_iov_size;
     HistogramCollector_16777216_20 http2_send_message_size;
     HistogramCollector_65536_26 http2_metadata_size;
+    HistogramCollector_65536_26 http2_hpack_encoded_size;
     HistogramCollector_1800000_40 http2_hpack_entry_lifetime;
     HistogramCollector_16777216_20 http2_header_table_size;
     HistogramCollector_16777216_20 http2_initial_window_size;
@@ -683,6 +809,7 @@ class GlobalStatsCollector {
     HistogramCollector_100000_20 work_serializer_work_time_ms;
     HistogramCollector_100000_20 work_serializer_work_time_per_item_ms;
     HistogramCollector_10000_20 work_serializer_items_per_run;
+    HistogramCollector_10000_20 work_serializer_queue_depth;
     HistogramCollector_100_20 chaotic_good_sendmsgs_per_write_control;
     HistogramCollector_100_20 chaotic_good_recvmsgs_per_read_control;
     HistogramCollector_100_20 chaotic_good_sendmsgs_per_write_data;
@@ -697,6 +824,15 @@ class GlobalStatsCollector {
     HistogramCollector_16777216_20 chaotic_good_tcp_read_offer_control;
     HistogramCollector_16777216_20 chaotic_good_tcp_write_size_data;
     HistogramCollector_16777216_20 chaotic_good_tcp_write_size_control;
+    HistogramCollector_100000_20 server_call_queue_time_us;
+    HistogramCollector_100000_20 client_call_filter_time_us;
+    HistogramCollector_100000_20 http2_write_latency_us;
+    HistogramCollector_100000_20 http2_client_network_time_us;
+    HistogramCollector_100000_20 tcp_info_srtt_us;
+    HistogramCollector_10000_20 tcp_info_congestion_window;
+    HistogramCollector_16777216_20 tcp_info_delivery_rate_kbps;
+    HistogramCollector_100000_20 mutex_contention_wait_kcycles;
+    HistogramCollector_65536_26 call_arena_allocated_size;
   };
   PerCpu<Data> data_{PerCpuOptions().SetCpusPerShard(4).SetMaxShards(32)};
 };
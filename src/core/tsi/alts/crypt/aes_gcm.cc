@@ -636,6 +636,181 @@ static grpc_status_code gsec_aes_gcm_aead_crypter_decrypt_iovec(
   return GRPC_STATUS_OK;
 }
 
+// Checks the nonce, rekeys if required, and starts an in-place operation by
+// authenticating aad_vec.
+static grpc_status_code aes_gcm_start_in_place(
+    gsec_aes_gcm_aead_crypter* aes_gcm_crypter, const uint8_t* nonce,
+    size_t nonce_length, const struct iovec* aad_vec, size_t aad_vec_length,
+    const struct iovec* data_vec, size_t data_vec_length, struct iovec tag,
+    bool encrypt, char** error_details) {
+  if (nonce == nullptr) {
+    aes_gcm_format_errors("Nonce buffer is nullptr.", error_details);
+    return GRPC_STATUS_INVALID_ARGUMENT;
+  }
+  if (kAesGcmNonceLength != nonce_length) {
+    aes_gcm_format_errors("Nonce buffer has the wrong length.", error_details);
+    return GRPC_STATUS_INVALID_ARGUMENT;
+  }
+  if (aad_vec_length > 0 && aad_vec == nullptr) {
+    aes_gcm_format_errors("Non-zero aad_vec_length but aad_vec is nullptr.",
+                          error_details);
+    return GRPC_STATUS_INVALID_ARGUMENT;
+  }
+  if (data_vec_length > 0 && data_vec == nullptr) {
+    aes_gcm_format_errors("Non-zero data_vec_length but data_vec is nullptr.",
+                          error_details);
+    return GRPC_STATUS_INVALID_ARGUMENT;
+  }
+  if (tag.iov_base == nullptr || tag.iov_len != kAesGcmTagLength) {
+    aes_gcm_format_errors("tag has the wrong length.", error_details);
+    return GRPC_STATUS_INVALID_ARGUMENT;
+  }
+  // rekey if required
+  if (aes_gcm_rekey_if_required(aes_gcm_crypter, nonce, error_details) !=
+      GRPC_STATUS_OK) {
+    return GRPC_STATUS_INTERNAL;
+  }
+  // mask nonce if required
+  const uint8_t* nonce_aead = nonce;
+  uint8_t nonce_masked[kAesGcmNonceLength];
+  if (aes_gcm_crypter->gsec_key->IsRekey()) {
+    aes_gcm_mask_nonce(nonce_masked,
+                       aes_gcm_crypter->gsec_key->nonce_mask().data(), nonce);
+    nonce_aead = nonce_masked;
+  }
+  // init openssl context
+  if (!EVP_CipherInit_ex(aes_gcm_crypter->ctx, nullptr, nullptr, nullptr,
+                         nonce_aead, encrypt ? 1 : 0)) {
+    aes_gcm_format_errors("Initializing nonce failed.", error_details);
+    return GRPC_STATUS_INTERNAL;
+  }
+  // process aad
+  for (size_t i = 0; i < aad_vec_length; i++) {
+    const uint8_t* aad = static_cast<uint8_t*>(aad_vec[i].iov_base);
+    int aad_length = static_cast<int>(aad_vec[i].iov_len);
+    if (aad_length == 0) continue;
+    if (aad == nullptr) {
+      aes_gcm_format_errors("aad is nullptr.", error_details);
+      return GRPC_STATUS_INVALID_ARGUMENT;
+    }
+    int aad_bytes_read = 0;
+    if (!EVP_CipherUpdate(aes_gcm_crypter->ctx, nullptr, &aad_bytes_read, aad,
+                          aad_length) ||
+        aad_bytes_read != aad_length) {
+      aes_gcm_format_errors("Setting authenticated associated data failed.",
+                            error_details);
+      return GRPC_STATUS_INTERNAL;
+    }
+  }
+  return GRPC_STATUS_OK;
+}
+
+// Encrypts or decrypts each buffer of data_vec into itself. GCM is a stream
+// mode, so each update writes as many bytes as it reads.
+static grpc_status_code aes_gcm_update_in_place(
+    gsec_aes_gcm_aead_crypter* aes_gcm_crypter, const struct iovec* data_vec,
+    size_t data_vec_length, char** error_details) {
+  for (size_t i = 0; i < data_vec_length; i++) {
+    uint8_t* data = static_cast<uint8_t*>(data_vec[i].iov_base);
+    int data_length = static_cast<int>(data_vec[i].iov_len);
+    if (data_length == 0) continue;
+    if (data == nullptr) {
+      aes_gcm_format_errors("data is nullptr.", error_details);
+      return GRPC_STATUS_INVALID_ARGUMENT;
+    }
+    int bytes_written = 0;
+    if (!EVP_CipherUpdate(aes_gcm_crypter->ctx, data, &bytes_written, data,
+                          data_length) ||
+        bytes_written != data_length) {
+      aes_gcm_format_errors("Processing data in place failed.", error_details);
+      return GRPC_STATUS_INTERNAL;
+    }
+  }
+  return GRPC_STATUS_OK;
+}
+
+static grpc_status_code gsec_aes_gcm_aead_crypter_encrypt_iovec_in_place(
+    gsec_aead_crypter* crypter, const uint8_t* nonce, size_t nonce_length,
+    const struct iovec* aad_vec, size_t aad_vec_length,
+    const struct iovec* data_vec, size_t data_vec_length, struct iovec tag,
+    char** error_details) {
+  gsec_aes_gcm_aead_crypter* aes_gcm_crypter =
+      reinterpret_cast<gsec_aes_gcm_aead_crypter*>(crypter);
+  grpc_status_code status = aes_gcm_start_in_place(
+      aes_gcm_crypter, nonce, nonce_length, aad_vec, aad_vec_length, data_vec,
+      data_vec_length, tag, /*encrypt=*/true, error_details);
+  if (status != GRPC_STATUS_OK) return status;
+  status = aes_gcm_update_in_place(aes_gcm_crypter, data_vec, data_vec_length,
+                                   error_details);
+  if (status != GRPC_STATUS_OK) return status;
+  int bytes_written_temp = 0;
+  if (!EVP_EncryptFinal_ex(aes_gcm_crypter->ctx, nullptr,
+                           &bytes_written_temp)) {
+    aes_gcm_format_errors("Finalizing encryption failed.", error_details);
+    return GRPC_STATUS_INTERNAL;
+  }
+  if (bytes_written_temp != 0) {
+    aes_gcm_format_errors("Openssl wrote some unexpected bytes.",
+                          error_details);
+    return GRPC_STATUS_INTERNAL;
+  }
+  if (!EVP_CIPHER_CTX_ctrl(aes_gcm_crypter->ctx, EVP_CTRL_GCM_GET_TAG,
+                           kAesGcmTagLength, tag.iov_base)) {
+    aes_gcm_format_errors("Writing tag failed.", error_details);
+    return GRPC_STATUS_INTERNAL;
+  }
+  return GRPC_STATUS_OK;
+}
+
+// Zeroes the partially decrypted data that failed authentication.
+static void aes_gcm_clear_data(const struct iovec* data_vec,
+                               size_t data_vec_length) {
+  for (size_t i = 0; i < data_vec_length; i++) {
+    if (data_vec[i].iov_base != nullptr) {
+      memset(data_vec[i].iov_base, 0x00, data_vec[i].iov_len);
+    }
+  }
+}
+
+static grpc_status_code gsec_aes_gcm_aead_crypter_decrypt_iovec_in_place(
+    gsec_aead_crypter* crypter, const uint8_t* nonce, size_t nonce_length,
+    const struct iovec* aad_vec, size_t aad_vec_length,
+    const struct iovec* data_vec, size_t data_vec_length, struct iovec tag,
+    char** error_details) {
+  gsec_aes_gcm_aead_crypter* aes_gcm_crypter =
+      reinterpret_cast<gsec_aes_gcm_aead_crypter*>(crypter);
+  grpc_status_code status = aes_gcm_start_in_place(
+      aes_gcm_crypter, nonce, nonce_length, aad_vec, aad_vec_length, data_vec,
+      data_vec_length, tag, /*encrypt=*/false, error_details);
+  if (status != GRPC_STATUS_OK) return status;
+  status = aes_gcm_update_in_place(aes_gcm_crypter, data_vec, data_vec_length,
+                                   error_details);
+  if (status != GRPC_STATUS_OK) {
+    aes_gcm_clear_data(data_vec, data_vec_length);
+    return status;
+  }
+  if (!EVP_CIPHER_CTX_ctrl(aes_gcm_crypter->ctx, EVP_CTRL_GCM_SET_TAG,
+                           kAesGcmTagLength, tag.iov_base)) {
+    aes_gcm_format_errors("Setting tag failed.", error_details);
+    aes_gcm_clear_data(data_vec, data_vec_length);
+    return GRPC_STATUS_INTERNAL;
+  }
+  int bytes_written_temp = 0;
+  if (!EVP_DecryptFinal_ex(aes_gcm_crypter->ctx, nullptr,
+                           &bytes_written_temp)) {
+    aes_gcm_format_errors("Checking tag failed.", error_details);
+    aes_gcm_clear_data(data_vec, data_vec_length);
+    return GRPC_STATUS_FAILED_PRECONDITION;
+  }
+  if (bytes_written_temp != 0) {
+    aes_gcm_format_errors("Openssl wrote some unexpected bytes.",
+                          error_details);
+    aes_gcm_clear_data(data_vec, data_vec_length);
+    return GRPC_STATUS_INTERNAL;
+  }
+  return GRPC_STATUS_OK;
+}
+
 static void gsec_aes_gcm_aead_crypter_destroy(gsec_aead_crypter* crypter) {
   gsec_aes_gcm_aead_crypter* aes_gcm_crypter =
       reinterpret_cast<gsec_aes_gcm_aead_crypter*>(
@@ -652,7 +827,9 @@ static const gsec_aead_crypter_vtable vtable = {
     gsec_aes_gcm_aead_crypter_nonce_length,
     gsec_aes_gcm_aead_crypter_key_length,
     gsec_aes_gcm_aead_crypter_tag_length,
-    gsec_aes_gcm_aead_crypter_destroy};
+    gsec_aes_gcm_aead_crypter_destroy,
+    gsec_aes_gcm_aead_crypter_encrypt_iovec_in_place,
+    gsec_aes_gcm_aead_crypter_decrypt_iovec_in_place};
 
 static grpc_status_code aes_gcm_new_evp_cipher_ctx(
     gsec_aes_gcm_aead_crypter* aes_gcm_crypter, char** error_details) {
@@ -111,6 +111,38 @@ grpc_status_code gsec_aead_crypter_decrypt_iovec(
   return GRPC_STATUS_INVALID_ARGUMENT;
 }
 
+grpc_status_code gsec_aead_crypter_encrypt_iovec_in_place(
+    gsec_aead_crypter* crypter, const uint8_t* nonce, size_t nonce_length,
+    const struct iovec* aad_vec, size_t aad_vec_length,
+    const struct iovec* data_vec, size_t data_vec_length, struct iovec tag,
+    char** error_details) {
+  if (crypter != nullptr && crypter->vtable != nullptr &&
+      crypter->vtable->encrypt_iovec_in_place != nullptr) {
+    return crypter->vtable->encrypt_iovec_in_place(
+        crypter, nonce, nonce_length, aad_vec, aad_vec_length, data_vec,
+        data_vec_length, tag, error_details);
+  }
+  // An error occurred.
+  maybe_copy_error_msg(vtable_error_msg, error_details);
+  return GRPC_STATUS_INVALID_ARGUMENT;
+}
+
+grpc_status_code gsec_aead_crypter_decrypt_iovec_in_place(
+    gsec_aead_crypter* crypter, const uint8_t* nonce, size_t nonce_length,
+    const struct iovec* aad_vec, size_t aad_vec_length,
+    const struct iovec* data_vec, size_t data_vec_length, struct iovec tag,
+    char** error_details) {
+  if (crypter != nullptr && crypter->vtable != nullptr &&
+      crypter->vtable->decrypt_iovec_in_place != nullptr) {
+    return crypter->vtable->decrypt_iovec_in_place(
+        crypter, nonce, nonce_length, aad_vec, aad_vec_length, data_vec,
+        data_vec_length, tag, error_details);
+  }
+  // An error occurred.
+  maybe_copy_error_msg(vtable_error_msg, error_details);
+  return GRPC_STATUS_INVALID_ARGUMENT;
+}
+
 grpc_status_code gsec_aead_crypter_max_ciphertext_and_tag_length(
     const gsec_aead_crypter* crypter, size_t plaintext_length,
     size_t* max_ciphertext_and_tag_length_to_return, char** error_details) {
@@ -242,6 +242,17 @@ typedef struct gsec_aead_crypter_vtable {
                                  size_t* tag_length_to_return,
                                  char** error_details);
   void (*destruct)(gsec_aead_crypter* crypter);
+  // The in-place operations may be null if the crypter does not support them.
+  grpc_status_code (*encrypt_iovec_in_place)(
+      gsec_aead_crypter* crypter, const uint8_t* nonce, size_t nonce_length,
+      const struct iovec* aad_vec, size_t aad_vec_length,
+      const struct iovec* data_vec, size_t data_vec_length, struct iovec tag,
+      char** error_details);
+  grpc_status_code (*decrypt_iovec_in_place)(
+      gsec_aead_crypter* crypter, const uint8_t* nonce, size_t nonce_length,
+      const struct iovec* aad_vec, size_t aad_vec_length,
+      const struct iovec* data_vec, size_t data_vec_length, struct iovec tag,
+      char** error_details);
 } gsec_aead_crypter_vtable;
 
 // Main struct for gsec interface
@@ -390,6 +401,42 @@ grpc_status_code gsec_aead_crypter_decrypt_iovec(
     struct iovec plaintext_vec, size_t* plaintext_bytes_written,
     char** error_details);
 
+//
+// These methods perform an AEAD encrypt or decrypt operation in place: each
+// buffer of data_vec is overwritten by its ciphertext or plaintext, and the
+// tag is written to or read from its own buffer.
+//
+//- crypter: AEAD crypter instance.
+//- nonce: buffer containing a nonce with its size equal to nonce_length.
+//- nonce_length: size of nonce buffer, and must be equal to the value returned
+//  from method gsec_aead_crypter_nonce_length.
+//- aad_vec: an iovec array containing data that needs to be authenticated but
+//  not encrypted.
+//- aad_vec_length: the array length of aad_vec.
+//- data_vec: an iovec array containing the data to be encrypted or decrypted.
+//- data_vec_length: the array length of data_vec.
+//- tag: an iovec containing the tag, of the length returned from method
+//  gsec_aead_crypter_tag_length.
+//- error_details: a buffer containing an error message if the method does not
+//  function correctly. It is legal to pass nullptr into error_details, and
+//  otherwise, the parameter should be freed with gpr_free.
+//
+// On success, the methods return GRPC_STATUS_OK. Otherwise, they return an
+// error status code along with its details specified in error_details (if
+// error_details is not nullptr). If decryption fails, data_vec is zeroed.
+//
+grpc_status_code gsec_aead_crypter_encrypt_iovec_in_place(
+    gsec_aead_crypter* crypter, const uint8_t* nonce, size_t nonce_length,
+    const struct iovec* aad_vec, size_t aad_vec_length,
+    const struct iovec* data_vec, size_t data_vec_length, struct iovec tag,
+    char** error_details);
+
+grpc_status_code gsec_aead_crypter_decrypt_iovec_in_place(
+    gsec_aead_crypter* crypter, const uint8_t* nonce, size_t nonce_length,
+    const struct iovec* aad_vec, size_t aad_vec_length,
+    const struct iovec* data_vec, size_t data_vec_length, struct iovec tag,
+    char** error_details);
+
 //
 // This method computes the size of ciphertext+tag buffer that must be passed
 // to gsec_aead_crypter_encrypt function to ensure correct encryption of a
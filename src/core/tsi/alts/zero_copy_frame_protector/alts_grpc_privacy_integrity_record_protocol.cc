@@ -33,6 +33,37 @@
 
 // --- alts_grpc_record_protocol methods implementation. ---
 
+// Protects unprotected_slices in place: the frame header and tag go in
+// slices of their own, around the encrypted unprotected slices.
+static tsi_result alts_grpc_privacy_integrity_protect_in_place(
+    alts_grpc_record_protocol* rp, grpc_slice_buffer* unprotected_slices,
+    grpc_slice_buffer* protected_slices) {
+  grpc_slice header_slice = GRPC_SLICE_MALLOC(rp->header_length);
+  grpc_slice tag_slice = GRPC_SLICE_MALLOC(rp->tag_length);
+  iovec_t header_iovec = {GRPC_SLICE_START_PTR(header_slice),
+                          GRPC_SLICE_LENGTH(header_slice)};
+  iovec_t tag_iovec = {GRPC_SLICE_START_PTR(tag_slice),
+                       GRPC_SLICE_LENGTH(tag_slice)};
+  char* error_details = nullptr;
+  alts_grpc_record_protocol_convert_slice_buffer_to_iovec(rp,
+                                                          unprotected_slices);
+  grpc_status_code status =
+      alts_iovec_record_protocol_privacy_integrity_protect_in_place(
+          rp->iovec_rp, rp->iovec_buf, unprotected_slices->count,
+          header_iovec, tag_iovec, &error_details);
+  if (status != GRPC_STATUS_OK) {
+    ABSL_LOG(ERROR) << "Failed to protect, " << error_details;
+    gpr_free(error_details);
+    grpc_core::CSliceUnref(header_slice);
+    grpc_core::CSliceUnref(tag_slice);
+    return TSI_INTERNAL_ERROR;
+  }
+  grpc_slice_buffer_add(protected_slices, header_slice);
+  grpc_slice_buffer_move_into(unprotected_slices, protected_slices);
+  grpc_slice_buffer_add(protected_slices, tag_slice);
+  return TSI_OK;
+}
+
 static tsi_result alts_grpc_privacy_integrity_protect(
     alts_grpc_record_protocol* rp, grpc_slice_buffer* unprotected_slices,
     grpc_slice_buffer* protected_slices) {
@@ -43,6 +74,10 @@ static tsi_result alts_grpc_privacy_integrity_protect(
         << "Invalid nullptr arguments to alts_grpc_record_protocol protect.";
     return TSI_INVALID_ARGUMENT;
   }
+  if (alts_grpc_record_protocol_slices_are_writable(unprotected_slices)) {
+    return alts_grpc_privacy_integrity_protect_in_place(rp, unprotected_slices,
+                                                        protected_slices);
+  }
   // Allocates memory for output frame. In privacy-integrity protect, the
   // protected frame is stored in a newly allocated buffer.
   size_t protected_frame_size =
@@ -70,6 +105,54 @@ static tsi_result alts_grpc_privacy_integrity_protect(
   return TSI_OK;
 }
 
+// Unprotects protected_slices in place if, once the frame header and tag have
+// been copied out of them, the remaining slices are writable. Otherwise,
+// returns false with protected_slices unchanged in content.
+static bool alts_grpc_privacy_integrity_unprotect_in_place(
+    alts_grpc_record_protocol* rp, grpc_slice_buffer* protected_slices,
+    grpc_slice_buffer* unprotected_slices, tsi_result* result) {
+  unsigned char tag_buf[kAesGcmTagLength];
+  if (rp->tag_length > sizeof(tag_buf)) return false;
+  // Copying out the header and tag drops the references that splitting them
+  // off took on the data slices.
+  grpc_slice_buffer_move_first_into_buffer(protected_slices, rp->header_length,
+                                           rp->header_buf);
+  grpc_slice_buffer tag_sb;
+  grpc_slice_buffer_init(&tag_sb);
+  grpc_slice_buffer_trim_end(protected_slices, rp->tag_length, &tag_sb);
+  alts_grpc_record_protocol_copy_slice_buffer(&tag_sb, tag_buf);
+  grpc_slice_buffer_destroy(&tag_sb);
+  if (!alts_grpc_record_protocol_slices_are_writable(protected_slices)) {
+    grpc_slice_buffer_undo_take_first(
+        protected_slices, grpc_slice_from_copied_buffer(
+                              reinterpret_cast<const char*>(rp->header_buf),
+                              rp->header_length));
+    grpc_slice_buffer_add(protected_slices,
+                          grpc_slice_from_copied_buffer(
+                              reinterpret_cast<const char*>(tag_buf),
+                              rp->tag_length));
+    return false;
+  }
+  iovec_t header_iovec = {rp->header_buf, rp->header_length};
+  iovec_t tag_iovec = {tag_buf, rp->tag_length};
+  char* error_details = nullptr;
+  alts_grpc_record_protocol_convert_slice_buffer_to_iovec(rp, protected_slices);
+  grpc_status_code status =
+      alts_iovec_record_protocol_privacy_integrity_unprotect_in_place(
+          rp->iovec_rp, header_iovec, rp->iovec_buf, protected_slices->count,
+          tag_iovec, &error_details);
+  if (status != GRPC_STATUS_OK) {
+    ABSL_LOG(ERROR) << "Failed to unprotect, " << error_details;
+    gpr_free(error_details);
+    grpc_slice_buffer_reset_and_unref(protected_slices);
+    *result = TSI_INTERNAL_ERROR;
+    return true;
+  }
+  grpc_slice_buffer_move_into(protected_slices, unprotected_slices);
+  *result = TSI_OK;
+  return true;
+}
+
 static tsi_result alts_grpc_privacy_integrity_unprotect(
     alts_grpc_record_protocol* rp, grpc_slice_buffer* protected_slices,
     grpc_slice_buffer* unprotected_slices) {
@@ -86,6 +169,12 @@ static tsi_result alts_grpc_privacy_integrity_unprotect(
     ABSL_LOG(ERROR) << "Protected slices do not have sufficient data.";
     return TSI_INVALID_ARGUMENT;
   }
+  tsi_result result;
+  if (alts_grpc_privacy_integrity_unprotect_in_place(rp, protected_slices,
+                                                     unprotected_slices,
+                                                     &result)) {
+    return result;
+  }
   size_t unprotected_frame_size =
       protected_slices->length - rp->header_length - rp->tag_length;
   grpc_slice unprotected_slice = GRPC_SLICE_MALLOC(unprotected_frame_size);
@@ -26,6 +26,7 @@
 #include "absl/log/absl_log.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/slice/slice_internal.h"
+#include "src/core/lib/slice/slice_refcount.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/useful.h"
 
@@ -70,6 +71,20 @@ void alts_grpc_record_protocol_copy_slice_buffer(const grpc_slice_buffer* src,
   }
 }
 
+bool alts_grpc_record_protocol_slices_are_writable(
+    const grpc_slice_buffer* sb) {
+  ABSL_CHECK(sb != nullptr);
+  for (size_t i = 0; i < sb->count; i++) {
+    const grpc_slice_refcount* refcount = sb->slices[i].refcount;
+    if (refcount == nullptr) continue;
+    if (refcount == grpc_slice_refcount::NoopRefcount() ||
+        !refcount->IsUnique()) {
+      return false;
+    }
+  }
+  return true;
+}
+
 iovec_t alts_grpc_record_protocol_get_header_iovec(
     alts_grpc_record_protocol* rp) {
   iovec_t header_iovec = {nullptr, 0};
@@ -71,6 +71,13 @@ void alts_grpc_record_protocol_convert_slice_buffer_to_iovec(
 void alts_grpc_record_protocol_copy_slice_buffer(const grpc_slice_buffer* src,
                                                  unsigned char* dst);
 
+///
+/// Returns true if the bytes of every slice in sb may be overwritten, i.e.,
+/// every slice is either inlined or holds the only reference to its
+/// refcounted memory. Such slices can be encrypted or decrypted in place.
+///
+bool alts_grpc_record_protocol_slices_are_writable(const grpc_slice_buffer* sb);
+
 ///
 /// This method returns an iovec object pointing to the frame header stored in
 /// rp->header_sb. If the frame header is stored in multiple slices,
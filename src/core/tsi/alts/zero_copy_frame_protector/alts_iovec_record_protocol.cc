@@ -424,6 +424,96 @@ grpc_status_code alts_iovec_record_protocol_privacy_integrity_unprotect(
   return increment_counter(rp->ctr, error_details);
 }
 
+grpc_status_code alts_iovec_record_protocol_privacy_integrity_protect_in_place(
+    alts_iovec_record_protocol* rp, const iovec_t* data_vec,
+    size_t data_vec_length, iovec_t header, iovec_t tag, char** error_details) {
+  // Input sanity checks.
+  if (rp == nullptr) {
+    maybe_copy_error_msg("Input iovec_record_protocol is nullptr.",
+                         error_details);
+    return GRPC_STATUS_INVALID_ARGUMENT;
+  }
+  if (rp->is_integrity_only) {
+    maybe_copy_error_msg(
+        "Privacy-integrity operations are not allowed for this object.",
+        error_details);
+    return GRPC_STATUS_FAILED_PRECONDITION;
+  }
+  if (!rp->is_protect) {
+    maybe_copy_error_msg("Protect operations are not allowed for this object.",
+                         error_details);
+    return GRPC_STATUS_FAILED_PRECONDITION;
+  }
+  grpc_status_code status =
+      ensure_header_and_tag_length(rp, header, tag, error_details);
+  if (status != GRPC_STATUS_OK) {
+    return status;
+  }
+  size_t data_length = get_total_length(data_vec, data_vec_length);
+  // Writes frame header.
+  status = write_frame_header(data_length + rp->tag_length,
+                              static_cast<unsigned char*>(header.iov_base),
+                              error_details);
+  if (status != GRPC_STATUS_OK) {
+    return status;
+  }
+  // Encrypts data in place by calling AEAD crypter.
+  status = gsec_aead_crypter_encrypt_iovec_in_place(
+      rp->crypter, alts_counter_get_counter(rp->ctr),
+      alts_counter_get_size(rp->ctr), /* aad_vec = */ nullptr,
+      /* aad_vec_length = */ 0, data_vec, data_vec_length, tag, error_details);
+  if (status != GRPC_STATUS_OK) {
+    return status;
+  }
+  // Increments the crypter counter.
+  return increment_counter(rp->ctr, error_details);
+}
+
+grpc_status_code
+alts_iovec_record_protocol_privacy_integrity_unprotect_in_place(
+    alts_iovec_record_protocol* rp, iovec_t header, const iovec_t* data_vec,
+    size_t data_vec_length, iovec_t tag, char** error_details) {
+  // Input sanity checks.
+  if (rp == nullptr) {
+    maybe_copy_error_msg("Input iovec_record_protocol is nullptr.",
+                         error_details);
+    return GRPC_STATUS_INVALID_ARGUMENT;
+  }
+  if (rp->is_integrity_only) {
+    maybe_copy_error_msg(
+        "Privacy-integrity operations are not allowed for this object.",
+        error_details);
+    return GRPC_STATUS_FAILED_PRECONDITION;
+  }
+  if (rp->is_protect) {
+    maybe_copy_error_msg(
+        "Unprotect operations are not allowed for this object.", error_details);
+    return GRPC_STATUS_FAILED_PRECONDITION;
+  }
+  grpc_status_code status =
+      ensure_header_and_tag_length(rp, header, tag, error_details);
+  if (status != GRPC_STATUS_OK) return status;
+  size_t data_length = get_total_length(data_vec, data_vec_length);
+  // Verifies frame header.
+  status = verify_frame_header(data_length + rp->tag_length,
+                               static_cast<unsigned char*>(header.iov_base),
+                               error_details);
+  if (status != GRPC_STATUS_OK) {
+    return status;
+  }
+  // Decrypts data in place by calling AEAD crypter.
+  status = gsec_aead_crypter_decrypt_iovec_in_place(
+      rp->crypter, alts_counter_get_counter(rp->ctr),
+      alts_counter_get_size(rp->ctr), /* aad_vec = */ nullptr,
+      /* aad_vec_length = */ 0, data_vec, data_vec_length, tag, error_details);
+  if (status != GRPC_STATUS_OK) {
+    maybe_append_error_msg(" Frame decryption failed.", error_details);
+    return GRPC_STATUS_INTERNAL;
+  }
+  // Increments the crypter counter.
+  return increment_counter(rp->ctr, error_details);
+}
+
 grpc_status_code alts_iovec_record_protocol_create(
     gsec_aead_crypter* crypter, size_t overflow_size, bool is_client,
     bool is_integrity_only, bool is_protect, alts_iovec_record_protocol** rp,
@@ -158,6 +158,52 @@ grpc_status_code alts_iovec_record_protocol_privacy_integrity_unprotect(
     const iovec_t* protected_vec, size_t protected_vec_length,
     iovec_t unprotected_data, char** error_details);
 
+///
+/// This method performs privacy-integrity protect operation on a
+/// alts_iovec_record_protocol instance in place, i.e., encrypts data_vec into
+/// itself and computes the frame header and tag. The protected frame is the
+/// header, followed by data_vec, followed by the tag.
+///
+///- rp: an alts_iovec_record_protocol instance.
+///- data_vec: an iovec array containing unprotected data, which is
+///  overwritten by the protected data.
+///- data_vec_length: the array length of data_vec.
+///- header: an iovec containing the output frame header.
+///- tag: an iovec containing the output frame tag.
+///- error_details: a buffer containing an error message if the method does not
+///  function correctly. It is OK to pass nullptr into error_details.
+///
+/// On success, the method returns GRPC_STATUS_OK. Otherwise, it returns an
+/// error status code along with its details specified in error_details (if
+/// error_details is not nullptr).
+///
+grpc_status_code alts_iovec_record_protocol_privacy_integrity_protect_in_place(
+    alts_iovec_record_protocol* rp, const iovec_t* data_vec,
+    size_t data_vec_length, iovec_t header, iovec_t tag, char** error_details);
+
+///
+/// This method performs privacy-integrity unprotect operation on a
+/// alts_iovec_record_protocol instance in place, i.e., verifies the frame
+/// header and tag and decrypts data_vec into itself.
+///
+///- rp: an alts_iovec_record_protocol instance.
+///- header: an iovec containing the frame header.
+///- data_vec: an iovec array containing protected data without the tag, which
+///  is overwritten by the unprotected data.
+///- data_vec_length: the array length of data_vec.
+///- tag: an iovec containing the frame tag.
+///- error_details: a buffer containing an error message if the method does not
+///  function correctly. It is OK to pass nullptr into error_details.
+///
+/// On success, the method returns GRPC_STATUS_OK. Otherwise, it returns an
+/// error status code along with its details specified in error_details (if
+/// error_details is not nullptr).
+///
+grpc_status_code
+alts_iovec_record_protocol_privacy_integrity_unprotect_in_place(
+    alts_iovec_record_protocol* rp, iovec_t header, const iovec_t* data_vec,
+    size_t data_vec_length, iovec_t tag, char** error_details);
+
 ///
 /// This method creates an alts_iovec_record_protocol instance, given a
 /// gsec_aead_crypter instance, a flag indicating if the created instance will
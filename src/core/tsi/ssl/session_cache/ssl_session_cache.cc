@@ -21,6 +21,12 @@
 #include <grpc/support/port_platform.h>
 #include <grpc/support/string_util.h>
 
+#include <algorithm>
+#include <functional>
+#include <string>
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
 #include "absl/log/absl_check.h"
 #include "absl/log/absl_log.h"
 #include "src/core/lib/slice/slice_internal.h"
@@ -52,7 +58,7 @@ class SslSessionLRUCache::Node {
   }
 
  private:
-  friend class SslSessionLRUCache;
+  friend struct SslSessionLRUCache::Shard;
 
   std::string key_;
   std::unique_ptr<SslCachedSession> session_;
@@ -61,31 +67,67 @@ class SslSessionLRUCache::Node {
   Node* prev_ = nullptr;
 };
 
-SslSessionLRUCache::SslSessionLRUCache(size_t capacity) : capacity_(capacity) {
+/// One LRU list of sessions, for a subset of the keys.
+struct SslSessionLRUCache::Shard {
+  ~Shard() {
+    Node* node = use_order_list_head;
+    while (node) {
+      Node* next = node->next_;
+      delete node;
+      node = next;
+    }
+  }
+
+  Node* FindLocked(const std::string& key) ABSL_EXCLUSIVE_LOCKS_REQUIRED(lock);
+  void Remove(Node* node) ABSL_EXCLUSIVE_LOCKS_REQUIRED(lock);
+  void PushFront(Node* node) ABSL_EXCLUSIVE_LOCKS_REQUIRED(lock);
+  void AssertInvariants() ABSL_EXCLUSIVE_LOCKS_REQUIRED(lock);
+
+  grpc_core::Mutex lock;
+  size_t capacity = 0;
+
+  Node* use_order_list_head ABSL_GUARDED_BY(lock) = nullptr;
+  Node* use_order_list_tail ABSL_GUARDED_BY(lock) = nullptr;
+  size_t use_order_list_size ABSL_GUARDED_BY(lock) = 0;
+  std::map<std::string, Node*> entry_by_key ABSL_GUARDED_BY(lock);
+};
+
+SslSessionLRUCache::SslSessionLRUCache(size_t capacity)
+    : num_shards_(std::clamp<size_t>(capacity / kMinShardCapacity, 1,
+                                     kMaxShards)),
+      shards_(new Shard[num_shards_]) {
   if (capacity == 0) {
     ABSL_LOG(ERROR) << "SslSessionLRUCache capacity is zero. SSL sessions cannot be "
                   "resumed.";
   }
+  // Split the capacity as evenly as possible.
+  for (size_t i = 0; i < num_shards_; ++i) {
+    shards_[i].capacity =
+        capacity / num_shards_ + (i < capacity % num_shards_ ? 1 : 0);
+  }
 }
 
-SslSessionLRUCache::~SslSessionLRUCache() {
-  Node* node = use_order_list_head_;
-  while (node) {
-    Node* next = node->next_;
-    delete node;
-    node = next;
-  }
+SslSessionLRUCache::~SslSessionLRUCache() = default;
+
+SslSessionLRUCache::Shard& SslSessionLRUCache::ShardForKey(
+    const std::string& key) {
+  if (num_shards_ == 1) return shards_[0];
+  return shards_[std::hash<std::string>()(key) % num_shards_];
 }
 
 size_t SslSessionLRUCache::Size() {
-  grpc_core::MutexLock lock(&lock_);
-  return use_order_list_size_;
+  size_t size = 0;
+  for (size_t i = 0; i < num_shards_; ++i) {
+    grpc_core::MutexLock lock(&shards_[i].lock);
+    size += shards_[i].use_order_list_size;
+  }
+  return size;
 }
 
-SslSessionLRUCache::Node* SslSessionLRUCache::FindLocked(
+SslSessionLRUCache::Node* SslSessionLRUCache::Shard::FindLocked(
     const std::string& key) {
-  auto it = entry_by_key_.find(key);
-  if (it == entry_by_key_.end()) {
+  auto it = entry_by_key.find(key);
+  if (it == entry_by_key.end()) {
     return nullptr;
   }
   Node* node = it->second;
@@ -101,87 +143,93 @@ void SslSessionLRUCache::Put(const char* key, SslSessionPtr session) {
     ABSL_LOG(ERROR) << "Attempted to put null SSL session in session cache.";
     return;
   }
-  grpc_core::MutexLock lock(&lock_);
-  Node* node = FindLocked(key);
+  std::string key_str(key);
+  Shard& shard = ShardForKey(key_str);
+  grpc_core::MutexLock lock(&shard.lock);
+  Node* node = shard.FindLocked(key_str);
   if (node != nullptr) {
     node->SetSession(std::move(session));
     return;
   }
-  node = new Node(key, std::move(session));
-  PushFront(node);
-  entry_by_key_.emplace(key, node);
-  AssertInvariants();
-  if (use_order_list_size_ > capacity_) {
-    ABSL_CHECK(use_order_list_tail_);
-    node = use_order_list_tail_;
-    Remove(node);
+  node = new Node(key_str, std::move(session));
+  shard.PushFront(node);
+  shard.entry_by_key.emplace(std::move(key_str), node);
+  shard.AssertInvariants();
+  if (shard.use_order_list_size > shard.capacity) {
+    ABSL_CHECK(shard.use_order_list_tail);
+    node = shard.use_order_list_tail;
+    shard.Remove(node);
     // Order matters, key is destroyed after deleting node.
-    entry_by_key_.erase(node->key());
+    shard.entry_by_key.erase(node->key());
     delete node;
-    AssertInvariants();
+    shard.AssertInvariants();
   }
 }
 
 SslSessionPtr SslSessionLRUCache::Get(const char* key) {
-  grpc_core::MutexLock lock(&lock_);
   // Key is only used for lookups.
-  Node* node = FindLocked(key);
+  std::string key_str(key);
+  Shard& shard = ShardForKey(key_str);
+  grpc_core::MutexLock lock(&shard.lock);
+  Node* node = shard.FindLocked(key_str);
   if (node == nullptr) {
+    misses_.fetch_add(1, std::memory_order_relaxed);
     return nullptr;
   }
+  hits_.fetch_add(1, std::memory_order_relaxed);
   return node->CopySession();
 }
 
-void SslSessionLRUCache::Remove(SslSessionLRUCache::Node* node) {
+void SslSessionLRUCache::Shard::Remove(SslSessionLRUCache::Node* node) {
   if (node->prev_ == nullptr) {
-    use_order_list_head_ = node->next_;
+    use_order_list_head = node->next_;
   } else {
     node->prev_->next_ = node->next_;
   }
   if (node->next_ == nullptr) {
-    use_order_list_tail_ = node->prev_;
+    use_order_list_tail = node->prev_;
   } else {
     node->next_->prev_ = node->prev_;
   }
-  ABSL_CHECK_GE(use_order_list_size_, 1u);
-  use_order_list_size_--;
+  ABSL_CHECK_GE(use_order_list_size, 1u);
+  use_order_list_size--;
 }
 
-void SslSessionLRUCache::PushFront(SslSessionLRUCache::Node* node) {
-  if (use_order_list_head_ == nullptr) {
-    use_order_list_head_ = node;
-    use_order_list_tail_ = node;
+void SslSessionLRUCache::Shard::PushFront(SslSessionLRUCache::Node* node) {
+  if (use_order_list_head == nullptr) {
+    use_order_list_head = node;
+    use_order_list_tail = node;
     node->next_ = nullptr;
     node->prev_ = nullptr;
   } else {
-    node->next_ = use_order_list_head_;
+    node->next_ = use_order_list_head;
     node->next_->prev_ = node;
-    use_order_list_head_ = node;
+    use_order_list_head = node;
     node->prev_ = nullptr;
   }
-  use_order_list_size_++;
+  use_order_list_size++;
 }
 
 #ifndef NDEBUG
-void SslSessionLRUCache::AssertInvariants() {
+void SslSessionLRUCache::Shard::AssertInvariants() {
   size_t size = 0;
   Node* prev = nullptr;
-  Node* current = use_order_list_head_;
+  Node* current = use_order_list_head;
   while (current != nullptr) {
     size++;
     ABSL_CHECK(current->prev_ == prev);
-    auto it = entry_by_key_.find(current->key());
-    ABSL_CHECK(it != entry_by_key_.end());
+    auto it = entry_by_key.find(current->key());
+    ABSL_CHECK(it != entry_by_key.end());
     ABSL_CHECK(it->second == current);
     prev = current;
     current = current->next_;
   }
-  ABSL_CHECK(prev == use_order_list_tail_);
-  ABSL_CHECK(size == use_order_list_size_);
-  ABSL_CHECK(entry_by_key_.size() == use_order_list_size_);
+  ABSL_CHECK(prev == use_order_list_tail);
+  ABSL_CHECK(size == use_order_list_size);
+  ABSL_CHECK(entry_by_key.size() == use_order_list_size);
 }
 #else
-void SslSessionLRUCache::AssertInvariants() {}
+void SslSessionLRUCache::Shard::AssertInvariants() {}
 #endif
 
 }  // namespace tsi
@@ -25,7 +25,12 @@
 #include <grpc/support/sync.h>
 #include <openssl/ssl.h>
 
+#include <stdint.h>
+
+#include <atomic>
 #include <map>
+#include <memory>
+#include <string>
 
 #include "src/core/tsi/ssl/session_cache/ssl_session.h"
 #include "src/core/util/cpp_impl_of.h"
@@ -40,6 +45,10 @@
 /// name. Note that servers are required to share session ticket encryption keys
 /// in order for cache to be effective.
 ///
+/// Large caches are split by key into shards of their own LRU list and lock,
+/// so that concurrent handshakes to different servers, as in a reconnect
+/// storm, do not all contend on one lock.
+///
 /// This class is thread safe.
 
 namespace tsi {
@@ -75,21 +84,26 @@ class SslSessionLRUCache
   /// found.
   SslSessionPtr Get(const char* key);
 
+  /// Returns the number of calls to Get() that found a session, and that did
+  /// not.
+  uint64_t hits() const { return hits_.load(std::memory_order_relaxed); }
+  uint64_t misses() const { return misses_.load(std::memory_order_relaxed); }
+
+  // Caches are only sharded if each shard gets at least this capacity, so
+  // that small caches keep a single exact LRU order.
+  static constexpr size_t kMinShardCapacity = 256;
+  static constexpr size_t kMaxShards = 16;
+
  private:
   class Node;
+  struct Shard;
 
-  Node* FindLocked(const std::string& key);
-  void Remove(Node* node);
-  void PushFront(Node* node);
-  void AssertInvariants();
-
-  grpc_core::Mutex lock_;
-  size_t capacity_;
+  Shard& ShardForKey(const std::string& key);
 
-  Node* use_order_list_head_ = nullptr;
-  Node* use_order_list_tail_ = nullptr;
-  size_t use_order_list_size_ = 0;
-  std::map<std::string, Node*> entry_by_key_;
+  size_t num_shards_;
+  std::unique_ptr<Shard[]> shards_;
+  std::atomic<uint64_t> hits_{0};
+  std::atomic<uint64_t> misses_{0};
 };
 
 }  // namespace tsi
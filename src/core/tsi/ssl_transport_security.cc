@@ -37,8 +37,27 @@
 #include <sys/socket.h>
 #endif
 
+// Only BoringSSL exposes the key block and record sequence numbers needed to
+// configure kernel TLS.
+#if defined(GPR_LINUX) && defined(OPENSSL_IS_BORINGSSL) && \
+    __has_include(<linux/tls.h>)
+#define TSI_SSL_KERNEL_TLS_SUPPORT 1
+#include <errno.h>
+#include <linux/tls.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#ifndef SOL_TLS
+#define SOL_TLS 282
+#endif
+#ifndef TCP_ULP
+#define TCP_ULP 31
+#endif
+#endif
+
 #include <grpc/grpc_crl_provider.h>
 #include <grpc/grpc_security.h>
+#include <grpc/slice.h>
+#include <grpc/slice_buffer.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/string_util.h>
 #include <grpc/support/sync.h>
@@ -47,26 +66,34 @@
 #include <openssl/crypto.h>  // For OPENSSL_free
 #include <openssl/engine.h>
 #include <openssl/err.h>
+#include <openssl/sha.h>
 #include <openssl/ssl.h>
 #include <openssl/tls1.h>
 #include <openssl/x509.h>
 #include <openssl/x509v3.h>
 
+#include <algorithm>
 #include <memory>
 #include <string>
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/log/absl_check.h"
 #include "absl/log/absl_log.h"
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/security/credentials/tls/grpc_tls_crl_provider.h"
+#include "src/core/lib/slice/slice.h"
 #include "src/core/tsi/ssl/key_logging/ssl_key_logging.h"
 #include "src/core/tsi/ssl/session_cache/ssl_session_cache.h"
 #include "src/core/tsi/ssl_transport_security_utils.h"
 #include "src/core/tsi/ssl_types.h"
 #include "src/core/tsi/transport_security.h"
+#include "src/core/tsi/transport_security_grpc.h"
 #include "src/core/util/crash.h"
+#include "src/core/util/no_destruct.h"
+#include "src/core/util/sync.h"
 #include "src/core/util/useful.h"
 
 // --- Constants. ---
@@ -108,6 +135,10 @@ struct tsi_ssl_client_handshaker_factory {
   size_t alpn_protocol_list_length;
   grpc_core::RefCountedPtr<tsi::SslSessionLRUCache> session_cache;
   grpc_core::RefCountedPtr<TlsSessionKeyLogger> key_logger;
+  // Set if the factory is listed in the shared client factory cache, under
+  // the digest of the options it was created from.
+  bool cached;
+  unsigned char cache_key[SHA256_DIGEST_LENGTH];
 };
 
 struct tsi_ssl_server_handshaker_factory {
@@ -147,6 +178,21 @@ struct tsi_ssl_frame_protector {
   size_t buffer_size;
   size_t buffer_offset;
 };
+
+struct tsi_ssl_zero_copy_grpc_protector {
+  tsi_zero_copy_grpc_protector base;
+  SSL* ssl;
+  BIO* network_io;
+  size_t max_protected_frame_size;
+  // The most unprotected bytes put in one record.
+  size_t max_record_size;
+  // Holds the unprotected bytes of a record that spans several slices.
+  unsigned char* record_buffer;
+  // The unused tail of the slice that unprotected bytes were last read into.
+  grpc_slice read_slice;
+  // Holds the bytes consumed from the front of an input slice buffer.
+  grpc_slice_buffer consumed;
+};
 // --- Library Initialization. ---
 
 static gpr_once g_init_openssl_once = GPR_ONCE_INIT;
@@ -1344,6 +1390,143 @@ static const tsi_frame_protector_vtable frame_protector_vtable = {
     ssl_protector_destroy,
 };
 
+// --- tsi_zero_copy_grpc_protector methods implementation. ---
+
+// Moves the records that SSL has written to its BIO into one slice of
+// protected_slices.
+static tsi_result ssl_zero_copy_grpc_protector_flush(
+    tsi_ssl_zero_copy_grpc_protector* impl,
+    grpc_slice_buffer* protected_slices) {
+  const int pending = static_cast<int>(BIO_pending(impl->network_io));
+  if (pending <= 0) return TSI_OK;
+  grpc_slice slice = GRPC_SLICE_MALLOC(pending);
+  const int read_from_ssl =
+      BIO_read(impl->network_io, GRPC_SLICE_START_PTR(slice), pending);
+  if (read_from_ssl != pending) {
+    ABSL_LOG(ERROR) << "Could not read from BIO after SSL_write.";
+    grpc_core::CSliceUnref(slice);
+    return TSI_INTERNAL_ERROR;
+  }
+  grpc_slice_buffer_add(protected_slices, slice);
+  return TSI_OK;
+}
+
+// Encrypts records into the BIO for as long as it has room for another, so
+// that each output slice holds as many records as the BIO does.
+static tsi_result ssl_zero_copy_grpc_protector_protect(
+    tsi_zero_copy_grpc_protector* self, grpc_slice_buffer* unprotected_slices,
+    grpc_slice_buffer* protected_slices) {
+  tsi_ssl_zero_copy_grpc_protector* impl =
+      reinterpret_cast<tsi_ssl_zero_copy_grpc_protector*>(self);
+  BIO* ssl_io = SSL_get_wbio(impl->ssl);
+  tsi_result result = TSI_OK;
+  while (unprotected_slices->length > 0) {
+    size_t record_size =
+        std::min(unprotected_slices->length, impl->max_record_size);
+    if (BIO_ctrl_get_write_guarantee(ssl_io) <
+        record_size + TSI_SSL_MAX_PROTECTION_OVERHEAD) {
+      result = ssl_zero_copy_grpc_protector_flush(impl, protected_slices);
+      if (result != TSI_OK) return result;
+      const size_t write_guarantee = BIO_ctrl_get_write_guarantee(ssl_io);
+      if (write_guarantee <= TSI_SSL_MAX_PROTECTION_OVERHEAD) {
+        ABSL_LOG(ERROR) << "SSL BIO is too small to hold a record.";
+        return TSI_INTERNAL_ERROR;
+      }
+      record_size = std::min(record_size,
+                             write_guarantee - TSI_SSL_MAX_PROTECTION_OVERHEAD);
+    }
+    grpc_slice& first = unprotected_slices->slices[0];
+    if (GRPC_SLICE_LENGTH(first) >= record_size) {
+      // Encrypt straight from the slice.
+      result = grpc_core::DoSslWrite(impl->ssl, GRPC_SLICE_START_PTR(first),
+                                     record_size);
+      grpc_slice_buffer_move_first(unprotected_slices, record_size,
+                                   &impl->consumed);
+      grpc_slice_buffer_reset_and_unref(&impl->consumed);
+    } else {
+      grpc_slice_buffer_move_first_into_buffer(unprotected_slices, record_size,
+                                               impl->record_buffer);
+      result =
+          grpc_core::DoSslWrite(impl->ssl, impl->record_buffer, record_size);
+    }
+    if (result != TSI_OK) return result;
+  }
+  return ssl_zero_copy_grpc_protector_flush(impl, protected_slices);
+}
+
+// Unprotects all of protected_slices. Unprotected bytes are read into
+// slices of the largest record size, and each read is split off the front
+// of one, so that they are not copied again.
+static tsi_result ssl_zero_copy_grpc_protector_unprotect(
+    tsi_zero_copy_grpc_protector* self, grpc_slice_buffer* protected_slices,
+    grpc_slice_buffer* unprotected_slices, int* min_progress_size) {
+  tsi_ssl_zero_copy_grpc_protector* impl =
+      reinterpret_cast<tsi_ssl_zero_copy_grpc_protector*>(self);
+  while (true) {
+    size_t read_size;
+    do {
+      if (GRPC_SLICE_LENGTH(impl->read_slice) == 0) {
+        grpc_core::CSliceUnref(impl->read_slice);
+        impl->read_slice =
+            GRPC_SLICE_MALLOC(TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND);
+      }
+      read_size = GRPC_SLICE_LENGTH(impl->read_slice);
+      tsi_result result = grpc_core::DoSslRead(
+          impl->ssl, GRPC_SLICE_START_PTR(impl->read_slice), &read_size);
+      if (result != TSI_OK) return result;
+      if (read_size > 0) {
+        grpc_slice_buffer_add(unprotected_slices,
+                              grpc_slice_split_head(&impl->read_slice,
+                                                    read_size));
+      }
+    } while (read_size > 0);
+    if (protected_slices->length == 0) break;
+    grpc_slice& first = protected_slices->slices[0];
+    const int written_into_ssl = BIO_write(
+        impl->network_io, GRPC_SLICE_START_PTR(first),
+        static_cast<int>(
+            std::min<size_t>(GRPC_SLICE_LENGTH(first), INT_MAX)));
+    if (written_into_ssl <= 0) {
+      ABSL_LOG(ERROR) << "Sending protected frame to ssl failed with "
+                      << written_into_ssl;
+      return TSI_INTERNAL_ERROR;
+    }
+    grpc_slice_buffer_move_first(protected_slices, written_into_ssl,
+                                 &impl->consumed);
+    grpc_slice_buffer_reset_and_unref(&impl->consumed);
+  }
+  if (min_progress_size != nullptr) *min_progress_size = 1;
+  return TSI_OK;
+}
+
+static void ssl_zero_copy_grpc_protector_destroy(
+    tsi_zero_copy_grpc_protector* self) {
+  tsi_ssl_zero_copy_grpc_protector* impl =
+      reinterpret_cast<tsi_ssl_zero_copy_grpc_protector*>(self);
+  gpr_free(impl->record_buffer);
+  grpc_core::CSliceUnref(impl->read_slice);
+  grpc_slice_buffer_destroy(&impl->consumed);
+  if (impl->ssl != nullptr) SSL_free(impl->ssl);
+  if (impl->network_io != nullptr) BIO_free(impl->network_io);
+  gpr_free(impl);
+}
+
+static tsi_result ssl_zero_copy_grpc_protector_max_frame_size(
+    tsi_zero_copy_grpc_protector* self, size_t* max_frame_size) {
+  tsi_ssl_zero_copy_grpc_protector* impl =
+      reinterpret_cast<tsi_ssl_zero_copy_grpc_protector*>(self);
+  *max_frame_size = impl->max_protected_frame_size;
+  return TSI_OK;
+}
+
+static const tsi_zero_copy_grpc_protector_vtable
+    zero_copy_grpc_protector_vtable = {
+        ssl_zero_copy_grpc_protector_protect,
+        ssl_zero_copy_grpc_protector_unprotect,
+        ssl_zero_copy_grpc_protector_destroy,
+        ssl_zero_copy_grpc_protector_max_frame_size,
+};
+
 // --- tsi_server_handshaker_factory methods implementation. ---
 
 static void tsi_ssl_handshaker_factory_destroy(
@@ -1374,6 +1557,19 @@ static void tsi_ssl_handshaker_factory_unref(
   }
 }
 
+// Takes a ref unless the last one has already been dropped.
+static bool tsi_ssl_handshaker_factory_ref_if_nonzero(
+    tsi_ssl_handshaker_factory* factory) {
+  gpr_atm count = gpr_atm_acq_load(&factory->refcount.count);
+  while (count != 0) {
+    if (gpr_atm_full_cas(&factory->refcount.count, count, count + 1)) {
+      return true;
+    }
+    count = gpr_atm_acq_load(&factory->refcount.count);
+  }
+  return false;
+}
+
 static tsi_ssl_handshaker_factory_vtable handshaker_factory_vtable = {nullptr};
 
 // Initializes a tsi_ssl_handshaker_factory object. Caller is responsible for
@@ -1496,7 +1692,55 @@ static tsi_result ssl_handshaker_result_extract_peer(
 static tsi_result ssl_handshaker_result_get_frame_protector_type(
     const tsi_handshaker_result* /*self*/,
     tsi_frame_protector_type* frame_protector_type) {
-  *frame_protector_type = TSI_FRAME_PROTECTOR_NORMAL;
+  *frame_protector_type = grpc_core::IsSslZeroCopyProtectorEnabled()
+                              ? TSI_FRAME_PROTECTOR_NORMAL_OR_ZERO_COPY
+                              : TSI_FRAME_PROTECTOR_NORMAL;
+  return TSI_OK;
+}
+
+// Clamps the requested frame size, if any, to the bounds that SSL supports,
+// and returns the frame size to use.
+static size_t ssl_max_output_protected_frame_size(
+    size_t* max_output_protected_frame_size) {
+  if (max_output_protected_frame_size == nullptr) {
+    return TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND;
+  }
+  if (*max_output_protected_frame_size >
+      TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND) {
+    *max_output_protected_frame_size =
+        TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND;
+  } else if (*max_output_protected_frame_size <
+             TSI_SSL_MAX_PROTECTED_FRAME_SIZE_LOWER_BOUND) {
+    *max_output_protected_frame_size =
+        TSI_SSL_MAX_PROTECTED_FRAME_SIZE_LOWER_BOUND;
+  }
+  return *max_output_protected_frame_size;
+}
+
+static tsi_result ssl_handshaker_result_create_zero_copy_grpc_protector(
+    const tsi_handshaker_result* self, size_t* max_output_protected_frame_size,
+    tsi_zero_copy_grpc_protector** protector) {
+  tsi_ssl_handshaker_result* impl =
+      reinterpret_cast<tsi_ssl_handshaker_result*>(
+          const_cast<tsi_handshaker_result*>(self));
+  tsi_ssl_zero_copy_grpc_protector* protector_impl =
+      static_cast<tsi_ssl_zero_copy_grpc_protector*>(
+          gpr_zalloc(sizeof(*protector_impl)));
+  protector_impl->max_protected_frame_size =
+      ssl_max_output_protected_frame_size(max_output_protected_frame_size);
+  protector_impl->max_record_size = protector_impl->max_protected_frame_size -
+                                    TSI_SSL_MAX_PROTECTION_OVERHEAD;
+  protector_impl->record_buffer = static_cast<unsigned char*>(
+      gpr_malloc(protector_impl->max_record_size));
+  protector_impl->read_slice = grpc_empty_slice();
+  grpc_slice_buffer_init(&protector_impl->consumed);
+  // Transfer ownership of ssl and network_io to the frame protector.
+  protector_impl->ssl = impl->ssl;
+  impl->ssl = nullptr;
+  protector_impl->network_io = impl->network_io;
+  impl->network_io = nullptr;
+  protector_impl->base.vtable = &zero_copy_grpc_protector_vtable;
+  *protector = &protector_impl->base;
   return TSI_OK;
 }
 
@@ -1504,7 +1748,7 @@ static tsi_result ssl_handshaker_result_create_frame_protector(
     const tsi_handshaker_result* self, size_t* max_output_protected_frame_size,
     tsi_frame_protector** protector) {
   size_t actual_max_output_protected_frame_size =
-      TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND;
+      ssl_max_output_protected_frame_size(max_output_protected_frame_size);
   tsi_ssl_handshaker_result* impl =
       reinterpret_cast<tsi_ssl_handshaker_result*>(
           const_cast<tsi_handshaker_result*>(self));
@@ -1512,18 +1756,6 @@ static tsi_result ssl_handshaker_result_create_frame_protector(
       static_cast<tsi_ssl_frame_protector*>(
           gpr_zalloc(sizeof(*protector_impl)));
 
-  if (max_output_protected_frame_size != nullptr) {
-    if (*max_output_protected_frame_size >
-        TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND) {
-      *max_output_protected_frame_size =
-          TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND;
-    } else if (*max_output_protected_frame_size <
-               TSI_SSL_MAX_PROTECTED_FRAME_SIZE_LOWER_BOUND) {
-      *max_output_protected_frame_size =
-          TSI_SSL_MAX_PROTECTED_FRAME_SIZE_LOWER_BOUND;
-    }
-    actual_max_output_protected_frame_size = *max_output_protected_frame_size;
-  }
   protector_impl->buffer_size =
       actual_max_output_protected_frame_size - TSI_SSL_MAX_PROTECTION_OVERHEAD;
   protector_impl->buffer =
@@ -1563,13 +1795,102 @@ static void ssl_handshaker_result_destroy(tsi_handshaker_result* self) {
   gpr_free(impl);
 }
 
+static tsi_result ssl_handshaker_result_offload_writes_to_kernel(
+    const tsi_handshaker_result* self, int fd) {
+#ifdef TSI_SSL_KERNEL_TLS_SUPPORT
+  const tsi_ssl_handshaker_result* impl =
+      reinterpret_cast<const tsi_ssl_handshaker_result*>(self);
+  SSL* ssl = impl->ssl;
+  // The traffic secrets of TLS 1.3 are not exposed, so only the AES-GCM
+  // suites of TLS 1.2 can be offloaded.
+  if (ssl == nullptr || SSL_version(ssl) != TLS1_2_VERSION) {
+    return TSI_UNIMPLEMENTED;
+  }
+  const SSL_CIPHER* cipher = SSL_get_current_cipher(ssl);
+  if (cipher == nullptr) return TSI_UNIMPLEMENTED;
+  size_t key_size;
+  switch (SSL_CIPHER_get_cipher_nid(cipher)) {
+    case NID_aes_128_gcm:
+      key_size = TLS_CIPHER_AES_GCM_128_KEY_SIZE;
+      break;
+    case NID_aes_256_gcm:
+      key_size = TLS_CIPHER_AES_GCM_256_KEY_SIZE;
+      break;
+    default:
+      return TSI_UNIMPLEMENTED;
+  }
+  // For AEAD suites, the key block holds the client and server write keys
+  // followed by the client and server implicit nonces.
+  constexpr size_t kSaltSize = TLS_CIPHER_AES_GCM_128_SALT_SIZE;
+  static_assert(kSaltSize == TLS_CIPHER_AES_GCM_256_SALT_SIZE);
+  uint8_t key_block[2 * (TLS_CIPHER_AES_GCM_256_KEY_SIZE + kSaltSize)];
+  const size_t key_block_size = 2 * (key_size + kSaltSize);
+  if (SSL_get_key_block_len(ssl) != key_block_size ||
+      !SSL_generate_key_block(ssl, key_block, key_block_size)) {
+    return TSI_INTERNAL_ERROR;
+  }
+  const bool is_server = SSL_is_server(ssl);
+  const uint8_t* key = key_block + (is_server ? key_size : 0);
+  const uint8_t* salt = key_block + 2 * key_size + (is_server ? kSaltSize : 0);
+  // BoringSSL uses the record sequence number as the explicit nonce, and the
+  // kernel advances both together.
+  uint8_t rec_seq[TLS_CIPHER_AES_GCM_128_REC_SEQ_SIZE];
+  uint64_t seq = SSL_get_write_sequence(ssl);
+  for (size_t i = sizeof(rec_seq); i > 0; --i) {
+    rec_seq[i - 1] = static_cast<uint8_t>(seq);
+    seq >>= 8;
+  }
+  union {
+    tls12_crypto_info_aes_gcm_128 aes_128;
+    tls12_crypto_info_aes_gcm_256 aes_256;
+  } crypto_info;
+  memset(&crypto_info, 0, sizeof(crypto_info));
+  socklen_t crypto_info_size;
+  if (key_size == TLS_CIPHER_AES_GCM_128_KEY_SIZE) {
+    crypto_info.aes_128.info.version = TLS_1_2_VERSION;
+    crypto_info.aes_128.info.cipher_type = TLS_CIPHER_AES_GCM_128;
+    memcpy(crypto_info.aes_128.key, key, key_size);
+    memcpy(crypto_info.aes_128.salt, salt, kSaltSize);
+    memcpy(crypto_info.aes_128.iv, rec_seq, sizeof(rec_seq));
+    memcpy(crypto_info.aes_128.rec_seq, rec_seq, sizeof(rec_seq));
+    crypto_info_size = sizeof(crypto_info.aes_128);
+  } else {
+    crypto_info.aes_256.info.version = TLS_1_2_VERSION;
+    crypto_info.aes_256.info.cipher_type = TLS_CIPHER_AES_GCM_256;
+    memcpy(crypto_info.aes_256.key, key, key_size);
+    memcpy(crypto_info.aes_256.salt, salt, kSaltSize);
+    memcpy(crypto_info.aes_256.iv, rec_seq, sizeof(rec_seq));
+    memcpy(crypto_info.aes_256.rec_seq, rec_seq, sizeof(rec_seq));
+    crypto_info_size = sizeof(crypto_info.aes_256);
+  }
+  OPENSSL_cleanse(key_block, sizeof(key_block));
+  // Until TLS_TX is set, the "tls" ULP leaves writes to the socket as they
+  // are, so the socket can still be used with the frame protector if either
+  // call fails.
+  tsi_result result = TSI_OK;
+  if (setsockopt(fd, SOL_TCP, TCP_ULP, "tls", sizeof("tls")) != 0 ||
+      setsockopt(fd, SOL_TLS, TLS_TX, &crypto_info, crypto_info_size) != 0) {
+    ABSL_VLOG(2) << "Kernel TLS is not available on fd " << fd << ": "
+                 << strerror(errno);
+    result = TSI_UNIMPLEMENTED;
+  }
+  OPENSSL_cleanse(&crypto_info, sizeof(crypto_info));
+  return result;
+#else
+  (void)self;
+  (void)fd;
+  return TSI_UNIMPLEMENTED;
+#endif  // TSI_SSL_KERNEL_TLS_SUPPORT
+}
+
 static const tsi_handshaker_result_vtable handshaker_result_vtable = {
     ssl_handshaker_result_extract_peer,
     ssl_handshaker_result_get_frame_protector_type,
-    nullptr,  // create_zero_copy_grpc_protector
+    ssl_handshaker_result_create_zero_copy_grpc_protector,
     ssl_handshaker_result_create_frame_protector,
     ssl_handshaker_result_get_unused_bytes,
     ssl_handshaker_result_destroy,
+    ssl_handshaker_result_offload_writes_to_kernel,
 };
 
 static tsi_result ssl_handshaker_result_create(
@@ -2017,11 +2338,115 @@ tsi_ssl_client_handshaker_factory* tsi_ssl_client_handshaker_factory_ref(
       tsi_ssl_handshaker_factory_ref(&client_factory->base));
 }
 
+namespace {
+
+// Client factories that are not tied to a particular session cache, key
+// logger or CRL provider, keyed by a digest of their options. Channels with
+// identical TLS options share one factory, and so one SSL_CTX, instead of
+// parsing the roots and key again. Entries don't hold a ref; a factory
+// removes itself when destroyed.
+struct ClientFactoryCache {
+  grpc_core::Mutex mu;
+  absl::flat_hash_map<std::string, tsi_ssl_client_handshaker_factory*>
+      factories ABSL_GUARDED_BY(mu);
+};
+
+ClientFactoryCache* GetClientFactoryCache() {
+  static grpc_core::NoDestruct<ClientFactoryCache> cache;
+  return cache.get();
+}
+
+std::string CacheKeyString(const unsigned char* digest) {
+  return std::string(reinterpret_cast<const char*>(digest),
+                     SHA256_DIGEST_LENGTH);
+}
+
+void DigestString(SHA256_CTX* sha, const char* str) {
+  // Distinguish a null string from an empty one, and keep adjacent fields
+  // from running into each other.
+  const uint64_t size = str == nullptr ? UINT64_MAX : strlen(str);
+  SHA256_Update(sha, &size, sizeof(size));
+  if (str != nullptr) SHA256_Update(sha, str, size);
+}
+
+template <typename T>
+void DigestValue(SHA256_CTX* sha, const T& value) {
+  SHA256_Update(sha, &value, sizeof(value));
+}
+
+// Returns false if factories created from `options` can't be shared.
+bool ClientFactoryCacheKey(const tsi_ssl_client_handshaker_options* options,
+                           unsigned char* digest) {
+  // The CRL provider is only referenced, not owned, by the SSL_CTX, so a
+  // shared factory could outlive it.
+  if (options->crl_provider != nullptr) return false;
+  SHA256_CTX sha;
+  SHA256_Init(&sha);
+  const tsi_ssl_pem_key_cert_pair* pair = options->pem_key_cert_pair;
+  DigestString(&sha, pair == nullptr ? nullptr : pair->private_key);
+  DigestString(&sha, pair == nullptr ? nullptr : pair->cert_chain);
+  DigestString(&sha, options->pem_root_certs);
+  // The remaining pointers are to objects the factory holds a ref on, so
+  // their addresses can't be reused while the entry exists.
+  DigestValue(&sha, options->root_store == nullptr
+                        ? nullptr
+                        : options->root_store->store);
+  DigestString(&sha, options->cipher_suites);
+  DigestValue(&sha, options->num_alpn_protocols);
+  for (size_t i = 0; i < options->num_alpn_protocols; ++i) {
+    DigestString(&sha, options->alpn_protocols[i]);
+  }
+  DigestValue(&sha, options->session_cache);
+  DigestValue(&sha, options->key_logger);
+  DigestValue(&sha, options->skip_server_certificate_verification);
+  DigestValue(&sha, options->min_tls_version);
+  DigestValue(&sha, options->max_tls_version);
+  DigestString(&sha, options->crl_directory);
+  SHA256_Final(digest, &sha);
+  return true;
+}
+
+tsi_ssl_client_handshaker_factory* LookupClientFactory(
+    const unsigned char* digest) {
+  ClientFactoryCache* cache = GetClientFactoryCache();
+  grpc_core::MutexLock lock(&cache->mu);
+  auto it = cache->factories.find(CacheKeyString(digest));
+  if (it == cache->factories.end() ||
+      !tsi_ssl_handshaker_factory_ref_if_nonzero(&it->second->base)) {
+    return nullptr;
+  }
+  return it->second;
+}
+
+void InsertClientFactory(tsi_ssl_client_handshaker_factory* factory,
+                         const unsigned char* digest) {
+  memcpy(factory->cache_key, digest, SHA256_DIGEST_LENGTH);
+  factory->cached = true;
+  ClientFactoryCache* cache = GetClientFactoryCache();
+  grpc_core::MutexLock lock(&cache->mu);
+  // Replaces a factory that is being destroyed, or one created concurrently
+  // for the same options; either way the other one stays valid for its own
+  // holders.
+  cache->factories[CacheKeyString(digest)] = factory;
+}
+
+void RemoveClientFactory(tsi_ssl_client_handshaker_factory* factory) {
+  ClientFactoryCache* cache = GetClientFactoryCache();
+  grpc_core::MutexLock lock(&cache->mu);
+  auto it = cache->factories.find(CacheKeyString(factory->cache_key));
+  if (it != cache->factories.end() && it->second == factory) {
+    cache->factories.erase(it);
+  }
+}
+
+}  // namespace
+
 static void tsi_ssl_client_handshaker_factory_destroy(
     tsi_ssl_handshaker_factory* factory) {
   if (factory == nullptr) return;
   tsi_ssl_client_handshaker_factory* self =
       reinterpret_cast<tsi_ssl_client_handshaker_factory*>(factory);
+  if (self->cached) RemoveClientFactory(self);
   if (self->ssl_context != nullptr) SSL_CTX_free(self->ssl_context);
   if (self->alpn_protocol_list != nullptr) gpr_free(self->alpn_protocol_list);
   self->session_cache.reset();
@@ -2234,6 +2659,14 @@ tsi_result tsi_create_ssl_client_handshaker_factory_with_options(
     return TSI_INVALID_ARGUMENT;
   }
 
+  unsigned char cache_key[SHA256_DIGEST_LENGTH];
+  const bool cacheable = grpc_core::IsSharedSslClientContextEnabled() &&
+                         ClientFactoryCacheKey(options, cache_key);
+  if (cacheable) {
+    *factory = LookupClientFactory(cache_key);
+    if (*factory != nullptr) return TSI_OK;
+  }
+
 #if OPENSSL_VERSION_NUMBER >= 0x10100000
   ssl_context = SSL_CTX_new(TLS_method());
 #else
@@ -2369,6 +2802,7 @@ tsi_result tsi_create_ssl_client_handshaker_factory_with_options(
   }
 #endif
 
+  if (cacheable) InsertClientFactory(impl, cache_key);
   *factory = impl;
   return TSI_OK;
 }
@@ -280,6 +280,17 @@ tsi_result tsi_handshaker_result_create_frame_protector(
       self, max_output_protected_frame_size, protector);
 }
 
+tsi_result tsi_handshaker_result_offload_writes_to_kernel(
+    const tsi_handshaker_result* self, int fd) {
+  if (self == nullptr || self->vtable == nullptr || fd < 0) {
+    return TSI_INVALID_ARGUMENT;
+  }
+  if (self->vtable->offload_writes_to_kernel == nullptr) {
+    return TSI_UNIMPLEMENTED;
+  }
+  return self->vtable->offload_writes_to_kernel(self, fd);
+}
+
 tsi_result tsi_handshaker_result_get_unused_bytes(
     const tsi_handshaker_result* self, const unsigned char** bytes,
     size_t* bytes_size) {
@@ -115,6 +115,10 @@ struct tsi_handshaker_result_vtable {
                                  const unsigned char** bytes,
                                  size_t* bytes_size);
   void (*destroy)(tsi_handshaker_result* self);
+  // May be null if the implementation cannot hand its write protection to
+  // the kernel.
+  tsi_result (*offload_writes_to_kernel)(const tsi_handshaker_result* self,
+                                         int fd);
 };
 struct tsi_handshaker_result {
   const tsi_handshaker_result_vtable* vtable;
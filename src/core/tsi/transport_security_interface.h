@@ -266,6 +266,15 @@ tsi_result tsi_handshaker_result_create_frame_protector(
     const tsi_handshaker_result* self, size_t* max_output_protected_frame_size,
     tsi_frame_protector** protector);
 
+// This method installs the write keys negotiated by the handshake on the
+// socket fd, so that the kernel protects all data written to it from then on.
+// It must be called before the frame protector is created, and once it
+// returns TSI_OK, the frame protector must only be used to unprotect.
+// It returns TSI_UNIMPLEMENTED if the implementation, the negotiated protocol
+// or the kernel does not support it, in which case the socket is unchanged.
+tsi_result tsi_handshaker_result_offload_writes_to_kernel(
+    const tsi_handshaker_result* self, int fd);
+
 // This method returns the unused bytes from the handshake. It returns TSI_OK
 // assuming there is no fatal error.
 // Ownership of the bytes is retained by the handshaker result. As a
@@ -0,0 +1,36 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/util/codel.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+
+namespace grpc_core {
+
+void CoDel::RecordQueueingDelay(Duration delay, Timestamp now) {
+  if (target_ == Duration::Zero()) return;
+  if (now < interval_end_) {
+    min_delay_ = std::min(min_delay_, delay);
+    return;
+  }
+  // The interval is over: judge it, unless it ended so long ago that the
+  // queue has since gone a whole interval without an item leaving it.
+  overloaded_ = now < interval_end_ + interval_ && min_delay_ > target_;
+  interval_end_ = now + interval_;
+  min_delay_ = delay;
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,60 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_UTIL_CODEL_H
+#define GRPC_SRC_CORE_UTIL_CODEL_H
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/util/time.h"
+
+namespace grpc_core {
+
+// Detects a standing queue in the manner of CoDel (Nichols & Jacobson,
+// "Controlling Queue Delay"): a queue is overloaded when the shortest time
+// that any item spent in it over an interval exceeds a target.  A burst
+// that drains within the interval is thereby not mistaken for overload.
+class CoDel {
+ public:
+  // A zero target disables detection.
+  CoDel() = default;
+  CoDel(Duration target, Duration interval)
+      : target_(target), interval_(interval) {}
+
+  // Records the time that an item spent in the queue, as it leaves the
+  // queue at now.
+  void RecordQueueingDelay(Duration delay, Timestamp now);
+
+  // Returns true if the last interval found the queue overloaded.  A
+  // verdict with no item recorded for a whole interval since lapses.
+  bool Overloaded(Timestamp now) const {
+    return overloaded_ && now < interval_end_ + interval_;
+  }
+
+  Duration target() const { return target_; }
+  Duration interval() const { return interval_; }
+
+ private:
+  Duration target_;
+  Duration interval_;
+  // The end of the current interval, and the shortest delay recorded
+  // during it.
+  Timestamp interval_end_ = Timestamp::InfPast();
+  Duration min_delay_ = Duration::Infinity();
+  bool overloaded_ = false;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_UTIL_CODEL_H
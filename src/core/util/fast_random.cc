@@ -0,0 +1,30 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/util/fast_random.h"
+
+#include <grpc/support/port_platform.h>
+
+#include "absl/random/distributions.h"
+#include "absl/random/random.h"
+
+namespace grpc_core {
+
+thread_local uint64_t FastRandom::state_;
+
+uint64_t FastRandom::Seed() {
+  return absl::Uniform<uint64_t>(absl::BitGen()) | 1;
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,69 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_UTIL_FAST_RANDOM_H
+#define GRPC_SRC_CORE_UTIL_FAST_RANDOM_H
+
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+
+#include "absl/base/optimization.h"
+#include "absl/numeric/int128.h"
+
+namespace grpc_core {
+
+// A cheap per-thread pseudo-random generator (wyrand), for hot paths such
+// as LB picks that need a few random bits per call and can't afford a
+// mutex around a shared absl::BitGen, or constructing a fresh one.
+// Each thread's state is seeded from absl::BitGen on first use.
+// NOT suitable for anything that needs unpredictable numbers.
+//
+// Satisfies UniformRandomBitGenerator, so that an instance can be passed to
+// absl::Uniform() and friends, or as an absl::BitGenRef.  Instances hold no
+// state of their own.
+class FastRandom {
+ public:
+  using result_type = uint64_t;
+
+  static constexpr result_type min() { return 0; }
+  static constexpr result_type max() { return ~result_type{0}; }
+
+  result_type operator()() { return Next(); }
+
+  // Returns 64 random bits.
+  static uint64_t Next() {
+    uint64_t& state = state_;
+    if (ABSL_PREDICT_FALSE(state == 0)) state = Seed();
+    state += 0xa0761d6478bd642f;
+    const absl::uint128 product =
+        absl::uint128(state) * (state ^ 0xe7037ed1a0b428db);
+    return absl::Uint128High64(product) ^ absl::Uint128Low64(product);
+  }
+
+  // Returns a number in [0, n), for n > 0.  Uses a multiply and shift
+  // rather than a division; the bias this leaves is below n / 2^64.
+  static uint64_t Below(uint64_t n) {
+    return absl::Uint128High64(absl::uint128(Next()) * n);
+  }
+
+ private:
+  // Returns a random non-zero seed.
+  static uint64_t Seed();
+
+  static thread_local uint64_t state_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_UTIL_FAST_RANDOM_H
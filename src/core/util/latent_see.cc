@@ -15,13 +15,17 @@
 #include "src/core/util/latent_see.h"
 
 #ifdef GRPC_ENABLE_LATENT_SEE
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
+#include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
 #include "src/core/util/ring_buffer.h"
@@ -31,6 +35,7 @@ namespace grpc_core {
 namespace latent_see {
 
 thread_local uint64_t Log::thread_id_ = Log::Get().next_thread_id_.fetch_add(1);
+thread_local uint32_t Log::sample_counter_ = 0;
 thread_local Bin* Log::bin_ = nullptr;
 thread_local void* Log::bin_owner_ = nullptr;
 std::atomic<uint64_t> Flow::next_flow_id_{1};
@@ -47,6 +52,7 @@ void Log::TryPullEventsAndFlush(
     for (auto& fragment : fragments_) {
       MutexLock lock(&fragment.mu_active);
       fragment.active.clear();
+      fragment.active_head = 0;
     }
     return;
   }
@@ -55,8 +61,15 @@ void Log::TryPullEventsAndFlush(
   // long.
   for (auto& fragment : fragments_) {
     ABSL_CHECK_EQ(fragment.flushing.size(), 0);
-    MutexLock lock(&fragment.mu_active);
-    fragment.flushing.swap(fragment.active);
+    size_t head;
+    {
+      MutexLock lock(&fragment.mu_active);
+      fragment.flushing.swap(fragment.active);
+      head = std::exchange(fragment.active_head, 0);
+    }
+    // Put the events of a wrapped ring buffer back in order.
+    std::rotate(fragment.flushing.begin(), fragment.flushing.begin() + head,
+                fragment.flushing.end());
   }
   // Now we've swapped out, call the callback repeatedly with each fragment.
   // This is the slow part - there's a lot of copying and transformation that
@@ -75,6 +88,96 @@ void Log::TryPullEventsAndFlush(
   mu_flushing_.Unlock();
 }
 
+namespace {
+
+void AppendVarint(std::string* out, uint64_t value) {
+  while (value >= 0x80) {
+    out->push_back(static_cast<char>((value & 0x7f) | 0x80));
+    value >>= 7;
+  }
+  out->push_back(static_cast<char>(value));
+}
+
+void AppendString(std::string* out, absl::string_view value) {
+  AppendVarint(out, value.size());
+  out->append(value.data(), value.size());
+}
+
+}  // namespace
+
+void Log::SetSampleRate(absl::string_view name_prefix, uint32_t one_in) {
+  MutexLock lock(&mu_config_);
+  auto it = std::find_if(
+      sample_rates_.begin(), sample_rates_.end(),
+      [name_prefix](const auto& rate) { return rate.first == name_prefix; });
+  if (it == sample_rates_.end()) {
+    sample_rates_.emplace_back(std::string(name_prefix), one_in);
+  } else {
+    it->second = one_in;
+  }
+  config_generation_.fetch_add(1, std::memory_order_relaxed);
+}
+
+uint64_t Log::UpdateSampling(const Metadata* metadata, uint32_t generation) {
+  uint32_t one_in = 1;
+  size_t prefix_length = 0;
+  {
+    MutexLock lock(&mu_config_);
+    for (const auto& rate : sample_rates_) {
+      if (rate.first.size() >= prefix_length &&
+          absl::StartsWith(metadata->name, rate.first)) {
+        one_in = rate.second;
+        prefix_length = rate.first.size();
+      }
+    }
+  }
+  const uint64_t sampling = (static_cast<uint64_t>(generation) << 32) | one_in;
+  metadata->sampling.store(sampling, std::memory_order_relaxed);
+  return sampling;
+}
+
+std::optional<std::string> Log::TryGenerateBinary() {
+  using Nanos = std::chrono::duration<unsigned long long, std::nano>;
+  absl::flat_hash_map<const Metadata*, uint64_t> metadata_indices;
+  std::string metadata_table;
+  std::string events_table;
+  uint64_t num_events = 0;
+  int callbacks = 0;
+  TryPullEventsAndFlush([&](absl::Span<const RecordedEvent> events) {
+    ++callbacks;
+    for (const auto& event : events) {
+      const Metadata* metadata = event.event.metadata;
+      auto it = metadata_indices.find(metadata);
+      if (it == metadata_indices.end()) {
+        it = metadata_indices.emplace(metadata, metadata_indices.size()).first;
+        AppendString(&metadata_table, metadata->file);
+        AppendVarint(&metadata_table, metadata->line);
+        AppendString(&metadata_table, metadata->name);
+      }
+      AppendVarint(&events_table, it->second);
+      AppendVarint(&events_table, static_cast<uint8_t>(event.event.type));
+      AppendVarint(&events_table, event.thread_id);
+      AppendVarint(&events_table, event.batch_id);
+      AppendVarint(&events_table,
+                   Nanos(event.event.timestamp - start_time).count());
+      if (event.event.type == EventType::kFlowStart ||
+          event.event.type == EventType::kFlowEnd) {
+        AppendVarint(&events_table, event.event.id);
+      }
+      ++num_events;
+    }
+  });
+  if (callbacks == 0) return std::nullopt;
+  std::string out = "LSB1";
+  AppendVarint(&out, Nanos(start_time.time_since_epoch()).count());
+  AppendVarint(&out, dropped_events_.exchange(0, std::memory_order_relaxed));
+  AppendVarint(&out, metadata_indices.size());
+  out.append(metadata_table);
+  AppendVarint(&out, num_events);
+  out.append(events_table);
+  return out;
+}
+
 std::optional<std::string> Log::TryGenerateJson() {
   using Nanos = std::chrono::duration<unsigned long long, std::nano>;
   std::string json = "[\n";
@@ -149,12 +252,23 @@ void Log::FlushBin(Bin* bin) {
       log.next_batch_id_.fetch_add(1, std::memory_order_relaxed);
   auto& fragment = log.fragments_.this_cpu();
   const auto thread_id = thread_id_;
+  size_t dropped = 0;
   {
     MutexLock lock(&fragment.mu_active);
     for (auto event : bin->events) {
-      fragment.active.push_back(RecordedEvent{thread_id, batch_id, event});
+      if (fragment.active.size() < kMaxEventsPerFragment) {
+        fragment.active.push_back(RecordedEvent{thread_id, batch_id, event});
+        continue;
+      }
+      fragment.active[fragment.active_head] =
+          RecordedEvent{thread_id, batch_id, event};
+      fragment.active_head = (fragment.active_head + 1) % kMaxEventsPerFragment;
+      ++dropped;
     }
   }
+  if (dropped != 0) {
+    log.dropped_events_.fetch_add(dropped, std::memory_order_relaxed);
+  }
   bin->events.clear();
 }
 
@@ -48,6 +48,10 @@ struct Metadata {
   const char* file;
   int line;
   const char* name;
+  // The sample rate of parent scopes with this name, cached by
+  // Log::ShouldSample(): the configuration generation it was computed for
+  // in the top 32 bits, and the rate (one in N, 0 for never) below.
+  mutable std::atomic<uint64_t> sampling{0};
 };
 
 enum class EventType : uint8_t { kBegin, kEnd, kFlowStart, kFlowEnd, kMark };
@@ -118,6 +122,33 @@ class Log {
 
   static Bin* CurrentThreadBin() { return bin_; }
 
+  // Appends an event to this thread's bin, if it is recording one.
+  GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION static void Append(
+      const Metadata* metadata, EventType type, uint64_t id) {
+    Bin* bin = bin_;
+    if (bin != nullptr) bin->Append(metadata, type, id);
+  }
+
+  // Returns whether a parent scope with metadata should record a bin.
+  GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION static bool ShouldSample(
+      const Metadata* metadata) {
+    const uint32_t generation =
+        Get().config_generation_.load(std::memory_order_relaxed);
+    uint64_t sampling = metadata->sampling.load(std::memory_order_relaxed);
+    if (sampling >> 32 != generation) {
+      sampling = Get().UpdateSampling(metadata, generation);
+    }
+    const uint32_t one_in = static_cast<uint32_t>(sampling);
+    if (one_in <= 1) return one_in == 1;
+    return ++sample_counter_ % one_in == 0;
+  }
+
+  // Records one in one_in of the parent scopes whose names start with
+  // name_prefix, or none if one_in is 0. The longest matching prefix set
+  // applies; the empty prefix sets the default, which is to record all of
+  // them. May be called at any time, from any thread.
+  void SetSampleRate(absl::string_view name_prefix, uint32_t one_in);
+
   GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION static Log& Get() {
     static Log* log = []() {
       atexit([] {
@@ -145,6 +176,16 @@ class Log {
   void TryPullEventsAndFlush(
       absl::FunctionRef<void(absl::Span<const RecordedEvent>)> callback);
   std::optional<std::string> TryGenerateJson();
+  // Like TryGenerateJson(), but in a compact binary format, for continuous
+  // capture. All integers are unsigned LEB128 varints; strings are their
+  // length followed by their bytes:
+  //   "LSB1", start time (ns since the steady clock epoch),
+  //   events dropped since the last dump, metadata count,
+  //   metadata count x (file, line, name),
+  //   event count, event count x (metadata index, type, thread id, batch id,
+  //     timestamp (ns since the start time), [flow id, for flow events])
+  // Event types are numbered as in EventType.
+  std::optional<std::string> TryGenerateBinary();
 
   void OverrideStatsFlusher(
       absl::AnyInvocable<void(absl::string_view)> stats_exporter) {
@@ -154,19 +195,36 @@ class Log {
  private:
   Log() = default;
 
+  // The most events each per-CPU fragment buffers between dumps; once it is
+  // full, each new event overwrites the oldest one.
+  static constexpr size_t kMaxEventsPerFragment = 16384;
+
   static void FlushBin(Bin* bin);
+  uint64_t UpdateSampling(const Metadata* metadata, uint32_t generation);
 
   std::atomic<uint64_t> next_thread_id_{1};
   std::atomic<uint64_t> next_batch_id_{1};
   static thread_local uint64_t thread_id_;
+  static thread_local uint32_t sample_counter_;
   static thread_local Bin* bin_;
   static thread_local void* bin_owner_;
   static std::atomic<uintptr_t> free_bins_;
   absl::AnyInvocable<void(absl::string_view)> stats_flusher_ = nullptr;
+  // Starts at 1, so that every Metadata computes its sample rate on first
+  // use.
+  std::atomic<uint32_t> config_generation_{1};
+  Mutex mu_config_;
+  // Sample rates by name prefix.
+  std::vector<std::pair<std::string, uint32_t>> sample_rates_
+      ABSL_GUARDED_BY(mu_config_);
+  std::atomic<uint64_t> dropped_events_{0};
   Mutex mu_flushing_;
   struct Fragment {
     Mutex mu_active ABSL_ACQUIRED_AFTER(mu_flushing_);
+    // A ring buffer of up to kMaxEventsPerFragment events, whose oldest event
+    // is at active_head once it is full.
     std::vector<RecordedEvent> active ABSL_GUARDED_BY(mu_active);
+    size_t active_head ABSL_GUARDED_BY(mu_active) = 0;
     std::vector<RecordedEvent> flushing ABSL_GUARDED_BY(&Log::mu_flushing_);
   };
   PerCpu<Fragment> fragments_{PerCpuOptions()};
@@ -179,13 +237,16 @@ class Scope {
       : metadata_(metadata) {
     bin_ = Log::CurrentThreadBin();
     if (kParent && bin_ == nullptr) {
+      if (!Log::ShouldSample(metadata_)) return;
       bin_descriptor_ = Log::StartBin(this);
       bin_ = Log::ToBin(bin_descriptor_);
     }
-    ABSL_CHECK_NE(bin_, nullptr);
+    // Not recording: the parent scope was not sampled.
+    if (bin_ == nullptr) return;
     bin_->Append(metadata_, EventType::kBegin, 0);
   }
   GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION ~Scope() {
+    if (bin_ == nullptr) return;
     bin_->Append(metadata_, EventType::kEnd, 0);
     if (kParent) Log::EndBin(bin_descriptor_, this);
   }
@@ -208,11 +269,11 @@ class Flow {
   GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION explicit Flow(const Metadata* metadata)
       : metadata_(metadata),
         id_(next_flow_id_.fetch_add(1, std::memory_order_relaxed)) {
-    Log::CurrentThreadBin()->Append(metadata_, EventType::kFlowStart, id_);
+    Log::Append(metadata_, EventType::kFlowStart, id_);
   }
   GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION ~Flow() {
     if (metadata_ != nullptr) {
-      Log::CurrentThreadBin()->Append(metadata_, EventType::kFlowEnd, id_);
+      Log::Append(metadata_, EventType::kFlowEnd, id_);
     }
   }
 
@@ -222,7 +283,7 @@ class Flow {
       : metadata_(std::exchange(other.metadata_, nullptr)), id_(other.id_) {}
   Flow& operator=(Flow&& other) noexcept {
     if (metadata_ != nullptr) {
-      Log::CurrentThreadBin()->Append(metadata_, EventType::kFlowEnd, id_);
+      Log::Append(metadata_, EventType::kFlowEnd, id_);
     }
     metadata_ = std::exchange(other.metadata_, nullptr);
     id_ = other.id_;
@@ -234,18 +295,17 @@ class Flow {
   }
   GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION void End() {
     if (metadata_ == nullptr) return;
-    Log::CurrentThreadBin()->Append(metadata_, EventType::kFlowEnd, id_);
+    Log::Append(metadata_, EventType::kFlowEnd, id_);
     metadata_ = nullptr;
   }
   GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION void Begin(const Metadata* metadata) {
-    auto* bin = Log::CurrentThreadBin();
     if (metadata_ != nullptr) {
-      bin->Append(metadata_, EventType::kFlowEnd, id_);
+      Log::Append(metadata_, EventType::kFlowEnd, id_);
     }
     metadata_ = metadata;
     if (metadata_ == nullptr) return;
     id_ = next_flow_id_.fetch_add(1, std::memory_order_relaxed);
-    bin->Append(metadata_, EventType::kFlowStart, id_);
+    Log::Append(metadata_, EventType::kFlowStart, id_);
   }
 
  private:
@@ -255,7 +315,7 @@ class Flow {
 };
 
 GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION inline void Mark(const Metadata* md) {
-  Log::CurrentThreadBin()->Append(md, EventType::kMark, 0);
+  Log::Append(md, EventType::kMark, 0);
 }
 
 template <typename P>
@@ -283,6 +343,8 @@ GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION auto Promise(const Metadata* md_poll,
 // Parent scope: logs a begin and end event, and flushes the thread log on scope
 // exit. Because the flush takes some time it's better to place one parent scope
 // at the top of the stack, and use lighter weight scopes within it.
+// Only sampled parent scopes (see Log::SetSampleRate()) record anything;
+// scopes, marks and flows within the others are not recorded.
 #define GRPC_LATENT_SEE_PARENT_SCOPE(name)                       \
   grpc_core::latent_see::ParentScope latent_see_scope##__LINE__( \
       GRPC_LATENT_SEE_METADATA(name))
@@ -24,6 +24,16 @@
 #include <limits>
 #include <memory>
 
+// glibc 2.35+ registers a restartable sequences area for every thread, in
+// which the kernel keeps the id of the cpu the thread is running on.
+#if defined(GPR_LINUX) && defined(__GLIBC__) && defined(__has_include) && \
+    defined(__has_builtin)
+#if __has_include(<sys/rseq.h>) && __has_builtin(__builtin_thread_pointer)
+#define GRPC_PER_CPU_RSEQ 1
+#include <sys/rseq.h>
+#endif
+#endif
+
 // Sharded collections of objects
 // This used to be per-cpu, now it's much less so - but still a way to limit
 // contention.
@@ -58,6 +68,14 @@ class PerCpuOptions {
 class PerCpuShardingHelper {
  public:
   size_t GetShardingBits() {
+#ifdef GRPC_PER_CPU_RSEQ
+    // The rseq cpu id is always current, so threads that migrate move to
+    // their new cpu's shard straight away, for the cost of a load.
+    if (GPR_LIKELY(__rseq_size > 0)) {
+      const int32_t cpu = RseqCpuId();
+      if (GPR_LIKELY(cpu >= 0)) return cpu;
+    }
+#endif
     // We periodically refresh the last seen cpu to try to ensure that we spread
     // load evenly over all shards of a per-cpu data structure, even in the
     // event of shifting thread distributions, load patterns.
@@ -70,6 +88,16 @@ class PerCpuShardingHelper {
   }
 
  private:
+#ifdef GRPC_PER_CPU_RSEQ
+  // Negative if rseq registration failed for this thread.
+  static int32_t RseqCpuId() {
+    const auto* area = reinterpret_cast<const struct rseq*>(
+        static_cast<const char*>(__builtin_thread_pointer()) + __rseq_offset);
+    return static_cast<int32_t>(
+        __atomic_load_n(&area->cpu_id, __ATOMIC_RELAXED));
+  }
+#endif
+
   struct State {
     uint16_t last_seen_cpu = gpr_cpu_current_cpu();
     uint16_t uses_until_refresh = 65535;
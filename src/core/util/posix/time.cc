@@ -85,6 +85,19 @@ static gpr_timespec now_impl(gpr_clock_type clock_type) {
 
 gpr_timespec (*gpr_now_impl)(gpr_clock_type clock_type) = now_impl;
 
+gpr_timespec gpr_now_coarse_monotonic(void) {
+#ifdef CLOCK_MONOTONIC_COARSE
+  if (gpr_now_impl == now_impl) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC_COARSE, &now);
+    // Same offset as now_impl, so both clocks share the same timeline.
+    now.tv_sec += 5;
+    return gpr_from_timespec(now, GPR_CLOCK_MONOTONIC);
+  }
+#endif
+  return gpr_now(GPR_CLOCK_MONOTONIC);
+}
+
 gpr_timespec gpr_now(gpr_clock_type clock_type) {
   // validate clock type
   ABSL_CHECK(clock_type == GPR_CLOCK_MONOTONIC || clock_type == GPR_CLOCK_REALTIME ||
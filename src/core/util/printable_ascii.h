@@ -0,0 +1,78 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_UTIL_PRINTABLE_ASCII_H
+#define GRPC_SRC_CORE_UTIL_PRINTABLE_ASCII_H
+
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "absl/strings/string_view.h"
+
+namespace grpc_core {
+
+namespace printable_ascii_detail {
+
+inline constexpr uint64_t kOnes = 0x0101010101010101;
+inline constexpr uint64_t kHighs = 0x8080808080808080;
+
+// Non-zero if some byte of `w` is below `n` (n <= 128).
+constexpr uint64_t HasByteBelow(uint64_t w, uint8_t n) {
+  return (w - kOnes * n) & ~w & kHighs;
+}
+
+// Non-zero if some byte of `w` is above `n` (n <= 127).
+constexpr uint64_t HasByteAbove(uint64_t w, uint8_t n) {
+  return ((w + kOnes * (127 - n)) | w) & kHighs;
+}
+
+constexpr bool IsPrintable(uint8_t c) { return c >= 0x20 && c <= 0x7e; }
+
+}  // namespace printable_ascii_detail
+
+// Returns true if every byte of `x` is printable ASCII (0x20 to 0x7e) other
+// than `excluded`, which may be 0 to exclude nothing.
+// Classifies eight bytes at a time: most header values it is used on are all
+// legal, and this keeps checking them from costing a table lookup per byte.
+inline bool IsPrintableAsciiWithout(absl::string_view x, uint8_t excluded) {
+  using printable_ascii_detail::HasByteAbove;
+  using printable_ascii_detail::HasByteBelow;
+  using printable_ascii_detail::kOnes;
+  const char* p = x.data();
+  const char* const end = p + x.size();
+  const uint64_t excluded_word = kOnes * excluded;
+  for (; end - p >= 8; p += 8) {
+    uint64_t w;
+    memcpy(&w, p, 8);
+    if (HasByteBelow(w, 0x20) | HasByteAbove(w, 0x7e) |
+        (excluded != 0 ? HasByteBelow(w ^ excluded_word, 1) : 0)) {
+      return false;
+    }
+  }
+  for (; p != end; ++p) {
+    const uint8_t c = static_cast<uint8_t>(*p);
+    if (!printable_ascii_detail::IsPrintable(c) || c == excluded) return false;
+  }
+  return true;
+}
+
+inline bool IsPrintableAscii(absl::string_view x) {
+  return IsPrintableAsciiWithout(x, 0);
+}
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_UTIL_PRINTABLE_ASCII_H
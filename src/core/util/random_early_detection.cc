@@ -17,6 +17,7 @@
 #include <grpc/support/port_platform.h>
 
 #include "absl/random/distributions.h"
+#include "src/core/util/fast_random.h"
 
 namespace grpc_core {
 
@@ -30,4 +31,9 @@ bool RandomEarlyDetection::Reject(uint64_t size, absl::BitGenRef bitsrc) const {
   return true;
 }
 
+bool RandomEarlyDetection::Reject(uint64_t size) const {
+  FastRandom bitsrc;
+  return Reject(size, bitsrc);
+}
+
 }  // namespace grpc_core
@@ -38,6 +38,8 @@ class RandomEarlyDetection {
 
   // Returns true if the item should be rejected.
   bool Reject(uint64_t size, absl::BitGenRef bitsrc) const;
+  // As above, drawing random bits from FastRandom.
+  bool Reject(uint64_t size) const;
 
   uint64_t soft_limit() const { return soft_limit_; }
   uint64_t hard_limit() const { return hard_limit_; }
@@ -42,6 +42,9 @@ class GprNowTimeSource final : public Timestamp::Source {
   Timestamp Now() override {
     return Timestamp::FromTimespecRoundDown(gpr_now(GPR_CLOCK_MONOTONIC));
   }
+  Timestamp CoarseNow() override {
+    return Timestamp::FromTimespecRoundDown(gpr_now_coarse_monotonic());
+  }
 };
 
 GPR_ATTRIBUTE_NOINLINE std::pair<int64_t, gpr_cycle_counter> InitTime() {
@@ -158,6 +161,13 @@ Timestamp ScopedTimeCache::Now() {
   return cached_time_.value();
 }
 
+Timestamp ScopedTimeCache::CoarseNow() {
+  // A cached time is as cheap as it gets; otherwise don't fill the cache with
+  // a coarse value that later Now() calls would return.
+  if (cached_time_.has_value()) return *cached_time_;
+  return previous()->CoarseNow();
+}
+
 Timestamp Timestamp::FromTimespecRoundUp(gpr_timespec ts) {
   return FromMillisecondsAfterProcessEpoch(TimespanToMillisRoundUp(gpr_time_sub(
       gpr_convert_clock_type(ts, GPR_CLOCK_MONOTONIC), StartTime())));
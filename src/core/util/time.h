@@ -77,6 +77,8 @@ class Timestamp {
    public:
     // Return the current time.
     virtual Timestamp Now() = 0;
+    // Return the current time, possibly a few milliseconds stale.
+    virtual Timestamp CoarseNow() { return Now(); }
     virtual void InvalidateCache() {}
 
    protected:
@@ -111,6 +113,13 @@ class Timestamp {
   static Timestamp FromCycleCounterRoundDown(gpr_cycle_counter c);
 
   static Timestamp Now() { return thread_local_time_source_->Now(); }
+  // Like Now(), but may lag the current time by a few milliseconds (one
+  // kernel tick), in exchange for being cheaper to read. For hot paths that
+  // only need approximate time, e.g. to push back a timer measured in
+  // seconds. Never use it to decide that a deadline has passed.
+  static Timestamp CoarseNow() {
+    return thread_local_time_source_->CoarseNow();
+  }
 
   static constexpr Timestamp FromMillisecondsAfterProcessEpoch(int64_t millis) {
     return Timestamp(millis);
@@ -169,6 +178,7 @@ class Timestamp {
 class ScopedTimeCache final : public Timestamp::ScopedSource {
  public:
   Timestamp Now() override;
+  Timestamp CoarseNow() override;
 
   void InvalidateCache() override {
     cached_time_ = std::nullopt;
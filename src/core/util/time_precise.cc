@@ -165,3 +165,8 @@ gpr_timespec gpr_cycle_counter_sub(gpr_cycle_counter a, gpr_cycle_counter b) {
 }
 #endif  // GPR_CYCLE_COUNTER_FALLBACK
 #endif  // !GPR_CYCLE_COUNTER_CUSTOM
+
+int64_t gpr_cycle_counter_sub_micros(gpr_cycle_counter a, gpr_cycle_counter b) {
+  const gpr_timespec ts = gpr_cycle_counter_sub(a, b);
+  return ts.tv_sec * GPR_US_PER_SEC + ts.tv_nsec / GPR_NS_PER_US;
+}
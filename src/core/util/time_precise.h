@@ -64,5 +64,13 @@ void gpr_precise_clock_init(void);
 void gpr_precise_clock_now(gpr_timespec* clk);
 gpr_timespec gpr_cycle_counter_to_time(gpr_cycle_counter cycles);
 gpr_timespec gpr_cycle_counter_sub(gpr_cycle_counter a, gpr_cycle_counter b);
+// Returns a - b in microseconds, for latency histograms.
+int64_t gpr_cycle_counter_sub_micros(gpr_cycle_counter a, gpr_cycle_counter b);
+
+// Like gpr_now(GPR_CLOCK_MONOTONIC), but where the platform has a cheaper
+// coarse clock it is used instead, and the result may lag the real time by up
+// to one kernel tick (a few milliseconds). If gpr_now_impl has been replaced
+// (e.g. by a test simulating time) this is exactly gpr_now().
+gpr_timespec gpr_now_coarse_monotonic(void);
 
 #endif  // GRPC_SRC_CORE_UTIL_TIME_PRECISE_H
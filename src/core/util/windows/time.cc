@@ -79,6 +79,10 @@ gpr_timespec gpr_now(gpr_clock_type clock_type) {
   return gpr_now_impl(clock_type);
 }
 
+gpr_timespec gpr_now_coarse_monotonic(void) {
+  return gpr_now(GPR_CLOCK_MONOTONIC);
+}
+
 void gpr_sleep_until(gpr_timespec until) {
   gpr_timespec now;
   gpr_timespec delta;
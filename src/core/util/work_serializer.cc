@@ -82,6 +82,14 @@ class WorkSerializer::WorkSerializerImpl
   };
   using CallbackVector = absl::InlinedVector<CallbackWrapper, 1>;
 
+  // With the work_serializer_batched_drain experiment, how long one
+  // EventEngine closure keeps draining queued callbacks before it yields the
+  // thread and reschedules itself.
+  static constexpr std::chrono::milliseconds kMaxDrainTime{1};
+
+  // Run the next callback in processing_ and pop it.
+  void RunNextCallback();
+
   // Refill processing_ from incoming_
   // If processing_ is empty, also update running_ and return false.
   // If additionally orphaned, will also delete this (therefore, it's not safe
@@ -192,6 +200,29 @@ void WorkSerializer::WorkSerializerImpl::Run() {
   // TODO(ctiller): remove these when we can deprecate ExecCtx
   ApplicationCallbackExecCtx app_exec_ctx;
   ExecCtx exec_ctx;
+  if (!IsWorkSerializerBatchedDrainEnabled()) {
+    RunNextCallback();
+    // Check if we've drained the queue and if so refill it.
+    if (processing_.empty() && !Refill()) return;
+  } else {
+    // Keep going while there is work, rather than paying a thread hop per
+    // callback, but yield after kMaxDrainTime so that we share the thread.
+    const auto drain_start = std::chrono::steady_clock::now();
+    do {
+      RunNextCallback();
+      if (processing_.empty() && !Refill()) return;
+      // Run anything the callback scheduled on the ExecCtx before the next
+      // callback, as we would if each callback had its own closure.
+      exec_ctx.Flush();
+    } while (std::chrono::steady_clock::now() - drain_start < kMaxDrainTime);
+  }
+  // There's still work in processing_, so schedule ourselves again on
+  // EventEngine.
+  flow_.Begin(GRPC_LATENT_SEE_METADATA("WorkSerializer::Link"));
+  event_engine_->Run(this);
+}
+
+void WorkSerializer::WorkSerializerImpl::RunNextCallback() {
   // Grab the last element of processing_ - which is the next item in our
   // queue since processing_ is stored in reverse order.
   auto& cb = processing_.back();
@@ -213,12 +244,6 @@ void WorkSerializer::WorkSerializerImpl::Run() {
       std::chrono::duration_cast<std::chrono::milliseconds>(work_time).count());
   time_running_items_ += work_time;
   ++items_processed_during_run_;
-  // Check if we've drained the queue and if so refill it.
-  if (processing_.empty() && !Refill()) return;
-  // There's still work in processing_, so schedule ourselves again on
-  // EventEngine.
-  flow_.Begin(GRPC_LATENT_SEE_METADATA("WorkSerializer::Link"));
-  event_engine_->Run(this);
 }
 
 WorkSerializer::WorkSerializerImpl::RefillResult
@@ -257,6 +282,7 @@ bool WorkSerializer::WorkSerializerImpl::Refill() {
   const auto result = RefillInner();
   switch (result) {
     case RefillResult::kRefilled:
+      global_stats().IncrementWorkSerializerQueueDepth(processing_.size());
       // Reverse processing_ so that we can pop_back() items in the correct
       // order. (note that this is mostly pointer swaps inside the
       // std::function's, so should be relatively cheap even for longer
@@ -372,34 +372,38 @@ std::vector<RefCountedPtr<GrpcXdsClient>> GetAllXdsClients() {
 
 }  // namespace
 
-// ABSL_NO_THREAD_SAFETY_ANALYSIS because we have to manually manage locks for
-// individual XdsClients and compiler struggles with checking the validity
-grpc_slice GrpcXdsClient::DumpAllClientConfigs()
-    ABSL_NO_THREAD_SAFETY_ANALYSIS {
+grpc_slice GrpcXdsClient::DumpAllClientConfigs() {
   auto xds_clients = GetAllXdsClients();
-  upb::Arena arena;
-  // Contains strings that should survive till serialization
-  std::set<std::string> string_pool;
-  auto response = envoy_service_status_v3_ClientStatusResponse_new(arena.ptr());
-  // We lock each XdsClient mutex till we are done with the serialization to
-  // ensure that all data referenced from the UPB proto message stays alive.
+  // Each XdsClient is encoded as its own single-config ClientStatusResponse.
+  // Concatenated serialized messages parse as their merge, so appending
+  // them builds the full response without holding it all as one upb
+  // message. Each XdsClient's mutex is held only while its state is copied.
+  std::string output;
   for (const auto& xds_client : xds_clients) {
+    ClientConfigSnapshot snapshot;
+    {
+      MutexLock lock(xds_client->mu());
+      snapshot = xds_client->SnapshotClientConfig();
+    }
+    upb::Arena arena;
+    // Contains strings that should survive till serialization
+    std::set<std::string> string_pool;
+    auto response =
+        envoy_service_status_v3_ClientStatusResponse_new(arena.ptr());
     auto client_config =
         envoy_service_status_v3_ClientStatusResponse_add_config(response,
                                                                 arena.ptr());
-    xds_client->mu()->Lock();
-    xds_client->DumpClientConfig(&string_pool, arena.ptr(), client_config);
+    xds_client->DumpClientConfig(snapshot, &string_pool, arena.ptr(),
+                                 client_config);
     envoy_service_status_v3_ClientConfig_set_client_scope(
         client_config, StdStringToUpbString(xds_client->key()));
+    // Serialize the upb message to bytes
+    size_t output_length;
+    char* serialized = envoy_service_status_v3_ClientStatusResponse_serialize(
+        response, arena.ptr(), &output_length);
+    output.append(serialized, output_length);
   }
-  // Serialize the upb message to bytes
-  size_t output_length;
-  char* output = envoy_service_status_v3_ClientStatusResponse_serialize(
-      response, arena.ptr(), &output_length);
-  for (const auto& xds_client : xds_clients) {
-    xds_client->mu()->Unlock();
-  }
-  return grpc_slice_from_cpp_string(std::string(output, output_length));
+  return grpc_slice_from_cpp_string(std::move(output));
 }
 
 void GrpcXdsClient::ReportCallbackMetrics(CallbackMetricReporter& reporter) {
@@ -118,10 +118,16 @@ std::string GetHashKeyFromMetadata(const XdsMetadataMap& metadata_map) {
       .value_or("");
 }
 
+// The distinct endpoint attribute sets of a resource.  Most endpoints of a
+// large cluster have the same weight, health status and proxy, so interning
+// their args lets them all share one copy, rather than each holding its own.
+using ChannelArgsSet = std::set<ChannelArgs>;
+
 std::optional<EndpointAddresses> EndpointAddressesParse(
     const XdsResourceType::DecodeContext& context,
     const envoy_config_endpoint_v3_LbEndpoint* lb_endpoint,
-    absl::string_view locality_proxy_address, ValidationErrors* errors) {
+    absl::string_view locality_proxy_address, ChannelArgsSet* interned_args,
+    ValidationErrors* errors) {
   // health_status
   const int32_t health_status =
       envoy_config_endpoint_v3_LbEndpoint_health_status(lb_endpoint);
@@ -204,7 +210,8 @@ std::optional<EndpointAddresses> EndpointAddressesParse(
   if (!hash_key.empty()) {
     args = args.Set(GRPC_ARG_RING_HASH_ENDPOINT_HASH_KEY, hash_key);
   }
-  return EndpointAddresses(addresses, args);
+  return EndpointAddresses(addresses,
+                           *interned_args->insert(std::move(args)).first);
 }
 
 struct ParsedLocality {
@@ -225,7 +232,8 @@ using ResolvedAddressSet =
 std::optional<ParsedLocality> LocalityParse(
     const XdsResourceType::DecodeContext& context,
     const envoy_config_endpoint_v3_LocalityLbEndpoints* locality_lb_endpoints,
-    ResolvedAddressSet* address_set, ValidationErrors* errors) {
+    ResolvedAddressSet* address_set, ChannelArgsSet* interned_args,
+    ValidationErrors* errors) {
   const size_t original_error_size = errors->size();
   ParsedLocality parsed_locality;
   // load_balancing_weight
@@ -275,8 +283,9 @@ std::optional<ParsedLocality> LocalityParse(
   for (size_t i = 0; i < size; ++i) {
     ValidationErrors::ScopedField field(errors,
                                         absl::StrCat(".lb_endpoints[", i, "]"));
-    auto endpoint =
-        EndpointAddressesParse(context, lb_endpoints[i], proxy_address, errors);
+    auto endpoint = EndpointAddressesParse(context, lb_endpoints[i],
+                                           proxy_address, interned_args,
+                                           errors);
     if (endpoint.has_value()) {
       for (const auto& address : endpoint->addresses()) {
         bool inserted = address_set->insert(address).second;
@@ -357,14 +366,15 @@ absl::StatusOr<std::shared_ptr<const XdsEndpointResource>> EdsResourceParse(
   {
     ValidationErrors::ScopedField field(&errors, "endpoints");
     ResolvedAddressSet address_set;
+    ChannelArgsSet interned_args;
     size_t locality_size;
     const envoy_config_endpoint_v3_LocalityLbEndpoints* const* endpoints =
         envoy_config_endpoint_v3_ClusterLoadAssignment_endpoints(
             cluster_load_assignment, &locality_size);
     for (size_t i = 0; i < locality_size; ++i) {
       ValidationErrors::ScopedField field(&errors, absl::StrCat("[", i, "]"));
-      auto parsed_locality =
-          LocalityParse(context, endpoints[i], &address_set, &errors);
+      auto parsed_locality = LocalityParse(context, endpoints[i], &address_set,
+                                           &interned_args, &errors);
       if (parsed_locality.has_value()) {
         ABSL_CHECK_NE(parsed_locality->locality.lb_weight, 0u);
         // Make sure prorities is big enough. Note that they might not
@@ -31,6 +31,7 @@
 #include <variant>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/log/absl_check.h"
 #include "absl/log/absl_log.h"
 #include "absl/status/status.h"
@@ -386,13 +387,29 @@ void RouteRuntimeFractionParse(const envoy_config_route_v3_RouteMatch* match,
   }
 }
 
+// Filter config overrides generated while parsing one RouteConfiguration,
+// keyed by filter name and the serialized Any they came from. Control
+// planes tend to attach identical overrides to many routes, and this way
+// each distinct one is converted only once.
+using FilterConfigOverrideCache =
+    absl::flat_hash_map<std::string, XdsHttpFilterImpl::FilterConfig>;
+
+std::string FilterConfigOverrideCacheKey(absl::string_view filter_name,
+                                         const google_protobuf_Any* any) {
+  absl::string_view type_url =
+      UpbStringToAbsl(google_protobuf_Any_type_url(any));
+  return absl::StrCat(filter_name.size(), ":", filter_name, type_url.size(),
+                      ":", type_url,
+                      UpbStringToAbsl(google_protobuf_Any_value(any)));
+}
+
 template <typename ParentType, typename EntryType>
 XdsRouteConfigResource::TypedPerFilterConfig ParseTypedPerFilterConfig(
     const XdsResourceType::DecodeContext& context, const ParentType* parent,
     const EntryType* (*entry_func)(const ParentType*, size_t*),
     upb_StringView (*key_func)(const EntryType*),
     const google_protobuf_Any* (*value_func)(const EntryType*),
-    ValidationErrors* errors) {
+    FilterConfigOverrideCache* cache, ValidationErrors* errors) {
   XdsRouteConfigResource::TypedPerFilterConfig typed_per_filter_config;
   size_t filter_it = kUpb_Map_Begin;
   while (true) {
@@ -400,8 +417,20 @@ XdsRouteConfigResource::TypedPerFilterConfig ParseTypedPerFilterConfig(
     if (filter_entry == nullptr) break;
     absl::string_view key = UpbStringToAbsl(key_func(filter_entry));
     ValidationErrors::ScopedField field(errors, absl::StrCat("[", key, "]"));
+    const size_t num_errors = errors->size();
     if (key.empty()) errors->AddError("filter name must be non-empty");
     const google_protobuf_Any* any = value_func(filter_entry);
+    // Only overrides that parsed without errors are cached, so a hit can
+    // skip validation entirely.
+    std::string cache_key;
+    if (any != nullptr) {
+      cache_key = FilterConfigOverrideCacheKey(key, any);
+      auto it = cache->find(cache_key);
+      if (it != cache->end()) {
+        typed_per_filter_config[std::string(key)] = it->second;
+        continue;
+      }
+    }
     auto extension = ExtractXdsExtension(context, any, errors);
     if (!extension.has_value()) continue;
     auto* extension_to_use = &*extension;
@@ -441,6 +470,9 @@ XdsRouteConfigResource::TypedPerFilterConfig ParseTypedPerFilterConfig(
         filter_impl->GenerateFilterConfigOverride(
             key, context, std::move(*extension_to_use), errors);
     if (filter_config.has_value()) {
+      if (!cache_key.empty() && errors->size() == num_errors) {
+        cache->emplace(std::move(cache_key), *filter_config);
+      }
       typed_per_filter_config[std::string(key)] = std::move(*filter_config);
     }
   }
@@ -520,7 +552,7 @@ std::optional<XdsRouteConfigResource::Route::RouteAction> RouteActionParse(
     const std::map<std::string /*cluster_specifier_plugin_name*/,
                    std::string /*LB policy config*/>&
         cluster_specifier_plugin_map,
-    ValidationErrors* errors) {
+    FilterConfigOverrideCache* filter_config_cache, ValidationErrors* errors) {
   XdsRouteConfigResource::Route::RouteAction route_action;
   // grpc_timeout_header_max or max_stream_duration
   const auto* max_stream_duration =
@@ -672,7 +704,7 @@ std::optional<XdsRouteConfigResource::Route::RouteAction> RouteActionParse(
             envoy_config_route_v3_WeightedCluster_ClusterWeight_typed_per_filter_config_next,
             envoy_config_route_v3_WeightedCluster_ClusterWeight_TypedPerFilterConfigEntry_key,
             envoy_config_route_v3_WeightedCluster_ClusterWeight_TypedPerFilterConfigEntry_value,
-            errors);
+            filter_config_cache, errors);
       }
       // name
       cluster.name = UpbStringToStdString(
@@ -742,7 +774,7 @@ std::optional<XdsRouteConfigResource::Route> ParseRoute(
     const XdsRouteConfigResource::ClusterSpecifierPluginMap&
         cluster_specifier_plugin_map,
     std::set<absl::string_view>* cluster_specifier_plugins_not_seen,
-    ValidationErrors* errors) {
+    FilterConfigOverrideCache* filter_config_cache, ValidationErrors* errors) {
   XdsRouteConfigResource::Route route;
   // Parse route match.
   {
@@ -769,8 +801,10 @@ std::optional<XdsRouteConfigResource::Route> ParseRoute(
       envoy_config_route_v3_Route_route(route_proto);
   if (route_action_proto != nullptr) {
     ValidationErrors::ScopedField field(errors, ".route");
-    auto route_action = RouteActionParse(context, route_action_proto,
-                                         cluster_specifier_plugin_map, errors);
+    auto route_action =
+        RouteActionParse(context, route_action_proto,
+                         cluster_specifier_plugin_map, filter_config_cache,
+                         errors);
     if (!route_action.has_value()) return std::nullopt;
     // If the route does not have a retry policy but the vhost does,
     // use the vhost retry policy for this route.
@@ -801,7 +835,8 @@ std::optional<XdsRouteConfigResource::Route> ParseRoute(
         context, route_proto,
         envoy_config_route_v3_Route_typed_per_filter_config_next,
         envoy_config_route_v3_Route_TypedPerFilterConfigEntry_key,
-        envoy_config_route_v3_Route_TypedPerFilterConfigEntry_value, errors);
+        envoy_config_route_v3_Route_TypedPerFilterConfigEntry_value,
+        filter_config_cache, errors);
   }
   return route;
 }
@@ -824,6 +859,7 @@ std::shared_ptr<const XdsRouteConfigResource> XdsRouteConfigResourceParse(
   for (auto& [name, _] : rds_update->cluster_specifier_plugin_map) {
     cluster_specifier_plugins_not_seen.emplace(name);
   }
+  FilterConfigOverrideCache filter_config_cache;
   // Get the virtual hosts.
   size_t num_virtual_hosts;
   const envoy_config_route_v3_VirtualHost* const* virtual_hosts =
@@ -863,7 +899,7 @@ std::shared_ptr<const XdsRouteConfigResource> XdsRouteConfigResourceParse(
           envoy_config_route_v3_VirtualHost_typed_per_filter_config_next,
           envoy_config_route_v3_VirtualHost_TypedPerFilterConfigEntry_key,
           envoy_config_route_v3_VirtualHost_TypedPerFilterConfigEntry_value,
-          errors);
+          &filter_config_cache, errors);
     }
     // Parse retry policy.
     std::optional<XdsRouteConfigResource::RetryPolicy>
@@ -883,7 +919,8 @@ std::shared_ptr<const XdsRouteConfigResource> XdsRouteConfigResourceParse(
       ValidationErrors::ScopedField field(errors, absl::StrCat("[", j, "]"));
       auto route = ParseRoute(context, routes[j], virtual_host_retry_policy,
                               rds_update->cluster_specifier_plugin_map,
-                              &cluster_specifier_plugins_not_seen, errors);
+                              &cluster_specifier_plugins_not_seen,
+                              &filter_config_cache, errors);
       if (route.has_value()) vhost.routes.emplace_back(std::move(*route));
     }
   }
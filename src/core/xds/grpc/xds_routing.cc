@@ -26,6 +26,7 @@
 #include <cctype>
 #include <utility>
 
+#include "absl/container/inlined_vector.h"
 #include "absl/log/absl_check.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
@@ -154,24 +155,94 @@ bool UnderFraction(const uint32_t fraction_per_million) {
   return random_number < fraction_per_million;
 }
 
+bool RouteMatches(const XdsRouteConfigResource::Route::Matchers& matchers,
+                  absl::string_view path,
+                  grpc_metadata_batch* initial_metadata) {
+  return matchers.path_matcher.Match(path) &&
+         HeadersMatch(matchers.header_matchers, initial_metadata) &&
+         (!matchers.fraction_per_million.has_value() ||
+          UnderFraction(*matchers.fraction_per_million));
+}
+
 }  // namespace
 
 std::optional<size_t> XdsRouting::GetRouteForRequest(
     const RouteListIterator& route_list_iterator, absl::string_view path,
     grpc_metadata_batch* initial_metadata) {
   for (size_t i = 0; i < route_list_iterator.Size(); ++i) {
-    const XdsRouteConfigResource::Route::Matchers& matchers =
-        route_list_iterator.GetMatchersForRoute(i);
-    if (matchers.path_matcher.Match(path) &&
-        HeadersMatch(matchers.header_matchers, initial_metadata) &&
-        (!matchers.fraction_per_million.has_value() ||
-         UnderFraction(*matchers.fraction_per_million))) {
+    if (RouteMatches(route_list_iterator.GetMatchersForRoute(i), path,
+                     initial_metadata)) {
       return i;
     }
   }
   return std::nullopt;
 }
 
+//
+// XdsRouting::RouteIndex
+//
+
+XdsRouting::RouteIndex::RouteIndex(
+    const RouteListIterator& route_list_iterator) {
+  for (size_t i = 0; i < route_list_iterator.Size(); ++i) {
+    const StringMatcher& path_matcher =
+        route_list_iterator.GetMatchersForRoute(i).path_matcher;
+    if (!path_matcher.case_sensitive()) {
+      other_routes_.push_back(i);
+    } else if (path_matcher.type() == StringMatcher::Type::kExact) {
+      exact_routes_[path_matcher.string_matcher()].push_back(i);
+    } else if (path_matcher.type() == StringMatcher::Type::kPrefix) {
+      prefix_routes_[path_matcher.string_matcher()].push_back(i);
+    } else {
+      other_routes_.push_back(i);
+    }
+  }
+  for (const auto& entry : prefix_routes_) {
+    prefix_lengths_.push_back(entry.first.size());
+  }
+  std::sort(prefix_lengths_.begin(), prefix_lengths_.end());
+  prefix_lengths_.erase(
+      std::unique(prefix_lengths_.begin(), prefix_lengths_.end()),
+      prefix_lengths_.end());
+}
+
+std::optional<size_t> XdsRouting::RouteIndex::GetRouteForRequest(
+    const RouteListIterator& route_list_iterator, absl::string_view path,
+    grpc_metadata_batch* initial_metadata) const {
+  // Gather the candidate lists, then evaluate their routes in increasing
+  // order of index, so that the first matching route wins as it does
+  // without the index.
+  struct Candidates {
+    const std::vector<size_t>* routes;
+    size_t next = 0;
+  };
+  absl::InlinedVector<Candidates, 4> candidates;
+  if (!other_routes_.empty()) candidates.push_back({&other_routes_});
+  auto it = exact_routes_.find(path);
+  if (it != exact_routes_.end()) candidates.push_back({&it->second});
+  for (size_t length : prefix_lengths_) {
+    if (length > path.size()) break;
+    it = prefix_routes_.find(path.substr(0, length));
+    if (it != prefix_routes_.end()) candidates.push_back({&it->second});
+  }
+  while (true) {
+    Candidates* lowest = nullptr;
+    for (Candidates& c : candidates) {
+      if (c.next == c.routes->size()) continue;
+      if (lowest == nullptr ||
+          (*c.routes)[c.next] < (*lowest->routes)[lowest->next]) {
+        lowest = &c;
+      }
+    }
+    if (lowest == nullptr) return std::nullopt;
+    const size_t index = (*lowest->routes)[lowest->next++];
+    if (RouteMatches(route_list_iterator.GetMatchersForRoute(index), path,
+                     initial_metadata)) {
+      return index;
+    }
+  }
+}
+
 bool XdsRouting::IsValidDomainPattern(absl::string_view domain_pattern) {
   return DomainPatternMatchType(domain_pattern) != INVALID_MATCH;
 }
@@ -27,6 +27,7 @@
 #include <string>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/string_view.h"
 #include "src/core/lib/channel/channel_args.h"
@@ -69,6 +70,31 @@ class XdsRouting final {
       const RouteListIterator& route_list_iterator, absl::string_view path,
       grpc_metadata_batch* initial_metadata);
 
+  // An index of the path matchers of a route list, built once per route
+  // list, that narrows the routes evaluated for a request down to those
+  // whose path matcher may match its path: case-sensitive exact and prefix
+  // path matchers are looked up by path instead of being run one by one.
+  class RouteIndex {
+   public:
+    RouteIndex() = default;
+    explicit RouteIndex(const RouteListIterator& route_list_iterator);
+
+    // Equivalent to GetRouteForRequest() on the route list that the index
+    // was built from.
+    std::optional<size_t> GetRouteForRequest(
+        const RouteListIterator& route_list_iterator, absl::string_view path,
+        grpc_metadata_batch* initial_metadata) const;
+
+   private:
+    // Route indices, in increasing order, by path or path prefix.
+    absl::flat_hash_map<std::string, std::vector<size_t>> exact_routes_;
+    absl::flat_hash_map<std::string, std::vector<size_t>> prefix_routes_;
+    // The distinct lengths of the keys of prefix_routes_.
+    std::vector<size_t> prefix_lengths_;
+    // The routes whose path matcher has to be run, in increasing order.
+    std::vector<size_t> other_routes_;
+  };
+
   // Returns true if \a domain_pattern is a valid domain pattern, false
   // otherwise.
   static bool IsValidDomainPattern(absl::string_view domain_pattern);
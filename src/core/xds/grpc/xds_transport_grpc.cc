@@ -41,6 +41,8 @@
 #include "src/core/lib/channel/channel_stack.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/event_engine/extensions/run_with_priority.h"
+#include "src/core/lib/event_engine/work_priority.h"
 #include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/iomgr/pollset_set.h"
@@ -297,7 +299,10 @@ void GrpcXdsTransportFactory::GrpcXdsTransport::Orphaned() {
   // Do an async hop before unreffing.  This avoids a deadlock upon
   // shutdown in the case where the xDS channel is itself an xDS channel
   // (e.g., when using one control plane to find another control plane).
-  grpc_event_engine::experimental::GetDefaultEventEngine()->Run(
+  // Nothing waits on this, so it must not delay work on the data path.
+  grpc_event_engine::experimental::RunWithPriority(
+      grpc_event_engine::experimental::GetDefaultEventEngine().get(),
+      grpc_event_engine::experimental::WorkPriority::kBackground,
       [self = WeakRefAsSubclass<GrpcXdsTransport>()]() mutable {
         ApplicationCallbackExecCtx application_exec_ctx;
         ExecCtx exec_ctx;
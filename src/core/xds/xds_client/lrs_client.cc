@@ -166,6 +166,21 @@ LrsClient::ClusterLocalityStats::~ClusterLocalityStats() {
   lrs_client_.reset(DEBUG_LOCATION, "ClusterLocalityStats");
 }
 
+void LrsClient::ClusterLocalityStats::AtomicBackendMetric::Add(double value) {
+  num_requests_finished_with_metric.fetch_add(1, std::memory_order_relaxed);
+  double total = total_metric_value.load(std::memory_order_relaxed);
+  while (!total_metric_value.compare_exchange_weak(
+      total, total + value, std::memory_order_relaxed)) {
+  }
+}
+
+LrsClient::ClusterLocalityStats::BackendMetric
+LrsClient::ClusterLocalityStats::AtomicBackendMetric::GetAndReset() {
+  return BackendMetric(
+      GetAndResetCounter(&num_requests_finished_with_metric),
+      total_metric_value.exchange(0, std::memory_order_relaxed));
+}
+
 LrsClient::ClusterLocalityStats::Snapshot
 LrsClient::ClusterLocalityStats::GetSnapshotAndReset() {
   Snapshot snapshot;
@@ -177,17 +192,21 @@ LrsClient::ClusterLocalityStats::GetSnapshotAndReset() {
         percpu_stats.total_requests_in_progress.load(std::memory_order_relaxed),
         GetAndResetCounter(&percpu_stats.total_error_requests),
         GetAndResetCounter(&percpu_stats.total_issued_requests),
-        {},
-        {},
-        {},
+        percpu_stats.cpu_utilization.GetAndReset(),
+        percpu_stats.mem_utilization.GetAndReset(),
+        percpu_stats.application_utilization.GetAndReset(),
         {}};
+    std::map<std::string, BackendMetric, std::less<>> backend_metrics;
     {
       MutexLock lock(&percpu_stats.backend_metrics_mu);
-      percpu_snapshot.cpu_utilization = std::move(percpu_stats.cpu_utilization);
-      percpu_snapshot.mem_utilization = std::move(percpu_stats.mem_utilization);
-      percpu_snapshot.application_utilization =
-          std::move(percpu_stats.application_utilization);
-      percpu_snapshot.backend_metrics = std::move(percpu_stats.backend_metrics);
+      backend_metrics = std::move(percpu_stats.backend_metrics);
+    }
+    for (auto& [name, value] : backend_metrics) {
+      percpu_snapshot.backend_metrics.emplace(
+          XdsOrcaLrsPropagationChangesEnabled()
+              ? absl::StrCat("named_metrics.", name)
+              : name,
+          std::move(value));
     }
     snapshot += percpu_snapshot;
   }
@@ -208,35 +227,48 @@ void LrsClient::ClusterLocalityStats::AddCallFinished(
   to_increment.fetch_add(1, std::memory_order_relaxed);
   stats.total_requests_in_progress.fetch_add(-1, std::memory_order_acq_rel);
   if (backend_metrics == nullptr) return;
-  MutexLock lock(&stats.backend_metrics_mu);
+  // Adds a named metric, allocating a key only the first time a name is seen
+  // in a reporting interval.
+  auto add_named_metric = [&](absl::string_view name, double value)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(&stats.backend_metrics_mu) {
+        auto it = stats.backend_metrics.find(name);
+        if (it == stats.backend_metrics.end()) {
+          it = stats.backend_metrics.emplace(std::string(name), BackendMetric())
+                   .first;
+        }
+        it->second += BackendMetric(1, value);
+      };
   if (!XdsOrcaLrsPropagationChangesEnabled()) {
+    if (backend_metrics->named_metrics.empty()) return;
+    MutexLock lock(&stats.backend_metrics_mu);
     for (const auto& [name, value] : backend_metrics->named_metrics) {
-      stats.backend_metrics[std::string(name)] += BackendMetric(1, value);
+      add_named_metric(name, value);
     }
     return;
   }
   if (backend_metric_propagation_->propagation_bits &
       BackendMetricPropagation::kCpuUtilization) {
-    stats.cpu_utilization += BackendMetric(1, backend_metrics->cpu_utilization);
+    stats.cpu_utilization.Add(backend_metrics->cpu_utilization);
   }
   if (backend_metric_propagation_->propagation_bits &
       BackendMetricPropagation::kMemUtilization) {
-    stats.mem_utilization += BackendMetric(1, backend_metrics->mem_utilization);
+    stats.mem_utilization.Add(backend_metrics->mem_utilization);
   }
   if (backend_metric_propagation_->propagation_bits &
       BackendMetricPropagation::kApplicationUtilization) {
-    stats.application_utilization +=
-        BackendMetric(1, backend_metrics->application_utilization);
+    stats.application_utilization.Add(
+        backend_metrics->application_utilization);
   }
-  if (backend_metric_propagation_->propagation_bits &
-          BackendMetricPropagation::kNamedMetricsAll ||
-      !backend_metric_propagation_->named_metric_keys.empty()) {
+  if ((backend_metric_propagation_->propagation_bits &
+           BackendMetricPropagation::kNamedMetricsAll ||
+       !backend_metric_propagation_->named_metric_keys.empty()) &&
+      !backend_metrics->named_metrics.empty()) {
+    MutexLock lock(&stats.backend_metrics_mu);
     for (const auto& [name, value] : backend_metrics->named_metrics) {
       if (backend_metric_propagation_->propagation_bits &
               BackendMetricPropagation::kNamedMetricsAll ||
           backend_metric_propagation_->named_metric_keys.contains(name)) {
-        stats.backend_metrics[absl::StrCat("named_metrics.", name)] +=
-            BackendMetric(1, value);
+        add_named_metric(name, value);
       }
     }
   }
@@ -20,6 +20,7 @@
 #include <grpc/event_engine/event_engine.h>
 
 #include <atomic>
+#include <functional>
 #include <map>
 #include <memory>
 #include <set>
@@ -205,17 +206,31 @@ class LrsClient : public DualRefCounted<LrsClient> {
     XdsLocalityName* locality_name() const { return name_.get(); }
 
    private:
+    // A BackendMetric that can be added to without a lock. The two fields are
+    // reset independently, so a concurrent add may have its count and value
+    // land in adjacent reports.
+    struct AtomicBackendMetric {
+      std::atomic<uint64_t> num_requests_finished_with_metric{0};
+      std::atomic<double> total_metric_value{0};
+
+      void Add(double value);
+      BackendMetric GetAndReset();
+    };
+
     struct Stats {
       std::atomic<uint64_t> total_successful_requests{0};
       std::atomic<uint64_t> total_requests_in_progress{0};
       std::atomic<uint64_t> total_error_requests{0};
       std::atomic<uint64_t> total_issued_requests{0};
 
+      AtomicBackendMetric cpu_utilization;
+      AtomicBackendMetric mem_utilization;
+      AtomicBackendMetric application_utilization;
+
+      // Only taken for calls that report named metrics. Keys are the metric
+      // names as reported; any prefix is added when taking a snapshot.
       Mutex backend_metrics_mu;
-      BackendMetric cpu_utilization ABSL_GUARDED_BY(backend_metrics_mu);
-      BackendMetric mem_utilization ABSL_GUARDED_BY(backend_metrics_mu);
-      BackendMetric application_utilization ABSL_GUARDED_BY(backend_metrics_mu);
-      std::map<std::string, BackendMetric> backend_metrics
+      std::map<std::string, BackendMetric, std::less<>> backend_metrics
           ABSL_GUARDED_BY(backend_metrics_mu);
     };
 
@@ -328,6 +328,12 @@ class XdsClient::XdsChannel::AdsCall final
     Timestamp update_time = Timestamp::Now();
     RefCountedPtr<ReadDelayHandle> read_delay_handle;
   };
+  // Returns the cached resource named resource_name, if its serialized
+  // bytes are serialized_resource.
+  std::shared_ptr<const XdsResourceType::ResourceData> FindCachedResource(
+      const XdsResourceType* type, absl::string_view resource_name,
+      absl::string_view serialized_resource)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
   void ParseResource(size_t idx, absl::string_view type_url,
                      absl::string_view resource_name,
                      absl::string_view serialized_resource,
@@ -920,6 +926,28 @@ void XdsClient::XdsChannel::AdsCall::OnRequestSent(bool ok) {
   }
 }
 
+std::shared_ptr<const XdsResourceType::ResourceData>
+XdsClient::XdsChannel::AdsCall::FindCachedResource(
+    const XdsResourceType* type, absl::string_view resource_name,
+    absl::string_view serialized_resource) {
+  auto parsed_resource_name =
+      xds_client()->ParseXdsResourceName(resource_name, type);
+  if (!parsed_resource_name.ok()) return nullptr;
+  auto authority_it =
+      xds_client()->authority_state_map_.find(parsed_resource_name->authority);
+  if (authority_it == xds_client()->authority_state_map_.end()) return nullptr;
+  auto type_it = authority_it->second.resource_map.find(type);
+  if (type_it == authority_it->second.resource_map.end()) return nullptr;
+  auto res_it = type_it->second.find(parsed_resource_name->key);
+  if (res_it == type_it->second.end()) return nullptr;
+  const ResourceState& resource_state = res_it->second;
+  if (!resource_state.HasResource() ||
+      resource_state.serialized_proto() != serialized_resource) {
+    return nullptr;
+  }
+  return resource_state.resource();
+}
+
 void XdsClient::XdsChannel::AdsCall::ParseResource(
     size_t idx, absl::string_view type_url, absl::string_view resource_name,
     absl::string_view serialized_resource, DecodeContext* context) {
@@ -934,12 +962,25 @@ void XdsClient::XdsChannel::AdsCall::ParseResource(
     ++context->num_invalid_resources;
     return;
   }
-  // Parse the resource.
-  XdsResourceType::DecodeContext resource_type_context = {
-      xds_client(), xds_channel()->server_, xds_client()->def_pool_.ptr(),
-      context->arena.ptr()};
-  XdsResourceType::DecodeResult decode_result =
-      context->type->Decode(resource_type_context, serialized_resource);
+  // Parse the resource. If the Resource wrapper gave us the resource's
+  // name and its bytes are those of the resource we have cached, it is the
+  // cached resource, which we already know to be valid, so we skip decoding
+  // it again.
+  XdsResourceType::DecodeResult decode_result;
+  std::shared_ptr<const XdsResourceType::ResourceData> cached_resource;
+  if (!resource_name.empty()) {
+    cached_resource = FindCachedResource(context->type, resource_name,
+                                         serialized_resource);
+  }
+  if (cached_resource != nullptr) {
+    decode_result.resource = cached_resource;
+  } else {
+    XdsResourceType::DecodeContext resource_type_context = {
+        xds_client(), xds_channel()->server_, xds_client()->def_pool_.ptr(),
+        context->arena.ptr()};
+    decode_result =
+        context->type->Decode(resource_type_context, serialized_resource);
+  }
   // If we didn't already have the resource name from the Resource
   // wrapper, try to get it from the decoding result.
   if (resource_name.empty()) {
@@ -1026,8 +1067,9 @@ void XdsClient::XdsChannel::AdsCall::ParseResource(
   // Check if the resource has changed.
   const bool resource_identical =
       resource_state.HasResource() &&
-      context->type->ResourcesEqual(resource_state.resource().get(),
-                                    decode_result.resource->get());
+      (resource_state.resource() == *decode_result.resource ||
+       context->type->ResourcesEqual(resource_state.resource().get(),
+                                     decode_result.resource->get()));
   // If not changed, keep using the current decoded resource object.
   // This should avoid wasting memory, since external watchers may be
   // holding refs to the current object.
@@ -1301,7 +1343,10 @@ void XdsClient::ResourceState::SetAcked(
     std::string serialized_proto, std::string version, Timestamp update_time) {
   resource_ = std::move(resource);
   client_status_ = ClientResourceStatus::ACKED;
-  serialized_proto_ = std::move(serialized_proto);
+  if (serialized_proto_ == nullptr || *serialized_proto_ != serialized_proto) {
+    serialized_proto_ =
+        std::make_shared<const std::string>(std::move(serialized_proto));
+  }
   update_time_ = update_time;
   version_ = std::move(version);
   failed_version_.clear();
@@ -1314,7 +1359,7 @@ void XdsClient::ResourceState::SetNacked(const std::string& version,
                                          bool drop_cached_resource) {
   if (drop_cached_resource) {
     resource_.reset();
-    serialized_proto_.clear();
+    serialized_proto_.reset();
   }
   client_status_ = ClientResourceStatus::NACKED;
   failed_status_ =
@@ -1328,7 +1373,7 @@ void XdsClient::ResourceState::SetDoesNotExistOnLdsOrCdsDeletion(
     bool drop_cached_resource) {
   if (drop_cached_resource) {
     resource_.reset();
-    serialized_proto_.clear();
+    serialized_proto_.reset();
   }
   client_status_ = ClientResourceStatus::DOES_NOT_EXIST;
   failed_status_ = absl::NotFoundError("does not exist");
@@ -1377,7 +1422,24 @@ google_protobuf_Timestamp* EncodeTimestamp(Timestamp value, upb_Arena* arena) {
 
 }  // namespace
 
-void XdsClient::ResourceState::FillGenericXdsConfig(
+void XdsClient::ResourceState::FillSnapshot(
+    ClientConfigSnapshot::Resource* snapshot) const {
+  snapshot->client_status = client_status_;
+  if (serialized_proto_ != nullptr && !serialized_proto_->empty()) {
+    snapshot->serialized_proto = serialized_proto_;
+    snapshot->version = version_;
+    snapshot->update_time = update_time_;
+  }
+  snapshot->failed_status = failed_status_;
+  snapshot->failed_version = failed_version_;
+  snapshot->failed_update_time = failed_update_time_;
+}
+
+//
+// XdsClient::ClientConfigSnapshot
+//
+
+void XdsClient::ClientConfigSnapshot::Resource::FillGenericXdsConfig(
     upb_StringView type_url, upb_StringView resource_name, upb_Arena* arena,
     envoy_service_status_v3_ClientConfig_GenericXdsConfig* entry) const {
   envoy_service_status_v3_ClientConfig_GenericXdsConfig_set_type_url(entry,
@@ -1385,28 +1447,28 @@ void XdsClient::ResourceState::FillGenericXdsConfig(
   envoy_service_status_v3_ClientConfig_GenericXdsConfig_set_name(entry,
                                                                  resource_name);
   envoy_service_status_v3_ClientConfig_GenericXdsConfig_set_client_status(
-      entry, client_status_);
-  if (!serialized_proto_.empty()) {
+      entry, client_status);
+  if (serialized_proto != nullptr) {
     envoy_service_status_v3_ClientConfig_GenericXdsConfig_set_version_info(
-        entry, StdStringToUpbString(version_));
+        entry, StdStringToUpbString(version));
     envoy_service_status_v3_ClientConfig_GenericXdsConfig_set_last_updated(
-        entry, EncodeTimestamp(update_time_, arena));
+        entry, EncodeTimestamp(update_time, arena));
     auto* any_field =
         envoy_service_status_v3_ClientConfig_GenericXdsConfig_mutable_xds_config(
             entry, arena);
     google_protobuf_Any_set_type_url(any_field, type_url);
     google_protobuf_Any_set_value(any_field,
-                                  StdStringToUpbString(serialized_proto_));
+                                  StdStringToUpbString(*serialized_proto));
   }
-  if (!failed_status_.ok()) {
+  if (!failed_status.ok()) {
     auto* update_failure_state = envoy_admin_v3_UpdateFailureState_new(arena);
     envoy_admin_v3_UpdateFailureState_set_details(
-        update_failure_state, StdStringToUpbString(failed_status_.message()));
-    if (!failed_version_.empty()) {
+        update_failure_state, StdStringToUpbString(failed_status.message()));
+    if (!failed_version.empty()) {
       envoy_admin_v3_UpdateFailureState_set_version_info(
-          update_failure_state, StdStringToUpbString(failed_version_));
+          update_failure_state, StdStringToUpbString(failed_version));
       envoy_admin_v3_UpdateFailureState_set_last_update_attempt(
-          update_failure_state, EncodeTimestamp(failed_update_time_, arena));
+          update_failure_state, EncodeTimestamp(failed_update_time, arena));
     }
     envoy_service_status_v3_ClientConfig_GenericXdsConfig_set_error_state(
         entry, update_failure_state);
@@ -1748,9 +1810,25 @@ void XdsClient::NotifyWatchersOnError(
   }
 }
 
+XdsClient::ClientConfigSnapshot XdsClient::SnapshotClientConfig() {
+  ClientConfigSnapshot snapshot;
+  for (const auto& [authority, authority_state] : authority_state_map_) {
+    for (const auto& [type, resource_map] : authority_state.resource_map) {
+      for (const auto& [resource_key, resource_state] : resource_map) {
+        auto& resource = snapshot.resources.emplace_back();
+        resource.type_url = type->type_url();
+        resource.name = ConstructFullXdsResourceName(
+            authority, type->type_url(), resource_key);
+        resource_state.FillSnapshot(&resource);
+      }
+    }
+  }
+  return snapshot;
+}
+
 void XdsClient::DumpClientConfig(
-    std::set<std::string>* string_pool, upb_Arena* arena,
-    envoy_service_status_v3_ClientConfig* client_config) {
+    const ClientConfigSnapshot& snapshot, std::set<std::string>* string_pool,
+    upb_Arena* arena, envoy_service_status_v3_ClientConfig* client_config) {
   // Assemble config dump messages
   // Fill-in the node information
   auto* node =
@@ -1758,26 +1836,17 @@ void XdsClient::DumpClientConfig(
   PopulateXdsNode(bootstrap_->node(), user_agent_name_, user_agent_version_,
                   node, arena);
   // Dump each resource.
-  for (const auto& [authority, authority_state] : authority_state_map_) {
-    for (const auto& [type, resource_map] : authority_state.resource_map) {
-      auto it =
-          string_pool
-              ->emplace(absl::StrCat("type.googleapis.com/", type->type_url()))
-              .first;
-      upb_StringView type_url = StdStringToUpbString(*it);
-      for (const auto& [resource_key, resource_state] : resource_map) {
-        auto it2 = string_pool
-                       ->emplace(ConstructFullXdsResourceName(
-                           authority, type->type_url(), resource_key))
-                       .first;
-        upb_StringView resource_name = StdStringToUpbString(*it2);
-        envoy_service_status_v3_ClientConfig_GenericXdsConfig* entry =
-            envoy_service_status_v3_ClientConfig_add_generic_xds_configs(
-                client_config, arena);
-        resource_state.FillGenericXdsConfig(type_url, resource_name, arena,
-                                            entry);
-      }
-    }
+  for (const auto& resource : snapshot.resources) {
+    auto it =
+        string_pool
+            ->emplace(absl::StrCat("type.googleapis.com/", resource.type_url))
+            .first;
+    envoy_service_status_v3_ClientConfig_GenericXdsConfig* entry =
+        envoy_service_status_v3_ClientConfig_add_generic_xds_configs(
+            client_config, arena);
+    resource.FillGenericXdsConfig(StdStringToUpbString(*it),
+                                  StdStringToUpbString(resource.name), arena,
+                                  entry);
   }
 }
 
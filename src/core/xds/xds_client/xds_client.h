@@ -140,12 +140,39 @@ class XdsClient : public DualRefCounted<XdsClient> {
 
   Mutex* mu() ABSL_LOCK_RETURNED(&mu_) { return &mu_; }
 
-  // Dumps the active xDS config to the provided
-  // envoy.service.status.v3.ClientConfig message.
-  void DumpClientConfig(std::set<std::string>* string_pool, upb_Arena* arena,
-                        envoy_service_status_v3_ClientConfig* client_config)
+  // A copy of the state of every resource, taken under mu_ so that the
+  // config dump can be encoded without holding it. Cached resources are
+  // shared with the XdsClient rather than copied.
+  struct ClientConfigSnapshot {
+    struct Resource {
+      // Points into the XdsResourceType, which is never destroyed.
+      absl::string_view type_url;
+      std::string name;
+      int32_t client_status;
+      std::shared_ptr<const std::string> serialized_proto;
+      std::string version;
+      Timestamp update_time;
+      absl::Status failed_status;
+      std::string failed_version;
+      Timestamp failed_update_time;
+
+      void FillGenericXdsConfig(
+          upb_StringView type_url, upb_StringView resource_name,
+          upb_Arena* arena,
+          envoy_service_status_v3_ClientConfig_GenericXdsConfig* entry) const;
+    };
+    std::vector<Resource> resources;
+  };
+  ClientConfigSnapshot SnapshotClientConfig()
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(&mu_);
 
+  // Dumps a snapshot of the xDS config to the provided
+  // envoy.service.status.v3.ClientConfig message. Strings referenced by
+  // the message are kept in string_pool and snapshot, which must outlive it.
+  void DumpClientConfig(const ClientConfigSnapshot& snapshot,
+                        std::set<std::string>* string_pool, upb_Arena* arena,
+                        envoy_service_status_v3_ClientConfig* client_config);
+
   // Invokes func once for each combination of labels to report the
   // resource count for those labels.
   struct ResourceCountLabels {
@@ -321,12 +348,15 @@ class XdsClient : public DualRefCounted<XdsClient> {
     std::shared_ptr<const XdsResourceType::ResourceData> resource() const {
       return resource_;
     }
+    // The serialized bytes of the cached resource, if any.
+    absl::string_view serialized_proto() const {
+      if (serialized_proto_ == nullptr) return "";
+      return *serialized_proto_;
+    }
 
     const absl::Status& failed_status() const { return failed_status_; }
 
-    void FillGenericXdsConfig(
-        upb_StringView type_url, upb_StringView resource_name, upb_Arena* arena,
-        envoy_service_status_v3_ClientConfig_GenericXdsConfig* entry) const;
+    void FillSnapshot(ClientConfigSnapshot::Resource* snapshot) const;
 
    private:
     WatcherSet watchers_;
@@ -335,7 +365,8 @@ class XdsClient : public DualRefCounted<XdsClient> {
     // Cache state.
     ClientResourceStatus client_status_ = REQUESTED;
     // The serialized bytes of the last successfully updated raw xDS resource.
-    std::string serialized_proto_;
+    // Shared with config dump snapshots.
+    std::shared_ptr<const std::string> serialized_proto_;
     // The timestamp when the resource was last successfully updated.
     Timestamp update_time_;
     // The last successfully updated version of the resource.
@@ -23,6 +23,7 @@
 #include <grpcpp/impl/completion_queue_tag.h>
 #include <grpcpp/impl/grpc_library.h>
 
+#include <algorithm>
 #include <vector>
 
 #include "absl/base/thread_annotations.h"
@@ -163,6 +164,41 @@ CompletionQueue::NextStatus CompletionQueue::AsyncNextInternal(
   }
 }
 
+CompletionQueue::NextStatus CompletionQueue::AsyncNextBatchInternal(
+    void** tags, bool* oks, size_t max_events, size_t* num_events,
+    gpr_timespec deadline) {
+  ABSL_CHECK_GT(max_events, 0u);
+  // The core events are read into a bounded array on the stack.
+  constexpr size_t kMaxEventsPerCall = 32;
+  grpc_event events[kMaxEventsPerCall];
+  *num_events = 0;
+  for (;;) {
+    size_t n = grpc_completion_queue_next_batch(
+        cq_, events, std::min(max_events, kMaxEventsPerCall), deadline,
+        nullptr);
+    switch (events[0].type) {
+      case GRPC_QUEUE_TIMEOUT:
+        return TIMEOUT;
+      case GRPC_QUEUE_SHUTDOWN:
+        return SHUTDOWN;
+      case GRPC_OP_COMPLETE:
+        break;
+    }
+    for (size_t i = 0; i < n; ++i) {
+      auto core_cq_tag =
+          static_cast<grpc::internal::CompletionQueueTag*>(events[i].tag);
+      void* tag = core_cq_tag;
+      bool ok = events[i].success != 0;
+      if (core_cq_tag->FinalizeResult(&tag, &ok)) {
+        tags[*num_events] = tag;
+        oks[*num_events] = ok;
+        ++*num_events;
+      }
+    }
+    if (*num_events > 0) return GOT_EVENT;
+  }
+}
+
 CompletionQueue::CompletionQueueTLSCache::CompletionQueueTLSCache(
     CompletionQueue* cq)
     : cq_(cq), flushed_(false) {
@@ -26,15 +26,18 @@
 #include <array>
 #include <cstdint>
 #include <optional>
+#include <string>
 #include <unordered_map>
+#include <utility>
 #include <variant>
+#include <vector>
 
-#include "absl/log/absl_check.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/escaping.h"
 #include "absl/strings/str_split.h"
 #include "absl/strings/string_view.h"
 #include "absl/strings/strip.h"
+#include "google/protobuf/struct.upb.h"
 #include "opentelemetry/sdk/resource/semantic_conventions.h"
 #include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/slice/slice_internal.h"
@@ -42,6 +45,7 @@
 #include "src/core/util/env.h"
 #include "src/cpp/ext/otel/key_value_iterable.h"
 #include "upb/base/string_view.h"
+#include "upb/mem/arena.hpp"
 
 namespace grpc {
 namespace internal {
@@ -83,18 +87,21 @@ constexpr absl::string_view kPeerCanonicalServiceAttribute =
 constexpr absl::string_view kGkeType = "gcp_kubernetes_engine";
 constexpr absl::string_view kGceType = "gcp_compute_engine";
 
-// A helper method that decodes the remote metadata \a slice as a protobuf
+// Bounds the decoded peer labels each injector caches, so that peers
+// sending ever-changing values can't grow the cache without limit.
+constexpr size_t kMaxCachedPeerLabels = 128;
+
+// A helper method that decodes the remote metadata \a value as a protobuf
 // Struct allocated on \a arena.
-google_protobuf_Struct* DecodeMetadata(grpc_core::Slice slice,
+google_protobuf_Struct* DecodeMetadata(absl::string_view value,
                                        upb_Arena* arena) {
-  // Treat an empty slice as an invalid metadata value.
-  if (slice.empty()) {
+  // Treat an empty value as an invalid metadata value.
+  if (value.empty()) {
     return nullptr;
   }
-  // Decode the slice.
+  // Decode the value.
   std::string decoded_metadata;
-  bool metadata_decoded =
-      absl::Base64Unescape(slice.as_string_view(), &decoded_metadata);
+  bool metadata_decoded = absl::Base64Unescape(value, &decoded_metadata);
   if (metadata_decoded) {
     return google_protobuf_Struct_parse(decoded_metadata.c_str(),
                                         decoded_metadata.size(), arena);
@@ -201,23 +208,31 @@ absl::Span<const RemoteAttribute> GetAttributesForType(
   }
 }
 
-std::optional<std::pair<absl::string_view, absl::string_view>>
-NextFromAttributeList(absl::Span<const RemoteAttribute> attributes,
-                      size_t start_index, size_t curr,
-                      google_protobuf_Struct* decoded_metadata,
-                      upb_Arena* arena) {
-  ABSL_DCHECK_GE(curr, start_index);
-  const size_t index = curr - start_index;
-  if (index >= attributes.size()) return std::nullopt;
-  const auto& attribute = attributes[index];
-  return std::make_pair(
-      attribute.otel_attribute,
-      GetStringValueFromUpbStruct(decoded_metadata,
-                                  attribute.metadata_attribute, arena));
-}
-
 }  // namespace
 
+//
+// MeshPeerLabels
+//
+
+MeshPeerLabels::MeshPeerLabels(absl::string_view remote_metadata) {
+  upb::Arena arena;
+  google_protobuf_Struct* struct_pb =
+      DecodeMetadata(remote_metadata, arena.ptr());
+  has_labels_ = struct_pb != nullptr;
+  auto add_labels = [&](absl::Span<const RemoteAttribute> attributes) {
+    for (const auto& attribute : attributes) {
+      labels_.emplace_back(
+          attribute.otel_attribute,
+          GetStringValueFromUpbStruct(struct_pb, attribute.metadata_attribute,
+                                      arena.ptr()));
+    }
+  };
+  add_labels(kFixedAttributes);
+  add_labels(GetAttributesForType(StringToGcpResourceType(
+      GetStringValueFromUpbStruct(struct_pb, kMetadataExchangeTypeKey,
+                                  arena.ptr()))));
+}
+
 //
 // MeshLabelsIterable
 //
@@ -225,10 +240,14 @@ NextFromAttributeList(absl::Span<const RemoteAttribute> attributes,
 MeshLabelsIterable::MeshLabelsIterable(
     const std::vector<std::pair<absl::string_view, std::string>>& local_labels,
     grpc_core::Slice remote_metadata)
-    : struct_pb_(DecodeMetadata(std::move(remote_metadata), arena_.ptr())),
-      local_labels_(local_labels),
-      remote_type_(StringToGcpResourceType(GetStringValueFromUpbStruct(
-          struct_pb_, kMetadataExchangeTypeKey, arena_.ptr()))) {}
+    : MeshLabelsIterable(local_labels,
+                         grpc_core::MakeRefCounted<MeshPeerLabels>(
+                             remote_metadata.as_string_view())) {}
+
+MeshLabelsIterable::MeshLabelsIterable(
+    const std::vector<std::pair<absl::string_view, std::string>>& local_labels,
+    grpc_core::RefCountedPtr<const MeshPeerLabels> peer_labels)
+    : local_labels_(local_labels), peer_labels_(std::move(peer_labels)) {}
 
 std::optional<std::pair<absl::string_view, absl::string_view>>
 MeshLabelsIterable::Next() {
@@ -236,20 +255,15 @@ MeshLabelsIterable::Next() {
   if (pos_ < local_labels_size) {
     return local_labels_[pos_++];
   }
-  const size_t fixed_attribute_end =
-      local_labels_size + kFixedAttributes.size();
-  if (pos_ < fixed_attribute_end) {
-    return NextFromAttributeList(kFixedAttributes, local_labels_size, pos_++,
-                                 struct_pb_, arena_.ptr());
-  }
-  return NextFromAttributeList(GetAttributesForType(remote_type_),
-                               fixed_attribute_end, pos_++, struct_pb_,
-                               arena_.ptr());
+  const auto& peer_labels = peer_labels_->labels();
+  const size_t index = pos_ - local_labels_size;
+  if (index >= peer_labels.size()) return std::nullopt;
+  ++pos_;
+  return peer_labels[index];
 }
 
 size_t MeshLabelsIterable::Size() const {
-  return local_labels_.size() + kFixedAttributes.size() +
-         GetAttributesForType(remote_type_).size();
+  return local_labels_.size() + peer_labels_->labels().size();
 }
 
 //
@@ -325,8 +339,9 @@ std::unique_ptr<LabelsIterable> ServiceMeshLabelsInjector::GetLabels(
   auto peer_metadata =
       incoming_initial_metadata->Take(grpc_core::XEnvoyPeerMetadata());
   return std::make_unique<MeshLabelsIterable>(
-      local_labels_, peer_metadata.has_value() ? *std::move(peer_metadata)
-                                               : grpc_core::Slice());
+      local_labels_,
+      GetPeerLabels(peer_metadata.has_value() ? *std::move(peer_metadata)
+                                              : grpc_core::Slice()));
 }
 
 void ServiceMeshLabelsInjector::AddLabels(
@@ -344,6 +359,24 @@ void ServiceMeshLabelsInjector::AddLabels(
                                  serialized_labels_to_send_.Ref());
 }
 
+grpc_core::RefCountedPtr<const MeshPeerLabels>
+ServiceMeshLabelsInjector::GetPeerLabels(
+    grpc_core::Slice remote_metadata) const {
+  const absl::string_view value = remote_metadata.as_string_view();
+  {
+    grpc_core::MutexLock lock(&peer_labels_mu_);
+    auto it = peer_labels_.find(value);
+    if (it != peer_labels_.end()) return it->second;
+  }
+  // Decode without holding the lock; if another call raced us, either
+  // result will do.
+  auto peer_labels = grpc_core::MakeRefCounted<MeshPeerLabels>(value);
+  grpc_core::MutexLock lock(&peer_labels_mu_);
+  if (peer_labels_.size() >= kMaxCachedPeerLabels) peer_labels_.clear();
+  peer_labels_.emplace(value, peer_labels);
+  return peer_labels;
+}
+
 bool ServiceMeshLabelsInjector::AddOptionalLabels(
     bool is_client,
     absl::Span<const grpc_core::RefCountedStringValue> optional_labels,
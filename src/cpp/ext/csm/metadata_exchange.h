@@ -26,17 +26,40 @@
 #include <utility>
 #include <vector>
 
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/strings/string_view.h"
-#include "google/protobuf/struct.upb.h"
 #include "opentelemetry/sdk/common/attribute_utils.h"
 #include "src/core/lib/slice/slice.h"
 #include "src/core/lib/transport/metadata_batch.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/sync.h"
 #include "src/cpp/ext/otel/otel_plugin.h"
-#include "upb/mem/arena.hpp"
 
 namespace grpc {
 namespace internal {
 
+// The peer labels decoded from an "x-envoy-peer-metadata" value. They are
+// immutable, so that all calls from the same peer can share them.
+class MeshPeerLabels : public grpc_core::RefCounted<MeshPeerLabels> {
+ public:
+  // An empty or malformed value gives "unknown" for the fixed labels.
+  explicit MeshPeerLabels(absl::string_view remote_metadata);
+
+  // Returns true if the value was a non-empty base64 encoded Struct.
+  bool has_labels() const { return has_labels_; }
+
+  const std::vector<std::pair<absl::string_view, std::string>>& labels()
+      const {
+    return labels_;
+  }
+
+ private:
+  bool has_labels_ = false;
+  std::vector<std::pair<absl::string_view, std::string>> labels_;
+};
+
 class ServiceMeshLabelsInjector : public LabelsInjector {
  public:
   explicit ServiceMeshLabelsInjector(
@@ -78,8 +101,18 @@ class ServiceMeshLabelsInjector : public LabelsInjector {
   }
 
  private:
+  // Returns the labels for remote_metadata, only decoding it if it is not
+  // among the values recently seen.
+  grpc_core::RefCountedPtr<const MeshPeerLabels> GetPeerLabels(
+      grpc_core::Slice remote_metadata) const;
+
   std::vector<std::pair<absl::string_view, std::string>> local_labels_;
   grpc_core::Slice serialized_labels_to_send_;
+  mutable grpc_core::Mutex peer_labels_mu_;
+  // Keyed by "x-envoy-peer-metadata" value.
+  mutable absl::flat_hash_map<std::string,
+                              grpc_core::RefCountedPtr<const MeshPeerLabels>>
+      peer_labels_ ABSL_GUARDED_BY(peer_labels_mu_);
 };
 
 // A LabelsIterable class provided by ServiceMeshLabelsInjector. EXPOSED FOR
@@ -92,6 +125,10 @@ class MeshLabelsIterable : public LabelsIterable {
       const std::vector<std::pair<absl::string_view, std::string>>&
           local_labels,
       grpc_core::Slice remote_metadata);
+  MeshLabelsIterable(
+      const std::vector<std::pair<absl::string_view, std::string>>&
+          local_labels,
+      grpc_core::RefCountedPtr<const MeshPeerLabels> peer_labels);
 
   std::optional<std::pair<absl::string_view, absl::string_view>> Next()
       override;
@@ -102,13 +139,11 @@ class MeshLabelsIterable : public LabelsIterable {
 
   // Returns true if the peer sent a non-empty base64 encoded
   // "x-envoy-peer-metadata" metadata.
-  bool GotRemoteLabels() const { return struct_pb_ != nullptr; }
+  bool GotRemoteLabels() const { return peer_labels_->has_labels(); }
 
  private:
-  upb::Arena arena_;
-  google_protobuf_Struct* struct_pb_ = nullptr;
   const std::vector<std::pair<absl::string_view, std::string>>& local_labels_;
-  GcpResourceType remote_type_ = GcpResourceType::kUnknown;
+  grpc_core::RefCountedPtr<const MeshPeerLabels> peer_labels_;
   uint32_t pos_ = 0;
 };
 
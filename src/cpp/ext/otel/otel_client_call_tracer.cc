@@ -87,6 +87,7 @@ OpenTelemetryPluginImpl::ClientCallTracer::CallAttemptTracer::CallAttemptTracer(
 
 void OpenTelemetryPluginImpl::ClientCallTracer::CallAttemptTracer::
     RecordReceivedInitialMetadata(grpc_metadata_batch* recv_initial_metadata) {
+  if (!RecordsAttemptEndMetrics()) return;
   if (recv_initial_metadata != nullptr &&
       recv_initial_metadata->get(grpc_core::GrpcTrailersOnly())
           .value_or(false)) {
@@ -112,6 +113,8 @@ void OpenTelemetryPluginImpl::ClientCallTracer::CallAttemptTracer::
 
 void OpenTelemetryPluginImpl::ClientCallTracer::CallAttemptTracer::
     RecordSendMessage(const grpc_core::Message& send_message) {
+  // Message events are only annotated on sampled calls.
+  if (!IsSampled()) return;
   RecordAnnotation(absl::StrFormat("Send message: %ld bytes",
                                    send_message.payload()->Length()));
 }
@@ -119,6 +122,7 @@ void OpenTelemetryPluginImpl::ClientCallTracer::CallAttemptTracer::
 void OpenTelemetryPluginImpl::ClientCallTracer::CallAttemptTracer::
     RecordSendCompressedMessage(
         const grpc_core::Message& send_compressed_message) {
+  if (!IsSampled()) return;
   RecordAnnotation(
       absl::StrFormat("Send compressed message: %ld bytes",
                       send_compressed_message.payload()->Length()));
@@ -126,6 +130,7 @@ void OpenTelemetryPluginImpl::ClientCallTracer::CallAttemptTracer::
 
 void OpenTelemetryPluginImpl::ClientCallTracer::CallAttemptTracer::
     RecordReceivedMessage(const grpc_core::Message& recv_message) {
+  if (!IsSampled()) return;
   RecordAnnotation(absl::StrFormat("Received message: %ld bytes",
                                    recv_message.payload()->Length()));
 }
@@ -133,6 +138,7 @@ void OpenTelemetryPluginImpl::ClientCallTracer::CallAttemptTracer::
 void OpenTelemetryPluginImpl::ClientCallTracer::CallAttemptTracer::
     RecordReceivedDecompressedMessage(
         const grpc_core::Message& recv_decompressed_message) {
+  if (!IsSampled()) return;
   RecordAnnotation(
       absl::StrFormat("Received decompressed message: %ld bytes",
                       recv_decompressed_message.payload()->Length()));
@@ -142,6 +148,7 @@ void OpenTelemetryPluginImpl::ClientCallTracer::CallAttemptTracer::
     RecordReceivedTrailingMetadata(
         absl::Status status, grpc_metadata_batch* recv_trailing_metadata,
         const grpc_transport_stream_stats* transport_stream_stats) {
+  if (!RecordsAttemptEndMetrics()) return;
   if (is_trailers_only_) {
     PopulateLabelInjectors(recv_trailing_metadata);
   }
@@ -228,6 +235,14 @@ void OpenTelemetryPluginImpl::ClientCallTracer::CallAttemptTracer::
   optional_labels_[static_cast<size_t>(key)] = std::move(value);
 }
 
+bool OpenTelemetryPluginImpl::ClientCallTracer::CallAttemptTracer::
+    RecordsAttemptEndMetrics() const {
+  const auto& attempt = parent_->otel_plugin_->client_.attempt;
+  return attempt.duration != nullptr ||
+         attempt.sent_total_compressed_message_size != nullptr ||
+         attempt.rcvd_total_compressed_message_size != nullptr;
+}
+
 void OpenTelemetryPluginImpl::ClientCallTracer::CallAttemptTracer::
     PopulateLabelInjectors(grpc_metadata_batch* metadata) {
   parent_->scope_config_->active_plugin_options_view().ForEach(
@@ -97,6 +97,9 @@ class OpenTelemetryPluginImpl::ClientCallTracer
 
    private:
     void PopulateLabelInjectors(grpc_metadata_batch* metadata);
+    // Returns true if any metric recorded at the end of the attempt is
+    // enabled, i.e. if the labels received from the server are needed.
+    bool RecordsAttemptEndMetrics() const;
 
     const ClientCallTracer* parent_;
     const bool arena_allocated_;
@@ -23,8 +23,10 @@
 #include <grpcpp/version_info.h>
 
 #include <memory>
+#include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "absl/log/absl_check.h"
 #include "opentelemetry/metrics/meter.h"
@@ -39,6 +41,9 @@
 #include "src/core/lib/surface/channel_stack_type.h"
 #include "src/core/telemetry/call_tracer.h"
 #include "src/core/util/match.h"
+#include "src/core/util/per_cpu.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/time.h"
 #include "src/cpp/ext/otel/key_value_iterable.h"
 #include "src/cpp/ext/otel/otel_client_call_tracer.h"
 #include "src/cpp/ext/otel/otel_server_call_tracer.h"
@@ -139,6 +144,91 @@ class OpenTelemetryPluginImpl::NPCMetricsKeyValueIterable
   const OptionalLabelsBitSet& optional_labels_bits_;
 };
 
+// A histogram with its attributes resolved at bind time. Values are
+// buffered per CPU and recorded in batches, so that threads recording to the
+// same histogram do not contend on the OpenTelemetry storage for each value.
+// A batch is recorded once it is full, once it is a second old when the next
+// value arrives, or when the bound histogram is destroyed.
+template <typename T>
+class OpenTelemetryPluginImpl::BoundHistogramImpl final
+    : public grpc_core::StatsPlugin::BoundHistogram {
+ public:
+  BoundHistogramImpl(
+      opentelemetry::metrics::Histogram<T>* histogram,
+      const grpc_core::GlobalInstrumentsRegistry::GlobalInstrumentDescriptor&
+          descriptor,
+      absl::Span<const absl::string_view> label_values,
+      absl::Span<const absl::string_view> optional_label_values,
+      const OptionalLabelsBitSet& optional_labels_bits)
+      : histogram_(histogram),
+        label_keys_(descriptor.label_keys.begin(),
+                    descriptor.label_keys.end()),
+        optional_label_keys_(descriptor.optional_label_keys.begin(),
+                             descriptor.optional_label_keys.end()),
+        optional_labels_bits_(optional_labels_bits),
+        label_values_(label_values.begin(), label_values.end()),
+        optional_label_values_(optional_label_values.begin(),
+                               optional_label_values.end()),
+        label_value_views_(label_values_.begin(), label_values_.end()),
+        optional_label_value_views_(optional_label_values_.begin(),
+                                    optional_label_values_.end()) {}
+
+  ~BoundHistogramImpl() override {
+    for (Shard& shard : shards_) {
+      grpc_core::MutexLock lock(&shard.mu);
+      FlushLocked(shard);
+    }
+  }
+
+  void Record(uint64_t value) override { Buffer(static_cast<T>(value)); }
+  void Record(double value) override { Buffer(static_cast<T>(value)); }
+
+ private:
+  static constexpr size_t kMaxBufferedValues = 64;
+  static constexpr grpc_core::Duration kMaxBufferedAge =
+      grpc_core::Duration::Seconds(1);
+
+  struct Shard {
+    grpc_core::Mutex mu;
+    std::vector<T> values ABSL_GUARDED_BY(mu);
+    grpc_core::Timestamp first_buffered ABSL_GUARDED_BY(mu);
+  };
+
+  void Buffer(T value) {
+    const grpc_core::Timestamp now = grpc_core::Timestamp::Now();
+    Shard& shard = shards_.this_cpu();
+    grpc_core::MutexLock lock(&shard.mu);
+    if (shard.values.empty()) shard.first_buffered = now;
+    shard.values.push_back(value);
+    if (shard.values.size() >= kMaxBufferedValues ||
+        now - shard.first_buffered >= kMaxBufferedAge) {
+      FlushLocked(shard);
+    }
+  }
+
+  void FlushLocked(Shard& shard) ABSL_EXCLUSIVE_LOCKS_REQUIRED(shard.mu) {
+    if (shard.values.empty()) return;
+    NPCMetricsKeyValueIterable attributes(
+        label_keys_, label_value_views_, optional_label_keys_,
+        optional_label_value_views_, optional_labels_bits_);
+    for (T value : shard.values) {
+      histogram_->Record(value, attributes, opentelemetry::context::Context{});
+    }
+    shard.values.clear();
+  }
+
+  opentelemetry::metrics::Histogram<T>* const histogram_;
+  const std::vector<absl::string_view> label_keys_;
+  const std::vector<absl::string_view> optional_label_keys_;
+  const OptionalLabelsBitSet& optional_labels_bits_;
+  const std::vector<std::string> label_values_;
+  const std::vector<std::string> optional_label_values_;
+  const std::vector<absl::string_view> label_value_views_;
+  const std::vector<absl::string_view> optional_label_value_views_;
+  grpc_core::PerCpu<Shard> shards_{
+      grpc_core::PerCpuOptions().SetCpusPerShard(4).SetMaxShards(32)};
+};
+
 //
 // OpenTelemetryPluginBuilderImpl
 //
@@ -794,6 +884,37 @@ void OpenTelemetryPluginImpl::RecordHistogram(
   }
 }
 
+std::unique_ptr<grpc_core::StatsPlugin::BoundHistogram>
+OpenTelemetryPluginImpl::BindHistogram(
+    grpc_core::GlobalInstrumentsRegistry::GlobalInstrumentHandle handle,
+    absl::Span<const absl::string_view> label_values,
+    absl::Span<const absl::string_view> optional_values) {
+  const auto& instrument_data = instruments_data_.at(handle.index);
+  const auto& descriptor =
+      grpc_core::GlobalInstrumentsRegistry::GetInstrumentDescriptor(handle);
+  ABSL_CHECK(descriptor.label_keys.size() == label_values.size());
+  ABSL_CHECK(descriptor.optional_label_keys.size() == optional_values.size());
+  if (const auto* histogram = std::get_if<
+          std::unique_ptr<opentelemetry::metrics::Histogram<uint64_t>>>(
+          &instrument_data.instrument)) {
+    return std::make_unique<BoundHistogramImpl<uint64_t>>(
+        histogram->get(), descriptor, label_values, optional_values,
+        instrument_data.optional_labels_bits);
+  }
+  if (const auto* histogram = std::get_if<
+          std::unique_ptr<opentelemetry::metrics::Histogram<double>>>(
+          &instrument_data.instrument)) {
+    return std::make_unique<BoundHistogramImpl<double>>(
+        histogram->get(), descriptor, label_values, optional_values,
+        instrument_data.optional_labels_bits);
+  }
+  // This instrument is disabled, so records are dropped by
+  // RecordHistogram().
+  ABSL_CHECK(std::holds_alternative<Disabled>(instrument_data.instrument));
+  return grpc_core::StatsPlugin::BindHistogram(handle, label_values,
+                                               optional_values);
+}
+
 void OpenTelemetryPluginImpl::AddCallback(
     grpc_core::RegisteredMetricCallback* callback) {
   std::vector<
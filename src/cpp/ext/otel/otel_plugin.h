@@ -224,6 +224,8 @@ class OpenTelemetryPluginImpl
   ~OpenTelemetryPluginImpl() override;
 
  private:
+  template <typename T>
+  class BoundHistogramImpl;
   class ClientCallTracer;
   class KeyValueIterable;
   class NPCMetricsKeyValueIterable;
@@ -419,6 +421,10 @@ class OpenTelemetryPluginImpl
       grpc_core::GlobalInstrumentsRegistry::GlobalInstrumentHandle handle,
       double value, absl::Span<const absl::string_view> label_values,
       absl::Span<const absl::string_view> optional_values) override;
+  std::unique_ptr<grpc_core::StatsPlugin::BoundHistogram> BindHistogram(
+      grpc_core::GlobalInstrumentsRegistry::GlobalInstrumentHandle handle,
+      absl::Span<const absl::string_view> label_values,
+      absl::Span<const absl::string_view> optional_values) override;
   void AddCallback(grpc_core::RegisteredMetricCallback* callback)
       ABSL_LOCKS_EXCLUDED(mu_) override;
   void RemoveCallback(grpc_core::RegisteredMetricCallback* callback)
@@ -105,6 +105,13 @@ void OpenTelemetryPluginImpl::ServerCallTracer::RecordSendTrailingMetadata(
 
 void OpenTelemetryPluginImpl::ServerCallTracer::RecordEnd(
     const grpc_call_final_info* final_info) {
+  if (otel_plugin_->server_.call.duration == nullptr &&
+      otel_plugin_->server_.call.sent_total_compressed_message_size ==
+          nullptr &&
+      otel_plugin_->server_.call.rcvd_total_compressed_message_size ==
+          nullptr) {
+    return;
+  }
   std::array<std::pair<absl::string_view, absl::string_view>, 2>
       additional_labels = {
           {{OpenTelemetryMethodKey(), MethodForStats()},
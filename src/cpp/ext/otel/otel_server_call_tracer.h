@@ -67,11 +67,14 @@ class OpenTelemetryPluginImpl::ServerCallTracer
       grpc_metadata_batch* /*send_trailing_metadata*/) override;
 
   void RecordSendMessage(const grpc_core::Message& send_message) override {
+    // Message events are only annotated on sampled calls.
+    if (!IsSampled()) return;
     RecordAnnotation(absl::StrFormat("Send message: %ld bytes",
                                      send_message.payload()->Length()));
   }
   void RecordSendCompressedMessage(
       const grpc_core::Message& send_compressed_message) override {
+    if (!IsSampled()) return;
     RecordAnnotation(
         absl::StrFormat("Send compressed message: %ld bytes",
                         send_compressed_message.payload()->Length()));
@@ -81,11 +84,13 @@ class OpenTelemetryPluginImpl::ServerCallTracer
       grpc_metadata_batch* recv_initial_metadata) override;
 
   void RecordReceivedMessage(const grpc_core::Message& recv_message) override {
+    if (!IsSampled()) return;
     RecordAnnotation(absl::StrFormat("Received message: %ld bytes",
                                      recv_message.payload()->Length()));
   }
   void RecordReceivedDecompressedMessage(
       const grpc_core::Message& recv_decompressed_message) override {
+    if (!IsSampled()) return;
     RecordAnnotation(
         absl::StrFormat("Received decompressed message: %ld bytes",
                         recv_decompressed_message.payload()->Length()));
@@ -20,6 +20,21 @@
 #include <grpcpp/ext/admin_services.h>
 #include <grpcpp/server_builder.h>
 
+#ifdef GRPC_ENABLE_LATENT_SEE
+#include <grpcpp/impl/rpc_method.h>
+#include <grpcpp/impl/rpc_service_method.h>
+#include <grpcpp/impl/service_type.h>
+#include <grpcpp/server_context.h>
+#include <grpcpp/support/byte_buffer.h>
+#include <grpcpp/support/method_handler.h>
+#include <grpcpp/support/status.h>
+
+#include <optional>
+#include <string>
+
+#include "src/core/util/latent_see.h"
+#endif  // GRPC_ENABLE_LATENT_SEE
+
 // TODO(lidiz) build a real registration system that can pull in services
 // automatically with minimum amount of code.
 #include "src/cpp/server/channelz/channelz_service.h"
@@ -30,10 +45,46 @@ namespace grpc {
 
 namespace {
 
+#ifdef GRPC_ENABLE_LATENT_SEE
+// Dumps the events that latent_see has captured since the last dump, in the
+// format of grpc_core::latent_see::Log::TryGenerateBinary(). The method
+// takes and returns raw bytes, so that it needs no generated code; the
+// request is ignored.
+class LatentSeeService final : public Service {
+ public:
+  LatentSeeService() {
+    AddMethod(new internal::RpcServiceMethod(
+        "/grpc.latent_see.v1.LatentSee/GetTrace",
+        internal::RpcMethod::NORMAL_RPC,
+        new internal::RpcMethodHandler<LatentSeeService, ByteBuffer,
+                                       ByteBuffer>(
+            [](LatentSeeService*, ServerContext*, const ByteBuffer*,
+               ByteBuffer* response) { return GetTrace(response); },
+            this)));
+  }
+
+ private:
+  static Status GetTrace(ByteBuffer* response) {
+    std::optional<std::string> trace =
+        grpc_core::latent_see::Log::Get().TryGenerateBinary();
+    if (!trace.has_value()) {
+      return Status(StatusCode::UNAVAILABLE,
+                    "another latent_see dump is in progress");
+    }
+    Slice slice(*trace);
+    *response = ByteBuffer(&slice, 1);
+    return Status::OK;
+  }
+};
+#endif  // GRPC_ENABLE_LATENT_SEE
+
 auto* g_channelz_service = new ChannelzService();
 #if !defined(GRPC_NO_XDS) && !defined(DISABLED_XDS_PROTO_IN_CC)
 auto* g_csds = new xds::experimental::ClientStatusDiscoveryService();
 #endif  // GRPC_NO_XDS or DISABLED_XDS_PROTO_IN_CC
+#ifdef GRPC_ENABLE_LATENT_SEE
+auto* g_latent_see_service = new LatentSeeService();
+#endif  // GRPC_ENABLE_LATENT_SEE
 
 }  // namespace
 
@@ -42,6 +93,9 @@ void AddAdminServices(ServerBuilder* builder) {
 #if !defined(GRPC_NO_XDS) && !defined(DISABLED_XDS_PROTO_IN_CC)
   builder->RegisterService(g_csds);
 #endif  // GRPC_NO_XDS or DISABLED_XDS_PROTO_IN_CC
+#ifdef GRPC_ENABLE_LATENT_SEE
+  builder->RegisterService(g_latent_see_service);
+#endif  // GRPC_ENABLE_LATENT_SEE
 }
 
 }  // namespace grpc
@@ -44,6 +44,8 @@ bool IsUtilizationValid(double utilization) {
 // Rate values (qps and eps) must be in [0, infy).
 bool IsRateValid(double rate) { return rate >= 0.0; }
 
+std::atomic<uint64_t> g_next_server_metric_recorder_id{1};
+
 }  // namespace
 
 namespace grpc {
@@ -54,7 +56,9 @@ std::unique_ptr<ServerMetricRecorder> ServerMetricRecorder::Create() {
 }
 
 ServerMetricRecorder::ServerMetricRecorder()
-    : metric_state_(std::make_shared<const BackendMetricDataState>()) {}
+    : id_(g_next_server_metric_recorder_id.fetch_add(
+          1, std::memory_order_relaxed)),
+      metric_state_(std::make_shared<const BackendMetricDataState>()) {}
 
 void ServerMetricRecorder::UpdateBackendMetricDataState(
     std::function<void(BackendMetricData*)> updater) {
@@ -62,6 +66,7 @@ void ServerMetricRecorder::UpdateBackendMetricDataState(
   auto new_state = std::make_shared<BackendMetricDataState>(*metric_state_);
   updater(&new_state->data);
   ++new_state->sequence_number;
+  sequence_number_.store(new_state->sequence_number, std::memory_order_release);
   metric_state_ = std::move(new_state);
 }
 
@@ -221,8 +226,38 @@ ServerMetricRecorder::GetMetricsIfChanged() const {
   return result;
 }
 
+const ServerMetricRecorder::BackendMetricDataState&
+ServerMetricRecorder::GetMetricsForCurrentThread() const {
+  struct Snapshot {
+    uint64_t recorder_id = 0;
+    std::shared_ptr<const BackendMetricDataState> state;
+  };
+  static thread_local Snapshot snapshot;
+  // Sequence numbers only grow, so a matching one means the snapshot holds
+  // exactly the current data.
+  if (snapshot.recorder_id != id_ ||
+      snapshot.state->sequence_number !=
+          sequence_number_.load(std::memory_order_acquire)) {
+    internal::MutexLock lock(&mu_);
+    snapshot.recorder_id = id_;
+    snapshot.state = metric_state_;
+  }
+  return *snapshot.state;
+}
+
 }  // namespace experimental
 
+void BackendMetricState::SetMetric(absl::string_view name, double value,
+                                   Metrics* metrics) {
+  for (auto& metric : *metrics) {
+    if (metric.first == name) {
+      metric.second = value;
+      return;
+    }
+  }
+  metrics->emplace_back(name, value);
+}
+
 experimental::CallMetricRecorder&
 BackendMetricState::RecordCpuUtilizationMetric(double value) {
   if (!IsUtilizationWithSoftLimitsValid(value)) {
@@ -298,7 +333,7 @@ experimental::CallMetricRecorder& BackendMetricState::RecordUtilizationMetric(
   }
   internal::MutexLock lock(&mu_);
   absl::string_view name_sv(name.data(), name.length());
-  utilization_[name_sv] = value;
+  SetMetric(name_sv, value, &utilization_);
   GRPC_TRACE_LOG(backend_metric, INFO)
       << "[" << this << "] Utilization recorded: " << name_sv << " " << value;
   return *this;
@@ -308,7 +343,7 @@ experimental::CallMetricRecorder& BackendMetricState::RecordRequestCostMetric(
     string_ref name, double value) {
   internal::MutexLock lock(&mu_);
   absl::string_view name_sv(name.data(), name.length());
-  request_cost_[name_sv] = value;
+  SetMetric(name_sv, value, &request_cost_);
   GRPC_TRACE_LOG(backend_metric, INFO)
       << "[" << this << "] Request cost recorded: " << name_sv << " " << value;
   return *this;
@@ -318,7 +353,7 @@ experimental::CallMetricRecorder& BackendMetricState::RecordNamedMetric(
     string_ref name, double value) {
   internal::MutexLock lock(&mu_);
   absl::string_view name_sv(name.data(), name.length());
-  named_metrics_[name_sv] = value;
+  SetMetric(name_sv, value, &named_metrics_);
   GRPC_TRACE_LOG(backend_metric, INFO)
       << "[" << this << "] Named metric recorded: " << name_sv << " " << value;
   return *this;
@@ -329,7 +364,7 @@ BackendMetricData BackendMetricState::GetBackendMetricData() {
   // to CallMetricRecorder takes a higher precedence.
   BackendMetricData data;
   if (server_metric_recorder_ != nullptr) {
-    data = server_metric_recorder_->GetMetrics();
+    data = server_metric_recorder_->GetMetricsForCurrentThread().data;
   }
   // Only overwrite if the value is set i.e. in the valid range.
   const double cpu = cpu_utilization_.load(std::memory_order_relaxed);
@@ -26,9 +26,10 @@
 #include <stdint.h>
 
 #include <atomic>
-#include <map>
+#include <utility>
 
 #include "absl/base/thread_annotations.h"
+#include "absl/container/inlined_vector.h"
 #include "absl/strings/string_view.h"
 #include "src/core/ext/filters/backend_metrics/backend_metric_provider.h"
 #include "src/core/load_balancing/backend_metric_data.h"
@@ -70,6 +71,14 @@ class BackendMetricState : public grpc_core::BackendMetricProvider,
   grpc_core::BackendMetricData GetBackendMetricData() override;
 
  private:
+  // Calls record a handful of metrics at most, so a linear scan over inline
+  // storage beats a node-based map.
+  using Metrics =
+      absl::InlinedVector<std::pair<absl::string_view, double>, 4>;
+
+  static void SetMetric(absl::string_view name, double value,
+                        Metrics* metrics);
+
   experimental::ServerMetricRecorder* server_metric_recorder_;
   std::atomic<double> cpu_utilization_{-1.0};
   std::atomic<double> mem_utilization_{-1.0};
@@ -77,9 +86,9 @@ class BackendMetricState : public grpc_core::BackendMetricProvider,
   std::atomic<double> qps_{-1.0};
   std::atomic<double> eps_{-1.0};
   internal::Mutex mu_;
-  std::map<absl::string_view, double> utilization_ ABSL_GUARDED_BY(mu_);
-  std::map<absl::string_view, double> request_cost_ ABSL_GUARDED_BY(mu_);
-  std::map<absl::string_view, double> named_metrics_ ABSL_GUARDED_BY(mu_);
+  Metrics utilization_ ABSL_GUARDED_BY(mu_);
+  Metrics request_cost_ ABSL_GUARDED_BY(mu_);
+  Metrics named_metrics_ ABSL_GUARDED_BY(mu_);
 };
 
 }  // namespace grpc
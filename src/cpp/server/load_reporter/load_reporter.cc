@@ -400,6 +400,9 @@ void LoadReporter::ProcessViewDataCallStart(
     const CensusViewProvider::ViewDataMap& view_data_map) {
   auto it = view_data_map.find(kViewStartCount);
   if (it != view_data_map.end()) {
+    // Rows arrive already aggregated per fetch, so the store is locked once
+    // for the whole view rather than once per row.
+    grpc_core::MutexLock lock(&store_mu_);
     for (const auto& p : it->second.int_data()) {
       const std::vector<std::string>& tag_values = p.first;
       const uint64_t start_count = static_cast<uint64_t>(p.second);
@@ -408,10 +411,7 @@ void LoadReporter::ProcessViewDataCallStart(
       const std::string& user_id = tag_values[2];
       LoadRecordKey key(client_ip_and_token, user_id);
       LoadRecordValue value = LoadRecordValue(start_count);
-      {
-        grpc_core::MutexLock lock(&store_mu_);
-        load_data_store_.MergeRow(host, key, value);
-      }
+      load_data_store_.MergeRow(host, key, value);
     }
   }
 }
@@ -422,6 +422,7 @@ void LoadReporter::ProcessViewDataCallEnd(
   uint64_t total_error_count = 0;
   auto it = view_data_map.find(kViewEndCount);
   if (it != view_data_map.end()) {
+    grpc_core::MutexLock lock(&store_mu_);
     for (const auto& p : it->second.int_data()) {
       const std::vector<std::string>& tag_values = p.first;
       const uint64_t end_count = static_cast<uint64_t>(p.second);
@@ -459,10 +460,7 @@ void LoadReporter::ProcessViewDataCallEnd(
       }
       LoadRecordValue value = LoadRecordValue(
           0, ok_count, error_count, bytes_sent, bytes_received, latency_ms);
-      {
-        grpc_core::MutexLock lock(&store_mu_);
-        load_data_store_.MergeRow(host, key, value);
-      }
+      load_data_store_.MergeRow(host, key, value);
     }
   }
   AppendNewFeedbackRecord(total_end_count, total_error_count);
@@ -472,6 +470,7 @@ void LoadReporter::ProcessViewDataOtherCallMetrics(
     const CensusViewProvider::ViewDataMap& view_data_map) {
   auto it = view_data_map.find(kViewOtherCallMetricCount);
   if (it != view_data_map.end()) {
+    grpc_core::MutexLock lock(&store_mu_);
     for (const auto& p : it->second.int_data()) {
       const std::vector<std::string>& tag_values = p.first;
       const int64_t num_calls = p.second;
@@ -486,10 +485,7 @@ void LoadReporter::ProcessViewDataOtherCallMetrics(
               sizeof(kViewOtherCallMetricValue) - 1, tag_values);
       LoadRecordValue value = LoadRecordValue(
           metric_name, static_cast<uint64_t>(num_calls), total_metric_value);
-      {
-        grpc_core::MutexLock lock(&store_mu_);
-        load_data_store_.MergeRow(host, key, value);
-      }
+      load_data_store_.MergeRow(host, key, value);
     }
   }
 }
@@ -18,7 +18,12 @@
 
 #include "src/cpp/thread_manager/thread_manager.h"
 
+#include <grpc/support/cpu.h>
+#include <grpc/support/port_platform.h>
+#include <grpc/support/time.h>
+
 #include <climits>
+#include <cmath>
 
 #include "absl/log/absl_check.h"
 #include "absl/log/absl_log.h"
@@ -28,8 +33,37 @@
 #include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/thd.h"
 
+#ifdef GPR_POSIX_TIME
+#include <time.h>
+#endif
+
 namespace grpc {
 
+namespace {
+
+// The weight of each new DoWork() call in the averages used for adaptive
+// sizing
+constexpr double kWorkTimeSmoothing = 0.1;
+
+double WallSeconds() {
+  gpr_timespec now = gpr_now(GPR_CLOCK_MONOTONIC);
+  return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+// Returns the CPU time used so far by the calling thread, or a negative
+// value where that cannot be measured.
+double ThreadCpuSeconds() {
+#if defined(GPR_POSIX_TIME) && defined(CLOCK_THREAD_CPUTIME_ID)
+  timespec now;
+  if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now) == 0) {
+    return now.tv_sec + now.tv_nsec * 1e-9;
+  }
+#endif
+  return -1;
+}
+
+}  // namespace
+
 ThreadManager::WorkerThread::WorkerThread(ThreadManager* thd_mgr)
     : thd_mgr_(thd_mgr) {
   // Make thread creation exclusive with respect to its join happening in
@@ -124,6 +158,36 @@ void ThreadManager::CleanupCompletedThreads() {
   for (auto thd : completed_threads) delete thd;
 }
 
+void ThreadManager::EnableAdaptiveSizing() {
+  if (ThreadCpuSeconds() < 0) return;
+  grpc_core::MutexLock lock(&mu_);
+  adaptive_sizing_ = true;
+}
+
+void ThreadManager::RecordWorkTimeLocked(double wall_seconds,
+                                         double cpu_seconds) {
+  if (avg_work_wall_time_ == 0) {
+    avg_work_wall_time_ = wall_seconds;
+    avg_work_cpu_time_ = cpu_seconds;
+    return;
+  }
+  avg_work_wall_time_ +=
+      kWorkTimeSmoothing * (wall_seconds - avg_work_wall_time_);
+  avg_work_cpu_time_ +=
+      kWorkTimeSmoothing * (cpu_seconds - avg_work_cpu_time_);
+}
+
+bool ThreadManager::AtAdaptiveThreadLimitLocked() const {
+  // Until some CPU time has been measured, there is nothing to size by.
+  if (!adaptive_sizing_ || avg_work_cpu_time_ <= 0) return false;
+  // By Little's law, keeping every CPU busy takes as many calls in DoWork()
+  // as there are CPUs, scaled by the ratio of a call's wall time to its CPU
+  // time. The pollers come on top of that.
+  const double busy_threads =
+      gpr_cpu_num_cores() * avg_work_wall_time_ / avg_work_cpu_time_;
+  return num_threads_ - min_pollers_ >= std::ceil(busy_threads);
+}
+
 void ThreadManager::Initialize() {
   if (!thread_quota_->Reserve(min_pollers_)) {
     grpc_core::Crash(absl::StrFormat(
@@ -170,7 +234,9 @@ void ThreadManager::MainWorkLoop() {
         // If we got work and there are now insufficient pollers and there is
         // quota available to create a new thread, start a new poller thread
         bool resource_exhausted = false;
-        if (!shutdown_ && num_pollers_ < min_pollers_) {
+        const bool measure_work = adaptive_sizing_;
+        if (!shutdown_ && num_pollers_ < min_pollers_ &&
+            !AtAdaptiveThreadLimitLocked()) {
           if (thread_quota_->Reserve(1)) {
             // We can allocate a new poller thread
             num_pollers_++;
@@ -203,16 +269,23 @@ void ThreadManager::MainWorkLoop() {
             resource_exhausted = true;
           }
         } else {
-          // There are a sufficient number of pollers available so we can do
-          // the work and continue polling with our existing poller threads
+          // There are a sufficient number of pollers available (or, with
+          // adaptive sizing, enough threads to keep the CPUs busy) so we can
+          // do the work and continue polling with our existing poller threads
           lock.Release();
         }
         // Lock is always released at this point - do the application work
         // or return resource exhausted if there is new work but we couldn't
         // get a thread in which to do it.
+        const double wall_start = measure_work ? WallSeconds() : 0;
+        const double cpu_start = measure_work ? ThreadCpuSeconds() : 0;
         DoWork(tag, ok, !resource_exhausted);
         // Take the lock again to check post conditions
         lock.Lock();
+        if (measure_work) {
+          RecordWorkTimeLocked(WallSeconds() - wall_start,
+                               ThreadCpuSeconds() - cpu_start);
+        }
         // If we're shutdown, we should finish at this point.
         if (shutdown_) done = true;
         break;
@@ -37,6 +37,15 @@ class ThreadManager {
   // Initializes and Starts the Rpc Manager threads
   void Initialize();
 
+  // Caps the number of threads at the number needed to keep the CPUs busy,
+  // as estimated from the wall and CPU time that DoWork() has been taking:
+  // with handlers that spend most of their time blocked, more threads are
+  // needed to use the CPUs, and with CPU-bound handlers, threads beyond the
+  // number of CPUs only add contention. Work found beyond the cap waits for
+  // a thread to finish its work instead. Has no effect where the CPU time
+  // of a thread cannot be measured. Must be called before Initialize().
+  void EnableAdaptiveSizing();
+
   // The return type of PollForWork() function
   enum WorkStatus { WORK_FOUND, SHUTDOWN, TIMEOUT };
 
@@ -139,6 +148,12 @@ class ThreadManager {
   void MarkAsCompleted(WorkerThread* thd);
   void CleanupCompletedThreads();
 
+  // Folds the wall and CPU time of one DoWork() call into the averages
+  // used for adaptive sizing
+  void RecordWorkTimeLocked(double wall_seconds, double cpu_seconds);
+  // Whether adaptive sizing rules out starting another thread
+  bool AtAdaptiveThreadLimitLocked() const;
+
   // Protects shutdown_, num_pollers_, num_threads_ and
   // max_active_threads_sofar_
   grpc_core::Mutex mu_;
@@ -170,6 +185,12 @@ class ThreadManager {
   // ever set so far
   int max_active_threads_sofar_;
 
+  // See EnableAdaptiveSizing(). The averages are exponentially weighted
+  // moving averages of the wall and CPU time of DoWork() calls, in seconds.
+  bool adaptive_sizing_ = false;
+  double avg_work_wall_time_ = 0;
+  double avg_work_cpu_time_ = 0;
+
   grpc_core::Mutex list_mu_;
   std::list<WorkerThread*> completed_threads_;
 };
@@ -69,6 +69,7 @@ CORE_SOURCE_FILES = [
     'src/core/ext/transport/chttp2/transport/call_tracer_wrapper.cc',
     'src/core/ext/transport/chttp2/transport/chttp2_transport.cc',
     'src/core/ext/transport/chttp2/transport/decode_huff.cc',
+    'src/core/ext/transport/chttp2/transport/decode_huff_multi.cc',
     'src/core/ext/transport/chttp2/transport/flow_control.cc',
     'src/core/ext/transport/chttp2/transport/frame.cc',
     'src/core/ext/transport/chttp2/transport/frame_data.cc',
@@ -85,6 +86,7 @@ CORE_SOURCE_FILES = [
     'src/core/ext/transport/chttp2/transport/hpack_parser_table.cc',
     'src/core/ext/transport/chttp2/transport/http2_settings.cc',
     'src/core/ext/transport/chttp2/transport/huffsyms.cc',
+    'src/core/ext/transport/chttp2/transport/keepalive_ticker.cc',
     'src/core/ext/transport/chttp2/transport/parsing.cc',
     'src/core/ext/transport/chttp2/transport/ping_abuse_policy.cc',
     'src/core/ext/transport/chttp2/transport/ping_callbacks.cc',
@@ -437,12 +439,16 @@ CORE_SOURCE_FILES = [
     'src/core/lib/channel/connected_channel.cc',
     'src/core/lib/channel/promise_based_filter.cc',
     'src/core/lib/channel/status_util.cc',
+    'src/core/lib/compression/adaptive_compression.cc',
     'src/core/lib/compression/compression.cc',
+    'src/core/lib/compression/compression_dictionary.cc',
+    'src/core/lib/compression/compression_engine.cc',
     'src/core/lib/compression/compression_internal.cc',
     'src/core/lib/compression/message_compress.cc',
     'src/core/lib/debug/trace.cc',
     'src/core/lib/debug/trace_flags.cc',
     'src/core/lib/event_engine/ares_resolver.cc',
+    'src/core/lib/event_engine/caching_dns_resolver.cc',
     'src/core/lib/event_engine/cf_engine/cf_engine.cc',
     'src/core/lib/event_engine/cf_engine/cfstream_endpoint.cc',
     'src/core/lib/event_engine/cf_engine/dns_service_resolver.cc',
@@ -452,6 +458,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/event_engine/event_engine.cc',
     'src/core/lib/event_engine/forkable.cc',
     'src/core/lib/event_engine/posix_engine/ev_epoll1_linux.cc',
+    'src/core/lib/event_engine/posix_engine/ev_io_uring_linux.cc',
     'src/core/lib/event_engine/posix_engine/ev_poll_posix.cc',
     'src/core/lib/event_engine/posix_engine/event_poller_posix_default.cc',
     'src/core/lib/event_engine/posix_engine/internal_errqueue.cc',
@@ -465,6 +472,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/event_engine/posix_engine/timer.cc',
     'src/core/lib/event_engine/posix_engine/timer_heap.cc',
     'src/core/lib/event_engine/posix_engine/timer_manager.cc',
+    'src/core/lib/event_engine/posix_engine/timer_wheel.cc',
     'src/core/lib/event_engine/posix_engine/traced_buffer_list.cc',
     'src/core/lib/event_engine/posix_engine/wakeup_fd_eventfd.cc',
     'src/core/lib/event_engine/posix_engine/wakeup_fd_pipe.cc',
@@ -489,6 +497,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/event_engine/windows/windows_engine.cc',
     'src/core/lib/event_engine/windows/windows_listener.cc',
     'src/core/lib/event_engine/work_queue/basic_work_queue.cc',
+    'src/core/lib/event_engine/work_queue/lock_free_work_queue.cc',
     'src/core/lib/experiments/config.cc',
     'src/core/lib/experiments/experiments.cc',
     'src/core/lib/iomgr/buffer_list.cc',
@@ -636,6 +645,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/security/transport/client_auth_filter.cc',
     'src/core/lib/security/transport/server_auth_filter.cc',
     'src/core/lib/security/util/json_util.cc',
+    'src/core/lib/slice/arena_slice.cc',
     'src/core/lib/slice/percent_encoding.cc',
     'src/core/lib/slice/slice.cc',
     'src/core/lib/slice/slice_buffer.cc',
@@ -643,6 +653,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/surface/byte_buffer.cc',
     'src/core/lib/surface/byte_buffer_reader.cc',
     'src/core/lib/surface/call.cc',
+    'src/core/lib/surface/call_deadline_wheel.cc',
     'src/core/lib/surface/call_details.cc',
     'src/core/lib/surface/call_log_batch.cc',
     'src/core/lib/surface/call_utils.cc',
@@ -673,10 +684,12 @@ CORE_SOURCE_FILES = [
     'src/core/lib/transport/connectivity_state.cc',
     'src/core/lib/transport/error_utils.cc',
     'src/core/lib/transport/interception_chain.cc',
+    'src/core/lib/transport/interned_metadata_key.cc',
     'src/core/lib/transport/message.cc',
     'src/core/lib/transport/metadata.cc',
     'src/core/lib/transport/metadata_batch.cc',
     'src/core/lib/transport/metadata_info.cc',
+    'src/core/lib/transport/metadata_template.cc',
     'src/core/lib/transport/parsed_metadata.cc',
     'src/core/lib/transport/status_conversion.cc',
     'src/core/lib/transport/timeout_encoding.cc',
@@ -694,15 +707,18 @@ CORE_SOURCE_FILES = [
     'src/core/load_balancing/health_check_client.cc',
     'src/core/load_balancing/lb_policy.cc',
     'src/core/load_balancing/lb_policy_registry.cc',
+    'src/core/load_balancing/least_request/least_request.cc',
     'src/core/load_balancing/oob_backend_metric.cc',
     'src/core/load_balancing/outlier_detection/outlier_detection.cc',
     'src/core/load_balancing/pick_first/pick_first.cc',
     'src/core/load_balancing/priority/priority.cc',
+    'src/core/load_balancing/ring_hash/endpoint_hash_table.cc',
     'src/core/load_balancing/ring_hash/ring_hash.cc',
     'src/core/load_balancing/rls/rls.cc',
     'src/core/load_balancing/round_robin/round_robin.cc',
     'src/core/load_balancing/weighted_round_robin/static_stride_scheduler.cc',
     'src/core/load_balancing/weighted_round_robin/weighted_round_robin.cc',
+    'src/core/load_balancing/weighted_target/alias_table.cc',
     'src/core/load_balancing/weighted_target/weighted_target.cc',
     'src/core/load_balancing/xds/cds.cc',
     'src/core/load_balancing/xds/xds_cluster_impl.cc',
@@ -775,10 +791,12 @@ CORE_SOURCE_FILES = [
     'src/core/tsi/transport_security_grpc.cc',
     'src/core/util/alloc.cc',
     'src/core/util/backoff.cc',
+    'src/core/util/codel.cc',
     'src/core/util/crash.cc',
     'src/core/util/dump_args.cc',
     'src/core/util/event_log.cc',
     'src/core/util/examine_stack.cc',
+    'src/core/util/fast_random.cc',
     'src/core/util/fork.cc',
     'src/core/util/gcp_metadata_query.cc',
     'src/core/util/gethostname_fallback.cc',
@@ -14,6 +14,9 @@
 
 #include "src/core/call/request_buffer.h"
 
+#include <string>
+#include <vector>
+
 #include "gtest/gtest.h"
 #include "test/core/promise/poll_matcher.h"
 
@@ -713,6 +716,34 @@ TEST(RequestBufferTest, CancelBeforeMessagePushButAfterInitialMetadataPull) {
   ASSERT_FALSE(poll.value().ok());
 }
 
+TEST(RequestBufferTest, ReadersSharePayloadSlices) {
+  RequestBuffer buffer;
+  EXPECT_EQ(buffer.PushClientInitialMetadata(TestMetadata()), 40);
+  // Large enough not to be inlined into the slice itself.
+  const std::string payload(1024, 'a');
+  auto pusher = buffer.PushMessage(Arena::MakePooled<Message>(
+      SliceBuffer(Slice::FromCopiedString(payload)), 0));
+  EXPECT_THAT(pusher(), IsReady(40 + payload.size()));
+  RequestBuffer::Reader reader1(&buffer);
+  RequestBuffer::Reader reader2(&buffer);
+  std::vector<MessageHandle> messages;
+  for (RequestBuffer::Reader* reader : {&reader1, &reader2}) {
+    auto pull_md = reader->PullClientInitialMetadata();
+    EXPECT_THAT(pull_md(), IsReady());  // value tested elsewhere
+    auto pull_msg = reader->PullMessage();
+    auto poll_msg = pull_msg();
+    ASSERT_THAT(poll_msg, IsReady());
+    ASSERT_TRUE(poll_msg.value().ok());
+    ASSERT_TRUE(poll_msg.value().value().has_value());
+    messages.push_back(std::move(*poll_msg.value().value()));
+  }
+  ASSERT_EQ(messages[0]->payload()->Count(), 1u);
+  ASSERT_EQ(messages[1]->payload()->Count(), 1u);
+  EXPECT_EQ(messages[0]->payload()->RefSlice(0).data(),
+            messages[1]->payload()->RefSlice(0).data());
+  EXPECT_EQ(messages[0]->payload()->JoinIntoString(), payload);
+}
+
 }  // namespace grpc_core
 
 int main(int argc, char** argv) {
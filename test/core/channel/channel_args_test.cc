@@ -74,6 +74,25 @@ TEST(ChannelArgsTest, SetGetRemove) {
   gpr_free(ptr);
 }
 
+TEST(ChannelArgsTest, HashIsConsistentWithEquality) {
+  int object;
+  ChannelArgs a = ChannelArgs()
+                      .Set("answer", 42)
+                      .Set("foo", "bar")
+                      .Set("ptr", ChannelArgs::UnownedPointer(&object));
+  // Built separately and in a different order, so no nodes are shared.
+  ChannelArgs b = ChannelArgs()
+                      .Set("ptr", ChannelArgs::UnownedPointer(&object))
+                      .Set("foo", std::string("bar"))
+                      .Set("answer", 42);
+  ASSERT_EQ(a, b);
+  EXPECT_EQ(a.Hash(), b.Hash());
+  EXPECT_NE(a.Hash(), a.Set("answer", 43).Hash());
+  EXPECT_NE(a.Hash(), a.Set("foo", "baz").Hash());
+  EXPECT_NE(a.Hash(), a.Remove("foo").Hash());
+  EXPECT_EQ(ChannelArgs().Hash(), ChannelArgs().Hash());
+}
+
 TEST(ChannelArgsTest, RemoveAllKeysWithPrefix) {
   ChannelArgs args;
   args = args.Set("foo", 1);
@@ -270,6 +270,28 @@ TEST(ChannelTracerTest, ComplexTest) {
       << JsonDump(json);
 }
 
+TEST(ChannelTracerTest, StateChangeEvents) {
+  ExecCtx exec_ctx;
+  ChannelTrace tracer(kEventListMemoryLimit);
+  tracer.AddChannelStateChangeEvent(GRPC_CHANNEL_READY);
+  tracer.AddSubchannelStateChangeEvent(GRPC_CHANNEL_IDLE, absl::OkStatus());
+  tracer.AddSubchannelStateChangeEvent(GRPC_CHANNEL_TRANSIENT_FAILURE,
+                                       absl::UnavailableError("failed"));
+  Json json = tracer.RenderJson();
+  ValidateJsonProtoTranslation(json);
+  EXPECT_THAT(
+      json,
+      IsChannelTrace(
+          3, ::testing::ElementsAre(
+                 IsTraceEvent("Channel state change to READY", "CT_INFO"),
+                 IsTraceEvent("Subchannel connectivity state changed to IDLE",
+                              "CT_INFO"),
+                 IsTraceEvent("Subchannel connectivity state changed to "
+                              "TRANSIENT_FAILURE: UNAVAILABLE: failed",
+                              "CT_INFO"))))
+      << JsonDump(json);
+}
+
 TEST(ChannelTracerTest, TestSmallMemoryLimit) {
   ExecCtx exec_ctx;
   // Doesn't make sense in practice, but serves a testing purpose for the
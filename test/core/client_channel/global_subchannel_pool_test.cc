@@ -0,0 +1,83 @@
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "src/core/client_channel/global_subchannel_pool.h"
+
+#include <grpc/support/port_platform.h>
+
+#include "gtest/gtest.h"
+#include "src/core/lib/address_utils/parse_address.h"
+#include "src/core/util/time.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+grpc_resolved_address Address(int port) {
+  return StringToSockaddr("127.0.0.1", port).value();
+}
+
+TEST(ReserveConnectAttempt, BurstThenPaced) {
+  ScopedTimeCache time_cache;
+  time_cache.TestOnlySetNow(Timestamp::FromMillisecondsAfterProcessEpoch(
+      1000000));
+  auto pool = GlobalSubchannelPool::instance();
+  const grpc_resolved_address address = Address(1001);
+  EXPECT_EQ(pool->ReserveConnectAttempt(address, 10, 2), Duration::Zero());
+  EXPECT_EQ(pool->ReserveConnectAttempt(address, 10, 2), Duration::Zero());
+  EXPECT_EQ(pool->ReserveConnectAttempt(address, 10, 2),
+            Duration::Milliseconds(100));
+  EXPECT_EQ(pool->ReserveConnectAttempt(address, 10, 2),
+            Duration::Milliseconds(200));
+}
+
+TEST(ReserveConnectAttempt, RefillsOverTime) {
+  ScopedTimeCache time_cache;
+  const Timestamp start = Timestamp::FromMillisecondsAfterProcessEpoch(2000000);
+  time_cache.TestOnlySetNow(start);
+  auto pool = GlobalSubchannelPool::instance();
+  const grpc_resolved_address address = Address(1002);
+  EXPECT_EQ(pool->ReserveConnectAttempt(address, 10, 1), Duration::Zero());
+  EXPECT_EQ(pool->ReserveConnectAttempt(address, 10, 1),
+            Duration::Milliseconds(100));
+  time_cache.TestOnlySetNow(start + Duration::Seconds(1));
+  EXPECT_EQ(pool->ReserveConnectAttempt(address, 10, 1), Duration::Zero());
+}
+
+TEST(ReserveConnectAttempt, AddressesAreIndependent) {
+  ScopedTimeCache time_cache;
+  time_cache.TestOnlySetNow(Timestamp::FromMillisecondsAfterProcessEpoch(
+      3000000));
+  auto pool = GlobalSubchannelPool::instance();
+  EXPECT_EQ(pool->ReserveConnectAttempt(Address(1003), 1, 1),
+            Duration::Zero());
+  EXPECT_EQ(pool->ReserveConnectAttempt(Address(1004), 1, 1),
+            Duration::Zero());
+  EXPECT_EQ(pool->ReserveConnectAttempt(Address(1003), 1, 1),
+            Duration::Seconds(1));
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  auto result = RUN_ALL_TESTS();
+  return result;
+}
@@ -77,6 +77,54 @@ TEST(MakeSubchannelArgs, StripsOutNoSubchannelArgs) {
   EXPECT_EQ(args.GetString(GRPC_ARG_NO_SUBCHANNEL_PREFIX "bar"), std::nullopt);
 }
 
+TEST(MakeSubchannelArgs, CoalescingIgnoresChannelOnlyArgs) {
+  auto make = [](ChannelArgs channel_args) {
+    return Subchannel::MakeSubchannelArgs(
+        channel_args.Set(GRPC_ARG_SUBCHANNEL_COALESCING, true)
+            .Set(GRPC_ARG_SUBCHANNEL_COALESCING_IGNORED_ARGS,
+                 "app.tenant, app.filter_config"),
+        ChannelArgs(), nullptr, "foo.example.com");
+  };
+  ChannelArgs a = make(ChannelArgs()
+                           .Set(GRPC_ARG_SERVICE_CONFIG, "{}")
+                           .Set(GRPC_ARG_LB_POLICY_NAME, "round_robin")
+                           .Set("app.tenant", "a")
+                           .Set(GRPC_ARG_KEEPALIVE_TIME_MS, 1000));
+  ChannelArgs b = make(ChannelArgs()
+                           .Set("app.filter_config", "b")
+                           .Set(GRPC_ARG_KEEPALIVE_TIME_MS, 1000));
+  EXPECT_EQ(a, b);
+  // Args that may affect the connection still tell subchannels apart.
+  ChannelArgs c = make(ChannelArgs().Set(GRPC_ARG_KEEPALIVE_TIME_MS, 2000));
+  EXPECT_NE(a, c);
+}
+
+TEST(MakeSubchannelArgs, NoCoalescingByDefault) {
+  ChannelArgs a = Subchannel::MakeSubchannelArgs(
+      ChannelArgs().Set(GRPC_ARG_LB_POLICY_NAME, "round_robin"), ChannelArgs(),
+      nullptr, "foo.example.com");
+  ChannelArgs b = Subchannel::MakeSubchannelArgs(ChannelArgs(), ChannelArgs(),
+                                                 nullptr, "foo.example.com");
+  EXPECT_NE(a, b);
+}
+
+TEST(AssignSubchannelCoalescingGroup, SpreadsChannelsOverGroups) {
+  const ChannelArgs channel_args =
+      ChannelArgs()
+          .Set(GRPC_ARG_SUBCHANNEL_COALESCING, true)
+          .Set(GRPC_ARG_SUBCHANNEL_COALESCING_MAX_CONNECTIONS, 2);
+  auto key = [&]() {
+    return Subchannel::MakeSubchannelArgs(
+        Subchannel::AssignSubchannelCoalescingGroup(channel_args),
+        ChannelArgs(), nullptr, "foo.example.com");
+  };
+  ChannelArgs first = key();
+  ChannelArgs second = key();
+  ChannelArgs third = key();
+  EXPECT_NE(first, second);
+  EXPECT_EQ(first, third);
+}
+
 }  // namespace
 }  // namespace testing
 }  // namespace grpc_core
@@ -0,0 +1,122 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/compression/adaptive_compression.h"
+
+#include <string>
+
+#include "absl/strings/str_cat.h"
+#include "gtest/gtest.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+using Action = AdaptiveCompression::Action;
+
+// Runs one window of probed messages of 1000 bytes each, compressed to
+// `output_bytes`.
+void RunWindow(AdaptiveCompression::Method* method, size_t output_bytes) {
+  for (uint64_t i = 0; i < AdaptiveCompression::kWindow; ++i) {
+    ASSERT_EQ(method->Next(), Action::kCompressAndRecord);
+    method->Record(1000, output_bytes, /*nanos=*/1000);
+  }
+}
+
+TEST(AdaptiveCompressionTest, GetMethodIsStable) {
+  AdaptiveCompression adaptive;
+  AdaptiveCompression::Method* a = adaptive.GetMethod("/foo/bar");
+  ASSERT_NE(a, nullptr);
+  EXPECT_EQ(adaptive.GetMethod("/foo/bar"), a);
+  EXPECT_NE(adaptive.GetMethod("/foo/baz"), a);
+}
+
+TEST(AdaptiveCompressionTest, TracksBoundedNumberOfMethods) {
+  AdaptiveCompression adaptive;
+  for (size_t i = 0; i < AdaptiveCompression::kMaxMethods; ++i) {
+    EXPECT_NE(adaptive.GetMethod(absl::StrCat("/m/", i)), nullptr);
+  }
+  EXPECT_EQ(adaptive.GetMethod("/one/more"), nullptr);
+  EXPECT_NE(adaptive.GetMethod("/m/0"), nullptr);
+}
+
+TEST(AdaptiveCompressionTest, KeepsCompressingCompressibleMethod) {
+  AdaptiveCompression adaptive;
+  AdaptiveCompression::Method* method = adaptive.GetMethod("/foo/bar");
+  RunWindow(method, 500);
+  EXPECT_TRUE(method->compressing());
+  int recorded = 0;
+  for (uint64_t i = 0; i < 10 * AdaptiveCompression::kSampleInterval; ++i) {
+    const Action action = method->Next();
+    ASSERT_NE(action, Action::kSkip);
+    if (action == Action::kCompressAndRecord) {
+      ++recorded;
+      method->Record(1000, 500, 1000);
+    }
+  }
+  EXPECT_EQ(recorded, 10);
+  EXPECT_TRUE(method->compressing());
+}
+
+TEST(AdaptiveCompressionTest, SkipsIncompressibleMethodAndReprobes) {
+  const auto before = global_stats().Collect();
+  AdaptiveCompression adaptive;
+  AdaptiveCompression::Method* method = adaptive.GetMethod("/foo/bar");
+  RunWindow(method, 1000);
+  EXPECT_FALSE(method->compressing());
+  // Everything until the next probe is skipped.
+  uint64_t skipped = 0;
+  while (method->Next() == Action::kSkip) ++skipped;
+  EXPECT_LT(skipped, AdaptiveCompression::kProbeInterval);
+  EXPECT_GT(skipped, 0u);
+  // The probe finds the payload compressible again.
+  method->Record(1000, 200, 1000);
+  for (uint64_t i = 1; i < AdaptiveCompression::kWindow; ++i) {
+    ASSERT_EQ(method->Next(), Action::kCompressAndRecord);
+    method->Record(1000, 200, 1000);
+  }
+  EXPECT_TRUE(method->compressing());
+  const auto after = global_stats().Collect();
+  EXPECT_EQ(after->compression_skipped_messages -
+                before->compression_skipped_messages,
+            skipped);
+  EXPECT_EQ(after->compression_methods_disabled -
+                before->compression_methods_disabled,
+            1u);
+  EXPECT_EQ(after->compression_methods_enabled -
+                before->compression_methods_enabled,
+            1u);
+}
+
+TEST(AdaptiveCompressionTest, SkipsMethodThatCostsTooMuchCpu) {
+  AdaptiveCompression adaptive;
+  AdaptiveCompression::Method* method = adaptive.GetMethod("/foo/bar");
+  // Saves half the bytes, but takes a millisecond per message to do it.
+  for (uint64_t i = 0; i < AdaptiveCompression::kWindow; ++i) {
+    ASSERT_EQ(method->Next(), Action::kCompressAndRecord);
+    method->Record(1000, 500, /*nanos=*/1000000);
+  }
+  EXPECT_FALSE(method->compressing());
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,120 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/compression/compression_engine.h"
+
+#include <grpc/slice_buffer.h>
+
+#include <memory>
+#include <utility>
+
+#include "gtest/gtest.h"
+#include "src/core/lib/slice/slice.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+using Direction = CompressionEngine::Direction;
+
+// Accepts gzip messages of at least min_length bytes, and "compresses" them
+// by copying, failing if told to.
+class FakeEngine final : public CompressionEngine {
+ public:
+  explicit FakeEngine(size_t min_length, bool fail = false)
+      : min_length_(min_length), fail_(fail) {}
+
+  absl::string_view name() const override { return "fake"; }
+
+  bool Accepts(Direction, grpc_compression_algorithm algorithm,
+               size_t length) const override {
+    return algorithm == GRPC_COMPRESS_GZIP && length >= min_length_;
+  }
+
+  void Run(Direction, grpc_compression_algorithm, int,
+           grpc_slice_buffer* input, grpc_slice_buffer* output,
+           absl::AnyInvocable<void(bool ok)> on_done) override {
+    for (size_t i = 0; i < input->count; ++i) {
+      grpc_slice_buffer_add(output, CSliceRef(input->slices[i]));
+    }
+    on_done(!fail_);
+  }
+
+ private:
+  const size_t min_length_;
+  const bool fail_;
+};
+
+TEST(CompressionEngineRegistryTest, EmptyRegistryFindsNothing) {
+  CompressionEngineRegistry registry;
+  EXPECT_EQ(registry.Find(Direction::kCompress, GRPC_COMPRESS_GZIP, 100),
+            nullptr);
+}
+
+TEST(CompressionEngineRegistryTest, FindsAcceptingEngine) {
+  CompressionEngineRegistry registry;
+  auto small = std::make_shared<FakeEngine>(0);
+  auto large = std::make_shared<FakeEngine>(1000);
+  registry.Register(small);
+  registry.Register(large);
+  // Engines registered later are asked first.
+  EXPECT_EQ(registry.Find(Direction::kCompress, GRPC_COMPRESS_GZIP, 5000),
+            large);
+  EXPECT_EQ(registry.Find(Direction::kCompress, GRPC_COMPRESS_GZIP, 10),
+            small);
+  EXPECT_EQ(registry.Find(Direction::kCompress, GRPC_COMPRESS_DEFLATE, 10),
+            nullptr);
+  EXPECT_TRUE(registry.Unregister(small.get()));
+  EXPECT_FALSE(registry.Unregister(small.get()));
+  EXPECT_EQ(registry.Find(Direction::kCompress, GRPC_COMPRESS_GZIP, 10),
+            nullptr);
+  EXPECT_TRUE(registry.Unregister(large.get()));
+  EXPECT_EQ(registry.Find(Direction::kCompress, GRPC_COMPRESS_GZIP, 5000),
+            nullptr);
+}
+
+TEST(CompressionEngineOperationTest, InlineCompletion) {
+  SliceBuffer input;
+  input.Append(Slice::FromCopiedString("hello world"));
+  auto operation = CompressionEngineOperation::Start(
+      std::make_shared<FakeEngine>(0), Direction::kCompress,
+      GRPC_COMPRESS_GZIP, 0, std::move(input));
+  auto done = operation->PollDone();
+  ASSERT_TRUE(done.ready());
+  EXPECT_TRUE(done.value());
+  EXPECT_EQ(operation->output().JoinIntoString(), "hello world");
+  EXPECT_EQ(operation->input().JoinIntoString(), "hello world");
+}
+
+TEST(CompressionEngineOperationTest, FailureLeavesOutputEmpty) {
+  SliceBuffer input;
+  input.Append(Slice::FromCopiedString("hello world"));
+  auto operation = CompressionEngineOperation::Start(
+      std::make_shared<FakeEngine>(0, /*fail=*/true), Direction::kCompress,
+      GRPC_COMPRESS_GZIP, 0, std::move(input));
+  auto done = operation->PollDone();
+  ASSERT_TRUE(done.ready());
+  EXPECT_FALSE(done.value());
+  EXPECT_EQ(operation->output().Length(), 0);
+  EXPECT_EQ(operation->input().JoinIntoString(), "hello world");
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -25,16 +25,19 @@
 
 #include "absl/log/absl_log.h"
 #include "gtest/gtest.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/compression/compression_internal.h"
 #include "src/core/util/useful.h"
 #include "test/core/test_util/test_config.h"
 
 TEST(CompressionTest, CompressionAlgorithmParse) {
   size_t i;
-  const char* valid_names[] = {"identity", "gzip", "deflate"};
+  const char* valid_names[] = {"identity", "gzip", "deflate", "zstd"};
   const grpc_compression_algorithm valid_algorithms[] = {
       GRPC_COMPRESS_NONE,
       GRPC_COMPRESS_GZIP,
       GRPC_COMPRESS_DEFLATE,
+      GRPC_COMPRESS_ZSTD,
   };
   const char* invalid_names[] = {"gzip2", "foo", "", "2gzip"};
 
@@ -64,11 +67,12 @@ TEST(CompressionTest, CompressionAlgorithmName) {
   int success;
   const char* name;
   size_t i;
-  const char* valid_names[] = {"identity", "gzip", "deflate"};
+  const char* valid_names[] = {"identity", "gzip", "deflate", "zstd"};
   const grpc_compression_algorithm valid_algorithms[] = {
       GRPC_COMPRESS_NONE,
       GRPC_COMPRESS_GZIP,
       GRPC_COMPRESS_DEFLATE,
+      GRPC_COMPRESS_ZSTD,
   };
 
   ABSL_VLOG(2) << "test_compression_algorithm_name";
@@ -240,6 +244,21 @@ TEST(CompressionTest, CompressionEnableDisableAlgorithm) {
   }
 }
 
+TEST(CompressionTest, ChannelArgsOnlyAdvertiseSupportedAlgorithms) {
+  auto set = grpc_core::CompressionAlgorithmSet::FromChannelArgs(
+      grpc_core::ChannelArgs());
+  for (size_t i = 0; i < GRPC_COMPRESS_ALGORITHMS_COUNT; i++) {
+    auto algorithm = static_cast<grpc_compression_algorithm>(i);
+    EXPECT_EQ(set.IsSet(algorithm),
+              grpc_core::IsCompressionAlgorithmSupported(algorithm));
+  }
+#ifdef GRPC_HAVE_ZSTD
+  EXPECT_EQ(set.ToString(), "identity, deflate, gzip, zstd");
+#else
+  EXPECT_EQ(set.ToString(), "identity, deflate, gzip");
+#endif
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   ::testing::InitGoogleTest(&argc, argv);
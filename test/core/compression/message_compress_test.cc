@@ -28,6 +28,9 @@
 
 #include "absl/log/absl_log.h"
 #include "gtest/gtest.h"
+#include "src/core/lib/compression/compression_dictionary.h"
+#include "src/core/lib/compression/compression_internal.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/util/useful.h"
 #include "test/core/test_util/slice_splitter.h"
@@ -113,6 +116,9 @@ static grpc_slice repeated(char c, size_t length) {
 static compressability get_compressability(
     test_value id, grpc_compression_algorithm algorithm) {
   if (algorithm == GRPC_COMPRESS_NONE) return SHOULD_NOT_COMPRESS;
+  if (!grpc_core::IsCompressionAlgorithmSupported(algorithm)) {
+    return SHOULD_NOT_COMPRESS;
+  }
   switch (id) {
     case ONE_A:
       return SHOULD_NOT_COMPRESS;
@@ -251,6 +257,355 @@ TEST(MessageCompressTest, BadDecompressionDataStream) {
   grpc_slice_buffer_destroy(&output);
 }
 
+#ifdef GRPC_HAVE_ZSTD
+TEST(MessageCompressTest, ZstdBadDecompressionDataTruncated) {
+  grpc_slice_buffer input;
+  grpc_slice_buffer compressed;
+  grpc_slice_buffer garbage;
+  grpc_slice_buffer output;
+
+  grpc_slice_buffer_init(&input);
+  grpc_slice_buffer_init(&compressed);
+  grpc_slice_buffer_init(&garbage);
+  grpc_slice_buffer_init(&output);
+  grpc_slice_buffer_add(&input, create_test_value(ONE_MB_A));
+
+  grpc_core::ExecCtx exec_ctx;
+  ASSERT_EQ(1, grpc_msg_compress(GRPC_COMPRESS_ZSTD, &input, &compressed));
+  ASSERT_GT(compressed.length, 4);
+  grpc_slice_buffer_trim_end(&compressed, 4, &garbage);
+  ASSERT_EQ(0, grpc_msg_decompress(GRPC_COMPRESS_ZSTD, &compressed, &output));
+  ASSERT_EQ(0, output.length);
+
+  grpc_slice_buffer_destroy(&input);
+  grpc_slice_buffer_destroy(&compressed);
+  grpc_slice_buffer_destroy(&garbage);
+  grpc_slice_buffer_destroy(&output);
+}
+
+TEST(MessageCompressTest, ZstdBadDecompressionDataTrailingGarbage) {
+  grpc_slice_buffer input;
+  grpc_slice_buffer compressed;
+  grpc_slice_buffer output;
+
+  grpc_slice_buffer_init(&input);
+  grpc_slice_buffer_init(&compressed);
+  grpc_slice_buffer_init(&output);
+  grpc_slice_buffer_add(&input, create_test_value(ONE_KB_A));
+
+  grpc_core::ExecCtx exec_ctx;
+  ASSERT_EQ(1, grpc_msg_compress(GRPC_COMPRESS_ZSTD, &input, &compressed));
+  grpc_slice_buffer_add(&compressed, grpc_slice_from_copied_string("\x99"));
+  ASSERT_EQ(0, grpc_msg_decompress(GRPC_COMPRESS_ZSTD, &compressed, &output));
+
+  grpc_slice_buffer_destroy(&input);
+  grpc_slice_buffer_destroy(&compressed);
+  grpc_slice_buffer_destroy(&output);
+}
+
+TEST(MessageCompressTest, ZstdCompressionLevels) {
+  grpc_slice_buffer input;
+  grpc_slice_buffer_init(&input);
+  grpc_slice_buffer_add(&input, create_test_value(ONE_MB_A));
+
+  grpc_core::ExecCtx exec_ctx;
+  for (int level : {-5, 0, 1, 19}) {
+    grpc_slice_buffer compressed;
+    grpc_slice_buffer output;
+    grpc_slice_buffer_init(&compressed);
+    grpc_slice_buffer_init(&output);
+    ASSERT_EQ(1, grpc_msg_compress_with_level(GRPC_COMPRESS_ZSTD, level,
+                                              &input, &compressed));
+    ASSERT_EQ(1,
+              grpc_msg_decompress(GRPC_COMPRESS_ZSTD, &compressed, &output));
+    ASSERT_EQ(input.length, output.length);
+    grpc_slice_buffer_destroy(&compressed);
+    grpc_slice_buffer_destroy(&output);
+  }
+
+  grpc_slice_buffer_destroy(&input);
+}
+#else
+TEST(MessageCompressTest, ZstdUnavailableSendsUncompressed) {
+  grpc_slice_buffer input;
+  grpc_slice_buffer output;
+
+  grpc_slice_buffer_init(&input);
+  grpc_slice_buffer_init(&output);
+  grpc_slice_buffer_add(&input, create_test_value(ONE_KB_A));
+
+  grpc_core::ExecCtx exec_ctx;
+  ASSERT_EQ(0, grpc_msg_compress(GRPC_COMPRESS_ZSTD, &input, &output));
+  ASSERT_EQ(input.length, output.length);
+
+  grpc_slice_buffer_destroy(&input);
+  grpc_slice_buffer_destroy(&output);
+}
+#endif  // GRPC_HAVE_ZSTD
+
+TEST(MessageCompressTest, ReusedCompressorMatchesOneShot) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::MessageCompressor compressor;
+  grpc_core::MessageCompressor decompressor;
+  // Interleave algorithms so contexts are both reset and reinitialized.
+  for (int round = 0; round < 3; round++) {
+    for (int i = 0; i < GRPC_COMPRESS_ALGORITHMS_COUNT; i++) {
+      auto algorithm = static_cast<grpc_compression_algorithm>(i);
+      grpc_slice value = create_test_value(ONE_KB_A);
+      grpc_slice_buffer input;
+      grpc_slice_buffer reused;
+      grpc_slice_buffer one_shot;
+      grpc_slice_buffer output;
+      grpc_slice_buffer_init(&input);
+      grpc_slice_buffer_init(&reused);
+      grpc_slice_buffer_init(&one_shot);
+      grpc_slice_buffer_init(&output);
+      grpc_slice_buffer_add(&input, grpc_slice_ref(value));
+
+      int was_compressed = compressor.Compress(algorithm, 0, &input, &reused);
+      ASSERT_EQ(was_compressed,
+                grpc_msg_compress(algorithm, &input, &one_shot));
+      // Each message must be independently decodable by a fresh context.
+      grpc_slice a = grpc_slice_merge(reused.slices, reused.count);
+      grpc_slice b = grpc_slice_merge(one_shot.slices, one_shot.count);
+      ASSERT_TRUE(grpc_slice_eq(a, b));
+      grpc_slice_unref(a);
+      grpc_slice_unref(b);
+
+      ASSERT_TRUE(decompressor.Decompress(
+          was_compressed ? algorithm : GRPC_COMPRESS_NONE, &reused, &output));
+      grpc_slice final = grpc_slice_merge(output.slices, output.count);
+      ASSERT_TRUE(grpc_slice_eq(value, final));
+      grpc_slice_unref(final);
+
+      grpc_slice_unref(value);
+      grpc_slice_buffer_destroy(&input);
+      grpc_slice_buffer_destroy(&reused);
+      grpc_slice_buffer_destroy(&one_shot);
+      grpc_slice_buffer_destroy(&output);
+    }
+  }
+}
+
+TEST(MessageCompressTest, ReusedDecompressorRecoversFromBadData) {
+  grpc_slice_buffer input;
+  grpc_slice_buffer compressed;
+  grpc_slice_buffer garbage;
+  grpc_slice_buffer output;
+
+  grpc_slice_buffer_init(&input);
+  grpc_slice_buffer_init(&compressed);
+  grpc_slice_buffer_init(&garbage);
+  grpc_slice_buffer_init(&output);
+  grpc_slice_buffer_add(&input, create_test_value(ONE_KB_A));
+
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::MessageCompressor decompressor;
+  ASSERT_EQ(1, grpc_msg_compress(GRPC_COMPRESS_GZIP, &input, &compressed));
+  grpc_slice_buffer_trim_end(&compressed, 8, &garbage);
+  ASSERT_EQ(0, decompressor.Decompress(GRPC_COMPRESS_GZIP, &compressed,
+                                       &output));
+  ASSERT_EQ(0, output.length);
+  grpc_slice_buffer_reset_and_unref(&compressed);
+  ASSERT_EQ(1, grpc_msg_compress(GRPC_COMPRESS_GZIP, &input, &compressed));
+  ASSERT_EQ(1, decompressor.Decompress(GRPC_COMPRESS_GZIP, &compressed,
+                                       &output));
+  ASSERT_EQ(input.length, output.length);
+
+  grpc_slice_buffer_destroy(&input);
+  grpc_slice_buffer_destroy(&compressed);
+  grpc_slice_buffer_destroy(&garbage);
+  grpc_slice_buffer_destroy(&output);
+}
+
+// Several chunks of text with enough variety to exercise the checksums.
+static grpc_slice create_large_test_value() {
+  const size_t length = 5 * grpc_core::kParallelCompressionChunkSize + 12345;
+  grpc_slice out = grpc_slice_malloc(length);
+  uint8_t* p = GRPC_SLICE_START_PTR(out);
+  for (size_t i = 0; i < length; i++) {
+    p[i] = static_cast<uint8_t>('a' + (i * 7 + i / 4096) % 26);
+  }
+  return out;
+}
+
+TEST(MessageCompressTest, ParallelCompressIsStandardDecodable) {
+  grpc_core::ExecCtx exec_ctx;
+  auto event_engine = grpc_event_engine::experimental::GetDefaultEventEngine();
+  grpc_slice value = create_large_test_value();
+  for (int i = 0; i < GRPC_COMPRESS_ALGORITHMS_COUNT; i++) {
+    auto algorithm = static_cast<grpc_compression_algorithm>(i);
+    if (!grpc_core::IsCompressionAlgorithmSupported(algorithm)) continue;
+    grpc_slice_buffer input;
+    grpc_slice_buffer compressed;
+    grpc_slice_buffer output;
+    grpc_slice_buffer_init(&input);
+    grpc_slice_buffer_init(&compressed);
+    grpc_slice_buffer_init(&output);
+    grpc_slice_buffer_add(&input, grpc_slice_ref(value));
+
+    const int was_compressed = grpc_core::ParallelCompress(
+        algorithm, 0, &input, &compressed, event_engine.get());
+    ASSERT_EQ(was_compressed, algorithm != GRPC_COMPRESS_NONE);
+    // Readable by the ordinary single threaded decoder...
+    ASSERT_EQ(1, grpc_msg_decompress(
+                     was_compressed ? algorithm : GRPC_COMPRESS_NONE,
+                     &compressed, &output));
+    grpc_slice final = grpc_slice_merge(output.slices, output.count);
+    ASSERT_TRUE(grpc_slice_eq(value, final));
+    grpc_slice_unref(final);
+    grpc_slice_buffer_reset_and_unref(&output);
+    // ... as well as the parallel one.
+    ASSERT_EQ(1, grpc_core::ParallelDecompress(
+                     was_compressed ? algorithm : GRPC_COMPRESS_NONE,
+                     &compressed, &output, GRPC_SLICE_LENGTH(value),
+                     event_engine.get()));
+    final = grpc_slice_merge(output.slices, output.count);
+    ASSERT_TRUE(grpc_slice_eq(value, final));
+    grpc_slice_unref(final);
+
+    grpc_slice_buffer_destroy(&input);
+    grpc_slice_buffer_destroy(&compressed);
+    grpc_slice_buffer_destroy(&output);
+  }
+  grpc_slice_unref(value);
+}
+
+TEST(MessageCompressTest, ParallelCompressSmallMessageMatchesSerial) {
+  grpc_core::ExecCtx exec_ctx;
+  auto event_engine = grpc_event_engine::experimental::GetDefaultEventEngine();
+  grpc_slice_buffer input;
+  grpc_slice_buffer parallel;
+  grpc_slice_buffer serial;
+  grpc_slice_buffer_init(&input);
+  grpc_slice_buffer_init(&parallel);
+  grpc_slice_buffer_init(&serial);
+  grpc_slice_buffer_add(&input, create_test_value(ONE_MB_A));
+
+  ASSERT_EQ(1, grpc_core::ParallelCompress(GRPC_COMPRESS_GZIP, 0, &input,
+                                           &parallel, event_engine.get()));
+  ASSERT_EQ(1, grpc_msg_compress(GRPC_COMPRESS_GZIP, &input, &serial));
+  grpc_slice a = grpc_slice_merge(parallel.slices, parallel.count);
+  grpc_slice b = grpc_slice_merge(serial.slices, serial.count);
+  ASSERT_TRUE(grpc_slice_eq(a, b));
+  grpc_slice_unref(a);
+  grpc_slice_unref(b);
+
+  grpc_slice_buffer_destroy(&input);
+  grpc_slice_buffer_destroy(&parallel);
+  grpc_slice_buffer_destroy(&serial);
+}
+
+#ifdef GRPC_HAVE_ZSTD
+TEST(MessageCompressTest, ZstdParallelDecompressRespectsLimit) {
+  grpc_core::ExecCtx exec_ctx;
+  auto event_engine = grpc_event_engine::experimental::GetDefaultEventEngine();
+  grpc_slice value = create_large_test_value();
+  grpc_slice_buffer input;
+  grpc_slice_buffer compressed;
+  grpc_slice_buffer output;
+  grpc_slice_buffer_init(&input);
+  grpc_slice_buffer_init(&compressed);
+  grpc_slice_buffer_init(&output);
+  grpc_slice_buffer_add(&input, grpc_slice_ref(value));
+
+  ASSERT_EQ(1, grpc_core::ParallelCompress(GRPC_COMPRESS_ZSTD, 0, &input,
+                                           &compressed, event_engine.get()));
+  // Too large to decompress in parallel, so it is decompressed serially.
+  ASSERT_EQ(1, grpc_core::ParallelDecompress(
+                   GRPC_COMPRESS_ZSTD, &compressed, &output,
+                   GRPC_SLICE_LENGTH(value) - 1, event_engine.get()));
+  ASSERT_EQ(output.length, GRPC_SLICE_LENGTH(value));
+  grpc_slice_buffer_reset_and_unref(&output);
+  // A damaged frame fails the whole message.
+  grpc_slice_buffer garbage;
+  grpc_slice_buffer_init(&garbage);
+  grpc_slice_buffer_trim_end(&compressed, 4, &garbage);
+  ASSERT_EQ(0, grpc_core::ParallelDecompress(
+                   GRPC_COMPRESS_ZSTD, &compressed, &output,
+                   GRPC_SLICE_LENGTH(value), event_engine.get()));
+  ASSERT_EQ(0, output.length);
+
+  grpc_slice_unref(value);
+  grpc_slice_buffer_destroy(&input);
+  grpc_slice_buffer_destroy(&compressed);
+  grpc_slice_buffer_destroy(&garbage);
+  grpc_slice_buffer_destroy(&output);
+}
+#endif  // GRPC_HAVE_ZSTD
+
+namespace {
+constexpr char kDictionary[] =
+    "{\"service\":\"telemetry\",\"region\":\"us-east1\",\"status\":"
+    "\"ok\",\"latency_ms\":,\"bytes_sent\":,\"bytes_received\":}";
+constexpr char kSmallMessage[] =
+    "{\"service\":\"telemetry\",\"region\":\"us-east1\",\"status\":"
+    "\"ok\",\"latency_ms\":12,\"bytes_sent\":1024,\"bytes_received\":77}";
+}  // namespace
+
+TEST(MessageCompressTest, DictionaryShrinksSmallMessages) {
+  auto& registry = grpc_core::CompressionDictionaryRegistry::Global();
+  registry.TestOnlyReset();
+  ASSERT_TRUE(registry.Register("telemetry", 1, kDictionary).ok());
+  auto dictionary = registry.Find("telemetry", 1);
+  ASSERT_NE(dictionary, nullptr);
+  EXPECT_EQ(registry.AdvertisedTokens(), "telemetry.v1");
+
+  grpc_slice_buffer input;
+  grpc_slice_buffer plain;
+  grpc_slice_buffer with_dictionary;
+  grpc_slice_buffer output;
+  grpc_slice_buffer_init(&input);
+  grpc_slice_buffer_init(&plain);
+  grpc_slice_buffer_init(&with_dictionary);
+  grpc_slice_buffer_init(&output);
+  grpc_slice_buffer_add(&input, grpc_slice_from_static_string(kSmallMessage));
+
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::MessageCompressor compressor;
+  grpc_msg_compress(GRPC_COMPRESS_DEFLATE, &input, &plain);
+  ASSERT_EQ(1, compressor.Compress(GRPC_COMPRESS_DEFLATE, 0, &input,
+                                   &with_dictionary, dictionary.get()));
+  EXPECT_LT(with_dictionary.length, plain.length);
+  ASSERT_EQ(1, grpc_msg_decompress(GRPC_COMPRESS_DEFLATE, &with_dictionary,
+                                   &output));
+  grpc_slice final = grpc_slice_merge(output.slices, output.count);
+  EXPECT_TRUE(grpc_slice_eq(final, grpc_slice_from_static_string(
+                                       kSmallMessage)));
+  grpc_slice_unref(final);
+
+  // Without the dictionary the receiver cannot decode the message.
+  registry.TestOnlyReset();
+  grpc_slice_buffer_reset_and_unref(&output);
+  EXPECT_EQ(0, grpc_msg_decompress(GRPC_COMPRESS_DEFLATE, &with_dictionary,
+                                   &output));
+  EXPECT_EQ(0, output.length);
+
+  grpc_slice_buffer_destroy(&input);
+  grpc_slice_buffer_destroy(&plain);
+  grpc_slice_buffer_destroy(&with_dictionary);
+  grpc_slice_buffer_destroy(&output);
+}
+
+TEST(MessageCompressTest, DictionaryRegistryRejectsConflicts) {
+  auto& registry = grpc_core::CompressionDictionaryRegistry::Global();
+  registry.TestOnlyReset();
+  EXPECT_TRUE(registry.Register("d", 1, "abcdef").ok());
+  EXPECT_TRUE(registry.Register("d", 1, "abcdef").ok());
+  EXPECT_EQ(registry.Register("d", 1, "ghijkl").code(),
+            absl::StatusCode::kAlreadyExists);
+  // Same bytes under another name would be indistinguishable on the wire.
+  EXPECT_EQ(registry.Register("e", 1, "abcdef").code(),
+            absl::StatusCode::kAlreadyExists);
+  EXPECT_TRUE(registry.Register("d", 2, "ghijkl").ok());
+  EXPECT_EQ(registry.Register("", 1, "x").code(),
+            absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(registry.Register("a,b", 1, "x").code(),
+            absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(registry.AdvertisedTokens(), "d.v1,d.v2");
+  registry.TestOnlyReset();
+}
+
 TEST(MessageCompressTest, BadCompressionAlgorithm) {
   grpc_slice_buffer input;
   grpc_slice_buffer output;
@@ -0,0 +1,59 @@
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+// Breaks cold-start cost down into building the CoreConfiguration (every
+// plugin registration plus ChannelInit filter ordering) and the rest of
+// grpc_init. First-channel creation is covered by bm_channel.
+
+#include <benchmark/benchmark.h>
+#include <grpc/grpc.h>
+
+#include "src/core/config/core_configuration.h"
+
+namespace grpc_core {
+namespace {
+
+void BM_BuildCoreConfiguration(benchmark::State& state) {
+  for (auto _ : state) {
+    CoreConfiguration::RunWithSpecialConfiguration(BuildCoreConfiguration, [] {
+      benchmark::DoNotOptimize(&CoreConfiguration::Get().channel_init());
+    });
+  }
+}
+BENCHMARK(BM_BuildCoreConfiguration);
+
+void BM_GrpcInitShutdown(benchmark::State& state) {
+  for (auto _ : state) {
+    grpc_init();
+    grpc_shutdown_blocking();
+  }
+}
+BENCHMARK(BM_GrpcInitShutdown);
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -0,0 +1,185 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/caching_dns_resolver.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/grpc.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "gtest/gtest.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/util/notification.h"
+#include "src/core/util/orphanable.h"
+#include "src/core/util/time.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_event_engine::experimental {
+namespace {
+
+using grpc_core::Duration;
+using grpc_core::MakeOrphanable;
+using grpc_core::Notification;
+using grpc_core::OrphanablePtr;
+using grpc_core::ScopedTimeCache;
+using grpc_core::Timestamp;
+
+using TXTResult = absl::StatusOr<std::vector<std::string>>;
+
+// Holds on to TXT lookups until the test completes them.
+class FakeResolver final : public RefCountedDNSResolverInterface {
+ public:
+  explicit FakeResolver(
+      std::vector<EventEngine::DNSResolver::LookupTXTCallback>* pending)
+      : pending_(pending) {}
+
+  void Orphan() override { Unref(); }
+
+  void LookupHostname(EventEngine::DNSResolver::LookupHostnameCallback,
+                      absl::string_view, absl::string_view) override {}
+  void LookupSRV(EventEngine::DNSResolver::LookupSRVCallback,
+                 absl::string_view) override {}
+  void LookupTXT(EventEngine::DNSResolver::LookupTXTCallback on_resolved,
+                 absl::string_view) override {
+    pending_->push_back(std::move(on_resolved));
+  }
+
+ private:
+  std::vector<EventEngine::DNSResolver::LookupTXTCallback>* const pending_;
+};
+
+class CachingDNSResolverTest : public ::testing::Test {
+ protected:
+  CachingDNSResolverTest() {
+    CachingDNSResolver::TestOnlyClearCache();
+    time_cache_.TestOnlySetNow(
+        Timestamp::FromMillisecondsAfterProcessEpoch(1000000));
+  }
+
+  OrphanablePtr<CachingDNSResolver> MakeResolver(
+      absl::string_view dns_server = "") {
+    CachingDNSResolver::Options options;
+    options.ttl = Duration::Seconds(10);
+    options.stale_while_revalidate = Duration::Seconds(10);
+    return MakeOrphanable<CachingDNSResolver>(
+        MakeOrphanable<FakeResolver>(&pending_), dns_server,
+        GetDefaultEventEngine(), options);
+  }
+
+  // Looks up name and waits for the answer.
+  static TXTResult LookupTXT(CachingDNSResolver& resolver,
+                             absl::string_view name) {
+    TXTResult result;
+    Notification done;
+    resolver.LookupTXT(
+        [&](TXTResult r) {
+          result = std::move(r);
+          done.Notify();
+        },
+        name);
+    done.WaitForNotification();
+    return result;
+  }
+
+  void CompletePending(TXTResult result) {
+    auto pending = std::move(pending_);
+    pending_.clear();
+    for (auto& callback : pending) callback(result);
+  }
+
+  void AdvanceTime(Duration duration) {
+    time_cache_.TestOnlySetNow(Timestamp::Now() + duration);
+  }
+
+  ScopedTimeCache time_cache_;
+  std::vector<EventEngine::DNSResolver::LookupTXTCallback> pending_;
+};
+
+TEST_F(CachingDNSResolverTest, CoalescesConcurrentLookups) {
+  auto resolver1 = MakeResolver();
+  auto resolver2 = MakeResolver();
+  std::vector<TXTResult> results;
+  resolver1->LookupTXT([&](TXTResult r) { results.push_back(r); }, "foo");
+  resolver2->LookupTXT([&](TXTResult r) { results.push_back(r); }, "foo");
+  ASSERT_EQ(pending_.size(), 1u);
+  CompletePending(std::vector<std::string>{"bar"});
+  ASSERT_EQ(results.size(), 2u);
+  EXPECT_EQ(results[0], TXTResult(std::vector<std::string>{"bar"}));
+  EXPECT_EQ(results[1], TXTResult(std::vector<std::string>{"bar"}));
+}
+
+TEST_F(CachingDNSResolverTest, ServesFromCacheUntilStale) {
+  auto resolver = MakeResolver();
+  resolver->LookupTXT([](TXTResult) {}, "foo");
+  CompletePending(std::vector<std::string>{"bar"});
+  // Fresh: no query.
+  EXPECT_EQ(LookupTXT(*resolver, "foo"),
+            TXTResult(std::vector<std::string>{"bar"}));
+  EXPECT_TRUE(pending_.empty());
+  // Stale: served as is, with one query refreshing it.
+  AdvanceTime(Duration::Seconds(15));
+  EXPECT_EQ(LookupTXT(*resolver, "foo"),
+            TXTResult(std::vector<std::string>{"bar"}));
+  EXPECT_EQ(LookupTXT(*resolver, "foo"),
+            TXTResult(std::vector<std::string>{"bar"}));
+  ASSERT_EQ(pending_.size(), 1u);
+  CompletePending(std::vector<std::string>{"baz"});
+  EXPECT_EQ(LookupTXT(*resolver, "foo"),
+            TXTResult(std::vector<std::string>{"baz"}));
+  // Too stale: waits for a new query.
+  AdvanceTime(Duration::Seconds(25));
+  TXTResult result;
+  resolver->LookupTXT([&](TXTResult r) { result = std::move(r); }, "foo");
+  ASSERT_EQ(pending_.size(), 1u);
+  CompletePending(std::vector<std::string>{"qux"});
+  EXPECT_EQ(result, TXTResult(std::vector<std::string>{"qux"}));
+}
+
+TEST_F(CachingDNSResolverTest, DoesNotCacheFailures) {
+  auto resolver = MakeResolver();
+  TXTResult result;
+  resolver->LookupTXT([&](TXTResult r) { result = std::move(r); }, "foo");
+  CompletePending(absl::UnavailableError("no"));
+  EXPECT_EQ(result.status(), absl::UnavailableError("no"));
+  resolver->LookupTXT([](TXTResult) {}, "foo");
+  EXPECT_EQ(pending_.size(), 1u);
+  CompletePending(absl::UnavailableError("no"));
+}
+
+TEST_F(CachingDNSResolverTest, DNSServersDoNotShare) {
+  auto resolver1 = MakeResolver("1.1.1.1");
+  auto resolver2 = MakeResolver("8.8.8.8");
+  resolver1->LookupTXT([](TXTResult) {}, "foo");
+  resolver2->LookupTXT([](TXTResult) {}, "foo");
+  EXPECT_EQ(pending_.size(), 2u);
+  CompletePending(std::vector<std::string>{"bar"});
+}
+
+}  // namespace
+}  // namespace grpc_event_engine::experimental
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
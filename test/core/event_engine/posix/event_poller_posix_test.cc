@@ -21,6 +21,7 @@
 #include <chrono>
 #include <cstring>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "absl/status/statusor.h"
@@ -55,6 +56,8 @@
 #include "absl/log/absl_log.h"
 #include "absl/status/status.h"
 #include "src/core/lib/event_engine/common_closures.h"
+#include "src/core/lib/event_engine/posix_engine/ev_epoll1_linux.h"
+#include "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller_posix_default.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine.h"
@@ -422,6 +425,61 @@ TEST_F(EventPollerTest, TestEventPollerHandle) {
   EXPECT_EQ(sv.read_bytes_total, cl.write_bytes_total);
 }
 
+// Same as TestEventPollerHandle, but on the io_uring poller, which the
+// default poll strategy never selects.
+TEST_F(EventPollerTest, TestIoUringPollerHandle) {
+  server sv;
+  client cl;
+  int port;
+  if (g_event_poller == nullptr) {
+    return;
+  }
+  std::shared_ptr<PosixEventPoller> io_uring_poller =
+      MakeIoUringPoller(Scheduler());
+  if (io_uring_poller == nullptr) {
+    return;
+  }
+  std::shared_ptr<PosixEventPoller> default_poller =
+      std::exchange(g_event_poller, io_uring_poller);
+  ServerInit(&sv);
+  port = ServerStart(&sv);
+  ClientInit(&cl);
+  ClientStart(&cl, port);
+
+  WaitAndShutdown(&sv, &cl);
+  EXPECT_EQ(sv.read_bytes_total, cl.write_bytes_total);
+  g_event_poller = std::move(default_poller);
+  io_uring_poller->Shutdown();
+}
+
+// Same as TestEventPollerHandle, but with the handles spread over the shards
+// of a sharded epoll1 poller, whose threads run the callbacks.
+TEST_F(EventPollerTest, TestShardedEpoll1PollerHandle) {
+  server sv;
+  client cl;
+  int port;
+  if (g_event_poller == nullptr) {
+    return;
+  }
+  std::shared_ptr<PosixEventPoller> sharded_poller =
+      MakeShardedEpoll1Poller(Scheduler(), /*num_shards=*/2);
+  if (sharded_poller == nullptr) {
+    return;
+  }
+  EXPECT_EQ(sharded_poller->NumShards(), 2);
+  std::shared_ptr<PosixEventPoller> default_poller =
+      std::exchange(g_event_poller, sharded_poller);
+  ServerInit(&sv);
+  port = ServerStart(&sv);
+  ClientInit(&cl);
+  ClientStart(&cl, port);
+
+  WaitAndShutdown(&sv, &cl);
+  EXPECT_EQ(sv.read_bytes_total, cl.write_bytes_total);
+  g_event_poller = std::move(default_poller);
+  sharded_poller->Shutdown();
+}
+
 typedef struct FdChangeData {
   void (*cb_that_ran)(struct FdChangeData*, absl::Status);
 } FdChangeData;
@@ -76,7 +76,8 @@ struct Connection {
 std::list<Connection> CreateConnectedEndpoints(
     PosixEventPoller& poller, bool is_zero_copy_enabled, int num_connections,
     std::shared_ptr<EventEngine> posix_ee,
-    std::shared_ptr<EventEngine> oracle_ee) {
+    std::shared_ptr<EventEngine> oracle_ee,
+    grpc_core::ChannelArgs extra_args = grpc_core::ChannelArgs()) {
   std::list<Connection> connections;
   auto memory_quota = std::make_unique<grpc_core::MemoryQuota>("bar");
   std::string target_addr = absl::StrCat(
@@ -93,13 +94,16 @@ std::list<Connection> CreateConnectedEndpoints(
         server_endpoint = std::move(ep);
         server_signal->Notify();
       };
-  grpc_core::ChannelArgs args;
+  grpc_core::ChannelArgs args = extra_args;
   auto quota = grpc_core::ResourceQuota::Default();
   args = args.Set(GRPC_ARG_RESOURCE_QUOTA, quota);
   if (is_zero_copy_enabled) {
     args = args.Set(GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED, 1);
     args = args.Set(GRPC_ARG_TCP_TX_ZEROCOPY_SEND_BYTES_THRESHOLD,
                     kMinMessageSize);
+    args = args.Set(GRPC_ARG_TCP_RX_ZEROCOPY_ENABLED, 1);
+    args = args.Set(GRPC_ARG_TCP_RX_ZEROCOPY_RECEIVE_BYTES_THRESHOLD,
+                    kMinMessageSize);
   }
   ChannelArgsEndpointConfig config(args);
   auto listener = oracle_ee->CreateListener(
@@ -266,6 +270,41 @@ TEST_P(PosixEndpointTest, ConnectExchangeBidiDataTransferTest) {
   worker->Wait();
 }
 
+// Exchange messages with the client endpoint holding small writes back for
+// coalescing, so every message is written out by the coalescing timer.
+TEST_P(PosixEndpointTest, WriteCoalescingBidiDataTransferTest) {
+  if (PosixPoller() == nullptr) {
+    return;
+  }
+  Worker* worker = new Worker(GetPosixEE(), PosixPoller());
+  worker->Start();
+  {
+    auto connections = CreateConnectedEndpoints(
+        *PosixPoller(), GetParam(), 1, GetPosixEE(), GetOracleEE(),
+        grpc_core::ChannelArgs()
+            .Set(GRPC_ARG_TCP_WRITE_COALESCING_DELAY_US, 100)
+            .Set(GRPC_ARG_TCP_WRITE_COALESCING_MAX_BYTES, 1024 * 1024));
+    auto it = connections.begin();
+    auto client_endpoint = std::move((*it).client_endpoint);
+    auto server_endpoint = std::move((*it).server_endpoint);
+    EXPECT_NE(client_endpoint, nullptr);
+    EXPECT_NE(server_endpoint, nullptr);
+    connections.erase(it);
+
+    for (int i = 0; i < kNumExchangedMessages; i++) {
+      ASSERT_TRUE(SendValidatePayload(GetNextSendMessage(),
+                                      client_endpoint.get(),
+                                      server_endpoint.get())
+                      .ok());
+      ASSERT_TRUE(SendValidatePayload(GetNextSendMessage(),
+                                      server_endpoint.get(),
+                                      client_endpoint.get())
+                      .ok());
+    }
+  }
+  worker->Wait();
+}
+
 // Create  N connections and exchange and verify random number of messages over
 // each connection in parallel.
 TEST_P(PosixEndpointTest, MultipleIPv6ConnectionsToOneOracleListenerTest) {
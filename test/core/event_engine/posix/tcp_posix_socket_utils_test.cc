@@ -27,9 +27,11 @@
 // This test won't work except with posix sockets enabled
 #ifdef GRPC_POSIX_SOCKET_UTILS_COMMON
 
+#include <fcntl.h>
 #include <grpc/support/alloc.h>
 #include <netinet/in.h>
 #include <netinet/ip.h>
+#include <netinet/tcp.h>
 
 #include "src/core/lib/event_engine/posix_engine/tcp_socket_utils.h"
 #include "src/core/lib/iomgr/socket_mutator.h"
@@ -169,6 +171,29 @@ TEST(TcpPosixSocketUtilsTest, SocketOptionsTest) {
   close(sock);
 }
 
+TEST(TcpPosixSocketUtilsTest, ClientSocketIsReadyToConnect) {
+  sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(443);
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  EventEngine::ResolvedAddress target(reinterpret_cast<sockaddr*>(&addr),
+                                      sizeof(addr));
+  PosixTcpOptions options;
+  // Best effort: this must not fail where Fast Open is unavailable.
+  options.tcp_fast_open_connect = true;
+  auto result =
+      PosixSocketWrapper::CreateAndPrepareTcpClientSocket(options, target);
+  ASSERT_TRUE(result.ok()) << result.status();
+  const int fd = result->sock.Fd();
+  EXPECT_NE(fcntl(fd, F_GETFL, 0) & O_NONBLOCK, 0);
+  EXPECT_NE(fcntl(fd, F_GETFD, 0) & FD_CLOEXEC, 0);
+  int nodelay = 0;
+  socklen_t len = sizeof(nodelay);
+  ASSERT_EQ(getsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &nodelay, &len), 0);
+  EXPECT_NE(nodelay, 0);
+  close(fd);
+}
+
 }  // namespace experimental
 }  // namespace grpc_event_engine
 
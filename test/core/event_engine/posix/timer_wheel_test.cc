@@ -0,0 +1,202 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/timer_wheel.h"
+
+#include <grpc/event_engine/event_engine.h>
+
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "src/core/lib/event_engine/posix_engine/timer.h"
+#include "src/core/util/time.h"
+
+namespace grpc_event_engine {
+namespace experimental {
+
+namespace {
+
+class CountingClosure : public experimental::EventEngine::Closure {
+ public:
+  void Run() override { ++run_count; }
+  int run_count = 0;
+};
+
+class FakeHost : public TimerListHost {
+ public:
+  grpc_core::Timestamp Now() override {
+    return grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(now_ms);
+  }
+  void Kick() override { ++kicks; }
+
+  int64_t now_ms = 0;
+  int kicks = 0;
+};
+
+grpc_core::Timestamp Millis(int64_t ms) {
+  return grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(ms);
+}
+
+// Runs the closures returned by a check, and returns how many there were.
+int RunCheck(TimerWheel& wheel, grpc_core::Timestamp* next = nullptr) {
+  auto result = wheel.TimerCheck(next);
+  EXPECT_TRUE(result.has_value());
+  if (!result.has_value()) return 0;
+  for (auto* closure : *result) closure->Run();
+  return result->size();
+}
+
+}  // namespace
+
+TEST(TimerWheelTest, Add) {
+  Timer timers[20];
+  CountingClosure closures[20];
+  FakeHost host;
+  host.now_ms = 100;
+  TimerWheel wheel(&host);
+
+  // 10 ms timers
+  for (int i = 0; i < 10; i++) {
+    wheel.TimerInit(&timers[i], Millis(110), &closures[i]);
+  }
+  // 1010 ms timers
+  for (int i = 10; i < 20; i++) {
+    wheel.TimerInit(&timers[i], Millis(1110), &closures[i]);
+  }
+
+  host.now_ms = 600;
+  EXPECT_EQ(RunCheck(wheel), 10);
+  for (int i = 0; i < 10; i++) EXPECT_EQ(closures[i].run_count, 1);
+  host.now_ms = 700;
+  EXPECT_EQ(RunCheck(wheel), 0);
+  host.now_ms = 1600;
+  EXPECT_EQ(RunCheck(wheel), 10);
+  for (int i = 10; i < 20; i++) EXPECT_EQ(closures[i].run_count, 1);
+  host.now_ms = 1700;
+  EXPECT_EQ(RunCheck(wheel), 0);
+}
+
+// Deadlines on every level of the wheel, including levels whose buckets have
+// to be cascaded more than once and the list past the last level, fire at
+// their exact millisecond.
+TEST(TimerWheelTest, FiresEveryLevelOnTime) {
+  const int64_t kStart = 1000;
+  const std::vector<int64_t> offsets = {
+      0,      1,      63,       64,       65,       4095,     4096,     4097,
+      262143, 262144, 300001,   16777215, 16777216, 20000000, 123456789};
+  std::vector<Timer> timers(offsets.size());
+  std::vector<CountingClosure> closures(offsets.size());
+  FakeHost host;
+  host.now_ms = kStart;
+  TimerWheel wheel(&host);
+  for (size_t i = 0; i < offsets.size(); i++) {
+    wheel.TimerInit(&timers[i], Millis(kStart + offsets[i]), &closures[i]);
+  }
+  for (size_t i = 0; i < offsets.size(); i++) {
+    if (offsets[i] > 0) {
+      host.now_ms = kStart + offsets[i] - 1;
+      EXPECT_EQ(RunCheck(wheel), 0) << "offset " << offsets[i];
+    }
+    host.now_ms = kStart + offsets[i];
+    EXPECT_EQ(RunCheck(wheel), 1) << "offset " << offsets[i];
+    EXPECT_EQ(closures[i].run_count, 1) << "offset " << offsets[i];
+  }
+}
+
+TEST(TimerWheelTest, CancelsPendingTimersOnly) {
+  constexpr int kTimerCount = 1000;
+  std::vector<Timer> timers(kTimerCount);
+  std::vector<CountingClosure> closures(kTimerCount);
+  FakeHost host;
+  TimerWheel wheel(&host);
+  for (int i = 0; i < kTimerCount; i++) {
+    wheel.TimerInit(&timers[i], Millis(1 + i * 37), &closures[i]);
+  }
+  for (int i = 0; i < kTimerCount; i += 2) {
+    EXPECT_TRUE(wheel.TimerCancel(&timers[i]));
+  }
+  host.now_ms = kTimerCount * 37;
+  EXPECT_EQ(RunCheck(wheel), kTimerCount / 2);
+  for (int i = 0; i < kTimerCount; i++) {
+    EXPECT_EQ(closures[i].run_count, i % 2) << i;
+    EXPECT_FALSE(wheel.TimerCancel(&timers[i])) << i;
+  }
+}
+
+TEST(TimerWheelTest, FiresPastDeadlinesOnTheNextCheck) {
+  Timer timer;
+  CountingClosure closure;
+  FakeHost host;
+  host.now_ms = 500;
+  TimerWheel wheel(&host);
+  EXPECT_EQ(RunCheck(wheel), 0);
+  wheel.TimerInit(&timer, Millis(100), &closure);
+  EXPECT_GT(host.kicks, 0);
+  EXPECT_EQ(RunCheck(wheel), 1);
+  EXPECT_EQ(closure.run_count, 1);
+}
+
+TEST(TimerWheelTest, ReportsTheNextWakeup) {
+  Timer timer;
+  CountingClosure closure;
+  FakeHost host;
+  host.now_ms = 100;
+  TimerWheel wheel(&host);
+  wheel.TimerInit(&timer, Millis(5100), &closure);
+  grpc_core::Timestamp next = grpc_core::Timestamp::InfFuture();
+  EXPECT_EQ(RunCheck(wheel, &next), 0);
+  EXPECT_GT(next, Millis(100));
+  EXPECT_LE(next, Millis(5100));
+  // Following the reported wakeups reaches the deadline in a few steps.
+  int wakeups = 0;
+  while (closure.run_count == 0) {
+    ASSERT_LT(++wakeups, 10);
+    host.now_ms = next.milliseconds_after_process_epoch();
+    next = grpc_core::Timestamp::InfFuture();
+    RunCheck(wheel, &next);
+  }
+  EXPECT_EQ(host.now_ms, 5100);
+}
+
+TEST(TimerWheelTest, LongRunningServiceCleanup) {
+  Timer timers[3];
+  CountingClosure closures[3];
+  const int64_t kStart = grpc_core::Duration::Hours(25 * 24).millis();
+  FakeHost host;
+  host.now_ms = kStart;
+  TimerWheel wheel(&host);
+  wheel.TimerInit(&timers[0],
+                  Millis(kStart + grpc_core::Duration::Hours(25 * 24).millis()),
+                  &closures[0]);
+  wheel.TimerInit(&timers[1], Millis(kStart + 3), &closures[1]);
+  wheel.TimerInit(&timers[2], Millis(std::numeric_limits<int64_t>::max() - 1),
+                  &closures[2]);
+  host.now_ms = kStart + 4;
+  EXPECT_EQ(RunCheck(wheel), 1);
+  EXPECT_EQ(closures[1].run_count, 1);
+  EXPECT_TRUE(wheel.TimerCancel(&timers[0]));
+  EXPECT_FALSE(wheel.TimerCancel(&timers[1]));
+  EXPECT_TRUE(wheel.TimerCancel(&timers[2]));
+}
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -16,6 +16,7 @@
 #include <grpc/grpc.h>
 #include <grpc/support/thd_id.h>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cmath>
@@ -31,7 +32,11 @@
 #include "gtest/gtest.h"
 #include "src/core/lib/event_engine/thread_pool/thread_count.h"
 #include "src/core/lib/event_engine/thread_pool/work_stealing_thread_pool.h"
+#include "src/core/lib/event_engine/work_priority.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 #include "src/core/util/notification.h"
+#include "src/core/util/sync.h"
 #include "src/core/util/thd.h"
 #include "src/core/util/time.h"
 #include "test/core/test_util/test_config.h"
@@ -298,6 +303,100 @@ TYPED_TEST(ThreadPoolTest, DISABLED_TestDumpStack) {
   p1.Quiesce();
 }
 
+TEST(WorkStealingThreadPoolTest, ParsesCpuLists) {
+  EXPECT_EQ(WorkStealingThreadPool::ParseCpuList("0-3,8,10-11"),
+            std::vector<int>({0, 1, 2, 3, 8, 10, 11}));
+  EXPECT_EQ(WorkStealingThreadPool::ParseCpuList("5"), std::vector<int>({5}));
+  EXPECT_TRUE(WorkStealingThreadPool::ParseCpuList("").empty());
+  EXPECT_TRUE(WorkStealingThreadPool::ParseCpuList("3-1").empty());
+  EXPECT_TRUE(WorkStealingThreadPool::ParseCpuList("a-b").empty());
+}
+
+TEST(WorkStealingThreadPoolTest, StealsAcrossNumaNodesUnderImbalance) {
+  // Two nodes with no CPUs: threads alternate between the nodes without being
+  // pinned. One worker queues more blocking closures than its node has idle
+  // threads, so the other node has to steal the rest.
+  constexpr int waiter_count = 3;
+  auto before = grpc_core::global_stats().Collect();
+  WorkStealingThreadPool p(4, WorkStealingThreadPool::NumaNodes(2));
+  grpc_core::Notification signal;
+  std::atomic<int> waiters{0};
+  std::atomic<bool> signaled{false};
+  grpc_core::Notification done;
+  p.Run([&]() {
+    for (int i = 0; i < waiter_count; i++) {
+      p.Run([&]() {
+        waiters.fetch_add(1);
+        while (!signaled.load()) {
+          signal.WaitForNotification();
+        }
+      });
+    }
+    while (waiters.load() != waiter_count) {
+      absl::SleepFor(absl::Milliseconds(10));
+    }
+    signaled.store(true);
+    signal.Notify();
+    done.Notify();
+  });
+  done.WaitForNotification();
+  p.Quiesce();
+  auto stats = grpc_core::global_stats().Collect()->Diff(*before);
+  EXPECT_GE(stats->thread_pool_remote_steals, waiter_count - 1);
+  EXPECT_GE(stats->thread_pool_local_steals + stats->thread_pool_remote_steals,
+            waiter_count);
+}
+
+TEST(WorkStealingThreadPoolTest, FavorsTransportIoWithoutStarvingOtherLanes) {
+  // A single thread, blocked while a backlog builds up in every lane, so that
+  // the order it drains them in is deterministic.
+  WorkStealingThreadPool p(1);
+  grpc_core::Notification blocked;
+  grpc_core::Notification unblock;
+  p.Run([&]() {
+    blocked.Notify();
+    unblock.WaitForNotification();
+  });
+  blocked.WaitForNotification();
+  constexpr int kIoCount = 5;
+  constexpr int kDefaultCount = 20;
+  constexpr int kBackgroundCount = 20;
+  grpc_core::Mutex mu;
+  std::vector<WorkPriority> order;
+  grpc_core::Notification done;
+  auto record = [&](WorkPriority priority) {
+    return [&, priority]() {
+      grpc_core::MutexLock lock(&mu);
+      order.push_back(priority);
+      if (order.size() == kIoCount + kDefaultCount + kBackgroundCount) {
+        done.Notify();
+      }
+    };
+  };
+  for (int i = 0; i < kDefaultCount; i++) {
+    p.Run(record(WorkPriority::kDefault));
+  }
+  for (int i = 0; i < kBackgroundCount; i++) {
+    p.Run(record(WorkPriority::kBackground), WorkPriority::kBackground);
+  }
+  for (int i = 0; i < kIoCount; i++) {
+    p.Run(record(WorkPriority::kTransportIo), WorkPriority::kTransportIo);
+  }
+  unblock.Notify();
+  done.WaitForNotification();
+  p.Quiesce();
+  // All transport I/O work runs first, and background work still gets turns
+  // while default work is pending.
+  for (int i = 0; i < kIoCount; i++) {
+    EXPECT_EQ(order[i], WorkPriority::kTransportIo);
+  }
+  auto last_default = std::find(order.rbegin(), order.rend(),
+                                WorkPriority::kDefault);
+  auto first_background =
+      std::find(order.begin(), order.end(), WorkPriority::kBackground);
+  EXPECT_LT(first_background - order.begin(), order.rend() - last_default - 1);
+}
+
 class BusyThreadCountTest : public testing::Test {};
 
 TEST_F(BusyThreadCountTest, StressTest) {
@@ -0,0 +1,193 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "src/core/lib/event_engine/work_queue/lock_free_work_queue.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "absl/functional/any_invocable.h"
+#include "gtest/gtest.h"
+#include "src/core/lib/event_engine/common_closures.h"
+#include "test/core/test_util/test_config.h"
+
+namespace {
+using ::grpc_event_engine::experimental::AnyInvocableClosure;
+using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::LockFreeWorkQueue;
+
+class CountingClosure : public EventEngine::Closure {
+ public:
+  explicit CountingClosure(std::atomic<int>* count) : count_(count) {}
+  void Run() override {
+    count_->fetch_add(1, std::memory_order_relaxed);
+    delete this;
+  }
+
+ private:
+  std::atomic<int>* count_;
+};
+
+TEST(LockFreeWorkQueueTest, StartsEmpty) {
+  LockFreeWorkQueue queue;
+  ASSERT_TRUE(queue.Empty());
+}
+
+TEST(LockFreeWorkQueueTest, TakesClosures) {
+  LockFreeWorkQueue queue;
+  bool ran = false;
+  AnyInvocableClosure closure([&ran] { ran = true; });
+  queue.Add(&closure);
+  ASSERT_FALSE(queue.Empty());
+  EventEngine::Closure* popped = queue.PopMostRecent();
+  ASSERT_NE(popped, nullptr);
+  popped->Run();
+  ASSERT_TRUE(ran);
+  ASSERT_TRUE(queue.Empty());
+}
+
+TEST(LockFreeWorkQueueTest, TakesAnyInvocables) {
+  LockFreeWorkQueue queue;
+  bool ran = false;
+  queue.Add([&ran] { ran = true; });
+  ASSERT_FALSE(queue.Empty());
+  EventEngine::Closure* popped = queue.PopMostRecent();
+  ASSERT_NE(popped, nullptr);
+  popped->Run();
+  ASSERT_TRUE(ran);
+  ASSERT_TRUE(queue.Empty());
+}
+
+TEST(LockFreeWorkQueueTest, OwnerPopMostRecentIsLIFO) {
+  LockFreeWorkQueue queue;
+  int flag = 0;
+  queue.Add([&flag] { flag |= 1; });
+  queue.Add([&flag] { flag |= 2; });
+  queue.PopMostRecent()->Run();
+  EXPECT_FALSE(flag & 1);
+  EXPECT_TRUE(flag & 2);
+  queue.PopMostRecent()->Run();
+  EXPECT_TRUE(flag & 1);
+  EXPECT_TRUE(flag & 2);
+  ASSERT_TRUE(queue.Empty());
+}
+
+TEST(LockFreeWorkQueueTest, PopOldestIsFIFO) {
+  LockFreeWorkQueue queue;
+  int flag = 0;
+  queue.Add([&flag] { flag |= 1; });
+  queue.Add([&flag] { flag |= 2; });
+  queue.PopOldest()->Run();
+  EXPECT_TRUE(flag & 1);
+  EXPECT_FALSE(flag & 2);
+  queue.PopOldest()->Run();
+  EXPECT_TRUE(flag & 1);
+  EXPECT_TRUE(flag & 2);
+  ASSERT_TRUE(queue.Empty());
+}
+
+TEST(LockFreeWorkQueueTest, OtherThreadsStealTheOldestClosure) {
+  LockFreeWorkQueue queue;
+  int flag = 0;
+  queue.Add([&flag] { flag |= 1; });
+  queue.Add([&flag] { flag |= 2; });
+  EventEngine::Closure* stolen = nullptr;
+  std::thread([&] { stolen = queue.PopMostRecent(); }).join();
+  ASSERT_NE(stolen, nullptr);
+  stolen->Run();
+  EXPECT_TRUE(flag & 1);
+  EXPECT_FALSE(flag & 2);
+  queue.PopMostRecent()->Run();
+  EXPECT_TRUE(flag & 2);
+  ASSERT_TRUE(queue.Empty());
+}
+
+TEST(LockFreeWorkQueueTest, AcceptsClosuresFromOtherThreads) {
+  LockFreeWorkQueue queue;
+  bool ran = false;
+  std::thread([&] { queue.Add([&ran] { ran = true; }); }).join();
+  ASSERT_EQ(queue.Size(), 1u);
+  EventEngine::Closure* popped = queue.PopMostRecent();
+  ASSERT_NE(popped, nullptr);
+  popped->Run();
+  ASSERT_TRUE(ran);
+  ASSERT_TRUE(queue.Empty());
+}
+
+TEST(LockFreeWorkQueueTest, OverflowsPastCapacity) {
+  LockFreeWorkQueue queue;
+  constexpr size_t kCount = LockFreeWorkQueue::kDequeCapacity +
+                         LockFreeWorkQueue::kInjectionQueueCapacity + 100;
+  std::atomic<int> run_count{0};
+  for (size_t i = 0; i < kCount; i++) {
+    queue.Add(new CountingClosure(&run_count));
+  }
+  EXPECT_EQ(queue.Size(), kCount);
+  while (auto* c = queue.PopOldest()) c->Run();
+  EXPECT_EQ(run_count.load(), static_cast<int>(kCount));
+  ASSERT_TRUE(queue.Empty());
+}
+
+TEST(LockFreeWorkQueueTest, ThreadedStress) {
+  LockFreeWorkQueue queue;
+  constexpr int kProducerCount = 8;
+  constexpr int kThiefCount = 8;
+  constexpr int kOwnerElementCount = 33333;
+  constexpr int kElementCountPerProducer = 3333;
+  constexpr int kTotal =
+      kOwnerElementCount + kProducerCount * kElementCountPerProducer;
+  std::atomic<int> run_count{0};
+  std::vector<std::thread> threads;
+  threads.reserve(kProducerCount + kThiefCount);
+  for (int i = 0; i < kProducerCount; i++) {
+    threads.emplace_back([&] {
+      for (int j = 0; j < kElementCountPerProducer; j++) {
+        queue.Add(new CountingClosure(&run_count));
+      }
+    });
+  }
+  for (int i = 0; i < kThiefCount; i++) {
+    threads.emplace_back([&] {
+      while (run_count.load(std::memory_order_relaxed) < kTotal) {
+        if (auto* c = queue.PopOldest()) c->Run();
+      }
+    });
+  }
+  // The test thread owns the queue: it keeps adding to and popping from the
+  // deque's bottom while the thieves take from its top.
+  for (int i = 0; i < kOwnerElementCount; i++) {
+    queue.Add(new CountingClosure(&run_count));
+    if (i % 3 == 0) {
+      if (auto* c = queue.PopMostRecent()) c->Run();
+    }
+  }
+  while (run_count.load(std::memory_order_relaxed) < kTotal) {
+    if (auto* c = queue.PopMostRecent()) c->Run();
+  }
+  for (auto& thd : threads) thd.join();
+  EXPECT_EQ(run_count.load(), kTotal);
+  EXPECT_TRUE(queue.Empty());
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  auto result = RUN_ALL_TESTS();
+  return result;
+}
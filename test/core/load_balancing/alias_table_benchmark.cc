@@ -0,0 +1,105 @@
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "absl/random/random.h"
+#include "absl/types/span.h"
+#include "src/core/load_balancing/weighted_target/alias_table.h"
+#include "src/core/util/no_destruct.h"
+
+namespace grpc_core {
+namespace {
+
+const int kNumWeightsLow = 10;
+const int kNumWeightsHigh = 10000;
+const int kRangeMultiplier = 10;
+
+// Returns a list of weights between 1 and 100, as xDS locality weights
+// typically are.
+const std::vector<uint32_t>& Weights() {
+  static const NoDestruct<std::vector<uint32_t>> kWeights([] {
+    absl::BitGen bit_gen;
+    std::vector<uint32_t> weights;
+    weights.reserve(kNumWeightsHigh);
+    for (int i = 0; i < kNumWeightsHigh; ++i) {
+      weights.push_back(absl::Uniform<uint32_t>(bit_gen, 1, 101));
+    }
+    return weights;
+  }());
+  return *kWeights;
+}
+
+void BM_AliasTablePick(benchmark::State& state) {
+  const AliasTable table(absl::MakeSpan(Weights()).subspan(0, state.range(0)));
+  absl::InsecureBitGen bit_gen;
+  for (auto s : state) {
+    benchmark::DoNotOptimize(table.Pick(absl::Uniform<uint64_t>(bit_gen)));
+  }
+}
+BENCHMARK(BM_AliasTablePick)
+    ->RangeMultiplier(kRangeMultiplier)
+    ->Range(kNumWeightsLow, kNumWeightsHigh);
+
+// The cumulative weight binary search that weighted_target used before, for
+// comparison.
+void BM_CumulativeWeightsPick(benchmark::State& state) {
+  std::vector<uint64_t> ends;
+  uint64_t end = 0;
+  for (uint32_t weight :
+       absl::MakeSpan(Weights()).subspan(0, state.range(0))) {
+    end += weight;
+    ends.push_back(end);
+  }
+  absl::InsecureBitGen bit_gen;
+  for (auto s : state) {
+    const uint64_t key = absl::Uniform<uint64_t>(bit_gen, 0, end);
+    benchmark::DoNotOptimize(std::upper_bound(ends.begin(), ends.end(), key));
+  }
+}
+BENCHMARK(BM_CumulativeWeightsPick)
+    ->RangeMultiplier(kRangeMultiplier)
+    ->Range(kNumWeightsLow, kNumWeightsHigh);
+
+void BM_AliasTableMake(benchmark::State& state) {
+  for (auto s : state) {
+    const AliasTable table(
+        absl::MakeSpan(Weights()).subspan(0, state.range(0)));
+    benchmark::DoNotOptimize(table.size());
+  }
+}
+BENCHMARK(BM_AliasTableMake)
+    ->RangeMultiplier(kRangeMultiplier)
+    ->Range(kNumWeightsLow, kNumWeightsHigh);
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -0,0 +1,89 @@
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "src/core/load_balancing/weighted_target/alias_table.h"
+
+#include <stdint.h>
+
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace grpc_core {
+namespace {
+
+using ::testing::ElementsAre;
+
+// Returns i / steps as a 32-bit fraction, rounded up.
+uint64_t Fraction(uint64_t i, uint64_t steps) {
+  return ((i << 32) + steps - 1) / steps;
+}
+
+// Picks with `steps` evenly spaced bucket choices and coin flips, and returns
+// how often each index came up.
+std::vector<uint64_t> CountPicks(const AliasTable& table, uint64_t steps) {
+  std::vector<uint64_t> counts(table.size());
+  for (uint64_t bucket = 0; bucket < steps; ++bucket) {
+    for (uint64_t coin = 0; coin < steps; ++coin) {
+      ++counts[table.Pick((Fraction(bucket, steps) << 32) |
+                          Fraction(coin, steps))];
+    }
+  }
+  return counts;
+}
+
+TEST(AliasTableTest, SingleWeight) {
+  const std::vector<uint32_t> weights = {7};
+  AliasTable table(weights);
+  EXPECT_EQ(table.size(), 1u);
+  EXPECT_EQ(table.Pick(0), 0u);
+  EXPECT_EQ(table.Pick(~uint64_t{0}), 0u);
+}
+
+TEST(AliasTableTest, EqualWeights) {
+  const std::vector<uint32_t> weights = {3, 3, 3, 3};
+  AliasTable table(weights);
+  EXPECT_THAT(CountPicks(table, 100), ElementsAre(2500, 2500, 2500, 2500));
+}
+
+TEST(AliasTableTest, ProportionalToWeights) {
+  const std::vector<uint32_t> weights = {1, 2, 3, 4};
+  AliasTable table(weights);
+  EXPECT_THAT(CountPicks(table, 100), ElementsAre(1000, 2000, 3000, 4000));
+}
+
+TEST(AliasTableTest, SkewedWeights) {
+  const std::vector<uint32_t> weights = {1, 1000, 1};
+  AliasTable table(weights);
+  const std::vector<uint64_t> counts = CountPicks(table, 1002);
+  EXPECT_THAT(counts, ElementsAre(1002, 1002 * 1000, 1002));
+}
+
+TEST(AliasTableTest, LargeWeights) {
+  const std::vector<uint32_t> weights = {0xffffffff, 0xffffffff, 0xffffffff,
+                                         0xffffffff};
+  AliasTable table(weights);
+  EXPECT_THAT(CountPicks(table, 100), ElementsAre(2500, 2500, 2500, 2500));
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
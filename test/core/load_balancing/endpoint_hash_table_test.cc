@@ -0,0 +1,183 @@
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "src/core/load_balancing/ring_hash/endpoint_hash_table.h"
+
+#include <grpc/impl/channel_arg_names.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+#include "gtest/gtest.h"
+#include "src/core/lib/address_utils/parse_address.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/iomgr/resolved_address.h"
+#include "src/core/resolver/endpoint_addresses.h"
+#include "src/core/util/uri.h"
+#include "src/core/util/xxhash_inline.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+std::string MakeAddress(size_t i) {
+  return absl::StrCat("ipv4:127.0.0.1:", 1000 + i);
+}
+
+EndpointAddresses MakeEndpoint(const std::string& address,
+                               const ChannelArgs& args = ChannelArgs()) {
+  grpc_resolved_address resolved_address;
+  EXPECT_TRUE(grpc_parse_uri(URI::Parse(address).value(), &resolved_address));
+  return EndpointAddresses(resolved_address, args);
+}
+
+EndpointAddressesList MakeEndpoints(size_t num_endpoints) {
+  EndpointAddressesList endpoints;
+  for (size_t i = 0; i < num_endpoints; ++i) {
+    endpoints.push_back(MakeEndpoint(MakeAddress(i)));
+  }
+  return endpoints;
+}
+
+// Returns the number of slots of table held by each endpoint.
+std::vector<size_t> CountSlots(const EndpointHashTable& table,
+                               size_t num_endpoints) {
+  std::vector<size_t> counts(num_endpoints);
+  for (size_t i = 0; i < table.size(); ++i) ++counts[table.endpoint_index(i)];
+  return counts;
+}
+
+TEST(HashRingTest, FindsPositionOfEndpointHash) {
+  const EndpointAddressesList endpoints = MakeEndpoints(3);
+  HashRing ring(endpoints, 1024, 4096);
+  ASSERT_GE(ring.size(), 1024u);
+  // The first hash of each endpoint is that of "<address>_0".
+  for (size_t i = 0; i < endpoints.size(); ++i) {
+    const std::string key = absl::StrCat("127.0.0.1:", 1000 + i, "_0");
+    const size_t position = ring.Find(XXH64(key.data(), key.size(), 0));
+    EXPECT_EQ(ring.endpoint_index(position), i);
+  }
+}
+
+TEST(MaglevTableTest, FillsTable) {
+  MaglevTable table(MakeEndpoints(3), 7);
+  EXPECT_EQ(table.size(), 7u);
+  for (size_t i = 0; i < table.size(); ++i) {
+    EXPECT_LT(table.endpoint_index(i), 3u);
+  }
+}
+
+TEST(MaglevTableTest, EmptyEndpointList) {
+  MaglevTable table(EndpointAddressesList(), MaglevTable::kDefaultTableSize);
+  EXPECT_EQ(table.size(), 0u);
+}
+
+TEST(MaglevTableTest, EndpointsGetEqualShares) {
+  constexpr size_t kNumEndpoints = 100;
+  MaglevTable table(MakeEndpoints(kNumEndpoints),
+                    MaglevTable::kDefaultTableSize);
+  ASSERT_EQ(table.size(), MaglevTable::kDefaultTableSize);
+  auto counts = CountSlots(table, kNumEndpoints);
+  auto [min, max] = std::minmax_element(counts.begin(), counts.end());
+  EXPECT_LE(*max - *min, 1u);
+}
+
+TEST(MaglevTableTest, SharesFollowWeights) {
+  EndpointAddressesList endpoints;
+  endpoints.push_back(MakeEndpoint(MakeAddress(0)));
+  endpoints.push_back(MakeEndpoint(
+      MakeAddress(1), ChannelArgs().Set(GRPC_ARG_ADDRESS_WEIGHT, 3)));
+  MaglevTable table(endpoints, MaglevTable::kDefaultTableSize);
+  auto counts = CountSlots(table, 2);
+  EXPECT_NEAR(static_cast<double>(counts[1]) / counts[0], 3.0, 0.01);
+}
+
+TEST(MaglevTableTest, RemovingEndpointMovesFewSlots) {
+  constexpr size_t kNumEndpoints = 100;
+  constexpr size_t kRemoved = 50;
+  EndpointAddressesList endpoints = MakeEndpoints(kNumEndpoints);
+  MaglevTable before(endpoints, MaglevTable::kDefaultTableSize);
+  endpoints.erase(endpoints.begin() + kRemoved);
+  MaglevTable after(endpoints, MaglevTable::kDefaultTableSize);
+  // Count the slots that move between endpoints present in both tables.
+  // Indices past the removed endpoint shift down by one.
+  size_t moved = 0;
+  for (size_t i = 0; i < before.size(); ++i) {
+    size_t old_index = before.endpoint_index(i);
+    if (old_index == kRemoved) continue;
+    if (old_index > kRemoved) --old_index;
+    if (after.endpoint_index(i) != old_index) ++moved;
+  }
+  EXPECT_LT(moved, before.size() / 50);
+}
+
+TEST(MaglevTableTest, IsPrime) {
+  EXPECT_FALSE(MaglevTable::IsPrime(0));
+  EXPECT_FALSE(MaglevTable::IsPrime(1));
+  EXPECT_TRUE(MaglevTable::IsPrime(2));
+  EXPECT_TRUE(MaglevTable::IsPrime(65537));
+  EXPECT_FALSE(MaglevTable::IsPrime(65536));
+  EXPECT_TRUE(MaglevTable::IsPrime(MaglevTable::kMaxTableSize));
+}
+
+TEST(EndpointHashTableTest, SharesTablesWhileInUse) {
+  const EndpointAddressesList endpoints = MakeEndpoints(3);
+  auto key = EndpointHashTableKey::ForMaglevTable(endpoints, 7);
+  EXPECT_EQ(EndpointHashTable::FindShared(key), nullptr);
+  auto table = EndpointHashTable::BuildShared(key, endpoints);
+  EXPECT_EQ(EndpointHashTable::FindShared(key), table);
+  EXPECT_EQ(EndpointHashTable::BuildShared(key, endpoints), table);
+  // Args other than the hash key and weight don't change the table.
+  EndpointAddressesList endpoints_with_args;
+  for (const auto& endpoint : endpoints) {
+    endpoints_with_args.emplace_back(endpoint.addresses(),
+                                     endpoint.args().Set("unrelated", 1));
+  }
+  EXPECT_EQ(EndpointHashTable::FindShared(
+                EndpointHashTableKey::ForMaglevTable(endpoints_with_args, 7)),
+            table);
+  // A different size, kind or weight does.
+  EXPECT_EQ(EndpointHashTable::FindShared(
+                EndpointHashTableKey::ForMaglevTable(endpoints, 11)),
+            nullptr);
+  EXPECT_EQ(EndpointHashTable::FindShared(
+                EndpointHashTableKey::ForHashRing(endpoints, 7, 7)),
+            nullptr);
+  EndpointAddressesList weighted = endpoints;
+  weighted[0] = EndpointAddresses(
+      weighted[0].addresses(),
+      weighted[0].args().Set(GRPC_ARG_ADDRESS_WEIGHT, 2));
+  EXPECT_EQ(EndpointHashTable::FindShared(
+                EndpointHashTableKey::ForMaglevTable(weighted, 7)),
+            nullptr);
+  // Once no one holds it, the table is gone.
+  table.reset();
+  EXPECT_EQ(EndpointHashTable::FindShared(key), nullptr);
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  return RUN_ALL_TESTS();
+}
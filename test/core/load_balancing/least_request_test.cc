@@ -0,0 +1,248 @@
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/grpc.h>
+
+#include <array>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+#include "gtest/gtest.h"
+#include "src/core/config/core_configuration.h"
+#include "src/core/load_balancing/backend_metric_data.h"
+#include "src/core/load_balancing/lb_policy.h"
+#include "src/core/load_balancing/lb_policy_registry.h"
+#include "src/core/util/json/json.h"
+#include "src/core/util/json/json_reader.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "test/core/load_balancing/lb_policy_test_lib.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+using SubchannelCallTracker =
+    LoadBalancingPolicy::SubchannelCallTrackerInterface;
+
+class LeastRequestTest : public LoadBalancingPolicyTest {
+ protected:
+  LeastRequestTest() : LoadBalancingPolicyTest("least_request") {}
+
+  static RefCountedPtr<LoadBalancingPolicy::Config> MakeLeastRequestConfig(
+      absl::string_view json = "{}") {
+    auto config = JsonParse(json);
+    EXPECT_TRUE(config.ok()) << config.status();
+    return MakeConfig(Json::FromArray(
+        {Json::FromObject({{"least_request", std::move(*config)}})}));
+  }
+
+  // Connects every address and returns the picker that includes them all.
+  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker>
+  SendInitialUpdateAndWaitForConnected(
+      absl::Span<const absl::string_view> addresses,
+      RefCountedPtr<LoadBalancingPolicy::Config> config) {
+    EXPECT_EQ(ApplyUpdate(BuildUpdate(addresses, std::move(config)),
+                          lb_policy()),
+              absl::OkStatus());
+    for (size_t i = 0; i < addresses.size(); ++i) {
+      auto* subchannel = FindSubchannel(addresses[i]);
+      EXPECT_NE(subchannel, nullptr) << addresses[i];
+      if (subchannel == nullptr) return nullptr;
+      EXPECT_TRUE(subchannel->ConnectionRequested()) << addresses[i];
+      subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+      if (i == 0) ExpectConnectingUpdate();
+      subchannel->SetConnectivityState(GRPC_CHANNEL_READY);
+    }
+    auto picker = WaitForConnected();
+    while (picker != nullptr && !helper_->QueueEmpty()) {
+      picker = ExpectState(GRPC_CHANNEL_READY);
+    }
+    return picker;
+  }
+
+  // Picks until a call to address is started, then leaves it in flight.
+  std::unique_ptr<SubchannelCallTracker> StartCallTo(
+      LoadBalancingPolicy::SubchannelPicker* picker,
+      absl::string_view address) {
+    for (size_t i = 0; i < 1000; ++i) {
+      std::unique_ptr<SubchannelCallTracker> tracker;
+      auto picked = ExpectPickComplete(picker, {}, {}, &tracker);
+      EXPECT_TRUE(picked.has_value());
+      if (!picked.has_value()) return nullptr;
+      EXPECT_NE(tracker, nullptr);
+      if (tracker == nullptr) return nullptr;
+      // Calls to other addresses are never started, so they are not
+      // counted.
+      if (*picked != address) continue;
+      tracker->Start();
+      return tracker;
+    }
+    ADD_FAILURE() << "never picked " << address;
+    return nullptr;
+  }
+
+  static void FinishCall(std::unique_ptr<SubchannelCallTracker> tracker,
+                         absl::string_view address,
+                         std::optional<BackendMetricData> backend_metrics =
+                             std::nullopt) {
+    FakeMetadata metadata({});
+    FakeBackendMetricAccessor backend_metric_accessor(
+        std::move(backend_metrics));
+    SubchannelCallTracker::FinishArgs args = {
+        address, absl::OkStatus(), &metadata, &backend_metric_accessor};
+    tracker->Finish(args);
+  }
+
+  // Returns the number of num_picks complete, immediately finished, picks
+  // that went to each address.
+  std::map<std::string, size_t> CountPicks(
+      LoadBalancingPolicy::SubchannelPicker* picker, size_t num_picks) {
+    std::map<std::string, size_t> counts;
+    auto picks = GetCompletePicks(picker, num_picks);
+    EXPECT_TRUE(picks.has_value());
+    if (!picks.has_value()) return counts;
+    for (const std::string& address : *picks) ++counts[address];
+    return counts;
+  }
+};
+
+TEST_F(LeastRequestTest, Basic) {
+  const std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
+  auto picker = SendInitialUpdateAndWaitForConnected(
+      kAddresses, MakeLeastRequestConfig());
+  ASSERT_NE(picker, nullptr);
+  // Without load, picks are spread over every endpoint.
+  auto counts = CountPicks(picker.get(), 300);
+  for (absl::string_view address : kAddresses) {
+    EXPECT_GT(counts[std::string(address)], 0u) << address;
+  }
+}
+
+TEST_F(LeastRequestTest, AvoidsEndpointWithCallsInFlight) {
+  const std::array<absl::string_view, 2> kAddresses = {"ipv4:127.0.0.1:441",
+                                                       "ipv4:127.0.0.1:442"};
+  auto picker = SendInitialUpdateAndWaitForConnected(
+      kAddresses, MakeLeastRequestConfig("{\"choiceCount\": 10}"));
+  ASSERT_NE(picker, nullptr);
+  std::vector<std::unique_ptr<SubchannelCallTracker>> in_flight;
+  for (size_t i = 0; i < 5; ++i) {
+    in_flight.push_back(StartCallTo(picker.get(), kAddresses[0]));
+    ASSERT_NE(in_flight.back(), nullptr);
+  }
+  // Address 0 is only picked when all ten choices land on it.
+  auto counts = CountPicks(picker.get(), 100);
+  EXPECT_LE(counts[std::string(kAddresses[0])], 5u);
+  // Once its calls finish, address 0 is picked again.
+  for (auto& tracker : in_flight) {
+    FinishCall(std::move(tracker), kAddresses[0]);
+  }
+  counts = CountPicks(picker.get(), 100);
+  EXPECT_GT(counts[std::string(kAddresses[0])], 10u);
+  EXPECT_GT(counts[std::string(kAddresses[1])], 10u);
+}
+
+TEST_F(LeastRequestTest, PowerOfTwoChoicesByDefault) {
+  const std::array<absl::string_view, 2> kAddresses = {"ipv4:127.0.0.1:441",
+                                                       "ipv4:127.0.0.1:442"};
+  auto picker = SendInitialUpdateAndWaitForConnected(
+      kAddresses, MakeLeastRequestConfig());
+  ASSERT_NE(picker, nullptr);
+  auto tracker = StartCallTo(picker.get(), kAddresses[0]);
+  ASSERT_NE(tracker, nullptr);
+  // Both choices land on address 0 for a quarter of the picks.
+  auto counts = CountPicks(picker.get(), 1000);
+  EXPECT_GT(counts[std::string(kAddresses[0])], 150u);
+  EXPECT_LT(counts[std::string(kAddresses[0])], 350u);
+  FinishCall(std::move(tracker), kAddresses[0]);
+}
+
+TEST_F(LeastRequestTest, OrcaWeighting) {
+  const std::array<absl::string_view, 2> kAddresses = {"ipv4:127.0.0.1:441",
+                                                       "ipv4:127.0.0.1:442"};
+  auto picker = SendInitialUpdateAndWaitForConnected(
+      kAddresses, MakeLeastRequestConfig("{\"choiceCount\": 10, "
+                                         "\"enableOrcaWeighting\": true}"));
+  ASSERT_NE(picker, nullptr);
+  // Address 0 reports that it is fully utilized, address 1 that it is idle.
+  BackendMetricData busy;
+  busy.application_utilization = 1.0;
+  BackendMetricData idle;
+  idle.application_utilization = 0.01;
+  auto tracker = StartCallTo(picker.get(), kAddresses[0]);
+  ASSERT_NE(tracker, nullptr);
+  FinishCall(std::move(tracker), kAddresses[0], busy);
+  tracker = StartCallTo(picker.get(), kAddresses[1]);
+  ASSERT_NE(tracker, nullptr);
+  FinishCall(std::move(tracker), kAddresses[1], idle);
+  // With no calls in flight, the less utilized endpoint wins.
+  auto counts = CountPicks(picker.get(), 100);
+  EXPECT_LE(counts[std::string(kAddresses[0])], 5u);
+}
+
+TEST_F(LeastRequestTest, UtilizationIgnoredWithoutOrcaWeighting) {
+  const std::array<absl::string_view, 2> kAddresses = {"ipv4:127.0.0.1:441",
+                                                       "ipv4:127.0.0.1:442"};
+  auto picker = SendInitialUpdateAndWaitForConnected(
+      kAddresses, MakeLeastRequestConfig("{\"choiceCount\": 10}"));
+  ASSERT_NE(picker, nullptr);
+  BackendMetricData busy;
+  busy.application_utilization = 1.0;
+  auto tracker = StartCallTo(picker.get(), kAddresses[0]);
+  ASSERT_NE(tracker, nullptr);
+  FinishCall(std::move(tracker), kAddresses[0], busy);
+  auto counts = CountPicks(picker.get(), 100);
+  EXPECT_GT(counts[std::string(kAddresses[0])], 10u);
+}
+
+TEST(LeastRequestConfigTest, ChoiceCountTooSmall) {
+  auto json = JsonParse("[{\"least_request\": {\"choiceCount\": 1}}]");
+  ASSERT_TRUE(json.ok()) << json.status();
+  auto config =
+      CoreConfiguration::Get().lb_policy_registry().ParseLoadBalancingConfig(
+          *json);
+  EXPECT_EQ(config.status(),
+            absl::InvalidArgumentError(
+                "errors validating least_request LB policy config: ["
+                "field:choiceCount error:must be at least 2]"));
+}
+
+TEST(LeastRequestConfigTest, LargeChoiceCountAccepted) {
+  auto json = JsonParse("[{\"least_request\": {\"choiceCount\": 100}}]");
+  ASSERT_TRUE(json.ok()) << json.status();
+  auto config =
+      CoreConfiguration::Get().lb_policy_registry().ParseLoadBalancingConfig(
+          *json);
+  EXPECT_TRUE(config.ok()) << config.status();
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -60,6 +60,13 @@ TEST_F(OutlierDetectionConfigParsingTest, ValidConfig) {
       "        \"minimumHosts\":3,\n"
       "        \"requestVolume\":4\n"
       "      },\n"
+      "      \"latencyEjection\":{\n"
+      "        \"percentile\":95,\n"
+      "        \"thresholdFactor\":1500,\n"
+      "        \"enforcementPercentage\":2,\n"
+      "        \"minimumHosts\":3,\n"
+      "        \"requestVolume\":4\n"
+      "      },\n"
       "      \"childPolicy\":[\n"
       "        {\"unknown\":{}},\n"  // Okay, since the next one exists.
       "        {\"grpclb\":{}}\n"
@@ -118,6 +125,37 @@ TEST_F(OutlierDetectionConfigParsingTest, InvalidValues) {
       << service_config.status();
 }
 
+TEST_F(OutlierDetectionConfigParsingTest, InvalidLatencyEjectionValues) {
+  const char* service_config_json =
+      "{\n"
+      "  \"loadBalancingConfig\":[{\n"
+      "    \"outlier_detection_experimental\":{\n"
+      "      \"latencyEjection\":{\n"
+      "        \"percentile\":0,\n"
+      "        \"thresholdFactor\":999,\n"
+      "        \"enforcementPercentage\":101\n"
+      "      },\n"
+      "      \"childPolicy\":[\n"
+      "        {\"round_robin\":{}}\n"
+      "      ]\n"
+      "    }\n"
+      "  }]\n"
+      "}\n";
+  auto service_config =
+      ServiceConfigImpl::Create(ChannelArgs(), service_config_json);
+  EXPECT_EQ(service_config.status().code(), absl::StatusCode::kInvalidArgument);
+  EXPECT_THAT(service_config.status().message(),
+              ::testing::HasSubstr(
+                  "errors validating outlier_detection LB policy config: ["
+                  "field:latencyEjection.enforcement_percentage "
+                  "error:value must be <= 100; "
+                  "field:latencyEjection.percentile "
+                  "error:value must be in the range [1, 100]; "
+                  "field:latencyEjection.threshold_factor "
+                  "error:value must be >= 1000]"))
+      << service_config.status();
+}
+
 TEST_F(OutlierDetectionConfigParsingTest, MissingChildPolicyField) {
   const char* service_config_json =
       "{\n"
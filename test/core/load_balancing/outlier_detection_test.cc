@@ -22,6 +22,7 @@
 #include <algorithm>
 #include <array>
 #include <chrono>
+#include <map>
 #include <memory>
 #include <optional>
 #include <string>
@@ -111,6 +112,19 @@ class OutlierDetectionTest : public LoadBalancingPolicyTest {
       return *this;
     }
 
+    ConfigBuilder& SetLatencyThresholdFactor(uint32_t value) {
+      GetLatency()["thresholdFactor"] = Json::FromNumber(value);
+      return *this;
+    }
+    ConfigBuilder& SetLatencyMinimumHosts(uint32_t value) {
+      GetLatency()["minimumHosts"] = Json::FromNumber(value);
+      return *this;
+    }
+    ConfigBuilder& SetLatencyRequestVolume(uint32_t value) {
+      GetLatency()["requestVolume"] = Json::FromNumber(value);
+      return *this;
+    }
+
     RefCountedPtr<LoadBalancingPolicy::Config> Build() {
       Json::Object fields = json_;
       if (success_rate_.has_value()) {
@@ -120,6 +134,9 @@ class OutlierDetectionTest : public LoadBalancingPolicyTest {
         fields["failurePercentageEjection"] =
             Json::FromObject(*failure_percentage_);
       }
+      if (latency_.has_value()) {
+        fields["latencyEjection"] = Json::FromObject(*latency_);
+      }
       Json config = Json::FromArray(
           {Json::FromObject({{"outlier_detection_experimental",
                               Json::FromObject(std::move(fields))}})});
@@ -137,9 +154,15 @@ class OutlierDetectionTest : public LoadBalancingPolicyTest {
       return *failure_percentage_;
     }
 
+    Json::Object& GetLatency() {
+      if (!latency_.has_value()) latency_.emplace();
+      return *latency_;
+    }
+
     Json::Object json_;
     std::optional<Json::Object> success_rate_;
     std::optional<Json::Object> failure_percentage_;
+    std::optional<Json::Object> latency_;
   };
 
   OutlierDetectionTest()
@@ -234,6 +257,57 @@ TEST_F(OutlierDetectionTest, FailurePercentage) {
   WaitForRoundRobinListChange(remaining_addresses, kAddresses);
 }
 
+TEST_F(OutlierDetectionTest, Latency) {
+  constexpr std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:440", "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442"};
+  // Send initial update.
+  absl::Status status = ApplyUpdate(
+      BuildUpdate(kAddresses, ConfigBuilder()
+                                  .SetLatencyThresholdFactor(2000)
+                                  .SetLatencyMinimumHosts(3)
+                                  .SetLatencyRequestVolume(1)
+                                  .SetMaxEjectionPercent(50)
+                                  .SetMaxEjectionTime(Duration::Seconds(1))
+                                  .SetBaseEjectionTime(Duration::Seconds(1))
+                                  .Build()),
+      lb_policy());
+  EXPECT_TRUE(status.ok()) << status;
+  // Expect normal startup.
+  auto picker = ExpectRoundRobinStartup(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  // Start one call on each address.  Address 2's call takes much longer
+  // than the others.
+  using SubchannelCallTracker =
+      LoadBalancingPolicy::SubchannelCallTrackerInterface;
+  std::map<std::string, std::unique_ptr<SubchannelCallTracker>> trackers;
+  while (trackers.size() < kAddresses.size()) {
+    std::unique_ptr<SubchannelCallTracker> tracker;
+    auto address = ExpectPickComplete(picker.get(), {}, {}, &tracker);
+    ASSERT_TRUE(address.has_value());
+    ASSERT_NE(tracker, nullptr);
+    tracker->Start();
+    trackers.emplace(*address, std::move(tracker));
+  }
+  auto finish_call = [&](absl::string_view address) {
+    FakeMetadata metadata({});
+    FakeBackendMetricAccessor backend_metric_accessor({});
+    LoadBalancingPolicy::SubchannelCallTrackerInterface::FinishArgs args = {
+        address, absl::OkStatus(), &metadata, &backend_metric_accessor};
+    trackers[std::string(address)]->Finish(args);
+  };
+  finish_call(kAddresses[1]);
+  IncrementTimeBy(Duration::Milliseconds(10));
+  finish_call(kAddresses[0]);
+  IncrementTimeBy(Duration::Milliseconds(500));
+  finish_call(kAddresses[2]);
+  // Advance time and run the timer callback to trigger ejection.
+  IncrementTimeBy(Duration::Seconds(10));
+  WaitForRoundRobinListChange(kAddresses, {kAddresses[0], kAddresses[1]});
+  // Advance time and run the timer callback to trigger un-ejection.
+  IncrementTimeBy(Duration::Seconds(10));
+  WaitForRoundRobinListChange({kAddresses[0], kAddresses[1]}, kAddresses);
+}
+
 TEST_F(OutlierDetectionTest, MultipleAddressesPerEndpoint) {
   // Can't use timer duration expectation here, because the Happy
   // Eyeballs timer inside pick_first will use a different duration than
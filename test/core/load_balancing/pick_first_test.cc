@@ -1056,6 +1056,52 @@ TEST_F(PickFirstTest, GoesIdleWhenConnectionFailsThenCanReconnect) {
   }
 }
 
+TEST_F(PickFirstTest, ReconnectStartsWithLastConnectedAddressFamily) {
+  if (!IsPickFirstNewEnabled() || !IsPickFirstPreferConnectedFamilyEnabled()) {
+    GTEST_SKIP() << "pick_first_prefer_connected_family not enabled";
+  }
+  // Send an update containing an IPv4 and an IPv6 address.
+  constexpr std::array<absl::string_view, 2> kAddresses = {
+      "ipv4:127.0.0.1:443", "ipv6:[::1]:444"};
+  absl::Status status = ApplyUpdate(
+      BuildUpdate(kAddresses, MakePickFirstConfig(false)), lb_policy());
+  EXPECT_TRUE(status.ok()) << status;
+  auto* subchannel_ipv4 = FindSubchannel(kAddresses[0]);
+  ASSERT_NE(subchannel_ipv4, nullptr);
+  auto* subchannel_ipv6 = FindSubchannel(kAddresses[1]);
+  ASSERT_NE(subchannel_ipv6, nullptr);
+  // The IPv4 address is attempted first, and fails.
+  EXPECT_TRUE(subchannel_ipv4->ConnectionRequested());
+  subchannel_ipv4->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  ExpectConnectingUpdate();
+  EXPECT_FALSE(subchannel_ipv6->ConnectionRequested());
+  subchannel_ipv4->SetConnectivityState(
+      GRPC_CHANNEL_TRANSIENT_FAILURE,
+      absl::UnavailableError("failed to connect"));
+  subchannel_ipv4->SetConnectivityState(GRPC_CHANNEL_IDLE);
+  // The IPv6 address connects.
+  EXPECT_TRUE(subchannel_ipv6->ConnectionRequested());
+  subchannel_ipv6->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  subchannel_ipv6->SetConnectivityState(GRPC_CHANNEL_READY);
+  auto picker = WaitForConnected();
+  ASSERT_NE(picker, nullptr);
+  EXPECT_EQ(ExpectPickComplete(picker.get()), kAddresses[1]);
+  // The connection is lost, and the LB policy goes IDLE.
+  subchannel_ipv6->SetConnectivityState(GRPC_CHANNEL_IDLE);
+  ExpectReresolutionRequest();
+  ExpectState(GRPC_CHANNEL_IDLE);
+  // When reconnecting, the IPv6 address is attempted first.
+  ExitIdle();
+  EXPECT_TRUE(subchannel_ipv6->ConnectionRequested());
+  EXPECT_FALSE(subchannel_ipv4->ConnectionRequested());
+  subchannel_ipv6->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  ExpectConnectingUpdate();
+  subchannel_ipv6->SetConnectivityState(GRPC_CHANNEL_READY);
+  picker = WaitForConnected();
+  ASSERT_NE(picker, nullptr);
+  EXPECT_EQ(ExpectPickComplete(picker.get()), kAddresses[1]);
+}
+
 TEST_F(PickFirstTest, AddressUpdateRemovedSelectedAddress) {
   if (!IsPickFirstNewEnabled()) return;
   // Send an update containing two addresses.
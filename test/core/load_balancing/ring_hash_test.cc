@@ -32,7 +32,10 @@
 #include "absl/strings/string_view.h"
 #include "absl/strings/strip.h"
 #include "gtest/gtest.h"
+#include "src/core/config/core_configuration.h"
 #include "src/core/load_balancing/lb_policy.h"
+#include "src/core/load_balancing/lb_policy_registry.h"
+#include "src/core/load_balancing/ring_hash/endpoint_hash_table.h"
 #include "src/core/resolver/endpoint_addresses.h"
 #include "src/core/util/json/json.h"
 #include "src/core/util/ref_counted_ptr.h"
@@ -55,7 +58,8 @@ class RingHashTest : public LoadBalancingPolicyTest {
 
   static RefCountedPtr<LoadBalancingPolicy::Config> MakeRingHashConfig(
       int min_ring_size = 0, int max_ring_size = 0,
-      const std::string& request_hash_header = "") {
+      const std::string& request_hash_header = "",
+      int hash_balance_factor = 0) {
     Json::Object fields;
     if (min_ring_size > 0) {
       fields["minRingSize"] = Json::FromString(absl::StrCat(min_ring_size));
@@ -66,6 +70,9 @@ class RingHashTest : public LoadBalancingPolicyTest {
     if (!request_hash_header.empty()) {
       fields["requestHashHeader"] = Json::FromString(request_hash_header);
     }
+    if (hash_balance_factor > 0) {
+      fields["hashBalanceFactor"] = Json::FromNumber(hash_balance_factor);
+    }
     return MakeConfig(Json::FromArray({Json::FromObject(
         {{"ring_hash_experimental", Json::FromObject(fields)}})}));
   }
@@ -317,6 +324,131 @@ TEST_F(RingHashTest, RequestHashHeaderNotPresent) {
   EXPECT_EQ(address, kAddresses[index]);
 }
 
+TEST_F(RingHashTest, HashBalanceFactorSpillsOverloadedEndpoint) {
+  const std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(kAddresses,
+                                    MakeRingHashConfig(0, 0, "", 100)),
+                        lb_policy()),
+            absl::OkStatus());
+  auto picker = ExpectState(GRPC_CHANNEL_IDLE);
+  // Connect every endpoint.
+  for (size_t i = 0; i < kAddresses.size(); ++i) {
+    ExpectPickQueued(picker.get(), {MakeHashAttribute(kAddresses[i])});
+    WaitForWorkSerializerToFlush();
+    WaitForWorkSerializerToFlush();
+    auto* subchannel = FindSubchannel(kAddresses[i]);
+    ASSERT_NE(subchannel, nullptr);
+    EXPECT_TRUE(subchannel->ConnectionRequested());
+    subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+    picker = ExpectState(i == 0 ? GRPC_CHANNEL_CONNECTING : GRPC_CHANNEL_READY);
+    subchannel->SetConnectivityState(GRPC_CHANNEL_READY);
+    picker = ExpectState(GRPC_CHANNEL_READY);
+    while (!helper_->QueueEmpty()) picker = ExpectState(GRPC_CHANNEL_READY);
+  }
+  auto* address0_attribute = MakeHashAttribute(kAddresses[0]);
+  std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>
+      tracker0;
+  auto address = ExpectPickComplete(picker.get(), {address0_attribute}, {},
+                                    &tracker0);
+  EXPECT_EQ(address, kAddresses[0]);
+  ASSERT_NE(tracker0, nullptr);
+  tracker0->Start();
+  // With a factor of 100%, address 0 is at its share of the one call in
+  // flight, so the next call for its key goes to another endpoint.
+  std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>
+      tracker1;
+  address = ExpectPickComplete(picker.get(), {address0_attribute}, {},
+                               &tracker1);
+  ASSERT_TRUE(address.has_value());
+  EXPECT_NE(*address, kAddresses[0]);
+  ASSERT_NE(tracker1, nullptr);
+  tracker1->Start();
+  // Once its call finishes, address 0 gets its key again.
+  FakeMetadata metadata({});
+  FakeBackendMetricAccessor backend_metric_accessor({});
+  tracker0->Finish(
+      {kAddresses[0], absl::OkStatus(), &metadata, &backend_metric_accessor});
+  tracker1->Finish(
+      {*address, absl::OkStatus(), &metadata, &backend_metric_accessor});
+  address = ExpectPickComplete(picker.get(), {address0_attribute});
+  EXPECT_EQ(address, kAddresses[0]);
+}
+
+TEST_F(RingHashTest, HashBalanceFactorTooSmall) {
+  auto config =
+      CoreConfiguration::Get().lb_policy_registry().ParseLoadBalancingConfig(
+          Json::FromArray({Json::FromObject(
+              {{"ring_hash_experimental",
+                Json::FromObject(
+                    {{"hashBalanceFactor", Json::FromNumber(99)}})}})}));
+  EXPECT_EQ(config.status(),
+            absl::InvalidArgumentError(
+                "errors validating ring_hash LB policy config: ["
+                "field:hashBalanceFactor error:must be at least 100]"));
+}
+
+class MaglevTest : public LoadBalancingPolicyTest {
+ protected:
+  MaglevTest() : LoadBalancingPolicyTest("maglev_experimental") {}
+
+  static RefCountedPtr<LoadBalancingPolicy::Config> MakeMaglevConfig(
+      int table_size = 0) {
+    Json::Object fields;
+    if (table_size > 0) fields["tableSize"] = Json::FromNumber(table_size);
+    return MakeConfig(Json::FromArray({Json::FromObject(
+        {{"maglev_experimental", Json::FromObject(fields)}})}));
+  }
+};
+
+TEST_F(MaglevTest, Basic) {
+  const std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
+  EXPECT_EQ(
+      ApplyUpdate(BuildUpdate(kAddresses, MakeMaglevConfig()), lb_policy()),
+      absl::OkStatus());
+  auto picker = ExpectState(GRPC_CHANNEL_IDLE);
+  // Find the endpoint that the table gives our hash.
+  constexpr uint64_t kHash = 12345;
+  MaglevTable table(MakeEndpointAddressesListFromAddressList(kAddresses),
+                    MaglevTable::kDefaultTableSize);
+  const absl::string_view expected_address =
+      kAddresses[table.endpoint_index(table.Find(kHash))];
+  RequestHashAttribute attribute(kHash);
+  ExpectPickQueued(picker.get(), {&attribute});
+  WaitForWorkSerializerToFlush();
+  WaitForWorkSerializerToFlush();
+  auto* subchannel = FindSubchannel(expected_address);
+  ASSERT_NE(subchannel, nullptr);
+  EXPECT_TRUE(subchannel->ConnectionRequested());
+  subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  picker = ExpectState(GRPC_CHANNEL_CONNECTING);
+  ExpectPickQueued(picker.get(), {&attribute});
+  for (absl::string_view address : kAddresses) {
+    if (address != expected_address) {
+      EXPECT_EQ(nullptr, FindSubchannel(address));
+    }
+  }
+  subchannel->SetConnectivityState(GRPC_CHANNEL_READY);
+  picker = ExpectState(GRPC_CHANNEL_READY);
+  auto address = ExpectPickComplete(picker.get(), {&attribute});
+  EXPECT_EQ(address, expected_address);
+}
+
+TEST_F(MaglevTest, TableSizeMustBePrime) {
+  auto config =
+      CoreConfiguration::Get().lb_policy_registry().ParseLoadBalancingConfig(
+          Json::FromArray({Json::FromObject(
+              {{"maglev_experimental",
+                Json::FromObject(
+                    {{"tableSize", Json::FromNumber(65536)}})}})}));
+  EXPECT_EQ(config.status(),
+            absl::InvalidArgumentError(
+                "errors validating maglev LB policy config: ["
+                "field:tableSize error:must be a prime no larger than "
+                "5000011]"));
+}
+
 }  // namespace
 }  // namespace testing
 }  // namespace grpc_core
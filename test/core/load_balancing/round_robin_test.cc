@@ -23,9 +23,15 @@
 #include "absl/strings/string_view.h"
 #include "absl/types/span.h"
 #include "gtest/gtest.h"
+#include "src/core/config/core_configuration.h"
+#include "src/core/load_balancing/lb_policy.h"
+#include "src/core/load_balancing/lb_policy_registry.h"
 #include "src/core/resolver/endpoint_addresses.h"
+#include "src/core/util/json/json.h"
+#include "src/core/util/json/json_reader.h"
 #include "src/core/util/orphanable.h"
 #include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/time.h"
 #include "test/core/load_balancing/lb_policy_test_lib.h"
 #include "test/core/test_util/test_config.h"
 
@@ -36,6 +42,30 @@ namespace {
 class RoundRobinTest : public LoadBalancingPolicyTest {
  protected:
   RoundRobinTest() : LoadBalancingPolicyTest("round_robin") {}
+
+  static RefCountedPtr<LoadBalancingPolicy::Config> MakeRoundRobinConfig(
+      absl::string_view json) {
+    auto config = JsonParse(json);
+    EXPECT_TRUE(config.ok()) << config.status();
+    return MakeConfig(Json::FromArray(
+        {Json::FromObject({{"round_robin", std::move(*config)}})}));
+  }
+
+  // Sends the initial update and has each subchannel report CONNECTING.
+  void SendInitialUpdateAndStartConnecting(
+      absl::Span<const absl::string_view> addresses,
+      RefCountedPtr<LoadBalancingPolicy::Config> config) {
+    EXPECT_EQ(ApplyUpdate(BuildUpdate(addresses, std::move(config)),
+                          lb_policy()),
+              absl::OkStatus());
+    for (absl::string_view address : addresses) {
+      auto* subchannel = FindSubchannel(address);
+      ASSERT_NE(subchannel, nullptr) << address;
+      EXPECT_TRUE(subchannel->ConnectionRequested()) << address;
+      subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+    }
+    DrainConnectingUpdates();
+  }
 };
 
 TEST_F(RoundRobinTest, Basic) {
@@ -67,6 +97,63 @@ TEST_F(RoundRobinTest, AddressUpdates) {
                               absl::MakeSpan(kAddresses).last(2));
 }
 
+TEST_F(RoundRobinTest, WarmUpWaitsForFractionOfEndpoints) {
+  const std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
+  SendInitialUpdateAndStartConnecting(
+      kAddresses, MakeRoundRobinConfig("{\"warmUpFraction\": 0.6}"));
+  // The first READY endpoint is not enough.
+  FindSubchannel(kAddresses[0])->SetConnectivityState(GRPC_CHANNEL_READY);
+  DrainConnectingUpdates();
+  // The second one is.
+  FindSubchannel(kAddresses[1])->SetConnectivityState(GRPC_CHANNEL_READY);
+  auto picker = WaitForConnected();
+  ASSERT_NE(picker, nullptr);
+  ExpectRoundRobinPicks(picker.get(), {kAddresses[0], kAddresses[1]});
+}
+
+TEST_F(RoundRobinTest, WarmUpEndsWhenOtherEndpointsFail) {
+  const std::array<absl::string_view, 2> kAddresses = {"ipv4:127.0.0.1:441",
+                                                       "ipv4:127.0.0.1:442"};
+  SendInitialUpdateAndStartConnecting(
+      kAddresses, MakeRoundRobinConfig("{\"warmUpFraction\": 1}"));
+  FindSubchannel(kAddresses[0])->SetConnectivityState(GRPC_CHANNEL_READY);
+  DrainConnectingUpdates();
+  FindSubchannel(kAddresses[1])->SetConnectivityState(
+      GRPC_CHANNEL_TRANSIENT_FAILURE, absl::UnavailableError("ugh"));
+  ExpectReresolutionRequest();
+  auto picker = WaitForConnected();
+  ASSERT_NE(picker, nullptr);
+  ExpectRoundRobinPicks(picker.get(), {kAddresses[0]});
+}
+
+TEST_F(RoundRobinTest, WarmUpTimeout) {
+  const std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
+  SendInitialUpdateAndStartConnecting(
+      kAddresses, MakeRoundRobinConfig("{\"warmUpFraction\": 1, "
+                                       "\"warmUpTimeout\": \"2s\"}"));
+  FindSubchannel(kAddresses[0])->SetConnectivityState(GRPC_CHANNEL_READY);
+  DrainConnectingUpdates();
+  // When the timer fires, READY is reported with the connected endpoint.
+  IncrementTimeBy(Duration::Seconds(2));
+  auto picker = WaitForConnected();
+  ASSERT_NE(picker, nullptr);
+  ExpectRoundRobinPicks(picker.get(), {kAddresses[0]});
+}
+
+TEST(RoundRobinConfigTest, WarmUpFractionOutOfRange) {
+  auto json = JsonParse("[{\"round_robin\": {\"warmUpFraction\": 1.5}}]");
+  ASSERT_TRUE(json.ok()) << json.status();
+  auto config =
+      CoreConfiguration::Get().lb_policy_registry().ParseLoadBalancingConfig(
+          *json);
+  EXPECT_EQ(config.status(),
+            absl::InvalidArgumentError(
+                "errors validating round_robin LB policy config: ["
+                "field:warmUpFraction error:must be in the range [0, 1]]"));
+}
+
 TEST_F(RoundRobinTest, MultipleAddressesPerEndpoint) {
   constexpr std::array<absl::string_view, 2> kEndpoint1Addresses = {
       "ipv4:127.0.0.1:443", "ipv4:127.0.0.1:444"};
@@ -38,8 +38,11 @@
 #include "absl/time/time.h"
 #include "absl/types/span.h"
 #include "gtest/gtest.h"
+#include "src/core/config/core_configuration.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/load_balancing/backend_metric_data.h"
 #include "src/core/load_balancing/lb_policy.h"
+#include "src/core/load_balancing/lb_policy_registry.h"
 #include "src/core/load_balancing/weighted_target/weighted_target.h"
 #include "src/core/resolver/endpoint_addresses.h"
 #include "src/core/util/debug_location.h"
@@ -854,6 +857,53 @@ TEST_F(WeightedRoundRobinTest, ZeroErrorUtilPenalty) {
       {{kAddresses[0], 1}, {kAddresses[1], 1}, {kAddresses[2], 1}});
 }
 
+TEST_F(WeightedRoundRobinTest, SharesWeightsAcrossChannelsToSameTarget) {
+  if (!IsWrrSharedEndpointWeightsEnabled()) {
+    GTEST_SKIP() << "requires wrr_shared_endpoint_weights experiment";
+  }
+  const std::array<absl::string_view, 2> kAddresses = {"ipv4:127.0.0.1:441",
+                                                       "ipv4:127.0.0.1:442"};
+  auto picker = SendInitialUpdateAndWaitForConnected(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  // Address 0 gets weight 1, address 1 gets weight 3.
+  WaitForWeightedRoundRobinPicks(
+      &picker,
+      {{kAddresses[0], MakeBackendMetricData(/*app_utilization=*/0.9,
+                                             /*qps=*/100.0, /*eps=*/0.0)},
+       {kAddresses[1], MakeBackendMetricData(/*app_utilization=*/0.3,
+                                             /*qps=*/100.0, /*eps=*/0.0)}},
+      {{kAddresses[0], 1}, {kAddresses[1], 3}});
+  // Start a second policy, as for another channel to the same target and
+  // locality.  The subchannels are already connected.
+  auto helper = std::make_unique<FakeHelper>(this);
+  FakeHelper* helper2 = helper.get();
+  LoadBalancingPolicy::Args args = {work_serializer_, std::move(helper),
+                                    channel_args_};
+  OrphanablePtr<LoadBalancingPolicy> lb_policy2 =
+      CoreConfiguration::Get().lb_policy_registry().CreateLoadBalancingPolicy(
+          "weighted_round_robin", std::move(args));
+  ASSERT_NE(lb_policy2, nullptr);
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(kAddresses, ConfigBuilder().Build()),
+                        lb_policy2.get()),
+            absl::OkStatus());
+  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker2;
+  while (!helper2->QueueEmpty()) {
+    auto update = helper2->GetNextStateUpdate();
+    ASSERT_TRUE(update.has_value());
+    if (update->state == GRPC_CHANNEL_READY) picker2 = update->picker;
+  }
+  ASSERT_NE(picker2, nullptr);
+  // Without any reports of its own, the second policy already uses the
+  // weights learned by the first.
+  auto picks = GetCompletePicks(picker2.get(), 400);
+  ASSERT_TRUE(picks.has_value());
+  auto actual = MakePickMap(*picks);
+  EXPECT_NEAR(actual[kAddresses[1]], 300, 10) << PickMapString(actual);
+  picker2.reset();
+  ExecCtx exec_ctx;
+  lb_policy2.reset();
+}
+
 TEST_F(WeightedRoundRobinTest, MultipleAddressesPerEndpoint) {
   // Can't use timer duration expectation here, because the Happy
   // Eyeballs timer inside pick_first will use a different duration than
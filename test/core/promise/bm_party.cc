@@ -15,7 +15,11 @@
 #include <benchmark/benchmark.h>
 #include <grpc/grpc.h>
 
+#include <atomic>
+#include <utility>
+
 #include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/promise/party.h"
 #include "src/core/lib/resource_quota/arena.h"
 
@@ -62,6 +66,102 @@ void BM_WakeupParticipant(benchmark::State& state) {
 }
 BENCHMARK(BM_WakeupParticipant);
 
+// Shared by all threads of the multi-threaded benchmarks below: thread 0 sets
+// it up before the timed loop (which every thread enters together), and the
+// last thread out tears it down.
+struct SharedParty {
+  static constexpr int kMaxThreads = 16;
+  struct Slot {
+    // Set once the participant has stored a fresh waker for its thread.
+    std::atomic<bool> armed{false};
+    std::atomic<bool> stop{false};
+    Waker waker;
+  };
+
+  void Start(benchmark::State& state) {
+    auto arena = SimpleArenaAllocator()->MakeArena();
+    arena->SetContext(
+        grpc_event_engine::experimental::GetDefaultEventEngine().get());
+    party = Party::Make(std::move(arena));
+    running_threads.store(state.threads(), std::memory_order_relaxed);
+    for (auto& slot : slots) {
+      slot.armed.store(false);
+      slot.stop.store(false);
+    }
+  }
+
+  void Finish() {
+    if (running_threads.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      party.reset();
+    }
+  }
+
+  RefCountedPtr<Party> party;
+  std::atomic<int> running_threads{0};
+  Slot slots[kMaxThreads];
+};
+SharedParty g_shared_party;
+
+// Every thread spawns short-lived participants into one party, as the
+// transport's many writers do for a chaotic_good connection.
+void BM_ConcurrentSpawn(benchmark::State& state) {
+  ExecCtx exec_ctx;
+  if (state.thread_index() == 0) g_shared_party.Start(state);
+  for (auto _ : state) {
+    g_shared_party.party->Spawn(
+        "participant", []() { return Success{}; }, [](StatusFlag) {});
+  }
+  state.SetItemsProcessed(state.iterations());
+  g_shared_party.Finish();
+}
+BENCHMARK(BM_ConcurrentSpawn)
+    ->ThreadRange(1, SharedParty::kMaxThreads)
+    ->UseRealTime();
+
+// Every thread repeatedly wakes its own long-lived participant in one party,
+// so that the wakeups contend on the party's state word.
+void BM_ConcurrentWakeup(benchmark::State& state) {
+  ExecCtx exec_ctx;
+  if (state.thread_index() == 0) {
+    g_shared_party.Start(state);
+    for (int i = 0; i < state.threads(); i++) {
+      g_shared_party.party->Spawn(
+          "waiter",
+          [slot = &g_shared_party.slots[i]]() -> Poll<StatusFlag> {
+            if (slot->stop.load()) return Success{};
+            if (slot->armed.load()) return Pending{};
+            slot->waker = GetContext<Activity>()->MakeOwningWaker();
+            slot->armed.store(true);
+            // Either we see the stop flag here, or the benchmark thread sees
+            // the waker we just armed and wakes us one last time.
+            if (slot->stop.load() && slot->armed.exchange(false)) {
+              slot->waker = Waker();
+              return Success{};
+            }
+            return Pending{};
+          },
+          [](StatusFlag) {});
+    }
+  }
+  auto& slot = g_shared_party.slots[state.thread_index()];
+  int64_t wakeups = 0;
+  for (auto _ : state) {
+    if (slot.armed.exchange(false)) {
+      std::exchange(slot.waker, Waker()).Wakeup();
+      ++wakeups;
+    }
+  }
+  state.SetItemsProcessed(wakeups);
+  slot.stop.store(true);
+  if (slot.armed.exchange(false)) {
+    std::exchange(slot.waker, Waker()).Wakeup();
+  }
+  g_shared_party.Finish();
+}
+BENCHMARK(BM_ConcurrentWakeup)
+    ->ThreadRange(1, SharedParty::kMaxThreads)
+    ->UseRealTime();
+
 }  // namespace
 }  // namespace grpc_core
 
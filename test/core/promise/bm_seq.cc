@@ -0,0 +1,149 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <utility>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "src/core/lib/promise/detail/seq_state.h"
+#include "src/core/lib/promise/poll.h"
+#include "src/core/lib/promise/seq.h"
+#include "src/core/lib/promise/try_seq.h"
+
+// Each benchmark polls a filter-like chain to completion, and reports the
+// size of the chain's promise ("sizeof") next to the size the same chain
+// would have without step fusion ("sizeof_unfused").
+
+namespace grpc_core {
+namespace {
+
+// Stands in for the metadata or message a filter step takes and hands on.
+struct Message {
+  char payload[64] = {};
+};
+
+// Resolves to `value` on the second poll.
+template <typename T>
+class PendingOnce {
+ public:
+  explicit PendingOnce(T value) : value_(std::move(value)) {}
+  Poll<T> operator()() {
+    if (!std::exchange(polled_, true)) return Pending{};
+    return std::move(value_);
+  }
+
+ private:
+  T value_;
+  bool polled_ = false;
+};
+
+struct Stamp {
+  Message operator()(Message message) const {
+    ++message.payload[0];
+    return message;
+  }
+};
+
+struct Validate {
+  absl::StatusOr<Message> operator()(Message message) const {
+    if (message.payload[0] < 0) return absl::InvalidArgumentError("bad");
+    return message;
+  }
+};
+
+struct Checksum {
+  int operator()(Message message) const {
+    int sum = 0;
+    for (char c : message.payload) sum += c;
+    return sum;
+  }
+};
+
+struct Send {
+  PendingOnce<absl::Status> operator()(Message) const {
+    return PendingOnce<absl::Status>(absl::OkStatus());
+  }
+};
+
+struct Finish {
+  absl::StatusOr<int> operator()() const { return 0; }
+};
+
+template <typename P>
+void PollToCompletion(benchmark::State& state, P (*make)()) {
+  for (auto _ : state) {
+    auto promise = make();
+    while (promise().pending()) {
+    }
+  }
+  state.counters["sizeof"] = sizeof(P);
+}
+
+// Pull, then a run of synchronous steps: fuses down to a single promise.
+auto MakeSyncChain() {
+  return Seq(PendingOnce<Message>(Message()), Stamp(), Stamp(), Checksum());
+}
+
+void BM_SeqSyncChain(benchmark::State& state) {
+  PollToCompletion(state, &MakeSyncChain);
+  state.counters["sizeof_unfused"] =
+      sizeof(promise_detail::SeqState<promise_detail::SeqTraits,
+                                      PendingOnce<Message>, Stamp, Stamp,
+                                      Checksum>);
+}
+BENCHMARK(BM_SeqSyncChain);
+
+// Pull, validate, send, then report: the shape of a typical filter's message
+// path.
+auto MakeFilterChain() {
+  return TrySeq(PendingOnce<absl::StatusOr<Message>>(Message()), Validate(),
+                Send(), Finish());
+}
+
+void BM_TrySeqFilterChain(benchmark::State& state) {
+  PollToCompletion(state, &MakeFilterChain);
+  state.counters["sizeof_unfused"] =
+      sizeof(promise_detail::SeqState<promise_detail::TrySeqTraits,
+                                      PendingOnce<absl::StatusOr<Message>>,
+                                      Validate, Send, Finish>);
+}
+BENCHMARK(BM_TrySeqFilterChain);
+
+// Synchronous steps following an asynchronous one fuse into its factory.
+auto MakeMixedChain() {
+  return Seq(PendingOnce<Message>(Message()), Stamp(), Send(),
+             [](absl::Status) { return Message(); }, Stamp(), Checksum());
+}
+
+void BM_SeqMixedChain(benchmark::State& state) {
+  PollToCompletion(state, &MakeMixedChain);
+}
+BENCHMARK(BM_SeqMixedChain);
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
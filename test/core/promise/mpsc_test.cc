@@ -192,6 +192,38 @@ TEST(MpscTest, ImmediateSendWorks) {
   activity.Deactivate();
 }
 
+TEST(MpscTest, NextBatchTakesEverythingQueued) {
+  StrictMock<MockActivity> activity;
+  MpscReceiver<Payload> receiver(10);
+  MpscSender<Payload> sender = receiver.MakeSender();
+  activity.Activate();
+  for (int i = 0; i < 5; i++) {
+    EXPECT_TRUE(sender.UnbufferedImmediateSend(MakePayload(i)));
+  }
+  auto batch = receiver.NextBatch(3)();
+  ASSERT_TRUE(batch.ready());
+  ASSERT_TRUE(batch.value().ok());
+  EXPECT_THAT(*batch.value(),
+              ::testing::ElementsAre(MakePayload(0), MakePayload(1),
+                                     MakePayload(2)));
+  // The rest were already received, and come before anything sent later.
+  EXPECT_TRUE(sender.UnbufferedImmediateSend(MakePayload(5)));
+  batch = receiver.NextBatch(3)();
+  ASSERT_TRUE(batch.ready());
+  ASSERT_TRUE(batch.value().ok());
+  EXPECT_THAT(*batch.value(),
+              ::testing::ElementsAre(MakePayload(3), MakePayload(4)));
+  EXPECT_THAT(receiver.Next()(), IsReady(MakePayload(5)));
+  auto next_batch = receiver.NextBatch(3);
+  EXPECT_TRUE(next_batch().pending());
+  EXPECT_CALL(activity, WakeupRequested());
+  receiver.MarkClosed();
+  batch = next_batch();
+  ASSERT_TRUE(batch.ready());
+  EXPECT_FALSE(batch.value().ok());
+  activity.Deactivate();
+}
+
 TEST(MpscTest, CloseFailsNext) {
   StrictMock<MockActivity> activity;
   MpscReceiver<Payload> receiver(1);
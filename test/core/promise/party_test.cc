@@ -157,17 +157,17 @@ auto MakePendingPromise(std::string& execution_order, int num) {
   };
 }
 
-TEST_F(PartyTest, Test16SpawnedPendingPromises) {
-  // This test spawns exactly 16 Promises on one Party.
+TEST_F(PartyTest, TestMaxSpawnedPendingPromises) {
+  // This test spawns exactly kMaxParticipants Promises on one Party.
   // This test asserts the following:
   // 1. All the Promises that are spawned get executed.
   // 2. A Party is able to spawn the Nth Promise even if (N-1) are Pending for
-  //    N<=16.
+  //    N<=kMaxParticipants.
   // 3. on_done callback is never called for a Promise that is not resolved.
-  // Note : If we try to spawn more than 16 Pending Promises on one Party, the
-  // code hangs because it is waiting for the Promises to resolve (Promises in
-  // this test will never resolve).
-  const int kNumPromises = 16;
+  // Note : If we try to spawn more than kMaxParticipants Pending Promises on
+  // one Party, the code hangs because it is waiting for the Promises to resolve
+  // (Promises in this test will never resolve).
+  const int kNumPromises = party_detail::kMaxParticipants;
   std::string execution_order;
   auto party = MakeParty();
   for (int i = 1; i <= kNumPromises; ++i) {
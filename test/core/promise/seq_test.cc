@@ -252,6 +252,53 @@ TEST(SeqTest, SaneSizes) {
   EXPECT_LT(sizeof(p1), 1.05 * sizeof(Big));  // Watchout for size bloat!
 }
 
+TEST(SeqTest, SynchronousStepsAreFused) {
+  std::string execution_order;
+  int polls = 0;
+  auto initial = [&polls]() -> Poll<Big> {
+    if (++polls == 1) return Pending{};
+    Big big;
+    big.x[0] = 1;
+    return big;
+  };
+  auto first = [&execution_order](Big big) {
+    absl::StrAppend(&execution_order, "a");
+    return big.x[0] + 1;
+  };
+  auto wait = [&execution_order](int x) {
+    return [&execution_order, x, polled = false]() mutable -> Poll<int> {
+      absl::StrAppend(&execution_order, "w");
+      if (!std::exchange(polled, true)) return Pending{};
+      return x;
+    };
+  };
+  auto format = [&execution_order](int x) {
+    absl::StrAppend(&execution_order, "f");
+    return absl::StrCat("x=", x);
+  };
+  auto p = Seq(initial, first, wait, format);
+  // Unfused, the sequence would keep the Big result of `initial` as the
+  // argument of a promise made from `first`.
+  EXPECT_LT(sizeof(p), sizeof(Big));
+  EXPECT_GE(sizeof(promise_detail::SeqState<promise_detail::SeqTraits,
+                                            decltype(initial), decltype(first),
+                                            decltype(wait), decltype(format)>),
+            sizeof(Big));
+  EXPECT_TRUE(p().pending());
+  EXPECT_TRUE(p().pending());
+  EXPECT_EQ(p(), Poll<std::string>("x=2"));
+  EXPECT_STREQ(execution_order.c_str(), "awwf");
+}
+
+TEST(SeqTest, AllSynchronousStepsFuseAway) {
+  auto p = Seq([] { return 1; }, [](int x) { return x * 10; },
+               [](int x) { return x + 2; }, [](int) {});
+  EXPECT_EQ(p(), Poll<Empty>(Empty{}));
+  auto q = Seq([] { return 1; }, [](int x) { return x * 10; },
+               [](int x) { return x + 2; });
+  EXPECT_EQ(q(), Poll<int>(12));
+}
+
 TEST(SeqIterTest, Accumulate) {
   std::vector<int> v{1, 2, 3, 4, 5};
   EXPECT_EQ(SeqIter(v.begin(), v.end(), 0,
@@ -295,6 +295,51 @@ TYPED_TEST(TrySeqTest, RawSucceedAndThenValue) {
   EXPECT_STREQ(execution_order.c_str(), "123");
 }
 
+TEST(TrySeqTestBasic, FusedStepsPassFailuresThrough) {
+  std::string execution_order;
+  auto p = TrySeq(
+      [&execution_order]() -> absl::StatusOr<int> {
+        absl::StrAppend(&execution_order, "1");
+        return absl::NotFoundError("nope");
+      },
+      [&execution_order](int x) {
+        absl::StrAppend(&execution_order, "2");
+        return x + 1;
+      },
+      [&execution_order](int) -> absl::Status {
+        absl::StrAppend(&execution_order, "3");
+        return absl::OkStatus();
+      });
+  EXPECT_EQ(p(), Poll<absl::Status>(absl::NotFoundError("nope")));
+  EXPECT_STREQ(execution_order.c_str(), "1");
+}
+
+TEST(TrySeqTestBasic, FusedStepsRunInOrder) {
+  std::string execution_order;
+  auto read = [&execution_order,
+               polled = false]() mutable -> Poll<absl::StatusOr<int>> {
+    absl::StrAppend(&execution_order, "r");
+    if (!std::exchange(polled, true)) return Pending{};
+    return 20;
+  };
+  auto validate = [&execution_order](int x) -> absl::StatusOr<int> {
+    absl::StrAppend(&execution_order, "v");
+    if (x < 0) return absl::InvalidArgumentError("negative");
+    return x;
+  };
+  auto add_one = [&execution_order](int x) {
+    absl::StrAppend(&execution_order, "a");
+    return x + 1;
+  };
+  auto p = TrySeq(read, validate, add_one);
+  EXPECT_LT(sizeof(p), sizeof(promise_detail::SeqState<
+                               promise_detail::TrySeqTraits, decltype(read),
+                               decltype(validate), decltype(add_one)>));
+  EXPECT_TRUE(p().pending());
+  EXPECT_EQ(p(), Poll<absl::StatusOr<int>>(21));
+  EXPECT_STREQ(execution_order.c_str(), "rrva");
+}
+
 TEST(TrySeqIterTest, Ok) {
   std::vector<int> v{1, 2, 3, 4, 5};
   EXPECT_EQ(TrySeqIter(v.begin(), v.end(), 0,
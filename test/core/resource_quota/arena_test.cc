@@ -316,6 +316,60 @@ TEST(ArenaTest, ConcurrentMakePooled) {
   }
 }
 
+TEST(ArenaTest, MakePooledReusesFreedStorage) {
+  struct Metadata {
+    char a[600];
+  };
+  struct SameSizeClass {
+    char a[590];
+  };
+  auto arena = SimpleArenaAllocator()->MakeArena();
+  auto p = arena->MakePooled<Metadata>();
+  void* storage = p.get();
+  p.reset();
+  auto q = arena->MakePooled<SameSizeClass>();
+  EXPECT_EQ(static_cast<void*>(q.get()), storage);
+}
+
+TEST(ArenaTest, MakePooledLargeObjects) {
+  struct Large {
+    char a[arena_detail::kMaxPooledSize + 1];
+  };
+  auto arena = SimpleArenaAllocator()->MakeArena();
+  auto p = arena->MakePooledForOverwrite<Large>();
+  Scribble(p->a, sizeof(p->a), 3);
+  EXPECT_TRUE(IsScribbled(p->a, sizeof(p->a), 3));
+}
+
+// Objects made on one thread and released on another, as with messages handed
+// between a transport and the application.
+TEST(ArenaTest, MakePooledAcrossThreads) {
+  struct TestObj {
+    int a[60];
+  };
+  constexpr int kObjects = 10000;
+  auto arena = SimpleArenaAllocator()->MakeArena();
+  std::vector<Arena::PoolPtr<TestObj>> objs(kObjects);
+  for (int round = 0; round < 3; round++) {
+    Thread producer("grpc_pooled_producer", [&objs, &arena, round] {
+      for (int i = 0; i < kObjects; i++) {
+        objs[i] = arena->MakePooled<TestObj>();
+        Scribble(objs[i]->a, 60, i + round);
+      }
+    });
+    producer.Start();
+    producer.Join();
+    Thread consumer("grpc_pooled_consumer", [&objs, round] {
+      for (int i = 0; i < kObjects; i++) {
+        EXPECT_TRUE(IsScribbled(objs[i]->a, 60, i + round));
+        objs[i].reset();
+      }
+    });
+    consumer.Start();
+    consumer.Join();
+  }
+}
+
 struct Foo {
   explicit Foo(int x) : p(std::make_unique<int>(x)) {}
   std::unique_ptr<int> p;
@@ -0,0 +1,74 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/resource_quota/connection_quota.h"
+
+#include "gtest/gtest.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/util/time.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+
+class FakeTimeSource final : public Timestamp::ScopedSource {
+ public:
+  Timestamp Now() override { return now_; }
+  void Advance(Duration d) { now_ += d; }
+
+ private:
+  Timestamp now_ = Timestamp::FromMillisecondsAfterProcessEpoch(1000);
+};
+
+TEST(ConnectionQuotaTest, MaxIncomingConnections) {
+  auto memory_quota = MakeMemoryQuota("test");
+  auto q = MakeRefCounted<ConnectionQuota>();
+  q->SetMaxIncomingConnections(2);
+  EXPECT_TRUE(q->AllowIncomingConnection(memory_quota, "peer"));
+  EXPECT_TRUE(q->AllowIncomingConnection(memory_quota, "peer"));
+  EXPECT_FALSE(q->AllowIncomingConnection(memory_quota, "peer"));
+  q->ReleaseConnections(1);
+  EXPECT_TRUE(q->AllowIncomingConnection(memory_quota, "peer"));
+  q->ReleaseConnections(2);
+}
+
+TEST(ConnectionQuotaTest, AcceptRateLimit) {
+  FakeTimeSource time_source;
+  auto memory_quota = MakeMemoryQuota("test");
+  auto q = MakeRefCounted<ConnectionQuota>();
+  q->SetMaxIncomingConnectionRate(10);
+  // A full second's worth of connections may arrive at once.
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_TRUE(q->AllowIncomingConnection(memory_quota, "peer"));
+  }
+  EXPECT_FALSE(q->AllowIncomingConnection(memory_quota, "peer"));
+  time_source.Advance(Duration::Milliseconds(100));
+  EXPECT_TRUE(q->AllowIncomingConnection(memory_quota, "peer"));
+  EXPECT_FALSE(q->AllowIncomingConnection(memory_quota, "peer"));
+  // Idle time refills the bucket, but not beyond one second's worth.
+  time_source.Advance(Duration::Seconds(10));
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_TRUE(q->AllowIncomingConnection(memory_quota, "peer"));
+  }
+  EXPECT_FALSE(q->AllowIncomingConnection(memory_quota, "peer"));
+}
+
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
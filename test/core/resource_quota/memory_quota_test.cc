@@ -26,6 +26,7 @@
 #include <vector>
 
 #include "gtest/gtest.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "test/core/resource_quota/call_checker.h"
 #include "test/core/test_util/test_config.h"
@@ -203,6 +204,78 @@ TEST(MemoryQuotaTest, ContainerMemoryAccountedFor) {
   SetContainerMemoryPressure(0.0);
 }
 
+TEST(MemoryQuotaTest, ManyThreadsGiveBackEverything) {
+  MemoryQuota memory_quota("foo");
+  memory_quota.SetSize(64 * 1024 * 1024);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 16; i++) {
+    threads.emplace_back([&memory_quota]() {
+      for (int j = 0; j < 1000; j++) {
+        ExecCtx exec_ctx;
+        auto allocator = memory_quota.CreateMemoryAllocator("bar");
+        for (int k = 0; k < 10; k++) {
+          allocator.Release(allocator.Reserve(MemoryRequest(1024, 8192)));
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  // Whatever is still cached per cpu is bounded well below the quota.
+  auto owner = memory_quota.CreateMemoryOwner();
+  EXPECT_LT(owner.GetPressureInfo().instantaneous_pressure, 1.0 / 16 + 0.01);
+}
+
+TEST(MemoryQuotaTest, ReclaimsLargestAllocatorFirst) {
+  if (!IsReclaimerCostAwareSelectionEnabled()) {
+    GTEST_SKIP() << "reclaimer_cost_aware_selection is disabled";
+  }
+  ExecCtx exec_ctx;
+  MemoryQuota memory_quota("foo");
+  memory_quota.SetSize(16384);
+  auto small = memory_quota.CreateMemoryOwner();
+  auto large = memory_quota.CreateMemoryOwner();
+  small.Reserve(1024);
+  large.Reserve(12288);
+  bool small_reclaimed = false;
+  bool large_reclaimed = false;
+  // The small allocator posts first: strict FIFO would pick it.
+  small.PostReclaimer(ReclamationPass::kDestructive,
+                      [&](std::optional<ReclamationSweep> sweep) {
+                        if (!sweep.has_value()) return;
+                        small_reclaimed = true;
+                        small.Release(1024);
+                      });
+  large.PostReclaimer(ReclamationPass::kDestructive,
+                      [&](std::optional<ReclamationSweep> sweep) {
+                        if (!sweep.has_value()) return;
+                        large_reclaimed = true;
+                        large.Release(12288);
+                      });
+  auto other = memory_quota.CreateMemoryAllocator("bar");
+  other.Reserve(8192);
+  exec_ctx.Flush();
+  EXPECT_TRUE(large_reclaimed);
+  EXPECT_FALSE(small_reclaimed);
+  other.Release(8192);
+}
+
+TEST(MemoryQuotaTest, BufferSizeShrinksSmoothlyUnderPressure) {
+  EXPECT_EQ(BufferSizeUnderMemoryPressure(0.0, 100, 1000), 1000);
+  EXPECT_EQ(BufferSizeUnderMemoryPressure(kBufferShrinkStartPressure, 100,
+                                          1000),
+            1000);
+  EXPECT_DOUBLE_EQ(BufferSizeUnderMemoryPressure(0.75, 100, 1000), 550);
+  EXPECT_EQ(BufferSizeUnderMemoryPressure(1.0, 100, 1000), 100);
+  EXPECT_EQ(BufferSizeUnderMemoryPressure(2.0, 100, 1000), 100);
+  double last = 1000;
+  for (double pressure = 0.5; pressure <= 1.0; pressure += 0.01) {
+    const double size = BufferSizeUnderMemoryPressure(pressure, 100, 1000);
+    EXPECT_LE(size, last);
+    EXPECT_LE(last - size, 20);
+    last = size;
+  }
+}
+
 }  // namespace testing
 
 namespace memory_quota_detail {
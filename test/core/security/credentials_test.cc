@@ -38,6 +38,7 @@
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
 #include "absl/strings/str_replace.h"
+#include "src/core/config/config_vars.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/iomgr/timer_manager.h"
@@ -2561,6 +2562,43 @@ TEST_F(TokenFetcherCredentialsTest, Expires30SecondsEarly) {
   event_engine_->TickUntilIdle();
 }
 
+TEST_F(TokenFetcherCredentialsTest, RefreshesInBackground) {
+  ConfigVars::Overrides overrides;
+  overrides.token_refresh_percent = 50;
+  ConfigVars::SetOverrides(overrides);
+  auto creds = MakeRefCounted<TestTokenFetcherCredentials>(event_engine_);
+  ConfigVars::Reset();
+  std::optional<FuzzingEventEngine::Duration> run_after_duration;
+  event_engine_->SetRunAfterDurationCallback(
+      [&](FuzzingEventEngine::Duration duration) {
+        run_after_duration = duration;
+      });
+  const auto kExpirationTime = Timestamp::Now() + Duration::Hours(1);
+  ExecCtx exec_ctx;
+  creds->AddResult(MakeToken("foo", kExpirationTime));
+  // First request will trigger a fetch.
+  auto state = RequestMetadataState::NewInstance(
+      absl::OkStatus(), "authorization: foo", /*expect_delay=*/true);
+  state->RunRequestMetadataTest(creds.get(), kTestUrlScheme, kTestAuthority,
+                                kTestPath);
+  EXPECT_EQ(creds->num_fetches(), 1);
+  while (!run_after_duration.has_value()) event_engine_->Tick();
+  // The refresh timer runs for half of the token's lifetime, less the
+  // expiration adjustment, with 10% jitter.
+  EXPECT_GE(*run_after_duration, std::chrono::seconds(1606));
+  EXPECT_LE(*run_after_duration, std::chrono::seconds(1964));
+  // The timer refreshes the token without waiting for a call.
+  creds->AddResult(MakeToken("bar"));
+  event_engine_->TickUntilIdle();
+  EXPECT_EQ(creds->num_fetches(), 2);
+  // Next request will use the new token with no delay.
+  state = RequestMetadataState::NewInstance(
+      absl::OkStatus(), "authorization: bar", /*expect_delay=*/false);
+  state->RunRequestMetadataTest(creds.get(), kTestUrlScheme, kTestAuthority,
+                                kTestPath);
+  EXPECT_EQ(creds->num_fetches(), 2);
+}
+
 TEST_F(TokenFetcherCredentialsTest, FetchFails) {
   const absl::Status kExpectedError = absl::UnavailableError("bummer, dude");
   std::optional<FuzzingEventEngine::Duration> run_after_duration;
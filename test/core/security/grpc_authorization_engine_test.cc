@@ -139,6 +139,48 @@ TEST_F(GrpcAuthorizationEngineTest, DenyEngineWithEmptyPolicies) {
   EXPECT_TRUE(decision.matching_policy_name.empty());
 }
 
+TEST_F(GrpcAuthorizationEngineTest, DecisionDependsOnlyOnPath) {
+  std::map<std::string, Rbac::Policy> policies;
+  policies["policy1"] = Rbac::Policy(
+      Rbac::Permission::MakePathPermission(
+          StringMatcher::Create(StringMatcher::Type::kExact, kRpcMethod)
+              .value()),
+      Rbac::Principal::MakeAnyPrincipal());
+  GrpcAuthorizationEngine engine(
+      Rbac("authz", Rbac::Action::kAllow, std::move(policies)));
+  EXPECT_TRUE(engine.DecisionDependsOnlyOnPath());
+}
+
+TEST_F(GrpcAuthorizationEngineTest, DecisionDependsOnHeaders) {
+  std::vector<std::unique_ptr<Rbac::Permission>> rules;
+  rules.push_back(
+      std::make_unique<Rbac::Permission>(Rbac::Permission::MakeHeaderPermission(
+          HeaderMatcher::Create(/*name=*/"foo", HeaderMatcher::Type::kExact,
+                                /*matcher=*/"bar")
+              .value())));
+  std::map<std::string, Rbac::Policy> policies;
+  policies["policy1"] = Rbac::Policy(
+      Rbac::Permission::MakeNotPermission(
+          Rbac::Permission::MakeOrPermission(std::move(rules))),
+      Rbac::Principal::MakeAnyPrincipal());
+  GrpcAuthorizationEngine engine(
+      Rbac("authz", Rbac::Action::kAllow, std::move(policies)));
+  EXPECT_FALSE(engine.DecisionDependsOnlyOnPath());
+}
+
+TEST_F(GrpcAuthorizationEngineTest, DecisionWithAuditLoggingNotCacheable) {
+  std::map<std::string, Rbac::Policy> policies;
+  policies["policy1"] = Rbac::Policy(Rbac::Permission::MakeAnyPermission(),
+                                     Rbac::Principal::MakeAnyPrincipal());
+  Rbac rbac(std::string(kPolicyName), Rbac::Action::kAllow,
+            std::move(policies));
+  rbac.audit_condition = Rbac::AuditCondition::kOnAllow;
+  rbac.logger_configs.push_back(
+      std::make_unique<TestAuditLoggerFactory::Config>());
+  GrpcAuthorizationEngine engine(std::move(rbac));
+  EXPECT_FALSE(engine.DecisionDependsOnlyOnPath());
+}
+
 TEST_F(GrpcAuthorizationEngineTest, AuditLoggerNoneNotInvokedOnAllowedRequest) {
   Rbac::Policy policy1(Rbac::Permission::MakeAnyPermission(),
                        Rbac::Principal::MakeAnyPrincipal());
@@ -604,6 +604,49 @@ TEST(JwtVerifierTest, JwtVerifierBadFormat) {
   grpc_core::HttpRequest::SetOverride(nullptr, nullptr, nullptr);
 }
 
+TEST(JwtVerifierTest, JwtVerifierCachesTokensAndKeys) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_jwt_verifier* verifier = grpc_jwt_verifier_create(nullptr, 0);
+  char* key_str = json_key_str(json_key_str_part3_for_url_issuer);
+  grpc_auth_json_key key = grpc_auth_json_key_create_from_string(key_str);
+  gpr_free(key_str);
+  ASSERT_TRUE(grpc_auth_json_key_is_valid(&key));
+  grpc_core::HttpRequest::SetOverride(httpcli_get_openid_config,
+                                      httpcli_post_should_not_be_called,
+                                      httpcli_put_should_not_be_called);
+  char* jwt = grpc_jwt_encode_and_sign(&key, expected_audience,
+                                       expected_lifetime, nullptr);
+  // A different expiry makes for a different token.
+  char* other_jwt = grpc_jwt_encode_and_sign(
+      &key, expected_audience,
+      gpr_time_sub(expected_lifetime, gpr_time_from_seconds(60, GPR_TIMESPAN)),
+      nullptr);
+  grpc_auth_json_key_destruct(&key);
+  ASSERT_NE(jwt, nullptr);
+  ASSERT_NE(other_jwt, nullptr);
+  grpc_jwt_verifier_verify(verifier, nullptr, jwt, expected_audience,
+                           on_verification_success,
+                           const_cast<char*>(expected_user_data));
+  grpc_core::ExecCtx::Get()->Flush();
+  grpc_core::HttpRequest::SetOverride(httpcli_get_should_not_be_called,
+                                      httpcli_post_should_not_be_called,
+                                      httpcli_put_should_not_be_called);
+  // The token was verified already.
+  grpc_jwt_verifier_verify(verifier, nullptr, jwt, expected_audience,
+                           on_verification_success,
+                           const_cast<char*>(expected_user_data));
+  grpc_core::ExecCtx::Get()->Flush();
+  // The issuer's jwks_uri and keys were fetched already.
+  grpc_jwt_verifier_verify(verifier, nullptr, other_jwt, expected_audience,
+                           on_verification_success,
+                           const_cast<char*>(expected_user_data));
+  grpc_core::ExecCtx::Get()->Flush();
+  grpc_jwt_verifier_destroy(verifier);
+  gpr_free(jwt);
+  gpr_free(other_jwt);
+  grpc_core::HttpRequest::SetOverride(nullptr, nullptr, nullptr);
+}
+
 // find verification key: bad jks, cannot find key in jks
 // bad signature custom provided email
 // bad key
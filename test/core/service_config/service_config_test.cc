@@ -290,6 +290,32 @@ TEST_F(ServiceConfigTest, Parser1DisabledViaChannelArg) {
   EXPECT_EQ((*service_config)->GetGlobalParsedConfig(0), nullptr);
 }
 
+TEST_F(ServiceConfigTest, ParseCacheReusesUnchangedConfig) {
+  ServiceConfigParseCache cache;
+  const char* test_json = "{\"global_param\":5}";
+  auto first = cache.Parse(ChannelArgs(), test_json);
+  ASSERT_TRUE(first.ok()) << first.status();
+  auto second = cache.Parse(ChannelArgs(), test_json);
+  ASSERT_TRUE(second.ok()) << second.status();
+  EXPECT_EQ(first->get(), second->get());
+  // A change to either the text or the args parses again.
+  auto changed = cache.Parse(ChannelArgs(), "{\"global_param\":6}");
+  ASSERT_TRUE(changed.ok()) << changed.status();
+  EXPECT_NE(changed->get(), first->get());
+  EXPECT_EQ((static_cast<TestParsedConfig1*>(
+                 (*changed)->GetGlobalParsedConfig(0)))
+                ->value(),
+            6);
+  auto disabled =
+      cache.Parse(ChannelArgs().Set(GRPC_ARG_DISABLE_PARSING, 1),
+                  "{\"global_param\":6}");
+  ASSERT_TRUE(disabled.ok()) << disabled.status();
+  EXPECT_EQ((*disabled)->GetGlobalParsedConfig(0), nullptr);
+  // Failures are returned again too.
+  EXPECT_FALSE(cache.Parse(ChannelArgs(), "").ok());
+  EXPECT_FALSE(cache.Parse(ChannelArgs(), "").ok());
+}
+
 TEST_F(ServiceConfigTest, Parser1ErrorInvalidType) {
   const char* test_json = "{\"global_param\":[]}";
   auto service_config = ServiceConfigImpl::Create(ChannelArgs(), test_json);
@@ -325,6 +351,29 @@ TEST_F(ServiceConfigTest, Parser2BasicTest) {
   EXPECT_EQ(static_cast<TestParsedConfig1*>(parsed_config)->value(), 5);
 }
 
+TEST_F(ServiceConfigTest, Parser2ExactMethodBeatsServiceWildcard) {
+  const char* test_json =
+      "{\"methodConfig\": ["
+      "{\"name\":[{\"service\":\"a.long.package.TestServ\"}], "
+      "\"method_param\":5},"
+      "{\"name\":[{\"service\":\"a.long.package.TestServ\","
+      "\"method\":\"Special\"}], \"method_param\":6}]}";
+  auto service_config = ServiceConfigImpl::Create(ChannelArgs(), test_json);
+  ASSERT_TRUE(service_config.ok()) << service_config.status();
+  auto get_value = [&](const char* path) -> int {
+    // Copied, so that long paths are refcounted rather than inlined.
+    grpc_slice path_slice = grpc_slice_from_copied_string(path);
+    const auto* vector_ptr =
+        (*service_config)->GetMethodParsedConfigVector(path_slice);
+    grpc_slice_unref(path_slice);
+    if (vector_ptr == nullptr) return -1;
+    return static_cast<TestParsedConfig1*>(((*vector_ptr)[1]).get())->value();
+  };
+  EXPECT_EQ(get_value("/a.long.package.TestServ/Special"), 6);
+  EXPECT_EQ(get_value("/a.long.package.TestServ/Other"), 5);
+  EXPECT_EQ(get_value("/a.long.package.OtherServ/Special"), -1);
+}
+
 TEST_F(ServiceConfigTest, Parser2DisabledViaChannelArg) {
   const ChannelArgs args = ChannelArgs().Set(GRPC_ARG_DISABLE_PARSING, 1);
   const char* test_json =
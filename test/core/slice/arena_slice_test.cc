@@ -0,0 +1,84 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/slice/arena_slice.h"
+
+#include <string.h>
+
+#include <string>
+#include <utility>
+
+#include "gtest/gtest.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_buffer.h"
+
+namespace grpc_core {
+namespace {
+
+bool IsInArena(const Arena* arena, const Slice& slice) {
+  const char* base = reinterpret_cast<const char*>(arena);
+  const char* p = reinterpret_cast<const char*>(slice.data());
+  return p >= base && p < base + arena->TotalUsedBytes();
+}
+
+TEST(ArenaSliceTest, AllocatesFromArena) {
+  auto arena = SimpleArenaAllocator(4096)->MakeArena();
+  MutableSlice slice = MakeArenaSlice(arena.get(), 100);
+  ASSERT_EQ(slice.length(), 100u);
+  memset(slice.data(), 'a', slice.length());
+  EXPECT_TRUE(IsInArena(arena.get(), Slice(std::move(slice))));
+}
+
+TEST(ArenaSliceTest, KeepsArenaAlive) {
+  auto arena = SimpleArenaAllocator()->MakeArena();
+  MutableSlice mutable_slice = MakeArenaSlice(arena.get(), 5);
+  memcpy(mutable_slice.data(), "hello", 5);
+  Slice slice(std::move(mutable_slice));
+  arena.reset();
+  EXPECT_EQ(slice.as_string_view(), "hello");
+  Slice copy = slice.Ref();
+  slice = Slice();
+  EXPECT_EQ(copy.as_string_view(), "hello");
+}
+
+TEST(ArenaSliceTest, MovesSmallBuffersIntoArena) {
+  auto arena = SimpleArenaAllocator(4096)->MakeArena();
+  SliceBuffer buffer;
+  buffer.Append(Slice::FromCopiedString(std::string(100, 'a')));
+  buffer.Append(Slice::FromCopiedString(std::string(100, 'b')));
+  EXPECT_TRUE(MoveIntoArenaSlice(buffer, arena.get(), 1024));
+  ASSERT_EQ(buffer.Count(), 1u);
+  EXPECT_EQ(buffer.JoinIntoString(),
+            std::string(100, 'a') + std::string(100, 'b'));
+  EXPECT_TRUE(IsInArena(arena.get(), buffer.TakeFirst()));
+}
+
+TEST(ArenaSliceTest, LeavesLargeAndEmptyBuffersAlone) {
+  auto arena = SimpleArenaAllocator()->MakeArena();
+  SliceBuffer empty;
+  EXPECT_FALSE(MoveIntoArenaSlice(empty, arena.get(), 1024));
+  SliceBuffer large;
+  large.Append(Slice::FromCopiedString(std::string(2048, 'a')));
+  EXPECT_FALSE(MoveIntoArenaSlice(large, arena.get(), 1024));
+  EXPECT_EQ(large.Length(), 2048u);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,79 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/surface/call_deadline_wheel.h"
+
+#include <grpc/grpc.h>
+
+#include <atomic>
+
+#include "absl/synchronization/notification.h"
+#include "gtest/gtest.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+using grpc_event_engine::experimental::GetDefaultEventEngine;
+
+void Notify(void* arg) { static_cast<absl::Notification*>(arg)->Notify(); }
+
+void Increment(void* arg) { static_cast<std::atomic<int>*>(arg)->fetch_add(1); }
+
+TEST(CallDeadlineWheelTest, RunsCallbacks) {
+  auto wheel = CallDeadlineWheel::Get(GetDefaultEventEngine().get());
+  absl::Notification first;
+  absl::Notification second;
+  CallDeadlineWheel::Entry entry1;
+  CallDeadlineWheel::Entry entry2;
+  const Timestamp start = Timestamp::Now();
+  wheel->Schedule(&entry1, Duration::Milliseconds(1), Notify, &first);
+  wheel->Schedule(&entry2, Duration::Milliseconds(150), Notify, &second);
+  first.WaitForNotification();
+  second.WaitForNotification();
+  EXPECT_GE(Timestamp::Now() - start, Duration::Milliseconds(150));
+  // Entries are cleared once run, so they can be scheduled again.
+  EXPECT_FALSE(wheel->Cancel(&entry1));
+  absl::Notification again;
+  wheel->Schedule(&entry1, Duration::Milliseconds(1), Notify, &again);
+  again.WaitForNotification();
+}
+
+TEST(CallDeadlineWheelTest, CancelPreventsCallback) {
+  auto wheel = CallDeadlineWheel::Get(GetDefaultEventEngine().get());
+  std::atomic<int> runs{0};
+  CallDeadlineWheel::Entry cancelled;
+  wheel->Schedule(&cancelled, Duration::Milliseconds(1), Increment, &runs);
+  EXPECT_TRUE(wheel->Cancel(&cancelled));
+  EXPECT_FALSE(wheel->Cancel(&cancelled));
+  // Once a later entry has run, the cancelled one's tick has passed too.
+  absl::Notification done;
+  CallDeadlineWheel::Entry later;
+  wheel->Schedule(&later, Duration::Milliseconds(50), Notify, &done);
+  done.WaitForNotification();
+  EXPECT_EQ(runs.load(), 0);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
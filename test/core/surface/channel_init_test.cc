@@ -17,8 +17,10 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "absl/strings/string_view.h"
+#include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "src/core/lib/channel/channel_stack.h"
 #include "src/core/lib/channel/channel_stack_builder_impl.h"
@@ -344,6 +346,98 @@ TEST(ChannelInitTest, CanCreateFilterWithCall) {
   EXPECT_EQ(handled, 1);
 }
 
+// Logs its index on each call it sees, so tests can check which filters ran
+// and in what order.
+template <int I>
+class LoggingFilter {
+ public:
+  explicit LoggingFilter(std::vector<int>* log) : log_(log) {}
+
+  static absl::string_view TypeName() { return kNames[I]; }
+
+  static absl::StatusOr<std::unique_ptr<LoggingFilter>> Create(
+      const ChannelArgs& args, ChannelFilter::Args) {
+    return std::make_unique<LoggingFilter>(
+        args.GetPointer<std::vector<int>>("log"));
+  }
+
+  static const grpc_channel_filter kFilter;
+
+  class Call {
+   public:
+    explicit Call(LoggingFilter* filter) { filter->log_->push_back(I); }
+    static const inline NoInterceptor OnClientInitialMetadata;
+    static const inline NoInterceptor OnServerInitialMetadata;
+    static const inline NoInterceptor OnServerTrailingMetadata;
+    static const inline NoInterceptor OnClientToServerMessage;
+    static const inline NoInterceptor OnClientToServerHalfClose;
+    static const inline NoInterceptor OnServerToClientMessage;
+    static const inline NoInterceptor OnFinalize;
+  };
+
+ private:
+  static constexpr absl::string_view kNames[] = {"logging0", "logging1",
+                                                 "logging2", "logging3"};
+  std::vector<int>* const log_;
+};
+
+template <int I>
+const grpc_channel_filter LoggingFilter<I>::kFilter = {
+    nullptr, nullptr, 0,       nullptr,
+    nullptr, nullptr, 0,       nullptr,
+    nullptr, nullptr, nullptr, UniqueTypeNameFor<LoggingFilter<I>>()};
+
+// Builds a client channel stack from init, starts one call on it, and returns
+// the order filters saw it in.
+std::vector<int> FiltersSeenByCall(const ChannelInit& init,
+                                   const ChannelArgs& args) {
+  std::vector<int> log;
+  InterceptionChainBuilder chain_builder{
+      args.Set("log", ChannelArgs::UnownedPointer(&log))};
+  init.AddToInterceptionChainBuilder(GRPC_CLIENT_CHANNEL, chain_builder);
+  auto stack = chain_builder.Build(
+      MakeCallDestinationFromHandlerFunction([](CallHandler) {}));
+  EXPECT_TRUE(stack.ok()) << stack.status();
+  if (!stack.ok()) return log;
+  RefCountedPtr<CallArenaAllocator> allocator =
+      MakeRefCounted<CallArenaAllocator>(
+          ResourceQuota::Default()->memory_quota()->CreateMemoryAllocator(
+              "test"),
+          1024);
+  auto event_engine = grpc_event_engine::experimental::GetDefaultEventEngine();
+  auto arena = allocator->MakeArena();
+  arena->SetContext<grpc_event_engine::experimental::EventEngine>(
+      event_engine.get());
+  auto call = MakeCallPair(Arena::MakePooledForOverwrite<ClientMetadata>(),
+                           std::move(arena));
+  (*stack)->StartCall(std::move(call.handler));
+  return log;
+}
+
+TEST(ChannelInitTest, SealedStacksKeepFiltersAndOrder) {
+  grpc::testing::TestGrpcScope g;
+  ChannelInit::Builder b;
+  b.RegisterFilter<LoggingFilter<0>>(GRPC_CLIENT_CHANNEL);
+  b.RegisterFilter<LoggingFilter<1>>(GRPC_CLIENT_CHANNEL)
+      .After<LoggingFilter<0>>();
+  b.RegisterFilter<LoggingFilter<2>>(GRPC_CLIENT_CHANNEL)
+      .After<LoggingFilter<1>>()
+      .IfChannelArg("use_2", true);
+  b.RegisterFilter<LoggingFilter<3>>(GRPC_CLIENT_CHANNEL)
+      .After<LoggingFilter<2>>();
+  b.RegisterSealedStack<LoggingFilter<1>, LoggingFilter<2>>(
+      GRPC_CLIENT_CHANNEL);
+  b.RegisterSealedStack<LoggingFilter<0>, LoggingFilter<3>>(
+      GRPC_CLIENT_CHANNEL);
+  auto init = b.Build();
+  // 1 and 2 are sealed together.
+  EXPECT_THAT(FiltersSeenByCall(init, ChannelArgs()),
+              ::testing::ElementsAre(0, 1, 2, 3));
+  // Without 2, 1 is added on its own; 0 and 3 are never adjacent.
+  EXPECT_THAT(FiltersSeenByCall(init, ChannelArgs().Set("use_2", false)),
+              ::testing::ElementsAre(0, 1, 3));
+}
+
 }  // namespace
 }  // namespace grpc_core
 
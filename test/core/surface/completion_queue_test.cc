@@ -23,6 +23,7 @@
 #include <grpc/support/time.h>
 #include <stddef.h>
 
+#include <algorithm>
 #include <memory>
 
 #include "absl/log/absl_log.h"
@@ -170,6 +171,52 @@ TEST(GrpcCompletionQueueTest, TestCqEndOp) {
   }
 }
 
+TEST(GrpcCompletionQueueTest, TestNextBatch) {
+  grpc_event events[4];
+  grpc_cq_completion completions[3];
+  void* tags[3];
+  grpc_completion_queue* cc;
+
+  LOG_TEST("test_next_batch");
+
+  grpc_core::ExecCtx exec_ctx;
+  cc = grpc_completion_queue_create_for_next(nullptr);
+  for (size_t i = 0; i < GPR_ARRAY_SIZE(tags); i++) {
+    tags[i] = create_test_tag();
+    ASSERT_TRUE(grpc_cq_begin_op(cc, tags[i]));
+    grpc_cq_end_op(cc, tags[i], absl::OkStatus(), do_nothing_end_completion,
+                   nullptr, &completions[i]);
+  }
+
+  // The first call reads as many of the queued events as it can, and the
+  // second reads the rest, without waiting for more. The queue does not
+  // promise an order.
+  ASSERT_EQ(grpc_completion_queue_next_batch(
+                cc, events, 2, gpr_inf_past(GPR_CLOCK_REALTIME), nullptr),
+            2u);
+  ASSERT_EQ(grpc_completion_queue_next_batch(
+                cc, events + 2, GPR_ARRAY_SIZE(events) - 2,
+                gpr_inf_past(GPR_CLOCK_REALTIME), nullptr),
+            1u);
+  std::sort(events, events + GPR_ARRAY_SIZE(tags),
+            [](const grpc_event& a, const grpc_event& b) {
+              return reinterpret_cast<intptr_t>(a.tag) <
+                     reinterpret_cast<intptr_t>(b.tag);
+            });
+  for (size_t i = 0; i < GPR_ARRAY_SIZE(tags); i++) {
+    ASSERT_EQ(events[i].type, GRPC_OP_COMPLETE);
+    ASSERT_EQ(events[i].tag, tags[i]);
+  }
+  // A timeout is the only event returned.
+  ASSERT_EQ(grpc_completion_queue_next_batch(
+                cc, events, GPR_ARRAY_SIZE(events),
+                gpr_inf_past(GPR_CLOCK_REALTIME), nullptr),
+            1u);
+  ASSERT_EQ(events[0].type, GRPC_QUEUE_TIMEOUT);
+
+  shutdown_and_destroy(cc);
+}
+
 TEST(GrpcCompletionQueueTest, TestCqTlsCacheFull) {
   grpc_event ev;
   grpc_completion_queue* cc;
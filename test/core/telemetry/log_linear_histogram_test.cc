@@ -0,0 +1,93 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/telemetry/log_linear_histogram.h"
+
+#include <stdint.h>
+
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace grpc_core {
+namespace {
+
+TEST(LogLinearHistogramShapeTest, SmallValuesAreExact) {
+  LogLinearHistogramShape shape(3, 1000000);
+  for (uint64_t i = 0; i < 8; ++i) {
+    EXPECT_EQ(shape.BucketFor(i), i);
+    EXPECT_EQ(shape.LowerBound(i), i);
+  }
+}
+
+TEST(LogLinearHistogramShapeTest, BucketsBoundRelativeError) {
+  LogLinearHistogramShape shape(3, 1000000);
+  for (uint64_t value = 1; value <= 1000000; value = value * 3 / 2 + 1) {
+    const size_t bucket = shape.BucketFor(value);
+    const uint64_t lower = shape.LowerBound(bucket);
+    EXPECT_LE(lower, value);
+    EXPECT_GT(shape.LowerBound(bucket + 1), value);
+    EXPECT_LE(value - lower, value / 8) << value;
+  }
+}
+
+TEST(LogLinearHistogramShapeTest, ClampsToMax) {
+  LogLinearHistogramShape shape(3, 1000);
+  EXPECT_EQ(shape.BucketFor(1000000), shape.num_buckets() - 1);
+}
+
+TEST(LogLinearHistogramTest, Percentiles) {
+  LogLinearHistogram histogram(LogLinearHistogramShape(7, 1000000));
+  for (uint64_t i = 1; i <= 10000; ++i) histogram.Record(i);
+  EXPECT_EQ(histogram.Count(), 10000u);
+  EXPECT_NEAR(histogram.Percentile(50), 5000, 5000 / 128.0);
+  EXPECT_NEAR(histogram.Percentile(99.9), 9990, 9990 / 128.0);
+}
+
+TEST(LogLinearHistogramTest, MergeAndDiff) {
+  LogLinearHistogramShape shape(4, 100000);
+  LogLinearHistogram a(shape);
+  LogLinearHistogram b(shape);
+  a.Record(10, 3);
+  b.Record(50000);
+  LogLinearHistogram merged = a;
+  merged.Merge(b);
+  EXPECT_EQ(merged.Count(), 4u);
+  LogLinearHistogram diff = merged - a;
+  EXPECT_EQ(diff.Count(), 1u);
+  EXPECT_EQ(diff.buckets()[shape.BucketFor(50000)], 1u);
+}
+
+TEST(LogLinearHistogramCollectorTest, CollectsFromAllThreads) {
+  LogLinearHistogramCollector collector(LogLinearHistogramShape(5, 1 << 20));
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 8; ++t) {
+    threads.emplace_back([&collector]() {
+      for (uint64_t i = 0; i < 1000; ++i) collector.Record(i);
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  LogLinearHistogram histogram = collector.Collect();
+  EXPECT_EQ(histogram.Count(), 8000u);
+  EXPECT_EQ(histogram.buckets()[0], 8u);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
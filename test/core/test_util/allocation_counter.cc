@@ -0,0 +1,81 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "test/core/test_util/allocation_counter.h"
+
+#include <stdlib.h>
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+
+#include "absl/base/config.h"
+
+#if defined(ABSL_HAVE_ADDRESS_SANITIZER) ||  \
+    defined(ABSL_HAVE_MEMORY_SANITIZER) ||   \
+    defined(ABSL_HAVE_THREAD_SANITIZER) ||   \
+    defined(ABSL_HAVE_HWADDRESS_SANITIZER) || \
+    defined(ABSL_HAVE_LEAK_SANITIZER)
+#define GRPC_ALLOCATION_COUNTER_DISABLED
+#endif
+
+namespace grpc_core {
+namespace testing {
+namespace {
+std::atomic<uint64_t> g_heap_allocations{0};
+}  // namespace
+
+#ifdef GRPC_ALLOCATION_COUNTER_DISABLED
+bool HeapAllocationCountingEnabled() { return false; }
+#else
+bool HeapAllocationCountingEnabled() { return true; }
+#endif
+
+uint64_t HeapAllocationCount() {
+  return g_heap_allocations.load(std::memory_order_relaxed);
+}
+
+}  // namespace testing
+}  // namespace grpc_core
+
+#ifndef GRPC_ALLOCATION_COUNTER_DISABLED
+
+namespace {
+void* CountedAlloc(size_t size) {
+  grpc_core::testing::g_heap_allocations.fetch_add(1,
+                                                   std::memory_order_relaxed);
+  return malloc(size == 0 ? 1 : size);
+}
+}  // namespace
+
+void* operator new(size_t size) {
+  void* p = CountedAlloc(size);
+  if (p == nullptr) abort();
+  return p;
+}
+void* operator new[](size_t size) { return operator new(size); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+  return CountedAlloc(size);
+}
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+  return CountedAlloc(size);
+}
+void operator delete(void* p) noexcept { free(p); }
+void operator delete[](void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+void operator delete[](void* p, size_t) noexcept { free(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { free(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { free(p); }
+
+#endif  // GRPC_ALLOCATION_COUNTER_DISABLED
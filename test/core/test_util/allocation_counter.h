@@ -0,0 +1,35 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_TEST_CORE_TEST_UTIL_ALLOCATION_COUNTER_H
+#define GRPC_TEST_CORE_TEST_UTIL_ALLOCATION_COUNTER_H
+
+#include <stdint.h>
+
+namespace grpc_core {
+namespace testing {
+
+// Linking this library replaces the global operator new and delete with ones
+// that count allocations, so that benchmarks can report the allocations made
+// on the path they measure. The count covers every thread in the process.
+//
+// Sanitizers bring their own allocator, so nothing is replaced under them and
+// HeapAllocationCountingEnabled() is false.
+bool HeapAllocationCountingEnabled();
+uint64_t HeapAllocationCount();
+
+}  // namespace testing
+}  // namespace grpc_core
+
+#endif  // GRPC_TEST_CORE_TEST_UTIL_ALLOCATION_COUNTER_H
@@ -15,9 +15,11 @@
 #include <benchmark/benchmark.h>
 #include <grpc/grpc.h>
 
+#include "absl/log/check.h"
 #include "absl/memory/memory.h"
 #include "absl/strings/string_view.h"
 #include "src/core/ext/transport/chaotic_good/client_transport.h"
+#include "src/core/ext/transport/chaotic_good/frame.h"
 #include "src/core/ext/transport/chaotic_good/server_transport.h"
 #include "src/core/lib/address_utils/parse_address.h"
 #include "test/core/test_util/passthrough_endpoint.h"
@@ -95,6 +97,46 @@ class ChaoticGoodTraits {
 };
 GRPC_CALL_SPINE_BENCHMARK(TransportFixture<ChaoticGoodTraits>);
 
+ClientMetadataHandle MakeTypicalClientMetadata() {
+  auto md = Arena::MakePooledForOverwrite<ClientMetadata>();
+  md->Set(HttpPathMetadata(), kTestPath.Copy());
+  md->Set(HttpAuthorityMetadata(), Slice::FromExternalString("foo.test"));
+  md->Set(GrpcTimeoutMetadata(), Timestamp::Now() + Duration::Seconds(30));
+  md->Append("x-custom-header", Slice::FromExternalString("some-value"),
+             [](absl::string_view, const Slice&) { Crash("append failed"); });
+  return md;
+}
+
+// The metadata half of the frame codec, without the transport around it.
+void BM_ClientMetadataEncode(benchmark::State& state) {
+  ExecCtx exec_ctx;
+  auto md = MakeTypicalClientMetadata();
+  AllocationCounters allocation_counters(state);
+  SliceBuffer out;
+  for (auto _ : state) {
+    chaotic_good::WriteProto(chaotic_good::ClientMetadataProtoFromGrpc(*md),
+                             out);
+    out.Clear();
+  }
+}
+BENCHMARK(BM_ClientMetadataEncode);
+
+void BM_ClientMetadataDecode(benchmark::State& state) {
+  ExecCtx exec_ctx;
+  SliceBuffer encoded;
+  chaotic_good::WriteProto(
+      chaotic_good::ClientMetadataProtoFromGrpc(*MakeTypicalClientMetadata()),
+      encoded);
+  AllocationCounters allocation_counters(state);
+  for (auto _ : state) {
+    chaotic_good_frame::ClientMetadata proto;
+    ABSL_CHECK_OK(chaotic_good::ReadProto(encoded.Copy(), proto));
+    auto md = chaotic_good::ClientMetadataGrpcFromProto(proto);
+    ABSL_CHECK_OK(md);
+  }
+}
+BENCHMARK(BM_ClientMetadataDecode);
+
 }  // namespace
 }  // namespace grpc_core
 
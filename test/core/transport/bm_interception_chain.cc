@@ -0,0 +1,153 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <grpc/grpc.h>
+
+#include <memory>
+
+#include "absl/log/check.h"
+#include "absl/status/statusor.h"
+#include "src/core/lib/channel/promise_based_filter.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/transport/interception_chain.h"
+#include "test/core/transport/call_spine_benchmarks.h"
+
+// Runs calls through interception chains built the way channels build them,
+// so that the cost of the chain's adaptors and of each interceptor hop shows
+// up on top of the bare spine measured by bm_call_spine.
+
+namespace grpc_core {
+namespace {
+
+const Slice kTestPath = Slice::FromExternalString("/foo/bar");
+
+// A filter that looks at its call's client initial metadata, like most.
+template <int kIndex>
+class PassiveFilter {
+ public:
+  class Call {
+   public:
+    void OnClientInitialMetadata(ClientMetadata&) {}
+    static const inline NoInterceptor OnServerInitialMetadata;
+    static const inline NoInterceptor OnClientToServerMessage;
+    static const inline NoInterceptor OnClientToServerHalfClose;
+    static const inline NoInterceptor OnServerToClientMessage;
+    static const inline NoInterceptor OnServerTrailingMetadata;
+    static const inline NoInterceptor OnFinalize;
+  };
+
+  static absl::StatusOr<std::unique_ptr<PassiveFilter>> Create(
+      const ChannelArgs&, ChannelFilter::Args) {
+    return std::make_unique<PassiveFilter>();
+  }
+};
+
+template <int kIndex>
+class PassThroughInterceptor final : public Interceptor {
+ public:
+  void InterceptCall(UnstartedCallHandler unstarted_call_handler) override {
+    PassThrough(std::move(unstarted_call_handler));
+  }
+  void Orphaned() override {}
+
+  static absl::StatusOr<RefCountedPtr<PassThroughInterceptor>> Create(
+      const ChannelArgs&, ChannelFilter::Args) {
+    return MakeRefCounted<PassThroughInterceptor>();
+  }
+};
+
+class ChainTraitsBase {
+ public:
+  ClientMetadataHandle MakeClientInitialMetadata() {
+    auto md = Arena::MakePooledForOverwrite<ClientMetadata>();
+    md->Set(HttpPathMetadata(), kTestPath.Copy());
+    return md;
+  }
+
+  ServerMetadataHandle MakeServerInitialMetadata() {
+    return Arena::MakePooledForOverwrite<ServerMetadata>();
+  }
+
+  MessageHandle MakePayload() { return Arena::MakePooled<Message>(); }
+
+  ServerMetadataHandle MakeServerTrailingMetadata() {
+    return Arena::MakePooledForOverwrite<ServerMetadata>();
+  }
+
+ protected:
+  static ChannelArgs MakeChannelArgs() {
+    return ChannelArgs().SetObject(
+        grpc_event_engine::experimental::GetDefaultEventEngine());
+  }
+};
+
+// Four filters and no interceptors: one filter stack in front of the
+// destination.
+class FiltersOnlyTraits : public ChainTraitsBase {
+ public:
+  RefCountedPtr<UnstartedCallDestination> CreateCallDestination(
+      RefCountedPtr<UnstartedCallDestination> final_destination) {
+    auto chain = InterceptionChainBuilder(MakeChannelArgs())
+                     .Add<PassiveFilter<0>>()
+                     .Add<PassiveFilter<1>>()
+                     .Add<PassiveFilter<2>>()
+                     .Add<PassiveFilter<3>>()
+                     .Build(std::move(final_destination));
+    ABSL_CHECK_OK(chain);
+    return std::move(*chain);
+  }
+};
+GRPC_CALL_SPINE_BENCHMARK(UnstartedCallDestinationFixture<FiltersOnlyTraits>);
+
+// The same filters split by two interceptors, so that each call crosses
+// three filter stacks and two interceptor hops.
+class WithInterceptorsTraits : public ChainTraitsBase {
+ public:
+  RefCountedPtr<UnstartedCallDestination> CreateCallDestination(
+      RefCountedPtr<UnstartedCallDestination> final_destination) {
+    auto chain = InterceptionChainBuilder(MakeChannelArgs())
+                     .Add<PassiveFilter<0>>()
+                     .Add<PassThroughInterceptor<0>>()
+                     .Add<PassiveFilter<1>>()
+                     .Add<PassiveFilter<2>>()
+                     .Add<PassThroughInterceptor<1>>()
+                     .Add<PassiveFilter<3>>()
+                     .Build(std::move(final_destination));
+    ABSL_CHECK_OK(chain);
+    return std::move(*chain);
+  }
+};
+GRPC_CALL_SPINE_BENCHMARK(
+    UnstartedCallDestinationFixture<WithInterceptorsTraits>);
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+  grpc_init();
+  {
+    auto ee = grpc_event_engine::experimental::GetDefaultEventEngine();
+    benchmark::RunTheBenchmarksNamespaced();
+  }
+  grpc_shutdown();
+  return 0;
+}
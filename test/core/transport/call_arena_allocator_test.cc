@@ -30,6 +30,7 @@
 #include <string>
 #include <vector>
 
+#include "absl/strings/str_cat.h"
 #include "absl/strings/str_join.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -71,6 +72,51 @@ TEST(CallArenaAllocatorTest, SettlesWithAllocation) {
   ABSL_LOG(INFO) << estimate;
 }
 
+TEST(CallArenaAllocatorTest, EstimatesEachMethodSeparately) {
+  auto allocator = MakeRefCounted<CallArenaAllocator>(
+      ResourceQuota::Default()->memory_quota()->CreateMemoryAllocator(
+          "test-allocator"),
+      1);
+  // Find two paths that do not share an estimate.
+  const std::string big = "/foo.Service/Stream";
+  std::string small;
+  for (int i = 0; small.empty(); i++) {
+    std::string candidate = absl::StrCat("/grpc.health.v1.Health/Check", i);
+    for (int j = 0; j < 10; j++) allocator->MakeArenaForMethod(candidate);
+    for (int j = 0; j < 10; j++) {
+      allocator->MakeArenaForMethod(big)->Alloc(100000);
+    }
+    if (allocator->CallSizeEstimate(candidate) <
+        allocator->CallSizeEstimate(big)) {
+      small = candidate;
+    }
+  }
+  for (int i = 0; i < 10000; i++) {
+    allocator->MakeArenaForMethod(big)->Alloc(100000);
+    allocator->MakeArenaForMethod(small);
+  }
+  EXPECT_GE(allocator->CallSizeEstimate(big), 100000);
+  EXPECT_LT(allocator->CallSizeEstimate(small), 1000);
+  // The first zone of a call is big enough for its method.
+  auto big_arena = allocator->MakeArenaForMethod(big);
+  char* p = static_cast<char*>(big_arena->Alloc(100000));
+  char* base = reinterpret_cast<char*>(big_arena.get());
+  EXPECT_GE(p, base);
+  EXPECT_LT(p, base + allocator->CallSizeEstimate(big));
+}
+
+TEST(CallArenaAllocatorTest, NewMethodsStartFromChannelEstimate) {
+  auto allocator = MakeRefCounted<CallArenaAllocator>(
+      ResourceQuota::Default()->memory_quota()->CreateMemoryAllocator(
+          "test-allocator"),
+      1);
+  for (int i = 0; i < 100; i++) {
+    allocator->MakeArena()->Alloc(10000);
+  }
+  EXPECT_EQ(allocator->CallSizeEstimate("/foo.Service/NeverCalled"),
+            allocator->CallSizeEstimate());
+}
+
 }  // namespace grpc_core
 
 int main(int argc, char* argv[]) {
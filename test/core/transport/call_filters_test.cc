@@ -82,6 +82,32 @@ TEST(LayoutTest, Add) {
   EXPECT_EQ(l.promise_size, 1u);
   EXPECT_EQ(l.promise_alignment, 4u);
   EXPECT_EQ(l.ops[0].call_offset, 120);
+  EXPECT_FALSE(l.AllInPlace());
+}
+
+TEST(LayoutTest, AddInPlace) {
+  Layout<ClientMetadataHandle> l;
+  EXPECT_TRUE(l.AllInPlace());
+  l.AddInPlace(
+      Operator<ClientMetadataHandle>{&l, 120, nullptr, nullptr, nullptr},
+      InPlaceOperator<ClientMetadataHandle>{&l, 120, nullptr});
+  l.AddInPlace(
+      Operator<ClientMetadataHandle>{&l, 240, nullptr, nullptr, nullptr},
+      InPlaceOperator<ClientMetadataHandle>{&l, 240, nullptr});
+  EXPECT_EQ(l.promise_size, 0u);
+  ASSERT_EQ(l.in_place_ops.size(), 2u);
+  EXPECT_TRUE(l.AllInPlace());
+  l.Reverse();
+  EXPECT_EQ(l.ops[0].call_offset, 240);
+  EXPECT_EQ(l.in_place_ops[0].call_offset, 240);
+  // Any other op means the layout has to be run through the promise path.
+  l.Add(0, 0,
+        Operator<ClientMetadataHandle>{&l, 360, nullptr, nullptr, nullptr});
+  l.AddInPlace(
+      Operator<ClientMetadataHandle>{&l, 480, nullptr, nullptr, nullptr},
+      InPlaceOperator<ClientMetadataHandle>{&l, 480, nullptr});
+  EXPECT_EQ(l.ops.size(), 4u);
+  EXPECT_FALSE(l.AllInPlace());
 }
 
 }  // namespace filters_detail
@@ -928,6 +954,61 @@ TEST(StackDataTest, ServerTrailingMetadataReturningVoidTakingChannelPtr) {
   EXPECT_THAT(f1.v, ::testing::ElementsAre(42));
 }
 
+namespace {
+struct SealedInPlaceFilter {
+  struct Call {
+    void OnClientInitialMetadata(ClientMetadata&) {}
+    static const inline NoInterceptor OnServerInitialMetadata;
+    absl::Status OnClientToServerMessage(Message&) {
+      return absl::OkStatus();
+    }
+    static const inline NoInterceptor OnClientToServerHalfClose;
+    static const inline NoInterceptor OnServerToClientMessage;
+    static const inline NoInterceptor OnServerTrailingMetadata;
+    static const inline NoInterceptor OnFinalize;
+    int n = 0;
+  };
+};
+struct SealedByHandleFilter {
+  struct Call {
+    void OnClientInitialMetadata(ClientMetadata&) {}
+    static const inline NoInterceptor OnServerInitialMetadata;
+    MessageHandle OnClientToServerMessage(MessageHandle message,
+                                          SealedByHandleFilter*) {
+      return message;
+    }
+    static const inline NoInterceptor OnClientToServerHalfClose;
+    static const inline NoInterceptor OnServerToClientMessage;
+    static const inline NoInterceptor OnServerTrailingMetadata;
+    static const inline NoInterceptor OnFinalize;
+    int n = 0;
+  };
+};
+}  // namespace
+
+TEST(StackDataTest, SealedRun) {
+  StackData d;
+  SealedInPlaceFilter f1;
+  SealedInPlaceFilter f2;
+  SealedByHandleFilter f3;
+  SealedChannelData<SealedInPlaceFilter, SealedInPlaceFilter,
+                    SealedByHandleFilter>
+      sealed;
+  sealed.filters = {&f1, &f2, &f3};
+  sealed.call_offsets = {d.AddFilter(&f1), d.AddFilter(&f2), d.AddFilter(&f3)};
+  d.AddSealedOps(&sealed);
+  // Every filter works in place: one op for the whole run.
+  ASSERT_EQ(d.client_initial_metadata.ops.size(), 1u);
+  EXPECT_EQ(d.client_initial_metadata.ops[0].channel_data, &sealed);
+  EXPECT_TRUE(d.client_initial_metadata.AllInPlace());
+  // No filter is interested: no op at all.
+  EXPECT_EQ(d.server_initial_metadata.ops.size(), 0u);
+  // One filter needs the promise path: one op per interested filter.
+  ASSERT_EQ(d.client_to_server_messages.ops.size(), 3u);
+  EXPECT_EQ(d.client_to_server_messages.ops[2].channel_data, &f3);
+  EXPECT_FALSE(d.client_to_server_messages.AllInPlace());
+}
+
 }  // namespace filters_detail
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -997,6 +1078,7 @@ TEST(OperationExecutorTest, InstantTwo) {
   ASSERT_EQ(d.filter_constructor.size(), 2u);
   ASSERT_EQ(d.filter_destructor.size(), 0u);
   ASSERT_EQ(d.client_initial_metadata.ops.size(), 2u);
+  EXPECT_TRUE(d.client_initial_metadata.AllInPlace());
   void* call_data1 =
       gpr_malloc_aligned(d.call_data_size, d.call_data_alignment);
   void* call_data2 = Offset(call_data1, d.filter_constructor[1].call_offset);
@@ -1060,6 +1142,7 @@ TEST(OperationExecutorTest, PromiseTwo) {
   ASSERT_EQ(d.filter_constructor.size(), 2u);
   ASSERT_EQ(d.filter_destructor.size(), 0u);
   ASSERT_EQ(d.client_initial_metadata.ops.size(), 2u);
+  EXPECT_FALSE(d.client_initial_metadata.AllInPlace());
   void* call_data1 =
       gpr_malloc_aligned(d.call_data_size, d.call_data_alignment);
   void* call_data2 = Offset(call_data1, d.filter_constructor[1].call_offset);
@@ -1215,6 +1298,104 @@ TEST(CallFiltersTest, UnaryCall) {
                   "f1:OnFinalize", "f2:OnFinalize"));
 }
 
+TEST(CallFiltersTest, UnaryCallWithSealedRun) {
+  struct Filter {
+    struct Call {
+      void OnClientInitialMetadata(ClientMetadata&, Filter* f) {
+        f->steps.push_back(absl::StrCat(f->label, ":OnClientInitialMetadata"));
+      }
+      void OnServerInitialMetadata(ServerMetadata&, Filter* f) {
+        f->steps.push_back(absl::StrCat(f->label, ":OnServerInitialMetadata"));
+      }
+      void OnClientToServerMessage(Message&, Filter* f) {
+        f->steps.push_back(absl::StrCat(f->label, ":OnClientToServerMessage"));
+      }
+      void OnClientToServerHalfClose(Filter* f) {
+        f->steps.push_back(
+            absl::StrCat(f->label, ":OnClientToServerHalfClose"));
+      }
+      void OnServerToClientMessage(Message&, Filter* f) {
+        f->steps.push_back(absl::StrCat(f->label, ":OnServerToClientMessage"));
+      }
+      void OnServerTrailingMetadata(ServerMetadata&, Filter* f) {
+        f->steps.push_back(absl::StrCat(f->label, ":OnServerTrailingMetadata"));
+      }
+      void OnFinalize(const grpc_call_final_info*, Filter* f) {
+        f->steps.push_back(absl::StrCat(f->label, ":OnFinalize"));
+      }
+      std::unique_ptr<int> i = std::make_unique<int>(3);
+    };
+
+    const std::string label;
+    std::vector<std::string>& steps;
+  };
+  std::vector<std::string> steps;
+  Filter f1{"f1", steps};
+  Filter f2{"f2", steps};
+  Filter f3{"f3", steps};
+  CallFilters::StackBuilder builder;
+  builder.AddSealed(&f1, &f2);
+  builder.Add(&f3);
+  auto arena = SimpleArenaAllocator()->MakeArena();
+  CallFilters filters(Arena::MakePooledForOverwrite<ClientMetadata>());
+  filters.AddStack(builder.Build());
+  filters.Start();
+  promise_detail::Context<Arena> ctx(arena.get());
+  StrictMock<MockActivity> activity;
+  activity.Activate();
+  // Pull client initial metadata
+  auto pull_client_initial_metadata = filters.PullClientInitialMetadata();
+  EXPECT_THAT(pull_client_initial_metadata(), IsReady());
+  Mock::VerifyAndClearExpectations(&activity);
+  // Push client to server message
+  auto push_client_to_server_message = filters.PushClientToServerMessage(
+      Arena::MakePooled<Message>(SliceBuffer(), 0));
+  EXPECT_THAT(push_client_to_server_message(), IsPending());
+  auto pull_client_to_server_message = filters.PullClientToServerMessage();
+  // Pull client to server message, expect a wakeup
+  EXPECT_WAKEUP(activity,
+                EXPECT_THAT(pull_client_to_server_message(), IsReady()));
+  // Push should be done
+  EXPECT_THAT(push_client_to_server_message(), IsReady(Success{}));
+  // Push server initial metadata
+  filters.PushServerInitialMetadata(
+      Arena::MakePooledForOverwrite<ServerMetadata>());
+  auto pull_server_initial_metadata = filters.PullServerInitialMetadata();
+  // Pull server initial metadata
+  EXPECT_THAT(pull_server_initial_metadata(), IsReady());
+  Mock::VerifyAndClearExpectations(&activity);
+  // Push server to client message
+  auto push_server_to_client_message = filters.PushServerToClientMessage(
+      Arena::MakePooled<Message>(SliceBuffer(), 0));
+  EXPECT_THAT(push_server_to_client_message(), IsPending());
+  auto pull_server_to_client_message = filters.PullServerToClientMessage();
+  // Pull server to client message, expect a wakeup
+  EXPECT_WAKEUP(activity,
+                EXPECT_THAT(pull_server_to_client_message(), IsReady()));
+  // Push should be done
+  EXPECT_THAT(push_server_to_client_message(), IsReady(Success{}));
+  // Push server trailing metadata
+  filters.PushServerTrailingMetadata(
+      Arena::MakePooledForOverwrite<ServerMetadata>());
+  // Pull server trailing metadata
+  auto pull_server_trailing_metadata = filters.PullServerTrailingMetadata();
+  // Should be done
+  EXPECT_THAT(pull_server_trailing_metadata(), IsReady());
+  filters.Finalize(nullptr);
+  EXPECT_THAT(
+      steps,
+      ::testing::ElementsAre(
+          "f1:OnClientInitialMetadata", "f2:OnClientInitialMetadata",
+          "f3:OnClientInitialMetadata", "f1:OnClientToServerMessage",
+          "f2:OnClientToServerMessage", "f3:OnClientToServerMessage",
+          "f3:OnServerInitialMetadata", "f2:OnServerInitialMetadata",
+          "f1:OnServerInitialMetadata", "f3:OnServerToClientMessage",
+          "f2:OnServerToClientMessage", "f1:OnServerToClientMessage",
+          "f3:OnServerTrailingMetadata", "f2:OnServerTrailingMetadata",
+          "f1:OnServerTrailingMetadata", "f1:OnFinalize", "f2:OnFinalize",
+          "f3:OnFinalize"));
+}
+
 TEST(CallFiltersTest, UnaryCallWithMultiStack) {
   struct Filter {
     struct Call {
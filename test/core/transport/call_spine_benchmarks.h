@@ -16,6 +16,8 @@
 #define GRPC_TEST_CORE_TRANSPORT_CALL_SPINE_BENCHMARKS_H
 
 #include <memory>
+#include <optional>
+#include <utility>
 
 #include "benchmark/benchmark.h"
 #include "src/core/lib/event_engine/default_event_engine.h"
@@ -27,6 +29,7 @@
 #include "src/core/lib/transport/call_spine.h"
 #include "src/core/lib/transport/transport.h"
 #include "src/core/util/notification.h"
+#include "test/core/test_util/allocation_counter.h"
 
 namespace grpc_core {
 
@@ -35,16 +38,50 @@ struct BenchmarkCall {
   CallHandler handler;
 };
 
+// Reports what a benchmark allocated per iteration, once it is destroyed:
+// heap allocations by any thread, and the arena bytes used by the calls
+// passed to RecordCallArena().
+class AllocationCounters {
+ public:
+  explicit AllocationCounters(benchmark::State& state)
+      : state_(state),
+        heap_allocations_at_start_(testing::HeapAllocationCount()) {}
+
+  ~AllocationCounters() {
+    if (testing::HeapAllocationCountingEnabled()) {
+      state_.counters["heap_allocs"] = benchmark::Counter(
+          testing::HeapAllocationCount() - heap_allocations_at_start_,
+          benchmark::Counter::kAvgIterations);
+    }
+    if (arena_bytes_ != 0) {
+      state_.counters["arena_bytes"] = benchmark::Counter(
+          arena_bytes_, benchmark::Counter::kAvgIterations);
+    }
+  }
+
+  void RecordCallArena(const Arena& arena) {
+    arena_bytes_ += arena.TotalUsedBytes();
+  }
+
+ private:
+  benchmark::State& state_;
+  const uint64_t heap_allocations_at_start_;
+  uint64_t arena_bytes_ = 0;
+};
+
 // Unary call with one spawn on each end of the spine.
 template <typename Fixture>
 void BM_UnaryWithSpawnPerEnd(benchmark::State& state) {
   Fixture fixture;
+  AllocationCounters allocation_counters(state);
   for (auto _ : state) {
     Notification handler_done;
     Notification initiator_done;
+    RefCountedPtr<Arena> arena;
     {
       ExecCtx exec_ctx;
       BenchmarkCall call = fixture.MakeCall();
+      arena = call.initiator.arena()->Ref();
       call.handler.SpawnInfallible("handler", [handler = call.handler, &fixture,
                                                &handler_done]() mutable {
         handler.PushServerInitialMetadata(fixture.MakeServerInitialMetadata());
@@ -87,6 +124,7 @@ void BM_UnaryWithSpawnPerEnd(benchmark::State& state) {
     }
     handler_done.WaitForNotification();
     initiator_done.WaitForNotification();
+    allocation_counters.RecordCallArena(*arena);
   }
 }
 
@@ -114,6 +152,7 @@ void BM_ClientToServerStreaming(benchmark::State& state) {
   });
   handler_metadata_done.WaitForNotification();
   initiator_metadata_done.WaitForNotification();
+  std::optional<AllocationCounters> allocation_counters(std::in_place, state);
   for (auto _ : state) {
     Notification handler_done;
     Notification initiator_done;
@@ -134,6 +173,8 @@ void BM_ClientToServerStreaming(benchmark::State& state) {
     handler_done.WaitForNotification();
     initiator_done.WaitForNotification();
   }
+  // Leaves out the allocations made tearing down the call.
+  allocation_counters.reset();
   call.initiator.SpawnInfallible(
       "done", [initiator = call.initiator]() mutable { initiator.Cancel(); });
   call.handler.SpawnInfallible("done", [handler = call.handler]() mutable {
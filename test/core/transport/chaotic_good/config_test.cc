@@ -14,6 +14,7 @@
 
 #include "src/core/ext/transport/chaotic_good/config.h"
 
+#include <memory>
 #include <vector>
 
 #include "fuzztest/fuzztest.h"
@@ -121,5 +122,26 @@ void ConfigTest(FuzzerChannelArgs client_args_input,
 }
 FUZZ_TEST(MyTestSuite, ConfigTest);
 
+class FakeReceiveBufferAllocator final
+    : public grpc_event_engine::experimental::
+          ChaoticGoodReceiveBufferAllocator {
+ public:
+  grpc_event_engine::experimental::Slice Allocate(size_t, size_t) override {
+    return grpc_event_engine::experimental::Slice();
+  }
+};
+
+TEST(ConfigTest, ReceiveBufferAllocatorReachesTransportOptions) {
+  EXPECT_EQ(chaotic_good::Config(ChannelArgs())
+                .MakeTransportOptions()
+                .receive_buffer_allocator,
+            nullptr);
+  auto allocator = std::make_shared<FakeReceiveBufferAllocator>();
+  chaotic_good::Config config(ChannelArgs().SetObject<
+      grpc_event_engine::experimental::ChaoticGoodReceiveBufferAllocator>(
+      allocator));
+  EXPECT_EQ(config.MakeTransportOptions().receive_buffer_allocator, allocator);
+}
+
 }  // namespace
 }  // namespace grpc_core
@@ -114,6 +114,122 @@ DATA_ENDPOINTS_TEST(CanRead) {
   WaitForAllPendingWork();
 }
 
+DATA_ENDPOINTS_TEST(RetiredEndpointTakesNoWrites) {
+  chaotic_good::testing::MockPromiseEndpoint ep1(1234);
+  chaotic_good::testing::MockPromiseEndpoint ep2(1235);
+  chaotic_good::DataEndpoints data_endpoints(
+      Endpoints(std::move(ep1.promise_endpoint),
+                std::move(ep2.promise_endpoint)),
+      event_engine().get(), false);
+  SliceBuffer writes2;
+  ep2.CaptureWrites(writes2, event_engine().get());
+  EXPECT_TRUE(data_endpoints.RetireSending(0));
+  EXPECT_FALSE(data_endpoints.RetireSending(0));
+  EXPECT_EQ(data_endpoints.ActiveEndpoints(), 1);
+  SpawnTestSeqWithoutContext(
+      "write",
+      data_endpoints.Write(SliceBuffer(Slice::FromCopiedString("hello"))),
+      [](uint32_t id) { EXPECT_EQ(id, 1); });
+  TickUntilTrue([&]() { return writes2.Length() == 5; });
+  WaitForAllPendingWork();
+  EXPECT_EQ(writes2.JoinIntoString(), "hello");
+}
+
+DATA_ENDPOINTS_TEST(CanAddEndpoint) {
+  chaotic_good::testing::MockPromiseEndpoint ep1(1234);
+  chaotic_good::testing::MockPromiseEndpoint ep2(1235);
+  chaotic_good::DataEndpoints data_endpoints(
+      Endpoints(std::move(ep1.promise_endpoint)), event_engine().get(), false);
+  SliceBuffer writes2;
+  ep2.CaptureWrites(writes2, event_engine().get());
+  auto id = data_endpoints.AddEndpoint(chaotic_good::ImmediateConnection(
+      "bar", std::move(ep2.promise_endpoint)));
+  ASSERT_TRUE(id.ok());
+  EXPECT_EQ(*id, 1);
+  EXPECT_TRUE(data_endpoints.IsValidConnectionId(1));
+  EXPECT_FALSE(data_endpoints.IsValidConnectionId(2));
+  EXPECT_EQ(data_endpoints.ActiveEndpoints(), 2);
+  // Steer the write onto the new endpoint.
+  EXPECT_TRUE(data_endpoints.RetireSending(0));
+  SpawnTestSeqWithoutContext(
+      "write",
+      data_endpoints.Write(SliceBuffer(Slice::FromCopiedString("hello"))),
+      [](uint32_t id) { EXPECT_EQ(id, 1); });
+  TickUntilTrue([&]() { return writes2.Length() == 5; });
+  WaitForAllPendingWork();
+  EXPECT_EQ(writes2.JoinIntoString(), "hello");
+}
+
+TEST(DataEndpointsSchedulerTest, FirstFitTakesFirstCandidate) {
+  using chaotic_good::data_endpoints_detail::Scheduler;
+  auto scheduler = chaotic_good::data_endpoints_detail::MakeFirstFitScheduler();
+  std::vector<Scheduler::Candidate> candidates = {
+      {3, 1000, 1.0}, {1, 0, 1e9}, {2, 0, std::nullopt}};
+  EXPECT_EQ(scheduler->Choose(candidates, 100), 3);
+}
+
+TEST(DataEndpointsSchedulerTest, DrainTimePrefersFastEndpoint) {
+  using chaotic_good::data_endpoints_detail::Scheduler;
+  auto scheduler =
+      chaotic_good::data_endpoints_detail::MakeDrainTimeScheduler();
+  // Endpoint 0 is congested: even with more data queued, endpoint 1 will
+  // finish first.
+  std::vector<Scheduler::Candidate> candidates = {{0, 0, 1e3},
+                                                  {1, 1024 * 1024, 1e9}};
+  EXPECT_EQ(scheduler->Choose(candidates, 1024), 1);
+  // Equal throughput: go where less is queued.
+  candidates = {{0, 4096, 1e6}, {1, 1024, 1e6}};
+  EXPECT_EQ(scheduler->Choose(candidates, 1024), 1);
+  // Nothing measured: least queued wins.
+  candidates = {{0, 4096, std::nullopt}, {1, 0, std::nullopt}};
+  EXPECT_EQ(scheduler->Choose(candidates, 1024), 1);
+  // An unmeasured endpoint is treated as fast so that it gets probed.
+  candidates = {{0, 0, 1e3}, {1, 0, std::nullopt}};
+  EXPECT_EQ(scheduler->Choose(candidates, 1024), 1);
+}
+
+TEST(DataEndpointsOutputBufferTest, PendingLimitTracksThroughput) {
+  using chaotic_good::data_endpoints_detail::OutputBuffer;
+  OutputBuffer buffer;
+  EXPECT_EQ(buffer.pending_max(), OutputBuffer::kDefaultPendingMax);
+  EXPECT_FALSE(buffer.bytes_per_second().has_value());
+  const Timestamp start = Timestamp::FromMillisecondsAfterProcessEpoch(1000);
+  SliceBuffer payload(Slice(grpc_slice_malloc(64 * 1024)));
+  ASSERT_TRUE(buffer.Accept(payload));
+  EXPECT_EQ(buffer.queued_bytes(), 64 * 1024);
+  auto written = buffer.TakePending(start);
+  EXPECT_EQ(written.Length(), 64 * 1024);
+  EXPECT_EQ(buffer.queued_bytes(), 64 * 1024);
+  // 64KiB in one second is slow: the limit drops to its floor.
+  buffer.WriteCompleted(start + Duration::Seconds(1));
+  EXPECT_EQ(buffer.queued_bytes(), 0);
+  ASSERT_TRUE(buffer.bytes_per_second().has_value());
+  EXPECT_DOUBLE_EQ(*buffer.bytes_per_second(), 64 * 1024);
+  EXPECT_EQ(buffer.pending_max(), OutputBuffer::kMinPendingMax);
+  // Once the floor is full, further payloads go elsewhere.
+  SliceBuffer first(Slice(grpc_slice_malloc(OutputBuffer::kMinPendingMax)));
+  ASSERT_TRUE(buffer.Accept(first));
+  EXPECT_FALSE(buffer.CanAccept(1));
+}
+
+TEST(DataEndpointsOutputBufferTest, TcpDeliveryRateSeedsThroughput) {
+  using chaotic_good::data_endpoints_detail::OutputBuffer;
+  OutputBuffer buffer;
+  const Timestamp start = Timestamp::FromMillisecondsAfterProcessEpoch(1000);
+  EXPECT_TRUE(buffer.TakeTcpInfoSample(start));
+  EXPECT_FALSE(buffer.TakeTcpInfoSample(start + Duration::Milliseconds(500)));
+  EXPECT_TRUE(buffer.TakeTcpInfoSample(start + Duration::Seconds(1)));
+  // Until a write is measured, the kernel's delivery rate stands in.
+  buffer.RecordTcpDeliveryRate(1e6);
+  ASSERT_TRUE(buffer.bytes_per_second().has_value());
+  EXPECT_DOUBLE_EQ(*buffer.bytes_per_second(), 1e6);
+  SliceBuffer payload(Slice(grpc_slice_malloc(64 * 1024)));
+  ASSERT_TRUE(buffer.Accept(payload));
+  buffer.TakePending(start);
+  buffer.WriteCompleted(start + Duration::Seconds(1));
+  EXPECT_DOUBLE_EQ(*buffer.bytes_per_second(), 64 * 1024);
+}
+
 namespace {
 yodel::Msg ParseTestProto(const std::string& text) {
   yodel::Msg msg;
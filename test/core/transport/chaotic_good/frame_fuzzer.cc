@@ -101,6 +101,10 @@ void Run(const frame_fuzzer::Test& test) {
     case FrameType::kCancel:
       FinishParseAndChecks<CancelFrame>(*r, std::move(payload));
       break;
+    case FrameType::kMessageChunk:
+    case FrameType::kCompressedMessageChunk:
+      FinishParseAndChecks<MessageChunkFrame>(*r, std::move(payload));
+      break;
   }
 }
 FUZZ_TEST(FrameFuzzer, Run);
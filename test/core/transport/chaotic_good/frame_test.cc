@@ -48,6 +48,24 @@ TEST(FrameTest, SettingsFrameRoundTrips) {
   AssertRoundTrips(SettingsFrame{}, FrameType::kSettings);
 }
 
+TEST(FrameTest, LargeSettingsFrameRoundTrips) {
+  SettingsFrame frame;
+  frame.body.add_connection_id(std::string(100, 'a'));
+  AssertRoundTrips(frame, FrameType::kSettings);
+}
+
+TEST(FrameTest, SmallPayloadSharesSliceWithHeader) {
+  SettingsFrame frame;
+  frame.body.add_connection_id("abc");
+  const auto hdr = frame.MakeHeader();
+  SliceBuffer output;
+  hdr.Serialize(output.AddTiny(FrameHeader::kFrameHeaderSize));
+  frame.SerializePayload(output);
+  EXPECT_EQ(output.Count(), 1u);
+  EXPECT_EQ(output.Length(),
+            FrameHeader::kFrameHeaderSize + hdr.payload_length);
+}
+
 }  // namespace
 }  // namespace chaotic_good
 }  // namespace grpc_core
@@ -18,6 +18,7 @@
 
 #include "fuzztest/fuzztest.h"
 #include "gtest/gtest.h"
+#include "src/core/lib/compression/message_compress.h"
 #include "src/core/lib/promise/status_flag.h"
 #include "test/core/promise/poll_matcher.h"
 
@@ -89,5 +90,31 @@ void MessageChunkerTest(uint32_t max_chunk_size, uint32_t alignment,
 }
 FUZZ_TEST(MyTestSuite, MessageChunkerTest);
 
+TEST(MessageChunkerTest, CompressesEachChunk) {
+  const std::string payload(100 * 1024, 'a');
+  chaotic_good::MessageChunker chunker(16 * 1024, 1, GRPC_COMPRESS_GZIP);
+  Sender sender;
+  EXPECT_THAT(chunker.Send(Arena::MakePooled<Message>(
+                               SliceBuffer(Slice::FromCopiedString(payload)),
+                               0),
+                           1, sender)(),
+              IsReady(true));
+  ASSERT_GT(sender.frames.size(), 2);
+  auto& begin = std::get<chaotic_good::BeginMessageFrame>(sender.frames[0]);
+  EXPECT_EQ(begin.body.length(), payload.length());
+  std::string received_payload;
+  for (size_t i = 1; i < sender.frames.size(); i++) {
+    auto& f = std::get<chaotic_good::MessageChunkFrame>(sender.frames[i]);
+    EXPECT_EQ(f.compression, GRPC_COMPRESS_GZIP);
+    EXPECT_LT(f.payload.Length(), 16 * 1024);
+    SliceBuffer decompressed;
+    ASSERT_TRUE(grpc_msg_decompress(f.compression, f.payload.c_slice_buffer(),
+                                    decompressed.c_slice_buffer()));
+    EXPECT_LE(decompressed.Length(), 16 * 1024);
+    received_payload.append(decompressed.JoinIntoString());
+  }
+  EXPECT_EQ(received_payload, payload);
+}
+
 }  // namespace
 }  // namespace grpc_core
@@ -0,0 +1,98 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chaotic_good/shared_memory_endpoint.h"
+
+#include <grpc/event_engine/slice.h>
+#include <grpc/event_engine/slice_buffer.h>
+
+#include <string>
+
+#include "gtest/gtest.h"
+
+namespace grpc_core {
+namespace chaotic_good {
+namespace {
+
+using grpc_event_engine::experimental::Slice;
+using grpc_event_engine::experimental::SliceBuffer;
+
+std::string Join(SliceBuffer& buffer) {
+  std::string out;
+  for (size_t i = 0; i < buffer.Count(); i++) {
+    out.append(std::string(buffer[i].as_string_view()));
+  }
+  return out;
+}
+
+TEST(SharedMemoryRegionTest, BytesCrossBetweenMappings) {
+  auto client = SharedMemoryRegion::Create(64);
+  if (!client.ok()) GTEST_SKIP() << client.status();
+  auto server = SharedMemoryRegion::Open((*client)->name());
+  ASSERT_TRUE(server.ok()) << server.status();
+  (*client)->Unlink();
+  SliceBuffer out;
+  out.Append(Slice::FromCopiedString("hello"));
+  EXPECT_EQ((*client)->client_to_server().Write(out), 5);
+  SliceBuffer in;
+  EXPECT_EQ((*server)->client_to_server().Read(in, 100), 5);
+  EXPECT_EQ(Join(in), "hello");
+  EXPECT_EQ((*server)->server_to_client().ReadableBytes(), 0);
+}
+
+TEST(SharedMemoryRegionTest, RingWrapsAndFills) {
+  auto region = SharedMemoryRegion::Create(16);
+  if (!region.ok()) GTEST_SKIP() << region.status();
+  auto ring = (*region)->client_to_server();
+  SliceBuffer out;
+  out.Append(Slice::FromCopiedString("0123456789"));
+  EXPECT_EQ(ring.Write(out), 10);
+  SliceBuffer in;
+  EXPECT_EQ(ring.Read(in, 8), 8);
+  EXPECT_EQ(Join(in), "01234567");
+  out.Append(Slice::FromCopiedString("abcdefghijklmnopqrstuvwxyz"));
+  // Only 14 bytes of space left: the ring keeps the rest in `out`.
+  EXPECT_EQ(ring.Write(out), 14);
+  EXPECT_EQ(out.Length(), 12);
+  EXPECT_EQ(ring.WritableBytes(), 0);
+  SliceBuffer rest;
+  EXPECT_EQ(ring.Read(rest, 100), 16);
+  EXPECT_EQ(Join(rest), "89abcdefghijklmn");
+}
+
+TEST(SharedMemoryRegionTest, WaitingFlagsAreTakenOnce) {
+  auto region = SharedMemoryRegion::Create(16);
+  if (!region.ok()) GTEST_SKIP() << region.status();
+  auto ring = (*region)->server_to_client();
+  EXPECT_FALSE(ring.TakeConsumerWaiting());
+  ring.SetConsumerWaiting();
+  EXPECT_TRUE(ring.TakeConsumerWaiting());
+  EXPECT_FALSE(ring.TakeConsumerWaiting());
+  ring.SetProducerWaiting();
+  EXPECT_TRUE(ring.TakeProducerWaiting());
+}
+
+TEST(SharedMemoryRegionTest, OnlyOpensChaoticGoodRegions) {
+  EXPECT_FALSE(SharedMemoryRegion::Open("/some_other_region").ok());
+  EXPECT_FALSE(SharedMemoryRegion::Open("/grpc_chaotic_good_/../x").ok());
+}
+
+}  // namespace
+}  // namespace chaotic_good
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
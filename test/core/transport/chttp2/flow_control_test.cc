@@ -263,6 +263,72 @@ TEST_F(FlowControlTest, GradualReadsUpdate) {
   EXPECT_EQ(immediate_updates + queued_updates, 65535);
 }
 
+TEST(PathModelTest, NoEstimateWithoutRtt) {
+  PathModel model;
+  const Timestamp start = Timestamp::FromMillisecondsAfterProcessEpoch(1000);
+  model.AddSample(start, 0, std::nullopt);
+  model.AddSample(start + Duration::Milliseconds(100), 1000000, std::nullopt);
+  EXPECT_DOUBLE_EQ(model.bandwidth(), 10000000);
+  EXPECT_FALSE(model.has_estimate());
+  EXPECT_FALSE(model.TargetWindow().has_value());
+}
+
+TEST(PathModelTest, BdpIsPeakRateTimesMinRtt) {
+  PathModel model;
+  Timestamp now = Timestamp::FromMillisecondsAfterProcessEpoch(1000);
+  int64_t bytes = 0;
+  model.AddSample(now, bytes, Duration::Milliseconds(100));
+  // 10MB/s, then a slower sample that the max filter should ignore.
+  now += Duration::Milliseconds(100);
+  bytes += 1000000;
+  model.AddSample(now, bytes, Duration::Milliseconds(120));
+  now += Duration::Milliseconds(100);
+  bytes += 500000;
+  model.AddSample(now, bytes, Duration::Milliseconds(110));
+  EXPECT_DOUBLE_EQ(model.bandwidth(), 10000000);
+  EXPECT_EQ(model.min_rtt(), Duration::Milliseconds(100));
+  EXPECT_DOUBLE_EQ(model.EstimateBdp(), 1000000);
+  ASSERT_TRUE(model.in_startup());
+  EXPECT_DOUBLE_EQ(*model.TargetWindow(), 1000000 * PathModel::kStartupGain);
+}
+
+TEST(PathModelTest, LeavesStartupWhenRateStopsGrowing) {
+  PathModel model;
+  Timestamp now = Timestamp::FromMillisecondsAfterProcessEpoch(1000);
+  int64_t bytes = 0;
+  model.AddSample(now, bytes, Duration::Milliseconds(50));
+  // Doubling every sample keeps the model in startup...
+  int64_t per_sample = 100000;
+  for (int i = 0; i < 5; ++i) {
+    now += Duration::Milliseconds(50);
+    bytes += per_sample;
+    per_sample *= 2;
+    model.AddSample(now, bytes, Duration::Milliseconds(50));
+    EXPECT_TRUE(model.in_startup());
+  }
+  // ...and a plateau ends it.
+  per_sample /= 2;
+  for (int i = 0; i < 3; ++i) {
+    now += Duration::Milliseconds(50);
+    bytes += per_sample;
+    model.AddSample(now, bytes, Duration::Milliseconds(50));
+  }
+  EXPECT_FALSE(model.in_startup());
+  EXPECT_DOUBLE_EQ(*model.TargetWindow(),
+                   model.EstimateBdp() * PathModel::kSteadyGain);
+}
+
+TEST(PathModelTest, MinRttExpires) {
+  PathModel model;
+  const Timestamp start = Timestamp::FromMillisecondsAfterProcessEpoch(1000);
+  model.AddSample(start, 0, Duration::Milliseconds(10));
+  model.AddSample(start + Duration::Seconds(5), 0, Duration::Milliseconds(50));
+  EXPECT_EQ(model.min_rtt(), Duration::Milliseconds(10));
+  model.AddSample(start + Duration::Seconds(11), 0,
+                  Duration::Milliseconds(50));
+  EXPECT_EQ(model.min_rtt(), Duration::Milliseconds(50));
+}
+
 }  // namespace chttp2
 }  // namespace grpc_core
 
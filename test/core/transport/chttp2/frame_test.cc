@@ -404,6 +404,76 @@ TEST(Frame, ParseRejects) {
                        "stream_id=0, length=4}"));
 }
 
+TEST(Frame, AppendDataFramesSplitsWithoutCopying) {
+  SliceBuffer payload;
+  payload.Append(Slice::FromCopiedString("hello"));
+  payload.Append(Slice::FromCopiedString("world"));
+  const uint8_t* first_slice = payload[0].data();
+  std::vector<Http2Frame> frames;
+  AppendDataFrames(1, payload, 4, true, frames);
+  EXPECT_EQ(payload.Length(), 0u);
+  ASSERT_EQ(frames.size(), 3u);
+  EXPECT_EQ(frames[0], Http2Frame(Http2DataFrame{
+                           1, false, SliceBufferFromString("hell")}));
+  EXPECT_EQ(frames[1], Http2Frame(Http2DataFrame{
+                           1, false, SliceBufferFromString("owor")}));
+  EXPECT_EQ(frames[2],
+            Http2Frame(Http2DataFrame{1, true, SliceBufferFromString("ld")}));
+  EXPECT_EQ(std::get<Http2DataFrame>(frames[0]).payload[0].data(),
+            first_slice);
+}
+
+TEST(Frame, AppendDataFramesEmptyPayload) {
+  SliceBuffer payload;
+  std::vector<Http2Frame> frames;
+  AppendDataFrames(3, payload, 16384, true, frames);
+  ASSERT_EQ(frames.size(), 1u);
+  EXPECT_EQ(frames[0], Http2Frame(Http2DataFrame{3, true, SliceBuffer()}));
+}
+
+TEST(Frame, AppendHeaderFramesUsesContinuations) {
+  SliceBuffer header_block = SliceBufferFromString("abcdefgh");
+  std::vector<Http2Frame> frames;
+  AppendHeaderFrames(5, header_block, 3, false, frames);
+  ASSERT_EQ(frames.size(), 3u);
+  EXPECT_EQ(frames[0], Http2Frame(Http2HeaderFrame{
+                           5, false, false, SliceBufferFromString("abc")}));
+  EXPECT_EQ(frames[1], Http2Frame(Http2ContinuationFrame{
+                           5, false, SliceBufferFromString("def")}));
+  EXPECT_EQ(frames[2], Http2Frame(Http2ContinuationFrame{
+                           5, true, SliceBufferFromString("gh")}));
+}
+
+TEST(Frame, ParseFramesKeepsPartialFrame) {
+  SliceBuffer buffer;
+  buffer.Append(Slice::FromCopiedBuffer(
+      ByteVec(0, 0, 5, 0, 0, 0, 0, 0, 1, 'h', 'e', 'l', 'l', 'o', 0, 0, 8, 6,
+              0, 0, 0, 0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 0, 0, 4, 8, 0, 0, 0)));
+  auto frames = ParseFrames(buffer, 16384);
+  ASSERT_TRUE(frames.ok()) << frames.status();
+  ASSERT_EQ(frames->size(), 2u);
+  EXPECT_EQ((*frames)[0], Http2Frame(Http2DataFrame{
+                              1, false, SliceBufferFromString("hello")}));
+  EXPECT_EQ((*frames)[1],
+            Http2Frame(Http2PingFrame{false, 0x0102030405060708}));
+  EXPECT_EQ(buffer.Length(), 7u);
+  buffer.Append(Slice::FromCopiedBuffer(ByteVec(0, 1, 0, 0, 0, 1)));
+  frames = ParseFrames(buffer, 16384);
+  ASSERT_TRUE(frames.ok()) << frames.status();
+  ASSERT_EQ(frames->size(), 1u);
+  EXPECT_EQ((*frames)[0], Http2Frame(Http2WindowUpdateFrame{1, 1}));
+  EXPECT_EQ(buffer.Length(), 0u);
+}
+
+TEST(Frame, ParseFramesRejectsOversizedFrame) {
+  SliceBuffer buffer;
+  buffer.Append(Slice::FromCopiedBuffer(ByteVec(0, 0, 5, 0, 0, 0, 0, 0, 1)));
+  EXPECT_THAT(ParseFrames(buffer, 4).status(),
+              StatusIs(absl::StatusCode::kInternal,
+                       "frame too large: {DATA: flags=0, stream_id=1, "
+                       "length=5}"));
+}
+
 }  // namespace
 }  // namespace grpc_core
 
@@ -27,13 +27,17 @@
 #include <string>
 
 #include "absl/log/absl_log.h"
+#include "absl/strings/str_cat.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
+#include "src/core/ext/transport/chttp2/transport/bin_encoder.h"
+#include "src/core/ext/transport/chttp2/transport/hpack_constants.h"
 #include "src/core/ext/transport/chttp2/transport/legacy_frame.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/resource_quota/arena.h"
 #include "src/core/lib/resource_quota/memory_quota.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/transport/metadata_template.h"
 #include "src/core/util/ref_counted_ptr.h"
 #include "test/core/test_util/parse_hexstring.h"
 #include "test/core/test_util/slice_splitter.h"
@@ -413,6 +417,116 @@ TEST(HpackEncoderTest, EncodeBinaryAsTrueBinary) {
   EXPECT_EQ(compressor.test_only_table_size(), 114);
 }
 
+static size_t EncodeCustomHeader(grpc_core::HPackCompressor* compressor,
+                                 absl::string_view key,
+                                 absl::string_view value) {
+  grpc_metadata_batch b;
+  b.Append(key, grpc_core::Slice::FromCopiedString(value), CrashOnAppendError);
+  grpc_core::FakeCallTracer call_tracer;
+  grpc_slice_buffer output;
+  grpc_slice_buffer_init(&output);
+  grpc_core::HPackCompressor::EncodeHeaderOptions hopt = {
+      0xdeadbeef,  // stream_id
+      true,        // is_eof
+      false,       // use_true_binary_metadata
+      16384,       // max_frame_size
+      &call_tracer};
+  compressor->EncodeHeaders(hopt, b, &output);
+  size_t length = output.length;
+  grpc_slice_buffer_destroy(&output);
+  return length;
+}
+
+TEST(HpackEncoderTest, CustomHeadersAreLiteralsByDefault) {
+  grpc_core::HPackCompressor compressor;
+  for (int i = 0; i < 3; i++) {
+    EncodeCustomHeader(&compressor, "x-tenant", "some-tenant");
+  }
+  EXPECT_EQ(compressor.test_only_table_size(), 0);
+}
+
+TEST(HpackEncoderTest, AdaptiveIndexingIndexesRepeatedValues) {
+  grpc_core::HPackCompressor compressor;
+  compressor.SetAdaptiveIndexing(true);
+  const size_t first = EncodeCustomHeader(&compressor, "x-tenant", "tenant");
+  EXPECT_EQ(compressor.test_only_table_size(), 0);
+  // The value repeated: it is now worth a table entry...
+  EncodeCustomHeader(&compressor, "x-tenant", "tenant");
+  EXPECT_EQ(compressor.test_only_table_size(),
+            grpc_core::hpack_constants::SizeForEntry(8, 6));
+  // ... and from then on is sent as an index.
+  const size_t indexed = EncodeCustomHeader(&compressor, "x-tenant", "tenant");
+  EXPECT_LT(indexed, first);
+}
+
+TEST(HpackEncoderTest, AdaptiveIndexingKeepsHighCardinalityValuesLiteral) {
+  grpc_core::HPackCompressor compressor;
+  compressor.SetAdaptiveIndexing(true);
+  for (int i = 0; i < 100; i++) {
+    EncodeCustomHeader(&compressor, "x-request-id", absl::StrCat("id-", i));
+  }
+  EXPECT_EQ(compressor.test_only_table_size(), 0);
+}
+
+TEST(HpackEncoderTest, BinaryValueEncodingCacheReusesEncoding) {
+  grpc_core::hpack_encoder_detail::BinaryValueEncodingCache cache;
+  const std::string value(100, '\x7f');
+  uint32_t expect_wire_size;
+  grpc_core::Slice expect(grpc_chttp2_base64_encode_and_huffman_compress(
+      grpc_core::Slice::FromCopiedString(value).c_slice(),
+      &expect_wire_size));
+  uint32_t wire_size = 0;
+  grpc_core::Slice first =
+      cache.Encode(grpc_core::Slice::FromCopiedString(value), &wire_size);
+  EXPECT_EQ(first, expect);
+  EXPECT_EQ(wire_size, expect_wire_size);
+  // A byte-identical value in a different buffer is served from the cache.
+  wire_size = 0;
+  grpc_core::Slice second =
+      cache.Encode(grpc_core::Slice::FromCopiedString(value), &wire_size);
+  EXPECT_EQ(second.data(), first.data());
+  EXPECT_EQ(wire_size, expect_wire_size);
+  // A different value is encoded afresh.
+  grpc_core::Slice other = cache.Encode(
+      grpc_core::Slice::FromCopiedString(std::string(100, 'x')), &wire_size);
+  EXPECT_NE(other, first);
+}
+
+TEST(HpackEncoderTest, MetadataTemplateEncodesLikeCustomHeaders) {
+  const std::pair<absl::string_view, absl::string_view> entries[] = {
+      {"x-service", "frontend"}, {"x-region", "us-east1"}};
+  auto metadata_template = grpc_core::MetadataTemplate::Create(entries);
+  ASSERT_TRUE(metadata_template.ok());
+  grpc_metadata_batch expected;
+  for (const auto& [key, value] : entries) {
+    expected.Append(key, grpc_core::Slice::FromCopiedString(value),
+                    CrashOnAppendError);
+  }
+  grpc_core::SliceBuffer expected_bytes;
+  grpc_core::HPackCompressor().EncodeRawHeaders(expected, expected_bytes);
+  grpc_core::HPackCompressor compressor;
+  for (int i = 0; i < 2; i++) {
+    grpc_metadata_batch b;
+    b.Set(grpc_core::GrpcMetadataTemplate(), *metadata_template);
+    grpc_core::SliceBuffer bytes;
+    EXPECT_TRUE(compressor.EncodeRawHeaders(b, bytes));
+    EXPECT_EQ(bytes.JoinIntoString(), expected_bytes.JoinIntoString());
+  }
+  EXPECT_EQ(compressor.test_only_table_size(), 0);
+}
+
+TEST(HpackEncoderTest, MetadataTemplateRejectsReservedKeys) {
+  const std::pair<absl::string_view, absl::string_view> reserved[] = {
+      {"grpc-status", "0"}};
+  EXPECT_FALSE(grpc_core::MetadataTemplate::Create(reserved).ok());
+  const std::pair<absl::string_view, absl::string_view> binary[] = {
+      {"x-blob-bin", "abc"}};
+  EXPECT_FALSE(grpc_core::MetadataTemplate::Create(binary).ok());
+  const std::pair<absl::string_view, absl::string_view> upper[] = {
+      {"X-Service", "frontend"}};
+  EXPECT_FALSE(grpc_core::MetadataTemplate::Create(upper).ok());
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   ::testing::InitGoogleTest(&argc, argv);
@@ -825,6 +825,51 @@ INSTANTIATE_TEST_SUITE_P(
                kFailureIsConnectionError}}}),
     NameFromConfig);
 
+// Parses one literal header with the given representation prefix byte and
+// returns whether the parsed value references the bytes of the input slice.
+bool ParsedValueReferencesInput(bool zero_copy, uint8_t prefix) {
+  ExecCtx exec_ctx;
+  const std::string key = "x-forwarded-thing";
+  const std::string value(40, 'v');
+  std::string frame;
+  frame.push_back(static_cast<char>(prefix));
+  frame.push_back(static_cast<char>(key.size()));
+  frame += key;
+  frame.push_back(static_cast<char>(value.size()));
+  frame += value;
+  Slice input = Slice::FromCopiedString(frame);
+  HPackParser parser;
+  parser.SetZeroCopyMetadata(zero_copy);
+  grpc_metadata_batch b;
+  absl::BitGen bitgen;
+  parser.BeginFrame(
+      &b, 4096, 4096, HPackParser::Boundary::EndOfHeaders,
+      HPackParser::Priority::None,
+      HPackParser::LogInfo{1, HPackParser::LogInfo::kHeaders, false});
+  EXPECT_EQ(parser.Parse(input.c_slice(), true, bitgen, nullptr),
+            absl::OkStatus());
+  parser.FinishFrame();
+  std::string backing;
+  auto parsed = b.GetStringValue(key, &backing);
+  EXPECT_EQ(parsed, value);
+  if (!parsed.has_value()) return false;
+  const char* begin = reinterpret_cast<const char*>(input.begin());
+  return parsed->data() >= begin && parsed->data() < begin + input.size();
+}
+
+TEST(HPackParserZeroCopyTest, CopiesLiteralsByDefault) {
+  EXPECT_FALSE(ParsedValueReferencesInput(false, 0x00));
+}
+
+TEST(HPackParserZeroCopyTest, ReferencesLiteralsWithoutIndexing) {
+  EXPECT_TRUE(ParsedValueReferencesInput(true, 0x00));
+  EXPECT_TRUE(ParsedValueReferencesInput(true, 0x10));
+}
+
+TEST(HPackParserZeroCopyTest, CopiesLiteralsAddedToTable) {
+  EXPECT_FALSE(ParsedValueReferencesInput(true, 0x40));
+}
+
 }  // namespace
 }  // namespace grpc_core
 
@@ -29,6 +29,7 @@
 #include "gtest/gtest.h"
 #include "src/core/ext/transport/chttp2/transport/bin_encoder.h"
 #include "src/core/ext/transport/chttp2/transport/decode_huff.h"
+#include "src/core/ext/transport/chttp2/transport/decode_huff_multi.h"
 #include "src/core/ext/transport/chttp2/transport/huffsyms.h"
 #include "src/core/util/dump_args.h"
 
@@ -117,5 +118,35 @@ void DifferentialOptimizedTest(std::vector<uint8_t> buffer) {
 }
 FUZZ_TEST(HuffTest, DifferentialOptimizedTest);
 
+std::optional<std::vector<uint8_t>> DecodeHuffMulti(const uint8_t* begin,
+                                                    const uint8_t* end) {
+  std::vector<uint8_t> v;
+  auto f = [&](uint8_t x) { v.push_back(x); };
+  if (!MultiSymbolHuffDecoder<decltype(f)>(f, begin, end).Run()) {
+    return std::nullopt;
+  }
+  return v;
+}
+
+void DifferentialMultiSymbolTest(std::vector<uint8_t> buffer) {
+  auto fast = DecodeHuffFast(buffer.data(), buffer.data() + buffer.size());
+  auto multi = DecodeHuffMulti(buffer.data(), buffer.data() + buffer.size());
+  EXPECT_EQ(multi, fast) << GRPC_DUMP_ARGS(ToString(buffer), ToString(fast),
+                                           ToString(multi));
+}
+FUZZ_TEST(HuffTest, DifferentialMultiSymbolTest);
+
+void MultiSymbolEncodeDecodeRoundTrips(std::vector<uint8_t> buffer) {
+  grpc_slice uncompressed = grpc_slice_from_copied_buffer(
+      reinterpret_cast<const char*>(buffer.data()), buffer.size());
+  grpc_slice compressed = grpc_chttp2_huffman_compress(uncompressed);
+  EXPECT_EQ(DecodeHuffMulti(GRPC_SLICE_START_PTR(compressed),
+                            GRPC_SLICE_END_PTR(compressed)),
+            buffer);
+  grpc_slice_unref(uncompressed);
+  grpc_slice_unref(compressed);
+}
+FUZZ_TEST(HuffTest, MultiSymbolEncodeDecodeRoundTrips);
+
 }  // namespace
 }  // namespace grpc_core
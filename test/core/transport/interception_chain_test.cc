@@ -414,6 +414,40 @@ TEST_F(InterceptionChainTest, FailsToInstantiateFilter2) {
   EXPECT_EQ(r.status().message(), "👊 failed to instantiate 2");
 }
 
+TEST_F(InterceptionChainTest, SealedFilters) {
+  CreationLog log;
+  auto r = InterceptionChainBuilder(ChannelArgs().SetObject(&log))
+               .Add<TestFilter<1>>()
+               .AddSealed<TestFilter<2>, TestFilter<3>>()
+               .Add<TestHijackingInterceptor<4>>()
+               .Build(destination());
+  ASSERT_TRUE(r.ok()) << r.status();
+  EXPECT_THAT(log.entries, ::testing::ElementsAre(CreationLogEntry{0, 1},
+                                                  CreationLogEntry{0, 2},
+                                                  CreationLogEntry{0, 3},
+                                                  CreationLogEntry{0, 4}));
+  auto finished_call = RunCall(r.value().get());
+  EXPECT_EQ(finished_call.server_metadata->get(GrpcStatusMetadata()),
+            GRPC_STATUS_INTERNAL);
+  ASSERT_NE(finished_call.client_metadata, nullptr);
+  std::string backing;
+  for (const char* key :
+       {"passed-through-1", "passed-through-2", "passed-through-3"}) {
+    EXPECT_EQ(finished_call.client_metadata->GetStringValue(key, &backing),
+              "true")
+        << key;
+  }
+}
+
+TEST_F(InterceptionChainTest, FailsToInstantiateSealedFilter) {
+  auto r = InterceptionChainBuilder(ChannelArgs())
+               .AddSealed<TestFilter<1>, FailsToInstantiateFilter<2>>()
+               .Build(destination());
+  EXPECT_FALSE(r.ok());
+  EXPECT_EQ(r.status().code(), absl::StatusCode::kInternal);
+  EXPECT_EQ(r.status().message(), "👊 failed to instantiate 2");
+}
+
 TEST_F(InterceptionChainTest, CreationOrderCorrect) {
   CreationLog log;
   auto r = InterceptionChainBuilder(ChannelArgs().SetObject(&log))
@@ -126,6 +126,36 @@ TEST(MetadataMapTest, NonEncodableTrait) {
   EXPECT_EQ(map.DebugString(), "GrpcStreamNetworkState: not sent on wire");
 }
 
+// Records where each unknown key's bytes live.
+struct UnknownKeyRecorder {
+  void Encode(const Slice& key, const Slice&) { keys.push_back(key.data()); }
+  template <typename T, typename V>
+  void Encode(T, const V&) {}
+  std::vector<const uint8_t*> keys;
+};
+
+TEST(MetadataMapTest, CopyEncodableTo) {
+  grpc_metadata_batch map;
+  map.Set(HttpPathMetadata(), Slice::FromStaticString("/foo/bar"));
+  map.Set(GrpcStreamNetworkState(), GrpcStreamNetworkState::kNotSentOnWire);
+  const std::string key(32, 'k');
+  map.Append(key, Slice::FromCopiedString("value"),
+             [](absl::string_view, const Slice&) { abort(); });
+  grpc_metadata_batch copy;
+  map.CopyEncodableTo(&copy);
+  EXPECT_EQ(copy.get_pointer(HttpPathMetadata())->as_string_view(),
+            "/foo/bar");
+  EXPECT_FALSE(copy.get(GrpcStreamNetworkState()).has_value());
+  std::string backing;
+  EXPECT_EQ(copy.GetStringValue(key, &backing), "value");
+  // Unknown keys are shared, not copied.
+  UnknownKeyRecorder recorder;
+  map.Encode(&recorder);
+  copy.Encode(&recorder);
+  ASSERT_EQ(recorder.keys.size(), 2u);
+  EXPECT_EQ(recorder.keys[0], recorder.keys[1]);
+}
+
 TEST(MetadataMapTest, NonTraitKeyWithMultipleValues) {
   FakeEncoder encoder;
   TimeoutOnlyMetadataMap map;
@@ -335,6 +365,70 @@ TEST(MetadataMapTest, FilterTest) {
   EXPECT_EQ(map.count(), kNumNonEncodableHeaders);
 }
 
+TEST(MetadataMapTest, KnownKeysResolveToTraits) {
+  grpc_metadata_batch map;
+  const std::vector<std::string> keys = GetEncodableHeaders();
+  for (const std::string& key : keys) {
+    map.Append(key, Slice::FromStaticString("value1"),
+               [](absl::string_view /*error*/, const Slice& /*value*/) {});
+  }
+  // Keys that differ from a known key in length or in one byte.
+  for (absl::string_view key : {":pat", ":paths", "grpc-statuz", "grpc-xtatus",
+                                "tf", "lb-cost-bix"}) {
+    map.Append(key, Slice::FromStaticString("value1"),
+               [](absl::string_view /*error*/, const Slice& /*value*/) {});
+  }
+  // Removing the unknown headers leaves exactly the known ones.
+  map.Filter(HeaderFilter<true>());
+  EXPECT_EQ(map.count(), keys.size());
+}
+
+TEST(MetadataMapTest, GetStringValueByInternedKey) {
+  grpc_metadata_batch map;
+  auto on_error = [](absl::string_view /*error*/, const Slice& /*value*/) {};
+  map.Append("x-mesh-tenant", Slice::FromStaticString("a"), on_error);
+  map.Append("x-mesh-zone", Slice::FromStaticString("b"), on_error);
+  map.Append("x-mesh-tenant", Slice::FromStaticString("c"), on_error);
+  auto tenant = InternedMetadataKey::Find("x-mesh-tenant");
+  ASSERT_TRUE(tenant.has_value());
+  EXPECT_EQ(InternedMetadataKey::Intern("x-mesh-tenant"), tenant);
+  EXPECT_NE(InternedMetadataKey::Intern("x-mesh-zone"), tenant);
+  std::string buffer;
+  EXPECT_EQ(map.GetStringValue(*tenant, &buffer), "a,c");
+  auto absent = InternedMetadataKey::Intern("x-mesh-absent");
+  ASSERT_TRUE(absent.has_value());
+  EXPECT_EQ(map.GetStringValue(*absent, &buffer), std::nullopt);
+  // Copies keep pointing at the interned keys.
+  grpc_metadata_batch copy = map.Copy();
+  EXPECT_EQ(copy.GetStringValue(*tenant, &buffer), "a,c");
+}
+
+TEST(InternedMetadataKeyTest, LongKeysAreNotInterned) {
+  const std::string key(InternedMetadataKey::kMaxKeyLength + 1, 'k');
+  EXPECT_FALSE(InternedMetadataKey::Intern(key).has_value());
+  EXPECT_FALSE(InternedMetadataKey::Find("never-interned-key").has_value());
+}
+
+TEST(KeyIndexTest, FindsEachKey) {
+  const std::vector<absl::string_view> keys = {"a", "bb", ":path", "grpc-x",
+                                               "grpc-y", "grpc-xx"};
+  metadata_detail::KeyIndex index(keys);
+  for (size_t i = 0; i < keys.size(); ++i) {
+    EXPECT_EQ(index.Find(keys[i]), static_cast<int>(i)) << keys[i];
+  }
+  EXPECT_EQ(index.Find(""), -1);
+  EXPECT_EQ(index.Find("b"), -1);
+  EXPECT_EQ(index.Find("grpc-z"), -1);
+}
+
+TEST(KeyIndexTest, FallsBackWhenNoPerfectHashExists) {
+  // Duplicate (and empty) keys can never hash perfectly.
+  metadata_detail::KeyIndex index({"dup", "", "dup"});
+  EXPECT_EQ(index.Find("dup"), 0);
+  EXPECT_EQ(index.Find(""), 1);
+  EXPECT_EQ(index.Find("other"), -1);
+}
+
 }  // namespace testing
 }  // namespace grpc_core
 
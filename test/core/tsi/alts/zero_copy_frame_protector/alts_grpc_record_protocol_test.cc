@@ -321,6 +321,33 @@ static void random_seal_unseal(alts_grpc_record_protocol* sender,
   }
 }
 
+static void unique_slices_seal_unseal(alts_grpc_record_protocol* sender,
+                                      alts_grpc_record_protocol* receiver) {
+  for (size_t i = 0; i < kSealRepeatTimes; i++) {
+    alts_grpc_record_protocol_test_var* var =
+        alts_grpc_record_protocol_test_var_create();
+    // Replaces duplicate_sb with copies, so that the slices of original_sb
+    // are not shared and may be protected in place.
+    grpc_slice_buffer_reset_and_unref(&var->duplicate_sb);
+    for (size_t j = 0; j < var->original_sb.count; j++) {
+      grpc_slice_buffer_add(&var->duplicate_sb,
+                            grpc_slice_copy(var->original_sb.slices[j]));
+    }
+    size_t data_length = var->original_sb.length;
+    tsi_result status = alts_grpc_record_protocol_protect(
+        sender, &var->original_sb, &var->protected_sb);
+    ASSERT_EQ(status, TSI_OK);
+    ASSERT_EQ(var->protected_sb.length,
+              data_length + var->header_length + var->tag_length);
+    status = alts_grpc_record_protocol_unprotect(receiver, &var->protected_sb,
+                                                 &var->unprotected_sb);
+    ASSERT_EQ(status, TSI_OK);
+    ASSERT_TRUE(
+        are_slice_buffers_equal(&var->unprotected_sb, &var->duplicate_sb));
+    alts_grpc_record_protocol_test_var_destroy(var);
+  }
+}
+
 static void empty_seal_unseal(alts_grpc_record_protocol* sender,
                               alts_grpc_record_protocol* receiver) {
   for (size_t i = 0; i < kSealRepeatTimes; i++) {
@@ -419,6 +446,12 @@ static void alts_grpc_record_protocol_random_seal_unseal_tests(
   random_seal_unseal(fixture->server_protect, fixture->client_unprotect);
 }
 
+static void alts_grpc_record_protocol_unique_slices_seal_unseal_tests(
+    alts_grpc_record_protocol_test_fixture* fixture) {
+  unique_slices_seal_unseal(fixture->client_protect, fixture->server_unprotect);
+  unique_slices_seal_unseal(fixture->server_protect, fixture->client_unprotect);
+}
+
 static void alts_grpc_record_protocol_empty_seal_unseal_tests(
     alts_grpc_record_protocol_test_fixture* fixture) {
   empty_seal_unseal(fixture->client_protect, fixture->server_unprotect);
@@ -463,6 +496,10 @@ static void alts_grpc_record_protocol_tests(
   auto* fixture_5 = fixture_create();
   alts_grpc_record_protocol_input_check_tests(fixture_5);
   alts_grpc_record_protocol_test_fixture_destroy(fixture_5);
+
+  auto* fixture_6 = fixture_create();
+  alts_grpc_record_protocol_unique_slices_seal_unseal_tests(fixture_6);
+  alts_grpc_record_protocol_test_fixture_destroy(fixture_6);
 }
 
 TEST(AltsGrpcRecordProtocolTest, MainTest) {
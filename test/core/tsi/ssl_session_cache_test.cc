@@ -166,6 +166,39 @@ TEST(SslSessionCacheTest, PutAndGet) {
   SSL_CTX_free(ssl_ctx);
 }
 
+TEST(SslSessionCacheTest, CountsHitsAndMisses) {
+  SessionTracker tracker;
+  RefCountedPtr<tsi::SslSessionLRUCache> cache =
+      tsi::SslSessionLRUCache::Create(3);
+  cache->Put("first.dropbox.com", tracker.NewSession(1));
+  EXPECT_TRUE(cache->Get("first.dropbox.com"));
+  EXPECT_TRUE(cache->Get("first.dropbox.com"));
+  EXPECT_FALSE(cache->Get("second.dropbox.com"));
+  EXPECT_EQ(cache->hits(), 2);
+  EXPECT_EQ(cache->misses(), 1);
+}
+
+TEST(SslSessionCacheTest, ShardedCacheKeepsCapacity) {
+  constexpr size_t kCapacity = tsi::SslSessionLRUCache::kMaxShards *
+                               tsi::SslSessionLRUCache::kMinShardCapacity;
+  SessionTracker tracker;
+  {
+    RefCountedPtr<tsi::SslSessionLRUCache> cache =
+        tsi::SslSessionLRUCache::Create(kCapacity);
+    for (long id = 0; id < static_cast<long>(3 * kCapacity); id++) {
+      std::string domain = std::to_string(id) + ".random.domain";
+      cache->Put(domain.c_str(), tracker.NewSession(id));
+    }
+    EXPECT_EQ(cache->Size(), kCapacity);
+    EXPECT_EQ(tracker.AliveCount(), kCapacity);
+    // The most recently added session is never evicted.
+    std::string last_domain =
+        std::to_string(3 * kCapacity - 1) + ".random.domain";
+    EXPECT_TRUE(cache->Get(last_domain.c_str()));
+  }
+  EXPECT_EQ(tracker.AliveCount(), 0);
+}
+
 TEST(SslSessionCacheTest, CapacityZeroCache) {
   // Set up an empty cache and an SSL session.
   SSL_CTX* ssl_ctx = SSL_CTX_new(TLS_method());
@@ -19,6 +19,7 @@
 #include "src/core/tsi/ssl_transport_security.h"
 
 #include <grpc/grpc.h>
+#include <grpc/slice_buffer.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/string_util.h>
 #include <gtest/gtest.h>
@@ -29,9 +30,13 @@
 #include <stdio.h>
 #include <string.h>
 
+#include <string>
+
 #include "absl/log/absl_log.h"
 #include "absl/strings/str_cat.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/tsi/transport_security.h"
+#include "src/core/tsi/transport_security_grpc.h"
 #include "src/core/tsi/transport_security_interface.h"
 #include "src/core/util/memory.h"
 #include "test/core/test_util/build.h"
@@ -953,6 +958,61 @@ TEST_P(SslTransportSecurityTest, DoRoundTripOddBufferSize) {
   }
 }
 
+TEST_P(SslTransportSecurityTest, DoRoundTripWithZeroCopyGrpcProtectors) {
+  SetUpSslFixture(/*tls_version=*/std::get<0>(GetParam()),
+                  /*send_client_ca_list=*/std::get<1>(GetParam()));
+  DoHandshake();
+  tsi_zero_copy_grpc_protector* client_protector = nullptr;
+  tsi_zero_copy_grpc_protector* server_protector = nullptr;
+  ASSERT_EQ(tsi_handshaker_result_create_zero_copy_grpc_protector(
+                ssl_tsi_test_fixture_->client_result, nullptr,
+                &client_protector),
+            TSI_OK);
+  ASSERT_EQ(tsi_handshaker_result_create_zero_copy_grpc_protector(
+                ssl_tsi_test_fixture_->server_result, nullptr,
+                &server_protector),
+            TSI_OK);
+  std::string message(100000, '\0');
+  for (size_t i = 0; i < message.size(); ++i) message[i] = i % 251;
+  // Split the message so that some records span several slices.
+  grpc_slice_buffer unprotected;
+  grpc_slice_buffer protected_slices;
+  grpc_slice_buffer received;
+  grpc_slice_buffer_init(&unprotected);
+  grpc_slice_buffer_init(&protected_slices);
+  grpc_slice_buffer_init(&received);
+  size_t offset = 0;
+  for (size_t size : {1, 3000, 20000}) {
+    grpc_slice_buffer_add(&unprotected, grpc_slice_from_copied_buffer(
+                                            message.data() + offset, size));
+    offset += size;
+  }
+  grpc_slice_buffer_add(
+      &unprotected, grpc_slice_from_copied_buffer(message.data() + offset,
+                                                  message.size() - offset));
+  ASSERT_EQ(tsi_zero_copy_grpc_protector_protect(
+                client_protector, &unprotected, &protected_slices),
+            TSI_OK);
+  EXPECT_EQ(unprotected.length, 0u);
+  EXPECT_GT(protected_slices.length, message.size());
+  int min_progress_size = 0;
+  ASSERT_EQ(tsi_zero_copy_grpc_protector_unprotect(
+                server_protector, &protected_slices, &received,
+                &min_progress_size),
+            TSI_OK);
+  EXPECT_EQ(protected_slices.length, 0u);
+  ASSERT_EQ(received.length, message.size());
+  std::string received_message(received.length, '\0');
+  grpc_slice_buffer_move_first_into_buffer(&received, received.length,
+                                           &received_message[0]);
+  EXPECT_EQ(received_message, message);
+  grpc_slice_buffer_destroy(&unprotected);
+  grpc_slice_buffer_destroy(&protected_slices);
+  grpc_slice_buffer_destroy(&received);
+  tsi_zero_copy_grpc_protector_destroy(client_protector);
+  tsi_zero_copy_grpc_protector_destroy(server_protector);
+}
+
 TEST_P(SslTransportSecurityTest, DoHandshakeSessionCache) {
   ABSL_LOG(INFO) << "ssl_tsi_test_do_handshake_session_cache";
   tsi_ssl_session_cache* session_cache = tsi_ssl_session_cache_create_lru(16);
@@ -1120,6 +1180,48 @@ TEST(SslTransportSecurityTest, TestServerHandshakerFactoryRefcounting) {
   ssl_test_pem_key_cert_pair_destroy(cert_pair);
 }
 
+TEST(SslTransportSecurityTest, SharedClientHandshakerFactory) {
+  if (!grpc_core::IsSharedSslClientContextEnabled()) {
+    GTEST_SKIP() << "shared_ssl_client_context experiment is disabled";
+  }
+  char* root_cert = load_file(SSL_TSI_TEST_CREDENTIALS_DIR "ca.pem");
+  // A separate copy of the same roots, so only contents can match.
+  std::string root_cert_copy(root_cert);
+  tsi_ssl_client_handshaker_options options;
+  options.pem_root_certs = root_cert;
+  tsi_ssl_client_handshaker_factory* first;
+  ASSERT_EQ(tsi_create_ssl_client_handshaker_factory_with_options(&options,
+                                                                  &first),
+            TSI_OK);
+  options.pem_root_certs = root_cert_copy.c_str();
+  tsi_ssl_client_handshaker_factory* second;
+  ASSERT_EQ(tsi_create_ssl_client_handshaker_factory_with_options(&options,
+                                                                  &second),
+            TSI_OK);
+  EXPECT_EQ(first, second);
+  options.max_tls_version = tsi_tls_version::TSI_TLS1_2;
+  tsi_ssl_client_handshaker_factory* other;
+  ASSERT_EQ(tsi_create_ssl_client_handshaker_factory_with_options(&options,
+                                                                  &other),
+            TSI_OK);
+  EXPECT_NE(first, other);
+  tsi_ssl_client_handshaker_factory_unref(other);
+  tsi_ssl_client_handshaker_factory_unref(second);
+  tsi_handshaker* handshaker;
+  ASSERT_EQ(tsi_ssl_client_handshaker_factory_create_handshaker(
+                first, "google.com", 0, 0, &handshaker),
+            TSI_OK);
+  tsi_ssl_client_handshaker_factory_unref(first);
+  tsi_handshaker_destroy(handshaker);
+  // Once every ref is gone the options get a fresh factory.
+  options.max_tls_version = tsi_tls_version::TSI_TLS1_3;
+  ASSERT_EQ(tsi_create_ssl_client_handshaker_factory_with_options(&options,
+                                                                  &first),
+            TSI_OK);
+  tsi_ssl_client_handshaker_factory_unref(first);
+  gpr_free(root_cert);
+}
+
 // Attempting to create a handshaker factory with invalid parameters should fail
 // but not crash.
 TEST(SslTransportSecurityTest, TestClientHandshakerFactoryBadParams) {
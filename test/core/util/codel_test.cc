@@ -0,0 +1,97 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/util/codel.h"
+
+#include "gtest/gtest.h"
+#include "src/core/util/time.h"
+
+namespace grpc_core {
+namespace {
+
+constexpr Duration kTarget = Duration::Milliseconds(5);
+constexpr Duration kInterval = Duration::Milliseconds(100);
+
+Timestamp Start() {
+  return Timestamp::FromMillisecondsAfterProcessEpoch(1000000);
+}
+
+TEST(CoDelTest, NotOverloadedInitially) {
+  CoDel codel(kTarget, kInterval);
+  EXPECT_FALSE(codel.Overloaded(Start()));
+}
+
+TEST(CoDelTest, OverloadedWhenMinimumDelayExceedsTarget) {
+  CoDel codel(kTarget, kInterval);
+  Timestamp now = Start();
+  codel.RecordQueueingDelay(Duration::Milliseconds(20), now);
+  codel.RecordQueueingDelay(Duration::Milliseconds(10), now + kInterval / 2);
+  EXPECT_FALSE(codel.Overloaded(now + kInterval / 2));
+  // The interval is judged by the first item to leave after it ends.
+  now += kInterval;
+  codel.RecordQueueingDelay(Duration::Milliseconds(30), now);
+  EXPECT_TRUE(codel.Overloaded(now));
+}
+
+TEST(CoDelTest, BurstThatDrainsIsNotOverload) {
+  CoDel codel(kTarget, kInterval);
+  Timestamp now = Start();
+  codel.RecordQueueingDelay(Duration::Milliseconds(50), now);
+  codel.RecordQueueingDelay(Duration::Zero(), now + kInterval / 2);
+  now += kInterval;
+  codel.RecordQueueingDelay(Duration::Milliseconds(50), now);
+  EXPECT_FALSE(codel.Overloaded(now));
+}
+
+TEST(CoDelTest, RecoversOnceDelaysFall) {
+  CoDel codel(kTarget, kInterval);
+  Timestamp now = Start();
+  codel.RecordQueueingDelay(Duration::Milliseconds(20), now);
+  now += kInterval;
+  codel.RecordQueueingDelay(Duration::Milliseconds(1), now);
+  EXPECT_TRUE(codel.Overloaded(now));
+  now += kInterval;
+  codel.RecordQueueingDelay(Duration::Milliseconds(20), now);
+  EXPECT_FALSE(codel.Overloaded(now));
+}
+
+TEST(CoDelTest, VerdictLapsesWithoutItems) {
+  CoDel codel(kTarget, kInterval);
+  Timestamp now = Start();
+  codel.RecordQueueingDelay(Duration::Milliseconds(20), now);
+  now += kInterval;
+  codel.RecordQueueingDelay(Duration::Milliseconds(20), now);
+  EXPECT_TRUE(codel.Overloaded(now));
+  EXPECT_FALSE(codel.Overloaded(now + kInterval * 2));
+  // Nor is an interval that ended long ago judged by its items.
+  codel.RecordQueueingDelay(Duration::Milliseconds(20), now + kInterval * 3);
+  EXPECT_FALSE(codel.Overloaded(now + kInterval * 3));
+}
+
+TEST(CoDelTest, ZeroTargetDisables) {
+  CoDel codel;
+  Timestamp now = Start();
+  codel.RecordQueueingDelay(Duration::Seconds(1), now);
+  now += kInterval;
+  codel.RecordQueueingDelay(Duration::Seconds(1), now);
+  EXPECT_FALSE(codel.Overloaded(now));
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,74 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/util/fast_random.h"
+
+#include <stdint.h>
+
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "absl/random/distributions.h"
+#include "gtest/gtest.h"
+
+namespace grpc_core {
+namespace testing {
+
+TEST(FastRandomTest, NoRepeatsInShortRun) {
+  std::set<uint64_t> seen;
+  for (int i = 0; i < 10000; ++i) {
+    EXPECT_TRUE(seen.insert(FastRandom::Next()).second);
+  }
+}
+
+TEST(FastRandomTest, BelowStaysInRangeAndCoversIt) {
+  constexpr uint64_t kN = 10;
+  std::vector<int> counts(kN);
+  for (int i = 0; i < 100000; ++i) {
+    const uint64_t value = FastRandom::Below(kN);
+    ASSERT_LT(value, kN);
+    ++counts[value];
+  }
+  // Expect ~10000 each.
+  for (int count : counts) {
+    EXPECT_GT(count, 9000);
+    EXPECT_LT(count, 11000);
+  }
+}
+
+TEST(FastRandomTest, WorksWithAbslDistributions) {
+  FastRandom rng;
+  for (int i = 0; i < 1000; ++i) {
+    const int value = absl::Uniform(rng, 1, 100);
+    EXPECT_GE(value, 1);
+    EXPECT_LT(value, 100);
+  }
+}
+
+TEST(FastRandomTest, ThreadsGetDifferentSequences) {
+  uint64_t other = 0;
+  std::thread thread([&other]() { other = FastRandom::Next(); });
+  thread.join();
+  const uint64_t mine = FastRandom::Next();
+  EXPECT_NE(mine, other);
+}
+
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
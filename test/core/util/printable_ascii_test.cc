@@ -0,0 +1,68 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/util/printable_ascii.h"
+
+#include <string>
+
+#include "gtest/gtest.h"
+
+namespace grpc_core {
+namespace testing {
+
+bool BytewisePrintableWithout(absl::string_view x, uint8_t excluded) {
+  for (char c : x) {
+    const uint8_t b = static_cast<uint8_t>(c);
+    if (b < 0x20 || b > 0x7e || b == excluded) return false;
+  }
+  return true;
+}
+
+TEST(PrintableAsciiTest, Empty) {
+  EXPECT_TRUE(IsPrintableAscii(""));
+  EXPECT_TRUE(IsPrintableAsciiWithout("", '%'));
+}
+
+TEST(PrintableAsciiTest, AllPrintable) {
+  std::string s;
+  for (int c = 0x20; c <= 0x7e; ++c) s.push_back(static_cast<char>(c));
+  EXPECT_TRUE(IsPrintableAscii(s));
+  EXPECT_FALSE(IsPrintableAsciiWithout(s, '%'));
+}
+
+// Every byte value at every position of strings long enough to exercise both
+// the word-at-a-time loop and the tail.
+TEST(PrintableAsciiTest, MatchesBytewiseCheck) {
+  for (size_t length : {1, 7, 8, 9, 16, 23}) {
+    for (size_t pos = 0; pos < length; ++pos) {
+      for (int c = 0; c < 256; ++c) {
+        std::string s(length, 'a');
+        s[pos] = static_cast<char>(c);
+        EXPECT_EQ(IsPrintableAscii(s), BytewisePrintableWithout(s, 0))
+            << length << " " << pos << " " << c;
+        EXPECT_EQ(IsPrintableAsciiWithout(s, '%'),
+                  BytewisePrintableWithout(s, '%'))
+            << length << " " << pos << " " << c;
+      }
+    }
+  }
+}
+
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -21,7 +21,9 @@
 #include <memory>
 #include <new>
 #include <set>
+#include <thread>
 #include <type_traits>
+#include <vector>
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -206,6 +208,85 @@ TEST(RefCountedNonPolymorphicWithTracing, Basic) {
   foo->Unref(DEBUG_LOCATION, "original_ref");
 }
 
+class FooBiased : public RefCounted<FooBiased, PolymorphicRefCount,
+                                    UnrefDelete, BiasedRefCount> {
+ public:
+  explicit FooBiased(bool* destroyed) : destroyed_(destroyed) {}
+  ~FooBiased() override { *destroyed_ = true; }
+
+ private:
+  bool* const destroyed_;
+};
+
+TEST(RefCountedBiased, Basic) {
+  bool destroyed = false;
+  FooBiased* foo = new FooBiased(&destroyed);
+  RefCountedPtr<FooBiased> foop = foo->Ref();
+  foop.reset();
+  EXPECT_FALSE(destroyed);
+  foo->Unref();
+  EXPECT_TRUE(destroyed);
+}
+
+TEST(RefCountedBiased, OwnerRefsAgainAfterDroppingAll) {
+  bool destroyed = false;
+  RefCountedPtr<FooBiased> foo(new FooBiased(&destroyed));
+  // A ref taken on another thread keeps the object alive while the owner
+  // has none.
+  RefCountedPtr<FooBiased> other;
+  std::thread([&]() { other = foo; }).join();
+  foo.reset();
+  EXPECT_FALSE(destroyed);
+  foo = other->Ref();
+  std::thread([&]() { other.reset(); }).join();
+  EXPECT_FALSE(destroyed);
+  foo.reset();
+  EXPECT_TRUE(destroyed);
+}
+
+TEST(RefCountedBiased, OwnerThreadExits) {
+  bool destroyed = false;
+  RefCountedPtr<FooBiased> foo;
+  std::thread([&]() { foo.reset(new FooBiased(&destroyed)); }).join();
+  RefCountedPtr<FooBiased> other = foo;
+  foo.reset();
+  EXPECT_FALSE(destroyed);
+  other.reset();
+  EXPECT_TRUE(destroyed);
+}
+
+TEST(RefCountedBiased, LastUnrefOnOtherThread) {
+  bool destroyed = false;
+  RefCountedPtr<FooBiased> foo(new FooBiased(&destroyed));
+  RefCountedPtr<FooBiased> other = foo;
+  foo.reset();
+  EXPECT_FALSE(destroyed);
+  std::thread([&]() { other.reset(); }).join();
+  EXPECT_TRUE(destroyed);
+}
+
+TEST(RefCountedBiased, RefsFromManyThreads) {
+  bool destroyed = false;
+  RefCountedPtr<FooBiased> foo(new FooBiased(&destroyed));
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([&]() {
+      for (int j = 0; j < 1000; ++j) {
+        RefCountedPtr<FooBiased> copy = foo;
+        RefCountedPtr<FooBiased> if_non_zero = copy->RefIfNonZero();
+        EXPECT_NE(if_non_zero, nullptr);
+      }
+    });
+  }
+  for (int j = 0; j < 1000; ++j) {
+    RefCountedPtr<FooBiased> copy = foo;
+  }
+  for (auto& thread : threads) thread.join();
+  EXPECT_FALSE(destroyed);
+  foo.reset();
+  EXPECT_TRUE(destroyed);
+}
+
 }  // namespace
 }  // namespace testing
 }  // namespace grpc_core
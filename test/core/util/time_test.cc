@@ -61,6 +61,22 @@ TEST(DurationTest, Scales) {
             Duration::Milliseconds(1300));
 }
 
+TEST(TimestampTest, CoarseNowLagsNowSlightly) {
+  const Timestamp before = Timestamp::Now();
+  const Timestamp coarse = Timestamp::CoarseNow();
+  const Timestamp after = Timestamp::Now();
+  EXPECT_LE(coarse, after);
+  // Coarse clocks tick at least every few milliseconds; allow a generous
+  // margin for slow test machines.
+  EXPECT_GE(coarse, before - Duration::Milliseconds(100));
+}
+
+TEST(TimestampTest, CoarseNowUsesTimeCache) {
+  ScopedTimeCache cache;
+  const Timestamp now = Timestamp::Now();
+  EXPECT_EQ(Timestamp::CoarseNow(), now);
+}
+
 TEST(DurationTest, Epsilon) {
   EXPECT_LE(Duration::Epsilon(), Duration::Milliseconds(1));
 }
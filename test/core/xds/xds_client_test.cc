@@ -27,6 +27,7 @@
 #include <stdint.h>
 
 #include <algorithm>
+#include <atomic>
 #include <deque>
 #include <fstream>
 #include <map>
@@ -444,6 +445,7 @@ class XdsClientTest : public ::testing::Test {
     XdsResourceType::DecodeResult Decode(
         const XdsResourceType::DecodeContext& /*context*/,
         absl::string_view serialized_resource) const override {
+      num_decodes_.fetch_add(1, std::memory_order_relaxed);
       auto json = JsonParse(serialized_resource);
       XdsResourceType::DecodeResult result;
       if (!json.ok()) {
@@ -464,6 +466,11 @@ class XdsClientTest : public ::testing::Test {
     bool AllResourcesRequiredInSotW() const override {
       return all_resources_required_in_sotw;
     }
+
+    // The number of resources decoded so far.
+    static size_t num_decodes() {
+      return num_decodes_.load(std::memory_order_relaxed);
+    }
     void InitUpbSymtab(XdsClient*, upb_DefPool* /*symtab*/) const override {}
 
     static google::protobuf::Any EncodeAsAny(const ResourceStruct& resource) {
@@ -473,6 +480,9 @@ class XdsClientTest : public ::testing::Test {
       any.set_value(resource.AsJsonString());
       return any;
     }
+
+   private:
+    static inline std::atomic<size_t> num_decodes_{0};
   };
 
   // A fake "Foo" xDS resource type.
@@ -4275,6 +4285,59 @@ TEST_F(XdsClientTest, ResourceWrappedInResourceMessage) {
   EXPECT_TRUE(stream->IsOrphaned());
 }
 
+TEST_F(XdsClientTest, UnchangedWrappedResourceIsNotDecodedAgain) {
+  InitXdsClient();
+  // Start a watch for "foo1".
+  auto watcher = StartFooWatch("foo1");
+  // XdsClient should have created an ADS stream.
+  auto stream = WaitForAdsStream();
+  ASSERT_TRUE(stream != nullptr);
+  // XdsClient should have sent a subscription request on the ADS stream.
+  auto request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  // Send a response with the resource wrapped in a Resource message.
+  stream->SendMessageToClient(
+      ResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_version_info("1")
+          .set_nonce("A")
+          .AddFooResource(XdsFooResource("foo1", 6),
+                          /*in_resource_wrapper=*/true)
+          .Serialize());
+  // XdsClient should have delivered the response to the watcher.
+  auto resource = watcher->WaitForNextResource();
+  ASSERT_NE(resource, nullptr);
+  EXPECT_EQ(resource->value, 6);
+  // XdsClient should have sent an ACK message to the xDS server.
+  request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckRequest(*request, XdsFooResourceType::Get()->type_url(),
+               /*version_info=*/"1", /*response_nonce=*/"A",
+               /*error_detail=*/absl::OkStatus(),
+               /*resource_names=*/{"foo1"});
+  // Server sends the same resource again in a new version.
+  const size_t num_decodes = XdsFooResourceType::num_decodes();
+  stream->SendMessageToClient(
+      ResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_version_info("2")
+          .set_nonce("B")
+          .AddFooResource(XdsFooResource("foo1", 6),
+                          /*in_resource_wrapper=*/true)
+          .Serialize());
+  // XdsClient should ACK the new version without decoding the resource
+  // or notifying the watcher.
+  request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckRequest(*request, XdsFooResourceType::Get()->type_url(),
+               /*version_info=*/"2", /*response_nonce=*/"B",
+               /*error_detail=*/absl::OkStatus(),
+               /*resource_names=*/{"foo1"});
+  EXPECT_EQ(XdsFooResourceType::num_decodes(), num_decodes);
+  EXPECT_FALSE(watcher->HasEvent());
+  // Cancel watch.
+  CancelFooWatch(watcher.get(), "foo1");
+  EXPECT_TRUE(stream->IsOrphaned());
+}
+
 TEST_F(XdsClientTest, MultipleResourceTypes) {
   InitXdsClient();
   // Start a watch for "foo1".
@@ -36,8 +36,13 @@ class XdsClientTestPeer {
     upb::Arena arena;
     auto* client_config = envoy_service_status_v3_ClientConfig_new(arena.ptr());
     std::set<std::string> string_pool;
-    MutexLock lock(xds_client_->mu());
-    xds_client_->DumpClientConfig(&string_pool, arena.ptr(), client_config);
+    XdsClient::ClientConfigSnapshot snapshot;
+    {
+      MutexLock lock(xds_client_->mu());
+      snapshot = xds_client_->SnapshotClientConfig();
+    }
+    xds_client_->DumpClientConfig(snapshot, &string_pool, arena.ptr(),
+                                  client_config);
     size_t output_length;
     char* output = envoy_service_status_v3_ClientConfig_serialize(
         client_config, arena.ptr(), &output_length);
@@ -646,6 +646,72 @@ TEST_P(TypedPerFilterConfigTest,
   EXPECT_THAT(typed_per_filter_config, ::testing::ElementsAre());
 }
 
+TEST_F(XdsRouteConfigTest, SameTypedPerFilterConfigOnManyRoutes) {
+  envoy::extensions::filters::http::fault::v3::HTTPFault fault_config;
+  fault_config.mutable_abort()->set_grpc_status(GRPC_STATUS_PERMISSION_DENIED);
+  RouteConfiguration route_config;
+  route_config.set_name("foo");
+  auto* vhost = route_config.add_virtual_hosts();
+  vhost->add_domains("*");
+  for (int i = 0; i < 3; ++i) {
+    auto* route_proto = vhost->add_routes();
+    route_proto->mutable_match()->set_prefix("");
+    route_proto->mutable_route()->set_cluster("cluster1");
+    (*route_proto->mutable_typed_per_filter_config())["fault"].PackFrom(
+        fault_config);
+  }
+  std::string serialized_resource;
+  ASSERT_TRUE(route_config.SerializeToString(&serialized_resource));
+  auto* resource_type = XdsRouteConfigResourceType::Get();
+  auto decode_result =
+      resource_type->Decode(decode_context_, serialized_resource);
+  ASSERT_TRUE(decode_result.resource.ok()) << decode_result.resource.status();
+  auto& resource =
+      static_cast<const XdsRouteConfigResource&>(**decode_result.resource);
+  ASSERT_EQ(resource.virtual_hosts.size(), 1UL);
+  ASSERT_EQ(resource.virtual_hosts[0].routes.size(), 3UL);
+  for (const auto& route : resource.virtual_hosts[0].routes) {
+    ASSERT_EQ(route.typed_per_filter_config.size(), 1UL);
+    auto it = route.typed_per_filter_config.find("fault");
+    ASSERT_NE(it, route.typed_per_filter_config.end());
+    EXPECT_EQ(it->second.config_proto_type_name,
+              "envoy.extensions.filters.http.fault.v3.HTTPFault");
+    EXPECT_EQ(JsonDump(it->second.config),
+              "{\"abortCode\":\"PERMISSION_DENIED\"}");
+  }
+}
+
+TEST_F(XdsRouteConfigTest, SameInvalidTypedPerFilterConfigOnManyRoutes) {
+  envoy::extensions::filters::http::fault::v3::HTTPFault fault_config;
+  fault_config.mutable_abort()->set_grpc_status(123);
+  RouteConfiguration route_config;
+  route_config.set_name("foo");
+  auto* vhost = route_config.add_virtual_hosts();
+  vhost->add_domains("*");
+  for (int i = 0; i < 2; ++i) {
+    auto* route_proto = vhost->add_routes();
+    route_proto->mutable_match()->set_prefix("");
+    route_proto->mutable_route()->set_cluster("cluster1");
+    (*route_proto->mutable_typed_per_filter_config())["fault"].PackFrom(
+        fault_config);
+  }
+  std::string serialized_resource;
+  ASSERT_TRUE(route_config.SerializeToString(&serialized_resource));
+  auto* resource_type = XdsRouteConfigResourceType::Get();
+  auto decode_result =
+      resource_type->Decode(decode_context_, serialized_resource);
+  // Each route reports its own error.
+  EXPECT_EQ(decode_result.resource.status().message(),
+            "errors validating RouteConfiguration resource: ["
+            "field:virtual_hosts[0].routes[0].typed_per_filter_config[fault]"
+            ".value[envoy.extensions.filters.http.fault.v3.HTTPFault]"
+            ".abort.grpc_status error:invalid gRPC status code: 123; "
+            "field:virtual_hosts[0].routes[1].typed_per_filter_config[fault]"
+            ".value[envoy.extensions.filters.http.fault.v3.HTTPFault]"
+            ".abort.grpc_status error:invalid gRPC status code: 123]")
+      << decode_result.resource.status();
+}
+
 //
 // retry policy tests
 //
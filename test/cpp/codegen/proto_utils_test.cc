@@ -16,12 +16,17 @@
 //
 //
 
+#include <google/protobuf/wrappers.pb.h>
 #include <grpc/byte_buffer.h>
 #include <grpc/slice.h>
 #include <grpcpp/impl/grpc_library.h>
 #include <grpcpp/impl/proto_utils.h>
 #include <gtest/gtest.h>
 
+#include <string>
+#include <vector>
+
+#include "absl/strings/cord.h"
 #include "test/core/test_util/test_config.h"
 
 namespace grpc {
@@ -61,6 +66,43 @@ class ProtoUtilsTest : public ::testing::Test {
   static void TearDownTestSuite() { grpc_shutdown(); }
 };
 
+TEST_F(ProtoUtilsTest, SerializesToSingleExactlySizedSlice) {
+  google::protobuf::StringValue msg;
+  msg.set_value(std::string(kProtoSerializeSingleSliceMaxLength / 2, 'x'));
+  ByteBuffer bb;
+  bool own_buffer;
+  ASSERT_TRUE(
+      SerializationTraits<google::protobuf::StringValue>::Serialize(
+          msg, &bb, &own_buffer)
+          .ok());
+  std::vector<Slice> slices;
+  ASSERT_TRUE(bb.Dump(&slices).ok());
+  ASSERT_EQ(slices.size(), 1u);
+  EXPECT_EQ(slices[0].size(), msg.ByteSizeLong());
+  google::protobuf::StringValue parsed;
+  ASSERT_TRUE(SerializationTraits<google::protobuf::StringValue>::Deserialize(
+                  &bb, &parsed)
+                  .ok());
+  EXPECT_EQ(parsed.value(), msg.value());
+}
+
+TEST_F(ProtoUtilsTest, ReadCordSharesLargeSlices) {
+  const std::string small(16, 's');
+  const std::string large(4096, 'l');
+  Slice slices[] = {Slice(small), Slice(large)};
+  ByteBuffer bb(slices, 2);
+  ProtoBufferReader reader(&bb);
+  absl::Cord cord;
+  ASSERT_TRUE(reader.ReadCord(&cord, small.size() + large.size()));
+  EXPECT_EQ(std::string(cord), small + large);
+  // The small slice is copied, and the large one is shared.
+  std::vector<absl::string_view> chunks(cord.Chunks().begin(),
+                                        cord.Chunks().end());
+  ASSERT_FALSE(chunks.empty());
+  EXPECT_EQ(chunks.back().data(),
+            reinterpret_cast<const char*>(slices[1].begin()));
+}
+
 // Regression test for a memory corruption bug where a series of
 // ProtoBufferWriter Next()/Backup() invocations could result in a dangling
 // pointer returned by Next() due to the interaction between grpc_slice inlining
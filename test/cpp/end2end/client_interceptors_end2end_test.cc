@@ -29,6 +29,7 @@
 #include <grpcpp/support/client_interceptor.h>
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <memory>
 #include <vector>
 
@@ -705,6 +706,35 @@ class LoggingInterceptorFactory
   }
 };
 
+// Only uses PRE_SEND_INITIAL_METADATA, and counts every batch it is run on.
+class InitialMetadataOnlyInterceptor : public experimental::Interceptor {
+ public:
+  void Intercept(experimental::InterceptorBatchMethods* methods) override {
+    EXPECT_TRUE(methods->QueryInterceptionHookPoint(
+        experimental::InterceptionHookPoints::PRE_SEND_INITIAL_METADATA));
+    num_times_run_++;
+    methods->Proceed();
+  }
+
+  experimental::InterceptionHookPointSet UsedHookPoints() const override {
+    return experimental::InterceptionHookPointBit(
+        experimental::InterceptionHookPoints::PRE_SEND_INITIAL_METADATA);
+  }
+
+  static std::atomic<int> num_times_run_;
+};
+
+std::atomic<int> InitialMetadataOnlyInterceptor::num_times_run_;
+
+class InitialMetadataOnlyInterceptorFactory
+    : public experimental::ClientInterceptorFactoryInterface {
+ public:
+  experimental::Interceptor* CreateClientInterceptor(
+      experimental::ClientRpcInfo* /*info*/) override {
+    return new InitialMetadataOnlyInterceptor();
+  }
+};
+
 class TestScenario {
  public:
   explicit TestScenario(const ChannelType& channel_type,
@@ -938,6 +968,23 @@ TEST_F(ClientInterceptorsEnd2endTest,
   EXPECT_EQ(PhonyInterceptor::GetNumTimesRun(), 12);
 }
 
+TEST_F(ClientInterceptorsEnd2endTest, ClientInterceptorUsedHookPointsTest) {
+  ChannelArguments args;
+  PhonyInterceptor::Reset();
+  InitialMetadataOnlyInterceptor::num_times_run_.store(0);
+  std::vector<std::unique_ptr<experimental::ClientInterceptorFactoryInterface>>
+      creators;
+  creators.push_back(std::make_unique<PhonyInterceptorFactory>());
+  creators.push_back(std::make_unique<InitialMetadataOnlyInterceptorFactory>());
+  creators.push_back(std::make_unique<PhonyInterceptorFactory>());
+  auto channel = experimental::CreateCustomChannelWithInterceptors(
+      server_address_, InsecureChannelCredentials(), args, std::move(creators));
+  MakeCall(channel);
+  // The receive batch skips the interceptor without reordering the others.
+  EXPECT_EQ(InitialMetadataOnlyInterceptor::num_times_run_.load(), 1);
+  EXPECT_EQ(PhonyInterceptor::GetNumTimesRun(), 2);
+}
+
 class ClientInterceptorsCallbackEnd2endTest : public ::testing::Test {
  protected:
   ClientInterceptorsCallbackEnd2endTest() {
@@ -23,6 +23,7 @@
 #include <grpcpp/server.h>
 #include <grpcpp/server_builder.h>
 #include <grpcpp/server_context.h>
+#include <grpcpp/support/arena_message_allocator.h>
 #include <grpcpp/support/client_callback.h>
 #include <grpcpp/support/message_allocator.h>
 #include <gtest/gtest.h>
@@ -350,6 +351,27 @@ TEST_P(ArenaAllocatorTest, SimpleRpc) {
   EXPECT_EQ(kRpcCount, allocator->allocation_count);
 }
 
+class PooledArenaAllocatorTest : public MessageAllocatorEnd2endTestBase {};
+
+TEST_P(PooledArenaAllocatorTest, SimpleRpc) {
+  const int kRpcCount = 10;
+  experimental::ArenaMessageAllocator<EchoRequest, EchoResponse> allocator;
+  CreateServer(&allocator);
+  ResetStub();
+  SendRpcs(kRpcCount);
+}
+
+TEST_P(PooledArenaAllocatorTest, MessagesOutgrowInitialBlock) {
+  const int kRpcCount = 10;
+  // Each request is larger than the initial block, and the pool holds a
+  // single arena.
+  experimental::ArenaMessageAllocator<EchoRequest, EchoResponse> allocator(
+      256, 1);
+  CreateServer(&allocator);
+  ResetStub();
+  SendRpcs(kRpcCount);
+}
+
 std::vector<TestScenario> CreateTestScenarios(bool test_insecure) {
   std::vector<TestScenario> scenarios;
   std::vector<std::string> credentials_types{
@@ -385,6 +407,8 @@ INSTANTIATE_TEST_SUITE_P(SimpleAllocatorTest, SimpleAllocatorTest,
                          ::testing::ValuesIn(CreateTestScenarios(true)));
 INSTANTIATE_TEST_SUITE_P(ArenaAllocatorTest, ArenaAllocatorTest,
                          ::testing::ValuesIn(CreateTestScenarios(true)));
+INSTANTIATE_TEST_SUITE_P(PooledArenaAllocatorTest, PooledArenaAllocatorTest,
+                         ::testing::ValuesIn(CreateTestScenarios(true)));
 
 }  // namespace
 }  // namespace testing
@@ -44,6 +44,7 @@
 #include "src/core/config/config_vars.h"
 #include "src/core/lib/address_utils/parse_address.h"
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/sockaddr.h"
 #include "src/core/lib/security/credentials/fake/fake_credentials.h"
 #include "src/core/load_balancing/rls/rls.h"
@@ -1017,6 +1018,61 @@ TEST_F(RlsEnd2endTest, CachedResponse) {
   EXPECT_EQ(backends_[0]->service_.request_count(), 2);
 }
 
+TEST_F(RlsEnd2endTest, CachedResponseFromSnapshot) {
+  if (!grpc_core::IsRlsLockFreeCacheReadsEnabled()) {
+    GTEST_SKIP() << "test requires rls_lock_free_cache_reads experiment";
+  }
+  const char* kTestValue2 = "test_value_2";
+  const char* kHeaderData = "header_data";
+  StartBackends(2);
+  SetNextResolution(
+      MakeServiceConfigBuilder()
+          .AddKeyBuilder(absl::StrFormat("\"names\":[{"
+                                         "  \"service\":\"%s\","
+                                         "  \"method\":\"%s\""
+                                         "}],"
+                                         "\"headers\":["
+                                         "  {"
+                                         "    \"key\":\"%s\","
+                                         "    \"names\":["
+                                         "      \"key1\""
+                                         "    ]"
+                                         "  }"
+                                         "]",
+                                         kServiceValue, kMethodValue, kTestKey))
+          .Build());
+  rls_server_->service_.SetResponse(
+      BuildRlsRequest({{kTestKey, kTestValue}}),
+      BuildRlsResponse({grpc_core::LocalIpUri(backends_[0]->port_)},
+                       kHeaderData));
+  rls_server_->service_.SetResponse(
+      BuildRlsRequest({{kTestKey, kTestValue2}}),
+      BuildRlsResponse({grpc_core::LocalIpUri(backends_[1]->port_)}));
+  CheckRpcSendOk(DEBUG_LOCATION,
+                 RpcOptions().set_metadata({{"key1", kTestValue}}));
+  // The response for kTestValue2 makes a new picker, whose snapshot has
+  // the entry for kTestValue.
+  CheckRpcSendOk(DEBUG_LOCATION,
+                 RpcOptions().set_metadata({{"key1", kTestValue2}}));
+  EXPECT_EQ(rls_server_->service_.request_count(), 2);
+  EXPECT_EQ(rls_server_->service_.response_count(), 2);
+  // Further RPCs for either key are routed from the snapshot, with the
+  // header data still attached.
+  for (size_t i = 0; i < 5; ++i) {
+    CheckRpcSendOk(DEBUG_LOCATION,
+                   RpcOptions().set_metadata({{"key1", kTestValue}}));
+    CheckRpcSendOk(DEBUG_LOCATION,
+                   RpcOptions().set_metadata({{"key1", kTestValue2}}));
+  }
+  EXPECT_EQ(rls_server_->service_.request_count(), 2);
+  EXPECT_EQ(rls_server_->service_.response_count(), 2);
+  EXPECT_EQ(backends_[0]->service_.request_count(), 6);
+  EXPECT_EQ(backends_[1]->service_.request_count(), 6);
+  EXPECT_THAT(backends_[0]->service_.rls_data(),
+              ::testing::ElementsAre(kHeaderData));
+  EXPECT_THAT(backends_[1]->service_.rls_data(), ::testing::IsEmpty());
+}
+
 TEST_F(RlsEnd2endTest, StaleCacheEntry) {
   StartBackends(1);
   SetNextResolution(
@@ -1066,6 +1122,58 @@ TEST_F(RlsEnd2endTest, StaleCacheEntry) {
   EXPECT_EQ(rls_server_->service_.response_count(), 2);
 }
 
+TEST_F(RlsEnd2endTest, HotCacheEntryRefreshedAhead) {
+  if (!grpc_core::IsRlsRefreshAheadEnabled()) {
+    GTEST_SKIP() << "test requires rls_refresh_ahead experiment";
+  }
+  StartBackends(1);
+  SetNextResolution(
+      MakeServiceConfigBuilder()
+          .AddKeyBuilder(absl::StrFormat("\"names\":[{"
+                                         "  \"service\":\"%s\","
+                                         "  \"method\":\"%s\""
+                                         "}],"
+                                         "\"headers\":["
+                                         "  {"
+                                         "    \"key\":\"%s\","
+                                         "    \"names\":["
+                                         "      \"key1\""
+                                         "    ]"
+                                         "  }"
+                                         "]",
+                                         kServiceValue, kMethodValue, kTestKey))
+          .set_max_age(grpc_core::Duration::Seconds(10))
+          .set_stale_age(grpc_core::Duration::Seconds(4))
+          .Build());
+  rls_server_->service_.SetResponse(
+      BuildRlsRequest({{kTestKey, kTestValue}}),
+      BuildRlsResponse({grpc_core::LocalIpUri(backends_[0]->port_)}));
+  // Send enough RPCs for the entry to count as hot.
+  for (int i = 0; i < 8; ++i) {
+    CheckRpcSendOk(DEBUG_LOCATION,
+                   RpcOptions().set_metadata({{"key1", kTestValue}}));
+  }
+  EXPECT_EQ(rls_server_->service_.request_count(), 1);
+  EXPECT_EQ(backends_[0]->service_.request_count(), 8);
+  // The refresh is sent with the data the entry already has.
+  rls_server_->service_.RemoveResponse(
+      BuildRlsRequest({{kTestKey, kTestValue}}));
+  rls_server_->service_.SetResponse(
+      BuildRlsRequest({{kTestKey, kTestValue}},
+                      RouteLookupRequest::REASON_STALE),
+      BuildRlsResponse({grpc_core::LocalIpUri(backends_[0]->port_)}));
+  // Wait past the refresh-ahead point, but not past the stale age.
+  gpr_sleep_until(grpc_timeout_seconds_to_deadline(3));
+  // This RPC uses the cached data and refreshes the entry.
+  CheckRpcSendOk(DEBUG_LOCATION,
+                 RpcOptions().set_metadata({{"key1", kTestValue}}));
+  EXPECT_EQ(backends_[0]->service_.request_count(), 9);
+  // Wait for RLS server to receive the refresh.
+  gpr_sleep_until(grpc_timeout_seconds_to_deadline(1));
+  EXPECT_EQ(rls_server_->service_.request_count(), 2);
+  EXPECT_EQ(rls_server_->service_.response_count(), 2);
+}
+
 TEST_F(RlsEnd2endTest, StaleCacheEntryWithHeaderData) {
   const char* kHeaderData = "header_data";
   StartBackends(1);
@@ -558,6 +558,28 @@ TEST(MeshLabelsIterableTest, TestResetIteratorPosition) {
   EXPECT_THAT(labels, expected_labels_matcher) << PrettyPrintLabels(labels);
 }
 
+TEST(ServiceMeshLabelsInjectorTest, PeerLabelsSharedAcrossCalls) {
+  grpc::internal::ServiceMeshLabelsInjector injector(
+      TestGkeResource().GetAttributes());
+  auto get_labels = [&]() {
+    grpc_metadata_batch metadata;
+    metadata.Set(grpc_core::XEnvoyPeerMetadata(),
+                 RemoteMetadataSliceFromResource(TestGceResource()));
+    auto iterable = injector.GetLabels(&metadata);
+    return LabelsFromIterable(
+        static_cast<grpc::internal::MeshLabelsIterable*>(iterable.get()));
+  };
+  auto first = get_labels();
+  auto second = get_labels();
+  ASSERT_EQ(first.size(), 7u) << PrettyPrintLabels(first);
+  ASSERT_EQ(first, second);
+  // The second call reuses the labels decoded for the first.
+  for (size_t i = 0; i < first.size(); ++i) {
+    EXPECT_EQ(first[i].second.data(), second[i].second.data())
+        << first[i].first;
+  }
+}
+
 INSTANTIATE_TEST_SUITE_P(
     MetadataExchange, MetadataExchangeTest,
     ::testing::Values(TestScenario(TestScenario::ResourceType::kGke),
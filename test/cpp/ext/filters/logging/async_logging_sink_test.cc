@@ -0,0 +1,222 @@
+//
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "src/core/ext/filters/logging/async_logging_sink.h"
+
+#include <grpc/grpc.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/synchronization/notification.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/util/sync.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+using Entry = LoggingSink::Entry;
+
+Entry MakeEntry(uint64_t sequence_id) {
+  Entry entry;
+  entry.call_id = absl::MakeUint128(0x0123456789abcdef, sequence_id);
+  entry.sequence_id = sequence_id;
+  entry.type = Entry::EventType::kClientMessage;
+  entry.logger = Entry::Logger::kClient;
+  entry.payload.metadata["key"] = "value";
+  entry.payload.timeout = Duration::Milliseconds(-1500);
+  entry.payload.status_code = 14;
+  entry.payload.status_message = "unavailable";
+  entry.payload.message_length = 5;
+  entry.payload.message = "hello";
+  entry.payload_truncated = true;
+  entry.peer.type = Entry::Address::Type::kIpv6;
+  entry.peer.address = "::1";
+  entry.peer.ip_port = 443;
+  entry.authority = "example.com";
+  entry.service_name = "foo.Bar";
+  entry.method_name = "Baz";
+  entry.timestamp = Timestamp::FromMillisecondsAfterProcessEpoch(12345);
+  entry.trace_id = "trace";
+  entry.is_sampled = true;
+  return entry;
+}
+
+class RecordingWriter : public AsyncLoggingSink::BatchWriter {
+ public:
+  explicit RecordingWriter(std::vector<std::string>* batches, Mutex* mu,
+                           absl::Notification* written = nullptr)
+      : batches_(batches), mu_(mu), written_(written) {}
+
+  void WriteBatch(absl::string_view batch) override {
+    MutexLock lock(mu_);
+    batches_->emplace_back(batch);
+    if (written_ != nullptr && !written_->HasBeenNotified()) {
+      written_->Notify();
+    }
+  }
+
+ private:
+  std::vector<std::string>* const batches_;
+  Mutex* const mu_;
+  absl::Notification* const written_;
+};
+
+class TestSink final : public AsyncLoggingSink {
+ public:
+  using AsyncLoggingSink::AsyncLoggingSink;
+
+  Config FindMatch(bool, absl::string_view, absl::string_view) override {
+    return Config(1024, 1024);
+  }
+};
+
+AsyncLoggingSink::Options OptionsWithoutTimer() {
+  AsyncLoggingSink::Options options;
+  options.flush_interval = Duration::Hours(1);
+  return options;
+}
+
+TEST(AsyncLoggingSinkTest, EncodeDecodeRoundTrip) {
+  const Entry entry = MakeEntry(7);
+  std::string batch;
+  EncodeLoggingEntry(entry, &batch);
+  EncodeLoggingEntry(MakeEntry(8), &batch);
+  auto decoded = DecodeLoggingEntries(batch);
+  ASSERT_TRUE(decoded.has_value());
+  ASSERT_EQ(decoded->size(), 2u);
+  const Entry& got = (*decoded)[0];
+  EXPECT_EQ(got.call_id, entry.call_id);
+  EXPECT_EQ(got.sequence_id, 7u);
+  EXPECT_EQ(got.type, entry.type);
+  EXPECT_EQ(got.logger, entry.logger);
+  EXPECT_EQ(got.payload.metadata, entry.payload.metadata);
+  EXPECT_EQ(got.payload.timeout, entry.payload.timeout);
+  EXPECT_EQ(got.payload.status_code, 14u);
+  EXPECT_EQ(got.payload.status_message, "unavailable");
+  EXPECT_EQ(got.payload.message, "hello");
+  EXPECT_TRUE(got.payload_truncated);
+  EXPECT_EQ(got.peer.type, Entry::Address::Type::kIpv6);
+  EXPECT_EQ(got.peer.address, "::1");
+  EXPECT_EQ(got.peer.ip_port, 443u);
+  EXPECT_EQ(got.authority, "example.com");
+  EXPECT_EQ(got.service_name, "foo.Bar");
+  EXPECT_EQ(got.method_name, "Baz");
+  EXPECT_LE(got.timestamp - entry.timestamp, Duration::Milliseconds(1));
+  EXPECT_LE(entry.timestamp - got.timestamp, Duration::Milliseconds(1));
+  EXPECT_EQ(got.trace_id, "trace");
+  EXPECT_TRUE(got.is_sampled);
+  EXPECT_FALSE(got.is_trailer_only);
+  EXPECT_EQ((*decoded)[1].sequence_id, 8u);
+}
+
+TEST(AsyncLoggingSinkTest, RejectsTruncatedBatch) {
+  std::string batch;
+  EncodeLoggingEntry(MakeEntry(1), &batch);
+  batch.pop_back();
+  EXPECT_FALSE(DecodeLoggingEntries(batch).has_value());
+}
+
+TEST(AsyncLoggingSinkTest, FlushSplitsBatches) {
+  std::string one;
+  EncodeLoggingEntry(MakeEntry(0), &one);
+  Mutex mu;
+  std::vector<std::string> batches;
+  AsyncLoggingSink::Options options = OptionsWithoutTimer();
+  options.max_batch_bytes = one.size() * 2;
+  TestSink sink(options, std::make_unique<RecordingWriter>(&batches, &mu),
+                grpc_event_engine::experimental::GetDefaultEventEngine());
+  for (uint64_t i = 0; i < 5; ++i) sink.LogEntry(MakeEntry(i));
+  sink.Flush();
+  MutexLock lock(&mu);
+  ASSERT_EQ(batches.size(), 3u);
+  std::vector<uint64_t> sequence_ids;
+  for (const std::string& batch : batches) {
+    EXPECT_LE(batch.size(), options.max_batch_bytes);
+    auto decoded = DecodeLoggingEntries(batch);
+    ASSERT_TRUE(decoded.has_value());
+    for (const Entry& entry : *decoded) {
+      sequence_ids.push_back(entry.sequence_id);
+    }
+  }
+  EXPECT_THAT(sequence_ids, ::testing::ElementsAre(0, 1, 2, 3, 4));
+}
+
+TEST(AsyncLoggingSinkTest, DropsOverBudget) {
+  std::string one;
+  EncodeLoggingEntry(MakeEntry(0), &one);
+  Mutex mu;
+  std::vector<std::string> batches;
+  AsyncLoggingSink::Options options = OptionsWithoutTimer();
+  options.max_queued_bytes = one.size() * 2;
+  TestSink sink(options, std::make_unique<RecordingWriter>(&batches, &mu),
+                grpc_event_engine::experimental::GetDefaultEventEngine());
+  for (uint64_t i = 0; i < 5; ++i) sink.LogEntry(MakeEntry(i));
+  EXPECT_EQ(sink.dropped_entries(), 3u);
+  sink.Flush();
+  // Flushing frees up the budget.
+  sink.LogEntry(MakeEntry(5));
+  EXPECT_EQ(sink.dropped_entries(), 3u);
+}
+
+TEST(AsyncLoggingSinkTest, FlushesAfterInterval) {
+  Mutex mu;
+  std::vector<std::string> batches;
+  absl::Notification written;
+  AsyncLoggingSink::Options options;
+  options.flush_interval = Duration::Milliseconds(10);
+  TestSink sink(options,
+                std::make_unique<RecordingWriter>(&batches, &mu, &written),
+                grpc_event_engine::experimental::GetDefaultEventEngine());
+  sink.LogEntry(MakeEntry(0));
+  written.WaitForNotification();
+  MutexLock lock(&mu);
+  ASSERT_EQ(batches.size(), 1u);
+  auto decoded = DecodeLoggingEntries(batches[0]);
+  ASSERT_TRUE(decoded.has_value());
+  ASSERT_EQ(decoded->size(), 1u);
+}
+
+TEST(AsyncLoggingSinkTest, DestructorFlushes) {
+  Mutex mu;
+  std::vector<std::string> batches;
+  {
+    TestSink sink(OptionsWithoutTimer(),
+                  std::make_unique<RecordingWriter>(&batches, &mu),
+                  grpc_event_engine::experimental::GetDefaultEventEngine());
+    sink.LogEntry(MakeEntry(0));
+  }
+  MutexLock lock(&mu);
+  EXPECT_EQ(batches.size(), 1u);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
@@ -1510,6 +1510,65 @@ TEST_F(OpenTelemetryPluginNPCMetricsTest, RecordDoubleHistogram) {
                                         ::testing::DoubleEq(kMax), kCount))))));
 }
 
+TEST_F(OpenTelemetryPluginNPCMetricsTest, RecordBoundDoubleHistogram) {
+  constexpr absl::string_view kMetricName = "bound_double_histogram";
+  constexpr double kHistogramValues[] = {1.1, 1.2, 2.2, 3.3,
+                                         4.4, 4.5, 5.5, 6.6};
+  constexpr double kSum = 28.8;
+  constexpr double kMin = 1.1;
+  constexpr double kMax = 6.6;
+  constexpr double kCount = 8;
+  constexpr std::array<absl::string_view, 2> kLabelKeys = {"label_key_1",
+                                                           "label_key_2"};
+  constexpr std::array<absl::string_view, 2> kOptionalLabelKeys = {
+      "optional_label_key_1", "optional_label_key_2"};
+  constexpr std::array<absl::string_view, 2> kLabelValues = {"label_value_1",
+                                                             "label_value_2"};
+  constexpr std::array<absl::string_view, 2> kOptionalLabelValues = {
+      "optional_label_value_1", "optional_label_value_2"};
+  auto handle =
+      grpc_core::GlobalInstrumentsRegistry::RegisterDoubleHistogram(
+          kMetricName, "A simple double histogram.", "unit",
+          /*enable_by_default=*/true)
+          .Labels(kLabelKeys[0], kLabelKeys[1])
+          .OptionalLabels(kOptionalLabelKeys[0], kOptionalLabelKeys[1])
+          .Build();
+  Init(std::move(
+      Options()
+          .set_metric_names({kMetricName})
+          .set_server_selector([](const grpc_core::ChannelArgs& args) {
+            return args.GetString(GRPC_ARG_SERVER_SELECTOR_KEY) ==
+                   GRPC_ARG_SERVER_SELECTOR_VALUE;
+          })
+          .add_optional_label(kOptionalLabelKeys[0])
+          .add_optional_label(kOptionalLabelKeys[1])));
+  grpc_core::ChannelArgs args;
+  args = args.Set(GRPC_ARG_SERVER_SELECTOR_KEY, GRPC_ARG_SERVER_SELECTOR_VALUE);
+  auto stats_plugins =
+      grpc_core::GlobalStatsPluginRegistry::GetStatsPluginsForServer(args);
+  {
+    // Labels are copied at bind time, and buffered values are recorded when
+    // the bound histogram is destroyed.
+    auto bound =
+        stats_plugins.BindHistogram(handle, kLabelValues, kOptionalLabelValues);
+    for (auto v : kHistogramValues) bound.Record(v);
+  }
+  auto data = ReadCurrentMetricsData(
+      [&](const absl::flat_hash_map<
+          std::string,
+          std::vector<opentelemetry::sdk::metrics::PointDataAttributes>>&
+              data) { return !data.contains(kMetricName); });
+  EXPECT_THAT(data,
+              ::testing::ElementsAre(::testing::Pair(
+                  kMetricName,
+                  ::testing::ElementsAre(::testing::AllOf(
+                      AttributesEq(kLabelKeys, kLabelValues, kOptionalLabelKeys,
+                                   kOptionalLabelValues),
+                      HistogramResultEq(::testing::DoubleEq(kSum),
+                                        ::testing::DoubleEq(kMin),
+                                        ::testing::DoubleEq(kMax), kCount))))));
+}
+
 TEST_F(OpenTelemetryPluginNPCMetricsTest,
        RegisterMultipleOpenTelemetryPlugins) {
   constexpr absl::string_view kMetricName = "yet_another_double_histogram";
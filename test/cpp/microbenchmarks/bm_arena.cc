@@ -92,6 +92,28 @@ static void BM_Arena_NewDeleteComparison_Small(benchmark::State& state) {
 }
 BENCHMARK(BM_Arena_NewDeleteComparison_Small);
 
+// Roughly the pooled allocations of a unary call: a metadata batch each way
+// and a message each way, all released at the end of the call.
+static void BM_Arena_MakePooled_CallChurn(benchmark::State& state) {
+  struct Metadata {
+    char a[600];
+  };
+  struct Message {
+    char a[248];
+  };
+  auto allocator = grpc_core::SimpleArenaAllocator();
+  for (auto _ : state) {
+    auto a = allocator->MakeArena();
+    auto client_md = a->MakePooledForOverwrite<Metadata>();
+    auto request = a->MakePooledForOverwrite<Message>();
+    auto response = a->MakePooledForOverwrite<Message>();
+    auto server_md = a->MakePooledForOverwrite<Metadata>();
+    benchmark::DoNotOptimize(client_md.get());
+    benchmark::DoNotOptimize(server_md.get());
+  }
+}
+BENCHMARK(BM_Arena_MakePooled_CallChurn)->ThreadRange(1, 16);
+
 // Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
 // and others do not. This allows us to support both modes.
 namespace benchmark {
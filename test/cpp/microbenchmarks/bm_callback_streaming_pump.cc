@@ -0,0 +1,137 @@
+//
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+// Benchmark client-to-server streaming throughput with the callback API
+
+#include <benchmark/benchmark.h>
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "absl/log/absl_check.h"
+#include "src/proto/grpc/testing/echo.grpc.pb.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/callback_test_service.h"
+#include "test/cpp/microbenchmarks/fullstack_fixtures.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc {
+namespace testing {
+
+//******************************************************************************
+// BENCHMARKING KERNELS
+//
+
+// Writes one message per benchmark iteration, starting each write from the
+// previous one's OnWriteDone().
+class PumpClient : public grpc::ClientWriteReactor<EchoRequest> {
+ public:
+  PumpClient(benchmark::State* state, EchoTestService::Stub* stub,
+             const EchoRequest* request)
+      : state_(state), request_(request) {
+    stub->async()->RequestStream(&cli_ctx_, &response_, this);
+    if (state_->KeepRunning()) {
+      StartWrite(request_);
+    } else {
+      StartWritesDone();
+    }
+    StartCall();
+  }
+
+  void OnWriteDone(bool ok) override {
+    ABSL_CHECK(ok);
+    if (state_->KeepRunning()) {
+      StartWrite(request_);
+    } else {
+      StartWritesDone();
+    }
+  }
+
+  void OnDone(const Status& s) override {
+    ABSL_CHECK(s.ok());
+    std::unique_lock<std::mutex> l(mu_);
+    done_ = true;
+    cv_.notify_one();
+  }
+
+  void Await() {
+    std::unique_lock<std::mutex> l(mu_);
+    while (!done_) {
+      cv_.wait(l);
+    }
+  }
+
+ private:
+  benchmark::State* const state_;
+  const EchoRequest* const request_;
+  ClientContext cli_ctx_;
+  EchoResponse response_;
+  std::mutex mu_;
+  std::condition_variable cv_;
+  bool done_ = false;
+};
+
+template <class Fixture>
+static void BM_CallbackPumpStreamClientToServer(benchmark::State& state) {
+  CallbackStreamingTestService service;
+  std::unique_ptr<Fixture> fixture(new Fixture(&service));
+  std::unique_ptr<EchoTestService::Stub> stub(
+      EchoTestService::NewStub(fixture->channel()));
+  EchoRequest request;
+  if (state.range(0) > 0) {
+    request.set_message(std::string(state.range(0), 'a'));
+  }
+  {
+    PumpClient client(&state, stub.get(), &request);
+    client.Await();
+  }
+  fixture.reset();
+  state.SetBytesProcessed(state.range(0) * state.iterations());
+}
+
+//******************************************************************************
+// CONFIGURATIONS
+//
+
+// Same message sizes as bm_fullstack_streaming_pump, for comparison with the
+// CQ-based API.
+BENCHMARK_TEMPLATE(BM_CallbackPumpStreamClientToServer, TCP)
+    ->Range(0, 128 * 1024 * 1024);
+BENCHMARK_TEMPLATE(BM_CallbackPumpStreamClientToServer, InProcess)
+    ->Range(0, 128 * 1024 * 1024);
+BENCHMARK_TEMPLATE(BM_CallbackPumpStreamClientToServer, MinInProcess)->Arg(0);
+
+}  // namespace testing
+}  // namespace grpc
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -0,0 +1,99 @@
+//
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+// Benchmarks the base64 (and base64 + huffman) coding of -bin metadata
+// values done by chttp2.
+
+#include <benchmark/benchmark.h>
+#include <stdint.h>
+
+#include <random>
+#include <vector>
+
+#include "absl/log/absl_check.h"
+#include "src/core/ext/transport/chttp2/transport/bin_decoder.h"
+#include "src/core/ext/transport/chttp2/transport/bin_encoder.h"
+#include "src/core/lib/slice/slice.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+Slice MakeBinaryValue(size_t length) {
+  std::mt19937 rd(0);
+  std::uniform_int_distribution<> distribution(0, 255);
+  std::vector<uint8_t> v(length);
+  for (auto& c : v) c = distribution(rd);
+  return Slice::FromCopiedBuffer(v);
+}
+
+void BM_Base64Encode(benchmark::State& state) {
+  Slice input = MakeBinaryValue(state.range(0));
+  for (auto _ : state) {
+    Slice output(grpc_chttp2_base64_encode(input.c_slice()));
+    benchmark::DoNotOptimize(output.data());
+  }
+  state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(BM_Base64Encode)->Range(16, 16384);
+
+void BM_Base64EncodeAndHuffmanCompress(benchmark::State& state) {
+  Slice input = MakeBinaryValue(state.range(0));
+  for (auto _ : state) {
+    uint32_t wire_size;
+    Slice output(grpc_chttp2_base64_encode_and_huffman_compress(
+        input.c_slice(), &wire_size));
+    benchmark::DoNotOptimize(output.data());
+  }
+  state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(BM_Base64EncodeAndHuffmanCompress)->Range(16, 16384);
+
+void BM_Base64Decode(benchmark::State& state) {
+  Slice input = MakeBinaryValue(state.range(0));
+  Slice encoded(grpc_chttp2_base64_encode(input.c_slice()));
+  const size_t output_length =
+      grpc_chttp2_base64_infer_length_after_decode(encoded.c_slice());
+  for (auto _ : state) {
+    Slice output(
+        grpc_chttp2_base64_decode_with_length(encoded.c_slice(), output_length));
+    ABSL_CHECK_EQ(output.size(), input.size());
+  }
+  state.SetBytesProcessed(state.iterations() * encoded.size());
+}
+BENCHMARK(BM_Base64Decode)->Range(16, 16384);
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
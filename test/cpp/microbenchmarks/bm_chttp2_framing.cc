@@ -0,0 +1,150 @@
+//
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+// Compares the frame encoding used by writing.cc with the one used by the
+// promise based HTTP/2 transports.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "absl/log/absl_check.h"
+#include "src/core/ext/transport/chttp2/transport/frame.h"
+#include "src/core/ext/transport/chttp2/transport/frame_data.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_buffer.h"
+#include "src/core/telemetry/call_tracer.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc_core {
+
+class FakeCallTracer final : public CallTracerInterface {
+ public:
+  void RecordIncomingBytes(
+      const TransportByteSize& transport_byte_size) override {}
+  void RecordOutgoingBytes(
+      const TransportByteSize& transport_byte_size) override {}
+  void RecordSendInitialMetadata(
+      grpc_metadata_batch* send_initial_metadata) override {}
+  void RecordSendTrailingMetadata(
+      grpc_metadata_batch* send_trailing_metadata) override {}
+  void RecordSendMessage(const Message& send_message) override {}
+  void RecordSendCompressedMessage(
+      const Message& send_compressed_message) override {}
+  void RecordReceivedInitialMetadata(
+      grpc_metadata_batch* recv_initial_metadata) override {}
+  void RecordReceivedMessage(const Message& recv_message) override {}
+  void RecordReceivedDecompressedMessage(
+      const Message& recv_decompressed_message) override {}
+  void RecordCancel(grpc_error_handle cancel_error) override {}
+  std::shared_ptr<TcpTracerInterface> StartNewTcpTrace() override {
+    return nullptr;
+  }
+  void RecordAnnotation(absl::string_view annotation) override {}
+  void RecordAnnotation(const Annotation& annotation) override {}
+  std::string TraceId() override { return ""; }
+  std::string SpanId() override { return ""; }
+  bool IsSampled() override { return false; }
+};
+
+
+namespace {
+
+constexpr uint32_t kMaxFrameSize = 16384;
+
+// A message as it arrives from the application: 8KiB slices.
+SliceBuffer MakeMessage(size_t size) {
+  SliceBuffer message;
+  while (message.Length() < size) {
+    message.Append(Slice::FromCopiedString(
+        std::string(std::min<size_t>(size - message.Length(), 8192), 'a')));
+  }
+  return message;
+}
+
+void BM_LegacyEncodeData(benchmark::State& state) {
+  FakeCallTracer call_tracer;
+  const SliceBuffer message = MakeMessage(state.range(0));
+  for (auto _ : state) {
+    SliceBuffer payload = message.Copy();
+    SliceBuffer out;
+    while (payload.Length() != 0) {
+      const uint32_t write_bytes =
+          std::min<size_t>(payload.Length(), kMaxFrameSize);
+      grpc_chttp2_encode_data(1, payload.c_slice_buffer(), write_bytes,
+                              payload.Length() == write_bytes, &call_tracer,
+                              out.c_slice_buffer());
+    }
+    benchmark::DoNotOptimize(out.Length());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_LegacyEncodeData)->Range(64, 4 * 1024 * 1024);
+
+void BM_EncodeDataFrames(benchmark::State& state) {
+  const SliceBuffer message = MakeMessage(state.range(0));
+  std::vector<Http2Frame> frames;
+  for (auto _ : state) {
+    SliceBuffer payload = message.Copy();
+    SliceBuffer out;
+    frames.clear();
+    AppendDataFrames(1, payload, kMaxFrameSize, true, frames);
+    Serialize(absl::MakeSpan(frames), out);
+    benchmark::DoNotOptimize(out.Length());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EncodeDataFrames)->Range(64, 4 * 1024 * 1024);
+
+void BM_ParseFrames(benchmark::State& state) {
+  SliceBuffer message = MakeMessage(state.range(0));
+  std::vector<Http2Frame> frames;
+  AppendDataFrames(1, message, kMaxFrameSize, true, frames);
+  SliceBuffer wire;
+  Serialize(absl::MakeSpan(frames), wire);
+  for (auto _ : state) {
+    SliceBuffer read = wire.Copy();
+    auto parsed = ParseFrames(read, kMaxFrameSize);
+    ABSL_CHECK(parsed.ok());
+    benchmark::DoNotOptimize(parsed->size());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ParseFrames)->Range(64, 4 * 1024 * 1024);
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -22,6 +22,7 @@
 #include <string.h>
 
 #include <atomic>
+#include <iterator>
 
 #include "absl/log/absl_check.h"
 #include "absl/log/absl_log.h"
@@ -42,6 +43,8 @@ static gpr_mu g_mu;
 static gpr_cv g_cv;
 static int g_threads_active;
 static bool g_active;
+// The number of completions that each pollset_work() call queues
+static int g_completions_per_work = 1;
 
 namespace grpc {
 namespace testing {
@@ -81,10 +84,12 @@ static grpc_error_handle pollset_work(grpc_pollset* ps,
   gpr_mu_unlock(&ps->mu);
 
   void* tag = reinterpret_cast<void*>(10);  // Some random number
-  ABSL_CHECK(grpc_cq_begin_op(g_cq, tag));
-  grpc_cq_end_op(
-      g_cq, tag, absl::OkStatus(), cq_done_cb, nullptr,
-      static_cast<grpc_cq_completion*>(gpr_malloc(sizeof(grpc_cq_completion))));
+  for (int i = 0; i < g_completions_per_work; i++) {
+    ABSL_CHECK(grpc_cq_begin_op(g_cq, tag));
+    grpc_cq_end_op(g_cq, tag, absl::OkStatus(), cq_done_cb, nullptr,
+                   static_cast<grpc_cq_completion*>(
+                       gpr_malloc(sizeof(grpc_cq_completion))));
+  }
   grpc_core::ExecCtx::Get()->Flush();
   gpr_mu_lock(&ps->mu);
   return absl::OkStatus();
@@ -156,7 +161,10 @@ static void teardown() {
 // by grpc, and its Finish call must take place before grpc_shutdown so that it
 // can use grpc_stats).
 //
-static void BM_Cq_Throughput(benchmark::State& state) {
+// Runs poll on every thread of the benchmark, with g_cq set up while they
+// run. poll returns the number of events that it read.
+template <typename Poll>
+static void RunCqThroughput(benchmark::State& state, Poll poll) {
   gpr_timespec deadline = gpr_inf_future(GPR_CLOCK_MONOTONIC);
   auto thd_idx = state.thread_index();
 
@@ -173,12 +181,12 @@ static void BM_Cq_Throughput(benchmark::State& state) {
   }
   gpr_mu_unlock(&g_mu);
 
+  int64_t events = 0;
   for (auto _ : state) {
-    ABSL_CHECK(grpc_completion_queue_next(g_cq, deadline, nullptr).type ==
-          GRPC_OP_COMPLETE);
+    events += poll(deadline);
   }
 
-  state.SetItemsProcessed(state.iterations());
+  state.SetItemsProcessed(events);
 
   gpr_mu_lock(&g_mu);
   g_threads_active--;
@@ -197,8 +205,49 @@ static void BM_Cq_Throughput(benchmark::State& state) {
   }
 }
 
+static void BM_Cq_Throughput(benchmark::State& state) {
+  g_completions_per_work = 1;
+  RunCqThroughput(state, [](gpr_timespec deadline) {
+    ABSL_CHECK(grpc_completion_queue_next(g_cq, deadline, nullptr).type ==
+               GRPC_OP_COMPLETE);
+    return 1;
+  });
+}
+
 BENCHMARK(BM_Cq_Throughput)->ThreadRange(1, 16)->UseRealTime();
 
+// Reads the completions that each poll queues, state.range(0) of them, one
+// call at a time or all in one call.
+template <bool kBatch>
+static void BM_Cq_BurstThroughput(benchmark::State& state) {
+  const int burst = state.range(0);
+  g_completions_per_work = burst;
+  RunCqThroughput(state, [burst](gpr_timespec deadline) {
+    if (!kBatch) {
+      ABSL_CHECK(grpc_completion_queue_next(g_cq, deadline, nullptr).type ==
+                 GRPC_OP_COMPLETE);
+      return static_cast<size_t>(1);
+    }
+    grpc_event events[64];
+    ABSL_CHECK_LE(static_cast<size_t>(burst), std::size(events));
+    size_t n = grpc_completion_queue_next_batch(g_cq, events, burst,
+                                                deadline, nullptr);
+    ABSL_CHECK(events[0].type == GRPC_OP_COMPLETE);
+    return n;
+  });
+}
+
+BENCHMARK_TEMPLATE(BM_Cq_BurstThroughput, false)
+    ->ThreadRange(1, 16)
+    ->Arg(16)
+    ->Arg(64)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Cq_BurstThroughput, true)
+    ->ThreadRange(1, 16)
+    ->Arg(16)
+    ->Arg(64)
+    ->UseRealTime();
+
 namespace {
 const grpc_event_engine_vtable g_none_vtable =
     grpc::testing::make_engine_vtable("none");
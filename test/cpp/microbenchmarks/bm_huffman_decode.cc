@@ -20,6 +20,7 @@
 #include "absl/strings/escaping.h"
 #include "src/core/ext/transport/chttp2/transport/bin_encoder.h"
 #include "src/core/ext/transport/chttp2/transport/decode_huff.h"
+#include "src/core/ext/transport/chttp2/transport/decode_huff_multi.h"
 #include "src/core/lib/slice/slice.h"
 #include "src/core/util/no_destruct.h"
 #include "test/core/test_util/test_config.h"
@@ -84,6 +85,7 @@ static void BM_Decode(benchmark::State& state, CharSet chars_gen) {
   BENCHMARK_CAPTURE(name, alpha_chars, AlphaChars)
 
 DECL_HUFFMAN_VARIANTS();
+DECL_BENCHMARK(grpc_core::MultiSymbolHuffDecoder, MultiSymbol);
 
 // Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
 // and others do not. This allows us to support both modes.
@@ -0,0 +1,99 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmarks the legality checks applied to metadata values and the
+// percent-encoding of grpc-message.
+
+#include <benchmark/benchmark.h>
+#include <grpc/grpc.h>
+
+#include <string>
+
+#include "src/core/lib/slice/percent_encoding.h"
+#include "src/core/lib/slice/slice.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+// Printable text, the common case for all of these.
+Slice MakeText(size_t length) {
+  std::string s;
+  s.reserve(length);
+  for (size_t i = 0; i < length; ++i) {
+    s.push_back("the quick brown fox jumps over the lazy dog "[i % 44]);
+  }
+  return Slice::FromCopiedString(s);
+}
+
+void BM_HeaderNonBinValueIsLegal(benchmark::State& state) {
+  Slice input = MakeText(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        grpc_header_nonbin_value_is_legal(input.c_slice()));
+  }
+  state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(BM_HeaderNonBinValueIsLegal)->Range(8, 4096);
+
+void BM_HeaderKeyIsLegal(benchmark::State& state) {
+  Slice input = Slice::FromCopiedString(
+      std::string(state.range(0), 'x').replace(0, 2, "x-"));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(grpc_header_key_is_legal(input.c_slice()));
+  }
+  state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(BM_HeaderKeyIsLegal)->Range(8, 256);
+
+void BM_PercentEncodeCompatible(benchmark::State& state) {
+  Slice input = MakeText(state.range(0));
+  for (auto _ : state) {
+    Slice output =
+        PercentEncodeSlice(input.Ref(), PercentEncodingType::Compatible);
+    benchmark::DoNotOptimize(output.data());
+  }
+  state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(BM_PercentEncodeCompatible)->Range(8, 4096);
+
+void BM_PermissivePercentDecode(benchmark::State& state) {
+  Slice input = MakeText(state.range(0));
+  for (auto _ : state) {
+    Slice output = PermissivePercentDecodeSlice(input.Ref());
+    benchmark::DoNotOptimize(output.data());
+  }
+  state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(BM_PermissivePercentDecode)->Range(8, 4096);
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
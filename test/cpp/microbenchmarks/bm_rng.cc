@@ -21,6 +21,7 @@
 #include <benchmark/benchmark.h>
 
 #include "absl/random/random.h"
+#include "src/core/util/fast_random.h"
 #include "src/core/util/sync.h"
 
 static void BM_OneRngFromFreshBitSet(benchmark::State& state) {
@@ -51,6 +52,21 @@ static void BM_OneRngFromReusedBitSetWithMutex(benchmark::State& state) {
 }
 BENCHMARK(BM_OneRngFromReusedBitSetWithMutex);
 
+static void BM_OneRngFromFastRandom(benchmark::State& state) {
+  grpc_core::FastRandom rng;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(absl::Uniform(rng, 0.0, 1.0));
+  }
+}
+BENCHMARK(BM_OneRngFromFastRandom);
+
+static void BM_OneRawUint64FromFastRandom(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(grpc_core::FastRandom::Next());
+  }
+}
+BENCHMARK(BM_OneRawUint64FromFastRandom);
+
 // Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
 // and others do not. This allows us to support both modes.
 namespace benchmark {
@@ -105,6 +105,40 @@ BENCHMARK(BM_ThreadPool_RunClosure)
     ->MeasureProcessCPUTime()
     ->UseRealTime();
 
+// A single pool closure floods its worker's local queue while the other
+// workers steal from it. This stresses the owner/thief paths of the worker
+// queues; compare the default queue against the lock-free one by running with
+// GRPC_EXPERIMENTS=event_engine_lock_free_work_queue.
+void BM_ThreadPool_WorkerLocalBurst(benchmark::State& state) {
+  auto pool = grpc_event_engine::experimental::MakeThreadPool(
+      grpc_core::Clamp(gpr_cpu_num_cores(), 2u, 16u));
+  const int cb_count = state.range(0);
+  std::atomic_int runcount{0};
+  for (auto _ : state) {
+    state.PauseTiming();
+    runcount.store(0);
+    grpc_core::Notification signal;
+    auto cb = [&signal, &runcount, cb_count]() {
+      if (runcount.fetch_add(1, std::memory_order_relaxed) + 1 == cb_count) {
+        signal.Notify();
+      }
+    };
+    state.ResumeTiming();
+    pool->Run([&pool, &cb, cb_count]() {
+      for (int i = 0; i < cb_count; i++) {
+        pool->Run(cb);
+      }
+    });
+    signal.WaitForNotification();
+  }
+  state.SetItemsProcessed(cb_count * state.iterations());
+  pool->Quiesce();
+}
+BENCHMARK(BM_ThreadPool_WorkerLocalBurst)
+    ->Range(100, 4096)
+    ->MeasureProcessCPUTime()
+    ->UseRealTime();
+
 void FanoutTestArguments(benchmark::internal::Benchmark* b) {
   // TODO(hork): enable when the engines are fast enough to run these:
   // ->Args({10000, 1})  // chain of callbacks scheduling callbacks
@@ -0,0 +1,141 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compares the EventEngine timer stores under the add/cancel churn of a
+// process with many outstanding deadlines.
+
+#include <benchmark/benchmark.h>
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#include <atomic>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "src/core/lib/event_engine/posix_engine/timer.h"
+#include "src/core/lib/event_engine/posix_engine/timer_wheel.h"
+#include "src/core/util/time.h"
+#include "test/core/test_util/test_config.h"
+
+namespace {
+
+using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::Timer;
+using ::grpc_event_engine::experimental::TimerList;
+using ::grpc_event_engine::experimental::TimerListHost;
+using ::grpc_event_engine::experimental::TimerWheel;
+
+class FakeHost final : public TimerListHost {
+ public:
+  grpc_core::Timestamp Now() override {
+    return grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
+        now_.load(std::memory_order_relaxed));
+  }
+  void Kick() override {}
+  void Advance(int64_t millis) {
+    now_.fetch_add(millis, std::memory_order_relaxed);
+  }
+
+ private:
+  std::atomic<int64_t> now_{1};
+};
+
+class NoopClosure final : public EventEngine::Closure {
+ public:
+  void Run() override {}
+};
+
+// RPC-style deadlines: anywhere from 100ms to a minute out.
+grpc_core::Timestamp RandomDeadline(FakeHost& host, std::mt19937& rng) {
+  std::uniform_int_distribution<int64_t> millis(100, 60000);
+  return host.Now() + grpc_core::Duration::Milliseconds(millis(rng));
+}
+
+// `state.range(0)` timers stay outstanding while one more is repeatedly added
+// and cancelled, as when an RPC finishes well before its deadline.
+template <typename TimerStore>
+void BM_TimerAddCancel(benchmark::State& state) {
+  FakeHost host;
+  TimerStore store(&host);
+  NoopClosure closure;
+  std::mt19937 rng(42);
+  std::vector<Timer> outstanding(state.range(0));
+  for (Timer& timer : outstanding) {
+    store.TimerInit(&timer, RandomDeadline(host, rng), &closure);
+  }
+  Timer timer;
+  for (auto _ : state) {
+    store.TimerInit(&timer, RandomDeadline(host, rng), &closure);
+    benchmark::DoNotOptimize(store.TimerCancel(&timer));
+  }
+  for (Timer& timer : outstanding) {
+    benchmark::DoNotOptimize(store.TimerCancel(&timer));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_TimerAddCancel, TimerList)->Range(1024, 512 * 1024);
+BENCHMARK_TEMPLATE(BM_TimerAddCancel, TimerWheel)->Range(1024, 512 * 1024);
+
+// `state.range(0)` timers outstanding while time moves forward a millisecond
+// per iteration: every iteration checks for expired timers and replaces each
+// one that fired with a new deadline.
+template <typename TimerStore>
+void BM_TimerExpiry(benchmark::State& state) {
+  FakeHost host;
+  TimerStore store(&host);
+  std::mt19937 rng(42);
+  struct RearmingClosure final : public EventEngine::Closure {
+    void Run() override { ++fired; }
+    int fired = 0;
+  };
+  std::vector<Timer> timers(state.range(0));
+  std::vector<RearmingClosure> closures(state.range(0));
+  for (size_t i = 0; i < timers.size(); i++) {
+    store.TimerInit(&timers[i], RandomDeadline(host, rng), &closures[i]);
+  }
+  int64_t expired = 0;
+  for (auto _ : state) {
+    host.Advance(1);
+    auto fired = store.TimerCheck(nullptr);
+    for (EventEngine::Closure* closure : *fired) {
+      auto* rearming = static_cast<RearmingClosure*>(closure);
+      rearming->Run();
+      store.TimerInit(&timers[rearming - closures.data()],
+                      RandomDeadline(host, rng), rearming);
+    }
+    expired += fired->size();
+  }
+  for (Timer& timer : timers) {
+    benchmark::DoNotOptimize(store.TimerCancel(&timer));
+  }
+  state.SetItemsProcessed(expired);
+}
+BENCHMARK_TEMPLATE(BM_TimerExpiry, TimerList)->Range(1024, 512 * 1024);
+BENCHMARK_TEMPLATE(BM_TimerExpiry, TimerWheel)->Range(1024, 512 * 1024);
+
+}  // namespace
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::benchmark::Initialize(&argc, argv);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
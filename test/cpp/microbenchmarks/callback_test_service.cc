@@ -64,6 +64,29 @@ ServerUnaryReactor* CallbackStreamingTestService::Echo(
   return reactor;
 }
 
+ServerReadReactor<EchoRequest>* CallbackStreamingTestService::RequestStream(
+    CallbackServerContext* /*context*/, EchoResponse* /*response*/) {
+  // Drains the stream, so that benchmarks can pump client-to-server.
+  class Reactor : public ServerReadReactor<EchoRequest> {
+   public:
+    Reactor() { StartRead(&request_); }
+    void OnDone() override { delete this; }
+    void OnCancel() override {}
+    void OnReadDone(bool ok) override {
+      if (!ok) {
+        Finish(grpc::Status::OK);
+        return;
+      }
+      StartRead(&request_);
+    }
+
+   private:
+    EchoRequest request_;
+  };
+
+  return new Reactor();
+}
+
 ServerBidiReactor<EchoRequest, EchoResponse>*
 CallbackStreamingTestService::BidiStream(CallbackServerContext* context) {
   class Reactor : public ServerBidiReactor<EchoRequest, EchoResponse> {
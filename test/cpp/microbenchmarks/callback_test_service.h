@@ -42,6 +42,9 @@ class CallbackStreamingTestService : public EchoTestService::CallbackService {
                            const EchoRequest* request,
                            EchoResponse* response) override;
 
+  ServerReadReactor<EchoRequest>* RequestStream(
+      CallbackServerContext* context, EchoResponse* response) override;
+
   ServerBidiReactor<EchoRequest, EchoResponse>* BidiStream(
       CallbackServerContext* context) override;
 };
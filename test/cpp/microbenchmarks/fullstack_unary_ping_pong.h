@@ -26,6 +26,8 @@
 #include <sstream>
 
 #include "absl/log/absl_check.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 #include "src/proto/grpc/testing/echo.grpc.pb.h"
 #include "test/cpp/microbenchmarks/fullstack_context_mutators.h"
 #include "test/cpp/microbenchmarks/fullstack_fixtures.h"
@@ -73,6 +75,7 @@ static void BM_UnaryPingPong(benchmark::State& state) {
                       fixture->cq(), tag(1));
   std::unique_ptr<EchoTestService::Stub> stub(
       EchoTestService::NewStub(fixture->channel()));
+  auto stats_before = grpc_core::global_stats().Collect();
   for (auto _ : state) {
     recv_response.Clear();
     ClientContext cli_ctx;
@@ -103,6 +106,16 @@ static void BM_UnaryPingPong(benchmark::State& state) {
     service.RequestEcho(&senv->ctx, &senv->recv_request, &senv->response_writer,
                         fixture->cq(), fixture->cq(), tag(slot));
   }
+  // Report the call arena allocations of each RPC, covering both the client
+  // and the server call.
+  auto stats = grpc_core::global_stats().Collect()->Diff(*stats_before);
+  state.counters["arena_overflows_per_rpc"] = benchmark::Counter(
+      stats->call_arena_overflows, benchmark::Counter::kAvgIterations);
+  state.counters["call_arena_bytes_p50"] =
+      stats
+          ->histogram(
+              grpc_core::GlobalStats::Histogram::kCallArenaAllocatedSize)
+          .Percentile(50);
   stub.reset();
   fixture.reset();
   server_env[0]->~ServerEnv();
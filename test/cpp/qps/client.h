@@ -195,16 +195,20 @@ class Client {
       timer_result = timer_->Mark();
     }
 
-    // Print the median latency per interval for one thread.
-    // If the number of warmup seconds is x, then the first x + 1 numbers in the
-    // vector are from the warmup period and should be discarded.
+    // Print the median and 99th percentile latency per interval for one
+    // thread. If the number of warmup seconds is x, then the first x + 1
+    // numbers in the vector are from the warmup period and should be
+    // discarded.
     if (median_latency_collection_interval_seconds_ > 0) {
       std::vector<double> medians_per_interval =
           threads_[0]->GetMedianPerIntervalList();
+      std::vector<double> p99s_per_interval =
+          threads_[0]->GetP99PerIntervalList();
       ABSL_LOG(INFO) << "Num threads: " << threads_.size();
       ABSL_LOG(INFO) << "Number of medians: " << medians_per_interval.size();
       for (size_t j = 0; j < medians_per_interval.size(); j++) {
-        ABSL_LOG(INFO) << medians_per_interval[j];
+        ABSL_LOG(INFO) << medians_per_interval[j] << " (p99 "
+                       << p99s_per_interval[j] << ")";
       }
     }
 
@@ -220,6 +224,8 @@ class Client {
     stats.set_time_system(timer_result.system);
     stats.set_time_user(timer_result.user);
     stats.set_cq_poll_count(poll_count);
+    stats.set_channels_connected(channels_connected_);
+    stats.set_channel_connect_time(channel_connect_time_);
     return stats;
   }
 
@@ -283,6 +289,10 @@ class Client {
       return medians_each_interval_list_;
     }
 
+    std::vector<double> GetP99PerIntervalList() {
+      return p99s_each_interval_list_;
+    }
+
     void UpdateHistogram(HistogramEntry* entry) {
       std::lock_guard<std::mutex> g(mu_);
       if (entry->value_used()) {
@@ -296,6 +306,8 @@ class Client {
             // Divide by 1e3 to get microseconds.
             medians_each_interval_list_.push_back(
                 histogram_per_interval_.Percentile(50) / 1e3);
+            p99s_each_interval_list_.push_back(
+                histogram_per_interval_.Percentile(99) / 1e3);
             histogram_per_interval_.Reset();
             interval_start_time_ = now;
           }
@@ -335,6 +347,7 @@ class Client {
     // median_latency_collection_interval_seconds_ is greater than 0
     Histogram histogram_per_interval_;
     std::vector<double> medians_each_interval_list_;
+    std::vector<double> p99s_each_interval_list_;
     double interval_start_time_;
   };
 
@@ -342,6 +355,9 @@ class Client {
   bool closed_loop_;
   gpr_atm thread_pool_done_;
   double median_latency_collection_interval_seconds_;  // In seconds
+  // Channels connected at setup and the time it took, set by subclasses.
+  size_t channels_connected_ = 0;
+  double channel_connect_time_ = 0;
 
   void StartThreads(size_t num_threads) {
     gpr_atm_rel_store(&thread_pool_done_, static_cast<gpr_atm>(false));
@@ -436,12 +452,23 @@ class ClientImpl : public Client {
              std::function<std::unique_ptr<StubType>(std::shared_ptr<Channel>)>
                  create_stub)
       : cores_(gpr_cpu_num_cores()), create_stub_(create_stub) {
+    const double connect_start = UsageTimer::Now();
     for (int i = 0; i < config.client_channels(); i++) {
       channels_.emplace_back(
           config.server_targets(i % config.server_targets_size()), config,
           create_stub_, i);
     }
+    // Idle channels continue the shard numbering so that each of them gets
+    // its own connection, but never have RPCs started on them.
+    for (int i = 0; i < config.idle_client_channels(); i++) {
+      const int shard = config.client_channels() + i;
+      idle_channels_.emplace_back(
+          config.server_targets(shard % config.server_targets_size()), config,
+          create_stub_, shard);
+    }
     WaitForChannelsToConnect();
+    channels_connected_ = channels_.size() + idle_channels_.size();
+    channel_connect_time_ = UsageTimer::Now() - connect_start;
     median_latency_collection_interval_seconds_ =
         config.median_latency_collection_interval_millis() / 1e3;
     ClientRequestCreator<RequestType> create_req(&request_,
@@ -468,7 +495,7 @@ class ClientImpl : public Client {
         gpr_time_from_seconds(connect_deadline_seconds, GPR_TIMESPAN));
     CompletionQueue cq;
     size_t num_remaining = 0;
-    for (auto& c : channels_) {
+    auto start_watching = [&](ClientChannelInfo& c) {
       if (!c.is_inproc()) {
         Channel* channel = c.get_channel();
         grpc_connectivity_state last_observed = channel->GetState(true);
@@ -480,7 +507,9 @@ class ClientImpl : public Client {
                                        channel);
         }
       }
-    }
+    };
+    for (auto& c : channels_) start_watching(c);
+    for (auto& c : idle_channels_) start_watching(c);
     while (num_remaining > 0) {
       bool ok = false;
       void* tag = nullptr;
@@ -564,6 +593,8 @@ class ClientImpl : public Client {
     bool is_inproc_;
   };
   std::vector<ClientChannelInfo> channels_;
+  // Connected for the lifetime of the client without running RPCs.
+  std::vector<ClientChannelInfo> idle_channels_;
   std::function<std::unique_ptr<StubType>(const std::shared_ptr<Channel>&)>
       create_stub_;
 };
@@ -176,17 +176,19 @@ class CallbackUnaryClient final : public CallbackClient {
       if (ctx_[vector_idx]->alarm_ == nullptr) {
         ctx_[vector_idx]->alarm_ = std::make_unique<Alarm>();
       }
-      ctx_[vector_idx]->alarm_->Set(next_issue_time,
-                                    [this, t, vector_idx](bool /*ok*/) {
-                                      IssueUnaryCallbackRpc(t, vector_idx);
-                                    });
+      // Latency counts from the intended issue time, so that falling behind
+      // the offered load is not hidden (coordinated omission).
+      const double start = UsageTimer::ToTimescale(next_issue_time);
+      ctx_[vector_idx]->alarm_->Set(
+          next_issue_time, [this, t, vector_idx, start](bool /*ok*/) {
+            IssueUnaryCallbackRpc(t, vector_idx, start);
+          });
     } else {
-      IssueUnaryCallbackRpc(t, vector_idx);
+      IssueUnaryCallbackRpc(t, vector_idx, UsageTimer::Now());
     }
   }
 
-  void IssueUnaryCallbackRpc(Thread* t, size_t vector_idx) {
-    double start = UsageTimer::Now();
+  void IssueUnaryCallbackRpc(Thread* t, size_t vector_idx, double start) {
     ctx_[vector_idx]->stub_->async()->UnaryCall(
         (&ctx_[vector_idx]->context_), &request_, &ctx_[vector_idx]->response_,
         [this, t, start, vector_idx](grpc::Status s) {
@@ -257,9 +259,10 @@ class CallbackStreamingPingPongReactor final
       std::unique_ptr<CallbackClientRpcContext> ctx)
       : client_(client), ctx_(std::move(ctx)), messages_issued_(0) {}
 
-  void StartNewRpc() {
+  // \a start_time is when the first ping-pong should have started.
+  void StartNewRpc(double start_time) {
     ctx_->stub_->async()->StreamingCall(&(ctx_->context_), this);
-    write_time_ = UsageTimer::Now();
+    write_time_ = start_time;
     StartWrite(client_->request());
     writes_done_started_.clear();
     StartCall();
@@ -294,8 +297,10 @@ class CallbackStreamingPingPongReactor final
       gpr_timespec next_issue_time = client_->NextRPCIssueTime();
       // Start an alarm callback to run the internal callback after
       // next_issue_time
-      ctx_->alarm_->Set(next_issue_time, [this](bool /*ok*/) {
-        write_time_ = UsageTimer::Now();
+      // Latency counts from the intended issue time, as for unary RPCs.
+      const double start = UsageTimer::ToTimescale(next_issue_time);
+      ctx_->alarm_->Set(next_issue_time, [this, start](bool /*ok*/) {
+        write_time_ = start;
         StartWrite(client_->request());
       });
     } else {
@@ -321,10 +326,11 @@ class CallbackStreamingPingPongReactor final
       if (ctx_->alarm_ == nullptr) {
         ctx_->alarm_ = std::make_unique<Alarm>();
       }
+      const double start = UsageTimer::ToTimescale(next_issue_time);
       ctx_->alarm_->Set(next_issue_time,
-                        [this](bool /*ok*/) { StartNewRpc(); });
+                        [this, start](bool /*ok*/) { StartNewRpc(start); });
     } else {
-      StartNewRpc();
+      StartNewRpc(UsageTimer::Now());
     }
   }
 
@@ -81,10 +81,14 @@ class SynchronousClient
   }
 
  protected:
-  // WaitToIssue returns false if we realize that we need to break out
-  bool WaitToIssue(int thread_idx) {
+  // WaitToIssue returns false if we realize that we need to break out.
+  // Otherwise it sets *start to the time latency should be measured from: in
+  // open loop mode, the intended issue time, so that falling behind the
+  // offered load is not hidden (coordinated omission).
+  bool WaitToIssue(int thread_idx, double* start) {
     if (!closed_loop_) {
       const gpr_timespec next_issue_time = NextIssueTime(thread_idx);
+      *start = UsageTimer::ToTimescale(next_issue_time);
       // Avoid sleeping for too long continuously because we might
       // need to terminate before then. This is an issue since
       // exponential distribution can occasionally produce bad outliers
@@ -103,6 +107,7 @@ class SynchronousClient
         }
       }
     }
+    *start = UsageTimer::Now();
     return true;
   }
 
@@ -121,11 +126,11 @@ class SynchronousUnaryClient final : public SynchronousClient {
   bool InitThreadFuncImpl(size_t /*thread_idx*/) override { return true; }
 
   bool ThreadFuncImpl(HistogramEntry* entry, size_t thread_idx) override {
-    if (!WaitToIssue(thread_idx)) {
+    double start;
+    if (!WaitToIssue(thread_idx, &start)) {
       return true;
     }
     auto* stub = channels_[thread_idx % channels_.size()].get_stub();
-    double start = UsageTimer::Now();
     grpc::ClientContext context;
     grpc::Status s =
         stub->UnaryCall(&context, request_, &responses_[thread_idx]);
@@ -240,10 +245,10 @@ class SynchronousStreamingPingPongClient final
   }
 
   bool ThreadFuncImpl(HistogramEntry* entry, size_t thread_idx) override {
-    if (!WaitToIssue(thread_idx)) {
+    double start;
+    if (!WaitToIssue(thread_idx, &start)) {
       return true;
     }
-    double start = UsageTimer::Now();
     if (stream_[thread_idx]->Write(request_) &&
         stream_[thread_idx]->Read(&responses_[thread_idx])) {
       entry->set_value((UsageTimer::Now() - start) * 1e9);
@@ -300,7 +305,8 @@ class SynchronousStreamingFromClientClient final
 
   bool ThreadFuncImpl(HistogramEntry* entry, size_t thread_idx) override {
     // Figure out how to make histogram sensible if this is rate-paced
-    if (!WaitToIssue(thread_idx)) {
+    double issue_time;
+    if (!WaitToIssue(thread_idx, &issue_time)) {
       return true;
     }
     if (stream_[thread_idx]->Write(request_)) {
@@ -113,6 +113,12 @@ static double ServerTotalCpuTime(const ServerStats& s) {
 static double ServerIdleCpuTime(const ServerStats& s) {
   return s.idle_cpu_time();
 }
+static double ServerMemoryGrowth(const ServerStats& s) {
+  return s.memory_growth_bytes();
+}
+static double ChannelsConnected(const ClientStats& s) {
+  return s.channels_connected();
+}
 static int Cores(int n) { return n; }
 
 static bool IsSuccess(const Status& s) {
@@ -222,6 +228,24 @@ static void postprocess_scenario_result(ScenarioResult* result) {
       server_queries_per_cpu_sec);
   result->mutable_summary()->set_client_queries_per_cpu_sec(
       client_queries_per_cpu_sec);
+
+  // Connection scaling: how fast the clients connected and what each
+  // connected channel costs the servers in memory.
+  const double channels_connected =
+      sum(result->client_stats(), ChannelsConnected);
+  if (channels_connected > 0) {
+    double channel_connects_per_second = 0;
+    for (const auto& client_stat : result->client_stats()) {
+      if (client_stat.channel_connect_time() > 0) {
+        channel_connects_per_second += client_stat.channels_connected() /
+                                       client_stat.channel_connect_time();
+      }
+    }
+    result->mutable_summary()->set_client_channel_connects_per_second(
+        channel_connects_per_second);
+    result->mutable_summary()->set_server_memory_per_channel(
+        sum(result->server_stats(), ServerMemoryGrowth) / channels_connected);
+  }
 }
 
 struct ClientData {
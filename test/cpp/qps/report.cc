@@ -20,12 +20,16 @@
 
 #include <grpcpp/client_context.h>
 
+#include <math.h>
+#include <stdio.h>
+
 #include <fstream>
 
 #include "absl/log/absl_log.h"
 #include "src/core/util/crash.h"
 #include "src/proto/grpc/testing/report_qps_scenario_service.grpc.pb.h"
 #include "test/cpp/qps/driver.h"
+#include "test/cpp/qps/histogram.h"
 #include "test/cpp/qps/parse_json.h"
 #include "test/cpp/qps/stats.h"
 
@@ -78,6 +82,12 @@ void CompositeReporter::ReportQueriesPerCpuSec(const ScenarioResult& result) {
   }
 }
 
+void CompositeReporter::ReportChannelScaling(const ScenarioResult& result) {
+  for (size_t i = 0; i < reporters_.size(); ++i) {
+    reporters_[i]->ReportChannelScaling(result);
+  }
+}
+
 void GprLogReporter::ReportQPS(const ScenarioResult& result) {
   ABSL_LOG(INFO) << "QPS: " << result.summary().qps();
   if (result.summary().failed_requests_per_second() > 0) {
@@ -127,6 +137,13 @@ void GprLogReporter::ReportQueriesPerCpuSec(const ScenarioResult& result) {
             << result.summary().client_queries_per_cpu_sec();
 }
 
+void GprLogReporter::ReportChannelScaling(const ScenarioResult& result) {
+  ABSL_LOG(INFO) << "Client channel connects/sec: "
+                 << result.summary().client_channel_connects_per_second();
+  ABSL_LOG(INFO) << "Server memory/channel: "
+                 << result.summary().server_memory_per_channel() << " bytes";
+}
+
 void JsonReporter::ReportQPS(const ScenarioResult& result) {
   std::string json_string =
       SerializeJson(result, "type.googleapis.com/grpc.testing.ScenarioResult");
@@ -159,6 +176,86 @@ void JsonReporter::ReportQueriesPerCpuSec(const ScenarioResult& /*result*/) {
   // NOP - all reporting is handled by ReportQPS.
 }
 
+void JsonReporter::ReportChannelScaling(const ScenarioResult& /*result*/) {
+  // NOP - all reporting is handled by ReportQPS.
+}
+
+void HdrHistogramReporter::ReportQPS(const ScenarioResult& /*result*/) {
+  // NOP - all reporting is handled by ReportLatency.
+}
+
+void HdrHistogramReporter::ReportQPSPerCore(const ScenarioResult& /*result*/) {
+  // NOP - all reporting is handled by ReportLatency.
+}
+
+void HdrHistogramReporter::ReportLatency(const ScenarioResult& result) {
+  // Recorded latencies are in nanoseconds; write microseconds.
+  constexpr double kUnitScale = 1e3;
+  // Rows get finer towards the tail: each time the distance to 100% halves,
+  // another kTicksPerHalfDistance rows are written, as HdrHistogram does.
+  constexpr int kTicksPerHalfDistance = 5;
+  const HistogramData& data = result.latencies();
+  Histogram histogram;
+  histogram.MergeProto(data);
+  const double count = histogram.Count();
+  FILE* file = fopen(report_file_.c_str(), "w");
+  if (file == nullptr) {
+    ABSL_LOG(ERROR) << "Failed to open " << report_file_;
+    return;
+  }
+  auto write_row = [&](double percentile) {
+    const double value = histogram.Percentile(percentile) / kUnitScale;
+    const double fraction = percentile / 100;
+    fprintf(file, "%12.3f %14.12f %10.0f", value, fraction,
+            round(count * fraction));
+    if (fraction < 1) fprintf(file, " %14.2f", 1 / (1 - fraction));
+    fprintf(file, "\n");
+  };
+  fprintf(file, "%12s %14s %10s %14s\n\n", "Value", "Percentile", "TotalCount",
+          "1/(1-Percentile)");
+  if (count > 0) {
+    for (double remaining = 100;; remaining /= 2) {
+      for (int i = 0; i < kTicksPerHalfDistance; ++i) {
+        write_row(100 - remaining +
+                  remaining / 2 * i / kTicksPerHalfDistance);
+      }
+      // Stop once less than one recorded value lies beyond this half.
+      if (count * remaining / 200 < 1) break;
+    }
+    write_row(100);
+  }
+  const double mean = count > 0 ? data.sum() / count : 0;
+  const double variance =
+      count > 0 ? data.sum_of_squares() / count - mean * mean : 0;
+  fprintf(file, "#[Mean    = %12.3f, StdDeviation   = %12.3f]\n",
+          mean / kUnitScale, sqrt(variance > 0 ? variance : 0) / kUnitScale);
+  fprintf(file, "#[Max     = %12.3f, Total count    = %12.0f]\n",
+          data.max_seen() / kUnitScale, count);
+  fclose(file);
+}
+
+void HdrHistogramReporter::ReportTimes(const ScenarioResult& /*result*/) {
+  // NOP - all reporting is handled by ReportLatency.
+}
+
+void HdrHistogramReporter::ReportCpuUsage(const ScenarioResult& /*result*/) {
+  // NOP - all reporting is handled by ReportLatency.
+}
+
+void HdrHistogramReporter::ReportPollCount(const ScenarioResult& /*result*/) {
+  // NOP - all reporting is handled by ReportLatency.
+}
+
+void HdrHistogramReporter::ReportQueriesPerCpuSec(
+    const ScenarioResult& /*result*/) {
+  // NOP - all reporting is handled by ReportLatency.
+}
+
+void HdrHistogramReporter::ReportChannelScaling(
+    const ScenarioResult& /*result*/) {
+  // NOP - all reporting is handled by ReportLatency.
+}
+
 void RpcReporter::ReportQPS(const ScenarioResult& result) {
   grpc::ClientContext context;
   grpc::Status status;
@@ -199,5 +296,9 @@ void RpcReporter::ReportQueriesPerCpuSec(const ScenarioResult& /*result*/) {
   // NOP - all reporting is handled by ReportQPS.
 }
 
+void RpcReporter::ReportChannelScaling(const ScenarioResult& /*result*/) {
+  // NOP - all reporting is handled by ReportQPS.
+}
+
 }  // namespace testing
 }  // namespace grpc
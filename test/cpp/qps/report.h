@@ -66,6 +66,9 @@ class Reporter {
   /// Reports queries per cpu-sec.
   virtual void ReportQueriesPerCpuSec(const ScenarioResult& result) = 0;
 
+  /// Reports channel connection rate and server memory per channel.
+  virtual void ReportChannelScaling(const ScenarioResult& result) = 0;
+
  private:
   const string name_;
 };
@@ -85,6 +88,7 @@ class CompositeReporter : public Reporter {
   void ReportCpuUsage(const ScenarioResult& result) override;
   void ReportPollCount(const ScenarioResult& result) override;
   void ReportQueriesPerCpuSec(const ScenarioResult& result) override;
+  void ReportChannelScaling(const ScenarioResult& result) override;
 
  private:
   std::vector<std::unique_ptr<Reporter> > reporters_;
@@ -103,6 +107,7 @@ class GprLogReporter : public Reporter {
   void ReportCpuUsage(const ScenarioResult& result) override;
   void ReportPollCount(const ScenarioResult& result) override;
   void ReportQueriesPerCpuSec(const ScenarioResult& result) override;
+  void ReportChannelScaling(const ScenarioResult& result) override;
 };
 
 /// Dumps the report to a JSON file.
@@ -119,6 +124,28 @@ class JsonReporter : public Reporter {
   void ReportCpuUsage(const ScenarioResult& result) override;
   void ReportPollCount(const ScenarioResult& result) override;
   void ReportQueriesPerCpuSec(const ScenarioResult& result) override;
+  void ReportChannelScaling(const ScenarioResult& result) override;
+
+  const string report_file_;
+};
+
+/// Writes the merged latency distribution, in microseconds, to a file in
+/// HdrHistogram's percentile distribution format, so that it can be plotted
+/// and compared with the usual HdrHistogram tooling.
+class HdrHistogramReporter : public Reporter {
+ public:
+  HdrHistogramReporter(const string& name, const string& report_file)
+      : Reporter(name), report_file_(report_file) {}
+
+ private:
+  void ReportQPS(const ScenarioResult& result) override;
+  void ReportQPSPerCore(const ScenarioResult& result) override;
+  void ReportLatency(const ScenarioResult& result) override;
+  void ReportTimes(const ScenarioResult& result) override;
+  void ReportCpuUsage(const ScenarioResult& result) override;
+  void ReportPollCount(const ScenarioResult& result) override;
+  void ReportQueriesPerCpuSec(const ScenarioResult& result) override;
+  void ReportChannelScaling(const ScenarioResult& result) override;
 
   const string report_file_;
 };
@@ -136,6 +163,7 @@ class RpcReporter : public Reporter {
   void ReportCpuUsage(const ScenarioResult& result) override;
   void ReportPollCount(const ScenarioResult& result) override;
   void ReportQueriesPerCpuSec(const ScenarioResult& result) override;
+  void ReportChannelScaling(const ScenarioResult& result) override;
 
   std::unique_ptr<ReportQpsScenarioService::Stub> stub_;
 };
@@ -42,7 +42,9 @@ namespace testing {
 class Server {
  public:
   explicit Server(const ServerConfig& config)
-      : timer_(new UsageTimer), last_reset_poll_count_(0) {
+      : timer_(new UsageTimer),
+        last_reset_poll_count_(0),
+        start_memory_bytes_(UsageTimer::ResidentMemoryBytes()) {
     cores_ = gpr_cpu_num_cores();
     if (config.port()) {  // positive for a fixed port, negative for inproc
       port_ = config.port();
@@ -72,6 +74,10 @@ class Server {
     stats.set_total_cpu_time(timer_result.total_cpu_time);
     stats.set_idle_cpu_time(timer_result.idle_cpu_time);
     stats.set_cq_poll_count(poll_count);
+    const unsigned long long memory_bytes = UsageTimer::ResidentMemoryBytes();
+    if (memory_bytes > start_memory_bytes_) {
+      stats.set_memory_growth_bytes(memory_bytes - start_memory_bytes_);
+    }
     return stats;
   }
 
@@ -145,6 +151,8 @@ class Server {
   int cores_;
   std::unique_ptr<UsageTimer> timer_;
   int last_reset_poll_count_;
+  // Baseline for reporting the memory taken by connections and calls.
+  const unsigned long long start_memory_bytes_;
 };
 
 std::unique_ptr<Server> CreateSynchronousServer(const ServerConfig& config);
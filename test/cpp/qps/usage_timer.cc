@@ -29,6 +29,7 @@
 #ifdef __linux__
 #include <sys/resource.h>
 #include <sys/time.h>
+#include <unistd.h>
 
 static double time_double(struct timeval* tv) {
   return tv->tv_sec + (1e-6 * tv->tv_usec);
@@ -42,6 +43,24 @@ double UsageTimer::Now() {
   return ts.tv_sec + (1e-9 * ts.tv_nsec);
 }
 
+double UsageTimer::ToTimescale(gpr_timespec time) {
+  auto ts = gpr_convert_clock_type(time, GPR_CLOCK_REALTIME);
+  return ts.tv_sec + (1e-9 * ts.tv_nsec);
+}
+
+unsigned long long UsageTimer::ResidentMemoryBytes() {
+#ifdef __linux__
+  // The second field of /proc/self/statm is the resident set size in pages.
+  std::ifstream proc_statm("/proc/self/statm");
+  unsigned long long size_pages = 0;
+  unsigned long long resident_pages = 0;
+  if (!(proc_statm >> size_pages >> resident_pages)) return 0;
+  return resident_pages * sysconf(_SC_PAGESIZE);
+#else
+  return 0;
+#endif
+}
+
 static void get_resource_usage(double* utime, double* stime) {
 #ifdef __linux__
   struct rusage usage;
@@ -19,6 +19,8 @@
 #ifndef GRPC_TEST_CPP_QPS_USAGE_TIMER_H
 #define GRPC_TEST_CPP_QPS_USAGE_TIMER_H
 
+#include <grpc/support/time.h>
+
 class UsageTimer {
  public:
   UsageTimer();
@@ -34,6 +36,11 @@ class UsageTimer {
   Result Mark() const;
 
   static double Now();
+  // Converts \a time, on any clock, to the timescale of Now().
+  static double ToTimescale(gpr_timespec time);
+
+  // Resident set size of this process in bytes, or 0 where unsupported.
+  static unsigned long long ResidentMemoryBytes();
 
  private:
   static Result Sample();
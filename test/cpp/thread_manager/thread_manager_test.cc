@@ -56,6 +56,9 @@ struct TestThreadManagerSettings {
 
   // How many should be instantiated
   int thread_manager_count;
+
+  // Whether to call EnableAdaptiveSizing()
+  bool adaptive_sizing;
 };
 
 class TestThreadManager final : public grpc::ThreadManager {
@@ -137,6 +140,7 @@ class ThreadManagerTest
     }
     grpc_resource_quota_unref(rq);
     for (auto& tm : thread_manager_) {
+      if (GetParam().adaptive_sizing) tm->EnableAdaptiveSizing();
       tm->Initialize();
     }
     for (auto& tm : thread_manager_) {
@@ -150,10 +154,15 @@ class ThreadManagerTest
 TestThreadManagerSettings scenarios[] = {
     {2 /* min_pollers */, 10 /* max_pollers */, 10 /* poll_duration_ms */,
      1 /* work_duration_ms */, 50 /* max_poll_calls */,
-     INT_MAX /* thread_limit */, 1 /* thread_manager_count */},
+     INT_MAX /* thread_limit */, 1 /* thread_manager_count */,
+     false /* adaptive_sizing */},
     {1 /* min_pollers */, 1 /* max_pollers */, 1 /* poll_duration_ms */,
      10 /* work_duration_ms */, 50 /* max_poll_calls */, 3 /* thread_limit */,
-     2 /* thread_manager_count */}};
+     2 /* thread_manager_count */, false /* adaptive_sizing */},
+    {1 /* min_pollers */, 10 /* max_pollers */, 1 /* poll_duration_ms */,
+     10 /* work_duration_ms */, 200 /* max_poll_calls */,
+     INT_MAX /* thread_limit */, 1 /* thread_manager_count */,
+     true /* adaptive_sizing */}};
 
 INSTANTIATE_TEST_SUITE_P(ThreadManagerTest, ThreadManagerTest,
                          ::testing::ValuesIn(scenarios));
@@ -1063,10 +1063,12 @@ include/grpcpp/server_builder.h \
 include/grpcpp/server_context.h \
 include/grpcpp/server_interface.h \
 include/grpcpp/server_posix.h \
+include/grpcpp/support/arena_message_allocator.h \
 include/grpcpp/support/async_stream.h \
 include/grpcpp/support/async_unary_call.h \
 include/grpcpp/support/byte_buffer.h \
 include/grpcpp/support/callback_common.h \
+include/grpcpp/support/callback_coroutine.h \
 include/grpcpp/support/channel_arguments.h \
 include/grpcpp/support/client_callback.h \
 include/grpcpp/support/client_interceptor.h \
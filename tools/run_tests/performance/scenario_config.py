@@ -147,6 +147,7 @@ def _ping_pong_scenario(
     excluded_poll_engines=None,
     minimal_stack=False,
     offered_load=None,
+    idle_channels=None,
 ):
     """Creates a basic ping pong scenario."""
     scenario = {
@@ -239,6 +240,11 @@ def _ping_pong_scenario(
 
     if messages_per_stream:
         scenario["client_config"]["messages_per_stream"] = messages_per_stream
+    if idle_channels:
+        # connected once at client setup, on top of the channels running RPCs
+        scenario["client_config"]["idle_client_channels"] = idle_channels
+        if num_clients is not None:
+            scenario["num_clients"] = num_clients
     if client_language:
         # the CLIENT_LANGUAGE field is recognized by run_performance_tests.py
         scenario["CLIENT_LANGUAGE"] = client_language
@@ -320,6 +326,42 @@ class CXXLanguage(Language):
             warmup_seconds=CXX_WARMUP_SECONDS,
         )
 
+        # Connection scaling: a single active channel next to 20k idle ones on
+        # each of 5 clients (100k connections in total), reporting server
+        # memory per connection and client connect rate.
+        yield _ping_pong_scenario(
+            "cpp_protobuf_async_unary_ping_pong_insecure_100k_idle_channels",
+            rpc_type="UNARY",
+            client_type="ASYNC_CLIENT",
+            server_type="ASYNC_SERVER",
+            secure=False,
+            async_server_threads=1,
+            idle_channels=20000,
+            num_clients=5,
+            categories=[SWEEP],
+            warmup_seconds=CXX_WARMUP_SECONDS,
+        )
+
+        # Channel scaling: 10k channels per client all running RPCs. The
+        # secure variant also measures TLS handshake throughput, since all
+        # channels connect at once.
+        for secure in [True, False]:
+            secstr = "secure" if secure else "insecure"
+            yield _ping_pong_scenario(
+                "cpp_protobuf_async_unary_qps_unconstrained_%s_10k_channels"
+                % secstr,
+                rpc_type="UNARY",
+                client_type="ASYNC_CLIENT",
+                server_type="ASYNC_SERVER",
+                unconstrained_client="async",
+                outstanding=10000,
+                channels=10000,
+                num_clients=1,
+                secure=secure,
+                categories=[SWEEP],
+                warmup_seconds=CXX_WARMUP_SECONDS,
+            )
+
         # Scenario was added in https://github.com/grpc/grpc/pull/12987, but its purpose is unclear
         # (beyond exercising some params that other scenarios don't)
         yield _ping_pong_scenario(